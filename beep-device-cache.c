@@ -0,0 +1,213 @@
+/* beep-device-cache.c - cache the detected device across invocations
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Without --device, beep probes all the default devices of all
+ * drivers until one works, paying for every failed probe first.
+ *
+ * After a successful probe, the driver name, the device file name
+ * and the identity of the device (device number and inode) are
+ * stored in $XDG_RUNTIME_DIR/beep-device, three lines of text:
+ *
+ *   console
+ *   /dev/tty0
+ *   4:0 1045
+ *
+ * The next beep opens that device file directly, and uses it if a
+ * single fstat(2) shows it is still the same device.  Otherwise, it
+ * falls back to probing and rewrites the cache.
+ *
+ * Only drivers whose whole state is the device fd are cached, as the
+ * cached device is used without running the driver's detect function.
+ */
+
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+
+#include "beep-device-cache.h"
+
+#include "beep-drivers.h"
+#include "beep-library.h"
+#include "beep-log.h"
+
+
+static
+bool device_cache_file_name(char *const buf, const size_t size)
+{
+    const char *const runtime_dir = getenv("XDG_RUNTIME_DIR");
+    if ((!runtime_dir) || (runtime_dir[0] != '/')) {
+        return false;
+    }
+    const int len = snprintf(buf, size, "%s/%s",
+                             runtime_dir, BEEP_DEVICE_CACHE_NAME);
+    return (len > 0) && ((size_t)len < size);
+}
+
+
+beep_driver *beep_device_cache_detect(void)
+{
+    char cache_name[PATH_MAX];
+    if (!device_cache_file_name(cache_name, sizeof(cache_name))) {
+        return NULL;
+    }
+
+    const int cache_fd = COUNT_SYSCALL(open(cache_name, O_RDONLY|O_CLOEXEC));
+    if (cache_fd == -1) {
+        log_verbose("device cache: could not open(2) %s: %s",
+                    cache_name, strerror(errno));
+        return NULL;
+    }
+    char buf[PATH_MAX + 128];
+    const ssize_t len = COUNT_SYSCALL(read(cache_fd, buf, sizeof(buf) - 1));
+    COUNT_SYSCALL(close(cache_fd));
+    if (len <= 0) {
+        return NULL;
+    }
+    buf[len] = '\0';
+
+    /* driver name, device file name, "major:minor inode" */
+    char *const driver_name = buf;
+    char *const driver_end = strchr(driver_name, '\n');
+    if (!driver_end) {
+        log_verbose("device cache: %s is invalid", cache_name);
+        return NULL;
+    }
+    *driver_end = '\0';
+    char *const device = driver_end + 1;
+    char *const device_end = strchr(device, '\n');
+    if ((!device_end) || (device[0] != '/')) {
+        log_verbose("device cache: %s is invalid", cache_name);
+        return NULL;
+    }
+    *device_end = '\0';
+    unsigned int dev_major, dev_minor;
+    unsigned long long ino;
+    if (3 != sscanf(device_end + 1, "%u:%u %llu",
+                    &dev_major, &dev_minor, &ino)) {
+        log_verbose("device cache: %s is invalid", cache_name);
+        return NULL;
+    }
+
+    /* The driver instance keeps pointing to the device name */
+    static char device_name[PATH_MAX];
+    if (strlen(device) >= sizeof(device_name)) {
+        return NULL;
+    }
+    strcpy(device_name, device);
+
+    const int fd = COUNT_SYSCALL(open(device_name, O_WRONLY));
+    if (fd == -1) {
+        log_verbose("device cache: could not open(2) %s: %s",
+                    device_name, strerror(errno));
+        return NULL;
+    }
+
+    struct stat sb;
+    if ((-1 == COUNT_SYSCALL(fstat(fd, &sb))) || (!S_ISCHR(sb.st_mode))
+        || (sb.st_rdev != makedev(dev_major, dev_minor))
+        || (sb.st_ino != (ino_t)ino)) {
+        log_verbose("device cache: %s is not the cached device",
+                    device_name);
+        COUNT_SYSCALL(close(fd));
+        return NULL;
+    }
+
+    beep_driver *const driver =
+        beep_drivers_adopt(driver_name, fd, device_name);
+    if (!driver) {
+        log_verbose("device cache: no driver named %s", driver_name);
+        COUNT_SYSCALL(close(fd));
+        return NULL;
+    }
+    log_verbose("device cache: using %s on %s", driver_name, device_name);
+    return driver;
+}
+
+
+void beep_device_cache_store(const beep_driver *const driver)
+{
+    if (driver->driver_data) {
+        /* The driver needs its detect function to set up its state */
+        return;
+    }
+
+    char cache_name[PATH_MAX];
+    if (!device_cache_file_name(cache_name, sizeof(cache_name))) {
+        return;
+    }
+
+    struct stat sb;
+    if ((-1 == COUNT_SYSCALL(fstat(driver->device_fd, &sb)))
+        || (!S_ISCHR(sb.st_mode))) {
+        return;
+    }
+
+    char buf[PATH_MAX + 128];
+    const int len = snprintf(buf, sizeof(buf), "%s\n%s\n%u:%u %llu\n",
+                             driver->name, driver->device_name,
+                             major(sb.st_rdev), minor(sb.st_rdev),
+                             (unsigned long long)sb.st_ino);
+    if ((len <= 0) || ((size_t)len >= sizeof(buf))) {
+        return;
+    }
+
+    /* Write a temporary file and rename(2) it, so that concurrent
+     * beeps never read a partially written cache.
+     */
+    char tmp_name[PATH_MAX + 32];
+    snprintf(tmp_name, sizeof(tmp_name), "%s.%ld",
+             cache_name, (long)getpid());
+    const int fd = COUNT_SYSCALL(open(tmp_name,
+                                      O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC,
+                                      0600));
+    if (fd == -1) {
+        log_verbose("device cache: could not open(2) %s: %s",
+                    tmp_name, strerror(errno));
+        return;
+    }
+    const int write_ret = write_all(fd, buf, (size_t)len);
+    COUNT_SYSCALL(close(fd));
+    if ((write_ret == -1)
+        || (-1 == COUNT_SYSCALL(rename(tmp_name, cache_name)))) {
+        log_verbose("device cache: could not write %s: %s",
+                    cache_name, strerror(errno));
+        COUNT_SYSCALL(unlink(tmp_name));
+        return;
+    }
+    log_verbose("device cache: stored %s on %s",
+                driver->name, driver->device_name);
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
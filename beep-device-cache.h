@@ -0,0 +1,51 @@
+/* beep-device-cache.h - interface to the cache of the detected device
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_DEVICE_CACHE_H
+#define BEEP_DEVICE_CACHE_H
+
+
+#include "beep-driver.h"
+
+
+/** Name of the cache file in $XDG_RUNTIME_DIR */
+#define BEEP_DEVICE_CACHE_NAME "beep-device"
+
+
+/** Open the device cached by a previous beep_device_cache_store().
+ *
+ * Returns NULL if there is no cache, or if the device file is not the
+ * very device (same device number and inode) which has been cached.
+ */
+beep_driver *beep_device_cache_detect(void);
+
+/** Cache the device of a driver instance found by full probing. */
+void beep_device_cache_store(const beep_driver *const driver)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_DEVICE_CACHE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
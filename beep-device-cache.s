@@ -0,0 +1,5548 @@
+	.file	"beep-device-cache.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-device-cache.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"XDG_RUNTIME_DIR"
+.LC1:
+	.string	"%s/%s"
+.LC2:
+	.string	"beep-device"
+	.text
+	.type	device_cache_file_name, @function
+device_cache_file_name:
+.LVL0:
+.LFB70:
+	.file 1 "beep-device-cache.c"
+	.loc 1 62 1 view -0
+	.cfi_startproc
+	.loc 1 62 1 is_stmt 0 view .LVU1
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	.loc 1 63 5 is_stmt 1 view .LVU2
+	.loc 1 63 37 is_stmt 0 view .LVU3
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 63 37 view .LVU4
+	call	getenv@PLT
+.LVL2:
+	.loc 1 64 5 is_stmt 1 view .LVU5
+	.loc 1 64 8 is_stmt 0 view .LVU6
+	testq	%rax, %rax
+	je	.L4
+	movq	%rax, %r9
+	.loc 1 65 15 discriminator 1 view .LVU7
+	movl	$0, %eax
+.LVL3:
+	.loc 1 64 24 discriminator 1 view .LVU8
+	cmpb	$47, (%r9)
+	je	.L8
+.LVL4:
+.L1:
+	.loc 1 70 1 view .LVU9
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL5:
+	.loc 1 70 1 view .LVU10
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL6:
+	.loc 1 70 1 view .LVU11
+	ret
+.LVL7:
+.L8:
+	.cfi_restore_state
+	.loc 1 67 5 is_stmt 1 view .LVU12
+.LBB24:
+.LBI24:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdio2.h"
+	.loc 2 51 42 view .LVU13
+.LBB25:
+	.loc 2 54 3 view .LVU14
+	.loc 2 54 10 is_stmt 0 view .LVU15
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	leaq	.LC2(%rip), %rax
+	pushq	%rax
+	.cfi_def_cfa_offset 48
+	leaq	.LC1(%rip), %r8
+	movq	$-1, %rcx
+	movl	$1, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	__snprintf_chk@PLT
+.LVL8:
+	.loc 2 54 10 view .LVU16
+	movl	%eax, %edx
+.LVL9:
+	.loc 2 54 10 view .LVU17
+.LBE25:
+.LBE24:
+	.loc 1 69 5 is_stmt 1 view .LVU18
+	.loc 1 69 22 is_stmt 0 view .LVU19
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	movl	$0, %eax
+.LVL10:
+	.loc 1 69 22 view .LVU20
+	testl	%edx, %edx
+	jle	.L3
+	.loc 1 69 26 discriminator 1 view .LVU21
+	movslq	%edx, %rdx
+	.loc 1 69 22 discriminator 1 view .LVU22
+	cmpq	%rbx, %rdx
+	setb	%al
+	movzbl	%al, %eax
+.LVL11:
+.L3:
+	.loc 1 69 22 discriminator 6 view .LVU23
+	andl	$1, %eax
+	jmp	.L1
+.LVL12:
+.L4:
+	.loc 1 65 15 view .LVU24
+	movl	$0, %eax
+.LVL13:
+	.loc 1 65 15 view .LVU25
+	jmp	.L1
+	.cfi_endproc
+.LFE70:
+	.size	device_cache_file_name, .-device_cache_file_name
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"device cache: could not open(2) %s: %s"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"device cache: %s is invalid"
+.LC5:
+	.string	"%u:%u %llu"
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"device cache: %s is not the cached device"
+	.align 8
+.LC7:
+	.string	"device cache: no driver named %s"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"device cache: using %s on %s"
+	.text
+	.globl	beep_device_cache_detect
+	.type	beep_device_cache_detect, @function
+beep_device_cache_detect:
+.LFB71:
+	.loc 1 74 1 is_stmt 1 view -0
+	.cfi_startproc
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4120
+	orq	$0, (%rsp)
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 8216
+	orq	$0, (%rsp)
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 8528
+	.loc 1 74 1 is_stmt 0 view .LVU27
+	movq	%fs:40, %rax
+	movq	%rax, 8488(%rsp)
+	xorl	%eax, %eax
+	.loc 1 75 5 is_stmt 1 view .LVU28
+	.loc 1 76 5 view .LVU29
+	.loc 1 76 10 is_stmt 0 view .LVU30
+	leaq	160(%rsp), %rdi
+	movl	$4096, %esi
+	call	device_cache_file_name
+.LVL14:
+	.loc 1 77 15 view .LVU31
+	movl	$0, %ebx
+	.loc 1 76 8 view .LVU32
+	testb	%al, %al
+	je	.L9
+	.loc 1 80 5 is_stmt 1 view .LVU33
+	.loc 1 80 27 is_stmt 0 view .LVU34
+	addl	$1, syscall_count(%rip)
+.LVL15:
+.LBB26:
+.LBI26:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 3 41 1 is_stmt 1 view .LVU35
+.LBB27:
+	.loc 3 43 3 view .LVU36
+	.loc 3 46 3 view .LVU37
+	.loc 3 48 7 view .LVU38
+	.loc 3 53 7 view .LVU39
+	.loc 3 53 14 is_stmt 0 view .LVU40
+	leaq	160(%rsp), %rdi
+.LVL16:
+	.loc 3 53 14 view .LVU41
+	movl	$524288, %esi
+	movl	$0, %eax
+	call	open@PLT
+.LVL17:
+	.loc 3 53 14 view .LVU42
+	movl	%eax, %ebx
+.LVL18:
+	.loc 3 53 14 view .LVU43
+.LBE27:
+.LBE26:
+	.loc 1 81 5 is_stmt 1 view .LVU44
+	.loc 1 81 8 is_stmt 0 view .LVU45
+	cmpl	$-1, %eax
+	je	.L31
+	.loc 1 86 5 is_stmt 1 view .LVU46
+	.loc 1 87 5 view .LVU47
+	.loc 1 87 26 is_stmt 0 view .LVU48
+	addl	$1, syscall_count(%rip)
+.LVL19:
+.LBB28:
+.LBI28:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/unistd.h"
+	.loc 4 36 1 is_stmt 1 view .LVU49
+.LBB29:
+	.loc 4 38 3 view .LVU50
+	.loc 4 38 469 is_stmt 0 view .LVU51
+	leaq	4256(%rsp), %rsi
+.LVL20:
+	.loc 4 38 469 view .LVU52
+	movl	$4223, %edx
+	movl	%eax, %edi
+	call	read@PLT
+.LVL21:
+	.loc 4 38 469 view .LVU53
+	movq	%rax, %rbp
+.LVL22:
+	.loc 4 38 469 view .LVU54
+.LBE29:
+.LBE28:
+	.loc 1 88 5 is_stmt 1 view .LVU55
+	.loc 1 88 6 is_stmt 0 view .LVU56
+	addl	$1, syscall_count(%rip)
+	.loc 1 88 24 view .LVU57
+	movl	%ebx, %edi
+	call	close@PLT
+.LVL23:
+	.loc 1 89 5 is_stmt 1 view .LVU58
+	.loc 1 89 8 is_stmt 0 view .LVU59
+	testq	%rbp, %rbp
+	jle	.L25
+	.loc 1 92 5 is_stmt 1 view .LVU60
+	.loc 1 92 14 is_stmt 0 view .LVU61
+	movb	$0, 4256(%rsp,%rbp)
+	.loc 1 95 5 is_stmt 1 view .LVU62
+.LVL24:
+	.loc 1 96 5 view .LVU63
+	.loc 1 96 30 is_stmt 0 view .LVU64
+	leaq	4256(%rsp), %rdi
+.LVL25:
+	.loc 1 96 30 view .LVU65
+	movl	$10, %esi
+	call	strchr@PLT
+.LVL26:
+	.loc 1 96 30 view .LVU66
+	movq	%rax, %rbx
+.LVL27:
+	.loc 1 97 5 is_stmt 1 view .LVU67
+	.loc 1 97 8 is_stmt 0 view .LVU68
+	testq	%rax, %rax
+	je	.L32
+	.loc 1 101 5 is_stmt 1 view .LVU69
+	.loc 1 101 17 is_stmt 0 view .LVU70
+	movb	$0, (%rax)
+	.loc 1 102 5 is_stmt 1 view .LVU71
+	.loc 1 102 17 is_stmt 0 view .LVU72
+	leaq	1(%rax), %rbp
+.LVL28:
+	.loc 1 103 5 is_stmt 1 view .LVU73
+	.loc 1 103 30 is_stmt 0 view .LVU74
+	movl	$10, %esi
+	movq	%rbp, %rdi
+	call	strchr@PLT
+.LVL29:
+	.loc 1 104 5 is_stmt 1 view .LVU75
+	.loc 1 104 8 is_stmt 0 view .LVU76
+	testq	%rax, %rax
+	je	.L13
+	.loc 1 104 23 discriminator 1 view .LVU77
+	cmpb	$47, 1(%rbx)
+	jne	.L13
+	.loc 1 108 5 is_stmt 1 view .LVU78
+	.loc 1 108 17 is_stmt 0 view .LVU79
+	movb	$0, (%rax)
+	.loc 1 109 5 is_stmt 1 view .LVU80
+	.loc 1 110 5 view .LVU81
+	.loc 1 111 5 view .LVU82
+	.loc 1 111 14 is_stmt 0 view .LVU83
+	leaq	4(%rsp), %rcx
+	movq	%rsp, %rdx
+	leaq	1(%rax), %rdi
+	leaq	8(%rsp), %r8
+	leaq	.LC5(%rip), %rsi
+	movl	$0, %eax
+.LVL30:
+	.loc 1 111 14 view .LVU84
+	call	__isoc99_sscanf@PLT
+.LVL31:
+	.loc 1 111 8 view .LVU85
+	cmpl	$3, %eax
+	jne	.L33
+	.loc 1 118 5 is_stmt 1 view .LVU86
+	.loc 1 119 5 view .LVU87
+	.loc 1 119 9 is_stmt 0 view .LVU88
+	movq	%rbp, %rdi
+	call	strlen@PLT
+.LVL32:
+	.loc 1 120 15 view .LVU89
+	movl	$0, %ebx
+.LVL33:
+	.loc 1 119 8 view .LVU90
+	cmpq	$4095, %rax
+	ja	.L9
+	.loc 1 122 5 is_stmt 1 view .LVU91
+.LVL34:
+.LBB30:
+.LBI30:
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/string_fortified.h"
+	.loc 5 77 42 view .LVU92
+.LBB31:
+	.loc 5 79 3 view .LVU93
+	.loc 5 79 10 is_stmt 0 view .LVU94
+	movl	$4096, %edx
+	movq	%rbp, %rsi
+	leaq	device_name.0(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__strcpy_chk@PLT
+.LVL35:
+	.loc 5 79 10 view .LVU95
+.LBE31:
+.LBE30:
+	.loc 1 124 5 is_stmt 1 view .LVU96
+	.loc 1 124 21 is_stmt 0 view .LVU97
+	addl	$1, syscall_count(%rip)
+.LVL36:
+.LBB32:
+.LBI32:
+	.loc 3 41 1 is_stmt 1 view .LVU98
+.LBB33:
+	.loc 3 43 3 view .LVU99
+	.loc 3 46 3 view .LVU100
+	.loc 3 48 7 view .LVU101
+	.loc 3 53 7 view .LVU102
+	.loc 3 53 14 is_stmt 0 view .LVU103
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL37:
+	movl	%eax, %ebp
+.LVL38:
+	.loc 3 53 14 view .LVU104
+.LBE33:
+.LBE32:
+	.loc 1 125 5 is_stmt 1 view .LVU105
+	.loc 1 125 8 is_stmt 0 view .LVU106
+	cmpl	$-1, %eax
+	je	.L34
+	.loc 1 131 5 is_stmt 1 view .LVU107
+	.loc 1 132 5 view .LVU108
+	.loc 1 132 17 is_stmt 0 view .LVU109
+	addl	$1, syscall_count(%rip)
+	.loc 1 132 35 view .LVU110
+	leaq	16(%rsp), %rsi
+	movl	%eax, %edi
+	call	fstat@PLT
+.LVL39:
+	.loc 1 132 8 view .LVU111
+	cmpl	$-1, %eax
+	je	.L17
+	.loc 1 132 54 discriminator 1 view .LVU112
+	movl	40(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 132 53 discriminator 1 view .LVU113
+	cmpl	$8192, %eax
+	jne	.L17
+	.loc 1 133 26 view .LVU114
+	movl	4(%rsp), %eax
+.LVL40:
+.LBB34:
+.LBI34:
+	.file 6 "/usr/include/x86_64-linux-gnu/sys/sysmacros.h"
+	.loc 6 43 141 is_stmt 1 view .LVU115
+.LBB35:
+	.loc 6 43 204 view .LVU116
+	.loc 6 43 219 view .LVU117
+	.loc 6 43 248 is_stmt 0 view .LVU118
+	movl	(%rsp), %edx
+	.loc 6 43 264 view .LVU119
+	movq	%rdx, %rcx
+	salq	$8, %rcx
+	.loc 6 43 225 view .LVU120
+	andl	$1048320, %ecx
+.LVL41:
+	.loc 6 43 271 is_stmt 1 view .LVU121
+	.loc 6 43 317 is_stmt 0 view .LVU122
+	salq	$32, %rdx
+	movabsq	$-17592186044416, %rsi
+	andq	%rsi, %rdx
+	.loc 6 43 277 view .LVU123
+	orq	%rcx, %rdx
+.LVL42:
+	.loc 6 43 325 is_stmt 1 view .LVU124
+	.loc 6 43 371 is_stmt 0 view .LVU125
+	movzbl	%al, %ecx
+	.loc 6 43 331 view .LVU126
+	orq	%rcx, %rdx
+.LVL43:
+	.loc 6 43 378 is_stmt 1 view .LVU127
+	.loc 6 43 432 view .LVU128
+	.loc 6 43 424 is_stmt 0 view .LVU129
+	salq	$12, %rax
+	movabsq	$17592184995840, %rcx
+	andq	%rcx, %rax
+	.loc 6 43 384 view .LVU130
+	orq	%rdx, %rax
+.LBE35:
+.LBE34:
+	.loc 1 133 9 view .LVU131
+	cmpq	%rax, 56(%rsp)
+	jne	.L17
+	.loc 1 134 9 view .LVU132
+	movq	8(%rsp), %rax
+	cmpq	%rax, 24(%rsp)
+	jne	.L17
+	.loc 1 141 5 is_stmt 1 view .LVU133
+	.loc 1 142 9 is_stmt 0 view .LVU134
+	leaq	4256(%rsp), %rdi
+.LVL44:
+	.loc 1 142 9 view .LVU135
+	leaq	device_name.0(%rip), %rdx
+	movl	%ebp, %esi
+	call	beep_drivers_adopt@PLT
+.LVL45:
+	.loc 1 142 9 view .LVU136
+	movq	%rax, %rbx
+.LVL46:
+	.loc 1 143 5 is_stmt 1 view .LVU137
+	.loc 1 143 8 is_stmt 0 view .LVU138
+	testq	%rax, %rax
+	je	.L35
+	.loc 1 148 5 is_stmt 1 view .LVU139
+	.loc 1 148 10 view .LVU140
+	.loc 1 148 13 is_stmt 0 view .LVU141
+	cmpl	$0, log_level(%rip)
+	jle	.L9
+	.loc 1 148 46 is_stmt 1 discriminator 1 view .LVU142
+	leaq	4256(%rsp), %rsi
+.LVL47:
+	.loc 1 148 46 is_stmt 0 discriminator 1 view .LVU143
+	leaq	device_name.0(%rip), %rdx
+	leaq	.LC8(%rip), %rdi
+	movl	$0, %eax
+.LVL48:
+	.loc 1 148 46 discriminator 1 view .LVU144
+	call	log_verbose@PLT
+.LVL49:
+	.loc 1 148 46 discriminator 1 view .LVU145
+	jmp	.L9
+.LVL50:
+.L31:
+	.loc 1 82 9 is_stmt 1 view .LVU146
+	.loc 1 82 14 view .LVU147
+	.loc 1 84 15 is_stmt 0 view .LVU148
+	movl	$0, %ebx
+	.loc 1 82 17 view .LVU149
+	cmpl	$0, log_level(%rip)
+	jle	.L9
+	.loc 1 82 50 is_stmt 1 discriminator 1 view .LVU150
+	.loc 1 82 10 is_stmt 0 discriminator 1 view .LVU151
+	call	__errno_location@PLT
+.LVL51:
+	.loc 1 82 50 discriminator 1 view .LVU152
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL52:
+	movq	%rax, %rdx
+	leaq	160(%rsp), %rsi
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL53:
+	jmp	.L9
+.LVL54:
+.L32:
+	.loc 1 98 9 is_stmt 1 view .LVU153
+	.loc 1 98 14 view .LVU154
+	.loc 1 98 17 is_stmt 0 view .LVU155
+	cmpl	$0, log_level(%rip)
+	jle	.L9
+	.loc 1 98 50 is_stmt 1 discriminator 1 view .LVU156
+	leaq	160(%rsp), %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+.LVL55:
+	.loc 1 98 50 is_stmt 0 discriminator 1 view .LVU157
+	call	log_verbose@PLT
+.LVL56:
+	jmp	.L9
+.LVL57:
+.L13:
+	.loc 1 105 9 is_stmt 1 view .LVU158
+	.loc 1 105 14 view .LVU159
+	.loc 1 106 15 is_stmt 0 view .LVU160
+	movl	$0, %ebx
+.LVL58:
+	.loc 1 105 17 view .LVU161
+	cmpl	$0, log_level(%rip)
+	jg	.L36
+.LVL59:
+.L9:
+	.loc 1 150 1 view .LVU162
+	movq	8488(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L37
+	movq	%rbx, %rax
+	addq	$8504, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL60:
+.L36:
+	.cfi_restore_state
+	.loc 1 105 50 is_stmt 1 discriminator 1 view .LVU163
+	leaq	160(%rsp), %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+.LVL61:
+	.loc 1 105 50 is_stmt 0 discriminator 1 view .LVU164
+	call	log_verbose@PLT
+.LVL62:
+	jmp	.L9
+.LVL63:
+.L33:
+	.loc 1 113 9 is_stmt 1 view .LVU165
+	.loc 1 113 14 view .LVU166
+	.loc 1 114 15 is_stmt 0 view .LVU167
+	movl	$0, %ebx
+.LVL64:
+	.loc 1 113 17 view .LVU168
+	cmpl	$0, log_level(%rip)
+	jle	.L9
+	.loc 1 113 50 is_stmt 1 discriminator 1 view .LVU169
+	leaq	160(%rsp), %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL65:
+	jmp	.L9
+.LVL66:
+.L34:
+	.loc 1 126 9 view .LVU170
+	.loc 1 126 14 view .LVU171
+	.loc 1 128 15 is_stmt 0 view .LVU172
+	movl	$0, %ebx
+	.loc 1 126 17 view .LVU173
+	cmpl	$0, log_level(%rip)
+	jle	.L9
+	.loc 1 126 50 is_stmt 1 discriminator 1 view .LVU174
+	.loc 1 126 10 is_stmt 0 discriminator 1 view .LVU175
+	call	__errno_location@PLT
+.LVL67:
+	.loc 1 126 50 discriminator 1 view .LVU176
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL68:
+	movq	%rax, %rdx
+	leaq	device_name.0(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL69:
+	jmp	.L9
+.L17:
+	.loc 1 135 9 is_stmt 1 view .LVU177
+	.loc 1 135 14 view .LVU178
+	.loc 1 135 17 is_stmt 0 view .LVU179
+	cmpl	$0, log_level(%rip)
+	jg	.L38
+.L19:
+	.loc 1 135 12 is_stmt 1 discriminator 3 view .LVU180
+	.loc 1 137 9 discriminator 3 view .LVU181
+	.loc 1 137 10 is_stmt 0 discriminator 3 view .LVU182
+	addl	$1, syscall_count(%rip)
+	.loc 1 137 28 discriminator 3 view .LVU183
+	movl	%ebp, %edi
+	call	close@PLT
+.LVL70:
+	.loc 1 138 9 is_stmt 1 discriminator 3 view .LVU184
+	.loc 1 138 15 is_stmt 0 discriminator 3 view .LVU185
+	movl	$0, %ebx
+	jmp	.L9
+.L38:
+	.loc 1 135 50 is_stmt 1 discriminator 1 view .LVU186
+	leaq	device_name.0(%rip), %rsi
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL71:
+	jmp	.L19
+.LVL72:
+.L35:
+	.loc 1 144 9 view .LVU187
+	.loc 1 144 14 view .LVU188
+	.loc 1 144 17 is_stmt 0 view .LVU189
+	cmpl	$0, log_level(%rip)
+	jg	.L39
+.LVL73:
+.L21:
+	.loc 1 144 12 is_stmt 1 discriminator 3 view .LVU190
+	.loc 1 145 9 discriminator 3 view .LVU191
+	.loc 1 145 10 is_stmt 0 discriminator 3 view .LVU192
+	addl	$1, syscall_count(%rip)
+	.loc 1 145 28 discriminator 3 view .LVU193
+	movl	%ebp, %edi
+	call	close@PLT
+.LVL74:
+	.loc 1 146 9 is_stmt 1 discriminator 3 view .LVU194
+	.loc 1 146 15 is_stmt 0 discriminator 3 view .LVU195
+	jmp	.L9
+.LVL75:
+.L39:
+	.loc 1 144 50 is_stmt 1 discriminator 1 view .LVU196
+	leaq	4256(%rsp), %rsi
+.LVL76:
+	.loc 1 144 50 is_stmt 0 discriminator 1 view .LVU197
+	leaq	.LC7(%rip), %rdi
+	movl	$0, %eax
+.LVL77:
+	.loc 1 144 50 discriminator 1 view .LVU198
+	call	log_verbose@PLT
+.LVL78:
+	.loc 1 144 50 discriminator 1 view .LVU199
+	jmp	.L21
+.LVL79:
+.L25:
+	.loc 1 90 15 view .LVU200
+	movl	$0, %ebx
+.LVL80:
+	.loc 1 90 15 view .LVU201
+	jmp	.L9
+.LVL81:
+.L37:
+	.loc 1 150 1 view .LVU202
+	call	__stack_chk_fail@PLT
+.LVL82:
+	.cfi_endproc
+.LFE71:
+	.size	beep_device_cache_detect, .-beep_device_cache_detect
+	.section	.rodata.str1.1
+.LC9:
+	.string	"%s\n%s\n%u:%u %llu\n"
+.LC10:
+	.string	"%s.%ld"
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"device cache: could not write %s: %s"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"device cache: stored %s on %s"
+	.text
+	.globl	beep_device_cache_store
+	.type	beep_device_cache_store, @function
+beep_device_cache_store:
+.LVL83:
+.LFB72:
+	.loc 1 154 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 154 1 is_stmt 0 view .LVU204
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4128
+	orq	$0, (%rsp)
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 8224
+	orq	$0, (%rsp)
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 12320
+	orq	$0, (%rsp)
+	subq	$320, %rsp
+	.cfi_def_cfa_offset 12640
+	.loc 1 154 1 view .LVU205
+	movq	%fs:40, %rax
+	movq	%rax, 12600(%rsp)
+	xorl	%eax, %eax
+	.loc 1 155 5 is_stmt 1 view .LVU206
+	.loc 1 155 8 is_stmt 0 view .LVU207
+	cmpq	$0, 104(%rdi)
+	je	.L50
+.LVL84:
+.L40:
+	.loc 1 205 1 view .LVU208
+	movq	12600(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L51
+	addq	$12608, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL85:
+.L50:
+	.cfi_restore_state
+	.loc 1 205 1 view .LVU209
+	movq	%rdi, %rbx
+	.loc 1 160 5 is_stmt 1 view .LVU210
+	.loc 1 161 5 view .LVU211
+	.loc 1 161 10 is_stmt 0 view .LVU212
+	leaq	144(%rsp), %rdi
+.LVL86:
+	.loc 1 161 10 view .LVU213
+	movl	$4096, %esi
+	call	device_cache_file_name
+.LVL87:
+	.loc 1 161 8 view .LVU214
+	testb	%al, %al
+	je	.L40
+	.loc 1 165 5 is_stmt 1 view .LVU215
+	.loc 1 166 5 view .LVU216
+	.loc 1 166 17 is_stmt 0 view .LVU217
+	addl	$1, syscall_count(%rip)
+	.loc 1 166 35 view .LVU218
+	movq	%rsp, %rsi
+	movl	88(%rbx), %edi
+	call	fstat@PLT
+.LVL88:
+	.loc 1 166 8 view .LVU219
+	cmpl	$-1, %eax
+	je	.L40
+	.loc 1 167 16 view .LVU220
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 167 9 view .LVU221
+	cmpl	$8192, %eax
+	jne	.L40
+	.loc 1 171 5 is_stmt 1 view .LVU222
+	.loc 1 172 5 view .LVU223
+	.loc 1 172 21 is_stmt 0 view .LVU224
+	movq	40(%rsp), %rax
+.LVL89:
+.LBB36:
+.LBI36:
+	.loc 6 42 146 is_stmt 1 view .LVU225
+.LBB37:
+	.loc 6 42 178 view .LVU226
+	.loc 6 42 200 view .LVU227
+	.loc 6 42 208 is_stmt 0 view .LVU228
+	movzbl	%al, %esi
+.LVL90:
+	.loc 6 42 258 is_stmt 1 view .LVU229
+	.loc 6 42 318 view .LVU230
+	.loc 6 42 318 is_stmt 0 view .LVU231
+.LBE37:
+.LBE36:
+.LBB39:
+.LBI39:
+	.loc 6 41 146 is_stmt 1 view .LVU232
+.LBB40:
+	.loc 6 41 178 view .LVU233
+	.loc 6 41 200 view .LVU234
+	.loc 6 41 251 is_stmt 0 view .LVU235
+	movq	%rax, %rcx
+	shrq	$8, %rcx
+	.loc 6 41 208 view .LVU236
+	andl	$4095, %ecx
+.LVL91:
+	.loc 6 41 258 is_stmt 1 view .LVU237
+	.loc 6 41 318 view .LVU238
+	.loc 6 41 318 is_stmt 0 view .LVU239
+.LBE40:
+.LBE39:
+.LBB42:
+.LBI42:
+	.loc 2 51 42 is_stmt 1 view .LVU240
+.LBB43:
+	.loc 2 54 3 view .LVU241
+	.loc 2 54 10 is_stmt 0 view .LVU242
+	leaq	8368(%rsp), %rdi
+.LVL92:
+	.loc 2 54 10 view .LVU243
+	pushq	8(%rsp)
+	.cfi_def_cfa_offset 12648
+.LBE43:
+.LBE42:
+.LBB46:
+.LBB38:
+	.loc 6 42 310 view .LVU244
+	movq	%rax, %rdx
+	shrq	$12, %rdx
+	movb	$0, %dl
+	.loc 6 42 266 view .LVU245
+	orl	%esi, %edx
+.LBE38:
+.LBE46:
+.LBB47:
+.LBB44:
+	.loc 2 54 10 view .LVU246
+	pushq	%rdx
+	.cfi_def_cfa_offset 12656
+.LBE44:
+.LBE47:
+.LBB48:
+.LBB41:
+	.loc 6 41 310 view .LVU247
+	shrq	$32, %rax
+	andl	$-4096, %eax
+	.loc 6 41 266 view .LVU248
+	orl	%ecx, %eax
+.LBE41:
+.LBE48:
+.LBB49:
+.LBB45:
+	.loc 2 54 10 view .LVU249
+	pushq	%rax
+	.cfi_def_cfa_offset 12664
+	pushq	96(%rbx)
+	.cfi_def_cfa_offset 12672
+	movq	(%rbx), %r9
+	leaq	.LC9(%rip), %r8
+	movl	$4224, %ecx
+	movl	$1, %edx
+	movl	$4224, %esi
+	movl	$0, %eax
+	call	__snprintf_chk@PLT
+.LVL93:
+	.loc 2 54 10 view .LVU250
+	movl	%eax, %ebp
+.LVL94:
+	.loc 2 54 10 view .LVU251
+.LBE45:
+.LBE49:
+	.loc 1 176 5 is_stmt 1 view .LVU252
+	.loc 1 176 20 is_stmt 0 view .LVU253
+	leal	-1(%rax), %eax
+.LVL95:
+	.loc 1 176 8 view .LVU254
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 12640
+	cmpl	$4222, %eax
+	ja	.L40
+	.loc 1 183 5 is_stmt 1 view .LVU255
+	.loc 1 184 5 view .LVU256
+	.loc 1 185 32 is_stmt 0 view .LVU257
+	call	getpid@PLT
+.LVL96:
+.LBB50:
+.LBI50:
+	.loc 2 51 42 is_stmt 1 view .LVU258
+.LBB51:
+	.loc 2 54 3 view .LVU259
+	.loc 2 54 10 is_stmt 0 view .LVU260
+	leaq	4240(%rsp), %r12
+.LVL97:
+	.loc 2 54 10 view .LVU261
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 12648
+.LBE51:
+.LBE50:
+	.loc 1 184 5 view .LVU262
+	cltq
+.LBB53:
+.LBB52:
+	.loc 2 54 10 view .LVU263
+	pushq	%rax
+	.cfi_def_cfa_offset 12656
+	leaq	160(%rsp), %r9
+	leaq	.LC10(%rip), %r8
+	movl	$4128, %ecx
+	movl	$1, %edx
+	movl	$4128, %esi
+	movq	%r12, %rdi
+	movl	$0, %eax
+	call	__snprintf_chk@PLT
+.LVL98:
+	.loc 2 54 10 view .LVU264
+.LBE52:
+.LBE53:
+	.loc 1 186 5 is_stmt 1 view .LVU265
+	.loc 1 186 21 is_stmt 0 view .LVU266
+	addl	$1, syscall_count(%rip)
+.LVL99:
+.LBB54:
+.LBI54:
+	.loc 3 41 1 is_stmt 1 view .LVU267
+.LBB55:
+	.loc 3 43 3 view .LVU268
+	.loc 3 46 3 view .LVU269
+	.loc 3 48 7 view .LVU270
+	.loc 3 53 7 view .LVU271
+	.loc 3 53 14 is_stmt 0 view .LVU272
+	movl	$384, %edx
+	movl	$524865, %esi
+	movq	%r12, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL100:
+	movl	%eax, %r12d
+.LVL101:
+	.loc 3 53 14 view .LVU273
+.LBE55:
+.LBE54:
+	.loc 1 189 5 is_stmt 1 view .LVU274
+	.loc 1 189 8 is_stmt 0 view .LVU275
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 12640
+	cmpl	$-1, %eax
+	je	.L52
+	.loc 1 194 5 is_stmt 1 view .LVU276
+	.loc 1 194 27 is_stmt 0 view .LVU277
+	movslq	%ebp, %rdx
+	leaq	8368(%rsp), %rsi
+	movl	%eax, %edi
+	call	write_all@PLT
+.LVL102:
+	.loc 1 194 27 view .LVU278
+	movl	%eax, %ebp
+.LVL103:
+	.loc 1 195 5 is_stmt 1 view .LVU279
+	.loc 1 195 6 is_stmt 0 view .LVU280
+	addl	$1, syscall_count(%rip)
+	.loc 1 195 24 view .LVU281
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL104:
+	.loc 1 196 5 is_stmt 1 view .LVU282
+	.loc 1 196 8 is_stmt 0 view .LVU283
+	cmpl	$-1, %ebp
+	je	.L43
+	.loc 1 197 20 view .LVU284
+	addl	$1, syscall_count(%rip)
+	.loc 1 197 38 view .LVU285
+	leaq	144(%rsp), %rsi
+	leaq	4240(%rsp), %rdi
+	call	rename@PLT
+.LVL105:
+	.loc 1 197 9 view .LVU286
+	cmpl	$-1, %eax
+	je	.L43
+	.loc 1 203 5 is_stmt 1 view .LVU287
+	.loc 1 203 10 view .LVU288
+	.loc 1 203 13 is_stmt 0 view .LVU289
+	cmpl	$0, log_level(%rip)
+	jle	.L40
+	.loc 1 203 46 is_stmt 1 discriminator 1 view .LVU290
+	movq	96(%rbx), %rdx
+	movq	(%rbx), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL106:
+	.loc 1 203 8 discriminator 1 view .LVU291
+	jmp	.L40
+.LVL107:
+.L52:
+	.loc 1 190 9 view .LVU292
+	.loc 1 190 14 view .LVU293
+	.loc 1 190 17 is_stmt 0 view .LVU294
+	cmpl	$0, log_level(%rip)
+	jle	.L40
+	.loc 1 190 50 is_stmt 1 discriminator 1 view .LVU295
+	.loc 1 190 10 is_stmt 0 discriminator 1 view .LVU296
+	call	__errno_location@PLT
+.LVL108:
+	.loc 1 190 50 discriminator 1 view .LVU297
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL109:
+	movq	%rax, %rdx
+	leaq	4240(%rsp), %rsi
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL110:
+	jmp	.L40
+.LVL111:
+.L43:
+	.loc 1 198 9 is_stmt 1 view .LVU298
+	.loc 1 198 14 view .LVU299
+	.loc 1 198 17 is_stmt 0 view .LVU300
+	cmpl	$0, log_level(%rip)
+	jg	.L53
+.L45:
+	.loc 1 198 12 is_stmt 1 discriminator 3 view .LVU301
+	.loc 1 200 9 discriminator 3 view .LVU302
+	.loc 1 200 10 is_stmt 0 discriminator 3 view .LVU303
+	addl	$1, syscall_count(%rip)
+	.loc 1 200 28 discriminator 3 view .LVU304
+	leaq	4240(%rsp), %rdi
+	call	unlink@PLT
+.LVL112:
+	.loc 1 201 9 is_stmt 1 discriminator 3 view .LVU305
+	jmp	.L40
+.L53:
+	.loc 1 198 50 discriminator 1 view .LVU306
+	.loc 1 198 10 is_stmt 0 discriminator 1 view .LVU307
+	call	__errno_location@PLT
+.LVL113:
+	.loc 1 198 50 discriminator 1 view .LVU308
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL114:
+	movq	%rax, %rdx
+	leaq	144(%rsp), %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL115:
+	jmp	.L45
+.LVL116:
+.L51:
+	.loc 1 205 1 view .LVU309
+	call	__stack_chk_fail@PLT
+.LVL117:
+	.cfi_endproc
+.LFE72:
+	.size	beep_device_cache_store, .-beep_device_cache_store
+	.local	device_name.0
+	.comm	device_name.0,4096,32
+.Letext0:
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 9 "/usr/include/stdio.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 15 "beep-driver.h"
+	.file 16 "beep-library.h"
+	.file 17 "beep-log.h"
+	.file 18 "/usr/include/unistd.h"
+	.file 19 "/usr/include/stdlib.h"
+	.file 20 "beep-drivers.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 22 "/usr/include/string.h"
+	.file 23 "/usr/include/errno.h"
+	.file 24 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1377
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF140
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF9
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x7
+	.long	0x35
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x4d
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x7
+	.long	0x59
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x8
+	.byte	0x28
+	.byte	0x1c
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x16
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x8
+	.byte	0x91
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x8
+	.byte	0x92
+	.byte	0x16
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x8
+	.byte	0x93
+	.byte	0x16
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x8
+	.byte	0x94
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x8
+	.byte	0x96
+	.byte	0x16
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x8
+	.byte	0x97
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x8
+	.byte	0x98
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x8
+	.byte	0x9a
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x8
+	.byte	0xaf
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x8
+	.byte	0xb4
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x8
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x8
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	0x146
+	.uleb128 0x7
+	.long	0x137
+	.uleb128 0x1f
+	.long	0x137
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF25
+	.uleb128 0x7
+	.long	0x146
+	.uleb128 0x4
+	.long	.LASF26
+	.byte	0x8
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x13
+	.long	0x11f
+	.uleb128 0x7
+	.long	0x15e
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF28
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x11
+	.long	0xbf
+	.uleb128 0x19
+	.long	.LASF33
+	.byte	0x10
+	.byte	0xb
+	.byte	0xb
+	.long	0x1a9
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0xb
+	.byte	0x10
+	.byte	0xc
+	.long	0xfb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0xb
+	.byte	0x15
+	.byte	0x15
+	.long	0x12b
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF32
+	.uleb128 0x8
+	.long	0x1ba
+	.uleb128 0x7
+	.long	0x1b0
+	.uleb128 0x2a
+	.uleb128 0x19
+	.long	.LASF34
+	.byte	0x90
+	.byte	0xc
+	.byte	0x1a
+	.long	0x28b
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0xc
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0xc
+	.byte	0x24
+	.byte	0xd
+	.long	0xbf
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd7
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0xc
+	.byte	0x2d
+	.byte	0xe
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0xc
+	.byte	0x2f
+	.byte	0xd
+	.long	0xa7
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0xc
+	.byte	0x30
+	.byte	0xd
+	.long	0xb3
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0xc
+	.byte	0x32
+	.byte	0x9
+	.long	0x4d
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0xc
+	.byte	0x34
+	.byte	0xd
+	.long	0x9b
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0xc
+	.byte	0x39
+	.byte	0xd
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x11
+	.long	0x107
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0xc
+	.byte	0x3f
+	.byte	0x10
+	.long	0x113
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0xc
+	.byte	0x4a
+	.byte	0x15
+	.long	0x182
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0xc
+	.byte	0x4b
+	.byte	0x15
+	.long	0x182
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0xc
+	.byte	0x4c
+	.byte	0x15
+	.long	0x182
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0xc
+	.byte	0x59
+	.byte	0x17
+	.long	0x28b
+	.byte	0x78
+	.byte	0
+	.uleb128 0x15
+	.long	0x12b
+	.long	0x29b
+	.uleb128 0x2b
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x14d
+	.uleb128 0x7
+	.long	0x29b
+	.uleb128 0x1f
+	.long	0x29b
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0xd
+	.byte	0x8
+	.byte	0x18
+	.long	0x152
+	.uleb128 0x7
+	.long	0x2aa
+	.uleb128 0x2c
+	.long	0x2b6
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0xe
+	.byte	0x19
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x7
+	.long	0x2c0
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0xf
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x2ee
+	.uleb128 0x7
+	.long	0x2dd
+	.uleb128 0x19
+	.long	.LASF54
+	.byte	0x70
+	.byte	0xf
+	.byte	0x43
+	.long	0x3b1
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0xf
+	.byte	0x44
+	.byte	0xb
+	.long	0x137
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0xf
+	.byte	0x45
+	.byte	0x12
+	.long	0x42c
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0xf
+	.byte	0x47
+	.byte	0x1d
+	.long	0x400
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF58
+	.byte	0xf
+	.byte	0x48
+	.byte	0x1b
+	.long	0x45b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF59
+	.byte	0xf
+	.byte	0x49
+	.byte	0x1b
+	.long	0x477
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0xf
+	.byte	0x4a
+	.byte	0x21
+	.long	0x483
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF61
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x4a4
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF62
+	.byte	0xf
+	.byte	0x52
+	.byte	0x1b
+	.long	0x4b0
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0xf
+	.byte	0x59
+	.byte	0x24
+	.long	0x4d1
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF64
+	.byte	0xf
+	.byte	0x61
+	.byte	0x1c
+	.long	0x436
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF65
+	.byte	0xf
+	.byte	0x62
+	.byte	0x18
+	.long	0x510
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF66
+	.byte	0xf
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0xf
+	.byte	0x68
+	.byte	0x11
+	.long	0x29b
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0xf
+	.byte	0x6d
+	.byte	0xb
+	.long	0x65
+	.byte	0x68
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x10
+	.byte	0xf
+	.byte	0x22
+	.byte	0x9
+	.long	0x3ef
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0xf
+	.byte	0x23
+	.byte	0xe
+	.long	0x2d1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF70
+	.byte	0xf
+	.byte	0x24
+	.byte	0xe
+	.long	0x2d1
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0xf
+	.byte	0x25
+	.byte	0xe
+	.long	0x2d1
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF72
+	.byte	0xf
+	.byte	0x26
+	.byte	0xe
+	.long	0x2d1
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xf
+	.byte	0x27
+	.byte	0x3
+	.long	0x3b1
+	.uleb128 0x7
+	.long	0x3ef
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0xf
+	.byte	0x32
+	.byte	0xf
+	.long	0x40c
+	.uleb128 0x8
+	.long	0x411
+	.uleb128 0x20
+	.long	0x425
+	.long	0x425
+	.uleb128 0x2
+	.long	0x42c
+	.uleb128 0x2
+	.long	0x29b
+	.byte	0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF75
+	.uleb128 0x8
+	.long	0x2dd
+	.uleb128 0x7
+	.long	0x42c
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xf
+	.byte	0x34
+	.byte	0xf
+	.long	0x442
+	.uleb128 0x8
+	.long	0x447
+	.uleb128 0x20
+	.long	0x425
+	.long	0x45b
+	.uleb128 0x2
+	.long	0x42c
+	.uleb128 0x2
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xf
+	.byte	0x36
+	.byte	0x10
+	.long	0x467
+	.uleb128 0x8
+	.long	0x46c
+	.uleb128 0x16
+	.long	0x477
+	.uleb128 0x2
+	.long	0x42c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xf
+	.byte	0x37
+	.byte	0x10
+	.long	0x467
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xf
+	.byte	0x38
+	.byte	0x10
+	.long	0x48f
+	.uleb128 0x8
+	.long	0x494
+	.uleb128 0x16
+	.long	0x4a4
+	.uleb128 0x2
+	.long	0x42c
+	.uleb128 0x2
+	.long	0x2cc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xf
+	.byte	0x3a
+	.byte	0x10
+	.long	0x467
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xf
+	.byte	0x3b
+	.byte	0x10
+	.long	0x4bc
+	.uleb128 0x8
+	.long	0x4c1
+	.uleb128 0x16
+	.long	0x4d1
+	.uleb128 0x2
+	.long	0x42c
+	.uleb128 0x2
+	.long	0x60
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x10
+	.long	0x4dd
+	.uleb128 0x8
+	.long	0x4e2
+	.uleb128 0x16
+	.long	0x4fc
+	.uleb128 0x2
+	.long	0x42c
+	.uleb128 0x2
+	.long	0x501
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x50b
+	.byte	0
+	.uleb128 0x8
+	.long	0x3fb
+	.uleb128 0x7
+	.long	0x4fc
+	.uleb128 0x8
+	.long	0x2bb
+	.uleb128 0x7
+	.long	0x506
+	.uleb128 0x8
+	.long	0x2a0
+	.uleb128 0x21
+	.long	.LASF83
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x15
+	.long	0x59
+	.uleb128 0x21
+	.long	.LASF84
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x11
+	.long	.LASF85
+	.byte	0x12
+	.value	0x35a
+	.byte	0xc
+	.long	0x4d
+	.long	0x544
+	.uleb128 0x2
+	.long	0x29b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF86
+	.byte	0x9
+	.byte	0x9a
+	.byte	0xc
+	.long	0x4d
+	.long	0x55f
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x2
+	.long	0x29b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF87
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x5
+	.long	0x4d
+	.long	0x57f
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x1b5
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF105
+	.byte	0x12
+	.value	0x28a
+	.byte	0x10
+	.long	0xef
+	.uleb128 0x1a
+	.long	.LASF92
+	.byte	0x3
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF94
+	.long	0x4d
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF88
+	.byte	0x3
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.long	0x5c7
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF89
+	.byte	0x25
+	.uleb128 0x22
+	.long	.LASF90
+	.byte	0x23
+	.uleb128 0xe
+	.long	.LASF91
+	.byte	0x4
+	.byte	0x17
+	.byte	0x10
+	.long	0x15e
+	.long	0x5f8
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x65
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF93
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x10
+	.long	.LASF91
+	.long	0x15e
+	.long	0x621
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x65
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF95
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x10
+	.long	.LASF96
+	.long	0x15e
+	.long	0x645
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x65
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF97
+	.byte	0x13
+	.value	0x28e
+	.byte	0xe
+	.long	0x137
+	.long	0x65c
+	.uleb128 0x2
+	.long	0x29b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF98
+	.byte	0x14
+	.byte	0x27
+	.byte	0xe
+	.long	0x42c
+	.long	0x67c
+	.uleb128 0x2
+	.long	0x2a0
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x2a0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF99
+	.byte	0x15
+	.byte	0xd2
+	.byte	0xc
+	.long	0x4d
+	.long	0x697
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x697
+	.byte	0
+	.uleb128 0x8
+	.long	0x1bb
+	.uleb128 0x11
+	.long	.LASF100
+	.byte	0x16
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x6b3
+	.uleb128 0x2
+	.long	0x29b
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF101
+	.byte	0x9
+	.value	0x1b7
+	.byte	0xc
+	.long	.LASF141
+	.long	0x4d
+	.long	0x6d4
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF102
+	.byte	0x16
+	.byte	0xf6
+	.byte	0xe
+	.long	0x137
+	.long	0x6ef
+	.uleb128 0x2
+	.long	0x29b
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF103
+	.byte	0x12
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0x706
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF142
+	.byte	0x11
+	.byte	0x43
+	.byte	0x6
+	.long	0x719
+	.uleb128 0x2
+	.long	0x2a0
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF104
+	.byte	0x16
+	.value	0x1a3
+	.byte	0xe
+	.long	0x137
+	.long	0x730
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF106
+	.byte	0x17
+	.byte	0x25
+	.byte	0xd
+	.long	0x73c
+	.uleb128 0x8
+	.long	0x4d
+	.uleb128 0x32
+	.long	.LASF143
+	.byte	0x1
+	.byte	0x99
+	.byte	0x6
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb24
+	.uleb128 0x23
+	.long	.LASF117
+	.byte	0x99
+	.byte	0x37
+	.long	0xb29
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x10
+	.long	.LASF107
+	.byte	0xa0
+	.byte	0xa
+	.long	0xb2e
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12496
+	.uleb128 0x13
+	.string	"sb"
+	.byte	0xa5
+	.byte	0x11
+	.long	0x1bb
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12640
+	.uleb128 0x13
+	.string	"buf"
+	.byte	0xab
+	.byte	0xa
+	.long	0xb3f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x14
+	.string	"len"
+	.byte	0xac
+	.byte	0xf
+	.long	0x54
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x10
+	.long	.LASF108
+	.byte	0xb7
+	.byte	0xa
+	.long	0xb50
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8400
+	.uleb128 0x14
+	.string	"fd"
+	.byte	0xba
+	.byte	0xf
+	.long	0x54
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xd
+	.long	.LASF109
+	.byte	0xc2
+	.byte	0xf
+	.long	0x54
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x17
+	.long	0x1257
+	.quad	.LBI36
+	.byte	.LVU225
+	.long	.LLRL31
+	.byte	0xac
+	.byte	0x15
+	.long	0x821
+	.uleb128 0x6
+	.long	0x1266
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x24
+	.long	.LLRL31
+	.uleb128 0x1b
+	.long	0x1272
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x127e
+	.quad	.LBI39
+	.byte	.LVU232
+	.long	.LLRL34
+	.byte	0xac
+	.byte	0x15
+	.long	0x85a
+	.uleb128 0x6
+	.long	0x128d
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x24
+	.long	.LLRL34
+	.uleb128 0x1b
+	.long	0x1299
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x132d
+	.quad	.LBI42
+	.byte	.LVU240
+	.long	.LLRL37
+	.byte	0xac
+	.byte	0x15
+	.long	0x8cf
+	.uleb128 0x6
+	.long	0x1351
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x6
+	.long	0x1347
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.long	0x133d
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0xc
+	.quad	.LVL93
+	.long	0x135f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1080
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1080
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x132d
+	.quad	.LBI50
+	.byte	.LVU258
+	.long	.LLRL41
+	.byte	0xb8
+	.byte	0x5
+	.long	0x94b
+	.uleb128 0x6
+	.long	0x1351
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x6
+	.long	0x1347
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x6
+	.long	0x133d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xc
+	.quad	.LVL98
+	.long	0x135f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1020
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1020
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12496
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1303
+	.quad	.LBI54
+	.byte	.LVU267
+	.quad	.LBB54
+	.quad	.LBE54-.LBB54
+	.byte	0xba
+	.byte	0x27
+	.long	0x9ae
+	.uleb128 0x6
+	.long	0x131f
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.long	0x1313
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0xc
+	.quad	.LVL100
+	.long	0x58c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x80241
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x180
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL87
+	.long	0x111b
+	.long	0x9cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12496
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL88
+	.long	0x67c
+	.long	0x9e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12640
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL96
+	.long	0x57f
+	.uleb128 0x5
+	.quad	.LVL102
+	.long	0x55f
+	.long	0xa21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL104
+	.long	0x6ef
+	.long	0xa39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL105
+	.long	0x544
+	.long	0xa5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8400
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12496
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL106
+	.long	0x706
+	.long	0xa7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL108
+	.long	0x730
+	.uleb128 0xb
+	.quad	.LVL109
+	.long	0x719
+	.uleb128 0x5
+	.quad	.LVL110
+	.long	0x706
+	.long	0xabb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8400
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL112
+	.long	0x52d
+	.long	0xad5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8400
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL113
+	.long	0x730
+	.uleb128 0xb
+	.quad	.LVL114
+	.long	0x719
+	.uleb128 0x5
+	.quad	.LVL115
+	.long	0x706
+	.long	0xb16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12496
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL117
+	.long	0x1368
+	.byte	0
+	.uleb128 0x8
+	.long	0x2e9
+	.uleb128 0x7
+	.long	0xb24
+	.uleb128 0x15
+	.long	0x146
+	.long	0xb3f
+	.uleb128 0x1c
+	.long	0x46
+	.value	0xfff
+	.byte	0
+	.uleb128 0x15
+	.long	0x146
+	.long	0xb50
+	.uleb128 0x1c
+	.long	0x46
+	.value	0x107f
+	.byte	0
+	.uleb128 0x15
+	.long	0x146
+	.long	0xb61
+	.uleb128 0x1c
+	.long	0x46
+	.value	0x101f
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF144
+	.byte	0x1
+	.byte	0x49
+	.byte	0xe
+	.long	0x42c
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x111b
+	.uleb128 0x10
+	.long	.LASF107
+	.byte	0x4b
+	.byte	0xa
+	.long	0xb2e
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.uleb128 0xd
+	.long	.LASF110
+	.byte	0x50
+	.byte	0xf
+	.long	0x54
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x13
+	.string	"buf"
+	.byte	0x56
+	.byte	0xa
+	.long	0xb3f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x14
+	.string	"len"
+	.byte	0x57
+	.byte	0x13
+	.long	0x16a
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xd
+	.long	.LASF111
+	.byte	0x5f
+	.byte	0x11
+	.long	0x13c
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xd
+	.long	.LASF112
+	.byte	0x60
+	.byte	0x11
+	.long	0x13c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xd
+	.long	.LASF113
+	.byte	0x66
+	.byte	0x11
+	.long	0x13c
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xd
+	.long	.LASF114
+	.byte	0x67
+	.byte	0x11
+	.long	0x13c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x10
+	.long	.LASF115
+	.byte	0x6d
+	.byte	0x12
+	.long	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8528
+	.uleb128 0x10
+	.long	.LASF116
+	.byte	0x6d
+	.byte	0x1d
+	.long	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8524
+	.uleb128 0x13
+	.string	"ino"
+	.byte	0x6e
+	.byte	0x18
+	.long	0x1a9
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8520
+	.uleb128 0x10
+	.long	.LASF67
+	.byte	0x76
+	.byte	0x11
+	.long	0xb2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	device_name.0
+	.uleb128 0x14
+	.string	"fd"
+	.byte	0x7c
+	.byte	0xf
+	.long	0x54
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x13
+	.string	"sb"
+	.byte	0x83
+	.byte	0x11
+	.long	0x1bb
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8512
+	.uleb128 0xd
+	.long	.LASF117
+	.byte	0x8d
+	.byte	0x18
+	.long	0x431
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xf
+	.long	0x1303
+	.quad	.LBI26
+	.byte	.LVU35
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.byte	0x50
+	.byte	0x2d
+	.long	0xce9
+	.uleb128 0x6
+	.long	0x131f
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	0x1313
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xc
+	.quad	.LVL17
+	.long	0x58c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x12a5
+	.quad	.LBI28
+	.byte	.LVU49
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.byte	0x57
+	.byte	0x2c
+	.long	0xd57
+	.uleb128 0x6
+	.long	0x12cd
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x6
+	.long	0x12c1
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x6
+	.long	0x12b5
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xc
+	.quad	.LVL21
+	.long	0x621
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x107f
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x12da
+	.quad	.LBI30
+	.byte	.LVU92
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.byte	0x7a
+	.byte	0x5
+	.long	0xdb7
+	.uleb128 0x6
+	.long	0x12f6
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x6
+	.long	0x12ea
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xc
+	.quad	.LVL35
+	.long	0x1371
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1303
+	.quad	.LBI32
+	.byte	.LVU98
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.byte	0x7c
+	.byte	0x27
+	.long	0xe0f
+	.uleb128 0x6
+	.long	0x131f
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x6
+	.long	0x1313
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xc
+	.quad	.LVL37
+	.long	0x58c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1224
+	.quad	.LBI34
+	.byte	.LVU115
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.byte	0x85
+	.byte	0x1a
+	.long	0xe5b
+	.uleb128 0x6
+	.long	0x123f
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x6
+	.long	0x1233
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1b
+	.long	0x124b
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL14
+	.long	0x111b
+	.long	0xe7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL23
+	.long	0x6ef
+	.long	0xe94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL26
+	.long	0x6d4
+	.long	0xeb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL29
+	.long	0x6d4
+	.long	0xecf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL31
+	.long	0x6b3
+	.long	0xf06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8528
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8524
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8520
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL32
+	.long	0x69c
+	.long	0xf1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL39
+	.long	0x67c
+	.long	0xf3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8512
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL45
+	.long	0x65c
+	.long	0xf63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL49
+	.long	0x706
+	.long	0xf96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	device_name.0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL51
+	.long	0x730
+	.uleb128 0xb
+	.quad	.LVL52
+	.long	0x719
+	.uleb128 0x5
+	.quad	.LVL53
+	.long	0x706
+	.long	0xfd7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL56
+	.long	0x706
+	.long	0xffe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL62
+	.long	0x706
+	.long	0x1025
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL65
+	.long	0x706
+	.long	0x104c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL67
+	.long	0x730
+	.uleb128 0xb
+	.quad	.LVL68
+	.long	0x719
+	.uleb128 0x5
+	.quad	.LVL69
+	.long	0x706
+	.long	0x1092
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	device_name.0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL70
+	.long	0x6ef
+	.long	0x10aa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL71
+	.long	0x706
+	.long	0x10cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL74
+	.long	0x6ef
+	.long	0x10e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL78
+	.long	0x706
+	.long	0x110d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL82
+	.long	0x1368
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF145
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x5
+	.long	0x425
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1224
+	.uleb128 0x35
+	.string	"buf"
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x28
+	.long	0x13c
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x23
+	.long	.LASF118
+	.byte	0x3d
+	.byte	0x3a
+	.long	0x41
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xd
+	.long	.LASF119
+	.byte	0x3f
+	.byte	0x17
+	.long	0x2a0
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.string	"len"
+	.byte	0x43
+	.byte	0xf
+	.long	0x54
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xf
+	.long	0x132d
+	.quad	.LBI24
+	.byte	.LVU13
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.byte	0x43
+	.byte	0x15
+	.long	0x1208
+	.uleb128 0x6
+	.long	0x1351
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	0x1347
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.long	0x133d
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xc
+	.quad	.LVL8
+	.long	0x135f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL2
+	.long	0x645
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF120
+	.byte	0x2b
+	.byte	0x8d
+	.long	0x9b
+	.long	0x1257
+	.uleb128 0x9
+	.long	.LASF121
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xab
+	.long	0x59
+	.uleb128 0x9
+	.long	.LASF122
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xc1
+	.long	0x59
+	.uleb128 0x1e
+	.long	.LASF124
+	.byte	0x2b
+	.byte	0xd4
+	.long	0x9b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF123
+	.byte	0x2a
+	.byte	0x92
+	.long	0x59
+	.long	0x127e
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xa9
+	.long	0x9b
+	.uleb128 0x1e
+	.long	.LASF122
+	.byte	0x2a
+	.byte	0xbf
+	.long	0x59
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF125
+	.byte	0x29
+	.byte	0x92
+	.long	0x59
+	.long	0x12a5
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0x6
+	.byte	0x29
+	.byte	0xa9
+	.long	0x9b
+	.uleb128 0x1e
+	.long	.LASF121
+	.byte	0x29
+	.byte	0xbf
+	.long	0x59
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF96
+	.byte	0x4
+	.byte	0x24
+	.byte	0x1
+	.long	0x15e
+	.long	0x12da
+	.uleb128 0x9
+	.long	.LASF126
+	.byte	0x4
+	.byte	0x24
+	.byte	0xb
+	.long	0x4d
+	.uleb128 0x9
+	.long	.LASF127
+	.byte	0x4
+	.byte	0x24
+	.byte	0x17
+	.long	0x65
+	.uleb128 0x9
+	.long	.LASF128
+	.byte	0x4
+	.byte	0x24
+	.byte	0x25
+	.long	0x35
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF129
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x2a
+	.long	0x137
+	.long	0x1303
+	.uleb128 0x9
+	.long	.LASF130
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x43
+	.long	0x141
+	.uleb128 0x9
+	.long	.LASF131
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x62
+	.long	0x2a5
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF94
+	.byte	0x3
+	.byte	0x29
+	.byte	0x1
+	.long	0x4d
+	.long	0x132d
+	.uleb128 0x9
+	.long	.LASF132
+	.byte	0x3
+	.byte	0x29
+	.byte	0x13
+	.long	0x29b
+	.uleb128 0x9
+	.long	.LASF133
+	.byte	0x3
+	.byte	0x29
+	.byte	0x1f
+	.long	0x4d
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF134
+	.byte	0x2
+	.byte	0x33
+	.byte	0x2a
+	.long	0x4d
+	.long	0x135f
+	.uleb128 0x25
+	.string	"__s"
+	.byte	0x45
+	.long	0x141
+	.uleb128 0x25
+	.string	"__n"
+	.byte	0x51
+	.long	0x35
+	.uleb128 0x9
+	.long	.LASF135
+	.byte	0x2
+	.byte	0x33
+	.byte	0x6d
+	.long	0x2a5
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF136
+	.long	.LASF138
+	.uleb128 0x36
+	.long	.LASF146
+	.long	.LASF146
+	.uleb128 0x26
+	.long	.LASF137
+	.long	.LASF139
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU251
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU279
+	.uleb128 .LVU292
+	.uleb128 .LVU298
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU273
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU309
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU279
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU292
+	.uleb128 .LVU298
+	.uleb128 .LVU309
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL104-1-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU225
+	.uleb128 .LVU231
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU229
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU231
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3c
+	.byte	0x25
+	.byte	0xb
+	.value	0xff00
+	.byte	0x1a
+	.byte	0x74
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU231
+	.uleb128 .LVU239
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU237
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU239
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x72
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU239
+	.uleb128 .LVU251
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU239
+	.uleb128 .LVU251
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1080
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU239
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU251
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU258
+	.uleb128 .LVU264
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC10
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU258
+	.uleb128 .LVU264
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1020
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU258
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU264
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -8400
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU267
+	.uleb128 .LVU273
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80241
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU267
+	.uleb128 .LVU273
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU43
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU67
+	.uleb128 .LVU146
+	.uleb128 .LVU152
+	.uleb128 .LVU200
+	.uleb128 .LVU201
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU73
+	.uleb128 .LVU153
+	.uleb128 .LVU158
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU153
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-1-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU67
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU104
+	.uleb128 .LVU153
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU170
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU73
+	.uleb128 .LVU104
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU170
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU75
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU164
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU104
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU146
+	.uleb128 .LVU170
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU200
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-1-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU137
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU146
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU35
+	.uleb128 .LVU43
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU35
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU43
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -8368
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU49
+	.uleb128 .LVU54
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x107f
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU49
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU54
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4272
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU49
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU54
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	device_name.0
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU98
+	.uleb128 .LVU104
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU98
+	.uleb128 .LVU104
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	device_name.0
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU115
+	.uleb128 .LVU129
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU115
+	.uleb128 .LVU129
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8528
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU121
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x16
+	.byte	0x70
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0x24
+	.byte	0xc
+	.long	0xffffff00
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x1a
+	.byte	0x71
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU5
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU23
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU13
+	.uleb128 .LVU17
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU13
+	.uleb128 .LVU17
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU13
+	.uleb128 .LVU17
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF18:
+	.string	"__off_t"
+.LASF14:
+	.string	"__gid_t"
+.LASF73:
+	.string	"beep_tone"
+.LASF48:
+	.string	"st_ctim"
+.LASF78:
+	.string	"beep_driver_fini_func"
+.LASF9:
+	.string	"size_t"
+.LASF95:
+	.string	"__read_alias"
+.LASF79:
+	.string	"beep_driver_begin_tone_func"
+.LASF132:
+	.string	"__path"
+.LASF27:
+	.string	"ssize_t"
+.LASF122:
+	.string	"__minor"
+.LASF58:
+	.string	"init"
+.LASF31:
+	.string	"tv_nsec"
+.LASF84:
+	.string	"log_level"
+.LASF32:
+	.string	"long long unsigned int"
+.LASF131:
+	.string	"__src"
+.LASF83:
+	.string	"syscall_count"
+.LASF90:
+	.string	"__open_too_many_args"
+.LASF56:
+	.string	"next"
+.LASF140:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF34:
+	.string	"stat"
+.LASF124:
+	.string	"__dev"
+.LASF28:
+	.string	"long long int"
+.LASF7:
+	.string	"signed char"
+.LASF69:
+	.string	"freq"
+.LASF133:
+	.string	"__oflag"
+.LASF36:
+	.string	"st_ino"
+.LASF16:
+	.string	"__mode_t"
+.LASF143:
+	.string	"beep_device_cache_store"
+.LASF80:
+	.string	"beep_driver_end_tone_func"
+.LASF62:
+	.string	"wait"
+.LASF22:
+	.string	"__blkcnt_t"
+.LASF2:
+	.string	"long int"
+.LASF53:
+	.string	"beep_driver"
+.LASF115:
+	.string	"dev_major"
+.LASF141:
+	.string	"__isoc99_sscanf"
+.LASF23:
+	.string	"__ssize_t"
+.LASF51:
+	.string	"uint16_t"
+.LASF46:
+	.string	"st_atim"
+.LASF101:
+	.string	"sscanf"
+.LASF86:
+	.string	"rename"
+.LASF67:
+	.string	"device_name"
+.LASF103:
+	.string	"close"
+.LASF145:
+	.string	"device_cache_file_name"
+.LASF68:
+	.string	"driver_data"
+.LASF11:
+	.string	"__uint32_t"
+.LASF139:
+	.string	"__builtin___strcpy_chk"
+.LASF45:
+	.string	"st_blocks"
+.LASF39:
+	.string	"st_uid"
+.LASF110:
+	.string	"cache_fd"
+.LASF137:
+	.string	"__strcpy_chk"
+.LASF64:
+	.string	"probe"
+.LASF4:
+	.string	"unsigned int"
+.LASF100:
+	.string	"strlen"
+.LASF74:
+	.string	"beep_driver_detect_func"
+.LASF89:
+	.string	"__open_missing_mode"
+.LASF125:
+	.string	"gnu_dev_major"
+.LASF81:
+	.string	"beep_driver_wait_func"
+.LASF57:
+	.string	"detect"
+.LASF102:
+	.string	"strchr"
+.LASF55:
+	.string	"name"
+.LASF66:
+	.string	"device_fd"
+.LASF60:
+	.string	"begin_tone"
+.LASF118:
+	.string	"size"
+.LASF113:
+	.string	"device"
+.LASF88:
+	.string	"__open_2"
+.LASF17:
+	.string	"__nlink_t"
+.LASF129:
+	.string	"strcpy"
+.LASF91:
+	.string	"__read_chk"
+.LASF82:
+	.string	"beep_driver_play_sequence_func"
+.LASF138:
+	.string	"__builtin___snprintf_chk"
+.LASF43:
+	.string	"st_size"
+.LASF121:
+	.string	"__major"
+.LASF111:
+	.string	"driver_name"
+.LASF38:
+	.string	"st_mode"
+.LASF97:
+	.string	"getenv"
+.LASF85:
+	.string	"unlink"
+.LASF87:
+	.string	"write_all"
+.LASF94:
+	.string	"open"
+.LASF12:
+	.string	"__dev_t"
+.LASF126:
+	.string	"__fd"
+.LASF24:
+	.string	"__syscall_slong_t"
+.LASF54:
+	.string	"_beep_driver"
+.LASF107:
+	.string	"cache_name"
+.LASF123:
+	.string	"gnu_dev_minor"
+.LASF21:
+	.string	"__blksize_t"
+.LASF127:
+	.string	"__buf"
+.LASF142:
+	.string	"log_verbose"
+.LASF50:
+	.string	"sig_atomic_t"
+.LASF98:
+	.string	"beep_drivers_adopt"
+.LASF108:
+	.string	"tmp_name"
+.LASF116:
+	.string	"dev_minor"
+.LASF30:
+	.string	"tv_sec"
+.LASF49:
+	.string	"__glibc_reserved"
+.LASF77:
+	.string	"beep_driver_init_func"
+.LASF37:
+	.string	"st_nlink"
+.LASF75:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF71:
+	.string	"delay"
+.LASF19:
+	.string	"__pid_t"
+.LASF8:
+	.string	"short int"
+.LASF44:
+	.string	"st_blksize"
+.LASF33:
+	.string	"timespec"
+.LASF146:
+	.string	"__stack_chk_fail"
+.LASF41:
+	.string	"__pad0"
+.LASF15:
+	.string	"__ino_t"
+.LASF52:
+	.string	"uint32_t"
+.LASF144:
+	.string	"beep_device_cache_detect"
+.LASF42:
+	.string	"st_rdev"
+.LASF3:
+	.string	"long unsigned int"
+.LASF70:
+	.string	"length"
+.LASF25:
+	.string	"char"
+.LASF10:
+	.string	"__uint16_t"
+.LASF112:
+	.string	"driver_end"
+.LASF106:
+	.string	"__errno_location"
+.LASF105:
+	.string	"getpid"
+.LASF13:
+	.string	"__uid_t"
+.LASF120:
+	.string	"gnu_dev_makedev"
+.LASF76:
+	.string	"beep_driver_probe_func"
+.LASF6:
+	.string	"short unsigned int"
+.LASF135:
+	.string	"__fmt"
+.LASF40:
+	.string	"st_gid"
+.LASF134:
+	.string	"snprintf"
+.LASF20:
+	.string	"__time_t"
+.LASF130:
+	.string	"__dest"
+.LASF128:
+	.string	"__nbytes"
+.LASF35:
+	.string	"st_dev"
+.LASF63:
+	.string	"play_sequence"
+.LASF92:
+	.string	"__open_alias"
+.LASF72:
+	.string	"flags"
+.LASF47:
+	.string	"st_mtim"
+.LASF99:
+	.string	"fstat"
+.LASF96:
+	.string	"read"
+.LASF117:
+	.string	"driver"
+.LASF65:
+	.string	"default_devices"
+.LASF59:
+	.string	"fini"
+.LASF93:
+	.string	"__read_chk_warn"
+.LASF136:
+	.string	"__snprintf_chk"
+.LASF104:
+	.string	"strerror"
+.LASF26:
+	.string	"__sig_atomic_t"
+.LASF109:
+	.string	"write_ret"
+.LASF61:
+	.string	"end_tone"
+.LASF119:
+	.string	"runtime_dir"
+.LASF114:
+	.string	"device_end"
+.LASF29:
+	.string	"ino_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-device-cache.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
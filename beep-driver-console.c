@@ -20,6 +20,7 @@
 
 
 #include <stddef.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <linux/kd.h>
@@ -29,6 +30,8 @@
 
 #include "beep-library.h"
 #include "beep-log.h"
+#include "beep-note-table.h"
+#include "beep-usdt.h"
 
 
 /* Use PIT_TICK_RATE value from the kernel. */
@@ -38,56 +41,23 @@
 
 
 static
-int open_checked_device(const char *const device_name)
-{
-    const int fd = open_checked_char_device(device_name);
-    if (fd == -1) {
-        return -1;
-    }
-
-    if (-1 == ioctl(fd, KIOCSOUND, 0)) {
-        log_verbose("console: %d does not implement KIOCSOUND API", fd);
-        return -1;
-    }
-
-    return fd;
-}
+const char *const console_default_devices[] =
+    {
+     "/dev/tty0",
+     "/dev/vc/0",
+     NULL
+    };
 
 
 static
-bool driver_detect(beep_driver *driver, const char *console_device)
+bool driver_probe(beep_driver *driver, const int device_fd)
 {
-    if (console_device) {
-        log_verbose("console driver_detect %p %s",
-                    (void *)driver, console_device);
-    } else {
-        log_verbose("console driver_detect %p %p",
-                    (void *)driver, (const void *)console_device);
+    log_verbose("console driver_probe %p %d", (void *)driver, device_fd);
+    if (-1 == COUNT_SYSCALL(ioctl(device_fd, KIOCSOUND, 0))) {
+        log_verbose("console: %d does not implement KIOCSOUND API", device_fd);
+        return false;
     }
-    if (console_device) {
-        const int fd = open_checked_device(console_device);
-        if (fd >= 0) {
-            driver->device_fd = fd;
-            driver->device_name = console_device;
-            return true;
-        }
-    } else {
-        static const char *const console_device_list[] =
-            {
-             "/dev/tty0",
-             "/dev/vc/0",
-            };
-        for (size_t i=0; i<(sizeof(console_device_list)/sizeof(console_device_list[0])); ++i) {
-            const char *const device_name = console_device_list[i];
-            const int fd = open_checked_device(device_name);
-            if (-1 != fd) {
-                driver->device_fd = fd;
-                driver->device_name = device_name;
-                return true;
-            }
-        }
-    }
-    return false;
+    return true;
 }
 
 
@@ -110,7 +80,7 @@ void driver_fini(beep_driver *driver)
 static
 void driver_begin_tone(beep_driver *driver, const uint16_t freq)
 {
-    log_verbose("console driver_begin_tone %p %u", (void *)driver, freq);
+    log_verbose_deferred_u("console driver_begin_tone %p %u", (void *)driver, freq);
     const uintptr_t argp = ((freq != 0) ? (CLOCK_TICK_RATE/freq) : freq) & 0xffff;
     if (-1 == ioctl(driver->device_fd, KIOCSOUND, argp)) {
 	/* If we cannot use the sound API, we cannot silence the sound either */
@@ -122,23 +92,100 @@ void driver_begin_tone(beep_driver *driver, const uint16_t freq)
 static
 void driver_end_tone(beep_driver *driver)
 {
-    log_verbose("console driver_end_tone %p", (void *)driver);
+    log_verbose_deferred("console driver_end_tone %p", (void *)driver);
     if (-1 == ioctl(driver->device_fd, KIOCSOUND, 0)) {
 	safe_error_exit("ioctl KIOCSOUND");
     }
 }
 
 
+/* The PIT count for a tone, from the note table for notes */
+static
+uintptr_t console_divisor(const beep_tone *const tone)
+{
+    if (tone->flags & BEEP_TONE_NOTE) {
+        return beep_note_console_divisor[tone->flags & BEEP_TONE_NOTE_MASK];
+    }
+    return (CLOCK_TICK_RATE/tone->freq) & 0xffff;
+}
+
+
+static
+void console_sleep_ms(const uint32_t milliseconds)
+{
+    BEEP_PROBE1(wait_enter, milliseconds);
+    const struct timespec request =
+        { milliseconds / 1000U,
+          (milliseconds % 1000UL) * 1000UL * 1000UL };
+    /* Interrupted by a signal is fine, the caller checks abort_flag */
+    nanosleep(&request, NULL);
+    BEEP_PROBE1(wait_exit, milliseconds);
+}
+
+
+/* A length of whole jiffies for HZ=100, 250, 300 and 1000 */
+#define CONSOLE_JIFFY_MULTIPLE_MS 20
+
+
+/* Have the kernel end each tone via KDMKTONE, which saves the
+ * KIOCSOUND ioctl(2) ending the tone, and sleep through tone and
+ * delay with a single nanosleep(2).
+ *
+ * The kernel timer ending a KDMKTONE tone rounds its length up to
+ * whole jiffies, which would make other tones longer and eat into
+ * their delay.  So only tones with a length of whole jiffies and a
+ * delay use KDMKTONE, and all other tones are played edge by edge,
+ * as are tones too long for its 16 bit length.
+ */
+static
+void driver_play_sequence(beep_driver *driver,
+                          const beep_tone *const tones, const size_t count,
+                          const volatile sig_atomic_t *const abort_flag)
+{
+    log_verbose("console driver_play_sequence %p %zu",
+                (void *)driver, count);
+    for (size_t i=0; (!*abort_flag) && (i<count); ++i) {
+        const beep_tone *const tone = &tones[i];
+        if ((tone->freq == 0) || (tone->length == 0)) {
+            console_sleep_ms(tone->length + tone->delay);
+        } else if ((tone->length <= 0xffff) && (tone->delay > 0)
+                   && ((tone->length % CONSOLE_JIFFY_MULTIPLE_MS) == 0)) {
+            const uintptr_t argp = (((uintptr_t)tone->length) << 16)
+                | console_divisor(tone);
+            if (-1 == ioctl(driver->device_fd, KDMKTONE, argp)) {
+                safe_error_exit("ioctl KDMKTONE");
+            }
+            console_sleep_ms(tone->length + tone->delay);
+        } else {
+            driver_begin_tone(driver, tone->freq & 0xffff);
+            console_sleep_ms(tone->length);
+            driver_end_tone(driver);
+            if (!*abort_flag) {
+                console_sleep_ms(tone->delay);
+            }
+        }
+    }
+    if (*abort_flag) {
+        driver_end_tone(driver);
+    }
+}
+
+
 beep_driver console_driver =
     {
      "console",
      NULL,
-     driver_detect,
+     NULL,
      driver_init,
      driver_fini,
      driver_begin_tone,
      driver_end_tone,
+     NULL,
+     driver_play_sequence,
+     driver_probe,
+     console_default_devices,
      0,
+     NULL,
      NULL
     };
 
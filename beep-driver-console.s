@@ -0,0 +1,3628 @@
+	.file	"beep-driver-console.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-console.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"console driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL0:
+.LFB14:
+	.file 1 "beep-driver-console.c"
+	.loc 1 66 1 view -0
+	.cfi_startproc
+	.loc 1 66 1 is_stmt 0 view .LVU1
+	endbr64
+	.loc 1 67 5 is_stmt 1 view .LVU2
+	.loc 1 67 10 view .LVU3
+	.loc 1 67 13 is_stmt 0 view .LVU4
+	cmpl	$0, log_level(%rip)
+	jg	.L7
+	ret
+.L7:
+	.loc 1 66 1 discriminator 1 view .LVU5
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 67 46 is_stmt 1 discriminator 1 view .LVU6
+	movq	%rdi, %rsi
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 67 46 is_stmt 0 discriminator 1 view .LVU7
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL2:
+	.loc 1 67 8 is_stmt 1 discriminator 1 view .LVU8
+	.loc 1 68 1 is_stmt 0 discriminator 1 view .LVU9
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.1
+.LC1:
+	.string	"console driver_probe %p %d"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"console: %d does not implement KIOCSOUND API"
+	.text
+	.type	driver_probe, @function
+driver_probe:
+.LVL3:
+.LFB13:
+	.loc 1 54 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 1 is_stmt 0 view .LVU11
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%esi, %ebx
+	.loc 1 55 5 is_stmt 1 view .LVU12
+	.loc 1 55 10 view .LVU13
+	.loc 1 55 13 is_stmt 0 view .LVU14
+	cmpl	$0, log_level(%rip)
+	jg	.L14
+.LVL4:
+.L9:
+	.loc 1 55 8 is_stmt 1 discriminator 3 view .LVU15
+	.loc 1 56 5 discriminator 3 view .LVU16
+	.loc 1 56 16 is_stmt 0 discriminator 3 view .LVU17
+	addl	$1, syscall_count(%rip)
+	.loc 1 56 34 discriminator 3 view .LVU18
+	movl	$0, %edx
+	movl	$19247, %esi
+	movl	%ebx, %edi
+	movl	$0, %eax
+	call	ioctl@PLT
+.LVL5:
+	movl	%eax, %edx
+	.loc 1 60 11 discriminator 3 view .LVU19
+	movl	$1, %eax
+	.loc 1 56 8 discriminator 3 view .LVU20
+	cmpl	$-1, %edx
+	je	.L15
+.L8:
+	.loc 1 61 1 view .LVU21
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL6:
+	.loc 1 61 1 view .LVU22
+	ret
+.LVL7:
+.L14:
+	.cfi_restore_state
+	.loc 1 55 46 is_stmt 1 discriminator 1 view .LVU23
+	movl	%esi, %edx
+	movq	%rdi, %rsi
+	leaq	.LC1(%rip), %rdi
+.LVL8:
+	.loc 1 55 46 is_stmt 0 discriminator 1 view .LVU24
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL9:
+	.loc 1 55 46 discriminator 1 view .LVU25
+	jmp	.L9
+.L15:
+	.loc 1 57 9 is_stmt 1 view .LVU26
+	.loc 1 57 14 view .LVU27
+	.loc 1 58 15 is_stmt 0 view .LVU28
+	movl	$0, %eax
+	.loc 1 57 17 view .LVU29
+	cmpl	$0, log_level(%rip)
+	jle	.L8
+	.loc 1 57 50 is_stmt 1 discriminator 1 view .LVU30
+	movl	%ebx, %esi
+	leaq	.LC2(%rip), %rdi
+	call	log_verbose@PLT
+.LVL10:
+	.loc 1 58 15 is_stmt 0 discriminator 1 view .LVU31
+	movl	$0, %eax
+	jmp	.L8
+	.cfi_endproc
+.LFE13:
+	.size	driver_probe, .-driver_probe
+	.type	console_sleep_ms, @function
+console_sleep_ms:
+.LVL11:
+.LFB19:
+	.loc 1 115 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 115 1 is_stmt 0 view .LVU33
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 115 1 view .LVU34
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 116 5 is_stmt 1 view .LVU35
+	.loc 1 116 9 view .LVU36
+	.loc 1 116 8 view .LVU37
+	.loc 1 117 5 view .LVU38
+	.loc 1 118 24 is_stmt 0 view .LVU39
+	movl	%edi, %eax
+	imulq	$274877907, %rax, %rax
+	shrq	$38, %rax
+	movl	%eax, %edx
+	movq	%rdx, (%rsp)
+	.loc 1 119 25 view .LVU40
+	imull	$1000, %eax, %eax
+	subl	%eax, %edi
+.LVL12:
+	.loc 1 119 44 view .LVU41
+	imulq	$1000000, %rdi, %rdi
+	.loc 1 117 27 view .LVU42
+	movq	%rdi, 8(%rsp)
+	.loc 1 121 5 is_stmt 1 view .LVU43
+	movq	%rsp, %rdi
+	movl	$0, %esi
+	call	nanosleep@PLT
+.LVL13:
+	.loc 1 122 5 view .LVU44
+	.loc 1 122 9 view .LVU45
+	.loc 1 122 8 view .LVU46
+	.loc 1 123 1 is_stmt 0 view .LVU47
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L19
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L19:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL14:
+	.cfi_endproc
+.LFE19:
+	.size	console_sleep_ms, .-console_sleep_ms
+	.section	.rodata.str1.1
+.LC3:
+	.string	"console driver_end_tone %p"
+.LC4:
+	.string	"ioctl KIOCSOUND"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL15:
+.LFB17:
+	.loc 1 94 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 94 1 is_stmt 0 view .LVU49
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 95 5 is_stmt 1 view .LVU50
+	.loc 1 95 10 view .LVU51
+	.loc 1 95 94 view .LVU52
+	.loc 1 95 97 is_stmt 0 view .LVU53
+	cmpl	$0, log_level(%rip)
+	jg	.L24
+.LVL16:
+.L21:
+	.loc 1 95 8 is_stmt 1 discriminator 6 view .LVU54
+	.loc 1 96 5 discriminator 6 view .LVU55
+	.loc 1 96 15 is_stmt 0 discriminator 6 view .LVU56
+	movl	88(%rbx), %edi
+	movl	$0, %edx
+	movl	$19247, %esi
+	movl	$0, %eax
+	call	ioctl@PLT
+.LVL17:
+	.loc 1 96 8 discriminator 6 view .LVU57
+	cmpl	$-1, %eax
+	je	.L25
+	.loc 1 99 1 view .LVU58
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL18:
+	.loc 1 99 1 view .LVU59
+	ret
+.LVL19:
+.L24:
+	.cfi_restore_state
+	.loc 1 95 130 is_stmt 1 discriminator 4 view .LVU60
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rdi, %rsi
+	leaq	.LC3(%rip), %rdi
+	call	log_deferred@PLT
+.LVL20:
+	jmp	.L21
+.L25:
+	.loc 1 97 2 view .LVU61
+	leaq	.LC4(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL21:
+	.cfi_endproc
+.LFE17:
+	.size	driver_end_tone, .-driver_end_tone
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"console driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL22:
+.LFB16:
+	.loc 1 82 1 view -0
+	.cfi_startproc
+	.loc 1 82 1 is_stmt 0 view .LVU63
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	movl	%esi, %ebx
+	.loc 1 83 5 is_stmt 1 view .LVU64
+	.loc 1 83 10 view .LVU65
+	.loc 1 83 105 view .LVU66
+	.loc 1 83 108 is_stmt 0 view .LVU67
+	cmpl	$0, log_level(%rip)
+	jg	.L32
+.LVL23:
+.L27:
+	.loc 1 83 8 is_stmt 1 discriminator 6 view .LVU68
+	.loc 1 84 5 discriminator 6 view .LVU69
+	.loc 1 84 68 is_stmt 0 discriminator 6 view .LVU70
+	movl	$0, %edx
+	testw	%bx, %bx
+	je	.L28
+	.loc 1 84 53 discriminator 1 view .LVU71
+	movzwl	%bx, %ebx
+	movl	$1193182, %eax
+	movl	$0, %edx
+	divq	%rbx
+	.loc 1 84 68 discriminator 1 view .LVU72
+	movzwl	%ax, %edx
+.L28:
+.LVL24:
+	.loc 1 85 5 is_stmt 1 discriminator 4 view .LVU73
+	.loc 1 85 15 is_stmt 0 discriminator 4 view .LVU74
+	movl	88(%rbp), %edi
+	movl	$19247, %esi
+	movl	$0, %eax
+	call	ioctl@PLT
+.LVL25:
+	.loc 1 85 8 discriminator 4 view .LVU75
+	cmpl	$-1, %eax
+	je	.L33
+	.loc 1 89 1 view .LVU76
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL26:
+	.loc 1 89 1 view .LVU77
+	ret
+.LVL27:
+.L32:
+	.cfi_restore_state
+	.loc 1 83 141 is_stmt 1 discriminator 4 view .LVU78
+	movzwl	%si, %ecx
+	movl	$1, %edx
+	movq	%rdi, %rsi
+.LVL28:
+	.loc 1 83 141 is_stmt 0 discriminator 4 view .LVU79
+	leaq	.LC5(%rip), %rdi
+.LVL29:
+	.loc 1 83 141 discriminator 4 view .LVU80
+	call	log_deferred@PLT
+.LVL30:
+	.loc 1 83 141 discriminator 4 view .LVU81
+	jmp	.L27
+.LVL31:
+.L33:
+	.loc 1 87 2 is_stmt 1 view .LVU82
+	leaq	.LC4(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL32:
+	.cfi_endproc
+.LFE16:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"console driver_play_sequence %p %zu"
+	.section	.rodata.str1.1
+.LC7:
+	.string	"ioctl KDMKTONE"
+	.text
+	.type	driver_play_sequence, @function
+driver_play_sequence:
+.LVL33:
+.LFB20:
+	.loc 1 144 1 view -0
+	.cfi_startproc
+	.loc 1 144 1 is_stmt 0 view .LVU84
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r15
+	movq	%rsi, %rbx
+	movq	%rdx, %r14
+	movq	%rcx, %r13
+	.loc 1 145 5 is_stmt 1 view .LVU85
+	.loc 1 145 10 view .LVU86
+	.loc 1 145 13 is_stmt 0 view .LVU87
+	cmpl	$0, log_level(%rip)
+	jg	.L49
+.LVL34:
+.L35:
+.LBB7:
+	.loc 1 147 37 is_stmt 1 discriminator 1 view .LVU88
+	.loc 1 147 24 is_stmt 0 discriminator 1 view .LVU89
+	movl	0(%r13), %eax
+	.loc 1 147 37 discriminator 1 view .LVU90
+	testq	%r14, %r14
+	je	.L36
+	testl	%eax, %eax
+	jne	.L36
+	.loc 1 147 37 view .LVU91
+	movl	$0, %ebp
+	jmp	.L44
+.LVL35:
+.L49:
+	.loc 1 147 37 view .LVU92
+.LBE7:
+	.loc 1 145 46 is_stmt 1 discriminator 1 view .LVU93
+	movq	%rdi, %rsi
+	leaq	.LC6(%rip), %rdi
+.LVL36:
+	.loc 1 145 46 is_stmt 0 discriminator 1 view .LVU94
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL37:
+	.loc 1 145 46 discriminator 1 view .LVU95
+	jmp	.L35
+.LVL38:
+.L37:
+.LBB16:
+.LBB8:
+	.loc 1 150 13 is_stmt 1 view .LVU96
+	movl	8(%r12), %edi
+	addl	4(%r12), %edi
+	call	console_sleep_ms
+.LVL39:
+.L39:
+	.loc 1 150 13 is_stmt 0 view .LVU97
+.LBE8:
+	.loc 1 147 51 is_stmt 1 discriminator 2 view .LVU98
+	addq	$1, %rbp
+.LVL40:
+	.loc 1 147 37 discriminator 2 view .LVU99
+	.loc 1 147 24 is_stmt 0 discriminator 2 view .LVU100
+	movl	0(%r13), %eax
+	.loc 1 147 37 discriminator 2 view .LVU101
+	addq	$16, %rbx
+.LVL41:
+	.loc 1 147 37 discriminator 2 view .LVU102
+	cmpq	%r14, %rbp
+	jnb	.L36
+	.loc 1 147 37 discriminator 2 view .LVU103
+	testl	%eax, %eax
+	jne	.L36
+.LVL42:
+.L44:
+.LBB15:
+	.loc 1 148 9 is_stmt 1 view .LVU104
+	.loc 1 149 9 view .LVU105
+	movq	%rbx, %r12
+	.loc 1 149 18 is_stmt 0 view .LVU106
+	movl	(%rbx), %esi
+	.loc 1 149 12 view .LVU107
+	testl	%esi, %esi
+	je	.L37
+	.loc 1 149 39 discriminator 1 view .LVU108
+	movl	4(%rbx), %eax
+	.loc 1 149 31 discriminator 1 view .LVU109
+	testl	%eax, %eax
+	je	.L37
+	.loc 1 151 16 is_stmt 1 view .LVU110
+	.loc 1 151 19 is_stmt 0 view .LVU111
+	cmpl	$65535, %eax
+	ja	.L40
+	.loc 1 151 45 discriminator 1 view .LVU112
+	cmpl	$0, 8(%rbx)
+	je	.L40
+	.loc 1 152 38 view .LVU113
+	movl	%eax, %edx
+	movl	$3435973837, %ecx
+	imulq	%rcx, %rdx
+	shrq	$36, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	sall	$2, %edx
+	.loc 1 152 20 view .LVU114
+	cmpl	%edx, %eax
+	je	.L50
+.L40:
+	.loc 1 160 13 is_stmt 1 view .LVU115
+	movzwl	%si, %esi
+	movq	%r15, %rdi
+	call	driver_begin_tone
+.LVL43:
+	.loc 1 161 13 view .LVU116
+	movl	4(%r12), %edi
+	call	console_sleep_ms
+.LVL44:
+	.loc 1 162 13 view .LVU117
+	movq	%r15, %rdi
+	call	driver_end_tone
+.LVL45:
+	.loc 1 163 13 view .LVU118
+	.loc 1 163 18 is_stmt 0 view .LVU119
+	movl	0(%r13), %eax
+	.loc 1 163 16 view .LVU120
+	testl	%eax, %eax
+	jne	.L39
+	.loc 1 164 17 is_stmt 1 view .LVU121
+	movl	8(%r12), %edi
+	call	console_sleep_ms
+.LVL46:
+	jmp	.L39
+.L50:
+.LBB9:
+	.loc 1 153 13 view .LVU122
+	.loc 1 153 38 is_stmt 0 view .LVU123
+	movl	%eax, %ecx
+	.loc 1 153 63 view .LVU124
+	salq	$16, %rcx
+.LVL47:
+.LBB10:
+.LBI10:
+	.loc 1 104 11 is_stmt 1 view .LVU125
+.LBB11:
+	.loc 1 106 5 view .LVU126
+	.loc 1 106 13 is_stmt 0 view .LVU127
+	movl	12(%rbx), %eax
+	.loc 1 106 8 view .LVU128
+	testb	$1, %ah
+	jne	.L51
+	.loc 1 109 5 is_stmt 1 view .LVU129
+	.loc 1 109 35 is_stmt 0 view .LVU130
+	movl	$1193182, %eax
+	movl	$0, %edx
+	divl	%esi
+	movzwl	%ax, %eax
+.L42:
+.LVL48:
+	.loc 1 109 35 view .LVU131
+.LBE11:
+.LBE10:
+	.loc 1 155 13 is_stmt 1 view .LVU132
+	.loc 1 153 29 is_stmt 0 view .LVU133
+	orq	%rax, %rcx
+.LVL49:
+	.loc 1 153 29 view .LVU134
+	movq	%rcx, %rdx
+	.loc 1 155 23 view .LVU135
+	movl	88(%r15), %edi
+	movl	$19248, %esi
+	movl	$0, %eax
+	call	ioctl@PLT
+.LVL50:
+	.loc 1 155 16 view .LVU136
+	cmpl	$-1, %eax
+	je	.L52
+	.loc 1 158 13 is_stmt 1 view .LVU137
+	movl	8(%r12), %edi
+	addl	4(%r12), %edi
+	call	console_sleep_ms
+.LVL51:
+.LBE9:
+	.loc 1 152 51 is_stmt 0 view .LVU138
+	jmp	.L39
+.LVL52:
+.L51:
+.LBB14:
+.LBB13:
+.LBB12:
+	.loc 1 107 9 is_stmt 1 view .LVU139
+	.loc 1 107 41 is_stmt 0 view .LVU140
+	andl	$127, %eax
+	leaq	beep_note_console_divisor(%rip), %rdx
+	movzwl	(%rdx,%rax,2), %eax
+	jmp	.L42
+.LVL53:
+.L52:
+	.loc 1 107 41 view .LVU141
+.LBE12:
+.LBE13:
+	.loc 1 156 17 is_stmt 1 view .LVU142
+	leaq	.LC7(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL54:
+.L36:
+	.loc 1 156 17 is_stmt 0 view .LVU143
+.LBE14:
+.LBE15:
+.LBE16:
+	.loc 1 168 5 is_stmt 1 view .LVU144
+	.loc 1 168 9 is_stmt 0 view .LVU145
+	movl	0(%r13), %eax
+	.loc 1 168 8 view .LVU146
+	testl	%eax, %eax
+	jne	.L53
+.L34:
+	.loc 1 171 1 view .LVU147
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL55:
+	.loc 1 171 1 view .LVU148
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL56:
+	.loc 1 171 1 view .LVU149
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL57:
+	.loc 1 171 1 view .LVU150
+	ret
+.LVL58:
+.L53:
+	.cfi_restore_state
+	.loc 1 169 9 is_stmt 1 view .LVU151
+	movq	%r15, %rdi
+	call	driver_end_tone
+.LVL59:
+	.loc 1 171 1 is_stmt 0 view .LVU152
+	jmp	.L34
+	.cfi_endproc
+.LFE20:
+	.size	driver_play_sequence, .-driver_play_sequence
+	.section	.rodata.str1.1
+.LC8:
+	.string	"console driver_fini %p"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL60:
+.LFB15:
+	.loc 1 73 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 73 1 is_stmt 0 view .LVU154
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 74 5 is_stmt 1 view .LVU155
+	.loc 1 74 10 view .LVU156
+	.loc 1 74 13 is_stmt 0 view .LVU157
+	cmpl	$0, log_level(%rip)
+	jg	.L57
+.LVL61:
+.L55:
+	.loc 1 74 8 is_stmt 1 discriminator 3 view .LVU158
+	.loc 1 75 5 discriminator 3 view .LVU159
+	movl	88(%rbx), %edi
+	call	close@PLT
+.LVL62:
+	.loc 1 76 5 discriminator 3 view .LVU160
+	.loc 1 76 23 is_stmt 0 discriminator 3 view .LVU161
+	movl	$-1, 88(%rbx)
+	.loc 1 77 1 discriminator 3 view .LVU162
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL63:
+	.loc 1 77 1 discriminator 3 view .LVU163
+	ret
+.LVL64:
+.L57:
+	.cfi_restore_state
+	.loc 1 74 46 is_stmt 1 discriminator 1 view .LVU164
+	movq	%rdi, %rsi
+	leaq	.LC8(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL65:
+	jmp	.L55
+	.cfi_endproc
+.LFE15:
+	.size	driver_fini, .-driver_fini
+	.globl	console_driver
+	.section	.rodata.str1.1
+.LC9:
+	.string	"console"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	console_driver, @object
+	.size	console_driver, 112
+console_driver:
+	.quad	.LC9
+	.quad	0
+	.quad	0
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	0
+	.quad	driver_play_sequence
+	.quad	driver_probe
+	.quad	console_default_devices
+	.long	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.section	.rodata.str1.1
+.LC10:
+	.string	"/dev/tty0"
+.LC11:
+	.string	"/dev/vc/0"
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	console_default_devices, @object
+	.size	console_default_devices, 24
+console_default_devices:
+	.quad	.LC10
+	.quad	.LC11
+	.quad	0
+	.section	.rodata
+	.align 32
+	.type	beep_note_console_divisor, @object
+	.size	beep_note_console_divisor, 256
+beep_note_console_divisor:
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-1
+	.value	-527
+	.value	-4175
+	.value	-7619
+	.value	-10870
+	.value	-13938
+	.value	-16834
+	.value	-19568
+	.value	-22148
+	.value	-24583
+	.value	-26881
+	.value	-29051
+	.value	-31099
+	.value	32505
+	.value	30680
+	.value	28958
+	.value	27333
+	.value	25799
+	.value	24351
+	.value	22984
+	.value	21694
+	.value	20477
+	.value	19327
+	.value	18243
+	.value	17219
+	.value	16252
+	.value	15340
+	.value	14479
+	.value	13667
+	.value	12899
+	.value	12175
+	.value	11492
+	.value	10847
+	.value	10238
+	.value	9664
+	.value	9121
+	.value	8609
+	.value	8126
+	.value	7670
+	.value	7240
+	.value	6833
+	.value	6450
+	.value	6088
+	.value	5746
+	.value	5424
+	.value	5119
+	.value	4832
+	.value	4561
+	.value	4305
+	.value	4063
+	.value	3835
+	.value	3620
+	.value	3417
+	.value	3225
+	.value	3044
+	.value	2873
+	.value	2712
+	.value	2560
+	.value	2416
+	.value	2280
+	.value	2152
+	.value	2032
+	.value	1918
+	.value	1810
+	.value	1708
+	.value	1612
+	.value	1522
+	.value	1437
+	.value	1356
+	.value	1280
+	.value	1208
+	.value	1140
+	.value	1076
+	.value	1016
+	.value	959
+	.value	905
+	.value	854
+	.value	806
+	.value	761
+	.value	718
+	.value	678
+	.value	640
+	.value	604
+	.value	570
+	.value	538
+	.value	508
+	.value	479
+	.value	452
+	.value	427
+	.value	403
+	.value	380
+	.value	359
+	.value	339
+	.value	320
+	.value	302
+	.value	285
+	.value	269
+	.value	254
+	.value	240
+	.value	226
+	.value	214
+	.value	202
+	.value	190
+	.value	180
+	.value	169
+	.value	160
+	.value	151
+	.value	143
+	.value	135
+	.value	127
+	.value	120
+	.value	113
+	.value	107
+	.value	101
+	.value	95
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/usr/include/stdint.h"
+	.file 8 "beep-driver.h"
+	.file 9 "beep-driver-console.h"
+	.file 10 "beep-library.h"
+	.file 11 "beep-log.h"
+	.file 12 "beep-note-table.h"
+	.file 13 "/usr/include/unistd.h"
+	.file 14 "/usr/include/time.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/ioctl.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xaca
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF81
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x3
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x5
+	.long	0x35
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x5
+	.long	0x67
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x3
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x60
+	.uleb128 0x3
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	0xb8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x5
+	.long	0xb8
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x6
+	.long	0xbf
+	.uleb128 0x5
+	.long	0xd0
+	.uleb128 0x11
+	.long	.LASF25
+	.byte	0x10
+	.byte	0x4
+	.byte	0xb
+	.long	0x101
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0x99
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x15
+	.byte	0x15
+	.long	0xa7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xda
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF18
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF19
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x8
+	.byte	0x18
+	.long	0xc4
+	.uleb128 0x5
+	.long	0x114
+	.uleb128 0x1c
+	.long	0x120
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x19
+	.byte	0x14
+	.long	0x81
+	.uleb128 0x5
+	.long	0x12a
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x5
+	.long	0x13b
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x5
+	.long	0x14c
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x169
+	.uleb128 0x11
+	.long	.LASF26
+	.byte	0x70
+	.byte	0x8
+	.byte	0x43
+	.long	0x22c
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x44
+	.byte	0xb
+	.long	0xb3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x45
+	.byte	0x12
+	.long	0x2a7
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x47
+	.byte	0x1d
+	.long	0x27b
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1b
+	.long	0x2d1
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x49
+	.byte	0x1b
+	.long	0x2ed
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x21
+	.long	0x2f9
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x31a
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x52
+	.byte	0x1b
+	.long	0x326
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x59
+	.byte	0x24
+	.long	0x347
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x61
+	.byte	0x1c
+	.long	0x2ac
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x62
+	.byte	0x18
+	.long	0x386
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x68
+	.byte	0x11
+	.long	0xd0
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xb
+	.long	0xa5
+	.byte	0x68
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x10
+	.byte	0x8
+	.byte	0x22
+	.byte	0x9
+	.long	0x26a
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x23
+	.byte	0xe
+	.long	0x13b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x24
+	.byte	0xe
+	.long	0x13b
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0x13b
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0x13b
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x22c
+	.uleb128 0x5
+	.long	0x26a
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x32
+	.byte	0xf
+	.long	0x287
+	.uleb128 0x6
+	.long	0x28c
+	.uleb128 0x12
+	.long	0x2a0
+	.long	0x2a0
+	.uleb128 0x2
+	.long	0x2a7
+	.uleb128 0x2
+	.long	0xd0
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF47
+	.uleb128 0x6
+	.long	0x15d
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x2b8
+	.uleb128 0x6
+	.long	0x2bd
+	.uleb128 0x12
+	.long	0x2a0
+	.long	0x2d1
+	.uleb128 0x2
+	.long	0x2a7
+	.uleb128 0x2
+	.long	0x54
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x36
+	.byte	0x10
+	.long	0x2dd
+	.uleb128 0x6
+	.long	0x2e2
+	.uleb128 0xd
+	.long	0x2ed
+	.uleb128 0x2
+	.long	0x2a7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x37
+	.byte	0x10
+	.long	0x2dd
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x38
+	.byte	0x10
+	.long	0x305
+	.uleb128 0x6
+	.long	0x30a
+	.uleb128 0xd
+	.long	0x31a
+	.uleb128 0x2
+	.long	0x2a7
+	.uleb128 0x2
+	.long	0x136
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x10
+	.long	0x2dd
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x10
+	.long	0x332
+	.uleb128 0x6
+	.long	0x337
+	.uleb128 0xd
+	.long	0x347
+	.uleb128 0x2
+	.long	0x2a7
+	.uleb128 0x2
+	.long	0x6e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x10
+	.long	0x353
+	.uleb128 0x6
+	.long	0x358
+	.uleb128 0xd
+	.long	0x372
+	.uleb128 0x2
+	.long	0x2a7
+	.uleb128 0x2
+	.long	0x377
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x381
+	.byte	0
+	.uleb128 0x6
+	.long	0x276
+	.uleb128 0x5
+	.long	0x372
+	.uleb128 0x6
+	.long	0x125
+	.uleb128 0x5
+	.long	0x37c
+	.uleb128 0x6
+	.long	0xd5
+	.uleb128 0xe
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x14
+	.long	0x15d
+	.uleb128 0xe
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x15
+	.long	0x67
+	.uleb128 0xe
+	.long	.LASF57
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x13
+	.long	0x136
+	.long	0x3bf
+	.uleb128 0x14
+	.long	0x46
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x5
+	.long	0x3af
+	.uleb128 0x1e
+	.long	.LASF58
+	.byte	0xc
+	.byte	0x10
+	.byte	0x17
+	.long	0x3bf
+	.value	0x100
+	.byte	0x8
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0x10
+	.byte	0
+	.byte	0x11
+	.byte	0
+	.byte	0x12
+	.byte	0
+	.byte	0x13
+	.byte	0
+	.byte	0x15
+	.byte	0
+	.byte	0x16
+	.byte	0
+	.byte	0x17
+	.byte	0
+	.byte	0x18
+	.byte	0
+	.byte	0x1a
+	.byte	0
+	.byte	0x1c
+	.byte	0
+	.byte	0x1d
+	.byte	0
+	.byte	0x1f
+	.byte	0
+	.byte	0x21
+	.byte	0
+	.byte	0x23
+	.byte	0
+	.byte	0x25
+	.byte	0
+	.byte	0x27
+	.byte	0
+	.byte	0x29
+	.byte	0
+	.byte	0x2c
+	.byte	0
+	.byte	0x2e
+	.byte	0
+	.byte	0x31
+	.byte	0
+	.byte	0x34
+	.byte	0
+	.byte	0x37
+	.byte	0
+	.byte	0x3a
+	.byte	0
+	.byte	0x3e
+	.byte	0
+	.byte	0x41
+	.byte	0
+	.byte	0x45
+	.byte	0
+	.byte	0x49
+	.byte	0
+	.byte	0x4e
+	.byte	0
+	.byte	0x52
+	.byte	0
+	.byte	0x57
+	.byte	0
+	.byte	0x5c
+	.byte	0
+	.byte	0x62
+	.byte	0
+	.byte	0x68
+	.byte	0
+	.byte	0x6e
+	.byte	0
+	.byte	0x75
+	.byte	0
+	.byte	0x7b
+	.byte	0
+	.byte	0x83
+	.byte	0
+	.byte	0x8b
+	.byte	0
+	.byte	0x93
+	.byte	0
+	.byte	0x9c
+	.byte	0
+	.byte	0xa5
+	.byte	0
+	.byte	0xaf
+	.byte	0
+	.byte	0xb9
+	.byte	0
+	.byte	0xc4
+	.byte	0
+	.byte	0xd0
+	.byte	0
+	.byte	0xdc
+	.byte	0
+	.byte	0xe9
+	.byte	0
+	.byte	0xf7
+	.byte	0
+	.byte	0x6
+	.byte	0x1
+	.byte	0x15
+	.byte	0x1
+	.byte	0x26
+	.byte	0x1
+	.byte	0x37
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x1
+	.byte	0x72
+	.byte	0x1
+	.byte	0x88
+	.byte	0x1
+	.byte	0x9f
+	.byte	0x1
+	.byte	0xb8
+	.byte	0x1
+	.byte	0xd2
+	.byte	0x1
+	.byte	0xee
+	.byte	0x1
+	.byte	0xb
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x2
+	.byte	0x4b
+	.byte	0x2
+	.byte	0x6e
+	.byte	0x2
+	.byte	0x93
+	.byte	0x2
+	.byte	0xba
+	.byte	0x2
+	.byte	0xe4
+	.byte	0x2
+	.byte	0x10
+	.byte	0x3
+	.byte	0x3f
+	.byte	0x3
+	.byte	0x70
+	.byte	0x3
+	.byte	0xa4
+	.byte	0x3
+	.byte	0xdc
+	.byte	0x3
+	.byte	0x17
+	.byte	0x4
+	.byte	0x55
+	.byte	0x4
+	.byte	0x97
+	.byte	0x4
+	.byte	0xdd
+	.byte	0x4
+	.byte	0x27
+	.byte	0x5
+	.byte	0x75
+	.byte	0x5
+	.byte	0xc8
+	.byte	0x5
+	.byte	0x20
+	.byte	0x6
+	.byte	0x7d
+	.byte	0x6
+	.byte	0xe0
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.byte	0xb8
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x8
+	.byte	0xa9
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x9
+	.byte	0xb9
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xa
+	.byte	0xea
+	.byte	0xa
+	.byte	0x90
+	.byte	0xb
+	.byte	0x40
+	.byte	0xc
+	.byte	0xfa
+	.byte	0xc
+	.byte	0xc0
+	.byte	0xd
+	.byte	0x91
+	.byte	0xe
+	.byte	0x6f
+	.byte	0xf
+	.byte	0x5a
+	.byte	0x10
+	.byte	0x53
+	.byte	0x11
+	.byte	0x5b
+	.byte	0x12
+	.byte	0x72
+	.byte	0x13
+	.byte	0x9a
+	.byte	0x14
+	.byte	0xd4
+	.byte	0x15
+	.byte	0x20
+	.byte	0x17
+	.byte	0x80
+	.byte	0x18
+	.byte	0xf5
+	.byte	0x19
+	.byte	0x80
+	.byte	0x1b
+	.byte	0x23
+	.byte	0x1d
+	.byte	0xde
+	.byte	0x1e
+	.byte	0xb4
+	.byte	0x20
+	.byte	0xa6
+	.byte	0x22
+	.byte	0xb5
+	.byte	0x24
+	.byte	0xe4
+	.byte	0x26
+	.byte	0x34
+	.byte	0x29
+	.byte	0xa7
+	.byte	0x2b
+	.byte	0x40
+	.byte	0x2e
+	.byte	0
+	.byte	0x31
+	.uleb128 0xf
+	.long	.LASF59
+	.byte	0xc
+	.byte	0x98
+	.byte	0x17
+	.long	0x3bf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	beep_note_console_divisor
+	.uleb128 0x13
+	.long	0xd5
+	.long	0x4f8
+	.uleb128 0x14
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	0x4e8
+	.uleb128 0xf
+	.long	.LASF60
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x13
+	.long	0x4f8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	console_default_devices
+	.uleb128 0x1f
+	.long	0x38b
+	.byte	0x1
+	.byte	0xae
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	console_driver
+	.uleb128 0x15
+	.long	.LASF61
+	.byte	0xd
+	.value	0x166
+	.long	0x4d
+	.long	0x53b
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF65
+	.byte	0x58
+	.long	0x55a
+	.uleb128 0x2
+	.long	0xd5
+	.uleb128 0x2
+	.long	0x55f
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x6e
+	.byte	0
+	.uleb128 0x6
+	.long	0x564
+	.uleb128 0x5
+	.long	0x55a
+	.uleb128 0x20
+	.uleb128 0x15
+	.long	.LASF62
+	.byte	0xe
+	.value	0x119
+	.long	0x4d
+	.long	0x580
+	.uleb128 0x2
+	.long	0x580
+	.uleb128 0x2
+	.long	0x585
+	.byte	0
+	.uleb128 0x6
+	.long	0x101
+	.uleb128 0x6
+	.long	0xda
+	.uleb128 0x21
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x47
+	.byte	0x6
+	.long	0x59c
+	.uleb128 0x2
+	.long	0xd5
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF64
+	.byte	0xf
+	.byte	0x2a
+	.byte	0xc
+	.long	0x4d
+	.long	0x5b8
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF66
+	.byte	0x43
+	.long	0x5c9
+	.uleb128 0x2
+	.long	0xd5
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF73
+	.byte	0x8d
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77c
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x8d
+	.byte	0x28
+	.long	0x2a7
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.long	.LASF68
+	.byte	0x8e
+	.byte	0x32
+	.long	0x377
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.long	.LASF69
+	.byte	0x8e
+	.byte	0x46
+	.long	0x41
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x7
+	.long	.LASF70
+	.byte	0x8f
+	.byte	0x3e
+	.long	0x381
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x18
+	.long	.LLRL12
+	.long	0x742
+	.uleb128 0x23
+	.string	"i"
+	.byte	0x1
+	.byte	0x93
+	.byte	0x11
+	.long	0x35
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x24
+	.long	.LLRL14
+	.uleb128 0x10
+	.long	.LASF71
+	.byte	0x94
+	.byte	0x20
+	.long	0x377
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x18
+	.long	.LLRL16
+	.long	0x6e9
+	.uleb128 0x10
+	.long	.LASF72
+	.byte	0x99
+	.byte	0x1d
+	.long	0x158
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x25
+	.long	0x7e5
+	.quad	.LBI10
+	.byte	.LVU125
+	.long	.LLRL18
+	.byte	0x1
+	.byte	0x9a
+	.byte	0x13
+	.long	0x6a7
+	.uleb128 0x26
+	.long	0x7f6
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL50
+	.long	0x59c
+	.long	0x6c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b30
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL51
+	.long	0x77c
+	.uleb128 0xa
+	.quad	.LVL54
+	.long	0x58a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL39
+	.long	0x77c
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x89b
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL44
+	.long	0x77c
+	.uleb128 0x9
+	.quad	.LVL45
+	.long	0x803
+	.long	0x733
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL46
+	.long	0x77c
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL37
+	.long	0x5b8
+	.long	0x767
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL59
+	.long	0x803
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF74
+	.byte	0x72
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e5
+	.uleb128 0x7
+	.long	.LASF75
+	.byte	0x72
+	.byte	0x26
+	.long	0x147
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xf
+	.long	.LASF76
+	.byte	0x1
+	.byte	0x75
+	.byte	0x1b
+	.long	0x101
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9
+	.quad	.LVL13
+	.long	0x565
+	.long	0x7d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL14
+	.long	0xac4
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x68
+	.byte	0xb
+	.long	0x14c
+	.byte	0x1
+	.long	0x803
+	.uleb128 0x28
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x68
+	.byte	0x32
+	.long	0x377
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF77
+	.byte	0x5d
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x89b
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x5d
+	.byte	0x23
+	.long	0x2a7
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x9
+	.quad	.LVL17
+	.long	0x59c
+	.long	0x850
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b2f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL20
+	.long	0x53b
+	.long	0x87f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL21
+	.long	0x58a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF78
+	.byte	0x51
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x95a
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x51
+	.byte	0x25
+	.long	0x2a7
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x7
+	.long	.LASF41
+	.byte	0x51
+	.byte	0x3c
+	.long	0x136
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x10
+	.long	.LASF72
+	.byte	0x54
+	.byte	0x15
+	.long	0x158
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.quad	.LVL25
+	.long	0x59c
+	.long	0x909
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b2f
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL30
+	.long	0x53b
+	.long	0x93e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL32
+	.long	0x58a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF79
+	.byte	0x48
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9b8
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x48
+	.byte	0x1f
+	.long	0x2a7
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xc
+	.quad	.LVL62
+	.long	0x525
+	.uleb128 0xa
+	.quad	.LVL65
+	.long	0x5b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF80
+	.byte	0x41
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa0a
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x41
+	.byte	0x1f
+	.long	0x2a7
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.quad	.LVL2
+	.long	0x5b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF83
+	.byte	0x1
+	.byte	0x35
+	.byte	0x5
+	.long	0x2a0
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xac4
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x35
+	.byte	0x1f
+	.long	0x2a7
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF38
+	.byte	0x35
+	.byte	0x31
+	.long	0x54
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.quad	.LVL5
+	.long	0x59c
+	.long	0xa76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b2f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL9
+	.long	0x5b8
+	.long	0xaa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL10
+	.long	0x5b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF84
+	.long	.LASF84
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU96
+	.uleb128 .LVU143
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU96
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU143
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU131
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU136
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU125
+	.uleb128 .LVU131
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF61:
+	.string	"close"
+.LASF17:
+	.string	"tv_nsec"
+.LASF41:
+	.string	"freq"
+.LASF83:
+	.string	"driver_probe"
+.LASF16:
+	.string	"tv_sec"
+.LASF59:
+	.string	"beep_note_console_divisor"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF37:
+	.string	"default_devices"
+.LASF32:
+	.string	"begin_tone"
+.LASF65:
+	.string	"log_deferred"
+.LASF71:
+	.string	"tone"
+.LASF43:
+	.string	"delay"
+.LASF10:
+	.string	"__uint16_t"
+.LASF46:
+	.string	"beep_driver_detect_func"
+.LASF53:
+	.string	"beep_driver_wait_func"
+.LASF68:
+	.string	"tones"
+.LASF73:
+	.string	"driver_play_sequence"
+.LASF79:
+	.string	"driver_fini"
+.LASF38:
+	.string	"device_fd"
+.LASF23:
+	.string	"uintptr_t"
+.LASF34:
+	.string	"wait"
+.LASF29:
+	.string	"detect"
+.LASF75:
+	.string	"milliseconds"
+.LASF18:
+	.string	"long long int"
+.LASF2:
+	.string	"long int"
+.LASF24:
+	.string	"beep_driver"
+.LASF80:
+	.string	"driver_init"
+.LASF20:
+	.string	"sig_atomic_t"
+.LASF55:
+	.string	"console_driver"
+.LASF56:
+	.string	"syscall_count"
+.LASF27:
+	.string	"name"
+.LASF78:
+	.string	"driver_begin_tone"
+.LASF42:
+	.string	"length"
+.LASF40:
+	.string	"driver_data"
+.LASF60:
+	.string	"console_default_devices"
+.LASF13:
+	.string	"__syscall_slong_t"
+.LASF15:
+	.string	"__sig_atomic_t"
+.LASF4:
+	.string	"unsigned char"
+.LASF39:
+	.string	"device_name"
+.LASF7:
+	.string	"signed char"
+.LASF44:
+	.string	"flags"
+.LASF19:
+	.string	"long long unsigned int"
+.LASF22:
+	.string	"uint32_t"
+.LASF6:
+	.string	"unsigned int"
+.LASF72:
+	.string	"argp"
+.LASF64:
+	.string	"ioctl"
+.LASF36:
+	.string	"probe"
+.LASF67:
+	.string	"driver"
+.LASF76:
+	.string	"request"
+.LASF66:
+	.string	"log_verbose"
+.LASF70:
+	.string	"abort_flag"
+.LASF50:
+	.string	"beep_driver_fini_func"
+.LASF14:
+	.string	"char"
+.LASF21:
+	.string	"uint16_t"
+.LASF26:
+	.string	"_beep_driver"
+.LASF49:
+	.string	"beep_driver_init_func"
+.LASF57:
+	.string	"log_level"
+.LASF5:
+	.string	"short unsigned int"
+.LASF77:
+	.string	"driver_end_tone"
+.LASF45:
+	.string	"beep_tone"
+.LASF33:
+	.string	"end_tone"
+.LASF47:
+	.string	"_Bool"
+.LASF51:
+	.string	"beep_driver_begin_tone_func"
+.LASF35:
+	.string	"play_sequence"
+.LASF31:
+	.string	"fini"
+.LASF3:
+	.string	"long unsigned int"
+.LASF74:
+	.string	"console_sleep_ms"
+.LASF12:
+	.string	"__time_t"
+.LASF11:
+	.string	"__uint32_t"
+.LASF54:
+	.string	"beep_driver_play_sequence_func"
+.LASF69:
+	.string	"count"
+.LASF63:
+	.string	"safe_error_exit"
+.LASF62:
+	.string	"nanosleep"
+.LASF48:
+	.string	"beep_driver_probe_func"
+.LASF58:
+	.string	"beep_note_freq"
+.LASF25:
+	.string	"timespec"
+.LASF52:
+	.string	"beep_driver_end_tone_func"
+.LASF84:
+	.string	"__stack_chk_fail"
+.LASF81:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF82:
+	.string	"console_divisor"
+.LASF28:
+	.string	"next"
+.LASF30:
+	.string	"init"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-console.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -38,49 +38,22 @@
 
 
 static
-int open_checked_device(const char *const device_name)
-{
-    const int fd = open_checked_char_device(device_name);
-    if (fd == -1) {
-        return -1;
-    }
-
-    if (-1 == ioctl(fd, EVIOCGSND(0))) {
-        log_verbose("evdev: %d does not implement EV_SND API", fd);
-        return -1;
-    }
-
-    return fd;
-}
+const char *const evdev_default_devices[] =
+    {
+     "/dev/input/by-path/platform-pcspkr-event-spkr",
+     NULL
+    };
 
 
 static
-bool driver_detect(beep_driver *driver, const char *console_device)
+bool driver_probe(beep_driver *driver, const int device_fd)
 {
-    if (console_device) {
-        log_verbose("evdev driver_detect %p %s",
-                    (void *)driver, console_device);
-    } else {
-        log_verbose("evdev driver_detect %p %p",
-                    (void *)driver, (const void *)console_device);
+    log_verbose("evdev driver_probe %p %d", (void *)driver, device_fd);
+    if (-1 == COUNT_SYSCALL(ioctl(device_fd, EVIOCGSND(0)))) {
+        log_verbose("evdev: %d does not implement EV_SND API", device_fd);
+        return false;
     }
-    if (console_device) {
-        const int fd = open_checked_device(console_device);
-        if (fd >= 0) {
-            driver->device_fd = fd;
-            driver->device_name = console_device;
-            return true;
-        }
-    } else {
-        static const char *const default_name = "/dev/input/by-path/platform-pcspkr-event-spkr";
-        const int fd = open_checked_device(default_name);
-        if (fd >= 0) {
-            driver->device_fd = fd;
-            driver->device_name = default_name;
-            return true;
-        }
-    }
-    return false;
+    return true;
 }
 
 
@@ -103,7 +76,7 @@ void driver_fini(beep_driver *driver)
 static
 void driver_begin_tone(beep_driver *driver, const uint16_t freq)
 {
-    log_verbose("evdev driver_begin_tone %p %u", (void *)driver, freq);
+    log_verbose_deferred_u("evdev driver_begin_tone %p %u", (void *)driver, freq);
 
     struct input_event e;
 
@@ -122,7 +95,7 @@ void driver_begin_tone(beep_driver *driver, const uint16_t freq)
 static
 void driver_end_tone(beep_driver *driver)
 {
-    log_verbose("evdev driver_end_tone %p", (void *)driver);
+    log_verbose_deferred("evdev driver_end_tone %p", (void *)driver);
 
     struct input_event e;
 
@@ -141,12 +114,17 @@ beep_driver evdev_driver =
     {
      "evdev",
      NULL,
-     driver_detect,
+     NULL,
      driver_init,
      driver_fini,
      driver_begin_tone,
      driver_end_tone,
+     NULL,
+     NULL,
+     driver_probe,
+     evdev_default_devices,
      0,
+     NULL,
      NULL
     };
 
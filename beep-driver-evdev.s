@@ -0,0 +1,2515 @@
+	.file	"beep-driver-evdev.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-evdev.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"evdev driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL0:
+.LFB32:
+	.file 1 "beep-driver-evdev.c"
+	.loc 1 62 1 view -0
+	.cfi_startproc
+	.loc 1 62 1 is_stmt 0 view .LVU1
+	endbr64
+	.loc 1 63 5 is_stmt 1 view .LVU2
+	.loc 1 63 10 view .LVU3
+	.loc 1 63 13 is_stmt 0 view .LVU4
+	cmpl	$0, log_level(%rip)
+	jg	.L7
+	ret
+.L7:
+	.loc 1 62 1 discriminator 1 view .LVU5
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 63 46 is_stmt 1 discriminator 1 view .LVU6
+	movq	%rdi, %rsi
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 63 46 is_stmt 0 discriminator 1 view .LVU7
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL2:
+	.loc 1 63 8 is_stmt 1 discriminator 1 view .LVU8
+	.loc 1 64 1 is_stmt 0 discriminator 1 view .LVU9
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.1
+.LC1:
+	.string	"evdev driver_probe %p %d"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"evdev: %d does not implement EV_SND API"
+	.text
+	.type	driver_probe, @function
+driver_probe:
+.LVL3:
+.LFB31:
+	.loc 1 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 1 is_stmt 0 view .LVU11
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%esi, %ebx
+	.loc 1 51 5 is_stmt 1 view .LVU12
+	.loc 1 51 10 view .LVU13
+	.loc 1 51 13 is_stmt 0 view .LVU14
+	cmpl	$0, log_level(%rip)
+	jg	.L14
+.LVL4:
+.L9:
+	.loc 1 51 8 is_stmt 1 discriminator 3 view .LVU15
+	.loc 1 52 5 discriminator 3 view .LVU16
+	.loc 1 52 16 is_stmt 0 discriminator 3 view .LVU17
+	addl	$1, syscall_count(%rip)
+	.loc 1 52 34 discriminator 3 view .LVU18
+	movl	$2147501338, %esi
+	movl	%ebx, %edi
+	movl	$0, %eax
+	call	ioctl@PLT
+.LVL5:
+	movl	%eax, %edx
+	.loc 1 56 11 discriminator 3 view .LVU19
+	movl	$1, %eax
+	.loc 1 52 8 discriminator 3 view .LVU20
+	cmpl	$-1, %edx
+	je	.L15
+.L8:
+	.loc 1 57 1 view .LVU21
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL6:
+	.loc 1 57 1 view .LVU22
+	ret
+.LVL7:
+.L14:
+	.cfi_restore_state
+	.loc 1 51 46 is_stmt 1 discriminator 1 view .LVU23
+	movl	%esi, %edx
+	movq	%rdi, %rsi
+	leaq	.LC1(%rip), %rdi
+.LVL8:
+	.loc 1 51 46 is_stmt 0 discriminator 1 view .LVU24
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL9:
+	.loc 1 51 46 discriminator 1 view .LVU25
+	jmp	.L9
+.L15:
+	.loc 1 53 9 is_stmt 1 view .LVU26
+	.loc 1 53 14 view .LVU27
+	.loc 1 54 15 is_stmt 0 view .LVU28
+	movl	$0, %eax
+	.loc 1 53 17 view .LVU29
+	cmpl	$0, log_level(%rip)
+	jle	.L8
+	.loc 1 53 50 is_stmt 1 discriminator 1 view .LVU30
+	movl	%ebx, %esi
+	leaq	.LC2(%rip), %rdi
+	call	log_verbose@PLT
+.LVL10:
+	.loc 1 54 15 is_stmt 0 discriminator 1 view .LVU31
+	movl	$0, %eax
+	jmp	.L8
+	.cfi_endproc
+.LFE31:
+	.size	driver_probe, .-driver_probe
+	.section	.rodata.str1.1
+.LC3:
+	.string	"evdev driver_fini %p"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL11:
+.LFB33:
+	.loc 1 69 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 69 1 is_stmt 0 view .LVU33
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 70 5 is_stmt 1 view .LVU34
+	.loc 1 70 10 view .LVU35
+	.loc 1 70 13 is_stmt 0 view .LVU36
+	cmpl	$0, log_level(%rip)
+	jg	.L19
+.LVL12:
+.L17:
+	.loc 1 70 8 is_stmt 1 discriminator 3 view .LVU37
+	.loc 1 71 5 discriminator 3 view .LVU38
+	movl	88(%rbx), %edi
+	call	close@PLT
+.LVL13:
+	.loc 1 72 5 discriminator 3 view .LVU39
+	.loc 1 72 23 is_stmt 0 discriminator 3 view .LVU40
+	movl	$-1, 88(%rbx)
+	.loc 1 73 1 discriminator 3 view .LVU41
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL14:
+	.loc 1 73 1 discriminator 3 view .LVU42
+	ret
+.LVL15:
+.L19:
+	.cfi_restore_state
+	.loc 1 70 46 is_stmt 1 discriminator 1 view .LVU43
+	movq	%rdi, %rsi
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL16:
+	jmp	.L17
+	.cfi_endproc
+.LFE33:
+	.size	driver_fini, .-driver_fini
+	.section	.rodata.str1.1
+.LC4:
+	.string	"evdev driver_end_tone %p"
+.LC5:
+	.string	"write EV_SND"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL17:
+.LFB35:
+	.loc 1 97 1 view -0
+	.cfi_startproc
+	.loc 1 97 1 is_stmt 0 view .LVU45
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	.loc 1 97 1 view .LVU46
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 98 5 is_stmt 1 view .LVU47
+	.loc 1 98 10 view .LVU48
+	.loc 1 98 92 view .LVU49
+	.loc 1 98 95 is_stmt 0 view .LVU50
+	cmpl	$0, log_level(%rip)
+	jg	.L25
+.LVL18:
+.L21:
+	.loc 1 98 8 is_stmt 1 discriminator 6 view .LVU51
+	.loc 1 100 5 discriminator 6 view .LVU52
+	.loc 1 102 5 discriminator 6 view .LVU53
+.LBB6:
+.LBI6:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/strings_fortified.h"
+	.loc 2 30 42 discriminator 6 view .LVU54
+.LBB7:
+	.loc 2 32 3 discriminator 6 view .LVU55
+	.loc 2 32 10 is_stmt 0 discriminator 6 view .LVU56
+	movq	%rsp, %rsi
+.LVL19:
+	.loc 2 32 10 discriminator 6 view .LVU57
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, (%rsp)
+	movq	$0, 16(%rsp)
+.LVL20:
+	.loc 2 32 10 discriminator 6 view .LVU58
+.LBE7:
+.LBE6:
+	.loc 1 103 5 is_stmt 1 discriminator 6 view .LVU59
+	.loc 1 103 12 is_stmt 0 discriminator 6 view .LVU60
+	movw	$18, 16(%rsp)
+	.loc 1 104 5 is_stmt 1 discriminator 6 view .LVU61
+	.loc 1 104 12 is_stmt 0 discriminator 6 view .LVU62
+	movw	$2, 18(%rsp)
+	.loc 1 105 5 is_stmt 1 discriminator 6 view .LVU63
+	.loc 1 107 5 discriminator 6 view .LVU64
+	.loc 1 107 22 is_stmt 0 discriminator 6 view .LVU65
+	movl	88(%rbx), %edi
+	movl	$24, %edx
+	call	write@PLT
+.LVL21:
+	.loc 1 107 8 discriminator 6 view .LVU66
+	cmpq	$24, %rax
+	jne	.L26
+	.loc 1 110 1 view .LVU67
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L27
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL22:
+	.loc 1 110 1 view .LVU68
+	ret
+.LVL23:
+.L25:
+	.cfi_restore_state
+	.loc 1 98 128 is_stmt 1 discriminator 4 view .LVU69
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rdi, %rsi
+	leaq	.LC4(%rip), %rdi
+	call	log_deferred@PLT
+.LVL24:
+	jmp	.L21
+.L26:
+	.loc 1 108 2 view .LVU70
+	leaq	.LC5(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL25:
+.L27:
+	.loc 1 110 1 is_stmt 0 view .LVU71
+	call	__stack_chk_fail@PLT
+.LVL26:
+	.cfi_endproc
+.LFE35:
+	.size	driver_end_tone, .-driver_end_tone
+	.section	.rodata.str1.1
+.LC6:
+	.string	"evdev driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL27:
+.LFB34:
+	.loc 1 78 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 78 1 is_stmt 0 view .LVU73
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbp
+	movl	%esi, %ebx
+	.loc 1 78 1 view .LVU74
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 79 5 is_stmt 1 view .LVU75
+	.loc 1 79 10 view .LVU76
+	.loc 1 79 103 view .LVU77
+	.loc 1 79 106 is_stmt 0 view .LVU78
+	cmpl	$0, log_level(%rip)
+	jg	.L33
+.LVL28:
+.L29:
+	.loc 1 79 8 is_stmt 1 discriminator 6 view .LVU79
+	.loc 1 81 5 discriminator 6 view .LVU80
+	.loc 1 83 5 discriminator 6 view .LVU81
+.LBB8:
+.LBI8:
+	.loc 2 30 42 discriminator 6 view .LVU82
+.LBB9:
+	.loc 2 32 3 discriminator 6 view .LVU83
+	.loc 2 32 10 is_stmt 0 discriminator 6 view .LVU84
+	movq	%rsp, %rsi
+.LVL29:
+	.loc 2 32 10 discriminator 6 view .LVU85
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, (%rsp)
+.LVL30:
+	.loc 2 32 10 discriminator 6 view .LVU86
+.LBE9:
+.LBE8:
+	.loc 1 84 5 is_stmt 1 discriminator 6 view .LVU87
+	.loc 1 84 12 is_stmt 0 discriminator 6 view .LVU88
+	movw	$18, 16(%rsp)
+	.loc 1 85 5 is_stmt 1 discriminator 6 view .LVU89
+	.loc 1 85 12 is_stmt 0 discriminator 6 view .LVU90
+	movw	$2, 18(%rsp)
+	.loc 1 86 5 is_stmt 1 discriminator 6 view .LVU91
+	.loc 1 86 13 is_stmt 0 discriminator 6 view .LVU92
+	movzwl	%bx, %ebx
+	movl	%ebx, 20(%rsp)
+	.loc 1 88 5 is_stmt 1 discriminator 6 view .LVU93
+	.loc 1 88 22 is_stmt 0 discriminator 6 view .LVU94
+	movl	88(%rbp), %edi
+	movl	$24, %edx
+	call	write@PLT
+.LVL31:
+	.loc 1 88 8 discriminator 6 view .LVU95
+	cmpq	$24, %rax
+	jne	.L34
+	.loc 1 92 1 view .LVU96
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L35
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL32:
+	.loc 1 92 1 view .LVU97
+	ret
+.LVL33:
+.L33:
+	.cfi_restore_state
+	.loc 1 79 139 is_stmt 1 discriminator 4 view .LVU98
+	movzwl	%si, %ecx
+	movl	$1, %edx
+	movq	%rdi, %rsi
+.LVL34:
+	.loc 1 79 139 is_stmt 0 discriminator 4 view .LVU99
+	leaq	.LC6(%rip), %rdi
+.LVL35:
+	.loc 1 79 139 discriminator 4 view .LVU100
+	call	log_deferred@PLT
+.LVL36:
+	.loc 1 79 139 discriminator 4 view .LVU101
+	jmp	.L29
+.L34:
+	.loc 1 90 2 is_stmt 1 view .LVU102
+	leaq	.LC5(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL37:
+.L35:
+	.loc 1 92 1 is_stmt 0 view .LVU103
+	call	__stack_chk_fail@PLT
+.LVL38:
+	.cfi_endproc
+.LFE34:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.globl	evdev_driver
+	.section	.rodata.str1.1
+.LC7:
+	.string	"evdev"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	evdev_driver, @object
+	.size	evdev_driver, 112
+evdev_driver:
+	.quad	.LC7
+	.quad	0
+	.quad	0
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	0
+	.quad	0
+	.quad	driver_probe
+	.quad	evdev_default_devices
+	.long	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"/dev/input/by-path/platform-pcspkr-event-spkr"
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	evdev_default_devices, @object
+	.size	evdev_default_devices, 16
+evdev_default_devices:
+	.quad	.LC8
+	.quad	0
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.file 7 "/usr/include/asm-generic/int-ll64.h"
+	.file 8 "/usr/include/linux/input.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "beep-driver.h"
+	.file 12 "beep-driver-evdev.h"
+	.file 13 "beep-library.h"
+	.file 14 "beep-log.h"
+	.file 15 "/usr/include/unistd.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/ioctl.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x86b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF81
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	0x35
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	0x4d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x5
+	.long	0x71
+	.uleb128 0x6
+	.long	0x60
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF5
+	.uleb128 0x6
+	.long	0x6a
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x6
+	.long	0x7d
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x7d
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xa2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0xc9
+	.uleb128 0xd
+	.long	.LASF24
+	.byte	0x10
+	.byte	0x6
+	.byte	0x8
+	.long	0x119
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x6
+	.byte	0xe
+	.byte	0xc
+	.long	0xaf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x6
+	.byte	0xf
+	.byte	0x11
+	.long	0xbb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF21
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x18
+	.byte	0x18
+	.long	0x59
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x18
+	.long	0x4d
+	.uleb128 0xd
+	.long	.LASF25
+	.byte	0x18
+	.byte	0x8
+	.byte	0x1a
+	.long	0x180
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x11
+	.long	0xf2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x8
+	.long	0x127
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x8
+	.long	0x127
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x8
+	.long	0x133
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x8
+	.byte	0x18
+	.long	0xda
+	.uleb128 0x6
+	.long	0x180
+	.uleb128 0x1b
+	.long	0x18c
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0xa
+	.byte	0x19
+	.byte	0x14
+	.long	0x97
+	.uleb128 0x6
+	.long	0x196
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa3
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x1bf
+	.uleb128 0xd
+	.long	.LASF34
+	.byte	0x70
+	.byte	0xb
+	.byte	0x43
+	.long	0x282
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0xb
+	.byte	0x44
+	.byte	0xb
+	.long	0xd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0xb
+	.byte	0x45
+	.byte	0x12
+	.long	0x2fd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0xb
+	.byte	0x47
+	.byte	0x1d
+	.long	0x2d1
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0xb
+	.byte	0x48
+	.byte	0x1b
+	.long	0x327
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0xb
+	.byte	0x49
+	.byte	0x1b
+	.long	0x343
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x21
+	.long	0x34f
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x370
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0xb
+	.byte	0x52
+	.byte	0x1b
+	.long	0x37c
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0xb
+	.byte	0x59
+	.byte	0x24
+	.long	0x39d
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0xb
+	.byte	0x61
+	.byte	0x1c
+	.long	0x302
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0xb
+	.byte	0x62
+	.byte	0x18
+	.long	0x3dc
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0xb
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0xb
+	.byte	0x68
+	.byte	0x11
+	.long	0x60
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0xb
+	.byte	0x6d
+	.byte	0xb
+	.long	0xc7
+	.byte	0x68
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x10
+	.byte	0xb
+	.byte	0x22
+	.byte	0x9
+	.long	0x2c0
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0xb
+	.byte	0x23
+	.byte	0xe
+	.long	0x1a7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0xb
+	.byte	0x24
+	.byte	0xe
+	.long	0x1a7
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0xb
+	.byte	0x25
+	.byte	0xe
+	.long	0x1a7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0xb
+	.byte	0x26
+	.byte	0xe
+	.long	0x1a7
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0xb
+	.byte	0x27
+	.byte	0x3
+	.long	0x282
+	.uleb128 0x6
+	.long	0x2c0
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0xb
+	.byte	0x32
+	.byte	0xf
+	.long	0x2dd
+	.uleb128 0x5
+	.long	0x2e2
+	.uleb128 0x11
+	.long	0x2f6
+	.long	0x2f6
+	.uleb128 0x1
+	.long	0x2fd
+	.uleb128 0x1
+	.long	0x60
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF55
+	.uleb128 0x5
+	.long	0x1b3
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0xb
+	.byte	0x34
+	.byte	0xf
+	.long	0x30e
+	.uleb128 0x5
+	.long	0x313
+	.uleb128 0x11
+	.long	0x2f6
+	.long	0x327
+	.uleb128 0x1
+	.long	0x2fd
+	.uleb128 0x1
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0xb
+	.byte	0x36
+	.byte	0x10
+	.long	0x333
+	.uleb128 0x5
+	.long	0x338
+	.uleb128 0xa
+	.long	0x343
+	.uleb128 0x1
+	.long	0x2fd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x37
+	.byte	0x10
+	.long	0x333
+	.uleb128 0x4
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x38
+	.byte	0x10
+	.long	0x35b
+	.uleb128 0x5
+	.long	0x360
+	.uleb128 0xa
+	.long	0x370
+	.uleb128 0x1
+	.long	0x2fd
+	.uleb128 0x1
+	.long	0x1a2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x10
+	.long	0x333
+	.uleb128 0x4
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x10
+	.long	0x388
+	.uleb128 0x5
+	.long	0x38d
+	.uleb128 0xa
+	.long	0x39d
+	.uleb128 0x1
+	.long	0x2fd
+	.uleb128 0x1
+	.long	0x84
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x10
+	.long	0x3a9
+	.uleb128 0x5
+	.long	0x3ae
+	.uleb128 0xa
+	.long	0x3c8
+	.uleb128 0x1
+	.long	0x2fd
+	.uleb128 0x1
+	.long	0x3cd
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x3d7
+	.byte	0
+	.uleb128 0x5
+	.long	0x2cc
+	.uleb128 0x6
+	.long	0x3c8
+	.uleb128 0x5
+	.long	0x191
+	.uleb128 0x6
+	.long	0x3d2
+	.uleb128 0x5
+	.long	0x65
+	.uleb128 0xe
+	.long	.LASF63
+	.byte	0xc
+	.byte	0x19
+	.byte	0x14
+	.long	0x1b3
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x15
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF65
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x1d
+	.long	0x65
+	.long	0x415
+	.uleb128 0x1e
+	.long	0x46
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	0x405
+	.uleb128 0x1f
+	.long	.LASF72
+	.byte	0x1
+	.byte	0x29
+	.byte	0x13
+	.long	0x415
+	.uleb128 0x9
+	.byte	0x3
+	.quad	evdev_default_devices
+	.uleb128 0x20
+	.long	0x3e1
+	.byte	0x1
+	.byte	0x71
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	evdev_driver
+	.uleb128 0x12
+	.long	.LASF66
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0x458
+	.uleb128 0x1
+	.long	0x4d
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF67
+	.byte	0xd
+	.byte	0x47
+	.byte	0x6
+	.long	0x46a
+	.uleb128 0x1
+	.long	0x65
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF68
+	.value	0x17a
+	.byte	0x10
+	.long	0xe6
+	.long	0x48a
+	.uleb128 0x1
+	.long	0x4d
+	.uleb128 0x1
+	.long	0x48a
+	.uleb128 0x1
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x494
+	.uleb128 0x6
+	.long	0x48a
+	.uleb128 0x22
+	.uleb128 0x13
+	.long	.LASF70
+	.byte	0x58
+	.long	0x4b4
+	.uleb128 0x1
+	.long	0x65
+	.uleb128 0x1
+	.long	0x48f
+	.uleb128 0x1
+	.long	0x54
+	.uleb128 0x1
+	.long	0x84
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF69
+	.byte	0x10
+	.byte	0x2a
+	.byte	0xc
+	.long	0x4d
+	.long	0x4d0
+	.uleb128 0x1
+	.long	0x4d
+	.uleb128 0x1
+	.long	0x46
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF71
+	.byte	0x43
+	.long	0x4e1
+	.uleb128 0x1
+	.long	0x65
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF73
+	.byte	0x60
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5d2
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x60
+	.byte	0x23
+	.long	0x2fd
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x15
+	.string	"e"
+	.byte	0x64
+	.long	0x13f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x16
+	.long	0x843
+	.quad	.LBI6
+	.byte	.LVU54
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.byte	0x66
+	.long	0x559
+	.uleb128 0xc
+	.long	0x85a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xc
+	.long	0x850
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL21
+	.long	0x46a
+	.long	0x576
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL24
+	.long	0x495
+	.long	0x5a5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL25
+	.long	0x458
+	.long	0x5c4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL26
+	.long	0x865
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF74
+	.byte	0x4d
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6dc
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x4d
+	.byte	0x25
+	.long	0x2fd
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.long	.LASF49
+	.byte	0x4d
+	.byte	0x3c
+	.long	0x1a2
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x15
+	.string	"e"
+	.byte	0x51
+	.long	0x13f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x16
+	.long	0x843
+	.quad	.LBI8
+	.byte	.LVU82
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.byte	0x53
+	.long	0x65d
+	.uleb128 0xc
+	.long	0x85a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xc
+	.long	0x850
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL31
+	.long	0x46a
+	.long	0x67a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL36
+	.long	0x495
+	.long	0x6af
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL37
+	.long	0x458
+	.long	0x6ce
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL38
+	.long	0x865
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF76
+	.byte	0x44
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x73a
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x44
+	.byte	0x1f
+	.long	0x2fd
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xf
+	.quad	.LVL13
+	.long	0x442
+	.uleb128 0x10
+	.quad	.LVL16
+	.long	0x4d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF77
+	.byte	0x3d
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x78c
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x3d
+	.byte	0x1f
+	.long	0x2fd
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x10
+	.quad	.LVL2
+	.long	0x4d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x31
+	.byte	0x5
+	.long	0x2f6
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x843
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x31
+	.byte	0x1f
+	.long	0x2fd
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.long	.LASF46
+	.byte	0x31
+	.byte	0x31
+	.long	0x54
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.quad	.LVL5
+	.long	0x4b4
+	.long	0x7f5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x8000451a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL9
+	.long	0x4d0
+	.long	0x821
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL10
+	.long	0x4d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF78
+	.byte	0x2
+	.byte	0x1e
+	.byte	0x2a
+	.byte	0x3
+	.long	0x865
+	.uleb128 0x17
+	.long	.LASF79
+	.byte	0x37
+	.long	0xc7
+	.uleb128 0x17
+	.long	.LASF80
+	.byte	0x46
+	.long	0x35
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF83
+	.long	.LASF83
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU58
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU82
+	.uleb128 .LVU86
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU86
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF66:
+	.string	"close"
+.LASF72:
+	.string	"evdev_default_devices"
+.LASF68:
+	.string	"write"
+.LASF82:
+	.string	"driver_probe"
+.LASF18:
+	.string	"tv_sec"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF45:
+	.string	"default_devices"
+.LASF23:
+	.string	"__s32"
+.LASF40:
+	.string	"begin_tone"
+.LASF70:
+	.string	"log_deferred"
+.LASF12:
+	.string	"__uint32_t"
+.LASF51:
+	.string	"delay"
+.LASF14:
+	.string	"__suseconds_t"
+.LASF11:
+	.string	"__uint16_t"
+.LASF17:
+	.string	"ssize_t"
+.LASF54:
+	.string	"beep_driver_detect_func"
+.LASF61:
+	.string	"beep_driver_wait_func"
+.LASF78:
+	.string	"bzero"
+.LASF76:
+	.string	"driver_fini"
+.LASF46:
+	.string	"device_fd"
+.LASF60:
+	.string	"beep_driver_end_tone_func"
+.LASF32:
+	.string	"uint32_t"
+.LASF42:
+	.string	"wait"
+.LASF37:
+	.string	"detect"
+.LASF49:
+	.string	"freq"
+.LASF21:
+	.string	"long long int"
+.LASF25:
+	.string	"input_event"
+.LASF15:
+	.string	"__ssize_t"
+.LASF2:
+	.string	"long int"
+.LASF79:
+	.string	"__dest"
+.LASF33:
+	.string	"beep_driver"
+.LASF77:
+	.string	"driver_init"
+.LASF30:
+	.string	"sig_atomic_t"
+.LASF64:
+	.string	"syscall_count"
+.LASF35:
+	.string	"name"
+.LASF74:
+	.string	"driver_begin_tone"
+.LASF50:
+	.string	"length"
+.LASF48:
+	.string	"driver_data"
+.LASF16:
+	.string	"__sig_atomic_t"
+.LASF6:
+	.string	"unsigned char"
+.LASF47:
+	.string	"device_name"
+.LASF63:
+	.string	"evdev_driver"
+.LASF8:
+	.string	"signed char"
+.LASF52:
+	.string	"flags"
+.LASF20:
+	.string	"long long unsigned int"
+.LASF27:
+	.string	"type"
+.LASF7:
+	.string	"unsigned int"
+.LASF31:
+	.string	"uint16_t"
+.LASF69:
+	.string	"ioctl"
+.LASF44:
+	.string	"probe"
+.LASF75:
+	.string	"driver"
+.LASF26:
+	.string	"time"
+.LASF71:
+	.string	"log_verbose"
+.LASF58:
+	.string	"beep_driver_fini_func"
+.LASF5:
+	.string	"char"
+.LASF38:
+	.string	"init"
+.LASF34:
+	.string	"_beep_driver"
+.LASF57:
+	.string	"beep_driver_init_func"
+.LASF65:
+	.string	"log_level"
+.LASF4:
+	.string	"short unsigned int"
+.LASF73:
+	.string	"driver_end_tone"
+.LASF53:
+	.string	"beep_tone"
+.LASF41:
+	.string	"end_tone"
+.LASF55:
+	.string	"_Bool"
+.LASF59:
+	.string	"beep_driver_begin_tone_func"
+.LASF43:
+	.string	"play_sequence"
+.LASF39:
+	.string	"fini"
+.LASF22:
+	.string	"__u16"
+.LASF3:
+	.string	"long unsigned int"
+.LASF13:
+	.string	"__time_t"
+.LASF24:
+	.string	"timeval"
+.LASF62:
+	.string	"beep_driver_play_sequence_func"
+.LASF19:
+	.string	"tv_usec"
+.LASF67:
+	.string	"safe_error_exit"
+.LASF56:
+	.string	"beep_driver_probe_func"
+.LASF80:
+	.string	"__len"
+.LASF28:
+	.string	"code"
+.LASF83:
+	.string	"__stack_chk_fail"
+.LASF29:
+	.string	"value"
+.LASF81:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF36:
+	.string	"next"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-evdev.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
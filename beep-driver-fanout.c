@@ -0,0 +1,231 @@
+/* beep-driver-fanout.c - implement the beep fan-out driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* The fan-out driver is used when more than one --device is given.
+ * It is never detected, but created by main() around the device
+ * driver instances.
+ *
+ * Every tone edge is sent to all devices in a tight loop.  Each
+ * device driver only does a single ioctl(2) or write(2) per edge, so
+ * this keeps the devices within microseconds of each other without
+ * the cost of one thread per device.  The skew from starting the
+ * first device until the last device has its edge is measured for
+ * every edge and reported at driver_fini() time with --verbose.
+ */
+
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <time.h>
+
+#include "beep-driver-fanout.h"
+
+#include "beep-drivers.h"
+#include "beep-log.h"
+
+
+typedef struct {
+    size_t        count;
+    bool          needs_sleep;  /* some device plays in real time */
+    unsigned long edges;
+    uint64_t      skew_sum_ns;
+    uint64_t      skew_max_ns;
+    beep_driver  *devices[BEEP_FANOUT_MAX_DEVICES];
+} fanout_data;
+
+
+static
+uint64_t fanout_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+static
+void fanout_account_skew(fanout_data *const data,
+                         const uint64_t first_ns, const uint64_t last_ns)
+{
+    const uint64_t skew_ns = last_ns - first_ns;
+    ++data->edges;
+    data->skew_sum_ns += skew_ns;
+    if (skew_ns > data->skew_max_ns) {
+        data->skew_max_ns = skew_ns;
+    }
+}
+
+
+static
+bool driver_detect(beep_driver *driver, const char *console_device)
+{
+    log_verbose("fanout driver_detect %p %p",
+                (void *)driver, (const void *)console_device);
+    /* Only ever created by fanout_driver_new() */
+    return false;
+}
+
+
+static
+void driver_init(beep_driver *driver)
+{
+    log_verbose("fanout driver_init %p", (void *)driver);
+    fanout_data *const data = driver->driver_data;
+    for (size_t i=0; i<data->count; ++i) {
+        beep_drivers_init(data->devices[i]);
+    }
+}
+
+
+static
+void driver_fini(beep_driver *driver)
+{
+    log_verbose("fanout driver_fini %p", (void *)driver);
+    fanout_data *const data = driver->driver_data;
+    for (size_t i=0; i<data->count; ++i) {
+        beep_drivers_fini(data->devices[i]);
+    }
+    if (data->edges > 0) {
+        log_verbose("fanout: %zu devices, %lu edges, "
+                    "skew mean %lu ns, max %lu ns",
+                    data->count, data->edges,
+                    (unsigned long)(data->skew_sum_ns / data->edges),
+                    (unsigned long)data->skew_max_ns);
+    }
+    free(driver->driver_data);
+    driver->driver_data = NULL;
+}
+
+
+static
+void driver_begin_tone(beep_driver *driver, const uint16_t freq)
+{
+    fanout_data *const data = driver->driver_data;
+
+    const uint64_t first_ns = fanout_now_ns();
+    for (size_t i=0; i<data->count; ++i) {
+        beep_drivers_begin_tone(data->devices[i], freq);
+    }
+    const uint64_t last_ns = fanout_now_ns();
+
+    fanout_account_skew(data, first_ns, last_ns);
+    log_verbose_deferred_u("fanout driver_begin_tone %p %u", (void *)driver, freq);
+}
+
+
+static
+void driver_end_tone(beep_driver *driver)
+{
+    fanout_data *const data = driver->driver_data;
+
+    const uint64_t first_ns = fanout_now_ns();
+    for (size_t i=0; i<data->count; ++i) {
+        beep_drivers_end_tone(data->devices[i]);
+    }
+    const uint64_t last_ns = fanout_now_ns();
+
+    fanout_account_skew(data, first_ns, last_ns);
+    log_verbose_deferred("fanout driver_end_tone %p", (void *)driver);
+}
+
+
+static
+void driver_wait(beep_driver *driver, const unsigned int milliseconds)
+{
+    fanout_data *const data = driver->driver_data;
+
+    /* Let the rendering devices account for the time first, then
+     * sleep once for all the real time devices.
+     */
+    for (size_t i=0; i<data->count; ++i) {
+        beep_driver *const device = data->devices[i];
+        if (device->wait) {
+            device->wait(device, milliseconds);
+        }
+    }
+    if (data->needs_sleep) {
+        const struct timespec request =
+            { milliseconds / 1000U,
+              (milliseconds % 1000UL) * 1000UL * 1000UL };
+        nanosleep(&request, NULL);
+    }
+}
+
+
+static
+beep_driver fanout_driver =
+    {
+     "fanout",
+     NULL,
+     driver_detect,
+     driver_init,
+     driver_fini,
+     driver_begin_tone,
+     driver_end_tone,
+     driver_wait,
+     NULL,
+     NULL,
+     NULL,
+     -1,
+     NULL,
+     NULL
+    };
+
+
+beep_driver *fanout_driver_new(beep_driver *const *const devices,
+                               const size_t count)
+{
+    if ((count == 0) || (count > BEEP_FANOUT_MAX_DEVICES)) {
+        return NULL;
+    }
+
+    beep_driver *const driver = malloc(sizeof(beep_driver));
+    fanout_data *const data = malloc(sizeof(fanout_data));
+    if ((!driver) || (!data)) {
+        free(driver);
+        free(data);
+        return NULL;
+    }
+
+    data->count = count;
+    data->needs_sleep = false;
+    data->edges = 0;
+    data->skew_sum_ns = 0;
+    data->skew_max_ns = 0;
+    for (size_t i=0; i<count; ++i) {
+        data->devices[i] = devices[i];
+        if (!devices[i]->wait) {
+            data->needs_sleep = true;
+        }
+    }
+
+    *driver = fanout_driver;
+    driver->device_name = devices[0]->device_name;
+    driver->driver_data = data;
+    return driver;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,54 @@
+/* beep-driver-fanout.h - interface to the beep fan-out driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_DRIVER_FANOUT_H
+#define BEEP_DRIVER_FANOUT_H
+
+
+#include <stddef.h>
+
+#include "beep-driver.h"
+
+
+/** Maximum number of devices one fan-out driver instance can drive */
+#define BEEP_FANOUT_MAX_DEVICES 16
+
+
+/** Create a driver instance playing every tone on all the given
+ * device driver instances, which must come from beep_drivers_detect().
+ *
+ * The fan-out driver takes over the device driver instances, i.e.
+ * beep_drivers_fini() on the fan-out driver finishes them as well.
+ *
+ * Returns NULL if out of memory.
+ */
+beep_driver *fanout_driver_new(beep_driver *const *const devices,
+                               const size_t count)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_DRIVER_FANOUT_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
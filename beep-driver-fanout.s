@@ -0,0 +1,3878 @@
+	.file	"beep-driver-fanout.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-fanout.c"
+	.type	driver_wait, @function
+driver_wait:
+.LVL0:
+.LFB24:
+	.file 1 "beep-driver-fanout.c"
+	.loc 1 151 1 view -0
+	.cfi_startproc
+	.loc 1 151 1 is_stmt 0 view .LVU1
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movl	%esi, %r12d
+	.loc 1 151 1 view .LVU2
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 152 5 is_stmt 1 view .LVU3
+	.loc 1 152 24 is_stmt 0 view .LVU4
+	movq	104(%rdi), %rbp
+.LVL1:
+	.loc 1 157 5 is_stmt 1 view .LVU5
+.LBB2:
+	.loc 1 157 10 view .LVU6
+	.loc 1 157 23 view .LVU7
+	cmpq	$0, 0(%rbp)
+	je	.L2
+	.loc 1 157 17 is_stmt 0 view .LVU8
+	movl	$0, %ebx
+	jmp	.L4
+.LVL2:
+.L9:
+.LBB3:
+	.loc 1 160 13 is_stmt 1 view .LVU9
+	movl	%r12d, %esi
+	call	*%rax
+.LVL3:
+.L3:
+	.loc 1 160 13 is_stmt 0 view .LVU10
+.LBE3:
+	.loc 1 157 37 is_stmt 1 discriminator 2 view .LVU11
+	addq	$1, %rbx
+.LVL4:
+	.loc 1 157 23 discriminator 2 view .LVU12
+	cmpq	0(%rbp), %rbx
+	jnb	.L2
+.LVL5:
+.L4:
+.LBB4:
+	.loc 1 158 9 view .LVU13
+	.loc 1 158 28 is_stmt 0 view .LVU14
+	movq	40(%rbp,%rbx,8), %rdi
+.LVL6:
+	.loc 1 159 9 is_stmt 1 view .LVU15
+	.loc 1 159 19 is_stmt 0 view .LVU16
+	movq	56(%rdi), %rax
+	.loc 1 159 12 view .LVU17
+	testq	%rax, %rax
+	jne	.L9
+	jmp	.L3
+.LVL7:
+.L2:
+	.loc 1 159 12 view .LVU18
+.LBE4:
+.LBE2:
+	.loc 1 163 5 is_stmt 1 view .LVU19
+	.loc 1 163 8 is_stmt 0 view .LVU20
+	cmpb	$0, 8(%rbp)
+	jne	.L10
+.LVL8:
+.L1:
+	.loc 1 169 1 view .LVU21
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L11
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 169 1 view .LVU22
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL10:
+.L10:
+	.cfi_restore_state
+.LBB5:
+	.loc 1 164 9 is_stmt 1 view .LVU23
+	.loc 1 165 28 is_stmt 0 view .LVU24
+	movl	%r12d, %eax
+	imulq	$274877907, %rax, %rax
+	shrq	$38, %rax
+	movl	%eax, %edx
+	movq	%rdx, (%rsp)
+	.loc 1 166 29 view .LVU25
+	imull	$1000, %eax, %eax
+	subl	%eax, %r12d
+.LVL11:
+	.loc 1 166 48 view .LVU26
+	imulq	$1000000, %r12, %r12
+	.loc 1 164 31 view .LVU27
+	movq	%r12, 8(%rsp)
+	.loc 1 167 9 is_stmt 1 view .LVU28
+	movq	%rsp, %rdi
+	movl	$0, %esi
+	call	nanosleep@PLT
+.LVL12:
+.LBE5:
+	.loc 1 169 1 is_stmt 0 view .LVU29
+	jmp	.L1
+.L11:
+	.loc 1 169 1 view .LVU30
+	call	__stack_chk_fail@PLT
+.LVL13:
+	.cfi_endproc
+.LFE24:
+	.size	driver_wait, .-driver_wait
+	.type	fanout_now_ns, @function
+fanout_now_ns:
+.LFB17:
+	.loc 1 56 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 56 1 is_stmt 0 view .LVU32
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 57 5 is_stmt 1 view .LVU33
+	.loc 1 58 5 view .LVU34
+	movq	%rsp, %rsi
+	movl	$1, %edi
+	call	clock_gettime@PLT
+.LVL14:
+	.loc 1 59 5 view .LVU35
+	.loc 1 59 32 is_stmt 0 view .LVU36
+	imulq	$1000000000, (%rsp), %rax
+	.loc 1 59 46 view .LVU37
+	addq	8(%rsp), %rax
+	.loc 1 60 1 view .LVU38
+	movq	24(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L15
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L15:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL15:
+	.cfi_endproc
+.LFE17:
+	.size	fanout_now_ns, .-fanout_now_ns
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"fanout driver_end_tone %p"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL16:
+.LFB23:
+	.loc 1 135 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 135 1 is_stmt 0 view .LVU40
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r12
+	.loc 1 136 5 is_stmt 1 view .LVU41
+	.loc 1 136 24 is_stmt 0 view .LVU42
+	movq	104(%rdi), %rbp
+.LVL17:
+	.loc 1 138 5 is_stmt 1 view .LVU43
+	.loc 1 138 31 is_stmt 0 view .LVU44
+	call	fanout_now_ns
+.LVL18:
+	.loc 1 138 31 view .LVU45
+	movq	%rax, %r13
+.LVL19:
+	.loc 1 139 5 is_stmt 1 view .LVU46
+.LBB9:
+	.loc 1 139 10 view .LVU47
+	.loc 1 139 23 view .LVU48
+	cmpq	$0, 0(%rbp)
+	je	.L17
+	.loc 1 139 17 is_stmt 0 view .LVU49
+	movl	$0, %ebx
+.LVL20:
+.L18:
+	.loc 1 140 9 is_stmt 1 discriminator 3 view .LVU50
+	movq	40(%rbp,%rbx,8), %rdi
+	call	beep_drivers_end_tone@PLT
+.LVL21:
+	.loc 1 139 37 discriminator 3 view .LVU51
+	addq	$1, %rbx
+.LVL22:
+	.loc 1 139 23 discriminator 3 view .LVU52
+	cmpq	0(%rbp), %rbx
+	jb	.L18
+.LVL23:
+.L17:
+	.loc 1 139 23 is_stmt 0 discriminator 3 view .LVU53
+.LBE9:
+	.loc 1 142 5 is_stmt 1 view .LVU54
+	.loc 1 142 30 is_stmt 0 view .LVU55
+	call	fanout_now_ns
+.LVL24:
+	.loc 1 144 5 is_stmt 1 view .LVU56
+.LBB10:
+.LBI10:
+	.loc 1 64 6 view .LVU57
+.LBB11:
+	.loc 1 67 5 view .LVU58
+	.loc 1 67 20 is_stmt 0 view .LVU59
+	subq	%r13, %rax
+.LVL25:
+	.loc 1 68 5 is_stmt 1 view .LVU60
+	addq	$1, 16(%rbp)
+	.loc 1 69 5 view .LVU61
+	.loc 1 69 23 is_stmt 0 view .LVU62
+	addq	%rax, 24(%rbp)
+	.loc 1 70 5 is_stmt 1 view .LVU63
+	.loc 1 70 8 is_stmt 0 view .LVU64
+	cmpq	%rax, 32(%rbp)
+	jnb	.L19
+	.loc 1 71 9 is_stmt 1 view .LVU65
+	.loc 1 71 27 is_stmt 0 view .LVU66
+	movq	%rax, 32(%rbp)
+.L19:
+.LVL26:
+	.loc 1 71 27 view .LVU67
+.LBE11:
+.LBE10:
+	.loc 1 145 5 is_stmt 1 view .LVU68
+	.loc 1 145 10 view .LVU69
+	.loc 1 145 93 view .LVU70
+	.loc 1 145 96 is_stmt 0 view .LVU71
+	cmpl	$0, log_level(%rip)
+	jg	.L23
+.L16:
+	.loc 1 146 1 view .LVU72
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL27:
+	.loc 1 146 1 view .LVU73
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL28:
+	.loc 1 146 1 view .LVU74
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL29:
+	.loc 1 146 1 view .LVU75
+	ret
+.LVL30:
+.L23:
+	.cfi_restore_state
+	.loc 1 145 129 is_stmt 1 discriminator 4 view .LVU76
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%r12, %rsi
+	leaq	.LC0(%rip), %rdi
+	call	log_deferred@PLT
+.LVL31:
+	.loc 1 145 8 discriminator 4 view .LVU77
+	.loc 1 146 1 is_stmt 0 discriminator 4 view .LVU78
+	jmp	.L16
+	.cfi_endproc
+.LFE23:
+	.size	driver_end_tone, .-driver_end_tone
+	.section	.rodata.str1.1
+.LC1:
+	.string	"fanout driver_detect %p %p"
+	.text
+	.type	driver_detect, @function
+driver_detect:
+.LVL32:
+.LFB19:
+	.loc 1 78 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 78 1 is_stmt 0 view .LVU80
+	endbr64
+	.loc 1 79 5 is_stmt 1 view .LVU81
+	.loc 1 79 10 view .LVU82
+	.loc 1 79 13 is_stmt 0 view .LVU83
+	cmpl	$0, log_level(%rip)
+	jg	.L30
+	.loc 1 79 8 is_stmt 1 view .LVU84
+	.loc 1 82 5 view .LVU85
+	.loc 1 83 1 is_stmt 0 view .LVU86
+	movl	$0, %eax
+	ret
+.L30:
+	.loc 1 78 1 discriminator 1 view .LVU87
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 79 46 is_stmt 1 discriminator 1 view .LVU88
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+.LVL33:
+	.loc 1 79 46 is_stmt 0 discriminator 1 view .LVU89
+	leaq	.LC1(%rip), %rdi
+.LVL34:
+	.loc 1 79 46 discriminator 1 view .LVU90
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL35:
+	.loc 1 79 8 is_stmt 1 discriminator 1 view .LVU91
+	.loc 1 82 5 discriminator 1 view .LVU92
+	.loc 1 83 1 is_stmt 0 discriminator 1 view .LVU93
+	movl	$0, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	driver_detect, .-driver_detect
+	.section	.rodata.str1.1
+.LC2:
+	.string	"fanout driver_fini %p"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"fanout: %zu devices, %lu edges, skew mean %lu ns, max %lu ns"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL36:
+.LFB21:
+	.loc 1 99 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 1 is_stmt 0 view .LVU95
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12
+	.loc 1 100 5 is_stmt 1 view .LVU96
+	.loc 1 100 10 view .LVU97
+	.loc 1 100 13 is_stmt 0 view .LVU98
+	cmpl	$0, log_level(%rip)
+	jg	.L38
+.LVL37:
+.L32:
+	.loc 1 100 8 is_stmt 1 discriminator 3 view .LVU99
+	.loc 1 101 5 discriminator 3 view .LVU100
+	.loc 1 101 24 is_stmt 0 discriminator 3 view .LVU101
+	movq	104(%r12), %rbp
+.LVL38:
+	.loc 1 102 5 is_stmt 1 discriminator 3 view .LVU102
+.LBB12:
+	.loc 1 102 10 discriminator 3 view .LVU103
+	.loc 1 102 23 discriminator 3 view .LVU104
+	.loc 1 102 28 is_stmt 0 discriminator 3 view .LVU105
+	movq	0(%rbp), %rsi
+	.loc 1 102 23 discriminator 3 view .LVU106
+	testq	%rsi, %rsi
+	je	.L33
+	.loc 1 102 17 view .LVU107
+	movl	$0, %ebx
+.LVL39:
+.L34:
+	.loc 1 103 9 is_stmt 1 discriminator 3 view .LVU108
+	movq	40(%rbp,%rbx,8), %rdi
+	call	beep_drivers_fini@PLT
+.LVL40:
+	.loc 1 102 37 discriminator 3 view .LVU109
+	addq	$1, %rbx
+.LVL41:
+	.loc 1 102 23 discriminator 3 view .LVU110
+	.loc 1 102 28 is_stmt 0 discriminator 3 view .LVU111
+	movq	0(%rbp), %rsi
+	.loc 1 102 23 discriminator 3 view .LVU112
+	cmpq	%rsi, %rbx
+	jb	.L34
+.LVL42:
+.L33:
+	.loc 1 102 23 discriminator 3 view .LVU113
+.LBE12:
+	.loc 1 105 5 is_stmt 1 view .LVU114
+	.loc 1 105 13 is_stmt 0 view .LVU115
+	movq	16(%rbp), %rdi
+	.loc 1 105 8 view .LVU116
+	testq	%rdi, %rdi
+	je	.L35
+	.loc 1 106 9 is_stmt 1 view .LVU117
+	.loc 1 106 14 view .LVU118
+	.loc 1 106 17 is_stmt 0 view .LVU119
+	cmpl	$0, log_level(%rip)
+	jg	.L39
+.L35:
+	.loc 1 106 12 is_stmt 1 discriminator 3 view .LVU120
+	.loc 1 112 5 discriminator 3 view .LVU121
+	movq	104(%r12), %rdi
+	call	free@PLT
+.LVL43:
+	.loc 1 113 5 discriminator 3 view .LVU122
+	.loc 1 113 25 is_stmt 0 discriminator 3 view .LVU123
+	movq	$0, 104(%r12)
+	.loc 1 114 1 discriminator 3 view .LVU124
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL44:
+	.loc 1 114 1 discriminator 3 view .LVU125
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL45:
+	.loc 1 114 1 discriminator 3 view .LVU126
+	ret
+.LVL46:
+.L38:
+	.cfi_restore_state
+	.loc 1 100 46 is_stmt 1 discriminator 1 view .LVU127
+	movq	%rdi, %rsi
+	leaq	.LC2(%rip), %rdi
+.LVL47:
+	.loc 1 100 46 is_stmt 0 discriminator 1 view .LVU128
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL48:
+	jmp	.L32
+.LVL49:
+.L39:
+	.loc 1 106 50 is_stmt 1 discriminator 1 view .LVU129
+	movq	24(%rbp), %rax
+	movl	$0, %edx
+	divq	%rdi
+	movq	32(%rbp), %r8
+	movq	%rax, %rcx
+	movq	%rdi, %rdx
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL50:
+	jmp	.L35
+	.cfi_endproc
+.LFE21:
+	.size	driver_fini, .-driver_fini
+	.section	.rodata.str1.1
+.LC4:
+	.string	"fanout driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL51:
+.LFB20:
+	.loc 1 88 1 view -0
+	.cfi_startproc
+	.loc 1 88 1 is_stmt 0 view .LVU131
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 89 5 is_stmt 1 view .LVU132
+	.loc 1 89 10 view .LVU133
+	.loc 1 89 13 is_stmt 0 view .LVU134
+	cmpl	$0, log_level(%rip)
+	jg	.L46
+.LVL52:
+.L41:
+	.loc 1 89 8 is_stmt 1 discriminator 3 view .LVU135
+	.loc 1 90 5 discriminator 3 view .LVU136
+	.loc 1 90 24 is_stmt 0 discriminator 3 view .LVU137
+	movq	104(%rbx), %rbp
+.LVL53:
+	.loc 1 91 5 is_stmt 1 discriminator 3 view .LVU138
+.LBB13:
+	.loc 1 91 10 discriminator 3 view .LVU139
+	.loc 1 91 23 discriminator 3 view .LVU140
+	cmpq	$0, 0(%rbp)
+	je	.L40
+	.loc 1 91 17 is_stmt 0 view .LVU141
+	movl	$0, %ebx
+.LVL54:
+.L43:
+	.loc 1 92 9 is_stmt 1 discriminator 3 view .LVU142
+	movq	40(%rbp,%rbx,8), %rdi
+	call	beep_drivers_init@PLT
+.LVL55:
+	.loc 1 91 37 discriminator 3 view .LVU143
+	addq	$1, %rbx
+.LVL56:
+	.loc 1 91 23 discriminator 3 view .LVU144
+	cmpq	0(%rbp), %rbx
+	jb	.L43
+.LVL57:
+.L40:
+	.loc 1 91 23 is_stmt 0 discriminator 3 view .LVU145
+.LBE13:
+	.loc 1 94 1 view .LVU146
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL58:
+	.loc 1 94 1 view .LVU147
+	ret
+.LVL59:
+.L46:
+	.cfi_restore_state
+	.loc 1 89 46 is_stmt 1 discriminator 1 view .LVU148
+	movq	%rdi, %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL60:
+	jmp	.L41
+	.cfi_endproc
+.LFE20:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"fanout driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL61:
+.LFB22:
+	.loc 1 119 1 view -0
+	.cfi_startproc
+	.loc 1 119 1 is_stmt 0 view .LVU150
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r14
+	movl	%esi, %r13d
+	.loc 1 120 5 is_stmt 1 view .LVU151
+	.loc 1 120 24 is_stmt 0 view .LVU152
+	movq	104(%rdi), %rbp
+.LVL62:
+	.loc 1 122 5 is_stmt 1 view .LVU153
+	.loc 1 122 31 is_stmt 0 view .LVU154
+	call	fanout_now_ns
+.LVL63:
+	.loc 1 122 31 view .LVU155
+	movq	%rax, %r15
+.LVL64:
+	.loc 1 123 5 is_stmt 1 view .LVU156
+.LBB17:
+	.loc 1 123 10 view .LVU157
+	.loc 1 123 23 view .LVU158
+	cmpq	$0, 0(%rbp)
+	je	.L48
+	.loc 1 123 17 is_stmt 0 view .LVU159
+	movl	$0, %ebx
+	.loc 1 124 9 view .LVU160
+	movzwl	%r13w, %r12d
+.LVL65:
+.L49:
+	.loc 1 124 9 is_stmt 1 discriminator 3 view .LVU161
+	movq	40(%rbp,%rbx,8), %rdi
+	movl	%r12d, %esi
+	call	beep_drivers_begin_tone@PLT
+.LVL66:
+	.loc 1 123 37 discriminator 3 view .LVU162
+	addq	$1, %rbx
+.LVL67:
+	.loc 1 123 23 discriminator 3 view .LVU163
+	cmpq	0(%rbp), %rbx
+	jb	.L49
+.LVL68:
+.L48:
+	.loc 1 123 23 is_stmt 0 discriminator 3 view .LVU164
+.LBE17:
+	.loc 1 126 5 is_stmt 1 view .LVU165
+	.loc 1 126 30 is_stmt 0 view .LVU166
+	call	fanout_now_ns
+.LVL69:
+	.loc 1 128 5 is_stmt 1 view .LVU167
+.LBB18:
+.LBI18:
+	.loc 1 64 6 view .LVU168
+.LBB19:
+	.loc 1 67 5 view .LVU169
+	.loc 1 67 20 is_stmt 0 view .LVU170
+	subq	%r15, %rax
+.LVL70:
+	.loc 1 68 5 is_stmt 1 view .LVU171
+	addq	$1, 16(%rbp)
+	.loc 1 69 5 view .LVU172
+	.loc 1 69 23 is_stmt 0 view .LVU173
+	addq	%rax, 24(%rbp)
+	.loc 1 70 5 is_stmt 1 view .LVU174
+	.loc 1 70 8 is_stmt 0 view .LVU175
+	cmpq	%rax, 32(%rbp)
+	jnb	.L50
+	.loc 1 71 9 is_stmt 1 view .LVU176
+	.loc 1 71 27 is_stmt 0 view .LVU177
+	movq	%rax, 32(%rbp)
+.L50:
+.LVL71:
+	.loc 1 71 27 view .LVU178
+.LBE19:
+.LBE18:
+	.loc 1 129 5 is_stmt 1 view .LVU179
+	.loc 1 129 10 view .LVU180
+	.loc 1 129 104 view .LVU181
+	.loc 1 129 107 is_stmt 0 view .LVU182
+	cmpl	$0, log_level(%rip)
+	jg	.L54
+.L47:
+	.loc 1 130 1 view .LVU183
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL72:
+	.loc 1 130 1 view .LVU184
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL73:
+	.loc 1 130 1 view .LVU185
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL74:
+	.loc 1 130 1 view .LVU186
+	ret
+.LVL75:
+.L54:
+	.cfi_restore_state
+	.loc 1 129 140 is_stmt 1 discriminator 4 view .LVU187
+	movzwl	%r13w, %ecx
+	movl	$1, %edx
+	movq	%r14, %rsi
+	leaq	.LC5(%rip), %rdi
+	call	log_deferred@PLT
+.LVL76:
+	.loc 1 129 8 discriminator 4 view .LVU188
+	.loc 1 130 1 is_stmt 0 discriminator 4 view .LVU189
+	jmp	.L47
+	.cfi_endproc
+.LFE22:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.globl	fanout_driver_new
+	.type	fanout_driver_new, @function
+fanout_driver_new:
+.LVL77:
+.LFB25:
+	.loc 1 194 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 194 1 is_stmt 0 view .LVU191
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 195 5 is_stmt 1 view .LVU192
+	.loc 1 195 22 is_stmt 0 view .LVU193
+	leaq	-1(%rsi), %rax
+	.loc 1 196 15 view .LVU194
+	movl	$0, %ebp
+	.loc 1 195 8 view .LVU195
+	cmpq	$15, %rax
+	ja	.L55
+	movq	%rdi, %r13
+	movq	%rsi, %r12
+	.loc 1 199 5 is_stmt 1 view .LVU196
+	.loc 1 199 33 is_stmt 0 view .LVU197
+	movl	$112, %edi
+.LVL78:
+	.loc 1 199 33 view .LVU198
+	call	malloc@PLT
+.LVL79:
+	.loc 1 199 33 view .LVU199
+	movq	%rax, %rbp
+.LVL80:
+	.loc 1 200 5 is_stmt 1 view .LVU200
+	.loc 1 200 31 is_stmt 0 view .LVU201
+	movl	$168, %edi
+	call	malloc@PLT
+.LVL81:
+	.loc 1 200 31 view .LVU202
+	movq	%rax, %rbx
+.LVL82:
+	.loc 1 201 5 is_stmt 1 view .LVU203
+	.loc 1 201 8 is_stmt 0 view .LVU204
+	testq	%rbp, %rbp
+	je	.L62
+	testq	%rax, %rax
+	je	.L62
+	.loc 1 207 5 is_stmt 1 view .LVU205
+	.loc 1 207 17 is_stmt 0 view .LVU206
+	movq	%r12, (%rax)
+	.loc 1 208 5 is_stmt 1 view .LVU207
+	.loc 1 208 23 is_stmt 0 view .LVU208
+	movb	$0, 8(%rax)
+	.loc 1 209 5 is_stmt 1 view .LVU209
+	.loc 1 209 17 is_stmt 0 view .LVU210
+	movq	$0, 16(%rax)
+	.loc 1 210 5 is_stmt 1 view .LVU211
+	.loc 1 210 23 is_stmt 0 view .LVU212
+	movq	$0, 24(%rax)
+	.loc 1 211 5 is_stmt 1 view .LVU213
+	.loc 1 211 23 is_stmt 0 view .LVU214
+	movq	$0, 32(%rax)
+	.loc 1 212 5 is_stmt 1 view .LVU215
+.LBB20:
+	.loc 1 212 10 view .LVU216
+.LVL83:
+	.loc 1 212 23 view .LVU217
+	.loc 1 212 17 is_stmt 0 view .LVU218
+	movl	$0, %eax
+.LVL84:
+	.loc 1 212 17 view .LVU219
+	jmp	.L60
+.LVL85:
+.L62:
+	.loc 1 212 17 view .LVU220
+.LBE20:
+	.loc 1 202 9 is_stmt 1 view .LVU221
+	movq	%rbp, %rdi
+	call	free@PLT
+.LVL86:
+	.loc 1 203 9 view .LVU222
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL87:
+	.loc 1 204 9 view .LVU223
+	.loc 1 204 15 is_stmt 0 view .LVU224
+	movl	$0, %ebp
+.LVL88:
+	.loc 1 204 15 view .LVU225
+	jmp	.L55
+.LVL89:
+.L59:
+.LBB21:
+	.loc 1 212 31 is_stmt 1 discriminator 2 view .LVU226
+	addq	$1, %rax
+.LVL90:
+	.loc 1 212 23 discriminator 2 view .LVU227
+	cmpq	%rax, %r12
+	je	.L65
+.LVL91:
+.L60:
+	.loc 1 213 9 view .LVU228
+	.loc 1 213 35 is_stmt 0 view .LVU229
+	movq	0(%r13,%rax,8), %rdx
+	.loc 1 213 26 view .LVU230
+	movq	%rdx, 40(%rbx,%rax,8)
+	.loc 1 214 9 is_stmt 1 view .LVU231
+	.loc 1 214 12 is_stmt 0 view .LVU232
+	cmpq	$0, 56(%rdx)
+	jne	.L59
+	.loc 1 215 13 is_stmt 1 view .LVU233
+	.loc 1 215 31 is_stmt 0 view .LVU234
+	movb	$1, 8(%rbx)
+	jmp	.L59
+.L65:
+	.loc 1 215 31 view .LVU235
+.LBE21:
+	.loc 1 219 5 is_stmt 1 view .LVU236
+	.loc 1 219 13 is_stmt 0 view .LVU237
+	movdqa	fanout_driver(%rip), %xmm0
+	movups	%xmm0, 0(%rbp)
+	movdqa	16+fanout_driver(%rip), %xmm1
+	movups	%xmm1, 16(%rbp)
+	movdqa	32+fanout_driver(%rip), %xmm2
+	movups	%xmm2, 32(%rbp)
+	movdqa	48+fanout_driver(%rip), %xmm3
+	movups	%xmm3, 48(%rbp)
+	movdqa	64+fanout_driver(%rip), %xmm4
+	movups	%xmm4, 64(%rbp)
+	movdqa	80+fanout_driver(%rip), %xmm5
+	movups	%xmm5, 80(%rbp)
+	movdqa	96+fanout_driver(%rip), %xmm6
+	movups	%xmm6, 96(%rbp)
+	.loc 1 220 5 is_stmt 1 view .LVU238
+	.loc 1 220 37 is_stmt 0 view .LVU239
+	movq	0(%r13), %rax
+.LVL92:
+	.loc 1 220 37 view .LVU240
+	movq	96(%rax), %rax
+	.loc 1 220 25 view .LVU241
+	movq	%rax, 96(%rbp)
+	.loc 1 221 5 is_stmt 1 view .LVU242
+	.loc 1 221 25 is_stmt 0 view .LVU243
+	movq	%rbx, 104(%rbp)
+	.loc 1 222 5 is_stmt 1 view .LVU244
+.LVL93:
+.L55:
+	.loc 1 223 1 is_stmt 0 view .LVU245
+	movq	%rbp, %rax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	fanout_driver_new, .-fanout_driver_new
+	.section	.rodata.str1.1
+.LC6:
+	.string	"fanout"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	fanout_driver, @object
+	.size	fanout_driver, 112
+fanout_driver:
+	.quad	.LC6
+	.quad	0
+	.quad	driver_detect
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	driver_wait
+	.quad	0
+	.quad	0
+	.quad	0
+	.long	-1
+	.zero	4
+	.quad	0
+	.quad	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "beep-driver.h"
+	.file 9 "beep-drivers.h"
+	.file 10 "beep-log.h"
+	.file 11 "/usr/include/time.h"
+	.file 12 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc13
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF92
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	0x35
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	0x4d
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x6
+	.long	0x6e
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xa9
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xd7
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF17
+	.uleb128 0x6
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x7
+	.byte	0x15
+	.long	0xb8
+	.uleb128 0x15
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb
+	.long	0x122
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x10
+	.byte	0xc
+	.long	0xac
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x15
+	.byte	0x15
+	.long	0xc6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xfb
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF22
+	.uleb128 0x5
+	.long	0x138
+	.uleb128 0x6
+	.long	0x12e
+	.uleb128 0x1f
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x6
+	.long	0x139
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x8
+	.byte	0x18
+	.long	0xe3
+	.uleb128 0x6
+	.long	0x143
+	.uleb128 0x20
+	.long	0x14f
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x19
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x6
+	.long	0x159
+	.uleb128 0x4
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x4
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x6
+	.long	0x176
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x193
+	.uleb128 0x15
+	.long	.LASF29
+	.byte	0x70
+	.byte	0x8
+	.byte	0x43
+	.long	0x256
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x44
+	.byte	0xb
+	.long	0xd2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x45
+	.byte	0x12
+	.long	0x2d0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x47
+	.byte	0x1d
+	.long	0x2a4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1b
+	.long	0x2ff
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x49
+	.byte	0x1b
+	.long	0x31b
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x21
+	.long	0x327
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x348
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x52
+	.byte	0x1b
+	.long	0x354
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x59
+	.byte	0x24
+	.long	0x375
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x61
+	.byte	0x1c
+	.long	0x2da
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x8
+	.byte	0x62
+	.byte	0x18
+	.long	0x3b4
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x68
+	.byte	0x11
+	.long	0x139
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xb
+	.long	0xc4
+	.byte	0x68
+	.byte	0
+	.uleb128 0x16
+	.byte	0x10
+	.byte	0x8
+	.byte	0x22
+	.long	0x293
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x23
+	.byte	0xe
+	.long	0x16a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x24
+	.byte	0xe
+	.long	0x16a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0x16a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0x16a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x256
+	.uleb128 0x6
+	.long	0x293
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x32
+	.byte	0xf
+	.long	0x2b0
+	.uleb128 0x5
+	.long	0x2b5
+	.uleb128 0x17
+	.long	0x2c9
+	.long	0x2c9
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x139
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF50
+	.uleb128 0x5
+	.long	0x187
+	.uleb128 0x6
+	.long	0x2d0
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x2e6
+	.uleb128 0x5
+	.long	0x2eb
+	.uleb128 0x17
+	.long	0x2c9
+	.long	0x2ff
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x36
+	.byte	0x10
+	.long	0x30b
+	.uleb128 0x5
+	.long	0x310
+	.uleb128 0x12
+	.long	0x31b
+	.uleb128 0x1
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x37
+	.byte	0x10
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x10
+	.long	0x333
+	.uleb128 0x5
+	.long	0x338
+	.uleb128 0x12
+	.long	0x348
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x165
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x10
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x10
+	.long	0x360
+	.uleb128 0x5
+	.long	0x365
+	.uleb128 0x12
+	.long	0x375
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x75
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x10
+	.long	0x381
+	.uleb128 0x5
+	.long	0x386
+	.uleb128 0x12
+	.long	0x3a0
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x3a5
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x3af
+	.byte	0
+	.uleb128 0x5
+	.long	0x29f
+	.uleb128 0x6
+	.long	0x3a0
+	.uleb128 0x5
+	.long	0x154
+	.uleb128 0x6
+	.long	0x3aa
+	.uleb128 0x5
+	.long	0x13e
+	.uleb128 0x21
+	.long	.LASF75
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x16
+	.byte	0xa8
+	.byte	0x1
+	.byte	0x2c
+	.long	0x41c
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x2d
+	.byte	0xc
+	.long	0x35
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF59
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x12
+	.long	0x2c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x1
+	.byte	0x2f
+	.byte	0x13
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF61
+	.byte	0x1
+	.byte	0x30
+	.byte	0xe
+	.long	0x176
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF62
+	.byte	0x1
+	.byte	0x31
+	.byte	0xe
+	.long	0x176
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF63
+	.byte	0x1
+	.byte	0x32
+	.byte	0x12
+	.long	0x41c
+	.byte	0x28
+	.byte	0
+	.uleb128 0x22
+	.long	0x2d0
+	.long	0x42c
+	.uleb128 0x23
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF64
+	.byte	0x1
+	.byte	0x33
+	.byte	0x3
+	.long	0x3c5
+	.uleb128 0x18
+	.long	.LASF80
+	.byte	0xad
+	.byte	0xd
+	.long	0x187
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fanout_driver
+	.uleb128 0xc
+	.long	.LASF65
+	.byte	0x9
+	.byte	0x2c
+	.long	0x45e
+	.uleb128 0x1
+	.long	0x2d0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF66
+	.byte	0x9
+	.byte	0x2f
+	.long	0x46f
+	.uleb128 0x1
+	.long	0x2d0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x43
+	.long	0x481
+	.uleb128 0x1
+	.long	0x13e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF68
+	.byte	0x9
+	.byte	0x32
+	.long	0x497
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1
+	.long	0x165
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF71
+	.byte	0xb
+	.value	0x120
+	.byte	0xc
+	.long	0x4d
+	.long	0x4b3
+	.uleb128 0x1
+	.long	0xef
+	.uleb128 0x1
+	.long	0x4b3
+	.byte	0
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0xc
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x58
+	.long	0x4d8
+	.uleb128 0x1
+	.long	0x13e
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0x54
+	.uleb128 0x1
+	.long	0x75
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF70
+	.byte	0x9
+	.byte	0x35
+	.long	0x4e9
+	.uleb128 0x1
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF72
+	.byte	0xb
+	.value	0x119
+	.byte	0xc
+	.long	0x4d
+	.long	0x505
+	.uleb128 0x1
+	.long	0x505
+	.uleb128 0x1
+	.long	0x4b3
+	.byte	0
+	.uleb128 0x5
+	.long	0x122
+	.uleb128 0x25
+	.long	.LASF73
+	.byte	0xc
+	.value	0x238
+	.byte	0xd
+	.long	0x51d
+	.uleb128 0x1
+	.long	0xc4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF74
+	.byte	0xc
+	.value	0x229
+	.byte	0xe
+	.long	0xc4
+	.long	0x534
+	.uleb128 0x1
+	.long	0x35
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF93
+	.byte	0x1
+	.byte	0xc0
+	.byte	0xe
+	.long	0x2d0
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x619
+	.uleb128 0x9
+	.long	.LASF63
+	.byte	0xc0
+	.byte	0x3a
+	.long	0x61e
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x9
+	.long	.LASF58
+	.byte	0xc1
+	.byte	0x2d
+	.long	0x41
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x7
+	.long	.LASF76
+	.byte	0xc7
+	.byte	0x18
+	.long	0x2d5
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0xc8
+	.byte	0x18
+	.long	0x628
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x27
+	.long	.LLRL37
+	.long	0x5bc
+	.uleb128 0xd
+	.string	"i"
+	.byte	0xd4
+	.long	0x35
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL79
+	.long	0x51d
+	.long	0x5d4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x70
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL81
+	.long	0x51d
+	.long	0x5ec
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL86
+	.long	0x50a
+	.long	0x604
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL87
+	.long	0x50a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2d5
+	.uleb128 0x6
+	.long	0x619
+	.uleb128 0x5
+	.long	0x42c
+	.uleb128 0x6
+	.long	0x623
+	.uleb128 0x11
+	.long	.LASF82
+	.byte	0x96
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71c
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x96
+	.byte	0x1f
+	.long	0x2d0
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x9
+	.long	.LASF78
+	.byte	0x96
+	.byte	0x3a
+	.long	0x75
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x98
+	.byte	0x18
+	.long	0x628
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xe
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.long	0x6d1
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x9d
+	.long	0x35
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x28
+	.long	.LLRL4
+	.uleb128 0x7
+	.long	.LASF79
+	.byte	0x9e
+	.byte	0x1c
+	.long	0x2d5
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x29
+	.quad	.LVL3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x70e
+	.uleb128 0x18
+	.long	.LASF81
+	.byte	0xa4
+	.byte	0x1f
+	.long	0x122
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xb
+	.quad	.LVL12
+	.long	0x4e9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL13
+	.long	0xc0d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF83
+	.byte	0x86
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x855
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x86
+	.byte	0x23
+	.long	0x2d0
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x88
+	.byte	0x18
+	.long	0x628
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.long	.LASF84
+	.byte	0x8a
+	.byte	0x14
+	.long	0x182
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x8e
+	.byte	0x14
+	.long	0x182
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xe
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x7b7
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x8b
+	.long	0x35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xa
+	.quad	.LVL21
+	.long	0x4d8
+	.byte	0
+	.uleb128 0x19
+	.long	0xb78
+	.quad	.LBI10
+	.byte	.LVU57
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.byte	0x90
+	.long	0x80f
+	.uleb128 0xf
+	.long	0xb9b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xf
+	.long	0xb90
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xf
+	.long	0xb85
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1a
+	.long	0xba6
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL18
+	.long	0xbb3
+	.uleb128 0xa
+	.quad	.LVL24
+	.long	0xbb3
+	.uleb128 0xb
+	.quad	.LVL31
+	.long	0x4b8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF86
+	.byte	0x76
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ad
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x76
+	.byte	0x25
+	.long	0x2d0
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x9
+	.long	.LASF44
+	.byte	0x76
+	.byte	0x3c
+	.long	0x165
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x78
+	.byte	0x18
+	.long	0x628
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x7
+	.long	.LASF84
+	.byte	0x7a
+	.byte	0x14
+	.long	0x182
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x7e
+	.byte	0x14
+	.long	0x182
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xe
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x90a
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x7b
+	.long	0x35
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xb
+	.quad	.LVL66
+	.long	0x481
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xb78
+	.quad	.LBI18
+	.byte	.LVU168
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.byte	0x80
+	.long	0x962
+	.uleb128 0xf
+	.long	0xb9b
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xf
+	.long	0xb90
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xf
+	.long	0xb85
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1a
+	.long	0xba6
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL63
+	.long	0xbb3
+	.uleb128 0xa
+	.quad	.LVL69
+	.long	0xbb3
+	.uleb128 0xb
+	.quad	.LVL76
+	.long	0x4b8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF87
+	.byte	0x62
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa70
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x62
+	.byte	0x1f
+	.long	0x2d0
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x65
+	.byte	0x18
+	.long	0x628
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xe
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.long	0xa22
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x66
+	.long	0x35
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xa
+	.quad	.LVL40
+	.long	0x45e
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL43
+	.long	0x50a
+	.uleb128 0x10
+	.quad	.LVL48
+	.long	0x46f
+	.long	0xa54
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL50
+	.long	0x46f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF88
+	.byte	0x57
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb07
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x57
+	.byte	0x1f
+	.long	0x2d0
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x5a
+	.byte	0x18
+	.long	0x628
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xe
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.long	0xae5
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x5b
+	.long	0x35
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xa
+	.quad	.LVL55
+	.long	0x44d
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL60
+	.long	0x46f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF90
+	.byte	0x4d
+	.byte	0x5
+	.long	0x2c9
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb78
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x4d
+	.byte	0x20
+	.long	0x2d0
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x9
+	.long	.LASF89
+	.byte	0x4d
+	.byte	0x34
+	.long	0x139
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xb
+	.quad	.LVL35
+	.long	0x46f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF94
+	.byte	0x1
+	.byte	0x40
+	.byte	0x6
+	.byte	0x1
+	.long	0xbb3
+	.uleb128 0x14
+	.long	.LASF77
+	.byte	0x40
+	.byte	0x2d
+	.long	0x628
+	.uleb128 0x14
+	.long	.LASF84
+	.byte	0x41
+	.byte	0x29
+	.long	0x182
+	.uleb128 0x14
+	.long	.LASF85
+	.byte	0x41
+	.byte	0x42
+	.long	0x182
+	.uleb128 0x2b
+	.long	.LASF95
+	.byte	0x1
+	.byte	0x43
+	.byte	0x14
+	.long	0x182
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF91
+	.byte	0x37
+	.byte	0xa
+	.long	0x176
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc0d
+	.uleb128 0x2c
+	.string	"ts"
+	.byte	0x1
+	.byte	0x39
+	.byte	0x15
+	.long	0xfb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x10
+	.quad	.LVL14
+	.long	0x497
+	.long	0xbff
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL15
+	.long	0xc0d
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF96
+	.long	.LASF96
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL79-1-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU225
+	.uleb128 .LVU226
+	.uleb128 .LVU245
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU203
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU245
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU217
+	.uleb128 .LVU220
+	.uleb128 .LVU226
+	.uleb128 .LVU240
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU5
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU18
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU43
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU46
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU75
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU48
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU53
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU57
+	.uleb128 .LVU67
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU57
+	.uleb128 .LVU67
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU60
+	.uleb128 .LVU67
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU153
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU156
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU167
+	.uleb128 .LVU171
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU158
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU164
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU168
+	.uleb128 .LVU171
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU168
+	.uleb128 .LVU178
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU168
+	.uleb128 .LVU178
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU102
+	.uleb128 .LVU125
+	.uleb128 .LVU129
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU104
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU113
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU138
+	.uleb128 .LVU147
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU145
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF21:
+	.string	"tv_nsec"
+.LASF44:
+	.string	"freq"
+.LASF20:
+	.string	"tv_sec"
+.LASF91:
+	.string	"fanout_now_ns"
+.LASF26:
+	.string	"uint64_t"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF74:
+	.string	"malloc"
+.LASF40:
+	.string	"default_devices"
+.LASF94:
+	.string	"fanout_account_skew"
+.LASF35:
+	.string	"begin_tone"
+.LASF69:
+	.string	"log_deferred"
+.LASF89:
+	.string	"console_device"
+.LASF85:
+	.string	"last_ns"
+.LASF16:
+	.string	"__syscall_slong_t"
+.LASF23:
+	.string	"sig_atomic_t"
+.LASF38:
+	.string	"play_sequence"
+.LASF11:
+	.string	"__uint16_t"
+.LASF49:
+	.string	"beep_driver_detect_func"
+.LASF56:
+	.string	"beep_driver_wait_func"
+.LASF46:
+	.string	"delay"
+.LASF41:
+	.string	"device_fd"
+.LASF51:
+	.string	"beep_driver_probe_func"
+.LASF73:
+	.string	"free"
+.LASF37:
+	.string	"wait"
+.LASF79:
+	.string	"device"
+.LASF32:
+	.string	"detect"
+.LASF19:
+	.string	"clockid_t"
+.LASF78:
+	.string	"milliseconds"
+.LASF4:
+	.string	"long long int"
+.LASF42:
+	.string	"device_name"
+.LASF62:
+	.string	"skew_max_ns"
+.LASF2:
+	.string	"long int"
+.LASF84:
+	.string	"first_ns"
+.LASF64:
+	.string	"fanout_data"
+.LASF27:
+	.string	"beep_driver"
+.LASF61:
+	.string	"skew_sum_ns"
+.LASF68:
+	.string	"beep_drivers_begin_tone"
+.LASF30:
+	.string	"name"
+.LASF86:
+	.string	"driver_begin_tone"
+.LASF45:
+	.string	"length"
+.LASF43:
+	.string	"driver_data"
+.LASF18:
+	.string	"__sig_atomic_t"
+.LASF5:
+	.string	"unsigned char"
+.LASF87:
+	.string	"driver_fini"
+.LASF8:
+	.string	"signed char"
+.LASF47:
+	.string	"flags"
+.LASF22:
+	.string	"long long unsigned int"
+.LASF25:
+	.string	"uint32_t"
+.LASF7:
+	.string	"unsigned int"
+.LASF65:
+	.string	"beep_drivers_init"
+.LASF71:
+	.string	"clock_gettime"
+.LASF29:
+	.string	"_beep_driver"
+.LASF39:
+	.string	"probe"
+.LASF76:
+	.string	"driver"
+.LASF81:
+	.string	"request"
+.LASF67:
+	.string	"log_verbose"
+.LASF55:
+	.string	"beep_driver_end_tone_func"
+.LASF63:
+	.string	"devices"
+.LASF93:
+	.string	"fanout_driver_new"
+.LASF17:
+	.string	"char"
+.LASF24:
+	.string	"uint16_t"
+.LASF88:
+	.string	"driver_init"
+.LASF52:
+	.string	"beep_driver_init_func"
+.LASF75:
+	.string	"log_level"
+.LASF6:
+	.string	"short unsigned int"
+.LASF83:
+	.string	"driver_end_tone"
+.LASF48:
+	.string	"beep_tone"
+.LASF36:
+	.string	"end_tone"
+.LASF50:
+	.string	"_Bool"
+.LASF54:
+	.string	"beep_driver_begin_tone_func"
+.LASF13:
+	.string	"__uint64_t"
+.LASF77:
+	.string	"data"
+.LASF34:
+	.string	"fini"
+.LASF3:
+	.string	"long unsigned int"
+.LASF95:
+	.string	"skew_ns"
+.LASF14:
+	.string	"__time_t"
+.LASF82:
+	.string	"driver_wait"
+.LASF12:
+	.string	"__uint32_t"
+.LASF66:
+	.string	"beep_drivers_fini"
+.LASF57:
+	.string	"beep_driver_play_sequence_func"
+.LASF58:
+	.string	"count"
+.LASF90:
+	.string	"driver_detect"
+.LASF15:
+	.string	"__clockid_t"
+.LASF72:
+	.string	"nanosleep"
+.LASF59:
+	.string	"needs_sleep"
+.LASF60:
+	.string	"edges"
+.LASF28:
+	.string	"timespec"
+.LASF70:
+	.string	"beep_drivers_end_tone"
+.LASF80:
+	.string	"fanout_driver"
+.LASF53:
+	.string	"beep_driver_fini_func"
+.LASF96:
+	.string	"__stack_chk_fail"
+.LASF92:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF31:
+	.string	"next"
+.LASF33:
+	.string	"init"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-fanout.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -54,14 +54,14 @@ void driver_fini(beep_driver *driver)
 static
 void driver_begin_tone(beep_driver *driver, const uint16_t freq)
 {
-    log_verbose("noop driver_begin_tone %p %u", (void *)driver, freq);
+    log_verbose_deferred_u("noop driver_begin_tone %p %u", (void *)driver, freq);
 }
 
 
 static
 void driver_end_tone(beep_driver *driver)
 {
-    log_verbose("noop driver_end_tone %p", (void *)driver);
+    log_verbose_deferred("noop driver_end_tone %p", (void *)driver);
 }
 
 
@@ -74,7 +74,12 @@ beep_driver noop_driver =
      driver_fini,
      driver_begin_tone,
      driver_end_tone,
+     NULL,
+     NULL,
+     NULL,
+     NULL,
      0,
+     NULL,
      NULL
     };
 
@@ -0,0 +1,723 @@
+/* beep-driver-pcm.c - implement the beep PCM synthesis driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* The PCM driver renders the tones as signed 16bit mono samples at
+ * BEEP_PCM_RATE instead of sending them to a sound device:
+ *
+ *   pcm:FILE   raw little endian samples written to FILE
+ *   wav:FILE   the same samples in a WAV file
+ *
+ * A FILE of "-" means stdout.
+ *
+ * As nobody is listening in real time, the driver implements the
+ * wait operation by rendering the requested time worth of samples
+ * instead of sleeping, so rendering is as fast as the CPU allows.
+ *
+ * The tones are band limited square waves (naive square wave plus
+ * PolyBLEP corrections at both edges) rendered four samples at a
+ * time with GCC vector extensions.
+ *
+ * When writing to stdout or any other non-seekable file, the samples
+ * are rendered into a buffer which is written out in large blocks.
+ *
+ * When writing to a regular file, the driver just records the tone
+ * program as a list of segments, each with its exact start phase.
+ * At driver_fini() time, it maps the output file into memory and
+ * renders time chunks of the program on one thread per CPU.  As every
+ * chunk can compute its start phase from the segment it starts in,
+ * the result is identical to rendering it serially.
+ */
+
+
+#define _GNU_SOURCE /* for sched_getaffinity(2) and CPU_COUNT */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "beep-driver-pcm.h"
+
+#include "beep-library.h"
+#include "beep-log.h"
+
+
+/* 64Ki frames of 2 bytes each, i.e. 128KiB per write(2) */
+#define PCM_BUFFER_FRAMES 65536U
+
+#define PCM_FRAMES_PER_MS (BEEP_PCM_RATE / 1000U)
+
+/* Half of full scale leaves room for the PolyBLEP overshoot */
+#define PCM_AMPLITUDE 16383.0f
+
+#define WAV_HEADER_SIZE 44U
+
+/* Do not bother starting a thread for less than a second of samples */
+#define PCM_MIN_FRAMES_PER_THREAD BEEP_PCM_RATE
+
+#define PCM_MAX_THREADS 64
+
+
+typedef float    v4sf __attribute__(( vector_size(16) ));
+typedef int32_t  v4si __attribute__(( vector_size(16) ));
+typedef uint32_t v4su __attribute__(( vector_size(16) ));
+typedef int16_t  v4hi __attribute__(( vector_size(8) ));
+
+
+/* A stretch of constant tone (or silence) in the tone program */
+typedef struct {
+    uint64_t start;   /* first frame */
+    uint32_t phase;   /* phase at the first frame */
+    uint32_t inc;     /* phase increment per frame, 0 for silence */
+} pcm_segment;
+
+
+typedef struct {
+    bool     is_wav;
+    bool     close_fd;
+    bool     offline; /* record the tone program, render at fini time */
+    uint32_t phase;   /* position in the current period, 2^32 is one period */
+    uint32_t inc;     /* phase increment per sample, 0 for silence */
+    uint64_t frames_written;
+
+    /* offline mode */
+    pcm_segment *segments;
+    size_t       segment_count;
+    size_t       segment_alloc;
+    uint64_t     total_frames;
+
+    /* streaming mode */
+    size_t   fill;
+    int16_t  buffer[PCM_BUFFER_FRAMES];
+} pcm_data;
+
+
+/* One time chunk of the tone program to render */
+typedef struct {
+    const pcm_data *data;
+    int16_t        *out;    /* where frame 0 goes */
+    uint64_t        first;  /* first frame to render */
+    uint64_t        last;   /* one after the last frame to render */
+} pcm_job;
+
+
+static inline
+v4sf v4sf_select(const v4si mask, const v4sf if_true, const v4sf if_false)
+{
+    return (v4sf)(((v4si)if_true & mask) | ((v4si)if_false & ~mask));
+}
+
+
+/* Convert 32bit fixed point phases to floats in [0,1).  Only the top
+ * 24 bits fit into a float mantissa anyway.
+ */
+static inline
+v4sf v4su_to_unit(const v4su phase)
+{
+    const float scale = 1.0f / 16777216.0f;
+    const v4sf vscale = { scale, scale, scale, scale };
+    return __builtin_convertvector((v4si)(phase >> 8), v4sf) * vscale;
+}
+
+
+/* PolyBLEP residual for a rising unit step at t=0 */
+static inline
+v4sf v4sf_polyblep(const v4sf t, const v4sf dt, const v4sf inv_dt)
+{
+    const v4sf zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+    const v4sf one  = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    const v4sf x_after  = t * inv_dt;
+    const v4sf b_after  = x_after + x_after - x_after * x_after - one;
+    const v4sf x_before = (t - one) * inv_dt;
+    const v4sf b_before = x_before * x_before + x_before + x_before + one;
+
+    return v4sf_select(t < dt, b_after,
+                       v4sf_select(t > (one - dt), b_before, zero));
+}
+
+
+/* Render count samples of a band limited square wave starting at
+ * phase, and return the phase after the last sample.
+ *
+ * Keeping the phase in 32bit fixed point means it wraps around by
+ * itself, so the only loop carried dependency is one integer add.
+ */
+static
+uint32_t render_square(int16_t *const out, const size_t count,
+                       uint32_t phase, const uint32_t inc)
+{
+    const float dt_f     = (float)inc / 4294967296.0f;
+    const float inv_dt_f = 1.0f / dt_f;
+    const v4sf dt      = { dt_f, dt_f, dt_f, dt_f };
+    const v4sf inv_dt  = { inv_dt_f, inv_dt_f, inv_dt_f, inv_dt_f };
+    const v4sf one     = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const v4sf far     = one - dt;
+    const v4sf amp     = { PCM_AMPLITUDE, PCM_AMPLITUDE,
+                           PCM_AMPLITUDE, PCM_AMPLITUDE };
+    const v4su lane    = { 0U, inc, 2U * inc, 3U * inc };
+    const v4su half    = { 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U };
+    const v4si sign    = { INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN };
+    const uint32_t step = 4U * inc;
+
+    const size_t full_blocks = count / 4U;
+    v4hi samples;
+    for (size_t i = 0; i <= full_blocks; ++i) {
+        const v4su base = { phase, phase, phase, phase };
+        const v4su pos  = base + lane;
+        /* +1.0 in the first half of the period, -1.0 in the second */
+        v4sf s = (v4sf)((v4si)one | ((v4si)pos & sign));
+        const v4sf t  = v4su_to_unit(pos);
+        const v4sf t2 = v4su_to_unit(pos + half);
+        /* Most blocks are nowhere near an edge and need no correction */
+        const v4si near_edge = (t < dt) | (t > far) | (t2 < dt) | (t2 > far);
+        if (near_edge[0] | near_edge[1] | near_edge[2] | near_edge[3]) {
+            s += v4sf_polyblep(t, dt, inv_dt) - v4sf_polyblep(t2, dt, inv_dt);
+        }
+        samples = __builtin_convertvector(__builtin_convertvector(s * amp, v4si), v4hi);
+        if (i == full_blocks) {
+            break;
+        }
+        memcpy(&out[4U * i], &samples, sizeof(samples));
+        phase += step;
+    }
+    /* The last, partial block */
+    memcpy(&out[4U * full_blocks], &samples, (count % 4U) * sizeof(int16_t));
+    return phase + (uint32_t)(count % 4U) * inc;
+}
+
+
+static
+void put_le16(unsigned char *const buf, const uint16_t value)
+{
+    buf[0] = (unsigned char)(value & 0xff);
+    buf[1] = (unsigned char)((value >> 8) & 0xff);
+}
+
+
+static
+void put_le32(unsigned char *const buf, const uint32_t value)
+{
+    put_le16(&buf[0], (uint16_t)(value & 0xffff));
+    put_le16(&buf[2], (uint16_t)((value >> 16) & 0xffff));
+}
+
+
+/* The sizes are unknown while streaming.  0xffffffff is what most
+ * tools expect in that case; driver_fini() fixes them up if the file
+ * is seekable.
+ */
+static
+void wav_header(unsigned char *const hdr, const uint32_t data_size)
+{
+    const uint32_t riff_size =
+        (data_size > (0xffffffffU - 36U)) ? 0xffffffffU : (36U + data_size);
+    memcpy(&hdr[0], "RIFF", 4);
+    put_le32(&hdr[4], riff_size);
+    memcpy(&hdr[8], "WAVEfmt ", 8);
+    put_le32(&hdr[16], 16);                     /* fmt chunk size */
+    put_le16(&hdr[20], 1);                      /* PCM */
+    put_le16(&hdr[22], 1);                      /* mono */
+    put_le32(&hdr[24], BEEP_PCM_RATE);
+    put_le32(&hdr[28], BEEP_PCM_RATE * 2U);     /* bytes per second */
+    put_le16(&hdr[32], 2);                      /* bytes per frame */
+    put_le16(&hdr[34], 16);                     /* bits per sample */
+    memcpy(&hdr[36], "data", 4);
+    put_le32(&hdr[40], data_size);
+}
+
+
+static
+void pcm_flush(beep_driver *driver)
+{
+    pcm_data *const data = driver->driver_data;
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    for (size_t i=0; i<data->fill; ++i) {
+        data->buffer[i] = (int16_t)__builtin_bswap16((uint16_t)data->buffer[i]);
+    }
+#endif
+
+    if (-1 == write_all(driver->device_fd, data->buffer,
+                        data->fill * sizeof(data->buffer[0]))) {
+        safe_error_exit("write pcm");
+    }
+    data->frames_written += data->fill;
+    data->fill = 0;
+}
+
+
+static
+void pcm_render(beep_driver *driver, size_t frames)
+{
+    pcm_data *const data = driver->driver_data;
+
+    while (frames > 0) {
+        const size_t space = PCM_BUFFER_FRAMES - data->fill;
+        const size_t chunk = (frames < space) ? frames : space;
+        int16_t *const out = &data->buffer[data->fill];
+        if (data->inc > 0) {
+            data->phase = render_square(out, chunk, data->phase, data->inc);
+        } else {
+            memset(out, 0, chunk * sizeof(*out));
+        }
+        data->fill += chunk;
+        frames -= chunk;
+        if (data->fill == PCM_BUFFER_FRAMES) {
+            pcm_flush(driver);
+        }
+    }
+}
+
+
+/* Whether the current tone just continues the last segment */
+static
+bool pcm_continues_last_segment(const pcm_data *const data)
+{
+    if (data->segment_count == 0) {
+        return false;
+    }
+    const pcm_segment *const prev = &data->segments[data->segment_count-1];
+    const uint32_t prev_end_phase = prev->phase
+        + (uint32_t)((data->total_frames - prev->start) * prev->inc);
+    return (prev->inc == data->inc) && (prev_end_phase == data->phase);
+}
+
+
+static
+void pcm_append_segment(beep_driver *driver, const uint64_t frames)
+{
+    pcm_data *const data = driver->driver_data;
+
+    if (!pcm_continues_last_segment(data)) {
+        if (data->segment_count == data->segment_alloc) {
+            const size_t new_alloc =
+                (data->segment_alloc > 0) ? (2 * data->segment_alloc) : 1024;
+            pcm_segment *const new_segments =
+                realloc(data->segments, new_alloc * sizeof(pcm_segment));
+            if (!new_segments) {
+                safe_error_exit("realloc pcm segments");
+            }
+            data->segments = new_segments;
+            data->segment_alloc = new_alloc;
+        }
+        pcm_segment *const seg = &data->segments[data->segment_count++];
+        seg->start = data->total_frames;
+        seg->phase = data->phase;
+        seg->inc   = data->inc;
+    }
+
+    data->total_frames += frames;
+    data->phase += (uint32_t)(frames * data->inc);
+}
+
+
+/* Index of the segment containing the given frame */
+static
+size_t pcm_find_segment(const pcm_data *const data, const uint64_t frame)
+{
+    size_t lo = 0;
+    size_t hi = data->segment_count;
+    while ((hi - lo) > 1) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (data->segments[mid].start <= frame) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+
+static
+void *pcm_run_job(void *arg)
+{
+    const pcm_job *const job = arg;
+    const pcm_data *const data = job->data;
+
+    uint64_t frame = job->first;
+    for (size_t i = pcm_find_segment(data, frame); frame < job->last; ++i) {
+        const pcm_segment *const seg = &data->segments[i];
+        const uint64_t seg_end = ((i+1) < data->segment_count)
+            ? data->segments[i+1].start : data->total_frames;
+        const uint64_t end = (seg_end < job->last) ? seg_end : job->last;
+        int16_t *const out = &job->out[frame];
+        const size_t count = (size_t)(end - frame);
+        if (seg->inc > 0) {
+            const uint32_t phase = seg->phase
+                + (uint32_t)((frame - seg->start) * seg->inc);
+            render_square(out, count, phase, seg->inc);
+        } else {
+            memset(out, 0, count * sizeof(*out));
+        }
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+        for (size_t k=0; k<count; ++k) {
+            out[k] = (int16_t)__builtin_bswap16((uint16_t)out[k]);
+        }
+#endif
+        frame = end;
+    }
+    return NULL;
+}
+
+
+/* Chunk boundary near the ideal split point.  Prefer the start of a
+ * segment, i.e. a tone boundary, unless that would make the chunks
+ * too unequal; the exact segment start phases make splitting inside
+ * a tone work just as well.
+ */
+static
+uint64_t pcm_chunk_boundary(const pcm_data *const data,
+                            const uint64_t ideal, const uint64_t slack)
+{
+    const size_t i = pcm_find_segment(data, ideal);
+    const uint64_t before = data->segments[i].start;
+    const uint64_t after = ((i+1) < data->segment_count)
+        ? data->segments[i+1].start : data->total_frames;
+    const uint64_t nearest = ((ideal - before) <= (after - ideal)) ? before : after;
+    const uint64_t distance = (nearest > ideal) ? (nearest - ideal) : (ideal - nearest);
+    return (distance <= slack) ? nearest : ideal;
+}
+
+
+/* BEEP_PCM_THREADS=N forces N threads regardless of the CPUs and the
+ * amount of frames, so the tests can exercise the chunk splitting on
+ * any machine.
+ */
+static
+unsigned int pcm_thread_count(const uint64_t frames)
+{
+    const char *const forced = getenv("BEEP_PCM_THREADS");
+    if (forced && *forced) {
+        char *endp;
+        const unsigned long n = strtoul(forced, &endp, 10);
+        if ((*endp == '\0') && (n > 0)) {
+            return (n < PCM_MAX_THREADS) ? (unsigned int)n : PCM_MAX_THREADS;
+        }
+    }
+
+    unsigned int cpus = 1;
+    cpu_set_t set;
+    if (0 == sched_getaffinity(0, sizeof(set), &set)) {
+        cpus = (unsigned int)CPU_COUNT(&set);
+    }
+    const uint64_t useful = frames / PCM_MIN_FRAMES_PER_THREAD;
+    unsigned int threads = (useful < cpus) ? (unsigned int)useful : cpus;
+    if (threads > PCM_MAX_THREADS) {
+        threads = PCM_MAX_THREADS;
+    }
+    return (threads > 0) ? threads : 1;
+}
+
+
+/* Render the recorded tone program into the output file */
+static
+void pcm_render_offline(beep_driver *driver)
+{
+    pcm_data *const data = driver->driver_data;
+    const uint64_t frames = data->total_frames;
+    if (frames == 0) {
+        return;
+    }
+
+    const size_t header_size = data->is_wav ? WAV_HEADER_SIZE : 0;
+    const size_t map_size = header_size + (size_t)frames * sizeof(int16_t);
+    void *map = MAP_FAILED;
+    if (0 == ftruncate(driver->device_fd, (off_t)map_size)) {
+        map = mmap(NULL, map_size, PROT_READ|PROT_WRITE, MAP_SHARED,
+                   driver->device_fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        log_verbose("pcm: cannot map output file (%s), rendering serially",
+                    strerror(errno));
+        for (size_t i = 0; i < data->segment_count; ++i) {
+            const uint64_t end = ((i+1) < data->segment_count)
+                ? data->segments[i+1].start : frames;
+            data->phase = data->segments[i].phase;
+            data->inc = data->segments[i].inc;
+            pcm_render(driver, (size_t)(end - data->segments[i].start));
+        }
+        return;
+    }
+
+    const unsigned int threads = pcm_thread_count(frames);
+    log_verbose("pcm: rendering %llu frames in %zu segments on %u threads",
+                (unsigned long long)frames, data->segment_count, threads);
+
+    pcm_job jobs[PCM_MAX_THREADS];
+    pthread_t tids[PCM_MAX_THREADS];
+    bool started[PCM_MAX_THREADS];
+    const uint64_t slack = frames / (4U * threads);
+    uint64_t first = 0;
+    for (unsigned int t = 0; t < threads; ++t) {
+        const uint64_t ideal = (frames / threads) * (t + 1U);
+        uint64_t last = ((t + 1U) == threads)
+            ? frames : pcm_chunk_boundary(data, ideal, slack);
+        if (last < first) {
+            last = first;
+        }
+        jobs[t].data  = data;
+        jobs[t].out   = (int16_t *)((char *)map + header_size);
+        jobs[t].first = first;
+        jobs[t].last  = last;
+        first = last;
+    }
+
+    /* This thread renders the first chunk itself */
+    for (unsigned int t = 1; t < threads; ++t) {
+        started[t] = (0 == pthread_create(&tids[t], NULL, pcm_run_job, &jobs[t]));
+        if (!started[t]) {
+            pcm_run_job(&jobs[t]);
+        }
+    }
+    pcm_run_job(&jobs[0]);
+    for (unsigned int t = 1; t < threads; ++t) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        }
+    }
+
+    munmap(map, map_size);
+    data->frames_written = frames;
+}
+
+
+static
+bool driver_detect(beep_driver *driver, const char *console_device)
+{
+    if (console_device) {
+        log_verbose("pcm driver_detect %p %s",
+                    (void *)driver, console_device);
+    } else {
+        log_verbose("pcm driver_detect %p %p",
+                    (void *)driver, (const void *)console_device);
+    }
+    if (!console_device) {
+        /* Never pick the PCM driver unless asked to */
+        return false;
+    }
+
+    bool is_wav;
+    const char *file_name;
+    if (0 == strncmp(console_device, BEEP_PCM_PREFIX, strlen(BEEP_PCM_PREFIX))) {
+        is_wav = false;
+        file_name = console_device + strlen(BEEP_PCM_PREFIX);
+    } else if (0 == strncmp(console_device, BEEP_WAV_PREFIX, strlen(BEEP_WAV_PREFIX))) {
+        is_wav = true;
+        file_name = console_device + strlen(BEEP_WAV_PREFIX);
+    } else {
+        return false;
+    }
+
+    int fd = STDOUT_FILENO;
+    const bool close_fd = (0 != strcmp(file_name, "-"));
+    if (close_fd) {
+        /* O_RDWR, as mmap(2) needs it even for writing */
+        fd = open(file_name, O_RDWR|O_CREAT|O_TRUNC|O_CLOEXEC, 0666);
+        if (fd == -1) {
+            log_verbose("pcm: could not open(2) %s: %s",
+                        file_name, strerror(errno));
+            return false;
+        }
+    }
+
+    pcm_data *const data = malloc(sizeof(pcm_data));
+    if (!data) {
+        if (close_fd) {
+            close(fd);
+        }
+        return false;
+    }
+    struct stat sb;
+    data->is_wav = is_wav;
+    data->close_fd = close_fd;
+    data->offline = close_fd && (0 == fstat(fd, &sb)) && S_ISREG(sb.st_mode);
+    data->segments = NULL;
+    data->segment_count = 0;
+    data->segment_alloc = 0;
+    data->total_frames = 0;
+    data->phase = 0;
+    data->inc = 0;
+    data->frames_written = 0;
+    data->fill = 0;
+
+    if (is_wav) {
+        unsigned char hdr[WAV_HEADER_SIZE];
+        wav_header(hdr, 0xffffffffU);
+        if (-1 == write_all(fd, hdr, sizeof(hdr))) {
+            log_verbose("pcm: could not write WAV header: %s",
+                        strerror(errno));
+            if (close_fd) {
+                close(fd);
+            }
+            free(data);
+            return false;
+        }
+    }
+
+    driver->device_fd = fd;
+    driver->device_name = console_device;
+    driver->driver_data = data;
+    return true;
+}
+
+
+static
+void driver_init(beep_driver *driver)
+{
+    log_verbose("pcm driver_init %p", (void *)driver);
+}
+
+
+static
+void driver_fini(beep_driver *driver)
+{
+    log_verbose("pcm driver_fini %p", (void *)driver);
+    pcm_data *const data = driver->driver_data;
+
+    if (data->offline) {
+        pcm_render_offline(driver);
+    }
+    pcm_flush(driver);
+
+    if (data->is_wav) {
+        const uint64_t data_size = data->frames_written * 2U;
+        unsigned char hdr[WAV_HEADER_SIZE];
+        wav_header(hdr, (data_size > 0xffffffffU) ? 0xffffffffU : (uint32_t)data_size);
+        /* Fails with ESPIPE for pipes, which is fine */
+        if (sizeof(hdr) != pwrite(driver->device_fd, hdr, sizeof(hdr), 0)) {
+            log_verbose("pcm: could not update WAV header: %s",
+                        strerror(errno));
+        }
+    }
+
+    if (data->close_fd) {
+        close(driver->device_fd);
+    }
+    driver->device_fd = -1;
+    free(data->segments);
+    free(driver->driver_data);
+    driver->driver_data = NULL;
+}
+
+
+static
+void pcm_start_tone(pcm_data *const data, const uint16_t freq)
+{
+    /* Above Nyquist, there is nothing left of a band limited tone */
+    data->inc = ((2U * freq) < BEEP_PCM_RATE)
+        ? (uint32_t)((((uint64_t)freq << 32) + BEEP_PCM_RATE / 2U) / BEEP_PCM_RATE)
+        : 0;
+    data->phase = 0;
+}
+
+
+static
+void pcm_advance(beep_driver *driver, const unsigned int milliseconds)
+{
+    pcm_data *const data = driver->driver_data;
+    const uint64_t frames = (uint64_t)milliseconds * PCM_FRAMES_PER_MS;
+
+    if (data->offline) {
+        pcm_append_segment(driver, frames);
+    } else {
+        pcm_render(driver, (size_t)frames);
+    }
+}
+
+
+static
+void driver_begin_tone(beep_driver *driver, const uint16_t freq)
+{
+    log_verbose_deferred_u("pcm driver_begin_tone %p %u", (void *)driver, freq);
+    pcm_start_tone(driver->driver_data, freq);
+}
+
+
+static
+void driver_end_tone(beep_driver *driver)
+{
+    log_verbose_deferred("pcm driver_end_tone %p", (void *)driver);
+    pcm_data *const data = driver->driver_data;
+
+    data->inc = 0;
+}
+
+
+static
+void driver_wait(beep_driver *driver, const unsigned int milliseconds)
+{
+    pcm_advance(driver, milliseconds);
+}
+
+
+/* Same samples as edge by edge playback, without the per edge calls */
+static
+void driver_play_sequence(beep_driver *driver,
+                          const beep_tone *const tones, const size_t count,
+                          const volatile sig_atomic_t *const abort_flag)
+{
+    log_verbose("pcm driver_play_sequence %p %zu", (void *)driver, count);
+    pcm_data *const data = driver->driver_data;
+
+    for (size_t i=0; (!*abort_flag) && (i<count); ++i) {
+        pcm_start_tone(data, tones[i].freq & 0xffff);
+        pcm_advance(driver, tones[i].length);
+        data->inc = 0;
+        if (tones[i].delay > 0) {
+            pcm_advance(driver, tones[i].delay);
+        }
+    }
+}
+
+
+beep_driver pcm_driver =
+    {
+     "pcm",
+     NULL,
+     driver_detect,
+     driver_init,
+     driver_fini,
+     driver_begin_tone,
+     driver_end_tone,
+     driver_wait,
+     driver_play_sequence,
+     NULL,
+     NULL,
+     0,
+     NULL,
+     NULL
+    };
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
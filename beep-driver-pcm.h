@@ -0,0 +1,48 @@
+/* beep-driver-pcm.h - interface to the beep PCM synthesis driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_DRIVER_PCM_H
+#define BEEP_DRIVER_PCM_H
+
+
+#include "beep-driver.h"
+
+
+/** Device name prefix for raw signed 16bit little endian mono output */
+#define BEEP_PCM_PREFIX "pcm:"
+
+/** Device name prefix for the same samples in a WAV file */
+#define BEEP_WAV_PREFIX "wav:"
+
+/** Sample rate of the rendered PCM data in Hz */
+#define BEEP_PCM_RATE 48000U
+
+
+extern beep_driver pcm_driver;
+
+
+#endif /* BEEP_DRIVER_PCM_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,14220 @@
+	.file	"beep-driver-pcm.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-pcm.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"pcm driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL0:
+.LFB65:
+	.file 1 "beep-driver-pcm.c"
+	.loc 1 592 1 view -0
+	.cfi_startproc
+	.loc 1 592 1 is_stmt 0 view .LVU1
+	endbr64
+	.loc 1 593 5 is_stmt 1 view .LVU2
+	.loc 1 593 10 view .LVU3
+	.loc 1 593 13 is_stmt 0 view .LVU4
+	cmpl	$0, log_level(%rip)
+	jg	.L7
+	ret
+.L7:
+	.loc 1 592 1 discriminator 1 view .LVU5
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 593 46 is_stmt 1 discriminator 1 view .LVU6
+	movq	%rdi, %rsi
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 593 46 is_stmt 0 discriminator 1 view .LVU7
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL2:
+	.loc 1 593 8 is_stmt 1 discriminator 1 view .LVU8
+	.loc 1 594 1 is_stmt 0 discriminator 1 view .LVU9
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE65:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.1
+.LC1:
+	.string	"write pcm"
+	.text
+	.type	pcm_flush, @function
+pcm_flush:
+.LVL3:
+.LFB55:
+	.loc 1 256 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 256 1 is_stmt 0 view .LVU11
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 257 5 is_stmt 1 view .LVU12
+	.loc 1 257 21 is_stmt 0 view .LVU13
+	movq	104(%rdi), %rbx
+.LVL4:
+	.loc 1 265 5 is_stmt 1 view .LVU14
+	.loc 1 265 15 is_stmt 0 view .LVU15
+	movq	56(%rbx), %rax
+	leaq	(%rax,%rax), %rdx
+	.loc 1 265 48 view .LVU16
+	leaq	64(%rbx), %rsi
+	.loc 1 265 15 view .LVU17
+	movl	88(%rdi), %edi
+.LVL5:
+	.loc 1 265 15 view .LVU18
+	call	write_all@PLT
+.LVL6:
+	.loc 1 265 8 view .LVU19
+	cmpl	$-1, %eax
+	je	.L11
+	.loc 1 269 5 is_stmt 1 view .LVU20
+	.loc 1 269 26 is_stmt 0 view .LVU21
+	movq	56(%rbx), %rax
+	addq	%rax, 16(%rbx)
+	.loc 1 270 5 is_stmt 1 view .LVU22
+	.loc 1 270 16 is_stmt 0 view .LVU23
+	movq	$0, 56(%rbx)
+	.loc 1 271 1 view .LVU24
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL7:
+	.loc 1 271 1 view .LVU25
+	ret
+.LVL8:
+.L11:
+	.cfi_restore_state
+	.loc 1 267 9 is_stmt 1 view .LVU26
+	leaq	.LC1(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL9:
+	.cfi_endproc
+.LFE55:
+	.size	pcm_flush, .-pcm_flush
+	.section	.rodata.str1.1
+.LC2:
+	.string	"pcm driver_end_tone %p"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL10:
+.LFB70:
+	.loc 1 664 1 view -0
+	.cfi_startproc
+	.loc 1 664 1 is_stmt 0 view .LVU28
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 665 5 is_stmt 1 view .LVU29
+	.loc 1 665 10 view .LVU30
+	.loc 1 665 90 view .LVU31
+	.loc 1 665 93 is_stmt 0 view .LVU32
+	cmpl	$0, log_level(%rip)
+	jg	.L15
+.LVL11:
+.L13:
+	.loc 1 665 8 is_stmt 1 discriminator 6 view .LVU33
+	.loc 1 666 5 discriminator 6 view .LVU34
+	.loc 1 666 21 is_stmt 0 discriminator 6 view .LVU35
+	movq	104(%rbx), %rax
+.LVL12:
+	.loc 1 668 5 is_stmt 1 discriminator 6 view .LVU36
+	.loc 1 668 15 is_stmt 0 discriminator 6 view .LVU37
+	movl	$0, 8(%rax)
+	.loc 1 669 1 discriminator 6 view .LVU38
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL13:
+	.loc 1 669 1 discriminator 6 view .LVU39
+	ret
+.LVL14:
+.L15:
+	.cfi_restore_state
+	.loc 1 665 126 is_stmt 1 discriminator 4 view .LVU40
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rdi, %rsi
+	leaq	.LC2(%rip), %rdi
+	call	log_deferred@PLT
+.LVL15:
+	jmp	.L13
+	.cfi_endproc
+.LFE70:
+	.size	driver_end_tone, .-driver_end_tone
+	.type	render_square, @function
+render_square:
+.LVL16:
+.LFB51:
+	.loc 1 173 1 view -0
+	.cfi_startproc
+	.loc 1 173 1 is_stmt 0 view .LVU42
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r10
+	movq	%rsi, %rax
+	movl	%edx, %r8d
+	movl	%ecx, %edx
+.LVL17:
+	.loc 1 173 1 view .LVU43
+	movq	%fs:40, %rcx
+	movq	%rcx, 24(%rsp)
+	xorl	%ecx, %ecx
+.LVL18:
+	.loc 1 174 5 is_stmt 1 view .LVU44
+	.loc 1 174 24 is_stmt 0 view .LVU45
+	movl	%edx, %ecx
+	pxor	%xmm0, %xmm0
+	cvtsi2ssq	%rcx, %xmm0
+	.loc 1 174 17 view .LVU46
+	mulss	.LC3(%rip), %xmm0
+.LVL19:
+	.loc 1 175 5 is_stmt 1 view .LVU47
+	.loc 1 175 17 is_stmt 0 view .LVU48
+	movss	.LC4(%rip), %xmm6
+	movaps	%xmm6, %xmm8
+	divss	%xmm0, %xmm8
+.LVL20:
+	.loc 1 176 5 is_stmt 1 view .LVU49
+	.loc 1 176 16 is_stmt 0 view .LVU50
+	movaps	%xmm0, %xmm7
+	shufps	$0, %xmm7, %xmm7
+.LVL21:
+	.loc 1 177 5 is_stmt 1 view .LVU51
+	.loc 1 177 16 is_stmt 0 view .LVU52
+	shufps	$0, %xmm8, %xmm8
+.LVL22:
+	.loc 1 178 5 is_stmt 1 view .LVU53
+	.loc 1 179 5 view .LVU54
+	.loc 1 179 16 is_stmt 0 view .LVU55
+	subss	%xmm0, %xmm6
+.LVL23:
+	.loc 1 179 16 view .LVU56
+	shufps	$0, %xmm6, %xmm6
+.LVL24:
+	.loc 1 180 5 is_stmt 1 view .LVU57
+	.loc 1 182 5 view .LVU58
+	.loc 1 182 37 is_stmt 0 view .LVU59
+	leal	(%rdx,%rdx), %ecx
+	.loc 1 182 47 view .LVU60
+	leal	(%rcx,%rdx), %esi
+.LVL25:
+	.loc 1 182 16 view .LVU61
+	movd	%ecx, %xmm0
+.LVL26:
+	.loc 1 182 16 view .LVU62
+	movd	%esi, %xmm4
+	punpckldq	%xmm4, %xmm0
+	pxor	%xmm14, %xmm14
+	movd	%edx, %xmm4
+	punpckldq	%xmm4, %xmm14
+	punpcklqdq	%xmm0, %xmm14
+.LVL27:
+	.loc 1 183 5 is_stmt 1 view .LVU63
+	.loc 1 184 5 view .LVU64
+	.loc 1 185 5 view .LVU65
+	.loc 1 185 20 is_stmt 0 view .LVU66
+	leal	0(,%rdx,4), %r11d
+.LVL28:
+	.loc 1 187 5 is_stmt 1 view .LVU67
+	.loc 1 187 18 is_stmt 0 view .LVU68
+	movq	%rax, %r9
+	shrq	$2, %r9
+.LVL29:
+	.loc 1 188 5 is_stmt 1 view .LVU69
+	.loc 1 189 5 view .LVU70
+.LBB61:
+	.loc 1 189 10 view .LVU71
+	.loc 1 189 26 view .LVU72
+	.loc 1 189 17 is_stmt 0 view .LVU73
+	movl	$0, %esi
+.LBB62:
+	.loc 1 193 48 view .LVU74
+	movdqa	.LC5(%rip), %xmm11
+	.loc 1 193 35 view .LVU75
+	movdqa	.LC6(%rip), %xmm15
+.LBB63:
+.LBB64:
+	.loc 1 143 62 view .LVU76
+	movss	.LC8(%rip), %xmm10
+	shufps	$0, %xmm10, %xmm10
+.LBE64:
+.LBE63:
+.LBB66:
+.LBB67:
+	.loc 1 155 16 view .LVU77
+	movss	.LC10(%rip), %xmm12
+	shufps	$0, %xmm12, %xmm12
+	.loc 1 157 16 view .LVU78
+	movss	.LC4(%rip), %xmm4
+	.loc 1 157 16 view .LVU79
+	shufps	$0, %xmm4, %xmm4
+	.loc 1 157 16 view .LVU80
+	movaps	%xmm4, (%rsp)
+.LBE67:
+.LBE66:
+	.loc 1 201 19 view .LVU81
+	pxor	%xmm9, %xmm9
+	jmp	.L22
+.LVL30:
+.L19:
+	.loc 1 201 9 is_stmt 1 view .LVU82
+	.loc 1 201 19 is_stmt 0 view .LVU83
+	mulps	.LC12(%rip), %xmm0
+.LVL31:
+	.loc 1 201 19 view .LVU84
+	cvttps2dq	%xmm0, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm9, %xmm1
+	punpcklwd	%xmm9, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhwd	%xmm1, %xmm2
+	punpcklwd	%xmm1, %xmm0
+	punpcklwd	%xmm2, %xmm0
+	.loc 1 202 9 is_stmt 1 view .LVU85
+	.loc 1 202 12 is_stmt 0 view .LVU86
+	cmpq	%rsi, %r9
+	je	.L29
+	.loc 1 205 9 is_stmt 1 view .LVU87
+.LVL32:
+.LBB73:
+.LBI73:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/string_fortified.h"
+	.loc 2 26 42 view .LVU88
+.LBB74:
+	.loc 2 29 3 view .LVU89
+	.loc 2 29 10 is_stmt 0 view .LVU90
+	movq	%xmm0, (%rdi)
+.LVL33:
+	.loc 2 29 10 view .LVU91
+.LBE74:
+.LBE73:
+	.loc 1 206 9 is_stmt 1 view .LVU92
+	.loc 1 206 15 is_stmt 0 view .LVU93
+	addl	%r11d, %r8d
+.LVL34:
+	.loc 1 206 15 view .LVU94
+.LBE62:
+	.loc 1 189 42 is_stmt 1 view .LVU95
+	leaq	1(%rsi), %rcx
+.LVL35:
+	.loc 1 189 26 view .LVU96
+	addq	$8, %rdi
+	cmpq	%rsi, %r9
+	je	.L30
+	.loc 1 189 42 is_stmt 0 view .LVU97
+	movq	%rcx, %rsi
+.LVL36:
+.L22:
+.LBB87:
+	.loc 1 190 9 is_stmt 1 view .LVU98
+	.loc 1 191 9 view .LVU99
+	.loc 1 190 20 is_stmt 0 view .LVU100
+	movd	%r8d, %xmm4
+	pshufd	$0, %xmm4, %xmm1
+	.loc 1 191 20 view .LVU101
+	paddd	%xmm14, %xmm1
+.LVL37:
+	.loc 1 193 9 is_stmt 1 view .LVU102
+	.loc 1 193 48 is_stmt 0 view .LVU103
+	movdqa	%xmm1, %xmm4
+	pand	%xmm11, %xmm4
+	.loc 1 193 35 view .LVU104
+	por	%xmm15, %xmm4
+	.loc 1 193 14 view .LVU105
+	movaps	%xmm4, %xmm0
+.LVL38:
+	.loc 1 194 9 is_stmt 1 view .LVU106
+.LBB75:
+.LBI63:
+	.loc 1 139 6 view .LVU107
+.LBB65:
+	.loc 1 141 5 view .LVU108
+	.loc 1 142 5 view .LVU109
+	.loc 1 143 5 view .LVU110
+	.loc 1 143 49 is_stmt 0 view .LVU111
+	movdqa	%xmm1, %xmm2
+	psrld	$8, %xmm2
+	.loc 1 143 12 view .LVU112
+	cvtdq2ps	%xmm2, %xmm2
+	.loc 1 143 62 view .LVU113
+	mulps	%xmm10, %xmm2
+.LVL39:
+	.loc 1 143 62 view .LVU114
+.LBE65:
+.LBE75:
+	.loc 1 195 9 is_stmt 1 view .LVU115
+.LBB76:
+.LBI76:
+	.loc 1 139 6 view .LVU116
+.LBB77:
+	.loc 1 141 5 view .LVU117
+	.loc 1 142 5 view .LVU118
+	.loc 1 143 5 view .LVU119
+.LBE77:
+.LBE76:
+	.loc 1 195 25 is_stmt 0 view .LVU120
+	paddd	%xmm11, %xmm1
+.LVL40:
+.LBB79:
+.LBB78:
+	.loc 1 143 49 view .LVU121
+	psrld	$8, %xmm1
+	.loc 1 143 12 view .LVU122
+	cvtdq2ps	%xmm1, %xmm1
+	.loc 1 143 62 view .LVU123
+	mulps	%xmm10, %xmm1
+.LVL41:
+	.loc 1 143 62 view .LVU124
+.LBE78:
+.LBE79:
+	.loc 1 197 9 is_stmt 1 view .LVU125
+	.loc 1 197 59 is_stmt 0 view .LVU126
+	movaps	%xmm1, %xmm3
+	cmpltps	%xmm7, %xmm3
+	.loc 1 197 71 view .LVU127
+	movaps	%xmm6, %xmm5
+	cmpltps	%xmm1, %xmm5
+	.loc 1 197 65 view .LVU128
+	por	%xmm3, %xmm5
+	.loc 1 197 35 view .LVU129
+	movaps	%xmm2, %xmm13
+	cmpltps	%xmm7, %xmm13
+	.loc 1 197 46 view .LVU130
+	movaps	%xmm6, %xmm3
+	cmpltps	%xmm2, %xmm3
+	.loc 1 197 65 view .LVU131
+	por	%xmm13, %xmm3
+	por	%xmm5, %xmm3
+.LVL42:
+	.loc 1 198 9 is_stmt 1 view .LVU132
+	.loc 1 198 22 is_stmt 0 view .LVU133
+	movd	%xmm3, %ecx
+	.loc 1 198 37 view .LVU134
+	pshufd	$85, %xmm3, %xmm5
+	movd	%xmm5, %ebx
+	.loc 1 198 26 view .LVU135
+	orl	%ebx, %ecx
+	.loc 1 198 52 view .LVU136
+	movdqa	%xmm3, %xmm5
+	punpckhdq	%xmm3, %xmm5
+	movd	%xmm5, %ebx
+	.loc 1 198 41 view .LVU137
+	orl	%ebx, %ecx
+	.loc 1 198 67 view .LVU138
+	pshufd	$255, %xmm3, %xmm3
+.LVL43:
+	.loc 1 198 67 view .LVU139
+	movd	%xmm3, %ebx
+	.loc 1 198 12 view .LVU140
+	orl	%ebx, %ecx
+	je	.L19
+	.loc 1 199 13 is_stmt 1 view .LVU141
+.LVL44:
+.LBB80:
+.LBI66:
+	.loc 1 149 6 view .LVU142
+.LBB72:
+	.loc 1 151 5 view .LVU143
+	.loc 1 152 5 view .LVU144
+	.loc 1 154 5 view .LVU145
+	.loc 1 154 16 is_stmt 0 view .LVU146
+	movaps	%xmm8, %xmm0
+.LVL45:
+	.loc 1 154 16 view .LVU147
+	mulps	%xmm2, %xmm0
+.LVL46:
+	.loc 1 155 5 is_stmt 1 view .LVU148
+	.loc 1 155 34 is_stmt 0 view .LVU149
+	movaps	%xmm0, %xmm3
+	addps	%xmm0, %xmm3
+	.loc 1 155 54 view .LVU150
+	mulps	%xmm0, %xmm0
+.LVL47:
+	.loc 1 155 44 view .LVU151
+	subps	%xmm0, %xmm3
+	.loc 1 155 16 view .LVU152
+	addps	%xmm12, %xmm3
+.LVL48:
+	.loc 1 156 5 is_stmt 1 view .LVU153
+	.loc 1 156 30 is_stmt 0 view .LVU154
+	movaps	%xmm2, %xmm0
+	addps	%xmm12, %xmm0
+	.loc 1 156 16 view .LVU155
+	mulps	%xmm8, %xmm0
+.LVL49:
+	.loc 1 157 5 is_stmt 1 view .LVU156
+	.loc 1 159 5 view .LVU157
+.LBB68:
+.LBI68:
+	.loc 1 129 6 view .LVU158
+.LBB69:
+	.loc 1 131 5 view .LVU159
+.LBE69:
+.LBE68:
+	.loc 1 157 36 is_stmt 0 view .LVU160
+	movaps	%xmm0, %xmm5
+	mulps	%xmm0, %xmm5
+	.loc 1 157 47 view .LVU161
+	addps	%xmm0, %xmm5
+	.loc 1 157 58 view .LVU162
+	addps	%xmm0, %xmm5
+	.loc 1 157 16 view .LVU163
+	movaps	(%rsp), %xmm13
+	addps	%xmm13, %xmm5
+	movaps	%xmm6, %xmm0
+.LVL50:
+	.loc 1 157 16 view .LVU164
+	cmpltps	%xmm2, %xmm0
+	pand	%xmm5, %xmm0
+.LVL51:
+.LBB70:
+.LBI70:
+	.loc 1 129 6 is_stmt 1 view .LVU165
+.LBB71:
+	.loc 1 131 5 view .LVU166
+	.loc 1 131 42 is_stmt 0 view .LVU167
+	cmpltps	%xmm7, %xmm2
+.LVL52:
+	.loc 1 131 42 view .LVU168
+	pand	%xmm2, %xmm3
+.LVL53:
+	.loc 1 131 42 view .LVU169
+	pandn	%xmm0, %xmm2
+	por	%xmm3, %xmm2
+.LVL54:
+	.loc 1 131 42 view .LVU170
+.LBE71:
+.LBE70:
+.LBE72:
+.LBE80:
+.LBB81:
+.LBI81:
+	.loc 1 149 6 is_stmt 1 view .LVU171
+.LBB82:
+	.loc 1 151 5 view .LVU172
+	.loc 1 152 5 view .LVU173
+	.loc 1 154 5 view .LVU174
+	.loc 1 154 16 is_stmt 0 view .LVU175
+	movaps	%xmm8, %xmm0
+	mulps	%xmm1, %xmm0
+.LVL55:
+	.loc 1 155 5 is_stmt 1 view .LVU176
+	.loc 1 155 34 is_stmt 0 view .LVU177
+	movaps	%xmm0, %xmm3
+	addps	%xmm0, %xmm3
+	.loc 1 155 54 view .LVU178
+	mulps	%xmm0, %xmm0
+.LVL56:
+	.loc 1 155 44 view .LVU179
+	subps	%xmm0, %xmm3
+	.loc 1 155 16 view .LVU180
+	addps	%xmm12, %xmm3
+.LVL57:
+	.loc 1 156 5 is_stmt 1 view .LVU181
+	.loc 1 156 30 is_stmt 0 view .LVU182
+	movaps	%xmm1, %xmm0
+	addps	%xmm12, %xmm0
+	.loc 1 156 16 view .LVU183
+	mulps	%xmm8, %xmm0
+.LVL58:
+	.loc 1 157 5 is_stmt 1 view .LVU184
+	.loc 1 159 5 view .LVU185
+.LBB83:
+.LBI83:
+	.loc 1 129 6 view .LVU186
+.LBB84:
+	.loc 1 131 5 view .LVU187
+.LBE84:
+.LBE83:
+	.loc 1 157 36 is_stmt 0 view .LVU188
+	movaps	%xmm0, %xmm5
+	mulps	%xmm0, %xmm5
+	.loc 1 157 47 view .LVU189
+	addps	%xmm0, %xmm5
+	.loc 1 157 58 view .LVU190
+	addps	%xmm0, %xmm5
+	.loc 1 157 16 view .LVU191
+	addps	%xmm13, %xmm5
+	movaps	%xmm6, %xmm0
+.LVL59:
+	.loc 1 157 16 view .LVU192
+	cmpltps	%xmm1, %xmm0
+	pand	%xmm5, %xmm0
+.LVL60:
+.LBB85:
+.LBI85:
+	.loc 1 129 6 is_stmt 1 view .LVU193
+.LBB86:
+	.loc 1 131 5 view .LVU194
+	.loc 1 131 42 is_stmt 0 view .LVU195
+	cmpltps	%xmm7, %xmm1
+.LVL61:
+	.loc 1 131 42 view .LVU196
+	pand	%xmm1, %xmm3
+.LVL62:
+	.loc 1 131 42 view .LVU197
+	pandn	%xmm0, %xmm1
+	por	%xmm3, %xmm1
+.LVL63:
+	.loc 1 131 42 view .LVU198
+.LBE86:
+.LBE85:
+.LBE82:
+.LBE81:
+	.loc 1 199 47 view .LVU199
+	subps	%xmm1, %xmm2
+	.loc 1 199 15 view .LVU200
+	addps	%xmm4, %xmm2
+	movaps	%xmm2, %xmm0
+.LVL64:
+	.loc 1 199 15 view .LVU201
+	jmp	.L19
+.LVL65:
+.L29:
+	.loc 1 199 15 view .LVU202
+	movq	%xmm0, 16(%rsp)
+.LVL66:
+.L21:
+	.loc 1 199 15 view .LVU203
+.LBE87:
+.LBE61:
+	.loc 1 209 5 is_stmt 1 view .LVU204
+.LBB88:
+.LBI88:
+	.loc 2 26 42 view .LVU205
+.LBB89:
+	.loc 2 29 3 view .LVU206
+.LBE89:
+.LBE88:
+	.loc 1 209 12 is_stmt 0 view .LVU207
+	leaq	(%r10,%r9,8), %r9
+.LVL67:
+	.loc 1 209 53 view .LVU208
+	movq	%rax, %rcx
+	andl	$3, %ecx
+	.loc 1 209 5 view .LVU209
+	addq	%rcx, %rcx
+.LVL68:
+.LBB91:
+.LBB90:
+	.loc 2 29 10 view .LVU210
+	leaq	16(%rsp), %r10
+.LVL69:
+	.loc 2 29 10 view .LVU211
+	movl	%ecx, %r11d
+.LVL70:
+	.loc 2 29 10 view .LVU212
+	testl	%ecx, %ecx
+	je	.L24
+	movl	$0, %ecx
+.LVL71:
+.L23:
+	.loc 2 29 10 view .LVU213
+	movl	%ecx, %esi
+	movzbl	(%r10,%rsi), %edi
+	movb	%dil, (%r9,%rsi)
+	addl	$1, %ecx
+	cmpl	%r11d, %ecx
+	jb	.L23
+.L24:
+.LVL72:
+	.loc 2 29 10 view .LVU214
+.LBE90:
+.LBE91:
+	.loc 1 210 5 is_stmt 1 view .LVU215
+	.loc 1 210 20 is_stmt 0 view .LVU216
+	andl	$3, %eax
+.LVL73:
+	.loc 1 210 43 view .LVU217
+	imull	%edx, %eax
+	.loc 1 210 18 view .LVU218
+	addl	%r8d, %eax
+	.loc 1 211 1 view .LVU219
+	movq	24(%rsp), %rdx
+	subq	%fs:40, %rdx
+.LVL74:
+	.loc 1 211 1 view .LVU220
+	jne	.L31
+	.loc 1 211 1 view .LVU221
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.LVL75:
+.L30:
+	.cfi_restore_state
+	.loc 1 211 1 view .LVU222
+	movq	%xmm0, 16(%rsp)
+	jmp	.L21
+.LVL76:
+.L31:
+	.loc 1 211 1 view .LVU223
+	call	__stack_chk_fail@PLT
+.LVL77:
+	.loc 1 211 1 view .LVU224
+	.cfi_endproc
+.LFE51:
+	.size	render_square, .-render_square
+	.type	pcm_run_job, @function
+pcm_run_job:
+.LVL78:
+.LFB60:
+	.loc 1 359 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 359 1 is_stmt 0 view .LVU226
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r12
+	.loc 1 360 5 is_stmt 1 view .LVU227
+.LVL79:
+	.loc 1 361 5 view .LVU228
+	.loc 1 361 27 is_stmt 0 view .LVU229
+	movq	(%rdi), %rbp
+.LVL80:
+	.loc 1 363 5 is_stmt 1 view .LVU230
+	.loc 1 363 14 is_stmt 0 view .LVU231
+	movq	16(%rdi), %rdx
+.LVL81:
+	.loc 1 364 5 is_stmt 1 view .LVU232
+.LBB100:
+	.loc 1 364 10 view .LVU233
+.LBB101:
+.LBI101:
+	.loc 1 341 8 view .LVU234
+.LBB102:
+	.loc 1 343 5 view .LVU235
+	.loc 1 344 5 view .LVU236
+	.loc 1 344 12 is_stmt 0 view .LVU237
+	movq	32(%rbp), %rsi
+.LVL82:
+	.loc 1 345 5 is_stmt 1 view .LVU238
+	.loc 1 343 12 is_stmt 0 view .LVU239
+	movl	$0, %ebx
+	.loc 1 345 11 view .LVU240
+	jmp	.L34
+.LVL83:
+.L35:
+.LBB103:
+	.loc 1 346 9 is_stmt 1 view .LVU241
+	.loc 1 346 43 is_stmt 0 view .LVU242
+	shrq	%rax
+	.loc 1 346 22 view .LVU243
+	addq	%rbx, %rax
+.LVL84:
+	.loc 1 347 9 is_stmt 1 view .LVU244
+	.loc 1 347 32 is_stmt 0 view .LVU245
+	movq	%rax, %rcx
+	salq	$4, %rcx
+	addq	24(%rbp), %rcx
+	.loc 1 347 12 view .LVU246
+	cmpq	(%rcx), %rdx
+	.loc 1 346 22 view .LVU247
+	cmovb	%rax, %rsi
+.LVL85:
+	.loc 1 346 22 view .LVU248
+	cmovnb	%rax, %rbx
+.LVL86:
+.L34:
+	.loc 1 346 22 view .LVU249
+.LBE103:
+	.loc 1 345 22 is_stmt 1 view .LVU250
+	.loc 1 345 16 is_stmt 0 view .LVU251
+	movq	%rsi, %rax
+	subq	%rbx, %rax
+	.loc 1 345 22 view .LVU252
+	cmpq	$1, %rax
+	ja	.L35
+.LVL87:
+	.loc 1 345 22 view .LVU253
+.LBE102:
+.LBE101:
+	.loc 1 364 58 is_stmt 1 view .LVU254
+	.loc 1 364 63 is_stmt 0 view .LVU255
+	movq	24(%r12), %rax
+	.loc 1 364 58 view .LVU256
+	cmpq	%rax, %rdx
+	jb	.L41
+.LVL88:
+.L36:
+	.loc 1 364 58 view .LVU257
+.LBE100:
+	.loc 1 385 5 is_stmt 1 view .LVU258
+	.loc 1 386 1 is_stmt 0 view .LVU259
+	movl	$0, %eax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL89:
+	.loc 1 386 1 view .LVU260
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL90:
+	.loc 1 386 1 view .LVU261
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL91:
+	.loc 1 386 1 view .LVU262
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL92:
+.L37:
+	.cfi_restore_state
+.LBB111:
+.LBB104:
+	.loc 1 367 41 discriminator 2 view .LVU263
+	movq	48(%rbp), %r13
+	jmp	.L38
+.LVL93:
+.L39:
+	.loc 1 376 13 is_stmt 1 view .LVU264
+.LBB105:
+.LBI105:
+	.loc 2 57 42 view .LVU265
+.LBB106:
+	.loc 2 59 3 view .LVU266
+.LBE106:
+.LBE105:
+	.loc 1 376 13 is_stmt 0 view .LVU267
+	leaq	(%rax,%rax), %rdx
+.LVL94:
+.LBB108:
+.LBB107:
+	.loc 2 59 10 view .LVU268
+	movl	$0, %esi
+.LVL95:
+	.loc 2 59 10 view .LVU269
+	call	memset@PLT
+.LVL96:
+.L40:
+	.loc 2 59 10 view .LVU270
+.LBE107:
+.LBE108:
+.LBE104:
+	.loc 1 364 58 is_stmt 1 discriminator 1 view .LVU271
+	.loc 1 364 63 is_stmt 0 discriminator 1 view .LVU272
+	movq	24(%r12), %rax
+	.loc 1 364 58 discriminator 1 view .LVU273
+	cmpq	%rax, %r13
+	jnb	.L36
+	.loc 1 364 58 discriminator 1 view .LVU274
+	movq	%r13, %rdx
+.LVL97:
+.L41:
+.LBB110:
+	.loc 1 365 9 is_stmt 1 view .LVU275
+	.loc 1 365 45 is_stmt 0 view .LVU276
+	movq	24(%rbp), %rdi
+	movq	%rbx, %rcx
+	salq	$4, %rcx
+	.loc 1 365 34 view .LVU277
+	leaq	(%rdi,%rcx), %rsi
+.LVL98:
+	.loc 1 366 9 is_stmt 1 view .LVU278
+	.loc 1 366 37 is_stmt 0 view .LVU279
+	addq	$1, %rbx
+.LVL99:
+	.loc 1 367 41 view .LVU280
+	cmpq	32(%rbp), %rbx
+	jnb	.L37
+	.loc 1 367 41 discriminator 1 view .LVU281
+	movq	16(%rdi,%rcx), %r13
+.L38:
+.LVL100:
+	.loc 1 368 9 is_stmt 1 view .LVU282
+	.loc 1 368 24 is_stmt 0 view .LVU283
+	cmpq	%rax, %r13
+	cmova	%rax, %r13
+.LVL101:
+	.loc 1 369 9 is_stmt 1 view .LVU284
+	.loc 1 369 24 is_stmt 0 view .LVU285
+	movq	8(%r12), %rax
+	leaq	(%rax,%rdx,2), %rdi
+.LVL102:
+	.loc 1 370 9 is_stmt 1 view .LVU286
+	.loc 1 370 22 is_stmt 0 view .LVU287
+	movq	%r13, %rax
+	subq	%rdx, %rax
+.LVL103:
+	.loc 1 371 9 is_stmt 1 view .LVU288
+	.loc 1 371 16 is_stmt 0 view .LVU289
+	movl	12(%rsi), %ecx
+	.loc 1 371 12 view .LVU290
+	testl	%ecx, %ecx
+	je	.L39
+.LBB109:
+	.loc 1 372 13 is_stmt 1 view .LVU291
+.LVL104:
+	.loc 1 374 13 view .LVU292
+	.loc 1 373 37 is_stmt 0 view .LVU293
+	subq	(%rsi), %rdx
+.LVL105:
+	.loc 1 373 19 view .LVU294
+	imull	%ecx, %edx
+	.loc 1 372 28 view .LVU295
+	addl	8(%rsi), %edx
+	.loc 1 374 13 view .LVU296
+	movq	%rax, %rsi
+.LVL106:
+	.loc 1 374 13 view .LVU297
+	call	render_square
+.LVL107:
+	.loc 1 374 13 view .LVU298
+.LBE109:
+	jmp	.L40
+.LBE110:
+.LBE111:
+	.cfi_endproc
+.LFE60:
+	.size	pcm_run_job, .-pcm_run_job
+	.type	pcm_render, @function
+pcm_render:
+.LVL108:
+.LFB56:
+	.loc 1 276 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 276 1 is_stmt 0 view .LVU300
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 277 5 is_stmt 1 view .LVU301
+	.loc 1 277 21 is_stmt 0 view .LVU302
+	movq	104(%rdi), %rbp
+.LVL109:
+	.loc 1 279 5 is_stmt 1 view .LVU303
+	.loc 1 279 19 view .LVU304
+	testq	%rsi, %rsi
+	je	.L45
+	movq	%rdi, %r14
+	movq	%rsi, %r12
+.LBB112:
+	.loc 1 280 22 is_stmt 0 view .LVU305
+	movl	$65536, %r13d
+	jmp	.L50
+.LVL110:
+.L47:
+	.loc 1 286 13 is_stmt 1 view .LVU306
+.LBB113:
+.LBI113:
+	.loc 2 57 42 view .LVU307
+.LBB114:
+	.loc 2 59 3 view .LVU308
+.LBE114:
+.LBE113:
+	.loc 1 286 13 is_stmt 0 view .LVU309
+	leaq	(%rbx,%rbx), %rdx
+.LBB116:
+.LBB115:
+	.loc 2 59 10 view .LVU310
+	movl	$0, %esi
+	call	memset@PLT
+.LVL111:
+.L48:
+	.loc 2 59 10 view .LVU311
+.LBE115:
+.LBE116:
+	.loc 1 288 9 is_stmt 1 view .LVU312
+	.loc 1 288 20 is_stmt 0 view .LVU313
+	movq	%rbx, %rax
+	addq	56(%rbp), %rax
+	movq	%rax, 56(%rbp)
+	.loc 1 289 9 is_stmt 1 view .LVU314
+	.loc 1 289 16 is_stmt 0 view .LVU315
+	subq	%rbx, %r12
+.LVL112:
+	.loc 1 290 9 is_stmt 1 view .LVU316
+	.loc 1 290 12 is_stmt 0 view .LVU317
+	cmpq	$65536, %rax
+	je	.L53
+.L49:
+	.loc 1 290 12 view .LVU318
+.LBE112:
+	.loc 1 279 19 is_stmt 1 view .LVU319
+	testq	%r12, %r12
+	je	.L45
+.LVL113:
+.L50:
+.LBB117:
+	.loc 1 280 9 view .LVU320
+	.loc 1 280 43 is_stmt 0 view .LVU321
+	movq	56(%rbp), %rax
+.LVL114:
+	.loc 1 281 9 is_stmt 1 view .LVU322
+	.loc 1 280 22 is_stmt 0 view .LVU323
+	movq	%r13, %rbx
+	subq	%rax, %rbx
+	.loc 1 281 22 view .LVU324
+	cmpq	%r12, %rbx
+	cmova	%r12, %rbx
+.LVL115:
+	.loc 1 282 9 is_stmt 1 view .LVU325
+	.loc 1 282 24 is_stmt 0 view .LVU326
+	leaq	64(%rbp,%rax,2), %rdi
+.LVL116:
+	.loc 1 283 9 is_stmt 1 view .LVU327
+	.loc 1 283 17 is_stmt 0 view .LVU328
+	movl	8(%rbp), %ecx
+	.loc 1 283 12 view .LVU329
+	testl	%ecx, %ecx
+	je	.L47
+	.loc 1 284 13 is_stmt 1 view .LVU330
+	.loc 1 284 27 is_stmt 0 view .LVU331
+	movl	4(%rbp), %edx
+	movq	%rbx, %rsi
+	call	render_square
+.LVL117:
+	.loc 1 284 25 view .LVU332
+	movl	%eax, 4(%rbp)
+	jmp	.L48
+.L53:
+	.loc 1 291 13 is_stmt 1 view .LVU333
+	movq	%r14, %rdi
+	call	pcm_flush
+.LVL118:
+	jmp	.L49
+.LVL119:
+.L45:
+	.loc 1 291 13 is_stmt 0 view .LVU334
+.LBE117:
+	.loc 1 294 1 view .LVU335
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL120:
+	.loc 1 294 1 view .LVU336
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	pcm_render, .-pcm_render
+	.section	.rodata.str1.1
+.LC14:
+	.string	"realloc pcm segments"
+	.text
+	.type	pcm_advance, @function
+pcm_advance:
+.LVL121:
+.LFB68:
+	.loc 1 642 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 642 1 is_stmt 0 view .LVU338
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 643 5 is_stmt 1 view .LVU339
+	.loc 1 643 21 is_stmt 0 view .LVU340
+	movq	104(%rdi), %rbx
+.LVL122:
+	.loc 1 644 5 is_stmt 1 view .LVU341
+	.loc 1 644 29 is_stmt 0 view .LVU342
+	movl	%esi, %esi
+	.loc 1 644 20 view .LVU343
+	leaq	(%rsi,%rsi,2), %rbp
+	salq	$4, %rbp
+.LVL123:
+	.loc 1 646 5 is_stmt 1 view .LVU344
+	.loc 1 646 8 is_stmt 0 view .LVU345
+	cmpb	$0, 2(%rbx)
+	je	.L55
+	.loc 1 647 9 is_stmt 1 view .LVU346
+.LVL124:
+.LBB124:
+.LBI124:
+	.loc 1 312 6 view .LVU347
+.LBB125:
+	.loc 1 314 5 view .LVU348
+	.loc 1 316 5 view .LVU349
+.LBB126:
+.LBI126:
+	.loc 1 299 5 view .LVU350
+.LBB127:
+	.loc 1 301 5 view .LVU351
+	.loc 1 301 13 is_stmt 0 view .LVU352
+	movq	32(%rbx), %rdx
+	.loc 1 301 8 view .LVU353
+	testq	%rdx, %rdx
+	je	.L56
+	.loc 1 304 5 is_stmt 1 view .LVU354
+	.loc 1 304 52 is_stmt 0 view .LVU355
+	movq	%rdx, %rax
+	salq	$4, %rax
+	.loc 1 304 30 view .LVU356
+	movq	24(%rbx), %rcx
+	leaq	-16(%rcx,%rax), %rcx
+.LVL125:
+	.loc 1 305 5 is_stmt 1 view .LVU357
+	.loc 1 306 63 is_stmt 0 view .LVU358
+	movl	12(%rcx), %eax
+.LVL126:
+	.loc 1 307 5 is_stmt 1 view .LVU359
+	.loc 1 307 37 is_stmt 0 view .LVU360
+	cmpl	8(%rbx), %eax
+	je	.L64
+.LVL127:
+.L56:
+	.loc 1 307 37 view .LVU361
+.LBE127:
+.LBE126:
+.LBB129:
+	.loc 1 317 9 is_stmt 1 view .LVU362
+	.loc 1 317 40 is_stmt 0 view .LVU363
+	movq	40(%rbx), %rax
+	.loc 1 317 12 view .LVU364
+	cmpq	%rdx, %rax
+	je	.L65
+.LVL128:
+.L58:
+	.loc 1 328 9 is_stmt 1 view .LVU365
+	.loc 1 328 54 is_stmt 0 view .LVU366
+	movq	32(%rbx), %rax
+	.loc 1 328 69 view .LVU367
+	leaq	1(%rax), %rdx
+	movq	%rdx, 32(%rbx)
+	.loc 1 328 49 view .LVU368
+	salq	$4, %rax
+	.loc 1 328 28 view .LVU369
+	addq	24(%rbx), %rax
+.LVL129:
+	.loc 1 329 9 is_stmt 1 view .LVU370
+	.loc 1 329 26 is_stmt 0 view .LVU371
+	movq	48(%rbx), %rdx
+	.loc 1 329 20 view .LVU372
+	movq	%rdx, (%rax)
+	.loc 1 330 9 is_stmt 1 view .LVU373
+	.loc 1 330 26 is_stmt 0 view .LVU374
+	movl	4(%rbx), %edx
+	.loc 1 330 20 view .LVU375
+	movl	%edx, 8(%rax)
+	.loc 1 331 9 is_stmt 1 view .LVU376
+	.loc 1 331 24 is_stmt 0 view .LVU377
+	movl	8(%rbx), %edx
+	.loc 1 331 18 view .LVU378
+	movl	%edx, 12(%rax)
+	jmp	.L57
+.LVL130:
+.L64:
+	.loc 1 331 18 view .LVU379
+.LBE129:
+.LBB131:
+.LBB128:
+	.loc 1 306 42 view .LVU380
+	movq	48(%rbx), %rsi
+	subq	(%rcx), %rsi
+	.loc 1 306 11 view .LVU381
+	imull	%esi, %eax
+	.loc 1 305 20 view .LVU382
+	addl	8(%rcx), %eax
+.LBE128:
+.LBE131:
+	.loc 1 316 8 view .LVU383
+	cmpl	4(%rbx), %eax
+	jne	.L56
+.LVL131:
+.L57:
+	.loc 1 334 5 is_stmt 1 view .LVU384
+	.loc 1 334 24 is_stmt 0 view .LVU385
+	addq	%rbp, 48(%rbx)
+	.loc 1 335 5 is_stmt 1 view .LVU386
+	.loc 1 335 20 is_stmt 0 view .LVU387
+	imull	8(%rbx), %ebp
+.LVL132:
+	.loc 1 335 17 view .LVU388
+	addl	%ebp, 4(%rbx)
+	.loc 1 336 1 view .LVU389
+	jmp	.L54
+.LVL133:
+.L65:
+.LBB132:
+.LBB130:
+	.loc 1 318 13 is_stmt 1 view .LVU390
+	.loc 1 319 71 is_stmt 0 view .LVU391
+	leaq	(%rax,%rax), %r12
+	testq	%rax, %rax
+	movl	$1024, %eax
+	cmove	%rax, %r12
+.LVL134:
+	.loc 1 320 13 is_stmt 1 view .LVU392
+	.loc 1 321 17 is_stmt 0 view .LVU393
+	movq	%r12, %rsi
+	salq	$4, %rsi
+	movq	24(%rbx), %rdi
+.LVL135:
+	.loc 1 321 17 view .LVU394
+	call	realloc@PLT
+.LVL136:
+	.loc 1 322 13 is_stmt 1 view .LVU395
+	.loc 1 322 16 is_stmt 0 view .LVU396
+	testq	%rax, %rax
+	je	.L66
+	.loc 1 325 13 is_stmt 1 view .LVU397
+	.loc 1 325 28 is_stmt 0 view .LVU398
+	movq	%rax, 24(%rbx)
+	.loc 1 326 13 is_stmt 1 view .LVU399
+	.loc 1 326 33 is_stmt 0 view .LVU400
+	movq	%r12, 40(%rbx)
+	jmp	.L58
+.L66:
+	.loc 1 323 17 is_stmt 1 view .LVU401
+	leaq	.LC14(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL137:
+.L55:
+	.loc 1 323 17 is_stmt 0 view .LVU402
+.LBE130:
+.LBE132:
+.LBE125:
+.LBE124:
+	.loc 1 649 9 is_stmt 1 view .LVU403
+	movq	%rbp, %rsi
+	call	pcm_render
+.LVL138:
+.L54:
+	.loc 1 651 1 is_stmt 0 view .LVU404
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL139:
+	.loc 1 651 1 view .LVU405
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE68:
+	.size	pcm_advance, .-pcm_advance
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC15:
+	.string	"pcm driver_play_sequence %p %zu"
+	.text
+	.type	driver_play_sequence, @function
+driver_play_sequence:
+.LVL140:
+.LFB72:
+	.loc 1 684 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 684 1 is_stmt 0 view .LVU407
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, (%rsp)
+	movq	%rsi, %rbx
+	movq	%rdx, %r15
+	movq	%rcx, 8(%rsp)
+	.loc 1 685 5 is_stmt 1 view .LVU408
+	.loc 1 685 10 view .LVU409
+	.loc 1 685 13 is_stmt 0 view .LVU410
+	cmpl	$0, log_level(%rip)
+	jg	.L77
+.LVL141:
+.L68:
+	.loc 1 685 8 is_stmt 1 discriminator 3 view .LVU411
+	.loc 1 686 5 discriminator 3 view .LVU412
+	.loc 1 686 21 is_stmt 0 discriminator 3 view .LVU413
+	movq	(%rsp), %rax
+	movq	104(%rax), %rbp
+.LVL142:
+	.loc 1 688 5 is_stmt 1 discriminator 3 view .LVU414
+.LBB136:
+	.loc 1 688 10 discriminator 3 view .LVU415
+	.loc 1 688 37 discriminator 3 view .LVU416
+	.loc 1 688 24 is_stmt 0 discriminator 3 view .LVU417
+	movq	8(%rsp), %rax
+	movl	(%rax), %eax
+	.loc 1 688 37 discriminator 3 view .LVU418
+	testq	%r15, %r15
+	je	.L67
+	testl	%eax, %eax
+	jne	.L67
+	.loc 1 688 17 view .LVU419
+	movl	$0, %r12d
+.LBB137:
+.LBB138:
+	.loc 1 635 9 view .LVU420
+	movl	$0, %r14d
+	jmp	.L72
+.LVL143:
+.L77:
+	.loc 1 635 9 view .LVU421
+.LBE138:
+.LBE137:
+.LBE136:
+	.loc 1 685 46 is_stmt 1 discriminator 1 view .LVU422
+	movq	%rdi, %rsi
+	leaq	.LC15(%rip), %rdi
+.LVL144:
+	.loc 1 685 46 is_stmt 0 discriminator 1 view .LVU423
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL145:
+	.loc 1 685 46 discriminator 1 view .LVU424
+	jmp	.L68
+.LVL146:
+.L70:
+.LBB143:
+.LBB141:
+.LBB139:
+	.loc 1 633 15 view .LVU425
+	movl	%edx, 8(%rbp)
+.LVL147:
+	.loc 1 636 5 is_stmt 1 view .LVU426
+	.loc 1 636 17 is_stmt 0 view .LVU427
+	movl	%r14d, 4(%rbp)
+.LVL148:
+	.loc 1 636 17 view .LVU428
+.LBE139:
+.LBE141:
+	.loc 1 690 9 is_stmt 1 view .LVU429
+	movl	4(%r13), %esi
+	movq	(%rsp), %rdi
+	call	pcm_advance
+.LVL149:
+	.loc 1 691 9 view .LVU430
+	.loc 1 691 19 is_stmt 0 view .LVU431
+	movl	$0, 8(%rbp)
+	.loc 1 692 9 is_stmt 1 view .LVU432
+	.loc 1 692 21 is_stmt 0 view .LVU433
+	movl	8(%r13), %esi
+	.loc 1 692 12 view .LVU434
+	testl	%esi, %esi
+	jne	.L78
+.L71:
+	.loc 1 688 51 is_stmt 1 discriminator 2 view .LVU435
+	addq	$1, %r12
+.LVL150:
+	.loc 1 688 37 discriminator 2 view .LVU436
+	.loc 1 688 24 is_stmt 0 discriminator 2 view .LVU437
+	movq	8(%rsp), %rax
+	movl	(%rax), %eax
+	.loc 1 688 37 discriminator 2 view .LVU438
+	addq	$16, %rbx
+	cmpq	%r15, %r12
+	jnb	.L67
+	testl	%eax, %eax
+	jne	.L67
+.LVL151:
+.L72:
+	.loc 1 689 9 is_stmt 1 view .LVU439
+	movq	%rbx, %r13
+	.loc 1 689 38 is_stmt 0 view .LVU440
+	movl	(%rbx), %eax
+.LVL152:
+.LBB142:
+.LBI137:
+	.loc 1 630 6 is_stmt 1 view .LVU441
+.LBB140:
+	.loc 1 633 5 view .LVU442
+	.loc 1 633 22 is_stmt 0 view .LVU443
+	movzwl	%ax, %ecx
+	addl	%ecx, %ecx
+	.loc 1 635 9 view .LVU444
+	movl	%r14d, %edx
+	cmpl	$47999, %ecx
+	ja	.L70
+	.loc 1 634 24 view .LVU445
+	movzwl	%ax, %eax
+	.loc 1 634 39 view .LVU446
+	salq	$32, %rax
+.LVL153:
+	.loc 1 634 46 view .LVU447
+	leaq	24000(%rax), %rdx
+	.loc 1 634 61 view .LVU448
+	movabsq	$-5853766786057164379, %rax
+	mulq	%rdx
+	shrq	$15, %rdx
+	jmp	.L70
+.LVL154:
+.L78:
+	.loc 1 634 61 view .LVU449
+.LBE140:
+.LBE142:
+	.loc 1 693 13 is_stmt 1 view .LVU450
+	movq	(%rsp), %rdi
+	call	pcm_advance
+.LVL155:
+	jmp	.L71
+.LVL156:
+.L67:
+	.loc 1 693 13 is_stmt 0 view .LVU451
+.LBE143:
+	.loc 1 696 1 view .LVU452
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL157:
+	.loc 1 696 1 view .LVU453
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL158:
+	.loc 1 696 1 view .LVU454
+	ret
+	.cfi_endproc
+.LFE72:
+	.size	driver_play_sequence, .-driver_play_sequence
+	.type	driver_wait, @function
+driver_wait:
+.LVL159:
+.LFB71:
+	.loc 1 674 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 674 1 is_stmt 0 view .LVU456
+	endbr64
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 675 5 is_stmt 1 view .LVU457
+	call	pcm_advance
+.LVL160:
+	.loc 1 676 1 is_stmt 0 view .LVU458
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE71:
+	.size	driver_wait, .-driver_wait
+	.section	.rodata.str1.1
+.LC16:
+	.string	"pcm driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL161:
+.LFB69:
+	.loc 1 656 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 656 1 is_stmt 0 view .LVU460
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	movl	%esi, %ebx
+	.loc 1 657 5 is_stmt 1 view .LVU461
+	.loc 1 657 10 view .LVU462
+	.loc 1 657 101 view .LVU463
+	.loc 1 657 104 is_stmt 0 view .LVU464
+	cmpl	$0, log_level(%rip)
+	jg	.L86
+.LVL162:
+.L82:
+	.loc 1 657 8 is_stmt 1 discriminator 6 view .LVU465
+	.loc 1 658 5 discriminator 6 view .LVU466
+	.loc 1 658 26 is_stmt 0 discriminator 6 view .LVU467
+	movq	104(%rbp), %rcx
+.LVL163:
+.LBB146:
+.LBI146:
+	.loc 1 630 6 is_stmt 1 discriminator 6 view .LVU468
+.LBB147:
+	.loc 1 633 5 discriminator 6 view .LVU469
+	.loc 1 633 22 is_stmt 0 discriminator 6 view .LVU470
+	movzwl	%bx, %eax
+	addl	%eax, %eax
+	.loc 1 635 9 discriminator 6 view .LVU471
+	movl	$0, %edx
+	cmpl	$47999, %eax
+	ja	.L83
+	.loc 1 634 24 view .LVU472
+	movzwl	%bx, %ebx
+	.loc 1 634 39 view .LVU473
+	salq	$32, %rbx
+.LVL164:
+	.loc 1 634 46 view .LVU474
+	addq	$24000, %rbx
+	.loc 1 634 61 view .LVU475
+	movabsq	$-5853766786057164379, %rdx
+	movq	%rbx, %rax
+	mulq	%rdx
+	shrq	$15, %rdx
+.L83:
+	.loc 1 633 15 view .LVU476
+	movl	%edx, 8(%rcx)
+	.loc 1 636 5 is_stmt 1 view .LVU477
+	.loc 1 636 17 is_stmt 0 view .LVU478
+	movl	$0, 4(%rcx)
+.LVL165:
+	.loc 1 636 17 view .LVU479
+.LBE147:
+.LBE146:
+	.loc 1 659 1 view .LVU480
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL166:
+	.loc 1 659 1 view .LVU481
+	ret
+.LVL167:
+.L86:
+	.cfi_restore_state
+	.loc 1 657 137 is_stmt 1 discriminator 4 view .LVU482
+	movzwl	%si, %ecx
+	movl	$1, %edx
+	movq	%rdi, %rsi
+.LVL168:
+	.loc 1 657 137 is_stmt 0 discriminator 4 view .LVU483
+	leaq	.LC16(%rip), %rdi
+.LVL169:
+	.loc 1 657 137 discriminator 4 view .LVU484
+	call	log_deferred@PLT
+.LVL170:
+	.loc 1 657 137 discriminator 4 view .LVU485
+	jmp	.L82
+	.cfi_endproc
+.LFE69:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"pcm: cannot map output file (%s), rendering serially"
+	.section	.rodata.str1.1
+.LC18:
+	.string	"BEEP_PCM_THREADS"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"pcm: rendering %llu frames in %zu segments on %u threads"
+	.text
+	.type	pcm_render_offline, @function
+pcm_render_offline:
+.LVL171:
+.LFB63:
+	.loc 1 441 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 441 1 is_stmt 0 view .LVU487
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$2696, %rsp
+	.cfi_def_cfa_offset 2752
+	.loc 1 441 1 view .LVU488
+	movq	%fs:40, %rax
+	movq	%rax, 2680(%rsp)
+	xorl	%eax, %eax
+	.loc 1 442 5 is_stmt 1 view .LVU489
+	.loc 1 442 21 is_stmt 0 view .LVU490
+	movq	104(%rdi), %rbx
+.LVL172:
+	.loc 1 443 5 is_stmt 1 view .LVU491
+	.loc 1 443 20 is_stmt 0 view .LVU492
+	movq	48(%rbx), %rbp
+.LVL173:
+	.loc 1 444 5 is_stmt 1 view .LVU493
+	.loc 1 444 8 is_stmt 0 view .LVU494
+	testq	%rbp, %rbp
+	je	.L87
+	movq	%rdi, %r12
+	.loc 1 448 5 is_stmt 1 view .LVU495
+	.loc 1 448 51 is_stmt 0 view .LVU496
+	movzbl	(%rbx), %eax
+	negb	%al
+	sbbq	%r13, %r13
+	andl	$44, %r13d
+.LVL174:
+	.loc 1 449 5 is_stmt 1 view .LVU497
+	.loc 1 449 18 is_stmt 0 view .LVU498
+	leaq	0(%r13,%rbp,2), %r15
+	movq	%r15, 24(%rsp)
+.LVL175:
+	.loc 1 450 5 is_stmt 1 view .LVU499
+	.loc 1 451 5 view .LVU500
+	.loc 1 451 14 is_stmt 0 view .LVU501
+	movl	88(%rdi), %edi
+.LVL176:
+	.loc 1 451 14 view .LVU502
+	movq	%r15, %rsi
+	call	ftruncate@PLT
+.LVL177:
+	.loc 1 451 8 view .LVU503
+	testl	%eax, %eax
+	je	.L133
+.LVL178:
+.L90:
+	.loc 1 456 9 is_stmt 1 view .LVU504
+	.loc 1 456 14 view .LVU505
+	.loc 1 456 17 is_stmt 0 view .LVU506
+	cmpl	$0, log_level(%rip)
+	jg	.L134
+.L92:
+.LVL179:
+.LBB162:
+	.loc 1 458 30 is_stmt 1 discriminator 1 view .LVU507
+	.loc 1 458 36 is_stmt 0 discriminator 1 view .LVU508
+	movq	32(%rbx), %rdx
+	.loc 1 458 30 discriminator 1 view .LVU509
+	testq	%rdx, %rdx
+	je	.L87
+	.loc 1 458 30 view .LVU510
+	movl	$0, %r13d
+.LVL180:
+	.loc 1 458 30 view .LVU511
+	jmp	.L94
+.LVL181:
+.L133:
+	.loc 1 458 30 view .LVU512
+.LBE162:
+	.loc 1 452 9 is_stmt 1 view .LVU513
+	.loc 1 452 15 is_stmt 0 view .LVU514
+	movl	$0, %r9d
+	movl	88(%r12), %r8d
+	movl	$1, %ecx
+	movl	$3, %edx
+	movq	%r15, %rsi
+	movl	$0, %edi
+	call	mmap@PLT
+.LVL182:
+	movq	%rax, 16(%rsp)
+.LVL183:
+	.loc 1 455 5 is_stmt 1 view .LVU515
+	.loc 1 455 8 is_stmt 0 view .LVU516
+	cmpq	$-1, %rax
+	je	.L90
+	.loc 1 468 5 is_stmt 1 view .LVU517
+.LVL184:
+.LBB165:
+.LBI165:
+	.loc 1 413 14 view .LVU518
+.LBB166:
+	.loc 1 415 5 view .LVU519
+	.loc 1 415 32 is_stmt 0 view .LVU520
+	leaq	.LC18(%rip), %rdi
+	call	getenv@PLT
+.LVL185:
+	.loc 1 416 5 is_stmt 1 view .LVU521
+	.loc 1 416 8 is_stmt 0 view .LVU522
+	testq	%rax, %rax
+	je	.L95
+	.loc 1 416 16 view .LVU523
+	cmpb	$0, (%rax)
+	jne	.L135
+.LVL186:
+.L95:
+	.loc 1 424 5 is_stmt 1 view .LVU524
+	.loc 1 425 5 view .LVU525
+	.loc 1 426 5 view .LVU526
+	.loc 1 426 14 is_stmt 0 view .LVU527
+	leaq	624(%rsp), %rdx
+	movl	$128, %esi
+	movl	$0, %edi
+	call	sched_getaffinity@PLT
+.LVL187:
+	.loc 1 424 18 view .LVU528
+	movl	$1, %r12d
+	.loc 1 426 8 view .LVU529
+	testl	%eax, %eax
+	je	.L136
+.LVL188:
+.L98:
+	.loc 1 429 5 is_stmt 1 view .LVU530
+	.loc 1 429 20 is_stmt 0 view .LVU531
+	movabsq	$-5853766786057164379, %rdx
+	movq	%rbp, %rax
+	mulq	%rdx
+	shrq	$15, %rdx
+.LVL189:
+	.loc 1 430 5 is_stmt 1 view .LVU532
+	.loc 1 430 36 is_stmt 0 view .LVU533
+	movl	%r12d, %eax
+	.loc 1 430 67 view .LVU534
+	cmpq	%rax, %rdx
+	cmovb	%edx, %r12d
+.LVL190:
+	.loc 1 431 5 is_stmt 1 view .LVU535
+	testl	%r12d, %r12d
+	movl	$1, %eax
+.LVL191:
+	.loc 1 431 5 is_stmt 0 view .LVU536
+	cmove	%eax, %r12d
+.LVL192:
+	.loc 1 431 5 view .LVU537
+	movl	$64, %eax
+	cmpl	%eax, %r12d
+	cmova	%eax, %r12d
+.LVL193:
+.L97:
+	.loc 1 431 5 view .LVU538
+.LBE166:
+.LBE165:
+	.loc 1 469 5 is_stmt 1 view .LVU539
+	.loc 1 469 10 view .LVU540
+	.loc 1 469 13 is_stmt 0 view .LVU541
+	cmpl	$0, log_level(%rip)
+	jg	.L137
+.L100:
+	.loc 1 469 8 is_stmt 1 discriminator 3 view .LVU542
+	.loc 1 472 5 discriminator 3 view .LVU543
+	.loc 1 473 5 discriminator 3 view .LVU544
+	.loc 1 474 4 discriminator 3 view .LVU545
+	.loc 1 475 5 discriminator 3 view .LVU546
+	.loc 1 475 41 is_stmt 0 discriminator 3 view .LVU547
+	leal	0(,%r12,4), %ecx
+	.loc 1 475 20 discriminator 3 view .LVU548
+	movq	%rbp, %rax
+	movl	$0, %edx
+	divq	%rcx
+	movq	%rax, (%rsp)
+.LVL194:
+	.loc 1 476 5 is_stmt 1 discriminator 3 view .LVU549
+	.loc 1 477 5 discriminator 3 view .LVU550
+.LBB169:
+	.loc 1 477 10 discriminator 3 view .LVU551
+	.loc 1 477 32 discriminator 3 view .LVU552
+.LBB170:
+	.loc 1 478 40 is_stmt 0 discriminator 3 view .LVU553
+	movl	%r12d, %ecx
+	movq	%rbp, %rax
+.LVL195:
+	.loc 1 478 40 discriminator 3 view .LVU554
+	movl	$0, %edx
+	divq	%rcx
+	leaq	624(%rsp), %r15
+.LVL196:
+	.loc 1 478 40 discriminator 3 view .LVU555
+	movq	%r15, %r9
+	movq	%rax, %rdi
+.LBE170:
+	.loc 1 477 23 discriminator 3 view .LVU556
+	movl	$0, %edx
+.LBE169:
+	.loc 1 476 14 discriminator 3 view .LVU557
+	movl	$0, %r10d
+.LBB184:
+.LBB180:
+	.loc 1 485 23 discriminator 3 view .LVU558
+	movq	16(%rsp), %rsi
+	addq	%r13, %rsi
+	movq	%rsi, 8(%rsp)
+	jmp	.L111
+.LVL197:
+.L134:
+	.loc 1 485 23 discriminator 3 view .LVU559
+.LBE180:
+.LBE184:
+	.loc 1 456 50 is_stmt 1 discriminator 1 view .LVU560
+	.loc 1 456 10 is_stmt 0 discriminator 1 view .LVU561
+	call	__errno_location@PLT
+.LVL198:
+	.loc 1 456 50 discriminator 1 view .LVU562
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL199:
+	movq	%rax, %rsi
+	leaq	.LC17(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL200:
+	jmp	.L92
+.LVL201:
+.L93:
+.LBB185:
+.LBB163:
+	.loc 1 461 13 is_stmt 1 discriminator 2 view .LVU563
+	.loc 1 461 41 is_stmt 0 discriminator 2 view .LVU564
+	movq	%r13, %rax
+	salq	$4, %rax
+	movq	24(%rbx), %rdx
+	leaq	-16(%rdx,%rax), %rax
+	.loc 1 461 44 discriminator 2 view .LVU565
+	movl	8(%rax), %edx
+	.loc 1 461 25 discriminator 2 view .LVU566
+	movl	%edx, 4(%rbx)
+	.loc 1 462 13 is_stmt 1 discriminator 2 view .LVU567
+	.loc 1 462 42 is_stmt 0 discriminator 2 view .LVU568
+	movl	12(%rax), %edx
+	.loc 1 462 23 discriminator 2 view .LVU569
+	movl	%edx, 8(%rbx)
+	.loc 1 463 13 is_stmt 1 discriminator 2 view .LVU570
+	.loc 1 463 45 is_stmt 0 discriminator 2 view .LVU571
+	subq	(%rax), %rsi
+.LVL202:
+	.loc 1 463 13 discriminator 2 view .LVU572
+	movq	%r12, %rdi
+	call	pcm_render
+.LVL203:
+.LBE163:
+	.loc 1 458 53 is_stmt 1 discriminator 2 view .LVU573
+	.loc 1 458 30 discriminator 2 view .LVU574
+	.loc 1 458 36 is_stmt 0 discriminator 2 view .LVU575
+	movq	32(%rbx), %rdx
+	.loc 1 458 30 discriminator 2 view .LVU576
+	cmpq	%rdx, %r13
+	jnb	.L87
+.LVL204:
+.L94:
+.LBB164:
+	.loc 1 459 13 is_stmt 1 view .LVU577
+	.loc 1 459 37 is_stmt 0 view .LVU578
+	addq	$1, %r13
+.LVL205:
+	.loc 1 460 45 view .LVU579
+	movq	%rbp, %rsi
+	cmpq	%rdx, %r13
+	jnb	.L93
+.LVL206:
+	.loc 1 460 45 discriminator 1 view .LVU580
+	movq	%r13, %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movq	(%rax), %rsi
+.LVL207:
+	.loc 1 460 45 discriminator 1 view .LVU581
+	jmp	.L93
+.LVL208:
+.L135:
+	.loc 1 460 45 discriminator 1 view .LVU582
+.LBE164:
+.LBE185:
+.LBB186:
+.LBB168:
+.LBB167:
+	.loc 1 417 9 is_stmt 1 view .LVU583
+	.loc 1 418 9 view .LVU584
+	.loc 1 418 33 is_stmt 0 view .LVU585
+	leaq	40(%rsp), %rsi
+	movl	$10, %edx
+	movq	%rax, %rdi
+	call	strtoul@PLT
+.LVL209:
+	.loc 1 418 33 view .LVU586
+	movq	%rax, %r12
+.LVL210:
+	.loc 1 419 9 is_stmt 1 view .LVU587
+	.loc 1 419 29 is_stmt 0 view .LVU588
+	movq	40(%rsp), %rax
+.LVL211:
+	.loc 1 419 29 view .LVU589
+	cmpb	$0, (%rax)
+	jne	.L95
+	testq	%r12, %r12
+	je	.L95
+	.loc 1 420 13 is_stmt 1 view .LVU590
+	movl	$64, %eax
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+.LVL212:
+	.loc 1 420 13 is_stmt 0 view .LVU591
+	jmp	.L97
+.LVL213:
+.L136:
+	.loc 1 420 13 view .LVU592
+.LBE167:
+	.loc 1 427 9 is_stmt 1 view .LVU593
+	.loc 1 427 29 is_stmt 0 view .LVU594
+	leaq	624(%rsp), %rsi
+	movl	$128, %edi
+	call	__sched_cpucount@PLT
+.LVL214:
+	movl	%eax, %r12d
+.LVL215:
+	.loc 1 427 29 view .LVU595
+	jmp	.L98
+.LVL216:
+.L137:
+	.loc 1 427 29 view .LVU596
+.LBE168:
+.LBE186:
+	.loc 1 469 46 is_stmt 1 discriminator 1 view .LVU597
+	movq	32(%rbx), %rdx
+	movl	%r12d, %ecx
+	movq	%rbp, %rsi
+	leaq	.LC19(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL217:
+	jmp	.L100
+.LVL218:
+.L138:
+.LBB187:
+.LBB181:
+.LBB171:
+.LBB172:
+.LBB173:
+.LBB174:
+	.loc 1 353 5 view .LVU598
+	.loc 1 353 5 is_stmt 0 view .LVU599
+.LBE174:
+.LBE173:
+	.loc 1 399 5 is_stmt 1 view .LVU600
+	.loc 1 399 33 is_stmt 0 view .LVU601
+	movq	24(%rbx), %r8
+	.loc 1 399 43 view .LVU602
+	movq	%rsi, %rcx
+	salq	$4, %rcx
+	.loc 1 399 20 view .LVU603
+	movq	(%r8,%rcx), %rdx
+.LVL219:
+	.loc 1 400 5 is_stmt 1 view .LVU604
+	.loc 1 400 31 is_stmt 0 view .LVU605
+	addq	$1, %rsi
+.LVL220:
+	.loc 1 401 37 view .LVU606
+	cmpq	%r14, %rsi
+	jnb	.L105
+	movq	16(%r8,%rcx), %rcx
+.L106:
+.LVL221:
+	.loc 1 402 5 is_stmt 1 view .LVU607
+	.loc 1 402 38 is_stmt 0 view .LVU608
+	movq	%rdi, %rsi
+.LVL222:
+	.loc 1 402 38 view .LVU609
+	subq	%rdx, %rsi
+	.loc 1 402 58 view .LVU610
+	movq	%rcx, %r8
+	subq	%rdi, %r8
+	.loc 1 402 77 view .LVU611
+	cmpq	%rsi, %r8
+	cmovnb	%rdx, %rcx
+.LVL223:
+	.loc 1 403 5 is_stmt 1 view .LVU612
+	.loc 1 403 69 is_stmt 0 view .LVU613
+	movq	%rcx, %rsi
+	subq	%rdi, %rsi
+	movq	%rdi, %rdx
+.LVL224:
+	.loc 1 403 69 view .LVU614
+	subq	%rcx, %rdx
+	cmpq	%rcx, %rdi
+	cmovb	%rsi, %rdx
+.LVL225:
+	.loc 1 404 5 is_stmt 1 view .LVU615
+	.loc 1 404 42 is_stmt 0 view .LVU616
+	cmpq	%rdx, (%rsp)
+	cmovb	%rdi, %rcx
+.LVL226:
+	.loc 1 404 42 view .LVU617
+.LBE172:
+.LBE171:
+	.loc 1 481 9 is_stmt 1 view .LVU618
+	cmpq	%r10, %rcx
+	cmovb	%r10, %rcx
+.LVL227:
+	.loc 1 484 9 view .LVU619
+	.loc 1 484 22 is_stmt 0 view .LVU620
+	movq	%rbx, (%r9)
+	.loc 1 485 9 is_stmt 1 view .LVU621
+	.loc 1 485 23 is_stmt 0 view .LVU622
+	movq	8(%rsp), %rsi
+	movq	%rsi, 8(%r9)
+	.loc 1 486 9 is_stmt 1 view .LVU623
+	.loc 1 486 23 is_stmt 0 view .LVU624
+	movq	%r10, 16(%r9)
+	.loc 1 487 9 is_stmt 1 view .LVU625
+	.loc 1 487 22 is_stmt 0 view .LVU626
+	movq	%rcx, 24(%r9)
+	.loc 1 488 9 is_stmt 1 view .LVU627
+.LVL228:
+	.loc 1 488 9 is_stmt 0 view .LVU628
+.LBE181:
+	.loc 1 477 43 is_stmt 1 view .LVU629
+	.loc 1 477 32 view .LVU630
+	addq	%rax, %rdi
+	.loc 1 477 32 is_stmt 0 view .LVU631
+	addq	$32, %r9
+	.loc 1 477 43 view .LVU632
+	movl	%r11d, %edx
+.LVL229:
+	.loc 1 477 32 view .LVU633
+	movq	%rcx, %r10
+.LVL230:
+.L111:
+.LBB182:
+	.loc 1 478 9 is_stmt 1 view .LVU634
+	.loc 1 478 56 is_stmt 0 view .LVU635
+	leal	1(%rdx), %r11d
+.LVL231:
+	.loc 1 479 9 is_stmt 1 view .LVU636
+	.loc 1 480 22 is_stmt 0 view .LVU637
+	cmpl	%r12d, %r11d
+	je	.L101
+.LVL232:
+.LBB179:
+.LBI171:
+	.loc 1 395 10 is_stmt 1 view .LVU638
+.LBB178:
+	.loc 1 398 5 view .LVU639
+.LBB177:
+.LBI173:
+	.loc 1 341 8 view .LVU640
+.LBB176:
+	.loc 1 343 5 view .LVU641
+	.loc 1 344 5 view .LVU642
+	.loc 1 344 12 is_stmt 0 view .LVU643
+	movq	32(%rbx), %r14
+.LVL233:
+	.loc 1 345 5 is_stmt 1 view .LVU644
+	.loc 1 344 12 is_stmt 0 view .LVU645
+	movq	%r14, %r8
+	.loc 1 343 12 view .LVU646
+	movl	$0, %esi
+.LVL234:
+.L103:
+	.loc 1 345 22 is_stmt 1 view .LVU647
+	.loc 1 345 16 is_stmt 0 view .LVU648
+	movq	%r8, %rdx
+	subq	%rsi, %rdx
+	.loc 1 345 22 view .LVU649
+	cmpq	$1, %rdx
+	jbe	.L138
+.LBB175:
+	.loc 1 346 9 is_stmt 1 view .LVU650
+	.loc 1 346 43 is_stmt 0 view .LVU651
+	shrq	%rdx
+	.loc 1 346 22 view .LVU652
+	addq	%rsi, %rdx
+.LVL235:
+	.loc 1 347 9 is_stmt 1 view .LVU653
+	.loc 1 347 32 is_stmt 0 view .LVU654
+	movq	%rdx, %rcx
+	salq	$4, %rcx
+	addq	24(%rbx), %rcx
+	.loc 1 347 12 view .LVU655
+	cmpq	(%rcx), %rdi
+	.loc 1 346 22 view .LVU656
+	cmovb	%rdx, %r8
+.LVL236:
+	.loc 1 346 22 view .LVU657
+	cmovnb	%rdx, %rsi
+.LVL237:
+	.loc 1 346 22 view .LVU658
+	jmp	.L103
+.LVL238:
+.L105:
+	.loc 1 346 22 view .LVU659
+.LBE175:
+.LBE176:
+.LBE177:
+	.loc 1 401 37 view .LVU660
+	movq	48(%rbx), %rcx
+	jmp	.L106
+.LVL239:
+.L140:
+	.loc 1 401 37 view .LVU661
+.LBE178:
+.LBE179:
+.LBE182:
+.LBE187:
+.LBB188:
+	.loc 1 495 13 is_stmt 1 view .LVU662
+	movq	%r12, %rdi
+	call	pcm_run_job
+.LVL240:
+.L112:
+	.loc 1 492 43 discriminator 2 view .LVU663
+	.loc 1 492 32 discriminator 2 view .LVU664
+	addq	$1, %r13
+.LVL241:
+	.loc 1 492 32 is_stmt 0 discriminator 2 view .LVU665
+	cmpq	%r14, %r13
+	je	.L139
+.LVL242:
+.L113:
+	.loc 1 493 9 is_stmt 1 view .LVU666
+	.loc 1 493 71 is_stmt 0 view .LVU667
+	movq	%r13, %r12
+	salq	$5, %r12
+	addq	%r15, %r12
+	.loc 1 493 28 view .LVU668
+	leaq	112(%rsp,%r13,8), %rdi
+	movq	%r12, %rcx
+	leaq	pcm_run_job(%rip), %rdx
+	movl	$0, %esi
+	call	pthread_create@PLT
+.LVL243:
+	.loc 1 493 25 view .LVU669
+	testl	%eax, %eax
+	.loc 1 493 20 view .LVU670
+	sete	48(%rsp,%r13)
+	.loc 1 494 9 is_stmt 1 view .LVU671
+	.loc 1 494 12 is_stmt 0 view .LVU672
+	je	.L112
+	jmp	.L140
+.LVL244:
+.L139:
+	.loc 1 494 12 view .LVU673
+.LBE188:
+	.loc 1 498 5 is_stmt 1 view .LVU674
+	leaq	624(%rsp), %rdi
+	call	pcm_run_job
+.LVL245:
+	.loc 1 499 5 view .LVU675
+.LBB189:
+	.loc 1 499 10 view .LVU676
+	.loc 1 499 32 view .LVU677
+	.loc 1 499 32 is_stmt 0 view .LVU678
+.LBE189:
+	.loc 1 498 5 view .LVU679
+	movl	$1, %r12d
+.LBB190:
+	.loc 1 500 20 view .LVU680
+	leaq	48(%rsp), %r13
+	jmp	.L115
+.LVL246:
+.L141:
+	.loc 1 501 13 is_stmt 1 view .LVU681
+	movq	112(%rsp,%r12,8), %rdi
+	movl	$0, %esi
+	call	pthread_join@PLT
+.LVL247:
+.L114:
+	.loc 1 499 43 discriminator 2 view .LVU682
+	.loc 1 499 32 discriminator 2 view .LVU683
+	addq	$1, %r12
+.LVL248:
+	.loc 1 499 32 is_stmt 0 discriminator 2 view .LVU684
+	cmpq	%r14, %r12
+	je	.L117
+.LVL249:
+.L115:
+	.loc 1 500 9 is_stmt 1 view .LVU685
+	.loc 1 500 12 is_stmt 0 view .LVU686
+	cmpb	$0, (%r12,%r13)
+	je	.L114
+	jmp	.L141
+.LVL250:
+.L101:
+	.loc 1 500 12 view .LVU687
+.LBE190:
+.LBB191:
+.LBB183:
+	.loc 1 481 9 is_stmt 1 view .LVU688
+	.loc 1 484 9 view .LVU689
+	.loc 1 484 22 is_stmt 0 view .LVU690
+	movl	%edx, %edx
+	.loc 1 484 22 view .LVU691
+	salq	$5, %rdx
+.LVL251:
+	.loc 1 484 22 view .LVU692
+	movq	%rbx, 624(%rsp,%rdx)
+	.loc 1 485 9 is_stmt 1 view .LVU693
+	.loc 1 485 23 is_stmt 0 view .LVU694
+	movq	16(%rsp), %rax
+.LVL252:
+	.loc 1 485 23 view .LVU695
+	addq	%rax, %r13
+.LVL253:
+	.loc 1 485 23 view .LVU696
+	movq	%r13, 632(%rsp,%rdx)
+	.loc 1 486 9 is_stmt 1 view .LVU697
+	.loc 1 486 23 is_stmt 0 view .LVU698
+	movq	%r10, 640(%rsp,%rdx)
+	.loc 1 487 9 is_stmt 1 view .LVU699
+	.loc 1 487 22 is_stmt 0 view .LVU700
+	cmpq	%r10, %rbp
+	cmovnb	%rbp, %r10
+.LVL254:
+	.loc 1 487 22 view .LVU701
+	movq	%r10, 648(%rsp,%rdx)
+	.loc 1 488 9 is_stmt 1 view .LVU702
+.LVL255:
+	.loc 1 488 9 is_stmt 0 view .LVU703
+.LBE183:
+	.loc 1 477 43 is_stmt 1 view .LVU704
+	.loc 1 477 32 view .LVU705
+	.loc 1 477 32 is_stmt 0 view .LVU706
+.LBE191:
+.LBB192:
+	.loc 1 492 32 is_stmt 1 view .LVU707
+	movl	%r12d, %r14d
+	movl	$1, %r13d
+	cmpl	$1, %r12d
+	ja	.L113
+	.loc 1 492 32 is_stmt 0 view .LVU708
+.LBE192:
+	.loc 1 498 5 is_stmt 1 view .LVU709
+	leaq	624(%rsp), %rdi
+	call	pcm_run_job
+.LVL256:
+	.loc 1 499 5 view .LVU710
+.LBB193:
+	.loc 1 499 10 view .LVU711
+	.loc 1 499 32 view .LVU712
+.L117:
+	.loc 1 499 32 is_stmt 0 view .LVU713
+.LBE193:
+	.loc 1 505 5 is_stmt 1 view .LVU714
+	movq	24(%rsp), %rsi
+	movq	16(%rsp), %rdi
+	call	munmap@PLT
+.LVL257:
+	.loc 1 506 5 view .LVU715
+	.loc 1 506 26 is_stmt 0 view .LVU716
+	movq	%rbp, 16(%rbx)
+.LVL258:
+.L87:
+	.loc 1 507 1 view .LVU717
+	movq	2680(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L142
+	addq	$2696, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL259:
+	.loc 1 507 1 view .LVU718
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL260:
+	.loc 1 507 1 view .LVU719
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL261:
+.L142:
+	.cfi_restore_state
+	.loc 1 507 1 view .LVU720
+	call	__stack_chk_fail@PLT
+.LVL262:
+	.cfi_endproc
+.LFE63:
+	.size	pcm_render_offline, .-pcm_render_offline
+	.type	put_le32, @function
+put_le32:
+.LVL263:
+.LFB53:
+	.loc 1 224 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 224 1 is_stmt 0 view .LVU722
+	movl	%esi, %eax
+	.loc 1 225 5 is_stmt 1 view .LVU723
+.LVL264:
+.LBB198:
+.LBI198:
+	.loc 1 215 6 view .LVU724
+.LBB199:
+	.loc 1 217 5 view .LVU725
+	.loc 1 217 14 is_stmt 0 view .LVU726
+	movb	%sil, (%rdi)
+	.loc 1 218 5 is_stmt 1 view .LVU727
+	.loc 1 218 14 is_stmt 0 view .LVU728
+	movzbl	%ah, %edx
+	movb	%dl, 1(%rdi)
+.LVL265:
+	.loc 1 218 14 view .LVU729
+.LBE199:
+.LBE198:
+	.loc 1 226 5 is_stmt 1 view .LVU730
+	.loc 1 226 41 is_stmt 0 view .LVU731
+	shrl	$16, %eax
+.LVL266:
+.LBB200:
+.LBI200:
+	.loc 1 215 6 is_stmt 1 view .LVU732
+.LBB201:
+	.loc 1 217 5 view .LVU733
+	.loc 1 217 14 is_stmt 0 view .LVU734
+	movb	%al, 2(%rdi)
+	.loc 1 218 5 is_stmt 1 view .LVU735
+	.loc 1 218 14 is_stmt 0 view .LVU736
+	movzbl	%ah, %eax
+.LVL267:
+	.loc 1 218 14 view .LVU737
+	movb	%al, 3(%rdi)
+.LVL268:
+	.loc 1 218 14 view .LVU738
+.LBE201:
+.LBE200:
+	.loc 1 227 1 view .LVU739
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	put_le32, .-put_le32
+	.type	wav_header, @function
+wav_header:
+.LVL269:
+.LFB54:
+	.loc 1 236 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 236 1 is_stmt 0 view .LVU741
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movl	%esi, %ebp
+	.loc 1 237 5 is_stmt 1 view .LVU742
+.LVL270:
+	.loc 1 239 5 view .LVU743
+.LBB216:
+.LBI216:
+	.loc 2 26 42 view .LVU744
+.LBB217:
+	.loc 2 29 3 view .LVU745
+	.loc 2 29 10 is_stmt 0 view .LVU746
+	movl	$1179011410, (%rdi)
+.LVL271:
+	.loc 2 29 10 view .LVU747
+.LBE217:
+.LBE216:
+	.loc 1 240 5 is_stmt 1 view .LVU748
+	.loc 1 238 57 is_stmt 0 view .LVU749
+	movl	$-37, %esi
+.LVL272:
+	.loc 1 238 57 view .LVU750
+	cmpl	%esi, %ebp
+	cmovbe	%ebp, %esi
+	.loc 1 237 20 view .LVU751
+	addl	$36, %esi
+	.loc 1 240 14 view .LVU752
+	leaq	4(%rdi), %rdi
+.LVL273:
+	.loc 1 240 5 view .LVU753
+	call	put_le32
+.LVL274:
+	.loc 1 241 5 is_stmt 1 view .LVU754
+.LBB218:
+.LBI218:
+	.loc 2 26 42 view .LVU755
+.LBB219:
+	.loc 2 29 3 view .LVU756
+	.loc 2 29 10 is_stmt 0 view .LVU757
+	movabsq	$2338614392529502551, %rax
+	movq	%rax, 8(%rbx)
+.LVL275:
+	.loc 2 29 10 view .LVU758
+.LBE219:
+.LBE218:
+	.loc 1 242 5 is_stmt 1 view .LVU759
+	.loc 1 242 14 is_stmt 0 view .LVU760
+	leaq	16(%rbx), %rdi
+	.loc 1 242 5 view .LVU761
+	movl	$16, %esi
+	call	put_le32
+.LVL276:
+	.loc 1 243 5 is_stmt 1 view .LVU762
+.LBB220:
+.LBI220:
+	.loc 1 215 6 view .LVU763
+.LBB221:
+	.loc 1 217 5 view .LVU764
+	.loc 1 217 12 is_stmt 0 view .LVU765
+	movb	$1, 20(%rbx)
+	.loc 1 218 5 is_stmt 1 view .LVU766
+	.loc 1 218 12 is_stmt 0 view .LVU767
+	movb	$0, 21(%rbx)
+.LVL277:
+	.loc 1 218 12 view .LVU768
+.LBE221:
+.LBE220:
+	.loc 1 244 5 is_stmt 1 view .LVU769
+.LBB222:
+.LBI222:
+	.loc 1 215 6 view .LVU770
+.LBB223:
+	.loc 1 217 5 view .LVU771
+	.loc 1 217 12 is_stmt 0 view .LVU772
+	movb	$1, 22(%rbx)
+	.loc 1 218 5 is_stmt 1 view .LVU773
+	.loc 1 218 12 is_stmt 0 view .LVU774
+	movb	$0, 23(%rbx)
+.LVL278:
+	.loc 1 218 12 view .LVU775
+.LBE223:
+.LBE222:
+	.loc 1 245 5 is_stmt 1 view .LVU776
+	.loc 1 245 14 is_stmt 0 view .LVU777
+	leaq	24(%rbx), %rdi
+	.loc 1 245 5 view .LVU778
+	movl	$48000, %esi
+	call	put_le32
+.LVL279:
+	.loc 1 246 5 is_stmt 1 view .LVU779
+	.loc 1 246 14 is_stmt 0 view .LVU780
+	leaq	28(%rbx), %rdi
+	.loc 1 246 5 view .LVU781
+	movl	$96000, %esi
+	call	put_le32
+.LVL280:
+	.loc 1 247 5 is_stmt 1 view .LVU782
+.LBB224:
+.LBI224:
+	.loc 1 215 6 view .LVU783
+.LBB225:
+	.loc 1 217 5 view .LVU784
+	.loc 1 217 12 is_stmt 0 view .LVU785
+	movb	$2, 32(%rbx)
+	.loc 1 218 5 is_stmt 1 view .LVU786
+	.loc 1 218 12 is_stmt 0 view .LVU787
+	movb	$0, 33(%rbx)
+.LVL281:
+	.loc 1 218 12 view .LVU788
+.LBE225:
+.LBE224:
+	.loc 1 248 5 is_stmt 1 view .LVU789
+.LBB226:
+.LBI226:
+	.loc 1 215 6 view .LVU790
+.LBB227:
+	.loc 1 217 5 view .LVU791
+	.loc 1 217 12 is_stmt 0 view .LVU792
+	movb	$16, 34(%rbx)
+	.loc 1 218 5 is_stmt 1 view .LVU793
+	.loc 1 218 12 is_stmt 0 view .LVU794
+	movb	$0, 35(%rbx)
+.LVL282:
+	.loc 1 218 12 view .LVU795
+.LBE227:
+.LBE226:
+	.loc 1 249 5 is_stmt 1 view .LVU796
+.LBB228:
+.LBI228:
+	.loc 2 26 42 view .LVU797
+.LBB229:
+	.loc 2 29 3 view .LVU798
+	.loc 2 29 10 is_stmt 0 view .LVU799
+	movl	$1635017060, 36(%rbx)
+.LVL283:
+	.loc 2 29 10 view .LVU800
+.LBE229:
+.LBE228:
+	.loc 1 250 5 is_stmt 1 view .LVU801
+	.loc 1 250 14 is_stmt 0 view .LVU802
+	leaq	40(%rbx), %rdi
+	.loc 1 250 5 view .LVU803
+	movl	%ebp, %esi
+	call	put_le32
+.LVL284:
+	.loc 1 251 1 view .LVU804
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL285:
+	.loc 1 251 1 view .LVU805
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL286:
+	.loc 1 251 1 view .LVU806
+	ret
+	.cfi_endproc
+.LFE54:
+	.size	wav_header, .-wav_header
+	.section	.rodata.str1.1
+.LC20:
+	.string	"pcm driver_fini %p"
+	.section	.rodata.str1.8
+	.align 8
+.LC21:
+	.string	"pcm: could not update WAV header: %s"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL287:
+.LFB66:
+	.loc 1 599 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 599 1 is_stmt 0 view .LVU808
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$64, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%rdi, %rbx
+	.loc 1 599 1 view .LVU809
+	movq	%fs:40, %rax
+	movq	%rax, 56(%rsp)
+	xorl	%eax, %eax
+	.loc 1 600 5 is_stmt 1 view .LVU810
+	.loc 1 600 10 view .LVU811
+	.loc 1 600 13 is_stmt 0 view .LVU812
+	cmpl	$0, log_level(%rip)
+	jg	.L154
+.LVL288:
+.L147:
+	.loc 1 600 8 is_stmt 1 discriminator 3 view .LVU813
+	.loc 1 601 5 discriminator 3 view .LVU814
+	.loc 1 601 21 is_stmt 0 discriminator 3 view .LVU815
+	movq	104(%rbx), %rbp
+.LVL289:
+	.loc 1 603 5 is_stmt 1 discriminator 3 view .LVU816
+	.loc 1 603 8 is_stmt 0 discriminator 3 view .LVU817
+	cmpb	$0, 2(%rbp)
+	jne	.L155
+.L148:
+	.loc 1 606 5 is_stmt 1 view .LVU818
+	movq	%rbx, %rdi
+	call	pcm_flush
+.LVL290:
+	.loc 1 608 5 view .LVU819
+	.loc 1 608 8 is_stmt 0 view .LVU820
+	cmpb	$0, 0(%rbp)
+	jne	.L156
+.L149:
+	.loc 1 619 5 is_stmt 1 view .LVU821
+	.loc 1 619 8 is_stmt 0 view .LVU822
+	cmpb	$0, 1(%rbp)
+	jne	.L157
+.L151:
+	.loc 1 622 5 is_stmt 1 view .LVU823
+	.loc 1 622 23 is_stmt 0 view .LVU824
+	movl	$-1, 88(%rbx)
+	.loc 1 623 5 is_stmt 1 view .LVU825
+	movq	24(%rbp), %rdi
+	call	free@PLT
+.LVL291:
+	.loc 1 624 5 view .LVU826
+	movq	104(%rbx), %rdi
+	call	free@PLT
+.LVL292:
+	.loc 1 625 5 view .LVU827
+	.loc 1 625 25 is_stmt 0 view .LVU828
+	movq	$0, 104(%rbx)
+	.loc 1 626 1 view .LVU829
+	movq	56(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L158
+	addq	$64, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL293:
+	.loc 1 626 1 view .LVU830
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL294:
+	.loc 1 626 1 view .LVU831
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL295:
+.L154:
+	.cfi_restore_state
+	.loc 1 600 46 is_stmt 1 discriminator 1 view .LVU832
+	movq	%rdi, %rsi
+	leaq	.LC20(%rip), %rdi
+	call	log_verbose@PLT
+.LVL296:
+	jmp	.L147
+.LVL297:
+.L155:
+	.loc 1 604 9 view .LVU833
+	movq	%rbx, %rdi
+	call	pcm_render_offline
+.LVL298:
+	jmp	.L148
+.L156:
+.LBB230:
+	.loc 1 609 9 view .LVU834
+.LVL299:
+	.loc 1 610 9 view .LVU835
+	.loc 1 611 9 view .LVU836
+	.loc 1 609 24 is_stmt 0 view .LVU837
+	movq	16(%rbp), %rax
+	leaq	(%rax,%rax), %rsi
+	.loc 1 611 9 view .LVU838
+	movq	%rsp, %r12
+	movl	$4294967295, %eax
+	cmpq	%rax, %rsi
+	cmova	%rax, %rsi
+	movq	%r12, %rdi
+	call	wav_header
+.LVL300:
+	.loc 1 613 9 is_stmt 1 view .LVU839
+	.loc 1 613 28 is_stmt 0 view .LVU840
+	movl	88(%rbx), %edi
+	movl	$0, %ecx
+	movl	$44, %edx
+	movq	%r12, %rsi
+	call	pwrite@PLT
+.LVL301:
+	.loc 1 613 12 view .LVU841
+	cmpq	$44, %rax
+	je	.L149
+	.loc 1 614 13 is_stmt 1 view .LVU842
+	.loc 1 614 18 view .LVU843
+	.loc 1 614 21 is_stmt 0 view .LVU844
+	cmpl	$0, log_level(%rip)
+	jle	.L149
+	.loc 1 614 54 is_stmt 1 discriminator 1 view .LVU845
+	.loc 1 614 14 is_stmt 0 discriminator 1 view .LVU846
+	call	__errno_location@PLT
+.LVL302:
+	.loc 1 614 54 discriminator 1 view .LVU847
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL303:
+	movq	%rax, %rsi
+	leaq	.LC21(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL304:
+	.loc 1 614 16 is_stmt 1 discriminator 1 view .LVU848
+	jmp	.L149
+.LVL305:
+.L157:
+	.loc 1 614 16 is_stmt 0 discriminator 1 view .LVU849
+.LBE230:
+	.loc 1 620 9 is_stmt 1 view .LVU850
+	movl	88(%rbx), %edi
+	call	close@PLT
+.LVL306:
+	jmp	.L151
+.L158:
+	.loc 1 626 1 is_stmt 0 view .LVU851
+	call	__stack_chk_fail@PLT
+.LVL307:
+	.cfi_endproc
+.LFE66:
+	.size	driver_fini, .-driver_fini
+	.section	.rodata.str1.1
+.LC22:
+	.string	"pcm driver_detect %p %s"
+.LC23:
+	.string	"pcm driver_detect %p %p"
+.LC24:
+	.string	"wav:"
+.LC25:
+	.string	"-"
+.LC26:
+	.string	"pcm: could not open(2) %s: %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC27:
+	.string	"pcm: could not write WAV header: %s"
+	.section	.rodata.str1.1
+.LC28:
+	.string	"pcm:"
+	.text
+	.type	driver_detect, @function
+driver_detect:
+.LVL308:
+.LFB64:
+	.loc 1 512 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 512 1 is_stmt 0 view .LVU853
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 272
+	movq	%rdi, %r12
+	.loc 1 512 1 view .LVU854
+	movq	%fs:40, %rax
+	movq	%rax, 200(%rsp)
+	xorl	%eax, %eax
+	.loc 1 513 5 is_stmt 1 view .LVU855
+	.loc 1 513 8 is_stmt 0 view .LVU856
+	testq	%rsi, %rsi
+	je	.L160
+	movq	%rsi, %rbp
+	.loc 1 514 9 is_stmt 1 view .LVU857
+	.loc 1 514 14 view .LVU858
+	.loc 1 514 17 is_stmt 0 view .LVU859
+	cmpl	$0, log_level(%rip)
+	jg	.L186
+.LVL309:
+.L161:
+	.loc 1 517 12 is_stmt 1 view .LVU860
+	.loc 1 520 5 view .LVU861
+	.loc 1 525 4 view .LVU862
+	.loc 1 526 5 view .LVU863
+	.loc 1 527 5 view .LVU864
+	.loc 1 527 14 is_stmt 0 view .LVU865
+	movl	$4, %edx
+	leaq	.LC28(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strncmp@PLT
+.LVL310:
+	.loc 1 527 8 view .LVU866
+	testl	%eax, %eax
+	je	.L175
+	.loc 1 530 12 is_stmt 1 view .LVU867
+	.loc 1 530 21 is_stmt 0 view .LVU868
+	movl	$4, %edx
+	leaq	.LC24(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strncmp@PLT
+.LVL311:
+	movl	%eax, %edx
+	.loc 1 534 15 view .LVU869
+	movl	$0, %eax
+	.loc 1 530 15 view .LVU870
+	testl	%edx, %edx
+	jne	.L159
+	.loc 1 531 9 is_stmt 1 view .LVU871
+.LVL312:
+	.loc 1 532 9 view .LVU872
+	.loc 1 532 19 is_stmt 0 view .LVU873
+	leaq	4(%rbp), %rbx
+.LVL313:
+	.loc 1 531 16 view .LVU874
+	movl	$1, %r15d
+	jmp	.L163
+.LVL314:
+.L186:
+	.loc 1 514 50 is_stmt 1 discriminator 1 view .LVU875
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+.LVL315:
+	.loc 1 514 50 is_stmt 0 discriminator 1 view .LVU876
+	leaq	.LC22(%rip), %rdi
+.LVL316:
+	.loc 1 514 50 discriminator 1 view .LVU877
+	call	log_verbose@PLT
+.LVL317:
+	jmp	.L161
+.LVL318:
+.L160:
+	.loc 1 517 9 is_stmt 1 view .LVU878
+	.loc 1 517 14 view .LVU879
+	.loc 1 517 17 is_stmt 0 view .LVU880
+	cmpl	$0, log_level(%rip)
+	jg	.L187
+.LVL319:
+.L162:
+	.loc 1 517 12 is_stmt 1 view .LVU881
+	.loc 1 520 5 view .LVU882
+	.loc 1 522 15 is_stmt 0 view .LVU883
+	movl	$0, %eax
+	jmp	.L159
+.LVL320:
+.L187:
+	.loc 1 517 50 is_stmt 1 discriminator 1 view .LVU884
+	movl	$0, %edx
+	movq	%rdi, %rsi
+.LVL321:
+	.loc 1 517 50 is_stmt 0 discriminator 1 view .LVU885
+	leaq	.LC23(%rip), %rdi
+.LVL322:
+	.loc 1 517 50 discriminator 1 view .LVU886
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL323:
+	jmp	.L162
+.LVL324:
+.L175:
+	.loc 1 528 9 is_stmt 1 view .LVU887
+	.loc 1 529 9 view .LVU888
+	.loc 1 529 19 is_stmt 0 view .LVU889
+	leaq	4(%rbp), %rbx
+.LVL325:
+	.loc 1 528 16 view .LVU890
+	movl	$0, %r15d
+.LVL326:
+.L163:
+	.loc 1 537 5 is_stmt 1 view .LVU891
+	.loc 1 538 5 view .LVU892
+	.loc 1 538 32 is_stmt 0 view .LVU893
+	leaq	.LC25(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL327:
+	movl	%eax, %r13d
+.LVL328:
+	.loc 1 539 5 is_stmt 1 view .LVU894
+	.loc 1 539 8 is_stmt 0 view .LVU895
+	testl	%eax, %eax
+	je	.L165
+	.loc 1 541 9 is_stmt 1 view .LVU896
+.LVL329:
+.LBB231:
+.LBI231:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 3 41 1 view .LVU897
+.LBB232:
+	.loc 3 43 3 view .LVU898
+	.loc 3 46 3 view .LVU899
+	.loc 3 48 7 view .LVU900
+	.loc 3 53 7 view .LVU901
+	.loc 3 53 14 is_stmt 0 view .LVU902
+	movl	$438, %edx
+	movl	$524866, %esi
+	movq	%rbx, %rdi
+	movl	$0, %eax
+.LVL330:
+	.loc 3 53 14 view .LVU903
+	call	open@PLT
+.LVL331:
+	movl	%eax, %r14d
+.LVL332:
+	.loc 3 53 14 view .LVU904
+.LBE232:
+.LBE231:
+	.loc 1 542 9 is_stmt 1 view .LVU905
+	.loc 1 542 12 is_stmt 0 view .LVU906
+	cmpl	$-1, %eax
+	je	.L188
+	.loc 1 549 5 is_stmt 1 view .LVU907
+	.loc 1 549 28 is_stmt 0 view .LVU908
+	movl	$131136, %edi
+	call	malloc@PLT
+.LVL333:
+	.loc 1 549 28 view .LVU909
+	movq	%rax, %rbx
+.LVL334:
+	.loc 1 550 5 is_stmt 1 view .LVU910
+	.loc 1 550 8 is_stmt 0 view .LVU911
+	testq	%rax, %rax
+	je	.L189
+	.loc 1 556 5 is_stmt 1 view .LVU912
+	.loc 1 557 5 view .LVU913
+	.loc 1 557 18 is_stmt 0 view .LVU914
+	movb	%r15b, (%rbx)
+	.loc 1 558 5 is_stmt 1 view .LVU915
+	.loc 1 558 20 is_stmt 0 view .LVU916
+	movb	$1, 1(%rbx)
+	.loc 1 559 5 is_stmt 1 view .LVU917
+	.loc 1 559 39 is_stmt 0 view .LVU918
+	movq	%rsp, %rsi
+	movl	%r14d, %edi
+	call	fstat@PLT
+.LVL335:
+	.loc 1 559 39 view .LVU919
+	movl	%eax, %edx
+	.loc 1 559 55 view .LVU920
+	movl	$0, %eax
+	.loc 1 559 30 view .LVU921
+	testl	%edx, %edx
+	jne	.L167
+	.loc 1 559 60 discriminator 3 view .LVU922
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 559 55 discriminator 3 view .LVU923
+	cmpl	$32768, %eax
+	sete	%al
+	movzbl	%al, %eax
+	jmp	.L167
+.LVL336:
+.L188:
+	.loc 1 543 13 is_stmt 1 view .LVU924
+	.loc 1 543 18 view .LVU925
+	.loc 1 545 19 is_stmt 0 view .LVU926
+	movl	$0, %eax
+.LVL337:
+	.loc 1 543 21 view .LVU927
+	cmpl	$0, log_level(%rip)
+	jle	.L159
+	.loc 1 543 54 is_stmt 1 discriminator 1 view .LVU928
+	.loc 1 543 14 is_stmt 0 discriminator 1 view .LVU929
+	call	__errno_location@PLT
+.LVL338:
+	.loc 1 543 54 discriminator 1 view .LVU930
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL339:
+	movq	%rax, %rdx
+	movq	%rbx, %rsi
+	leaq	.LC26(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL340:
+	.loc 1 545 19 discriminator 1 view .LVU931
+	movl	$0, %eax
+	jmp	.L159
+.LVL341:
+.L189:
+	.loc 1 552 13 is_stmt 1 view .LVU932
+	movl	%r14d, %edi
+	call	close@PLT
+.LVL342:
+	.loc 1 554 15 is_stmt 0 view .LVU933
+	movl	$0, %eax
+	jmp	.L159
+.LVL343:
+.L193:
+.LBB233:
+	.loc 1 570 9 is_stmt 1 view .LVU934
+	.loc 1 571 9 view .LVU935
+	leaq	144(%rsp), %r15
+.LVL344:
+	.loc 1 571 9 is_stmt 0 view .LVU936
+	movl	$-1, %esi
+	movq	%r15, %rdi
+	call	wav_header
+.LVL345:
+	.loc 1 572 9 is_stmt 1 view .LVU937
+	.loc 1 572 19 is_stmt 0 view .LVU938
+	movl	$44, %edx
+	movq	%r15, %rsi
+	movl	%r14d, %edi
+	call	write_all@PLT
+.LVL346:
+	.loc 1 572 12 view .LVU939
+	cmpl	$-1, %eax
+	jne	.L168
+	.loc 1 573 13 is_stmt 1 view .LVU940
+	.loc 1 573 18 view .LVU941
+	.loc 1 573 21 is_stmt 0 view .LVU942
+	cmpl	$0, log_level(%rip)
+	jg	.L190
+.L170:
+	.loc 1 573 16 is_stmt 1 discriminator 3 view .LVU943
+	.loc 1 575 13 discriminator 3 view .LVU944
+	.loc 1 575 16 is_stmt 0 discriminator 3 view .LVU945
+	testl	%r13d, %r13d
+	jne	.L191
+.L171:
+	.loc 1 578 13 is_stmt 1 view .LVU946
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL347:
+	.loc 1 579 13 view .LVU947
+	.loc 1 579 19 is_stmt 0 view .LVU948
+	movl	$0, %eax
+	jmp	.L159
+.L190:
+	.loc 1 573 54 is_stmt 1 discriminator 1 view .LVU949
+	.loc 1 573 14 is_stmt 0 discriminator 1 view .LVU950
+	call	__errno_location@PLT
+.LVL348:
+	.loc 1 573 54 discriminator 1 view .LVU951
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL349:
+	movq	%rax, %rsi
+	leaq	.LC27(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL350:
+	jmp	.L170
+.L191:
+	.loc 1 576 17 is_stmt 1 view .LVU952
+	movl	%r14d, %edi
+	call	close@PLT
+.LVL351:
+	jmp	.L171
+.LVL352:
+.L192:
+	.loc 1 576 17 is_stmt 0 view .LVU953
+.LBE233:
+	.loc 1 554 15 view .LVU954
+	movl	$0, %eax
+.LVL353:
+	.loc 1 554 15 view .LVU955
+	jmp	.L159
+.LVL354:
+.L165:
+	.loc 1 549 5 is_stmt 1 view .LVU956
+	.loc 1 549 28 is_stmt 0 view .LVU957
+	movl	$131136, %edi
+	call	malloc@PLT
+.LVL355:
+	.loc 1 549 28 view .LVU958
+	movq	%rax, %rbx
+.LVL356:
+	.loc 1 550 5 is_stmt 1 view .LVU959
+	.loc 1 550 8 is_stmt 0 view .LVU960
+	testq	%rax, %rax
+	je	.L192
+	.loc 1 556 5 is_stmt 1 view .LVU961
+	.loc 1 557 5 view .LVU962
+	.loc 1 557 18 is_stmt 0 view .LVU963
+	movb	%r15b, (%rbx)
+	.loc 1 558 5 is_stmt 1 view .LVU964
+	.loc 1 558 20 is_stmt 0 view .LVU965
+	movb	$0, 1(%rbx)
+	.loc 1 559 5 is_stmt 1 view .LVU966
+	.loc 1 559 55 is_stmt 0 view .LVU967
+	movl	%r13d, %eax
+.LVL357:
+	.loc 1 537 9 view .LVU968
+	movl	$1, %r14d
+.LVL358:
+.L167:
+	.loc 1 559 55 discriminator 8 view .LVU969
+	movb	%al, 2(%rbx)
+	andb	$1, 2(%rbx)
+	.loc 1 560 5 is_stmt 1 discriminator 8 view .LVU970
+	.loc 1 560 20 is_stmt 0 discriminator 8 view .LVU971
+	movq	$0, 24(%rbx)
+	.loc 1 561 5 is_stmt 1 discriminator 8 view .LVU972
+	.loc 1 561 25 is_stmt 0 discriminator 8 view .LVU973
+	movq	$0, 32(%rbx)
+	.loc 1 562 5 is_stmt 1 discriminator 8 view .LVU974
+	.loc 1 562 25 is_stmt 0 discriminator 8 view .LVU975
+	movq	$0, 40(%rbx)
+	.loc 1 563 5 is_stmt 1 discriminator 8 view .LVU976
+	.loc 1 563 24 is_stmt 0 discriminator 8 view .LVU977
+	movq	$0, 48(%rbx)
+	.loc 1 564 5 is_stmt 1 discriminator 8 view .LVU978
+	.loc 1 564 17 is_stmt 0 discriminator 8 view .LVU979
+	movl	$0, 4(%rbx)
+	.loc 1 565 5 is_stmt 1 discriminator 8 view .LVU980
+	.loc 1 565 15 is_stmt 0 discriminator 8 view .LVU981
+	movl	$0, 8(%rbx)
+	.loc 1 566 5 is_stmt 1 discriminator 8 view .LVU982
+	.loc 1 566 26 is_stmt 0 discriminator 8 view .LVU983
+	movq	$0, 16(%rbx)
+	.loc 1 567 5 is_stmt 1 discriminator 8 view .LVU984
+	.loc 1 567 16 is_stmt 0 discriminator 8 view .LVU985
+	movq	$0, 56(%rbx)
+	.loc 1 569 5 is_stmt 1 discriminator 8 view .LVU986
+	.loc 1 569 8 is_stmt 0 discriminator 8 view .LVU987
+	testb	%r15b, %r15b
+	jne	.L193
+.LVL359:
+.L168:
+	.loc 1 583 5 is_stmt 1 view .LVU988
+	.loc 1 583 23 is_stmt 0 view .LVU989
+	movl	%r14d, 88(%r12)
+	.loc 1 584 5 is_stmt 1 view .LVU990
+	.loc 1 584 25 is_stmt 0 view .LVU991
+	movq	%rbp, 96(%r12)
+	.loc 1 585 5 is_stmt 1 view .LVU992
+	.loc 1 585 25 is_stmt 0 view .LVU993
+	movq	%rbx, 104(%r12)
+	.loc 1 586 5 is_stmt 1 view .LVU994
+	.loc 1 586 11 is_stmt 0 view .LVU995
+	movl	$1, %eax
+.LVL360:
+.L159:
+	.loc 1 587 1 view .LVU996
+	movq	200(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L194
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL361:
+	.loc 1 587 1 view .LVU997
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL362:
+.L194:
+	.cfi_restore_state
+	.loc 1 587 1 view .LVU998
+	call	__stack_chk_fail@PLT
+.LVL363:
+	.cfi_endproc
+.LFE64:
+	.size	driver_detect, .-driver_detect
+	.globl	pcm_driver
+	.section	.rodata.str1.1
+.LC29:
+	.string	"pcm"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	pcm_driver, @object
+	.size	pcm_driver, 112
+pcm_driver:
+	.quad	.LC29
+	.quad	0
+	.quad	driver_detect
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	driver_wait
+	.quad	driver_play_sequence
+	.quad	0
+	.quad	0
+	.long	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC3:
+	.long	796917760
+	.set	.LC4,.LC6
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC5:
+	.long	-2147483648
+	.long	-2147483648
+	.long	-2147483648
+	.long	-2147483648
+	.align 16
+.LC6:
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.section	.rodata.cst4
+	.align 4
+.LC8:
+	.long	864026624
+	.align 4
+.LC10:
+	.long	-1082130432
+	.section	.rodata.cst16
+	.align 16
+.LC12:
+	.long	1182792704
+	.long	1182792704
+	.long	1182792704
+	.long	1182792704
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 14 "beep-driver.h"
+	.file 15 "beep-driver-pcm.h"
+	.file 16 "beep-log.h"
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 18 "/usr/include/stdlib.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/usr/include/sched.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 22 "/usr/include/pthread.h"
+	.file 23 "/usr/include/unistd.h"
+	.file 24 "beep-library.h"
+	.file 25 "/usr/include/errno.h"
+	.file 26 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2a04
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x43
+	.long	.LASF235
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x8
+	.long	0x43
+	.uleb128 0x8
+	.long	0x35
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x59
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.long	0x89
+	.uleb128 0x8
+	.long	0x73
+	.uleb128 0x1f
+	.long	0x73
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x8
+	.long	0x82
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF8
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x8
+	.long	0x95
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x27
+	.byte	0x1a
+	.long	0xb4
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x6c
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x95
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x91
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x92
+	.byte	0x16
+	.long	0x95
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x93
+	.byte	0x16
+	.long	0x95
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x94
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x96
+	.byte	0x16
+	.long	0x95
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x97
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x98
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x9a
+	.byte	0xd
+	.long	0x59
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x5
+	.byte	0xa0
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x45
+	.byte	0x8
+	.uleb128 0x1f
+	.long	0x14b
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x5
+	.byte	0xaf
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x5
+	.byte	0xb4
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x5
+	.byte	0xc2
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x5
+	.byte	0xc5
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x9
+	.long	0x82
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x5
+	.byte	0xd7
+	.byte	0xd
+	.long	0x59
+	.uleb128 0x5
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x55
+	.byte	0x11
+	.long	0x127
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x6c
+	.byte	0x13
+	.long	0x16a
+	.uleb128 0x5
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x19
+	.byte	0x13
+	.long	0xa8
+	.uleb128 0x2c
+	.long	.LASF41
+	.byte	0x10
+	.byte	0x8
+	.byte	0xb
+	.long	0x1de
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x10
+	.byte	0xc
+	.long	0x13f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x15
+	.byte	0x15
+	.long	0x176
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF36
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x46
+	.long	.LASF40
+	.byte	0x38
+	.byte	0x9
+	.byte	0x38
+	.byte	0x7
+	.long	0x215
+	.uleb128 0x3b
+	.long	.LASF38
+	.byte	0x3a
+	.byte	0x8
+	.long	0x215
+	.uleb128 0x3b
+	.long	.LASF39
+	.byte	0x3b
+	.byte	0xc
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1a
+	.long	0x82
+	.long	0x225
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x1f1
+	.uleb128 0x8
+	.long	0x225
+	.uleb128 0x9
+	.long	0x245
+	.uleb128 0x8
+	.long	0x236
+	.uleb128 0x1f
+	.long	0x236
+	.uleb128 0x47
+	.uleb128 0x2c
+	.long	.LASF42
+	.byte	0x90
+	.byte	0xa
+	.byte	0x1a
+	.long	0x316
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0xa
+	.byte	0x1f
+	.byte	0xd
+	.long	0xdf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0xa
+	.byte	0x24
+	.byte	0xd
+	.long	0x103
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0xa
+	.byte	0x2c
+	.byte	0xf
+	.long	0x11b
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0x10f
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xd
+	.long	0xeb
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0xa
+	.byte	0x30
+	.byte	0xd
+	.long	0xf7
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x32
+	.byte	0x9
+	.long	0x59
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0xa
+	.byte	0x34
+	.byte	0xd
+	.long	0xdf
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0xa
+	.byte	0x39
+	.byte	0xd
+	.long	0x127
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x11
+	.long	0x152
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x10
+	.long	0x15e
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x15
+	.long	0x1b7
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0xa
+	.byte	0x4b
+	.byte	0x15
+	.long	0x1b7
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x4c
+	.byte	0x15
+	.long	0x1b7
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x59
+	.byte	0x17
+	.long	0x316
+	.byte	0x78
+	.byte	0
+	.uleb128 0x1a
+	.long	0x176
+	.long	0x326
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x20
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x21
+	.byte	0x80
+	.byte	0xb
+	.byte	0x27
+	.long	0x348
+	.uleb128 0x4
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x29
+	.byte	0xe
+	.long	0x348
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x326
+	.long	0x358
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x3
+	.long	0x332
+	.uleb128 0x8
+	.long	0x358
+	.uleb128 0x9
+	.long	0x182
+	.uleb128 0x1f
+	.long	0x369
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xc
+	.byte	0x8
+	.byte	0x18
+	.long	0x187
+	.uleb128 0x8
+	.long	0x373
+	.uleb128 0x48
+	.long	0x37f
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xd
+	.byte	0x19
+	.byte	0x14
+	.long	0xbb
+	.uleb128 0x8
+	.long	0x389
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x14
+	.long	0xc7
+	.uleb128 0x8
+	.long	0x39a
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x14
+	.long	0xd3
+	.uleb128 0x8
+	.long	0x3ab
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x3c8
+	.uleb128 0x2c
+	.long	.LASF66
+	.byte	0x70
+	.byte	0xe
+	.byte	0x43
+	.long	0x48b
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0xe
+	.byte	0x44
+	.byte	0xb
+	.long	0x182
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF68
+	.byte	0xe
+	.byte	0x45
+	.byte	0x12
+	.long	0x50a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0xe
+	.byte	0x47
+	.byte	0x1d
+	.long	0x4d9
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0xe
+	.byte	0x48
+	.byte	0x1b
+	.long	0x534
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xe
+	.byte	0x49
+	.byte	0x1b
+	.long	0x550
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xe
+	.byte	0x4a
+	.byte	0x21
+	.long	0x55c
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xe
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x57d
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0xe
+	.byte	0x52
+	.byte	0x1b
+	.long	0x589
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0xe
+	.byte	0x59
+	.byte	0x24
+	.long	0x5aa
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xe
+	.byte	0x61
+	.byte	0x1c
+	.long	0x50f
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xe
+	.byte	0x62
+	.byte	0x18
+	.long	0x5e9
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xe
+	.byte	0x67
+	.byte	0x9
+	.long	0x59
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xe
+	.byte	0x68
+	.byte	0x11
+	.long	0x73
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x6d
+	.byte	0xb
+	.long	0x14b
+	.byte	0x68
+	.byte	0
+	.uleb128 0x21
+	.byte	0x10
+	.byte	0xe
+	.byte	0x22
+	.long	0x4c8
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xe
+	.byte	0x23
+	.byte	0xe
+	.long	0x39a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0x39a
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0xe
+	.byte	0x25
+	.byte	0xe
+	.long	0x39a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0xe
+	.byte	0x26
+	.byte	0xe
+	.long	0x39a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF85
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x48b
+	.uleb128 0x8
+	.long	0x4c8
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0xe
+	.byte	0x32
+	.byte	0xf
+	.long	0x4e5
+	.uleb128 0x9
+	.long	0x4ea
+	.uleb128 0x2d
+	.long	0x4fe
+	.long	0x4fe
+	.uleb128 0x2
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x73
+	.byte	0
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF87
+	.uleb128 0x8
+	.long	0x4fe
+	.uleb128 0x9
+	.long	0x3bc
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0xe
+	.byte	0x34
+	.byte	0xf
+	.long	0x51b
+	.uleb128 0x9
+	.long	0x520
+	.uleb128 0x2d
+	.long	0x4fe
+	.long	0x534
+	.uleb128 0x2
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x60
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF89
+	.byte	0xe
+	.byte	0x36
+	.byte	0x10
+	.long	0x540
+	.uleb128 0x9
+	.long	0x545
+	.uleb128 0x22
+	.long	0x550
+	.uleb128 0x2
+	.long	0x50a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0xe
+	.byte	0x37
+	.byte	0x10
+	.long	0x540
+	.uleb128 0x5
+	.long	.LASF91
+	.byte	0xe
+	.byte	0x38
+	.byte	0x10
+	.long	0x568
+	.uleb128 0x9
+	.long	0x56d
+	.uleb128 0x22
+	.long	0x57d
+	.uleb128 0x2
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x395
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF92
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x10
+	.long	0x540
+	.uleb128 0x5
+	.long	.LASF93
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x10
+	.long	0x595
+	.uleb128 0x9
+	.long	0x59a
+	.uleb128 0x22
+	.long	0x5aa
+	.uleb128 0x2
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x9c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x10
+	.long	0x5b6
+	.uleb128 0x9
+	.long	0x5bb
+	.uleb128 0x22
+	.long	0x5d5
+	.uleb128 0x2
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x5da
+	.uleb128 0x2
+	.long	0x4f
+	.uleb128 0x2
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x9
+	.long	0x4d4
+	.uleb128 0x8
+	.long	0x5d5
+	.uleb128 0x9
+	.long	0x384
+	.uleb128 0x8
+	.long	0x5df
+	.uleb128 0x9
+	.long	0x78
+	.uleb128 0x3c
+	.long	.LASF95
+	.byte	0xf
+	.byte	0x25
+	.byte	0x14
+	.long	0x3bc
+	.uleb128 0x3c
+	.long	.LASF96
+	.byte	0x10
+	.byte	0x1a
+	.byte	0xc
+	.long	0x59
+	.uleb128 0x5
+	.long	.LASF97
+	.byte	0x1
+	.byte	0x55
+	.byte	0xf
+	.long	0x617
+	.uleb128 0x8
+	.long	0x606
+	.uleb128 0x23
+	.long	0x2e
+	.long	0x622
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x5
+	.long	.LASF98
+	.byte	0x1
+	.byte	0x56
+	.byte	0x11
+	.long	0x638
+	.uleb128 0x8
+	.long	0x627
+	.uleb128 0x23
+	.long	0x59
+	.long	0x643
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x1
+	.byte	0x57
+	.byte	0x12
+	.long	0x654
+	.uleb128 0x8
+	.long	0x643
+	.uleb128 0x23
+	.long	0x95
+	.long	0x65f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF100
+	.byte	0x1
+	.byte	0x58
+	.byte	0x11
+	.long	0x66b
+	.uleb128 0x23
+	.long	0xb4
+	.long	0x676
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x21
+	.byte	0x10
+	.byte	0x1
+	.byte	0x5c
+	.long	0x6a4
+	.uleb128 0x4
+	.long	.LASF101
+	.byte	0x1
+	.byte	0x5d
+	.byte	0xe
+	.long	0x3ab
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x5e
+	.byte	0xe
+	.long	0x39a
+	.byte	0x8
+	.uleb128 0x2e
+	.string	"inc"
+	.byte	0x5f
+	.long	0x39a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x1
+	.byte	0x60
+	.byte	0x3
+	.long	0x676
+	.uleb128 0x8
+	.long	0x6a4
+	.uleb128 0x49
+	.long	0x20040
+	.byte	0x1
+	.byte	0x63
+	.byte	0x9
+	.long	0x75c
+	.uleb128 0x4
+	.long	.LASF104
+	.byte	0x1
+	.byte	0x64
+	.byte	0xd
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF105
+	.byte	0x1
+	.byte	0x65
+	.byte	0xd
+	.long	0x4fe
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF106
+	.byte	0x1
+	.byte	0x66
+	.byte	0xd
+	.long	0x4fe
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x67
+	.byte	0xe
+	.long	0x39a
+	.byte	0x4
+	.uleb128 0x2e
+	.string	"inc"
+	.byte	0x68
+	.long	0x39a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x69
+	.byte	0xe
+	.long	0x3ab
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF108
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x12
+	.long	0x75c
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF109
+	.byte	0x1
+	.byte	0x6d
+	.byte	0xc
+	.long	0x43
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF110
+	.byte	0x1
+	.byte	0x6e
+	.byte	0xc
+	.long	0x43
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF111
+	.byte	0x1
+	.byte	0x6f
+	.byte	0xe
+	.long	0x3ab
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF112
+	.byte	0x1
+	.byte	0x72
+	.byte	0xc
+	.long	0x43
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF113
+	.byte	0x1
+	.byte	0x73
+	.byte	0xd
+	.long	0x766
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	0x6a4
+	.uleb128 0x8
+	.long	0x75c
+	.uleb128 0x1a
+	.long	0x1ab
+	.long	0x777
+	.uleb128 0x4a
+	.long	0x35
+	.value	0xffff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x1
+	.byte	0x74
+	.byte	0x3
+	.long	0x6b5
+	.uleb128 0x8
+	.long	0x777
+	.uleb128 0x21
+	.byte	0x20
+	.byte	0x1
+	.byte	0x78
+	.long	0x7c3
+	.uleb128 0x4
+	.long	.LASF115
+	.byte	0x1
+	.byte	0x79
+	.byte	0x15
+	.long	0x7c3
+	.byte	0
+	.uleb128 0x2e
+	.string	"out"
+	.byte	0x7a
+	.long	0x7cd
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF116
+	.byte	0x1
+	.byte	0x7b
+	.byte	0xe
+	.long	0x3ab
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF117
+	.byte	0x1
+	.byte	0x7c
+	.byte	0xe
+	.long	0x3ab
+	.byte	0x18
+	.byte	0
+	.uleb128 0x9
+	.long	0x783
+	.uleb128 0x8
+	.long	0x7c3
+	.uleb128 0x9
+	.long	0x1ab
+	.uleb128 0x8
+	.long	0x7cd
+	.uleb128 0x5
+	.long	.LASF118
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x3
+	.long	0x788
+	.uleb128 0x8
+	.long	0x7d7
+	.uleb128 0x4b
+	.long	0x5ee
+	.byte	0x1
+	.value	0x2bb
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pcm_driver
+	.uleb128 0x4c
+	.long	.LASF225
+	.byte	0x3
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF232
+	.long	0x59
+	.long	0x81b
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF121
+	.byte	0x3
+	.byte	0x1a
+	.byte	0xc
+	.long	0x59
+	.long	0x836
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0x2
+	.long	0x59
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF119
+	.byte	0x25
+	.uleb128 0x3d
+	.long	.LASF120
+	.byte	0x23
+	.uleb128 0x12
+	.long	.LASF122
+	.byte	0x11
+	.byte	0xd2
+	.byte	0xc
+	.long	0x59
+	.long	0x85d
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x85d
+	.byte	0
+	.uleb128 0x9
+	.long	0x246
+	.uleb128 0x1c
+	.long	.LASF123
+	.byte	0x12
+	.value	0x229
+	.byte	0xe
+	.long	0x14b
+	.long	0x879
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF124
+	.byte	0x13
+	.byte	0x9c
+	.byte	0xc
+	.long	0x59
+	.long	0x894
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0x2
+	.long	0x73
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF125
+	.byte	0x13
+	.byte	0x9f
+	.byte	0xc
+	.long	0x59
+	.long	0x8b4
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF126
+	.byte	0xb
+	.byte	0x75
+	.byte	0xc
+	.long	0x59
+	.long	0x8cf
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x8cf
+	.byte	0
+	.uleb128 0x9
+	.long	0x364
+	.uleb128 0x12
+	.long	.LASF127
+	.byte	0x14
+	.byte	0x86
+	.byte	0xc
+	.long	0x59
+	.long	0x8f4
+	.uleb128 0x2
+	.long	0x133
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x8f4
+	.byte	0
+	.uleb128 0x9
+	.long	0x358
+	.uleb128 0x12
+	.long	.LASF128
+	.byte	0x12
+	.byte	0xb5
+	.byte	0x1a
+	.long	0x35
+	.long	0x919
+	.uleb128 0x2
+	.long	0x7d
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x59
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF129
+	.byte	0x12
+	.value	0x28e
+	.byte	0xe
+	.long	0x182
+	.long	0x930
+	.uleb128 0x2
+	.long	0x73
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF130
+	.byte	0x15
+	.byte	0x4c
+	.byte	0xc
+	.long	0x59
+	.long	0x94b
+	.uleb128 0x2
+	.long	0x14b
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF131
+	.byte	0x16
+	.byte	0xdb
+	.byte	0xc
+	.long	0x59
+	.long	0x966
+	.uleb128 0x2
+	.long	0x1e5
+	.uleb128 0x2
+	.long	0x966
+	.byte	0
+	.uleb128 0x9
+	.long	0x14b
+	.uleb128 0x12
+	.long	.LASF132
+	.byte	0x16
+	.byte	0xca
+	.byte	0xc
+	.long	0x59
+	.long	0x990
+	.uleb128 0x2
+	.long	0x995
+	.uleb128 0x2
+	.long	0x99f
+	.uleb128 0x2
+	.long	0x9a4
+	.uleb128 0x2
+	.long	0x14d
+	.byte	0
+	.uleb128 0x9
+	.long	0x1e5
+	.uleb128 0x1f
+	.long	0x990
+	.uleb128 0x9
+	.long	0x231
+	.uleb128 0x1f
+	.long	0x99a
+	.uleb128 0x9
+	.long	0x9a9
+	.uleb128 0x2d
+	.long	0x14b
+	.long	0x9b8
+	.uleb128 0x2
+	.long	0x14b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF133
+	.byte	0x15
+	.byte	0x39
+	.byte	0xe
+	.long	0x14b
+	.long	0x9e7
+	.uleb128 0x2
+	.long	0x14b
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x127
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF134
+	.byte	0x17
+	.value	0x419
+	.byte	0xc
+	.long	0x59
+	.long	0xa03
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x127
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF138
+	.byte	0x12
+	.value	0x238
+	.byte	0xd
+	.long	0xa16
+	.uleb128 0x2
+	.long	0x14b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF135
+	.byte	0x17
+	.value	0x166
+	.byte	0xc
+	.long	0x59
+	.long	0xa2d
+	.uleb128 0x2
+	.long	0x59
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF136
+	.byte	0x13
+	.value	0x1a3
+	.byte	0xe
+	.long	0x182
+	.long	0xa44
+	.uleb128 0x2
+	.long	0x59
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF236
+	.byte	0x19
+	.byte	0x25
+	.byte	0xd
+	.long	0xa50
+	.uleb128 0x9
+	.long	0x59
+	.uleb128 0x1c
+	.long	.LASF137
+	.byte	0x17
+	.value	0x18e
+	.byte	0x10
+	.long	0x19f
+	.long	0xa7b
+	.uleb128 0x2
+	.long	0x59
+	.uleb128 0x2
+	.long	0x236
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x127
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF139
+	.byte	0x58
+	.long	0xa9a
+	.uleb128 0x2
+	.long	0x78
+	.uleb128 0x2
+	.long	0x23b
+	.uleb128 0x2
+	.long	0x60
+	.uleb128 0x2
+	.long	0x9c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF140
+	.byte	0x18
+	.byte	0x2e
+	.byte	0x5
+	.long	0x59
+	.long	0xaba
+	.uleb128 0x2
+	.long	0x60
+	.uleb128 0x2
+	.long	0x23b
+	.uleb128 0x2
+	.long	0x4f
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF141
+	.byte	0x18
+	.byte	0x47
+	.byte	0x6
+	.long	0xacc
+	.uleb128 0x2
+	.long	0x78
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF142
+	.byte	0x12
+	.value	0x234
+	.byte	0xe
+	.long	0x14b
+	.long	0xae8
+	.uleb128 0x2
+	.long	0x14b
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF143
+	.byte	0x43
+	.long	0xaf9
+	.uleb128 0x2
+	.long	0x78
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF148
+	.value	0x2a9
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc1e
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x2a9
+	.byte	0x28
+	.long	0x50a
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0xc
+	.long	.LASF145
+	.value	0x2aa
+	.byte	0x32
+	.long	0x5da
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0xc
+	.long	.LASF146
+	.value	0x2aa
+	.byte	0x46
+	.long	0x4f
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0xc
+	.long	.LASF147
+	.value	0x2ab
+	.byte	0x3e
+	.long	0x5e4
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x2ae
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x20
+	.long	.LLRL117
+	.long	0xbfa
+	.uleb128 0xe
+	.string	"i"
+	.value	0x2b0
+	.byte	0x11
+	.long	0x43
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x25
+	.long	0xf44
+	.quad	.LBI137
+	.byte	.LVU441
+	.long	.LLRL119
+	.value	0x2b1
+	.byte	0x9
+	.long	0xbc9
+	.uleb128 0x3
+	.long	0xf5b
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x3
+	.long	0xf4f
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL149
+	.long	0xdb2
+	.long	0xbe3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL155
+	.long	0xdb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL145
+	.long	0xae8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x777
+	.uleb128 0x8
+	.long	0xc1e
+	.uleb128 0x16
+	.long	.LASF149
+	.value	0x2a1
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc8a
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x2a1
+	.byte	0x1f
+	.long	0x50a
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0xc
+	.long	.LASF150
+	.value	0x2a1
+	.byte	0x3a
+	.long	0x9c
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0xb
+	.quad	.LVL160
+	.long	0xdb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF151
+	.value	0x297
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcfb
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x297
+	.byte	0x23
+	.long	0x50a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x29a
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xb
+	.quad	.LVL15
+	.long	0xa7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF152
+	.value	0x28f
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdb2
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x28f
+	.byte	0x25
+	.long	0x50a
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0xc
+	.long	.LASF81
+	.value	0x28f
+	.byte	0x3c
+	.long	0x395
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x30
+	.long	0xf44
+	.quad	.LBI146
+	.byte	.LVU468
+	.quad	.LBB146
+	.quad	.LBE146-.LBB146
+	.value	0x292
+	.byte	0x5
+	.long	0xd80
+	.uleb128 0x3
+	.long	0xf5b
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x3
+	.long	0xf4f
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL170
+	.long	0xa7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF153
+	.value	0x281
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf44
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x281
+	.byte	0x1f
+	.long	0x50a
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0xc
+	.long	.LASF150
+	.value	0x281
+	.byte	0x3a
+	.long	0x9c
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x283
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0xa
+	.long	.LASF154
+	.value	0x284
+	.byte	0x14
+	.long	0x3b7
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x30
+	.long	0x1d64
+	.quad	.LBI124
+	.byte	.LVU347
+	.quad	.LBB124
+	.quad	.LBE124-.LBB124
+	.value	0x287
+	.byte	0x9
+	.long	0xf2f
+	.uleb128 0x3
+	.long	0x1d7b
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x3
+	.long	0x1d6f
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x7
+	.long	0x1d87
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x25
+	.long	0x1dbc
+	.quad	.LBI126
+	.byte	.LVU350
+	.long	.LLRL104
+	.value	0x13c
+	.byte	0xa
+	.long	0xeb2
+	.uleb128 0x3
+	.long	0x1dcc
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x13
+	.long	.LLRL104
+	.uleb128 0x7
+	.long	0x1dd8
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x7
+	.long	0x1de4
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.long	0x1d93
+	.long	.LLRL108
+	.uleb128 0x7
+	.long	0x1d94
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x31
+	.long	0x1da0
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.uleb128 0x7
+	.long	0x1da1
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x7
+	.long	0x1dad
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x6
+	.quad	.LVL136
+	.long	0xacc
+	.long	0xf11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL137
+	.long	0xaba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL138
+	.long	0x1df1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF184
+	.value	0x276
+	.long	0xf68
+	.uleb128 0x14
+	.long	.LASF115
+	.value	0x276
+	.byte	0x25
+	.long	0xc23
+	.uleb128 0x14
+	.long	.LASF81
+	.value	0x276
+	.byte	0x3a
+	.long	0x395
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF155
+	.value	0x256
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10e1
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x256
+	.byte	0x1f
+	.long	0x50a
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x259
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x26
+	.quad	.LBB230
+	.quad	.LBE230-.LBB230
+	.long	0x1057
+	.uleb128 0xa
+	.long	.LASF156
+	.value	0x261
+	.byte	0x18
+	.long	0x3b7
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x32
+	.string	"hdr"
+	.value	0x262
+	.byte	0x17
+	.long	0x10e1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x6
+	.quad	.LVL300
+	.long	0x1f8d
+	.long	0xffe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL301
+	.long	0xa55
+	.long	0x1021
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL302
+	.long	0xa44
+	.uleb128 0xd
+	.quad	.LVL303
+	.long	0xa2d
+	.uleb128 0xb
+	.quad	.LVL304
+	.long	0xae8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL290
+	.long	0x1f15
+	.long	0x106f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL291
+	.long	0xa03
+	.uleb128 0xd
+	.quad	.LVL292
+	.long	0xa03
+	.uleb128 0x6
+	.quad	.LVL296
+	.long	0xae8
+	.long	0x10ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL298
+	.long	0x14ba
+	.long	0x10c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL306
+	.long	0xa16
+	.uleb128 0xd
+	.quad	.LVL307
+	.long	0x29d4
+	.byte	0
+	.uleb128 0x1a
+	.long	0x8e
+	.long	0x10f1
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF157
+	.value	0x24f
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1145
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x24f
+	.byte	0x1f
+	.long	0x50a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xb
+	.quad	.LVL2
+	.long	0xae8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF179
+	.value	0x1ff
+	.byte	0x5
+	.long	0x4fe
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14ba
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x1ff
+	.byte	0x20
+	.long	0x50a
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0xc
+	.long	.LASF158
+	.value	0x1ff
+	.byte	0x34
+	.long	0x73
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0xa
+	.long	.LASF104
+	.value	0x20d
+	.byte	0x9
+	.long	0x4fe
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0xa
+	.long	.LASF159
+	.value	0x20e
+	.byte	0x11
+	.long	0x73
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0xe
+	.string	"fd"
+	.value	0x219
+	.byte	0x9
+	.long	0x59
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0xa
+	.long	.LASF105
+	.value	0x21a
+	.byte	0xf
+	.long	0x505
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x225
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x32
+	.string	"sb"
+	.value	0x22c
+	.byte	0x11
+	.long	0x246
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x26
+	.quad	.LBB233
+	.quad	.LBE233-.LBB233
+	.long	0x12ce
+	.uleb128 0x32
+	.string	"hdr"
+	.value	0x23a
+	.byte	0x17
+	.long	0x10e1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x6
+	.quad	.LVL345
+	.long	0x1f8d
+	.long	0x1244
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL346
+	.long	0xa9a
+	.long	0x1268
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL347
+	.long	0xa03
+	.long	0x1280
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL348
+	.long	0xa44
+	.uleb128 0xd
+	.quad	.LVL349
+	.long	0xa2d
+	.uleb128 0x6
+	.quad	.LVL350
+	.long	0xae8
+	.long	0x12b9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL351
+	.long	0xa16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	0x29aa
+	.quad	.LBI231
+	.byte	.LVU897
+	.quad	.LBB231
+	.quad	.LBE231-.LBB231
+	.value	0x21d
+	.byte	0xe
+	.long	0x1332
+	.uleb128 0x3
+	.long	0x29c6
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x3
+	.long	0x29ba
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0xb
+	.quad	.LVL331
+	.long	0x7fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x80242
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL310
+	.long	0x894
+	.long	0x135c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL311
+	.long	0x894
+	.long	0x1386
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL317
+	.long	0xae8
+	.long	0x13b1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL323
+	.long	0xae8
+	.long	0x13db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL327
+	.long	0x879
+	.long	0x1400
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL333
+	.long	0x862
+	.long	0x141b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x20040
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL335
+	.long	0x842
+	.long	0x143a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL338
+	.long	0xa44
+	.uleb128 0xd
+	.quad	.LVL339
+	.long	0xa2d
+	.uleb128 0x6
+	.quad	.LVL340
+	.long	0xae8
+	.long	0x1479
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL342
+	.long	0xa16
+	.long	0x1491
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL355
+	.long	0x862
+	.long	0x14ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x20040
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL363
+	.long	0x29d4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF160
+	.value	0x1b8
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19f8
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x1b8
+	.byte	0x26
+	.long	0x50a
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x1ba
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xa
+	.long	.LASF154
+	.value	0x1bb
+	.byte	0x14
+	.long	0x3b7
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0xa
+	.long	.LASF161
+	.value	0x1c0
+	.byte	0x12
+	.long	0x4f
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0xa
+	.long	.LASF162
+	.value	0x1c1
+	.byte	0x12
+	.long	0x4f
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0xe
+	.string	"map"
+	.value	0x1c2
+	.byte	0xb
+	.long	0x14b
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0xa
+	.long	.LASF163
+	.value	0x1d4
+	.byte	0x18
+	.long	0x9c
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x33
+	.long	.LASF164
+	.value	0x1d8
+	.byte	0xd
+	.long	0x19f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.uleb128 0x33
+	.long	.LASF165
+	.value	0x1d9
+	.byte	0xf
+	.long	0x1a08
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2640
+	.uleb128 0x33
+	.long	.LASF166
+	.value	0x1da
+	.byte	0x9
+	.long	0x1a18
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2704
+	.uleb128 0xa
+	.long	.LASF167
+	.value	0x1db
+	.byte	0x14
+	.long	0x3b7
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0xa
+	.long	.LASF116
+	.value	0x1dc
+	.byte	0xe
+	.long	0x3ab
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x20
+	.long	.LLRL137
+	.long	0x1605
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1ca
+	.byte	0x15
+	.long	0x43
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x13
+	.long	.LLRL139
+	.uleb128 0xe
+	.string	"end"
+	.value	0x1cb
+	.byte	0x1c
+	.long	0x3b7
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0xb
+	.quad	.LVL203
+	.long	0x1df1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LLRL148
+	.long	0x1746
+	.uleb128 0xe
+	.string	"t"
+	.value	0x1dd
+	.byte	0x17
+	.long	0x95
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x13
+	.long	.LLRL150
+	.uleb128 0xa
+	.long	.LASF168
+	.value	0x1de
+	.byte	0x18
+	.long	0x3b7
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0xa
+	.long	.LASF117
+	.value	0x1df
+	.byte	0x12
+	.long	0x3ab
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x34
+	.long	0x1a99
+	.quad	.LBI171
+	.byte	.LVU638
+	.long	.LLRL153
+	.value	0x1e0
+	.byte	0x18
+	.uleb128 0x3
+	.long	0x1ac1
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x3
+	.long	0x1ab5
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x3
+	.long	0x1aa9
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x13
+	.long	.LLRL153
+	.uleb128 0x7
+	.long	0x1acd
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x7
+	.long	0x1ad7
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x7
+	.long	0x1ae3
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x7
+	.long	0x1aef
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x7
+	.long	0x1afb
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x34
+	.long	0x1d17
+	.quad	.LBI173
+	.byte	.LVU640
+	.long	.LLRL162
+	.value	0x18e
+	.byte	0x16
+	.uleb128 0x3
+	.long	0x1d33
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x3
+	.long	0x1d27
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x13
+	.long	.LLRL162
+	.uleb128 0x7
+	.long	0x1d3f
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x7
+	.long	0x1d4a
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x31
+	.long	0x1d55
+	.quad	.LBB175
+	.quad	.LBE175-.LBB175
+	.uleb128 0x7
+	.long	0x1d56
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LLRL168
+	.long	0x17af
+	.uleb128 0xe
+	.string	"t"
+	.value	0x1ec
+	.byte	0x17
+	.long	0x95
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x6
+	.quad	.LVL240
+	.long	0x1b08
+	.long	0x1779
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL243
+	.long	0x96b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0xa50
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pcm_run_job
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LLRL170
+	.long	0x17de
+	.uleb128 0xe
+	.string	"t"
+	.value	0x1f3
+	.byte	0x17
+	.long	0x95
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0xb
+	.quad	.LVL247
+	.long	0x94b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x1a28
+	.quad	.LBI165
+	.byte	.LVU518
+	.long	.LLRL141
+	.value	0x1d4
+	.byte	0x22
+	.long	0x18f0
+	.uleb128 0x3
+	.long	0x1a38
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x13
+	.long	.LLRL141
+	.uleb128 0x7
+	.long	0x1a44
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x7
+	.long	0x1a50
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x41
+	.long	0x1a5c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.uleb128 0x7
+	.long	0x1a68
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x7
+	.long	0x1a74
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x51
+	.long	0x1a80
+	.quad	.LBB167
+	.quad	.LBE167-.LBB167
+	.long	0x1890
+	.uleb128 0x41
+	.long	0x1a81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2712
+	.uleb128 0x7
+	.long	0x1a8d
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0xb
+	.quad	.LVL209
+	.long	0x8f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2712
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL185
+	.long	0x919
+	.long	0x18af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL187
+	.long	0x8d4
+	.long	0x18d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL214
+	.long	0x8b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL177
+	.long	0x9e7
+	.long	0x1908
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL182
+	.long	0x9b8
+	.long	0x1934
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL198
+	.long	0xa44
+	.uleb128 0xd
+	.quad	.LVL199
+	.long	0xa2d
+	.uleb128 0x6
+	.quad	.LVL200
+	.long	0xae8
+	.long	0x196d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL217
+	.long	0xae8
+	.long	0x1998
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL245
+	.long	0x1b08
+	.long	0x19b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL256
+	.long	0x1b08
+	.long	0x19c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL257
+	.long	0x930
+	.long	0x19ea
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2736
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2728
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL262
+	.long	0x29d4
+	.byte	0
+	.uleb128 0x1a
+	.long	0x7d7
+	.long	0x1a08
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1a
+	.long	0x1e5
+	.long	0x1a18
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1a
+	.long	0x4fe
+	.long	0x1a28
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF173
+	.value	0x19d
+	.byte	0xe
+	.long	0x95
+	.long	0x1a99
+	.uleb128 0x14
+	.long	.LASF154
+	.value	0x19d
+	.byte	0x2e
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF169
+	.value	0x19f
+	.byte	0x17
+	.long	0x78
+	.uleb128 0xf
+	.long	.LASF170
+	.value	0x1a8
+	.byte	0x12
+	.long	0x95
+	.uleb128 0x1d
+	.string	"set"
+	.value	0x1a9
+	.byte	0xf
+	.long	0x358
+	.uleb128 0xf
+	.long	.LASF171
+	.value	0x1ad
+	.byte	0x14
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF163
+	.value	0x1ae
+	.byte	0x12
+	.long	0x95
+	.uleb128 0x28
+	.uleb128 0xf
+	.long	.LASF172
+	.value	0x1a1
+	.byte	0xf
+	.long	0x182
+	.uleb128 0x1d
+	.string	"n"
+	.value	0x1a2
+	.byte	0x1d
+	.long	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF174
+	.value	0x18b
+	.byte	0xa
+	.long	0x3ab
+	.long	0x1b08
+	.uleb128 0x14
+	.long	.LASF115
+	.value	0x18b
+	.byte	0x33
+	.long	0x7c8
+	.uleb128 0x14
+	.long	.LASF168
+	.value	0x18c
+	.byte	0x2c
+	.long	0x3b7
+	.uleb128 0x14
+	.long	.LASF167
+	.value	0x18c
+	.byte	0x42
+	.long	0x3b7
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x18e
+	.byte	0x12
+	.long	0x4f
+	.uleb128 0xf
+	.long	.LASF175
+	.value	0x18f
+	.byte	0x14
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF176
+	.value	0x190
+	.byte	0x14
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF177
+	.value	0x192
+	.byte	0x14
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF178
+	.value	0x193
+	.byte	0x14
+	.long	0x3b7
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF180
+	.value	0x166
+	.byte	0x7
+	.long	0x14b
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d03
+	.uleb128 0x52
+	.string	"arg"
+	.byte	0x1
+	.value	0x166
+	.byte	0x19
+	.long	0x14b
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xe
+	.string	"job"
+	.value	0x168
+	.byte	0x1a
+	.long	0x1d08
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x169
+	.byte	0x1b
+	.long	0x7c8
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xa
+	.long	.LASF181
+	.value	0x16b
+	.byte	0xe
+	.long	0x3ab
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x13
+	.long	.LLRL68
+	.uleb128 0xe
+	.string	"i"
+	.value	0x16c
+	.byte	0x11
+	.long	0x43
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x20
+	.long	.LLRL75
+	.long	0x1c87
+	.uleb128 0xe
+	.string	"seg"
+	.value	0x16d
+	.byte	0x22
+	.long	0x1d12
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xa
+	.long	.LASF182
+	.value	0x16e
+	.byte	0x18
+	.long	0x3b7
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xe
+	.string	"end"
+	.value	0x170
+	.byte	0x18
+	.long	0x3b7
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0xe
+	.string	"out"
+	.value	0x171
+	.byte	0x18
+	.long	0x7d2
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xa
+	.long	.LASF146
+	.value	0x172
+	.byte	0x16
+	.long	0x4f
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x26
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.long	0x1c36
+	.uleb128 0xa
+	.long	.LASF102
+	.value	0x174
+	.byte	0x1c
+	.long	0x3a6
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xd
+	.quad	.LVL107
+	.long	0x2351
+	.byte	0
+	.uleb128 0x34
+	.long	0x2940
+	.quad	.LBI105
+	.byte	.LVU265
+	.long	.LLRL81
+	.value	0x178
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x2968
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x3
+	.long	0x295c
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x3
+	.long	0x2950
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xb
+	.quad	.LVL96
+	.long	0x29dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.long	0x1d17
+	.quad	.LBI101
+	.byte	.LVU234
+	.quad	.LBB101
+	.quad	.LBE101-.LBB101
+	.byte	0x1
+	.value	0x16c
+	.byte	0x15
+	.uleb128 0x3
+	.long	0x1d33
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x3
+	.long	0x1d27
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x7
+	.long	0x1d3f
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x7
+	.long	0x1d4a
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x31
+	.long	0x1d55
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.uleb128 0x7
+	.long	0x1d56
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x7e3
+	.uleb128 0x8
+	.long	0x1d03
+	.uleb128 0x9
+	.long	0x6b0
+	.uleb128 0x8
+	.long	0x1d0d
+	.uleb128 0x27
+	.long	.LASF183
+	.value	0x155
+	.byte	0x8
+	.long	0x43
+	.long	0x1d64
+	.uleb128 0x14
+	.long	.LASF115
+	.value	0x155
+	.byte	0x2f
+	.long	0x7c8
+	.uleb128 0x14
+	.long	.LASF181
+	.value	0x155
+	.byte	0x44
+	.long	0x3b7
+	.uleb128 0x1d
+	.string	"lo"
+	.value	0x157
+	.byte	0xc
+	.long	0x43
+	.uleb128 0x1d
+	.string	"hi"
+	.value	0x158
+	.byte	0xc
+	.long	0x43
+	.uleb128 0x28
+	.uleb128 0x1d
+	.string	"mid"
+	.value	0x15a
+	.byte	0x16
+	.long	0x4f
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF185
+	.value	0x138
+	.long	0x1dbc
+	.uleb128 0x14
+	.long	.LASF144
+	.value	0x138
+	.byte	0x26
+	.long	0x50a
+	.uleb128 0x14
+	.long	.LASF154
+	.value	0x138
+	.byte	0x3d
+	.long	0x3b7
+	.uleb128 0xf
+	.long	.LASF115
+	.value	0x13a
+	.byte	0x15
+	.long	0xc23
+	.uleb128 0x28
+	.uleb128 0x1d
+	.string	"seg"
+	.value	0x148
+	.byte	0x1c
+	.long	0x761
+	.uleb128 0x28
+	.uleb128 0xf
+	.long	.LASF186
+	.value	0x13e
+	.byte	0x1a
+	.long	0x4f
+	.uleb128 0xf
+	.long	.LASF187
+	.value	0x140
+	.byte	0x20
+	.long	0x761
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF188
+	.value	0x12b
+	.byte	0x5
+	.long	0x4fe
+	.long	0x1df1
+	.uleb128 0x14
+	.long	.LASF115
+	.value	0x12b
+	.byte	0x36
+	.long	0x7c8
+	.uleb128 0xf
+	.long	.LASF189
+	.value	0x130
+	.byte	0x1e
+	.long	0x1d12
+	.uleb128 0xf
+	.long	.LASF190
+	.value	0x131
+	.byte	0x14
+	.long	0x3a6
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF191
+	.value	0x113
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f15
+	.uleb128 0xc
+	.long	.LASF144
+	.value	0x113
+	.byte	0x1e
+	.long	0x50a
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0xc
+	.long	.LASF154
+	.value	0x113
+	.byte	0x2d
+	.long	0x43
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x115
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x13
+	.long	.LLRL89
+	.uleb128 0xa
+	.long	.LASF192
+	.value	0x118
+	.byte	0x16
+	.long	0x4f
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xa
+	.long	.LASF193
+	.value	0x119
+	.byte	0x16
+	.long	0x4f
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0xe
+	.string	"out"
+	.value	0x11a
+	.byte	0x18
+	.long	0x7d2
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x25
+	.long	0x2940
+	.quad	.LBI113
+	.byte	.LVU307
+	.long	.LLRL93
+	.value	0x11e
+	.byte	0xd
+	.long	0x1ee7
+	.uleb128 0x3
+	.long	0x2968
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x3
+	.long	0x295c
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x3
+	.long	0x2950
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0xb
+	.quad	.LVL111
+	.long	0x29dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL117
+	.long	0x2351
+	.long	0x1eff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL118
+	.long	0x1f15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF194
+	.byte	0xff
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f8d
+	.uleb128 0x29
+	.long	.LASF144
+	.byte	0xff
+	.byte	0x1d
+	.long	0x50a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xa
+	.long	.LASF115
+	.value	0x101
+	.byte	0x15
+	.long	0xc23
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.quad	.LVL6
+	.long	0xa9a
+	.long	0x1f71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 64
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL9
+	.long	0xaba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF195
+	.byte	0xeb
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x226f
+	.uleb128 0x36
+	.string	"hdr"
+	.byte	0xeb
+	.byte	0x26
+	.long	0x2274
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x29
+	.long	.LASF156
+	.byte	0xeb
+	.byte	0x3a
+	.long	0x3a6
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x17
+	.long	.LASF196
+	.byte	0xed
+	.byte	0x14
+	.long	0x3a6
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x15
+	.long	0x2975
+	.quad	.LBI216
+	.byte	.LVU744
+	.quad	.LBB216
+	.quad	.LBE216-.LBB216
+	.byte	0xef
+	.byte	0x5
+	.long	0x202e
+	.uleb128 0x3
+	.long	0x299d
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x3
+	.long	0x2991
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x3
+	.long	0x2985
+	.long	.LLST181
+	.long	.LVUS181
+	.byte	0
+	.uleb128 0x15
+	.long	0x2975
+	.quad	.LBI218
+	.byte	.LVU755
+	.quad	.LBB218
+	.quad	.LBE218-.LBB218
+	.byte	0xf1
+	.byte	0x5
+	.long	0x207a
+	.uleb128 0x3
+	.long	0x299d
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x3
+	.long	0x2991
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x3
+	.long	0x2985
+	.long	.LLST184
+	.long	.LVUS184
+	.byte	0
+	.uleb128 0x15
+	.long	0x232c
+	.quad	.LBI220
+	.byte	.LVU763
+	.quad	.LBB220
+	.quad	.LBE220-.LBB220
+	.byte	0xf3
+	.byte	0x5
+	.long	0x20b9
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST186
+	.long	.LVUS186
+	.byte	0
+	.uleb128 0x15
+	.long	0x232c
+	.quad	.LBI222
+	.byte	.LVU770
+	.quad	.LBB222
+	.quad	.LBE222-.LBB222
+	.byte	0xf4
+	.byte	0x5
+	.long	0x20f8
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST188
+	.long	.LVUS188
+	.byte	0
+	.uleb128 0x15
+	.long	0x232c
+	.quad	.LBI224
+	.byte	.LVU783
+	.quad	.LBB224
+	.quad	.LBE224-.LBB224
+	.byte	0xf7
+	.byte	0x5
+	.long	0x2137
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST190
+	.long	.LVUS190
+	.byte	0
+	.uleb128 0x15
+	.long	0x232c
+	.quad	.LBI226
+	.byte	.LVU790
+	.quad	.LBB226
+	.quad	.LBE226-.LBB226
+	.byte	0xf8
+	.byte	0x5
+	.long	0x2176
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST192
+	.long	.LVUS192
+	.byte	0
+	.uleb128 0x15
+	.long	0x2975
+	.quad	.LBI228
+	.byte	.LVU797
+	.quad	.LBB228
+	.quad	.LBE228-.LBB228
+	.byte	0xf9
+	.byte	0x5
+	.long	0x21c2
+	.uleb128 0x3
+	.long	0x299d
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x3
+	.long	0x2991
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x3
+	.long	0x2985
+	.long	.LLST195
+	.long	.LVUS195
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL274
+	.long	0x2279
+	.long	0x21f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x19
+	.byte	0x76
+	.sleb128 0
+	.byte	0x9
+	.byte	0xdb
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffdb
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL276
+	.long	0x2279
+	.long	0x2214
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL279
+	.long	0x2279
+	.long	0x2233
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0xbb80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL280
+	.long	0x2279
+	.long	0x2254
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x17700
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL284
+	.long	0x2279
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x8e
+	.uleb128 0x8
+	.long	0x226f
+	.uleb128 0x35
+	.long	.LASF197
+	.byte	0xdf
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x232c
+	.uleb128 0x54
+	.string	"buf"
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x24
+	.long	0x2274
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x55
+	.long	.LASF198
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x38
+	.long	0x3a6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x15
+	.long	0x232c
+	.quad	.LBI198
+	.byte	.LVU724
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.byte	0xe1
+	.byte	0x5
+	.long	0x22f0
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST173
+	.long	.LVUS173
+	.byte	0
+	.uleb128 0x2a
+	.long	0x232c
+	.quad	.LBI200
+	.byte	.LVU732
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.byte	0xe2
+	.byte	0x5
+	.uleb128 0x3
+	.long	0x2344
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x3
+	.long	0x2339
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF199
+	.byte	0x1
+	.byte	0xd7
+	.byte	0x6
+	.byte	0x1
+	.long	0x2351
+	.uleb128 0x37
+	.string	"buf"
+	.byte	0xd7
+	.byte	0x24
+	.long	0x2274
+	.uleb128 0x10
+	.long	.LASF198
+	.byte	0x1
+	.byte	0xd7
+	.byte	0x38
+	.long	0x395
+	.byte	0
+	.uleb128 0x57
+	.long	.LASF200
+	.byte	0x1
+	.byte	0xab
+	.byte	0xa
+	.long	0x39a
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x286b
+	.uleb128 0x36
+	.string	"out"
+	.byte	0xab
+	.byte	0x27
+	.long	0x7d2
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x29
+	.long	.LASF146
+	.byte	0xab
+	.byte	0x39
+	.long	0x4f
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x29
+	.long	.LASF102
+	.byte	0xac
+	.byte	0x21
+	.long	0x39a
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x36
+	.string	"inc"
+	.byte	0xac
+	.byte	0x37
+	.long	0x3a6
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x17
+	.long	.LASF201
+	.byte	0xae
+	.byte	0x11
+	.long	0x622
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x17
+	.long	.LASF202
+	.byte	0xaf
+	.byte	0x11
+	.long	0x622
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x18
+	.string	"dt"
+	.byte	0xb0
+	.byte	0x10
+	.long	0x612
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x17
+	.long	.LASF203
+	.byte	0xb1
+	.byte	0x10
+	.long	0x612
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x18
+	.string	"one"
+	.byte	0xb2
+	.byte	0x10
+	.long	0x612
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x18
+	.string	"far"
+	.byte	0xb3
+	.byte	0x10
+	.long	0x612
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x18
+	.string	"amp"
+	.byte	0xb4
+	.byte	0x10
+	.long	0x612
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x17
+	.long	.LASF204
+	.byte	0xb6
+	.byte	0x10
+	.long	0x64f
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x19
+	.long	.LASF205
+	.byte	0xb7
+	.byte	0x10
+	.long	0x64f
+	.uleb128 0x19
+	.long	.LASF206
+	.byte	0xb8
+	.byte	0x10
+	.long	0x633
+	.uleb128 0x17
+	.long	.LASF207
+	.byte	0xb9
+	.byte	0x14
+	.long	0x3a6
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x17
+	.long	.LASF208
+	.byte	0xbb
+	.byte	0x12
+	.long	0x4f
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x58
+	.long	.LASF209
+	.byte	0x1
+	.byte	0xbc
+	.byte	0xa
+	.long	0x65f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x26
+	.quad	.LBB61
+	.quad	.LBE61-.LBB61
+	.long	0x281d
+	.uleb128 0x18
+	.string	"i"
+	.byte	0xbd
+	.byte	0x11
+	.long	0x43
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x13
+	.long	.LLRL20
+	.uleb128 0x17
+	.long	.LASF210
+	.byte	0xbe
+	.byte	0x14
+	.long	0x64f
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x18
+	.string	"pos"
+	.byte	0xbf
+	.byte	0x14
+	.long	0x64f
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x18
+	.string	"s"
+	.byte	0xc1
+	.byte	0xe
+	.long	0x606
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x18
+	.string	"t"
+	.byte	0xc2
+	.byte	0x14
+	.long	0x612
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x18
+	.string	"t2"
+	.byte	0xc3
+	.byte	0x14
+	.long	0x612
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x17
+	.long	.LASF211
+	.byte	0xc5
+	.byte	0x14
+	.long	0x633
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2b
+	.long	0x28dc
+	.quad	.LBI63
+	.byte	.LVU107
+	.long	.LLRL27
+	.byte	0xc2
+	.byte	0x18
+	.long	0x257f
+	.uleb128 0x3
+	.long	0x28ea
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x13
+	.long	.LLRL27
+	.uleb128 0x7
+	.long	0x28f6
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x7
+	.long	0x2901
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x286b
+	.quad	.LBI66
+	.byte	.LVU142
+	.long	.LLRL31
+	.byte	0xc7
+	.byte	0x12
+	.long	0x2687
+	.uleb128 0x3
+	.long	0x288c
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x3
+	.long	0x2882
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x3
+	.long	0x2879
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x13
+	.long	.LLRL31
+	.uleb128 0x7
+	.long	0x2898
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x7
+	.long	0x28a3
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x7
+	.long	0x28af
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x7
+	.long	0x28ba
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x7
+	.long	0x28c5
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x42
+	.long	0x28d0
+	.uleb128 0x15
+	.long	0x290d
+	.quad	.LBI68
+	.byte	.LVU158
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0x9f
+	.byte	0xc
+	.long	0x2645
+	.uleb128 0x3
+	.long	0x2933
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1e
+	.long	0x2927
+	.uleb128 0x1e
+	.long	0x291b
+	.byte	0
+	.uleb128 0x2a
+	.long	0x290d
+	.quad	.LBI70
+	.byte	.LVU165
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0x9f
+	.byte	0xc
+	.uleb128 0x3
+	.long	0x2933
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x3
+	.long	0x2927
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1e
+	.long	0x291b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x2975
+	.quad	.LBI73
+	.byte	.LVU88
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.byte	0xcd
+	.byte	0x9
+	.long	0x26d3
+	.uleb128 0x3
+	.long	0x299d
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x3
+	.long	0x2991
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x3
+	.long	0x2985
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x2b
+	.long	0x28dc
+	.quad	.LBI76
+	.byte	.LVU116
+	.long	.LLRL46
+	.byte	0xc3
+	.byte	0x19
+	.long	0x2711
+	.uleb128 0x1e
+	.long	0x28ea
+	.uleb128 0x13
+	.long	.LLRL46
+	.uleb128 0x7
+	.long	0x28f6
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x7
+	.long	0x2901
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x286b
+	.quad	.LBI81
+	.byte	.LVU171
+	.quad	.LBB81
+	.quad	.LBE81-.LBB81
+	.byte	0xc7
+	.byte	0x31
+	.uleb128 0x3
+	.long	0x288c
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x3
+	.long	0x2882
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.long	0x2879
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x7
+	.long	0x2898
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.long	0x28a3
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x7
+	.long	0x28af
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x7
+	.long	0x28ba
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x7
+	.long	0x28c5
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x42
+	.long	0x28d0
+	.uleb128 0x15
+	.long	0x290d
+	.quad	.LBI83
+	.byte	.LVU186
+	.quad	.LBB83
+	.quad	.LBE83-.LBB83
+	.byte	0x9f
+	.byte	0xc
+	.long	0x27da
+	.uleb128 0x3
+	.long	0x2933
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1e
+	.long	0x2927
+	.uleb128 0x1e
+	.long	0x291b
+	.byte	0
+	.uleb128 0x2a
+	.long	0x290d
+	.quad	.LBI85
+	.byte	.LVU193
+	.quad	.LBB85
+	.quad	.LBE85-.LBB85
+	.byte	0x9f
+	.byte	0xc
+	.uleb128 0x3
+	.long	0x2933
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x3
+	.long	0x2927
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1e
+	.long	0x291b
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x2975
+	.quad	.LBI88
+	.byte	.LVU205
+	.long	.LLRL60
+	.byte	0xd1
+	.byte	0x5
+	.long	0x285d
+	.uleb128 0x3
+	.long	0x299d
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x3
+	.long	0x2991
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x3
+	.long	0x2985
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL77
+	.long	0x29d4
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF212
+	.byte	0x95
+	.long	0x606
+	.long	0x28dc
+	.uleb128 0x37
+	.string	"t"
+	.byte	0x95
+	.byte	0x1f
+	.long	0x612
+	.uleb128 0x37
+	.string	"dt"
+	.byte	0x95
+	.byte	0x2d
+	.long	0x612
+	.uleb128 0x10
+	.long	.LASF203
+	.byte	0x1
+	.byte	0x95
+	.byte	0x3c
+	.long	0x612
+	.uleb128 0x19
+	.long	.LASF213
+	.byte	0x97
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x59
+	.string	"one"
+	.byte	0x1
+	.byte	0x98
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x19
+	.long	.LASF214
+	.byte	0x9a
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x19
+	.long	.LASF215
+	.byte	0x9b
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x19
+	.long	.LASF216
+	.byte	0x9c
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x19
+	.long	.LASF217
+	.byte	0x9d
+	.byte	0x10
+	.long	0x612
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF218
+	.byte	0x8b
+	.long	0x606
+	.long	0x290d
+	.uleb128 0x10
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x1e
+	.long	0x64f
+	.uleb128 0x19
+	.long	.LASF219
+	.byte	0x8d
+	.byte	0x11
+	.long	0x622
+	.uleb128 0x19
+	.long	.LASF220
+	.byte	0x8e
+	.byte	0x10
+	.long	0x612
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF221
+	.byte	0x81
+	.long	0x606
+	.long	0x2940
+	.uleb128 0x10
+	.long	.LASF222
+	.byte	0x1
+	.byte	0x81
+	.byte	0x1d
+	.long	0x633
+	.uleb128 0x10
+	.long	.LASF223
+	.byte	0x1
+	.byte	0x81
+	.byte	0x2e
+	.long	0x612
+	.uleb128 0x10
+	.long	.LASF224
+	.byte	0x1
+	.byte	0x81
+	.byte	0x42
+	.long	0x612
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF226
+	.byte	0x2
+	.byte	0x39
+	.byte	0x2a
+	.long	0x14b
+	.long	0x2975
+	.uleb128 0x10
+	.long	.LASF227
+	.byte	0x2
+	.byte	0x39
+	.byte	0x38
+	.long	0x14b
+	.uleb128 0x10
+	.long	.LASF228
+	.byte	0x2
+	.byte	0x39
+	.byte	0x44
+	.long	0x59
+	.uleb128 0x10
+	.long	.LASF229
+	.byte	0x2
+	.byte	0x39
+	.byte	0x51
+	.long	0x43
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF230
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x2a
+	.long	0x14b
+	.long	0x29aa
+	.uleb128 0x10
+	.long	.LASF227
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x43
+	.long	0x14d
+	.uleb128 0x10
+	.long	.LASF231
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x62
+	.long	0x240
+	.uleb128 0x10
+	.long	.LASF229
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x70
+	.long	0x43
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF232
+	.byte	0x3
+	.byte	0x29
+	.byte	0x1
+	.long	0x59
+	.long	0x29d4
+	.uleb128 0x10
+	.long	.LASF233
+	.byte	0x3
+	.byte	0x29
+	.byte	0x13
+	.long	0x73
+	.uleb128 0x10
+	.long	.LASF234
+	.byte	0x3
+	.byte	0x29
+	.byte	0x1f
+	.long	0x59
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF237
+	.long	.LASF237
+	.uleb128 0x5b
+	.long	.LASF226
+	.long	.LASF238
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x7
+	.byte	0x9e
+	.uleb128 0x5
+	.byte	0x52
+	.byte	0x49
+	.byte	0x46
+	.byte	0x46
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.byte	0x9e
+	.uleb128 0x9
+	.byte	0x57
+	.byte	0x41
+	.byte	0x56
+	.byte	0x45
+	.byte	0x66
+	.byte	0x6d
+	.byte	0x74
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x7
+	.byte	0x9e
+	.uleb128 0x5
+	.byte	0x64
+	.byte	0x61
+	.byte	0x74
+	.byte	0x61
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU423
+	.uleb128 .LVU423
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU425
+	.uleb128 .LVU425
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU414
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+	.uleb128 .LVU453
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU416
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+	.uleb128 .LVU451
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU425
+	.uleb128 .LVU426
+	.uleb128 .LVU441
+	.uleb128 .LVU447
+	.uleb128 .LVU447
+	.uleb128 .LVU449
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+	.uleb128 .LVU441
+	.uleb128 .LVU449
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU36
+	.uleb128 .LVU40
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU468
+	.uleb128 .LVU474
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU468
+	.uleb128 .LVU479
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU341
+	.uleb128 .LVU405
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU344
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x34
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x34
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU347
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU402
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x34
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU347
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU402
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU349
+	.uleb128 .LVU402
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU350
+	.uleb128 .LVU361
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU357
+	.uleb128 .LVU361
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU359
+	.uleb128 .LVU361
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x12
+	.byte	0x73
+	.sleb128 48
+	.byte	0x94
+	.byte	0x4
+	.byte	0x72
+	.sleb128 0
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU370
+	.uleb128 .LVU379
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU392
+	.uleb128 .LVU402
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU395
+	.uleb128 .LVU402
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS196:
+	.uleb128 0
+	.uleb128 .LVU813
+	.uleb128 .LVU813
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU832
+	.uleb128 .LVU832
+	.uleb128 0
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU816
+	.uleb128 .LVU831
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU835
+	.uleb128 .LVU839
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 0
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU881
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 .LVU997
+	.uleb128 .LVU997
+	.uleb128 .LVU998
+	.uleb128 .LVU998
+	.uleb128 0
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS200:
+	.uleb128 0
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU876
+	.uleb128 .LVU876
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU881
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU996
+	.uleb128 .LVU996
+	.uleb128 0
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU872
+	.uleb128 .LVU875
+	.uleb128 .LVU888
+	.uleb128 .LVU891
+	.uleb128 .LVU891
+	.uleb128 .LVU936
+	.uleb128 .LVU953
+	.uleb128 .LVU988
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU874
+	.uleb128 .LVU875
+	.uleb128 .LVU890
+	.uleb128 .LVU910
+	.uleb128 .LVU924
+	.uleb128 .LVU932
+	.uleb128 .LVU956
+	.uleb128 .LVU959
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU892
+	.uleb128 .LVU904
+	.uleb128 .LVU904
+	.uleb128 .LVU909
+	.uleb128 .LVU909
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 .LVU927
+	.uleb128 .LVU927
+	.uleb128 .LVU934
+	.uleb128 .LVU953
+	.uleb128 .LVU969
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU894
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU956
+	.uleb128 .LVU956
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU996
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU910
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 .LVU924
+	.uleb128 .LVU932
+	.uleb128 .LVU933
+	.uleb128 .LVU933
+	.uleb128 .LVU953
+	.uleb128 .LVU953
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 .LVU956
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+	.uleb128 .LVU968
+	.uleb128 .LVU996
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL342-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL342-1-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU897
+	.uleb128 .LVU904
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80242
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU897
+	.uleb128 .LVU904
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU559
+	.uleb128 .LVU559
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU491
+	.uleb128 .LVU718
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU493
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU719
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU497
+	.uleb128 .LVU511
+	.uleb128 .LVU512
+	.uleb128 .LVU563
+	.uleb128 .LVU582
+	.uleb128 .LVU661
+	.uleb128 .LVU687
+	.uleb128 .LVU696
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU499
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU559
+	.uleb128 .LVU559
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU717
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2728
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2728
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU500
+	.uleb128 .LVU504
+	.uleb128 .LVU512
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU559
+	.uleb128 .LVU582
+	.uleb128 .LVU717
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2736
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2736
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU538
+	.uleb128 .LVU559
+	.uleb128 .LVU596
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU717
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU549
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU559
+	.uleb128 .LVU598
+	.uleb128 .LVU717
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2752
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2752
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU550
+	.uleb128 .LVU559
+	.uleb128 .LVU598
+	.uleb128 .LVU628
+	.uleb128 .LVU628
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU661
+	.uleb128 .LVU687
+	.uleb128 .LVU701
+	.uleb128 .LVU701
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU710
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x840
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 0x2c
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x840
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU507
+	.uleb128 .LVU512
+	.uleb128 .LVU563
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 .LVU582
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU563
+	.uleb128 .LVU572
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU552
+	.uleb128 .LVU559
+	.uleb128 .LVU598
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU717
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU598
+	.uleb128 .LVU634
+	.uleb128 .LVU636
+	.uleb128 .LVU661
+	.uleb128 .LVU687
+	.uleb128 .LVU695
+	.uleb128 .LVU695
+	.uleb128 .LVU710
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 0x1b
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU617
+	.uleb128 .LVU634
+	.uleb128 .LVU687
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU701
+	.uleb128 .LVU701
+	.uleb128 .LVU710
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x24
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 0x2c
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x840
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU598
+	.uleb128 .LVU617
+	.uleb128 .LVU638
+	.uleb128 .LVU661
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2752
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2752
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU598
+	.uleb128 .LVU617
+	.uleb128 .LVU638
+	.uleb128 .LVU661
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU598
+	.uleb128 .LVU617
+	.uleb128 .LVU638
+	.uleb128 .LVU661
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU599
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU609
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU604
+	.uleb128 .LVU614
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU607
+	.uleb128 .LVU612
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU612
+	.uleb128 .LVU617
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU615
+	.uleb128 .LVU633
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+	.uleb128 .LVU640
+	.uleb128 .LVU659
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0xc
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+	.uleb128 .LVU640
+	.uleb128 .LVU659
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+	.uleb128 .LVU642
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU658
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+	.uleb128 .LVU644
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU657
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU653
+	.uleb128 .LVU659
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+	.uleb128 .LVU673
+	.uleb128 .LVU706
+	.uleb128 .LVU713
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU677
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU684
+	.uleb128 .LVU685
+	.uleb128 .LVU687
+	.uleb128 .LVU712
+	.uleb128 .LVU713
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU518
+	.uleb128 .LVU538
+	.uleb128 .LVU582
+	.uleb128 .LVU596
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU521
+	.uleb128 .LVU524
+	.uleb128 .LVU582
+	.uleb128 .LVU586
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU525
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU536
+	.uleb128 .LVU592
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU532
+	.uleb128 .LVU538
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU535
+	.uleb128 .LVU537
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU587
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU591
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU228
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU230
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU232
+	.uleb128 .LVU257
+	.uleb128 .LVU263
+	.uleb128 .LVU268
+	.uleb128 .LVU270
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 .LVU294
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU253
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU263
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU270
+	.uleb128 .LVU278
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x34
+	.byte	0x24
+	.byte	0x76
+	.sleb128 24
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x34
+	.byte	0x24
+	.byte	0x76
+	.sleb128 24
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU282
+	.uleb128 .LVU284
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU264
+	.uleb128 .LVU275
+	.uleb128 .LVU284
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU264
+	.uleb128 .LVU270
+	.uleb128 .LVU286
+	.uleb128 .LVU298
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU264
+	.uleb128 .LVU270
+	.uleb128 .LVU288
+	.uleb128 .LVU298
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU292
+	.uleb128 .LVU294
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x10
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU265
+	.uleb128 .LVU270
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU265
+	.uleb128 .LVU270
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU265
+	.uleb128 .LVU270
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU234
+	.uleb128 .LVU253
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU234
+	.uleb128 .LVU253
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU236
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU253
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU238
+	.uleb128 .LVU248
+	.uleb128 .LVU249
+	.uleb128 .LVU253
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU244
+	.uleb128 .LVU249
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU334
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU303
+	.uleb128 .LVU336
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU306
+	.uleb128 .LVU311
+	.uleb128 .LVU322
+	.uleb128 .LVU332
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU306
+	.uleb128 .LVU320
+	.uleb128 .LVU325
+	.uleb128 .LVU334
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU306
+	.uleb128 .LVU311
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU307
+	.uleb128 .LVU311
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU307
+	.uleb128 .LVU311
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU307
+	.uleb128 .LVU311
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU14
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS176:
+	.uleb128 0
+	.uleb128 .LVU753
+	.uleb128 .LVU753
+	.uleb128 .LVU805
+	.uleb128 .LVU805
+	.uleb128 0
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 0
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 0
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU743
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x12
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9
+	.byte	0xdb
+	.byte	0x16
+	.byte	0x14
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1c
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9
+	.byte	0xdb
+	.byte	0x16
+	.byte	0x14
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1d
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x12
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9
+	.byte	0xdb
+	.byte	0x16
+	.byte	0x14
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x24
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU744
+	.uleb128 .LVU747
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU744
+	.uleb128 .LVU747
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+10728
+	.sleb128 0
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU744
+	.uleb128 .LVU747
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU755
+	.uleb128 .LVU758
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU755
+	.uleb128 .LVU758
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+10737
+	.sleb128 0
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU755
+	.uleb128 .LVU758
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU763
+	.uleb128 .LVU768
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU763
+	.uleb128 .LVU768
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 20
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU770
+	.uleb128 .LVU775
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU770
+	.uleb128 .LVU775
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 22
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU783
+	.uleb128 .LVU788
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU783
+	.uleb128 .LVU788
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 34
+	.byte	0x9f
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU797
+	.uleb128 .LVU800
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU797
+	.uleb128 .LVU800
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+10750
+	.sleb128 0
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU797
+	.uleb128 .LVU800
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 36
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU724
+	.uleb128 .LVU729
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU724
+	.uleb128 .LVU729
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU732
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU738
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 0
+	.byte	0x40
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU732
+	.uleb128 .LVU738
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU224
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU47
+	.uleb128 .LVU62
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU49
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU62
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x8
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0xc
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU51
+	.uleb128 .LVU224
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU53
+	.uleb128 .LVU224
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU57
+	.uleb128 .LVU224
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x467ffc00
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x467ffc00
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x467ffc00
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x467ffc00
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU63
+	.uleb128 .LVU224
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU67
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x32
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x32
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU69
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU72
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU203
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU82
+	.uleb128 .LVU94
+	.uleb128 .LVU99
+	.uleb128 .LVU203
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0xc
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0xc
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x58
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU102
+	.uleb128 .LVU121
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU106
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU202
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU114
+	.uleb128 .LVU168
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU124
+	.uleb128 .LVU196
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU132
+	.uleb128 .LVU139
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU107
+	.uleb128 .LVU114
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU82
+	.uleb128 .LVU98
+	.uleb128 .LVU109
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU82
+	.uleb128 .LVU98
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU142
+	.uleb128 .LVU170
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU142
+	.uleb128 .LVU170
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU142
+	.uleb128 .LVU168
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU144
+	.uleb128 .LVU202
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU145
+	.uleb128 .LVU202
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU148
+	.uleb128 .LVU151
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU153
+	.uleb128 .LVU169
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU156
+	.uleb128 .LVU164
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU158
+	.uleb128 .LVU165
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU82
+	.uleb128 .LVU98
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU82
+	.uleb128 .LVU98
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x33800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU170
+	.uleb128 .LVU198
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU170
+	.uleb128 .LVU198
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU170
+	.uleb128 .LVU196
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU173
+	.uleb128 .LVU202
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU174
+	.uleb128 .LVU202
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU181
+	.uleb128 .LVU197
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU184
+	.uleb128 .LVU192
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU186
+	.uleb128 .LVU193
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x20
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU193
+	.uleb128 .LVU198
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU193
+	.uleb128 .LVU197
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU205
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU205
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU214
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU205
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU214
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB131-.Ltext0
+	.uleb128 .LBE131-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0
+.LLRL117:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0
+.LLRL137:
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0
+.LLRL141:
+	.byte	0x4
+	.uleb128 .LBB165-.Ltext0
+	.uleb128 .LBE165-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0
+.LLRL148:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0
+.LLRL150:
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0
+.LLRL162:
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0
+.LLRL168:
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0
+.LLRL170:
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF57:
+	.string	"__glibc_reserved"
+.LASF56:
+	.string	"st_ctim"
+.LASF109:
+	.string	"segment_count"
+.LASF11:
+	.string	"size_t"
+.LASF110:
+	.string	"segment_alloc"
+.LASF101:
+	.string	"start"
+.LASF193:
+	.string	"chunk"
+.LASF52:
+	.string	"st_blksize"
+.LASF53:
+	.string	"st_blocks"
+.LASF28:
+	.string	"__ssize_t"
+.LASF150:
+	.string	"milliseconds"
+.LASF215:
+	.string	"b_after"
+.LASF203:
+	.string	"inv_dt"
+.LASF194:
+	.string	"pcm_flush"
+.LASF89:
+	.string	"beep_driver_init_func"
+.LASF19:
+	.string	"__gid_t"
+.LASF55:
+	.string	"st_mtim"
+.LASF73:
+	.string	"end_tone"
+.LASF206:
+	.string	"sign"
+.LASF151:
+	.string	"driver_end_tone"
+.LASF202:
+	.string	"inv_dt_f"
+.LASF232:
+	.string	"open"
+.LASF175:
+	.string	"before"
+.LASF60:
+	.string	"cpu_set_t"
+.LASF132:
+	.string	"pthread_create"
+.LASF42:
+	.string	"stat"
+.LASF96:
+	.string	"log_level"
+.LASF83:
+	.string	"delay"
+.LASF32:
+	.string	"ssize_t"
+.LASF95:
+	.string	"pcm_driver"
+.LASF137:
+	.string	"pwrite"
+.LASF201:
+	.string	"dt_f"
+.LASF102:
+	.string	"phase"
+.LASF17:
+	.string	"__dev_t"
+.LASF199:
+	.string	"put_le16"
+.LASF233:
+	.string	"__path"
+.LASF61:
+	.string	"sig_atomic_t"
+.LASF166:
+	.string	"started"
+.LASF4:
+	.string	"long int"
+.LASF173:
+	.string	"pcm_thread_count"
+.LASF238:
+	.string	"__builtin_memset"
+.LASF213:
+	.string	"zero"
+.LASF180:
+	.string	"pcm_run_job"
+.LASF197:
+	.string	"put_le32"
+.LASF10:
+	.string	"signed char"
+.LASF26:
+	.string	"__blksize_t"
+.LASF153:
+	.string	"pcm_advance"
+.LASF47:
+	.string	"st_uid"
+.LASF207:
+	.string	"step"
+.LASF219:
+	.string	"scale"
+.LASF8:
+	.string	"unsigned char"
+.LASF50:
+	.string	"st_rdev"
+.LASF142:
+	.string	"realloc"
+.LASF164:
+	.string	"jobs"
+.LASF29:
+	.string	"__syscall_slong_t"
+.LASF87:
+	.string	"_Bool"
+.LASF198:
+	.string	"value"
+.LASF84:
+	.string	"flags"
+.LASF7:
+	.string	"char"
+.LASF208:
+	.string	"full_blocks"
+.LASF184:
+	.string	"pcm_start_tone"
+.LASF105:
+	.string	"close_fd"
+.LASF108:
+	.string	"segments"
+.LASF149:
+	.string	"driver_wait"
+.LASF205:
+	.string	"half"
+.LASF14:
+	.string	"__uint16_t"
+.LASF97:
+	.string	"v4sf"
+.LASF98:
+	.string	"v4si"
+.LASF236:
+	.string	"__errno_location"
+.LASF106:
+	.string	"offline"
+.LASF178:
+	.string	"distance"
+.LASF99:
+	.string	"v4su"
+.LASF21:
+	.string	"__mode_t"
+.LASF75:
+	.string	"play_sequence"
+.LASF216:
+	.string	"x_before"
+.LASF103:
+	.string	"pcm_segment"
+.LASF143:
+	.string	"log_verbose"
+.LASF124:
+	.string	"strcmp"
+.LASF114:
+	.string	"pcm_data"
+.LASF211:
+	.string	"near_edge"
+.LASF133:
+	.string	"mmap"
+.LASF171:
+	.string	"useful"
+.LASF112:
+	.string	"fill"
+.LASF209:
+	.string	"samples"
+.LASF126:
+	.string	"__sched_cpucount"
+.LASF196:
+	.string	"riff_size"
+.LASF182:
+	.string	"seg_end"
+.LASF79:
+	.string	"device_name"
+.LASF128:
+	.string	"strtoul"
+.LASF113:
+	.string	"buffer"
+.LASF224:
+	.string	"if_false"
+.LASF58:
+	.string	"__cpu_mask"
+.LASF141:
+	.string	"safe_error_exit"
+.LASF188:
+	.string	"pcm_continues_last_segment"
+.LASF104:
+	.string	"is_wav"
+.LASF48:
+	.string	"st_gid"
+.LASF127:
+	.string	"sched_getaffinity"
+.LASF71:
+	.string	"fini"
+.LASF16:
+	.string	"__uint64_t"
+.LASF129:
+	.string	"getenv"
+.LASF3:
+	.string	"long unsigned int"
+.LASF155:
+	.string	"driver_fini"
+.LASF107:
+	.string	"frames_written"
+.LASF37:
+	.string	"pthread_t"
+.LASF130:
+	.string	"munmap"
+.LASF200:
+	.string	"render_square"
+.LASF221:
+	.string	"v4sf_select"
+.LASF51:
+	.string	"st_size"
+.LASF190:
+	.string	"prev_end_phase"
+.LASF76:
+	.string	"probe"
+.LASF168:
+	.string	"ideal"
+.LASF225:
+	.string	"__open_alias"
+.LASF100:
+	.string	"v4hi"
+.LASF38:
+	.string	"__size"
+.LASF156:
+	.string	"data_size"
+.LASF214:
+	.string	"x_after"
+.LASF122:
+	.string	"fstat"
+.LASF27:
+	.string	"__blkcnt_t"
+.LASF167:
+	.string	"slack"
+.LASF165:
+	.string	"tids"
+.LASF177:
+	.string	"nearest"
+.LASF20:
+	.string	"__ino_t"
+.LASF15:
+	.string	"__uint32_t"
+.LASF237:
+	.string	"__stack_chk_fail"
+.LASF228:
+	.string	"__ch"
+.LASF192:
+	.string	"space"
+.LASF5:
+	.string	"long long int"
+.LASF154:
+	.string	"frames"
+.LASF186:
+	.string	"new_alloc"
+.LASF169:
+	.string	"forced"
+.LASF145:
+	.string	"tones"
+.LASF147:
+	.string	"abort_flag"
+.LASF170:
+	.string	"cpus"
+.LASF152:
+	.string	"driver_begin_tone"
+.LASF136:
+	.string	"strerror"
+.LASF2:
+	.string	"float"
+.LASF74:
+	.string	"wait"
+.LASF40:
+	.string	"pthread_attr_t"
+.LASF235:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF93:
+	.string	"beep_driver_wait_func"
+.LASF146:
+	.string	"count"
+.LASF222:
+	.string	"mask"
+.LASF9:
+	.string	"unsigned int"
+.LASF120:
+	.string	"__open_too_many_args"
+.LASF134:
+	.string	"ftruncate"
+.LASF49:
+	.string	"__pad0"
+.LASF88:
+	.string	"beep_driver_probe_func"
+.LASF172:
+	.string	"endp"
+.LASF195:
+	.string	"wav_header"
+.LASF72:
+	.string	"begin_tone"
+.LASF139:
+	.string	"log_deferred"
+.LASF116:
+	.string	"first"
+.LASF181:
+	.string	"frame"
+.LASF45:
+	.string	"st_nlink"
+.LASF31:
+	.string	"off_t"
+.LASF220:
+	.string	"vscale"
+.LASF78:
+	.string	"device_fd"
+.LASF125:
+	.string	"strncmp"
+.LASF24:
+	.string	"__pid_t"
+.LASF85:
+	.string	"beep_tone"
+.LASF217:
+	.string	"b_before"
+.LASF43:
+	.string	"st_dev"
+.LASF41:
+	.string	"timespec"
+.LASF59:
+	.string	"__bits"
+.LASF36:
+	.string	"long long unsigned int"
+.LASF94:
+	.string	"beep_driver_play_sequence_func"
+.LASF82:
+	.string	"length"
+.LASF62:
+	.string	"uint16_t"
+.LASF23:
+	.string	"__off_t"
+.LASF111:
+	.string	"total_frames"
+.LASF90:
+	.string	"beep_driver_fini_func"
+.LASF161:
+	.string	"header_size"
+.LASF25:
+	.string	"__time_t"
+.LASF119:
+	.string	"__open_missing_mode"
+.LASF226:
+	.string	"memset"
+.LASF185:
+	.string	"pcm_append_segment"
+.LASF30:
+	.string	"__sig_atomic_t"
+.LASF12:
+	.string	"__int16_t"
+.LASF158:
+	.string	"console_device"
+.LASF118:
+	.string	"pcm_job"
+.LASF92:
+	.string	"beep_driver_end_tone_func"
+.LASF123:
+	.string	"malloc"
+.LASF39:
+	.string	"__align"
+.LASF163:
+	.string	"threads"
+.LASF70:
+	.string	"init"
+.LASF157:
+	.string	"driver_init"
+.LASF65:
+	.string	"beep_driver"
+.LASF140:
+	.string	"write_all"
+.LASF144:
+	.string	"driver"
+.LASF67:
+	.string	"name"
+.LASF148:
+	.string	"driver_play_sequence"
+.LASF231:
+	.string	"__src"
+.LASF159:
+	.string	"file_name"
+.LASF176:
+	.string	"after"
+.LASF210:
+	.string	"base"
+.LASF77:
+	.string	"default_devices"
+.LASF13:
+	.string	"short int"
+.LASF64:
+	.string	"uint64_t"
+.LASF204:
+	.string	"lane"
+.LASF35:
+	.string	"tv_nsec"
+.LASF33:
+	.string	"int16_t"
+.LASF160:
+	.string	"pcm_render_offline"
+.LASF183:
+	.string	"pcm_find_segment"
+.LASF223:
+	.string	"if_true"
+.LASF227:
+	.string	"__dest"
+.LASF187:
+	.string	"new_segments"
+.LASF212:
+	.string	"v4sf_polyblep"
+.LASF162:
+	.string	"map_size"
+.LASF179:
+	.string	"driver_detect"
+.LASF69:
+	.string	"detect"
+.LASF230:
+	.string	"memcpy"
+.LASF131:
+	.string	"pthread_join"
+.LASF46:
+	.string	"st_mode"
+.LASF18:
+	.string	"__uid_t"
+.LASF218:
+	.string	"v4su_to_unit"
+.LASF63:
+	.string	"uint32_t"
+.LASF174:
+	.string	"pcm_chunk_boundary"
+.LASF234:
+	.string	"__oflag"
+.LASF138:
+	.string	"free"
+.LASF81:
+	.string	"freq"
+.LASF6:
+	.string	"short unsigned int"
+.LASF91:
+	.string	"beep_driver_begin_tone_func"
+.LASF191:
+	.string	"pcm_render"
+.LASF86:
+	.string	"beep_driver_detect_func"
+.LASF44:
+	.string	"st_ino"
+.LASF22:
+	.string	"__nlink_t"
+.LASF229:
+	.string	"__len"
+.LASF68:
+	.string	"next"
+.LASF66:
+	.string	"_beep_driver"
+.LASF115:
+	.string	"data"
+.LASF135:
+	.string	"close"
+.LASF189:
+	.string	"prev"
+.LASF34:
+	.string	"tv_sec"
+.LASF80:
+	.string	"driver_data"
+.LASF121:
+	.string	"__open_2"
+.LASF117:
+	.string	"last"
+.LASF54:
+	.string	"st_atim"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-pcm.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,274 @@
+/* beep-driver-pwm.c - implement the beep sysfs PWM driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* The PWM driver drives a buzzer attached to a PWM output through the
+ * Linux sysfs PWM interface, e.g. on a Raspberry Pi:
+ *
+ *   beep -e pwm:/sys/class/pwm/pwmchip0/pwm0
+ *
+ * The PWM channel must already be exported, and the user running
+ * beep must be allowed to write to its period, duty_cycle and enable
+ * attributes.
+ *
+ * All three attribute files are opened once in driver_detect() and
+ * kept open.  Every value is written with a single pwrite(2) at
+ * offset 0, and only if it differs from the value last written.
+ *
+ * For testing, the attribute files may also be regular files in a
+ * fake sysfs directory.  Those are truncated after writing, so that
+ * they read back like sysfs attributes.
+ */
+
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include "beep-driver-pwm.h"
+
+#include "beep-library.h"
+#include "beep-log.h"
+
+
+typedef struct {
+    int      fd;
+    bool     known;   /* whether value is what the attribute contains */
+    uint32_t value;
+} pwm_attr;
+
+
+typedef struct {
+    pwm_attr      period;      /* ns */
+    pwm_attr      duty_cycle;  /* ns */
+    pwm_attr      enable;      /* 0 or 1 */
+    bool          is_regular;  /* fake sysfs tree made of regular files */
+    unsigned long writes;
+    unsigned long tones;
+} pwm_data;
+
+
+static
+void pwm_write_attr(pwm_data *const data, pwm_attr *const attr,
+                    const uint32_t value)
+{
+    if (attr->known && (attr->value == value)) {
+        return;
+    }
+
+    /* Format the decimal string backwards from the end of the buffer */
+    char buf[16];
+    char *const end = &buf[sizeof(buf)];
+    char *str = end;
+    uint32_t v = value;
+    do {
+        *--str = (char)('0' + (v % 10U));
+        v /= 10U;
+    } while (v > 0);
+    const size_t len = (size_t)(end - str);
+
+    if ((ssize_t)len != pwrite(attr->fd, str, len, 0)) {
+        /* If we cannot write, we cannot silence the buzzer either */
+        safe_error_exit("pwrite pwm attribute");
+    }
+    if (data->is_regular) {
+        if (-1 == ftruncate(attr->fd, (off_t)len)) {
+            safe_error_exit("ftruncate pwm attribute");
+        }
+    }
+    ++data->writes;
+
+    attr->known = true;
+    attr->value = value;
+}
+
+
+static
+int pwm_open_attr(const int dir_fd, const char *const name)
+{
+    const int fd = openat(dir_fd, name, O_WRONLY|O_CLOEXEC);
+    if (fd == -1) {
+        log_verbose("pwm: could not open(2) %s: %s", name, strerror(errno));
+    }
+    return fd;
+}
+
+
+static
+bool driver_detect(beep_driver *driver, const char *console_device)
+{
+    if (console_device) {
+        log_verbose("pwm driver_detect %p %s",
+                    (void *)driver, console_device);
+    } else {
+        log_verbose("pwm driver_detect %p %p",
+                    (void *)driver, (const void *)console_device);
+    }
+    if (!console_device) {
+        /* There is no well-known default PWM channel for a buzzer */
+        return false;
+    }
+    if (strncmp(console_device, BEEP_PWM_PREFIX,
+                strlen(BEEP_PWM_PREFIX)) != 0) {
+        return false;
+    }
+
+    const char *const dir_name = console_device + strlen(BEEP_PWM_PREFIX);
+    const int dir_fd = open(dir_name, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+    if (dir_fd == -1) {
+        log_verbose("pwm: could not open(2) %s: %s",
+                    dir_name, strerror(errno));
+        return false;
+    }
+
+    pwm_data *const data = malloc(sizeof(pwm_data));
+    if (!data) {
+        close(dir_fd);
+        return false;
+    }
+    data->period.fd     = pwm_open_attr(dir_fd, "period");
+    data->duty_cycle.fd = pwm_open_attr(dir_fd, "duty_cycle");
+    data->enable.fd     = pwm_open_attr(dir_fd, "enable");
+    close(dir_fd);
+
+    struct stat sb;
+    if ((data->period.fd == -1) || (data->duty_cycle.fd == -1)
+        || (data->enable.fd == -1) || (-1 == fstat(data->enable.fd, &sb))) {
+        if (data->period.fd != -1)     close(data->period.fd);
+        if (data->duty_cycle.fd != -1) close(data->duty_cycle.fd);
+        if (data->enable.fd != -1)     close(data->enable.fd);
+        free(data);
+        return false;
+    }
+    data->is_regular = S_ISREG(sb.st_mode);
+    data->period.known     = false;
+    data->duty_cycle.known = false;
+    data->enable.known     = false;
+    data->writes = 0;
+    data->tones = 0;
+
+    /* Start from a known state: silent, and a duty cycle which is
+     * valid for any period.
+     */
+    pwm_write_attr(data, &data->enable, 0);
+    pwm_write_attr(data, &data->duty_cycle, 0);
+
+    driver->device_fd = data->enable.fd;
+    driver->device_name = console_device;
+    driver->driver_data = data;
+    return true;
+}
+
+
+static
+void driver_init(beep_driver *driver)
+{
+    log_verbose("pwm driver_init %p", (void *)driver);
+}
+
+
+static
+void driver_fini(beep_driver *driver)
+{
+    log_verbose("pwm driver_fini %p", (void *)driver);
+    pwm_data *const data = driver->driver_data;
+    log_verbose("pwm: %lu attribute writes for %lu tones",
+                data->writes, data->tones);
+    close(data->period.fd);
+    close(data->duty_cycle.fd);
+    close(data->enable.fd);
+    driver->device_fd = -1;
+    free(driver->driver_data);
+    driver->driver_data = NULL;
+}
+
+
+static
+void driver_end_tone(beep_driver *driver);
+
+
+static
+void driver_begin_tone(beep_driver *driver, const uint16_t freq)
+{
+    log_verbose_deferred_u("pwm driver_begin_tone %p %u", (void *)driver, freq);
+    pwm_data *const data = driver->driver_data;
+
+    if (freq == 0) {
+        driver_end_tone(driver);
+        return;
+    }
+    ++data->tones;
+
+    const uint32_t period = (1000000000U + freq / 2U) / freq;
+    const uint32_t duty_cycle = period / 2U;
+
+    /* The kernel rejects a duty cycle longer than the period, so the
+     * order of the writes depends on whether the period shrinks.
+     */
+    if (period >= data->duty_cycle.value) {
+        pwm_write_attr(data, &data->period, period);
+        pwm_write_attr(data, &data->duty_cycle, duty_cycle);
+    } else {
+        pwm_write_attr(data, &data->duty_cycle, duty_cycle);
+        pwm_write_attr(data, &data->period, period);
+    }
+    pwm_write_attr(data, &data->enable, 1);
+}
+
+
+static
+void driver_end_tone(beep_driver *driver)
+{
+    log_verbose_deferred("pwm driver_end_tone %p", (void *)driver);
+    pwm_data *const data = driver->driver_data;
+
+    pwm_write_attr(data, &data->enable, 0);
+}
+
+
+beep_driver pwm_driver =
+    {
+     "pwm",
+     NULL,
+     driver_detect,
+     driver_init,
+     driver_fini,
+     driver_begin_tone,
+     driver_end_tone,
+     NULL,
+     NULL,
+     NULL,
+     NULL,
+     0,
+     NULL,
+     NULL
+    };
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,44 @@
+/* beep-driver-pwm.h - interface to the beep sysfs PWM driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_DRIVER_PWM_H
+#define BEEP_DRIVER_PWM_H
+
+
+#include "beep-driver.h"
+
+
+/** Device name prefix selecting the PWM driver, as in
+ * "pwm:/sys/class/pwm/pwmchip0/pwm0".
+ */
+#define BEEP_PWM_PREFIX "pwm:"
+
+
+extern beep_driver pwm_driver;
+
+
+#endif /* BEEP_DRIVER_PWM_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,4743 @@
+	.file	"beep-driver-pwm.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-pwm.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"pwrite pwm attribute"
+.LC1:
+	.string	"ftruncate pwm attribute"
+	.text
+	.type	pwm_write_attr, @function
+pwm_write_attr:
+.LVL0:
+.LFB43:
+	.file 1 "beep-driver-pwm.c"
+	.loc 1 75 1 view -0
+	.cfi_startproc
+	.loc 1 75 1 is_stmt 0 view .LVU1
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	movl	%edx, %r12d
+	.loc 1 75 1 view .LVU2
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 76 5 is_stmt 1 view .LVU3
+	.loc 1 76 8 is_stmt 0 view .LVU4
+	cmpb	$0, 4(%rsi)
+	je	.L8
+	.loc 1 76 21 discriminator 1 view .LVU5
+	cmpl	%edx, 8(%rsi)
+	je	.L1
+	leaq	16(%rsp), %r8
+	jmp	.L2
+.L8:
+	leaq	16(%rsp), %r8
+.L2:
+	.loc 1 86 34 discriminator 1 view .LVU6
+	movl	$3435973837, %edi
+.LVL1:
+.L4:
+	.loc 1 85 5 is_stmt 1 discriminator 1 view .LVU7
+	.loc 1 86 9 discriminator 1 view .LVU8
+	.loc 1 86 16 is_stmt 0 discriminator 1 view .LVU9
+	subq	$1, %r8
+.LVL2:
+	.loc 1 86 34 discriminator 1 view .LVU10
+	movl	%edx, %eax
+	imulq	%rdi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %esi
+	addl	%esi, %esi
+	movl	%edx, %ecx
+	subl	%esi, %ecx
+	.loc 1 86 29 discriminator 1 view .LVU11
+	addl	$48, %ecx
+	movb	%cl, (%r8)
+	.loc 1 87 9 is_stmt 1 discriminator 1 view .LVU12
+	movl	%edx, %ecx
+	.loc 1 87 11 is_stmt 0 discriminator 1 view .LVU13
+	movl	%eax, %edx
+.LVL3:
+	.loc 1 88 16 is_stmt 1 discriminator 1 view .LVU14
+	cmpl	$9, %ecx
+	ja	.L4
+	.loc 1 89 5 view .LVU15
+	.loc 1 89 37 is_stmt 0 view .LVU16
+	leaq	16(%rsp), %r13
+	subq	%r8, %r13
+.LVL4:
+	.loc 1 91 5 is_stmt 1 view .LVU17
+	.loc 1 91 25 is_stmt 0 view .LVU18
+	movl	(%rbx), %edi
+	movl	$0, %ecx
+	movq	%r13, %rdx
+	movq	%r8, %rsi
+	call	pwrite@PLT
+.LVL5:
+	.loc 1 91 8 view .LVU19
+	cmpq	%rax, %r13
+	jne	.L11
+	.loc 1 95 5 is_stmt 1 view .LVU20
+	.loc 1 95 8 is_stmt 0 view .LVU21
+	cmpb	$0, 36(%rbp)
+	jne	.L12
+.L6:
+	.loc 1 100 5 is_stmt 1 view .LVU22
+	addq	$1, 40(%rbp)
+	.loc 1 102 5 view .LVU23
+	.loc 1 102 17 is_stmt 0 view .LVU24
+	movb	$1, 4(%rbx)
+	.loc 1 103 5 is_stmt 1 view .LVU25
+	.loc 1 103 17 is_stmt 0 view .LVU26
+	movl	%r12d, 8(%rbx)
+.LVL6:
+.L1:
+	.loc 1 104 1 view .LVU27
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L13
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL7:
+	.loc 1 104 1 view .LVU28
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL8:
+	.loc 1 104 1 view .LVU29
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 104 1 view .LVU30
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL10:
+.L11:
+	.cfi_restore_state
+	.loc 1 93 9 is_stmt 1 view .LVU31
+	leaq	.LC0(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL11:
+.L12:
+	.loc 1 96 9 view .LVU32
+	.loc 1 96 19 is_stmt 0 view .LVU33
+	movl	(%rbx), %edi
+	movq	%r13, %rsi
+	call	ftruncate@PLT
+.LVL12:
+	.loc 1 96 12 view .LVU34
+	cmpl	$-1, %eax
+	jne	.L6
+	.loc 1 97 13 is_stmt 1 view .LVU35
+	leaq	.LC1(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL13:
+.L13:
+	.loc 1 104 1 is_stmt 0 view .LVU36
+	call	__stack_chk_fail@PLT
+.LVL14:
+	.cfi_endproc
+.LFE43:
+	.size	pwm_write_attr, .-pwm_write_attr
+	.section	.rodata.str1.1
+.LC2:
+	.string	"pwm driver_end_tone %p"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL15:
+.LFB49:
+	.loc 1 242 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 242 1 is_stmt 0 view .LVU38
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 243 5 is_stmt 1 view .LVU39
+	.loc 1 243 10 view .LVU40
+	.loc 1 243 90 view .LVU41
+	.loc 1 243 93 is_stmt 0 view .LVU42
+	cmpl	$0, log_level(%rip)
+	jg	.L17
+.LVL16:
+.L15:
+	.loc 1 243 8 is_stmt 1 discriminator 6 view .LVU43
+	.loc 1 244 5 discriminator 6 view .LVU44
+	.loc 1 244 21 is_stmt 0 discriminator 6 view .LVU45
+	movq	104(%rbx), %rdi
+.LVL17:
+	.loc 1 246 5 is_stmt 1 discriminator 6 view .LVU46
+	leaq	24(%rdi), %rsi
+	movl	$0, %edx
+	call	pwm_write_attr
+.LVL18:
+	.loc 1 247 1 is_stmt 0 discriminator 6 view .LVU47
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL19:
+	.loc 1 247 1 discriminator 6 view .LVU48
+	ret
+.LVL20:
+.L17:
+	.cfi_restore_state
+	.loc 1 243 126 is_stmt 1 discriminator 4 view .LVU49
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rdi, %rsi
+	leaq	.LC2(%rip), %rdi
+	call	log_deferred@PLT
+.LVL21:
+	jmp	.L15
+	.cfi_endproc
+.LFE49:
+	.size	driver_end_tone, .-driver_end_tone
+	.section	.rodata.str1.1
+.LC3:
+	.string	"pwm driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL22:
+.LFB48:
+	.loc 1 213 1 view -0
+	.cfi_startproc
+	.loc 1 213 1 is_stmt 0 view .LVU51
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12
+	movl	%esi, %ebx
+	.loc 1 214 5 is_stmt 1 view .LVU52
+	.loc 1 214 10 view .LVU53
+	.loc 1 214 101 view .LVU54
+	.loc 1 214 104 is_stmt 0 view .LVU55
+	cmpl	$0, log_level(%rip)
+	jg	.L25
+.LVL23:
+.L19:
+	.loc 1 214 8 is_stmt 1 discriminator 6 view .LVU56
+	.loc 1 215 5 discriminator 6 view .LVU57
+	.loc 1 215 21 is_stmt 0 discriminator 6 view .LVU58
+	movq	104(%r12), %rbp
+.LVL24:
+	.loc 1 217 5 is_stmt 1 discriminator 6 view .LVU59
+	.loc 1 217 8 is_stmt 0 discriminator 6 view .LVU60
+	testw	%bx, %bx
+	je	.L26
+	.loc 1 221 5 is_stmt 1 view .LVU61
+	addq	$1, 48(%rbp)
+	.loc 1 223 5 view .LVU62
+	.loc 1 223 49 is_stmt 0 view .LVU63
+	movl	%ebx, %eax
+	shrw	%ax
+	movzwl	%ax, %eax
+	.loc 1 223 42 view .LVU64
+	addl	$1000000000, %eax
+	.loc 1 223 55 view .LVU65
+	movzwl	%bx, %ebx
+	.loc 1 223 20 view .LVU66
+	movl	$0, %edx
+	divl	%ebx
+	movl	%eax, %ebx
+.LVL25:
+	.loc 1 224 5 is_stmt 1 view .LVU67
+	.loc 1 224 20 is_stmt 0 view .LVU68
+	movl	%eax, %r12d
+.LVL26:
+	.loc 1 224 20 view .LVU69
+	shrl	%r12d
+.LVL27:
+	.loc 1 229 5 is_stmt 1 view .LVU70
+	.loc 1 229 8 is_stmt 0 view .LVU71
+	cmpl	20(%rbp), %eax
+	jb	.L22
+	.loc 1 230 9 is_stmt 1 view .LVU72
+	movl	%eax, %edx
+	movq	%rbp, %rsi
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL28:
+	.loc 1 231 9 view .LVU73
+	leaq	12(%rbp), %rsi
+	movl	%r12d, %edx
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL29:
+.L23:
+	.loc 1 236 5 view .LVU74
+	leaq	24(%rbp), %rsi
+	movl	$1, %edx
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL30:
+.L18:
+	.loc 1 237 1 is_stmt 0 view .LVU75
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL31:
+	.loc 1 237 1 view .LVU76
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL32:
+.L25:
+	.cfi_restore_state
+	.loc 1 214 137 is_stmt 1 discriminator 4 view .LVU77
+	movzwl	%si, %ecx
+	movl	$1, %edx
+	movq	%rdi, %rsi
+.LVL33:
+	.loc 1 214 137 is_stmt 0 discriminator 4 view .LVU78
+	leaq	.LC3(%rip), %rdi
+.LVL34:
+	.loc 1 214 137 discriminator 4 view .LVU79
+	call	log_deferred@PLT
+.LVL35:
+	.loc 1 214 137 discriminator 4 view .LVU80
+	jmp	.L19
+.LVL36:
+.L26:
+	.loc 1 218 9 is_stmt 1 view .LVU81
+	movq	%r12, %rdi
+	call	driver_end_tone
+.LVL37:
+	.loc 1 219 9 view .LVU82
+	jmp	.L18
+.LVL38:
+.L22:
+	.loc 1 233 9 view .LVU83
+	leaq	12(%rbp), %rsi
+	movl	%r12d, %edx
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL39:
+	.loc 1 234 9 view .LVU84
+	movl	%ebx, %edx
+	movq	%rbp, %rsi
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL40:
+	jmp	.L23
+	.cfi_endproc
+.LFE48:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.section	.rodata.str1.1
+.LC4:
+	.string	"pwm driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL41:
+.LFB46:
+	.loc 1 186 1 view -0
+	.cfi_startproc
+	.loc 1 186 1 is_stmt 0 view .LVU86
+	endbr64
+	.loc 1 187 5 is_stmt 1 view .LVU87
+	.loc 1 187 10 view .LVU88
+	.loc 1 187 13 is_stmt 0 view .LVU89
+	cmpl	$0, log_level(%rip)
+	jg	.L33
+	ret
+.L33:
+	.loc 1 186 1 discriminator 1 view .LVU90
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 187 46 is_stmt 1 discriminator 1 view .LVU91
+	movq	%rdi, %rsi
+	leaq	.LC4(%rip), %rdi
+.LVL42:
+	.loc 1 187 46 is_stmt 0 discriminator 1 view .LVU92
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL43:
+	.loc 1 187 8 is_stmt 1 discriminator 1 view .LVU93
+	.loc 1 188 1 is_stmt 0 discriminator 1 view .LVU94
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.1
+.LC5:
+	.string	"pwm driver_fini %p"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"pwm: %lu attribute writes for %lu tones"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL44:
+.LFB47:
+	.loc 1 193 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 1 is_stmt 0 view .LVU96
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 194 5 is_stmt 1 view .LVU97
+	.loc 1 194 10 view .LVU98
+	.loc 1 194 13 is_stmt 0 view .LVU99
+	cmpl	$0, log_level(%rip)
+	jg	.L39
+	.loc 1 194 8 is_stmt 1 view .LVU100
+	.loc 1 195 5 view .LVU101
+	.loc 1 195 21 is_stmt 0 view .LVU102
+	movq	104(%rdi), %rbp
+.LVL45:
+	.loc 1 196 5 is_stmt 1 view .LVU103
+	.loc 1 196 10 view .LVU104
+.L36:
+	.loc 1 196 8 discriminator 3 view .LVU105
+	.loc 1 198 5 discriminator 3 view .LVU106
+	movl	0(%rbp), %edi
+	call	close@PLT
+.LVL46:
+	.loc 1 199 5 discriminator 3 view .LVU107
+	movl	12(%rbp), %edi
+	call	close@PLT
+.LVL47:
+	.loc 1 200 5 discriminator 3 view .LVU108
+	movl	24(%rbp), %edi
+	call	close@PLT
+.LVL48:
+	.loc 1 201 5 discriminator 3 view .LVU109
+	.loc 1 201 23 is_stmt 0 discriminator 3 view .LVU110
+	movl	$-1, 88(%rbx)
+	.loc 1 202 5 is_stmt 1 discriminator 3 view .LVU111
+	movq	104(%rbx), %rdi
+	call	free@PLT
+.LVL49:
+	.loc 1 203 5 discriminator 3 view .LVU112
+	.loc 1 203 25 is_stmt 0 discriminator 3 view .LVU113
+	movq	$0, 104(%rbx)
+	.loc 1 204 1 discriminator 3 view .LVU114
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL50:
+	.loc 1 204 1 discriminator 3 view .LVU115
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL51:
+	.loc 1 204 1 discriminator 3 view .LVU116
+	ret
+.LVL52:
+.L39:
+	.cfi_restore_state
+	.loc 1 194 46 is_stmt 1 discriminator 1 view .LVU117
+	movq	%rdi, %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL53:
+	.loc 1 194 8 discriminator 1 view .LVU118
+	.loc 1 195 5 discriminator 1 view .LVU119
+	.loc 1 195 21 is_stmt 0 discriminator 1 view .LVU120
+	movq	104(%rbx), %rbp
+.LVL54:
+	.loc 1 196 5 is_stmt 1 discriminator 1 view .LVU121
+	.loc 1 196 10 discriminator 1 view .LVU122
+	.loc 1 196 13 is_stmt 0 discriminator 1 view .LVU123
+	cmpl	$0, log_level(%rip)
+	jle	.L36
+	.loc 1 196 46 is_stmt 1 discriminator 1 view .LVU124
+	movq	48(%rbp), %rdx
+	movq	40(%rbp), %rsi
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL55:
+	jmp	.L36
+	.cfi_endproc
+.LFE47:
+	.size	driver_fini, .-driver_fini
+	.section	.rodata.str1.1
+.LC7:
+	.string	"pwm: could not open(2) %s: %s"
+	.text
+	.type	pwm_open_attr, @function
+pwm_open_attr:
+.LVL56:
+.LFB44:
+	.loc 1 109 1 view -0
+	.cfi_startproc
+	.loc 1 109 1 is_stmt 0 view .LVU126
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rsi, %rbp
+	.loc 1 110 5 is_stmt 1 view .LVU127
+.LVL57:
+.LBB6:
+.LBI6:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 2 117 1 view .LVU128
+.LBB7:
+	.loc 2 119 3 view .LVU129
+	.loc 2 122 3 view .LVU130
+	.loc 2 124 7 view .LVU131
+	.loc 2 129 7 view .LVU132
+	.loc 2 129 14 is_stmt 0 view .LVU133
+	movl	$524289, %edx
+	movl	$0, %eax
+	call	openat@PLT
+.LVL58:
+	.loc 2 129 14 view .LVU134
+	movl	%eax, %ebx
+.LVL59:
+	.loc 2 129 14 view .LVU135
+.LBE7:
+.LBE6:
+	.loc 1 111 5 is_stmt 1 view .LVU136
+	.loc 1 111 8 is_stmt 0 view .LVU137
+	cmpl	$-1, %eax
+	je	.L43
+.LVL60:
+.L40:
+	.loc 1 115 1 view .LVU138
+	movl	%ebx, %eax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL61:
+	.loc 1 115 1 view .LVU139
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 115 1 view .LVU140
+	ret
+.LVL63:
+.L43:
+	.cfi_restore_state
+	.loc 1 112 9 is_stmt 1 view .LVU141
+	.loc 1 112 14 view .LVU142
+	.loc 1 112 17 is_stmt 0 view .LVU143
+	cmpl	$0, log_level(%rip)
+	jle	.L40
+	.loc 1 112 50 is_stmt 1 discriminator 1 view .LVU144
+	.loc 1 112 10 is_stmt 0 discriminator 1 view .LVU145
+	call	__errno_location@PLT
+.LVL64:
+	.loc 1 112 50 discriminator 1 view .LVU146
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL65:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL66:
+	.loc 1 112 12 is_stmt 1 discriminator 1 view .LVU147
+	.loc 1 114 5 discriminator 1 view .LVU148
+	.loc 1 114 12 is_stmt 0 discriminator 1 view .LVU149
+	jmp	.L40
+	.cfi_endproc
+.LFE44:
+	.size	pwm_open_attr, .-pwm_open_attr
+	.section	.rodata.str1.1
+.LC8:
+	.string	"pwm driver_detect %p %s"
+.LC9:
+	.string	"pwm driver_detect %p %p"
+.LC10:
+	.string	"period"
+.LC11:
+	.string	"duty_cycle"
+.LC12:
+	.string	"enable"
+.LC13:
+	.string	"pwm:"
+	.text
+	.type	driver_detect, @function
+driver_detect:
+.LVL67:
+.LFB45:
+	.loc 1 120 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 120 1 is_stmt 0 view .LVU151
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 208
+	movq	%rdi, %r13
+	.loc 1 120 1 view .LVU152
+	movq	%fs:40, %rax
+	movq	%rax, 152(%rsp)
+	xorl	%eax, %eax
+	.loc 1 121 5 is_stmt 1 view .LVU153
+	.loc 1 121 8 is_stmt 0 view .LVU154
+	testq	%rsi, %rsi
+	je	.L45
+	movq	%rsi, %rbx
+	.loc 1 122 9 is_stmt 1 view .LVU155
+	.loc 1 122 14 view .LVU156
+	.loc 1 122 17 is_stmt 0 view .LVU157
+	cmpl	$0, log_level(%rip)
+	jg	.L62
+.LVL68:
+.L46:
+	.loc 1 125 12 is_stmt 1 view .LVU158
+	.loc 1 128 5 view .LVU159
+	.loc 1 132 5 view .LVU160
+	.loc 1 132 9 is_stmt 0 view .LVU161
+	movl	$4, %edx
+	leaq	.LC13(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strncmp@PLT
+.LVL69:
+	movl	%eax, %edx
+	.loc 1 134 15 view .LVU162
+	movl	$0, %eax
+	.loc 1 132 8 view .LVU163
+	testl	%edx, %edx
+	je	.L63
+.LVL70:
+.L44:
+	.loc 1 181 1 view .LVU164
+	movq	152(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L64
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL71:
+	.loc 1 181 1 view .LVU165
+	ret
+.LVL72:
+.L62:
+	.cfi_restore_state
+	.loc 1 122 50 is_stmt 1 discriminator 1 view .LVU166
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	leaq	.LC8(%rip), %rdi
+.LVL73:
+	.loc 1 122 50 is_stmt 0 discriminator 1 view .LVU167
+	call	log_verbose@PLT
+.LVL74:
+	jmp	.L46
+.LVL75:
+.L45:
+	.loc 1 125 9 is_stmt 1 view .LVU168
+	.loc 1 125 14 view .LVU169
+	.loc 1 125 17 is_stmt 0 view .LVU170
+	cmpl	$0, log_level(%rip)
+	jg	.L65
+.LVL76:
+.L47:
+	.loc 1 125 12 is_stmt 1 view .LVU171
+	.loc 1 128 5 view .LVU172
+	.loc 1 130 15 is_stmt 0 view .LVU173
+	movl	$0, %eax
+	jmp	.L44
+.LVL77:
+.L65:
+	.loc 1 125 50 is_stmt 1 discriminator 1 view .LVU174
+	movl	$0, %edx
+	movq	%rdi, %rsi
+.LVL78:
+	.loc 1 125 50 is_stmt 0 discriminator 1 view .LVU175
+	leaq	.LC9(%rip), %rdi
+.LVL79:
+	.loc 1 125 50 discriminator 1 view .LVU176
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL80:
+	jmp	.L47
+.LVL81:
+.L63:
+	.loc 1 137 5 is_stmt 1 view .LVU177
+	.loc 1 137 23 is_stmt 0 view .LVU178
+	leaq	4(%rbx), %rbp
+.LVL82:
+	.loc 1 138 5 is_stmt 1 view .LVU179
+.LBB8:
+.LBI8:
+	.loc 2 41 1 view .LVU180
+.LBB9:
+	.loc 2 43 3 view .LVU181
+	.loc 2 46 3 view .LVU182
+	.loc 2 48 7 view .LVU183
+	.loc 2 53 7 view .LVU184
+	.loc 2 53 14 is_stmt 0 view .LVU185
+	movl	$589824, %esi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL83:
+	movl	%eax, %r12d
+.LVL84:
+	.loc 2 53 14 view .LVU186
+.LBE9:
+.LBE8:
+	.loc 1 139 5 is_stmt 1 view .LVU187
+	.loc 1 139 8 is_stmt 0 view .LVU188
+	cmpl	$-1, %eax
+	je	.L66
+	.loc 1 145 5 is_stmt 1 view .LVU189
+	.loc 1 145 28 is_stmt 0 view .LVU190
+	movl	$56, %edi
+	call	malloc@PLT
+.LVL85:
+	.loc 1 145 28 view .LVU191
+	movq	%rax, %rbp
+.LVL86:
+	.loc 1 146 5 is_stmt 1 view .LVU192
+	.loc 1 146 8 is_stmt 0 view .LVU193
+	testq	%rax, %rax
+	je	.L67
+	.loc 1 150 5 is_stmt 1 view .LVU194
+	.loc 1 150 23 is_stmt 0 view .LVU195
+	leaq	.LC10(%rip), %rsi
+	movl	%r12d, %edi
+	call	pwm_open_attr
+.LVL87:
+	.loc 1 150 21 view .LVU196
+	movl	%eax, 0(%rbp)
+	.loc 1 151 5 is_stmt 1 view .LVU197
+	.loc 1 151 27 is_stmt 0 view .LVU198
+	leaq	.LC11(%rip), %rsi
+	movl	%r12d, %edi
+	call	pwm_open_attr
+.LVL88:
+	.loc 1 151 25 view .LVU199
+	movl	%eax, 12(%rbp)
+	.loc 1 152 5 is_stmt 1 view .LVU200
+	.loc 1 152 23 is_stmt 0 view .LVU201
+	leaq	.LC12(%rip), %rsi
+	movl	%r12d, %edi
+	call	pwm_open_attr
+.LVL89:
+	.loc 1 152 21 view .LVU202
+	movl	%eax, 24(%rbp)
+	.loc 1 153 5 is_stmt 1 view .LVU203
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL90:
+	.loc 1 155 5 view .LVU204
+	.loc 1 156 5 view .LVU205
+	.loc 1 156 22 is_stmt 0 view .LVU206
+	movl	0(%rbp), %edi
+	.loc 1 156 8 view .LVU207
+	cmpl	$-1, %edi
+	je	.L51
+	.loc 1 156 33 discriminator 1 view .LVU208
+	cmpl	$-1, 12(%rbp)
+	je	.L52
+	.loc 1 157 25 view .LVU209
+	movl	24(%rbp), %eax
+	.loc 1 157 9 view .LVU210
+	cmpl	$-1, %eax
+	je	.L52
+	.loc 1 157 46 discriminator 1 view .LVU211
+	movq	%rsp, %rsi
+	movl	%eax, %edi
+	call	fstat@PLT
+.LVL91:
+	.loc 1 157 36 discriminator 1 view .LVU212
+	cmpl	$-1, %eax
+	je	.L68
+	.loc 1 164 5 is_stmt 1 view .LVU213
+	.loc 1 164 26 is_stmt 0 view .LVU214
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 164 37 view .LVU215
+	cmpl	$32768, %eax
+	.loc 1 164 22 view .LVU216
+	sete	36(%rbp)
+	.loc 1 165 5 is_stmt 1 view .LVU217
+	.loc 1 165 24 is_stmt 0 view .LVU218
+	movb	$0, 4(%rbp)
+	.loc 1 166 5 is_stmt 1 view .LVU219
+	.loc 1 166 28 is_stmt 0 view .LVU220
+	movb	$0, 16(%rbp)
+	.loc 1 167 5 is_stmt 1 view .LVU221
+	.loc 1 167 24 is_stmt 0 view .LVU222
+	movb	$0, 28(%rbp)
+	.loc 1 168 5 is_stmt 1 view .LVU223
+	.loc 1 168 18 is_stmt 0 view .LVU224
+	movq	$0, 40(%rbp)
+	.loc 1 169 5 is_stmt 1 view .LVU225
+	.loc 1 169 17 is_stmt 0 view .LVU226
+	movq	$0, 48(%rbp)
+	.loc 1 174 5 is_stmt 1 view .LVU227
+	leaq	24(%rbp), %rsi
+	movl	$0, %edx
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL92:
+	.loc 1 175 5 view .LVU228
+	leaq	12(%rbp), %rsi
+	movl	$0, %edx
+	movq	%rbp, %rdi
+	call	pwm_write_attr
+.LVL93:
+	.loc 1 177 5 view .LVU229
+	.loc 1 177 23 is_stmt 0 view .LVU230
+	movl	24(%rbp), %eax
+	movl	%eax, 88(%r13)
+	.loc 1 178 5 is_stmt 1 view .LVU231
+	.loc 1 178 25 is_stmt 0 view .LVU232
+	movq	%rbx, 96(%r13)
+	.loc 1 179 5 is_stmt 1 view .LVU233
+	.loc 1 179 25 is_stmt 0 view .LVU234
+	movq	%rbp, 104(%r13)
+	.loc 1 180 5 is_stmt 1 view .LVU235
+	.loc 1 180 11 is_stmt 0 view .LVU236
+	movl	$1, %eax
+	jmp	.L44
+.LVL94:
+.L66:
+	.loc 1 140 9 is_stmt 1 view .LVU237
+	.loc 1 140 14 view .LVU238
+	.loc 1 142 15 is_stmt 0 view .LVU239
+	movl	$0, %eax
+.LVL95:
+	.loc 1 140 17 view .LVU240
+	cmpl	$0, log_level(%rip)
+	jle	.L44
+	.loc 1 140 50 is_stmt 1 discriminator 1 view .LVU241
+	.loc 1 140 10 is_stmt 0 discriminator 1 view .LVU242
+	call	__errno_location@PLT
+.LVL96:
+	.loc 1 140 50 discriminator 1 view .LVU243
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL97:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL98:
+	.loc 1 142 15 discriminator 1 view .LVU244
+	movl	$0, %eax
+	jmp	.L44
+.LVL99:
+.L67:
+	.loc 1 147 9 is_stmt 1 view .LVU245
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL100:
+	.loc 1 148 9 view .LVU246
+	.loc 1 148 15 is_stmt 0 view .LVU247
+	movl	$0, %eax
+	jmp	.L44
+.L68:
+	.loc 1 158 9 is_stmt 1 view .LVU248
+	.loc 1 158 25 is_stmt 0 view .LVU249
+	movl	0(%rbp), %edi
+	.loc 1 158 12 view .LVU250
+	cmpl	$-1, %edi
+	je	.L51
+.L52:
+	.loc 1 158 36 is_stmt 1 discriminator 1 view .LVU251
+	call	close@PLT
+.LVL101:
+.L51:
+	.loc 1 159 9 view .LVU252
+	.loc 1 159 29 is_stmt 0 view .LVU253
+	movl	12(%rbp), %edi
+	.loc 1 159 12 view .LVU254
+	cmpl	$-1, %edi
+	jne	.L69
+.L54:
+	.loc 1 160 9 is_stmt 1 view .LVU255
+	.loc 1 160 25 is_stmt 0 view .LVU256
+	movl	24(%rbp), %edi
+	.loc 1 160 12 view .LVU257
+	cmpl	$-1, %edi
+	jne	.L70
+.L55:
+	.loc 1 161 9 is_stmt 1 view .LVU258
+	movq	%rbp, %rdi
+	call	free@PLT
+.LVL102:
+	.loc 1 162 9 view .LVU259
+	.loc 1 162 15 is_stmt 0 view .LVU260
+	movl	$0, %eax
+	jmp	.L44
+.L69:
+	.loc 1 159 40 is_stmt 1 discriminator 1 view .LVU261
+	call	close@PLT
+.LVL103:
+	jmp	.L54
+.L70:
+	.loc 1 160 36 discriminator 1 view .LVU262
+	call	close@PLT
+.LVL104:
+	jmp	.L55
+.LVL105:
+.L64:
+	.loc 1 181 1 is_stmt 0 view .LVU263
+	call	__stack_chk_fail@PLT
+.LVL106:
+	.cfi_endproc
+.LFE45:
+	.size	driver_detect, .-driver_detect
+	.globl	pwm_driver
+	.section	.rodata.str1.1
+.LC14:
+	.string	"pwm"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	pwm_driver, @object
+	.size	pwm_driver, 112
+pwm_driver:
+	.quad	.LC14
+	.quad	0
+	.quad	driver_detect
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.long	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 10 "beep-driver.h"
+	.file 11 "beep-driver-pwm.h"
+	.file 12 "beep-log.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 14 "/usr/include/stdlib.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "/usr/include/unistd.h"
+	.file 17 "beep-library.h"
+	.file 18 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1034
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF131
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x7
+	.long	0x35
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x4d
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x7
+	.long	0x6e
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x91
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x92
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x93
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x94
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x96
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x97
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x4
+	.byte	0xaf
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x4
+	.byte	0xb4
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	0x13c
+	.uleb128 0x7
+	.long	0x132
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF25
+	.uleb128 0x7
+	.long	0x13c
+	.uleb128 0x4
+	.long	.LASF26
+	.byte	0x4
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x55
+	.byte	0x11
+	.long	0xe8
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0x11a
+	.uleb128 0x16
+	.long	.LASF32
+	.byte	0x10
+	.byte	0x6
+	.byte	0xb
+	.long	0x193
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x10
+	.byte	0xc
+	.long	0xf4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x15
+	.byte	0x15
+	.long	0x126
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF31
+	.uleb128 0x6
+	.long	0x1a4
+	.uleb128 0x7
+	.long	0x19a
+	.uleb128 0x25
+	.uleb128 0x16
+	.long	.LASF33
+	.byte	0x90
+	.byte	0x7
+	.byte	0x1a
+	.long	0x275
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xd
+	.long	0xa0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0xc4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xf
+	.long	0xdc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd0
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xd
+	.long	0xac
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x7
+	.byte	0x30
+	.byte	0xd
+	.long	0xb8
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x32
+	.byte	0x9
+	.long	0x4d
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x34
+	.byte	0xd
+	.long	0xa0
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x39
+	.byte	0xd
+	.long	0xe8
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x11
+	.long	0x102
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x10
+	.long	0x10e
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x4a
+	.byte	0x15
+	.long	0x16c
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x15
+	.long	0x16c
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x15
+	.long	0x16c
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x7
+	.byte	0x59
+	.byte	0x17
+	.long	0x275
+	.byte	0x78
+	.byte	0
+	.uleb128 0x18
+	.long	0x126
+	.long	0x285
+	.uleb128 0x19
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0x143
+	.uleb128 0x7
+	.long	0x285
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x8
+	.byte	0x18
+	.long	0x148
+	.uleb128 0x7
+	.long	0x28f
+	.uleb128 0x26
+	.long	0x29b
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x19
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x7
+	.long	0x2a5
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x7
+	.long	0x2b6
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x2d3
+	.uleb128 0x16
+	.long	.LASF53
+	.byte	0x70
+	.byte	0xa
+	.byte	0x43
+	.long	0x396
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0xa
+	.byte	0x44
+	.byte	0xb
+	.long	0x132
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0xa
+	.byte	0x45
+	.byte	0x12
+	.long	0x410
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x47
+	.byte	0x1d
+	.long	0x3e4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x48
+	.byte	0x1b
+	.long	0x43a
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x49
+	.byte	0x1b
+	.long	0x456
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF59
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x21
+	.long	0x462
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x483
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x52
+	.byte	0x1b
+	.long	0x48f
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x59
+	.byte	0x24
+	.long	0x4b0
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x61
+	.byte	0x1c
+	.long	0x415
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x62
+	.byte	0x18
+	.long	0x4ef
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x68
+	.byte	0x11
+	.long	0x285
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xb
+	.long	0x100
+	.byte	0x68
+	.byte	0
+	.uleb128 0x17
+	.byte	0x10
+	.byte	0xa
+	.byte	0x22
+	.long	0x3d3
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x23
+	.byte	0xe
+	.long	0x2b6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x24
+	.byte	0xe
+	.long	0x2b6
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF70
+	.byte	0xa
+	.byte	0x25
+	.byte	0xe
+	.long	0x2b6
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x26
+	.byte	0xe
+	.long	0x2b6
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xa
+	.byte	0x27
+	.byte	0x3
+	.long	0x396
+	.uleb128 0x7
+	.long	0x3d3
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xa
+	.byte	0x32
+	.byte	0xf
+	.long	0x3f0
+	.uleb128 0x6
+	.long	0x3f5
+	.uleb128 0x1a
+	.long	0x409
+	.long	0x409
+	.uleb128 0x2
+	.long	0x410
+	.uleb128 0x2
+	.long	0x285
+	.byte	0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF74
+	.uleb128 0x6
+	.long	0x2c7
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0xa
+	.byte	0x34
+	.byte	0xf
+	.long	0x421
+	.uleb128 0x6
+	.long	0x426
+	.uleb128 0x1a
+	.long	0x409
+	.long	0x43a
+	.uleb128 0x2
+	.long	0x410
+	.uleb128 0x2
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xa
+	.byte	0x36
+	.byte	0x10
+	.long	0x446
+	.uleb128 0x6
+	.long	0x44b
+	.uleb128 0x12
+	.long	0x456
+	.uleb128 0x2
+	.long	0x410
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xa
+	.byte	0x37
+	.byte	0x10
+	.long	0x446
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xa
+	.byte	0x38
+	.byte	0x10
+	.long	0x46e
+	.uleb128 0x6
+	.long	0x473
+	.uleb128 0x12
+	.long	0x483
+	.uleb128 0x2
+	.long	0x410
+	.uleb128 0x2
+	.long	0x2b1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x10
+	.long	0x446
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x10
+	.long	0x49b
+	.uleb128 0x6
+	.long	0x4a0
+	.uleb128 0x12
+	.long	0x4b0
+	.uleb128 0x2
+	.long	0x410
+	.uleb128 0x2
+	.long	0x75
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x10
+	.long	0x4bc
+	.uleb128 0x6
+	.long	0x4c1
+	.uleb128 0x12
+	.long	0x4db
+	.uleb128 0x2
+	.long	0x410
+	.uleb128 0x2
+	.long	0x4e0
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x4ea
+	.byte	0
+	.uleb128 0x6
+	.long	0x3df
+	.uleb128 0x7
+	.long	0x4db
+	.uleb128 0x6
+	.long	0x2a0
+	.uleb128 0x7
+	.long	0x4e5
+	.uleb128 0x6
+	.long	0x28a
+	.uleb128 0x1b
+	.long	.LASF82
+	.byte	0xb
+	.byte	0x21
+	.byte	0x14
+	.long	0x2c7
+	.uleb128 0x1b
+	.long	.LASF83
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x17
+	.byte	0xc
+	.byte	0x1
+	.byte	0x37
+	.long	0x53b
+	.uleb128 0x27
+	.string	"fd"
+	.byte	0x1
+	.byte	0x38
+	.byte	0x9
+	.long	0x4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF84
+	.byte	0x1
+	.byte	0x39
+	.byte	0xd
+	.long	0x409
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF85
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xe
+	.long	0x2b6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x1
+	.byte	0x3b
+	.byte	0x3
+	.long	0x50c
+	.uleb128 0x17
+	.byte	0x38
+	.byte	0x1
+	.byte	0x3e
+	.long	0x59e
+	.uleb128 0x3
+	.long	.LASF87
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xe
+	.long	0x53b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF88
+	.byte	0x1
+	.byte	0x40
+	.byte	0xe
+	.long	0x53b
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF89
+	.byte	0x1
+	.byte	0x41
+	.byte	0xe
+	.long	0x53b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF90
+	.byte	0x1
+	.byte	0x42
+	.byte	0x12
+	.long	0x409
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x43
+	.byte	0x13
+	.long	0x46
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x44
+	.byte	0x13
+	.long	0x46
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF93
+	.byte	0x1
+	.byte	0x45
+	.byte	0x3
+	.long	0x547
+	.uleb128 0x28
+	.long	0x4f4
+	.byte	0x1
+	.byte	0xfa
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pwm_driver
+	.uleb128 0x1c
+	.long	.LASF96
+	.byte	0x64
+	.long	.LASF98
+	.long	0x4d
+	.long	0x5df
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF100
+	.byte	0x2
+	.byte	0x62
+	.long	0x4d
+	.long	0x5fe
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF94
+	.byte	0x71
+	.uleb128 0x14
+	.long	.LASF95
+	.byte	0x6f
+	.uleb128 0x1c
+	.long	.LASF97
+	.byte	0x1b
+	.long	.LASF99
+	.long	0x4d
+	.long	0x628
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF101
+	.byte	0x2
+	.byte	0x1a
+	.long	0x4d
+	.long	0x642
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF102
+	.byte	0x25
+	.uleb128 0x14
+	.long	.LASF103
+	.byte	0x23
+	.uleb128 0x13
+	.long	.LASF104
+	.byte	0xd
+	.byte	0xd2
+	.long	0x4d
+	.long	0x668
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x668
+	.byte	0
+	.uleb128 0x6
+	.long	0x1a5
+	.uleb128 0xe
+	.long	.LASF105
+	.byte	0xe
+	.value	0x229
+	.byte	0xe
+	.long	0x100
+	.long	0x684
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF106
+	.byte	0xf
+	.value	0x1a3
+	.byte	0xe
+	.long	0x132
+	.long	0x69b
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF132
+	.byte	0x12
+	.byte	0x25
+	.byte	0xd
+	.long	0x6a7
+	.uleb128 0x6
+	.long	0x4d
+	.uleb128 0x13
+	.long	.LASF107
+	.byte	0xf
+	.byte	0x9f
+	.long	0x4d
+	.long	0x6cb
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF109
+	.byte	0xe
+	.value	0x238
+	.byte	0xd
+	.long	0x6de
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF108
+	.byte	0x10
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0x6f5
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF110
+	.byte	0x43
+	.long	0x706
+	.uleb128 0x2
+	.long	0x28a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF111
+	.byte	0x10
+	.value	0x419
+	.byte	0xc
+	.long	0x4d
+	.long	0x722
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xe8
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF112
+	.byte	0x11
+	.byte	0x47
+	.byte	0x6
+	.long	0x734
+	.uleb128 0x2
+	.long	0x28a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF113
+	.byte	0x10
+	.value	0x18e
+	.byte	0x10
+	.long	0x160
+	.long	0x75a
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x19a
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0xe8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF114
+	.byte	0x58
+	.long	0x779
+	.uleb128 0x2
+	.long	0x28a
+	.uleb128 0x2
+	.long	0x19f
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x75
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF116
+	.byte	0xf1
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7fe
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0xf1
+	.byte	0x23
+	.long	0x410
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xb
+	.long	.LASF115
+	.byte	0xf4
+	.byte	0x15
+	.long	0x803
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x5
+	.quad	.LVL18
+	.long	0xe95
+	.long	0x7d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL21
+	.long	0x75a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x59e
+	.uleb128 0x7
+	.long	0x7fe
+	.uleb128 0xf
+	.long	.LASF117
+	.byte	0xd4
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x980
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0xd4
+	.byte	0x25
+	.long	0x410
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x9
+	.long	.LASF68
+	.byte	0xd4
+	.byte	0x3c
+	.long	0x2b1
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xb
+	.long	.LASF115
+	.byte	0xd7
+	.byte	0x15
+	.long	0x803
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xb
+	.long	.LASF87
+	.byte	0xdf
+	.byte	0x14
+	.long	0x2c2
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0xe0
+	.byte	0x14
+	.long	0x2c2
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x5
+	.quad	.LVL28
+	.long	0xe95
+	.long	0x8a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL29
+	.long	0xe95
+	.long	0x8cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL30
+	.long	0xe95
+	.long	0x8ee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL35
+	.long	0x75a
+	.long	0x923
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL37
+	.long	0x779
+	.long	0x93b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL39
+	.long	0xe95
+	.long	0x95f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL40
+	.long	0xe95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF119
+	.byte	0xc0
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa37
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0xc0
+	.byte	0x1f
+	.long	0x410
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.long	.LASF115
+	.byte	0xc3
+	.byte	0x15
+	.long	0x803
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x8
+	.quad	.LVL46
+	.long	0x6de
+	.uleb128 0x8
+	.quad	.LVL47
+	.long	0x6de
+	.uleb128 0x8
+	.quad	.LVL48
+	.long	0x6de
+	.uleb128 0x8
+	.quad	.LVL49
+	.long	0x6cb
+	.uleb128 0x5
+	.quad	.LVL53
+	.long	0x6f5
+	.long	0xa1b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL55
+	.long	0x6f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF120
+	.byte	0xb9
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa89
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0xb9
+	.byte	0x1f
+	.long	0x410
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xc
+	.quad	.LVL43
+	.long	0x6f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF124
+	.byte	0x77
+	.long	0x409
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd91
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0x77
+	.byte	0x20
+	.long	0x410
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x9
+	.long	.LASF121
+	.byte	0x77
+	.byte	0x34
+	.long	0x285
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xb
+	.long	.LASF122
+	.byte	0x89
+	.byte	0x17
+	.long	0x28a
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xb
+	.long	.LASF123
+	.byte	0x8a
+	.byte	0xf
+	.long	0x54
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xb
+	.long	.LASF115
+	.byte	0x91
+	.byte	0x15
+	.long	0x803
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1f
+	.string	"sb"
+	.byte	0x9b
+	.byte	0x11
+	.long	0x1a5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x20
+	.long	0x1008
+	.quad	.LBI8
+	.byte	.LVU180
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.byte	0x8a
+	.byte	0x18
+	.long	0xb70
+	.uleb128 0x10
+	.long	0x1021
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x10
+	.long	0x1016
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xc
+	.quad	.LVL83
+	.long	0x60a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x42
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL69
+	.long	0x6ac
+	.long	0xb9a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL74
+	.long	0x6f5
+	.long	0xbc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL80
+	.long	0x6f5
+	.long	0xbef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL85
+	.long	0x66d
+	.long	0xc07
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL87
+	.long	0xd91
+	.long	0xc2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL88
+	.long	0xd91
+	.long	0xc51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL89
+	.long	0xd91
+	.long	0xc76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL90
+	.long	0x6de
+	.long	0xc8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL91
+	.long	0x64e
+	.long	0xca7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL92
+	.long	0xe95
+	.long	0xcca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL93
+	.long	0xe95
+	.long	0xced
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL96
+	.long	0x69b
+	.uleb128 0x8
+	.quad	.LVL97
+	.long	0x684
+	.uleb128 0x5
+	.quad	.LVL98
+	.long	0x6f5
+	.long	0xd2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL100
+	.long	0x6de
+	.long	0xd44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL101
+	.long	0x6de
+	.uleb128 0x5
+	.quad	.LVL102
+	.long	0x6cb
+	.long	0xd69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL103
+	.long	0x6de
+	.uleb128 0x8
+	.quad	.LVL104
+	.long	0x6de
+	.uleb128 0x8
+	.quad	.LVL106
+	.long	0x102e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF125
+	.byte	0x6c
+	.long	0x4d
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe95
+	.uleb128 0x9
+	.long	.LASF123
+	.byte	0x6c
+	.byte	0x1d
+	.long	0x54
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x9
+	.long	.LASF54
+	.byte	0x6c
+	.byte	0x37
+	.long	0x28a
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x15
+	.string	"fd"
+	.byte	0x6e
+	.byte	0xf
+	.long	0x54
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x20
+	.long	0xfd7
+	.quad	.LBI6
+	.byte	.LVU128
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.byte	0x6e
+	.byte	0x14
+	.long	0xe59
+	.uleb128 0x10
+	.long	0xffb
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.long	0xff0
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x10
+	.long	0xfe5
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xc
+	.quad	.LVL58
+	.long	0x5bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x80001
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL64
+	.long	0x69b
+	.uleb128 0x8
+	.quad	.LVL65
+	.long	0x684
+	.uleb128 0xc
+	.quad	.LVL66
+	.long	0x6f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF126
+	.byte	0x49
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfbd
+	.uleb128 0x9
+	.long	.LASF115
+	.byte	0x49
+	.byte	0x25
+	.long	0x803
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x9
+	.long	.LASF127
+	.byte	0x49
+	.byte	0x3b
+	.long	0xfc2
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.long	.LASF85
+	.byte	0x4a
+	.byte	0x24
+	.long	0x2c2
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1f
+	.string	"buf"
+	.byte	0x51
+	.byte	0xa
+	.long	0xfc7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2c
+	.string	"end"
+	.byte	0x1
+	.byte	0x52
+	.byte	0x11
+	.long	0x137
+	.uleb128 0x15
+	.string	"str"
+	.byte	0x53
+	.byte	0xb
+	.long	0x132
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x15
+	.string	"v"
+	.byte	0x54
+	.byte	0xe
+	.long	0x2b6
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x15
+	.string	"len"
+	.byte	0x59
+	.byte	0x12
+	.long	0x41
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x5
+	.quad	.LVL5
+	.long	0x734
+	.long	0xf59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL11
+	.long	0x722
+	.long	0xf78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL12
+	.long	0x706
+	.long	0xf90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL13
+	.long	0x722
+	.long	0xfaf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL14
+	.long	0x102e
+	.byte	0
+	.uleb128 0x6
+	.long	0x53b
+	.uleb128 0x7
+	.long	0xfbd
+	.uleb128 0x18
+	.long	0x13c
+	.long	0xfd7
+	.uleb128 0x19
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF98
+	.byte	0x75
+	.long	0x4d
+	.long	0x1008
+	.uleb128 0x11
+	.long	.LASF128
+	.byte	0x75
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x11
+	.long	.LASF129
+	.byte	0x75
+	.byte	0x1f
+	.long	0x285
+	.uleb128 0x11
+	.long	.LASF130
+	.byte	0x75
+	.byte	0x2b
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF99
+	.byte	0x29
+	.long	0x4d
+	.long	0x102e
+	.uleb128 0x11
+	.long	.LASF129
+	.byte	0x29
+	.byte	0x13
+	.long	0x285
+	.uleb128 0x11
+	.long	.LASF130
+	.byte	0x29
+	.byte	0x1f
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF133
+	.long	.LASF133
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU59
+	.uleb128 .LVU76
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU67
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU70
+	.uleb128 .LVU75
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU103
+	.uleb128 .LVU116
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU179
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU263
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU186
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU263
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU192
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU237
+	.uleb128 .LVU245
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU263
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU180
+	.uleb128 .LVU186
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x4
+	.byte	0x42
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU180
+	.uleb128 .LVU186
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU135
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU128
+	.uleb128 .LVU135
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80001
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU128
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU128
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 .LVU19
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU7
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU19
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU17
+	.uleb128 .LVU27
+	.uleb128 .LVU31
+	.uleb128 .LVU36
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF19:
+	.string	"__off_t"
+.LASF15:
+	.string	"__gid_t"
+.LASF105:
+	.string	"malloc"
+.LASF114:
+	.string	"log_deferred"
+.LASF47:
+	.string	"st_ctim"
+.LASF90:
+	.string	"is_regular"
+.LASF10:
+	.string	"size_t"
+.LASF55:
+	.string	"next"
+.LASF78:
+	.string	"beep_driver_begin_tone_func"
+.LASF113:
+	.string	"pwrite"
+.LASF28:
+	.string	"ssize_t"
+.LASF92:
+	.string	"tones"
+.LASF77:
+	.string	"beep_driver_fini_func"
+.LASF93:
+	.string	"pwm_data"
+.LASF83:
+	.string	"log_level"
+.LASF67:
+	.string	"driver_data"
+.LASF31:
+	.string	"long long unsigned int"
+.LASF115:
+	.string	"data"
+.LASF117:
+	.string	"driver_begin_tone"
+.LASF57:
+	.string	"init"
+.LASF103:
+	.string	"__open_too_many_args"
+.LASF109:
+	.string	"free"
+.LASF131:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF33:
+	.string	"stat"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF68:
+	.string	"freq"
+.LASF130:
+	.string	"__oflag"
+.LASF35:
+	.string	"st_ino"
+.LASF17:
+	.string	"__mode_t"
+.LASF124:
+	.string	"driver_detect"
+.LASF120:
+	.string	"driver_init"
+.LASF79:
+	.string	"beep_driver_end_tone_func"
+.LASF61:
+	.string	"wait"
+.LASF82:
+	.string	"pwm_driver"
+.LASF22:
+	.string	"__blkcnt_t"
+.LASF2:
+	.string	"long int"
+.LASF52:
+	.string	"beep_driver"
+.LASF23:
+	.string	"__ssize_t"
+.LASF116:
+	.string	"driver_end_tone"
+.LASF89:
+	.string	"enable"
+.LASF45:
+	.string	"st_atim"
+.LASF112:
+	.string	"safe_error_exit"
+.LASF66:
+	.string	"device_name"
+.LASF108:
+	.string	"close"
+.LASF27:
+	.string	"off_t"
+.LASF12:
+	.string	"__uint32_t"
+.LASF44:
+	.string	"st_blocks"
+.LASF38:
+	.string	"st_uid"
+.LASF85:
+	.string	"value"
+.LASF127:
+	.string	"attr"
+.LASF63:
+	.string	"probe"
+.LASF7:
+	.string	"unsigned int"
+.LASF50:
+	.string	"uint16_t"
+.LASF73:
+	.string	"beep_driver_detect_func"
+.LASF102:
+	.string	"__open_missing_mode"
+.LASF3:
+	.string	"long unsigned int"
+.LASF80:
+	.string	"beep_driver_wait_func"
+.LASF56:
+	.string	"detect"
+.LASF54:
+	.string	"name"
+.LASF65:
+	.string	"device_fd"
+.LASF59:
+	.string	"begin_tone"
+.LASF6:
+	.string	"short unsigned int"
+.LASF84:
+	.string	"known"
+.LASF18:
+	.string	"__nlink_t"
+.LASF91:
+	.string	"writes"
+.LASF81:
+	.string	"beep_driver_play_sequence_func"
+.LASF128:
+	.string	"__fd"
+.LASF42:
+	.string	"st_size"
+.LASF101:
+	.string	"__open_2"
+.LASF37:
+	.string	"st_mode"
+.LASF72:
+	.string	"beep_tone"
+.LASF107:
+	.string	"strncmp"
+.LASF30:
+	.string	"tv_nsec"
+.LASF99:
+	.string	"open"
+.LASF13:
+	.string	"__dev_t"
+.LASF88:
+	.string	"duty_cycle"
+.LASF24:
+	.string	"__syscall_slong_t"
+.LASF53:
+	.string	"_beep_driver"
+.LASF123:
+	.string	"dir_fd"
+.LASF21:
+	.string	"__blksize_t"
+.LASF64:
+	.string	"default_devices"
+.LASF110:
+	.string	"log_verbose"
+.LASF49:
+	.string	"sig_atomic_t"
+.LASF98:
+	.string	"openat"
+.LASF86:
+	.string	"pwm_attr"
+.LASF40:
+	.string	"__pad0"
+.LASF29:
+	.string	"tv_sec"
+.LASF48:
+	.string	"__glibc_reserved"
+.LASF76:
+	.string	"beep_driver_init_func"
+.LASF74:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF70:
+	.string	"delay"
+.LASF9:
+	.string	"short int"
+.LASF126:
+	.string	"pwm_write_attr"
+.LASF111:
+	.string	"ftruncate"
+.LASF43:
+	.string	"st_blksize"
+.LASF122:
+	.string	"dir_name"
+.LASF32:
+	.string	"timespec"
+.LASF94:
+	.string	"__openat_missing_mode"
+.LASF125:
+	.string	"pwm_open_attr"
+.LASF133:
+	.string	"__stack_chk_fail"
+.LASF129:
+	.string	"__path"
+.LASF16:
+	.string	"__ino_t"
+.LASF36:
+	.string	"st_nlink"
+.LASF41:
+	.string	"st_rdev"
+.LASF121:
+	.string	"console_device"
+.LASF69:
+	.string	"length"
+.LASF25:
+	.string	"char"
+.LASF11:
+	.string	"__uint16_t"
+.LASF132:
+	.string	"__errno_location"
+.LASF100:
+	.string	"__openat_2"
+.LASF87:
+	.string	"period"
+.LASF14:
+	.string	"__uid_t"
+.LASF75:
+	.string	"beep_driver_probe_func"
+.LASF119:
+	.string	"driver_fini"
+.LASF39:
+	.string	"st_gid"
+.LASF95:
+	.string	"__openat_too_many_args"
+.LASF20:
+	.string	"__time_t"
+.LASF51:
+	.string	"uint32_t"
+.LASF34:
+	.string	"st_dev"
+.LASF62:
+	.string	"play_sequence"
+.LASF97:
+	.string	"__open_alias"
+.LASF71:
+	.string	"flags"
+.LASF46:
+	.string	"st_mtim"
+.LASF104:
+	.string	"fstat"
+.LASF118:
+	.string	"driver"
+.LASF58:
+	.string	"fini"
+.LASF96:
+	.string	"__openat_alias"
+.LASF106:
+	.string	"strerror"
+.LASF26:
+	.string	"__sig_atomic_t"
+.LASF60:
+	.string	"end_tone"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-pwm.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
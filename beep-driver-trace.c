@@ -0,0 +1,186 @@
+/* beep-driver-trace.c - implement the beep trace driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* The trace driver does not make any noise.  It appends one
+ * beep_trace_record per tone edge to a file, which allows measuring
+ * the timing accuracy of beep without any sound hardware.
+ *
+ * To keep the file I/O away from the tone edges, the records are
+ * collected in a preallocated buffer and only written out when the
+ * buffer is full and at driver_fini() time.
+ */
+
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "beep-driver-trace.h"
+
+#include "beep-library.h"
+#include "beep-log.h"
+
+
+/* 4096 records are 64KiB, i.e. 2048 tones before the first write(2) */
+#define TRACE_BUFFER_RECORDS 4096
+
+
+typedef struct {
+    size_t            count;
+    beep_trace_record records[TRACE_BUFFER_RECORDS];
+} trace_data;
+
+
+static
+void trace_flush(beep_driver *driver)
+{
+    trace_data *const data = driver->driver_data;
+    if (-1 == write_all(driver->device_fd, data->records,
+                        data->count * sizeof(beep_trace_record))) {
+        safe_error_exit("write trace");
+    }
+    data->count = 0;
+}
+
+
+static
+void trace_record(beep_driver *driver,
+                  const beep_trace_event_E event, const uint16_t freq)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    trace_data *const data = driver->driver_data;
+    beep_trace_record *const rec = &data->records[data->count];
+    rec->timestamp_ns = (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+    rec->event = event;
+    rec->freq = freq;
+
+    if (++data->count == TRACE_BUFFER_RECORDS) {
+        trace_flush(driver);
+    }
+}
+
+
+static
+bool driver_detect(beep_driver *driver, const char *console_device)
+{
+    if (console_device) {
+        log_verbose("trace driver_detect %p %s",
+                    (void *)driver, console_device);
+    } else {
+        log_verbose("trace driver_detect %p %p",
+                    (void *)driver, (const void *)console_device);
+    }
+    if (!console_device) {
+        /* Never pick the trace driver unless asked to */
+        return false;
+    }
+    if (strncmp(console_device, BEEP_TRACE_PREFIX,
+                strlen(BEEP_TRACE_PREFIX)) != 0) {
+        return false;
+    }
+
+    const char *const trace_name = console_device + strlen(BEEP_TRACE_PREFIX);
+    const int fd = open(trace_name, O_WRONLY|O_CREAT|O_APPEND|O_CLOEXEC, 0666);
+    if (fd == -1) {
+        log_verbose("trace: could not open(2) %s: %s",
+                    trace_name, strerror(errno));
+        return false;
+    }
+
+    trace_data *const data = malloc(sizeof(trace_data));
+    if (!data) {
+        close(fd);
+        return false;
+    }
+    data->count = 0;
+
+    driver->device_fd = fd;
+    driver->device_name = console_device;
+    driver->driver_data = data;
+    return true;
+}
+
+
+static
+void driver_init(beep_driver *driver)
+{
+    log_verbose("trace driver_init %p", (void *)driver);
+}
+
+
+static
+void driver_fini(beep_driver *driver)
+{
+    log_verbose("trace driver_fini %p", (void *)driver);
+    trace_flush(driver);
+    close(driver->device_fd);
+    driver->device_fd = -1;
+    free(driver->driver_data);
+    driver->driver_data = NULL;
+}
+
+
+static
+void driver_begin_tone(beep_driver *driver, const uint16_t freq)
+{
+    trace_record(driver, BEEP_TRACE_BEGIN_TONE, freq);
+    log_verbose_deferred_u("trace driver_begin_tone %p %u", (void *)driver, freq);
+}
+
+
+static
+void driver_end_tone(beep_driver *driver)
+{
+    trace_record(driver, BEEP_TRACE_END_TONE, 0);
+    log_verbose_deferred("trace driver_end_tone %p", (void *)driver);
+}
+
+
+beep_driver trace_driver =
+    {
+     "trace",
+     NULL,
+     driver_detect,
+     driver_init,
+     driver_fini,
+     driver_begin_tone,
+     driver_end_tone,
+     NULL,
+     NULL,
+     NULL,
+     NULL,
+     0,
+     NULL,
+     NULL
+    };
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,64 @@
+/* beep-driver-trace.h - interface to the beep trace driver
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_DRIVER_TRACE_H
+#define BEEP_DRIVER_TRACE_H
+
+
+#include <stdint.h>
+
+#include "beep-driver.h"
+
+
+/** Device name prefix selecting the trace driver, as in "trace:FILE". */
+#define BEEP_TRACE_PREFIX "trace:"
+
+
+/** Event types in a trace record */
+typedef enum
+    {
+     BEEP_TRACE_BEGIN_TONE = 1,
+     BEEP_TRACE_END_TONE   = 2,
+    } beep_trace_event_E;
+
+
+/** One trace record as written to the trace file.
+ *
+ * The records are written in host byte order, without any file
+ * header, so that a trace file is just an array of these.
+ */
+typedef struct {
+    uint64_t timestamp_ns; /* CLOCK_MONOTONIC in nanoseconds */
+    uint32_t event;        /* beep_trace_event_E */
+    uint32_t freq;         /* Hz for BEEP_TRACE_BEGIN_TONE, else 0 */
+} beep_trace_record;
+
+
+extern beep_driver trace_driver;
+
+
+#endif /* BEEP_DRIVER_TRACE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
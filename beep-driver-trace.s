@@ -0,0 +1,3469 @@
+	.file	"beep-driver-trace.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-driver-trace.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"write trace"
+	.text
+	.type	trace_flush, @function
+trace_flush:
+.LVL0:
+.LFB43:
+	.file 1 "beep-driver-trace.c"
+	.loc 1 57 1 view -0
+	.cfi_startproc
+	.loc 1 57 1 is_stmt 0 view .LVU1
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 58 5 is_stmt 1 view .LVU2
+	.loc 1 58 23 is_stmt 0 view .LVU3
+	movq	104(%rdi), %rbx
+.LVL1:
+	.loc 1 59 5 is_stmt 1 view .LVU4
+	.loc 1 59 15 is_stmt 0 view .LVU5
+	movq	(%rbx), %rdx
+	salq	$4, %rdx
+	.loc 1 59 48 view .LVU6
+	leaq	8(%rbx), %rsi
+	.loc 1 59 15 view .LVU7
+	movl	88(%rdi), %edi
+.LVL2:
+	.loc 1 59 15 view .LVU8
+	call	write_all@PLT
+.LVL3:
+	.loc 1 59 8 view .LVU9
+	cmpl	$-1, %eax
+	je	.L4
+	.loc 1 63 5 is_stmt 1 view .LVU10
+	.loc 1 63 17 is_stmt 0 view .LVU11
+	movq	$0, (%rbx)
+	.loc 1 64 1 view .LVU12
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL4:
+	.loc 1 64 1 view .LVU13
+	ret
+.LVL5:
+.L4:
+	.cfi_restore_state
+	.loc 1 61 9 is_stmt 1 view .LVU14
+	leaq	.LC0(%rip), %rdi
+	call	safe_error_exit@PLT
+.LVL6:
+	.cfi_endproc
+.LFE43:
+	.size	trace_flush, .-trace_flush
+	.type	trace_record, @function
+trace_record:
+.LVL7:
+.LFB44:
+	.loc 1 70 1 view -0
+	.cfi_startproc
+	.loc 1 70 1 is_stmt 0 view .LVU16
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbp
+	movl	%esi, %r12d
+	movl	%edx, %ebx
+	.loc 1 70 1 view .LVU17
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 71 5 is_stmt 1 view .LVU18
+	.loc 1 72 5 view .LVU19
+	movq	%rsp, %rsi
+.LVL8:
+	.loc 1 72 5 is_stmt 0 view .LVU20
+	movl	$1, %edi
+.LVL9:
+	.loc 1 72 5 view .LVU21
+	call	clock_gettime@PLT
+.LVL10:
+	.loc 1 74 5 is_stmt 1 view .LVU22
+	.loc 1 74 23 is_stmt 0 view .LVU23
+	movq	104(%rbp), %rcx
+.LVL11:
+	.loc 1 75 5 is_stmt 1 view .LVU24
+	.loc 1 75 55 is_stmt 0 view .LVU25
+	movq	(%rcx), %rax
+.LVL12:
+	.loc 1 76 5 is_stmt 1 view .LVU26
+	movq	%rax, %rdx
+	salq	$4, %rdx
+	addq	%rcx, %rdx
+	.loc 1 76 45 is_stmt 0 view .LVU27
+	imulq	$1000000000, (%rsp), %rsi
+	.loc 1 76 59 view .LVU28
+	addq	8(%rsp), %rsi
+	.loc 1 76 23 view .LVU29
+	movq	%rsi, 8(%rdx)
+	.loc 1 77 5 is_stmt 1 view .LVU30
+	.loc 1 77 16 is_stmt 0 view .LVU31
+	movl	%r12d, 16(%rdx)
+	.loc 1 78 5 is_stmt 1 view .LVU32
+	.loc 1 78 15 is_stmt 0 view .LVU33
+	movzwl	%bx, %ebx
+	movl	%ebx, 20(%rdx)
+	.loc 1 80 5 is_stmt 1 view .LVU34
+	.loc 1 80 9 is_stmt 0 view .LVU35
+	addq	$1, %rax
+.LVL13:
+	.loc 1 80 8 view .LVU36
+	movq	%rax, (%rcx)
+	cmpq	$4096, %rax
+	je	.L9
+.LVL14:
+.L5:
+	.loc 1 83 1 view .LVU37
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L10
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL15:
+	.loc 1 83 1 view .LVU38
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL16:
+	.loc 1 83 1 view .LVU39
+	ret
+.LVL17:
+.L9:
+	.cfi_restore_state
+	.loc 1 81 9 is_stmt 1 view .LVU40
+	movq	%rbp, %rdi
+	call	trace_flush
+.LVL18:
+	.loc 1 83 1 is_stmt 0 view .LVU41
+	jmp	.L5
+.L10:
+	.loc 1 83 1 view .LVU42
+	call	__stack_chk_fail@PLT
+.LVL19:
+	.cfi_endproc
+.LFE44:
+	.size	trace_record, .-trace_record
+	.section	.rodata.str1.1
+.LC1:
+	.string	"trace driver_end_tone %p"
+	.text
+	.type	driver_end_tone, @function
+driver_end_tone:
+.LVL20:
+.LFB49:
+	.loc 1 156 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 1 is_stmt 0 view .LVU44
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 157 5 is_stmt 1 view .LVU45
+	movl	$0, %edx
+	movl	$2, %esi
+	call	trace_record
+.LVL21:
+	.loc 1 158 5 view .LVU46
+	.loc 1 158 10 view .LVU47
+	.loc 1 158 92 view .LVU48
+	.loc 1 158 95 is_stmt 0 view .LVU49
+	cmpl	$0, log_level(%rip)
+	jg	.L14
+.L11:
+	.loc 1 159 1 view .LVU50
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL22:
+	.loc 1 159 1 view .LVU51
+	ret
+.LVL23:
+.L14:
+	.cfi_restore_state
+	.loc 1 158 128 is_stmt 1 discriminator 4 view .LVU52
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rbx, %rsi
+	leaq	.LC1(%rip), %rdi
+	call	log_deferred@PLT
+.LVL24:
+	.loc 1 158 8 discriminator 4 view .LVU53
+	.loc 1 159 1 is_stmt 0 discriminator 4 view .LVU54
+	jmp	.L11
+	.cfi_endproc
+.LFE49:
+	.size	driver_end_tone, .-driver_end_tone
+	.section	.rodata.str1.1
+.LC2:
+	.string	"trace driver_begin_tone %p %u"
+	.text
+	.type	driver_begin_tone, @function
+driver_begin_tone:
+.LVL25:
+.LFB48:
+	.loc 1 148 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 148 1 is_stmt 0 view .LVU56
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	movl	%esi, %ebx
+	.loc 1 149 5 is_stmt 1 view .LVU57
+	movzwl	%si, %edx
+	movl	$1, %esi
+.LVL26:
+	.loc 1 149 5 is_stmt 0 view .LVU58
+	call	trace_record
+.LVL27:
+	.loc 1 150 5 is_stmt 1 view .LVU59
+	.loc 1 150 10 view .LVU60
+	.loc 1 150 103 view .LVU61
+	.loc 1 150 106 is_stmt 0 view .LVU62
+	cmpl	$0, log_level(%rip)
+	jg	.L18
+.L15:
+	.loc 1 151 1 view .LVU63
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL28:
+	.loc 1 151 1 view .LVU64
+	ret
+.LVL29:
+.L18:
+	.cfi_restore_state
+	.loc 1 150 139 is_stmt 1 discriminator 4 view .LVU65
+	movzwl	%bx, %ecx
+	movl	$1, %edx
+	movq	%rbp, %rsi
+	leaq	.LC2(%rip), %rdi
+	call	log_deferred@PLT
+.LVL30:
+	.loc 1 150 8 discriminator 4 view .LVU66
+	.loc 1 151 1 is_stmt 0 discriminator 4 view .LVU67
+	jmp	.L15
+	.cfi_endproc
+.LFE48:
+	.size	driver_begin_tone, .-driver_begin_tone
+	.section	.rodata.str1.1
+.LC3:
+	.string	"trace driver_init %p"
+	.text
+	.type	driver_init, @function
+driver_init:
+.LVL31:
+.LFB46:
+	.loc 1 129 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 1 is_stmt 0 view .LVU69
+	endbr64
+	.loc 1 130 5 is_stmt 1 view .LVU70
+	.loc 1 130 10 view .LVU71
+	.loc 1 130 13 is_stmt 0 view .LVU72
+	cmpl	$0, log_level(%rip)
+	jg	.L25
+	ret
+.L25:
+	.loc 1 129 1 discriminator 1 view .LVU73
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 130 46 is_stmt 1 discriminator 1 view .LVU74
+	movq	%rdi, %rsi
+	leaq	.LC3(%rip), %rdi
+.LVL32:
+	.loc 1 130 46 is_stmt 0 discriminator 1 view .LVU75
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL33:
+	.loc 1 130 8 is_stmt 1 discriminator 1 view .LVU76
+	.loc 1 131 1 is_stmt 0 discriminator 1 view .LVU77
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	driver_init, .-driver_init
+	.section	.rodata.str1.1
+.LC4:
+	.string	"trace driver_fini %p"
+	.text
+	.type	driver_fini, @function
+driver_fini:
+.LVL34:
+.LFB47:
+	.loc 1 136 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 136 1 is_stmt 0 view .LVU79
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 137 5 is_stmt 1 view .LVU80
+	.loc 1 137 10 view .LVU81
+	.loc 1 137 13 is_stmt 0 view .LVU82
+	cmpl	$0, log_level(%rip)
+	jg	.L29
+.LVL35:
+.L27:
+	.loc 1 137 8 is_stmt 1 discriminator 3 view .LVU83
+	.loc 1 138 5 discriminator 3 view .LVU84
+	movq	%rbx, %rdi
+	call	trace_flush
+.LVL36:
+	.loc 1 139 5 discriminator 3 view .LVU85
+	movl	88(%rbx), %edi
+	call	close@PLT
+.LVL37:
+	.loc 1 140 5 discriminator 3 view .LVU86
+	.loc 1 140 23 is_stmt 0 discriminator 3 view .LVU87
+	movl	$-1, 88(%rbx)
+	.loc 1 141 5 is_stmt 1 discriminator 3 view .LVU88
+	movq	104(%rbx), %rdi
+	call	free@PLT
+.LVL38:
+	.loc 1 142 5 discriminator 3 view .LVU89
+	.loc 1 142 25 is_stmt 0 discriminator 3 view .LVU90
+	movq	$0, 104(%rbx)
+	.loc 1 143 1 discriminator 3 view .LVU91
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL39:
+	.loc 1 143 1 discriminator 3 view .LVU92
+	ret
+.LVL40:
+.L29:
+	.cfi_restore_state
+	.loc 1 137 46 is_stmt 1 discriminator 1 view .LVU93
+	movq	%rdi, %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL41:
+	jmp	.L27
+	.cfi_endproc
+.LFE47:
+	.size	driver_fini, .-driver_fini
+	.section	.rodata.str1.1
+.LC5:
+	.string	"trace driver_detect %p %s"
+.LC6:
+	.string	"trace driver_detect %p %p"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC7:
+	.string	"trace: could not open(2) %s: %s"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"trace:"
+	.text
+	.type	driver_detect, @function
+driver_detect:
+.LVL42:
+.LFB45:
+	.loc 1 88 1 view -0
+	.cfi_startproc
+	.loc 1 88 1 is_stmt 0 view .LVU95
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbp
+	.loc 1 89 5 is_stmt 1 view .LVU96
+	.loc 1 89 8 is_stmt 0 view .LVU97
+	testq	%rsi, %rsi
+	je	.L31
+	movq	%rsi, %rbx
+	.loc 1 90 9 is_stmt 1 view .LVU98
+	.loc 1 90 14 view .LVU99
+	.loc 1 90 17 is_stmt 0 view .LVU100
+	cmpl	$0, log_level(%rip)
+	jg	.L42
+.LVL43:
+.L32:
+	.loc 1 93 12 is_stmt 1 view .LVU101
+	.loc 1 96 5 view .LVU102
+	.loc 1 100 5 view .LVU103
+	.loc 1 100 9 is_stmt 0 view .LVU104
+	movl	$6, %edx
+	leaq	.LC8(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strncmp@PLT
+.LVL44:
+	movl	%eax, %edx
+	.loc 1 102 15 view .LVU105
+	movl	$0, %eax
+	.loc 1 100 8 view .LVU106
+	testl	%edx, %edx
+	je	.L43
+.LVL45:
+.L30:
+	.loc 1 124 1 view .LVU107
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL46:
+	.loc 1 124 1 view .LVU108
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL47:
+.L42:
+	.cfi_restore_state
+	.loc 1 90 50 is_stmt 1 discriminator 1 view .LVU109
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	leaq	.LC5(%rip), %rdi
+.LVL48:
+	.loc 1 90 50 is_stmt 0 discriminator 1 view .LVU110
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL49:
+	jmp	.L32
+.LVL50:
+.L31:
+	.loc 1 93 9 is_stmt 1 view .LVU111
+	.loc 1 93 14 view .LVU112
+	.loc 1 93 17 is_stmt 0 view .LVU113
+	cmpl	$0, log_level(%rip)
+	jg	.L44
+.LVL51:
+.L33:
+	.loc 1 93 12 is_stmt 1 view .LVU114
+	.loc 1 96 5 view .LVU115
+	.loc 1 98 15 is_stmt 0 view .LVU116
+	movl	$0, %eax
+	jmp	.L30
+.LVL52:
+.L44:
+	.loc 1 93 50 is_stmt 1 discriminator 1 view .LVU117
+	movl	$0, %edx
+	movq	%rdi, %rsi
+.LVL53:
+	.loc 1 93 50 is_stmt 0 discriminator 1 view .LVU118
+	leaq	.LC6(%rip), %rdi
+.LVL54:
+	.loc 1 93 50 discriminator 1 view .LVU119
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL55:
+	jmp	.L33
+.LVL56:
+.L43:
+	.loc 1 105 5 is_stmt 1 view .LVU120
+	.loc 1 105 23 is_stmt 0 view .LVU121
+	leaq	6(%rbx), %r13
+.LVL57:
+	.loc 1 106 5 is_stmt 1 view .LVU122
+.LBB4:
+.LBI4:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 2 41 1 view .LVU123
+.LBB5:
+	.loc 2 43 3 view .LVU124
+	.loc 2 46 3 view .LVU125
+	.loc 2 48 7 view .LVU126
+	.loc 2 53 7 view .LVU127
+	.loc 2 53 14 is_stmt 0 view .LVU128
+	movl	$438, %edx
+	movl	$525377, %esi
+	movq	%r13, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL58:
+	movl	%eax, %r12d
+.LVL59:
+	.loc 2 53 14 view .LVU129
+.LBE5:
+.LBE4:
+	.loc 1 107 5 is_stmt 1 view .LVU130
+	.loc 1 107 8 is_stmt 0 view .LVU131
+	cmpl	$-1, %eax
+	je	.L45
+	.loc 1 113 5 is_stmt 1 view .LVU132
+	.loc 1 113 30 is_stmt 0 view .LVU133
+	movl	$65544, %edi
+	call	malloc@PLT
+.LVL60:
+	.loc 1 114 5 is_stmt 1 view .LVU134
+	.loc 1 114 8 is_stmt 0 view .LVU135
+	testq	%rax, %rax
+	je	.L46
+	.loc 1 118 5 is_stmt 1 view .LVU136
+	.loc 1 118 17 is_stmt 0 view .LVU137
+	movq	$0, (%rax)
+	.loc 1 120 5 is_stmt 1 view .LVU138
+	.loc 1 120 23 is_stmt 0 view .LVU139
+	movl	%r12d, 88(%rbp)
+	.loc 1 121 5 is_stmt 1 view .LVU140
+	.loc 1 121 25 is_stmt 0 view .LVU141
+	movq	%rbx, 96(%rbp)
+	.loc 1 122 5 is_stmt 1 view .LVU142
+	.loc 1 122 25 is_stmt 0 view .LVU143
+	movq	%rax, 104(%rbp)
+	.loc 1 123 5 is_stmt 1 view .LVU144
+	.loc 1 123 11 is_stmt 0 view .LVU145
+	movl	$1, %eax
+.LVL61:
+	.loc 1 123 11 view .LVU146
+	jmp	.L30
+.LVL62:
+.L45:
+	.loc 1 108 9 is_stmt 1 view .LVU147
+	.loc 1 108 14 view .LVU148
+	.loc 1 110 15 is_stmt 0 view .LVU149
+	movl	$0, %eax
+.LVL63:
+	.loc 1 108 17 view .LVU150
+	cmpl	$0, log_level(%rip)
+	jle	.L30
+	.loc 1 108 50 is_stmt 1 discriminator 1 view .LVU151
+	.loc 1 108 10 is_stmt 0 discriminator 1 view .LVU152
+	call	__errno_location@PLT
+.LVL64:
+	.loc 1 108 50 discriminator 1 view .LVU153
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL65:
+	movq	%rax, %rdx
+	movq	%r13, %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL66:
+	.loc 1 110 15 discriminator 1 view .LVU154
+	movl	$0, %eax
+	jmp	.L30
+.LVL67:
+.L46:
+	.loc 1 115 9 is_stmt 1 view .LVU155
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL68:
+	.loc 1 116 9 view .LVU156
+	.loc 1 116 15 is_stmt 0 view .LVU157
+	movl	$0, %eax
+	jmp	.L30
+	.cfi_endproc
+.LFE45:
+	.size	driver_detect, .-driver_detect
+	.globl	trace_driver
+	.section	.rodata.str1.1
+.LC9:
+	.string	"trace"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	trace_driver, @object
+	.size	trace_driver, 112
+trace_driver:
+	.quad	.LC9
+	.quad	0
+	.quad	driver_detect
+	.quad	driver_init
+	.quad	driver_fini
+	.quad	driver_begin_tone
+	.quad	driver_end_tone
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.long	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 9 "beep-driver.h"
+	.file 10 "beep-driver-trace.h"
+	.file 11 "beep-log.h"
+	.file 12 "/usr/include/stdlib.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/unistd.h"
+	.file 15 "beep-library.h"
+	.file 16 "/usr/include/time.h"
+	.file 17 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb0f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF96
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x3
+	.long	.LASF10
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	0x35
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	0x4d
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x6
+	.long	0x6e
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x3
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x4
+	.byte	0xa9
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xd7
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF17
+	.uleb128 0x6
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x4
+	.byte	0xd7
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0xb8
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x6
+	.byte	0xb
+	.long	0x122
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x10
+	.byte	0xc
+	.long	0xac
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x15
+	.byte	0x15
+	.long	0xc6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF22
+	.uleb128 0x5
+	.long	0x133
+	.uleb128 0x6
+	.long	0x129
+	.uleb128 0x1f
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x6
+	.long	0x134
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x19
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x6
+	.long	0x13e
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x8
+	.byte	0x18
+	.long	0xe3
+	.uleb128 0x6
+	.long	0x167
+	.uleb128 0x20
+	.long	0x173
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x189
+	.uleb128 0x12
+	.long	.LASF29
+	.byte	0x70
+	.byte	0x9
+	.byte	0x43
+	.long	0x24c
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x44
+	.byte	0xb
+	.long	0xd2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x45
+	.byte	0x12
+	.long	0x2c5
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x47
+	.byte	0x1d
+	.long	0x299
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x48
+	.byte	0x1b
+	.long	0x2ef
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x49
+	.byte	0x1b
+	.long	0x30b
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x21
+	.long	0x317
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x338
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x52
+	.byte	0x1b
+	.long	0x344
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x59
+	.byte	0x24
+	.long	0x365
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x61
+	.byte	0x1c
+	.long	0x2ca
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x62
+	.byte	0x18
+	.long	0x3a4
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x67
+	.byte	0x9
+	.long	0x4d
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x68
+	.byte	0x11
+	.long	0x134
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xb
+	.long	0xc4
+	.byte	0x68
+	.byte	0
+	.uleb128 0x13
+	.byte	0x9
+	.byte	0x22
+	.long	0x288
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x23
+	.byte	0xe
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x24
+	.byte	0xe
+	.long	0x14f
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x25
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x26
+	.byte	0xe
+	.long	0x14f
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x27
+	.byte	0x3
+	.long	0x24c
+	.uleb128 0x6
+	.long	0x288
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x32
+	.byte	0xf
+	.long	0x2a5
+	.uleb128 0x5
+	.long	0x2aa
+	.uleb128 0x14
+	.long	0x2be
+	.long	0x2be
+	.uleb128 0x2
+	.long	0x2c5
+	.uleb128 0x2
+	.long	0x134
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF50
+	.uleb128 0x5
+	.long	0x17d
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x34
+	.byte	0xf
+	.long	0x2d6
+	.uleb128 0x5
+	.long	0x2db
+	.uleb128 0x14
+	.long	0x2be
+	.long	0x2ef
+	.uleb128 0x2
+	.long	0x2c5
+	.uleb128 0x2
+	.long	0x54
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x36
+	.byte	0x10
+	.long	0x2fb
+	.uleb128 0x5
+	.long	0x300
+	.uleb128 0xd
+	.long	0x30b
+	.uleb128 0x2
+	.long	0x2c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x37
+	.byte	0x10
+	.long	0x2fb
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x38
+	.byte	0x10
+	.long	0x323
+	.uleb128 0x5
+	.long	0x328
+	.uleb128 0xd
+	.long	0x338
+	.uleb128 0x2
+	.long	0x2c5
+	.uleb128 0x2
+	.long	0x14a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x10
+	.long	0x2fb
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x10
+	.long	0x350
+	.uleb128 0x5
+	.long	0x355
+	.uleb128 0xd
+	.long	0x365
+	.uleb128 0x2
+	.long	0x2c5
+	.uleb128 0x2
+	.long	0x75
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x10
+	.long	0x371
+	.uleb128 0x5
+	.long	0x376
+	.uleb128 0xd
+	.long	0x390
+	.uleb128 0x2
+	.long	0x2c5
+	.uleb128 0x2
+	.long	0x395
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x39f
+	.byte	0
+	.uleb128 0x5
+	.long	0x294
+	.uleb128 0x6
+	.long	0x390
+	.uleb128 0x5
+	.long	0x178
+	.uleb128 0x6
+	.long	0x39a
+	.uleb128 0x5
+	.long	0x139
+	.uleb128 0x21
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0xa
+	.byte	0x23
+	.byte	0x5
+	.long	0x3c4
+	.uleb128 0x15
+	.long	.LASF58
+	.byte	0x1
+	.uleb128 0x15
+	.long	.LASF59
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x26
+	.byte	0x7
+	.long	0x3a9
+	.uleb128 0x6
+	.long	0x3c4
+	.uleb128 0x13
+	.byte	0xa
+	.byte	0x2e
+	.long	0x404
+	.uleb128 0x4
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0x15b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x30
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0xa
+	.byte	0x31
+	.byte	0xe
+	.long	0x14f
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x32
+	.byte	0x3
+	.long	0x3d5
+	.uleb128 0x16
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x35
+	.byte	0x14
+	.long	0x17d
+	.uleb128 0x16
+	.long	.LASF65
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x22
+	.long	0x10008
+	.byte	0x1
+	.byte	0x31
+	.byte	0x9
+	.long	0x44f
+	.uleb128 0x4
+	.long	.LASF66
+	.byte	0x1
+	.byte	0x32
+	.byte	0xc
+	.long	0x35
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0x1
+	.byte	0x33
+	.byte	0x17
+	.long	0x44f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x23
+	.long	0x404
+	.long	0x460
+	.uleb128 0x24
+	.long	0x46
+	.value	0xfff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0x1
+	.byte	0x34
+	.byte	0x3
+	.long	0x428
+	.uleb128 0x25
+	.long	0x410
+	.byte	0x1
+	.byte	0xa2
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trace_driver
+	.uleb128 0x26
+	.long	.LASF92
+	.byte	0x2
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF93
+	.long	0x4d
+	.long	0x49e
+	.uleb128 0x2
+	.long	0x134
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF71
+	.byte	0x2
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.long	0x4b9
+	.uleb128 0x2
+	.long	0x134
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF69
+	.byte	0x25
+	.uleb128 0x17
+	.long	.LASF70
+	.byte	0x23
+	.uleb128 0xe
+	.long	.LASF72
+	.byte	0xc
+	.value	0x229
+	.byte	0xe
+	.long	0xc4
+	.long	0x4dc
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF73
+	.byte	0xd
+	.value	0x1a3
+	.byte	0xe
+	.long	0xd2
+	.long	0x4f3
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF97
+	.byte	0x11
+	.byte	0x25
+	.byte	0xd
+	.long	0x4ff
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x11
+	.long	.LASF74
+	.byte	0xd
+	.byte	0x9f
+	.byte	0xc
+	.long	0x4d
+	.long	0x524
+	.uleb128 0x2
+	.long	0x134
+	.uleb128 0x2
+	.long	0x134
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF76
+	.byte	0xc
+	.value	0x238
+	.byte	0xd
+	.long	0x537
+	.uleb128 0x2
+	.long	0xc4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF75
+	.byte	0xe
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF77
+	.byte	0x43
+	.long	0x55f
+	.uleb128 0x2
+	.long	0x139
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF78
+	.byte	0xf
+	.byte	0x47
+	.byte	0x6
+	.long	0x571
+	.uleb128 0x2
+	.long	0x139
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF79
+	.byte	0xf
+	.byte	0x2e
+	.byte	0x5
+	.long	0x4d
+	.long	0x591
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x12e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF80
+	.byte	0x10
+	.value	0x120
+	.byte	0xc
+	.long	0x4d
+	.long	0x5ad
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0x5ad
+	.byte	0
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x18
+	.long	.LASF81
+	.byte	0x58
+	.long	0x5d1
+	.uleb128 0x2
+	.long	0x139
+	.uleb128 0x2
+	.long	0x12e
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x75
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0x9b
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x64e
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x9b
+	.byte	0x23
+	.long	0x2c5
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.quad	.LVL21
+	.long	0x998
+	.long	0x622
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL24
+	.long	0x5b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF83
+	.byte	0x93
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6e9
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x93
+	.byte	0x25
+	.long	0x2c5
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x8
+	.long	.LASF44
+	.byte	0x93
+	.byte	0x3c
+	.long	0x14a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x9
+	.quad	.LVL27
+	.long	0x998
+	.long	0x6b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL30
+	.long	0x5b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF85
+	.byte	0x87
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76c
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x87
+	.byte	0x1f
+	.long	0x2c5
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.quad	.LVL36
+	.long	0xa6d
+	.long	0x730
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL37
+	.long	0x537
+	.uleb128 0xc
+	.quad	.LVL38
+	.long	0x524
+	.uleb128 0xa
+	.quad	.LVL41
+	.long	0x54e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF86
+	.byte	0x80
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7be
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x80
+	.byte	0x1f
+	.long	0x2c5
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xa
+	.quad	.LVL33
+	.long	0x54e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF98
+	.byte	0x1
+	.byte	0x57
+	.byte	0x5
+	.long	0x2be
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x98e
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x57
+	.byte	0x20
+	.long	0x2c5
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x57
+	.byte	0x34
+	.long	0x134
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xf
+	.long	.LASF88
+	.byte	0x69
+	.long	0x139
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x19
+	.string	"fd"
+	.byte	0x6a
+	.byte	0xf
+	.long	0x54
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xf
+	.long	.LASF89
+	.byte	0x71
+	.long	0x993
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2b
+	.long	0xae2
+	.quad	.LBI4
+	.byte	.LVU123
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x14
+	.long	0x8a0
+	.uleb128 0x1a
+	.long	0xafd
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1a
+	.long	0xaf3
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xa
+	.quad	.LVL58
+	.long	0x47e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x80441
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b6
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL44
+	.long	0x504
+	.long	0x8ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL49
+	.long	0x54e
+	.long	0x8f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL55
+	.long	0x54e
+	.long	0x91f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL60
+	.long	0x4c5
+	.long	0x93a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x10008
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL64
+	.long	0x4f3
+	.uleb128 0xc
+	.quad	.LVL65
+	.long	0x4dc
+	.uleb128 0x9
+	.quad	.LVL66
+	.long	0x54e
+	.long	0x979
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL68
+	.long	0x537
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x460
+	.uleb128 0x6
+	.long	0x98e
+	.uleb128 0xb
+	.long	.LASF90
+	.byte	0x44
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa63
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x44
+	.byte	0x20
+	.long	0x2c5
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.long	.LASF62
+	.byte	0x45
+	.byte	0x2c
+	.long	0x3d0
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.long	.LASF44
+	.byte	0x45
+	.byte	0x42
+	.long	0x14a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2c
+	.string	"ts"
+	.byte	0x1
+	.byte	0x47
+	.byte	0x15
+	.long	0xfb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xf
+	.long	.LASF89
+	.byte	0x4a
+	.long	0x993
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x19
+	.string	"rec"
+	.byte	0x4b
+	.byte	0x1e
+	.long	0xa68
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.quad	.LVL10
+	.long	0x591
+	.long	0xa3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL18
+	.long	0xa6d
+	.long	0xa55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL19
+	.long	0xb09
+	.byte	0
+	.uleb128 0x5
+	.long	0x404
+	.uleb128 0x6
+	.long	0xa63
+	.uleb128 0xb
+	.long	.LASF91
+	.byte	0x38
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xae2
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x38
+	.byte	0x1f
+	.long	0x2c5
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xf
+	.long	.LASF89
+	.byte	0x3a
+	.long	0x993
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.quad	.LVL3
+	.long	0x571
+	.long	0xac6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL6
+	.long	0x55f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF93
+	.byte	0x2
+	.byte	0x29
+	.byte	0x1
+	.long	0x4d
+	.byte	0x3
+	.long	0xb09
+	.uleb128 0x1b
+	.long	.LASF94
+	.byte	0x13
+	.long	0x134
+	.uleb128 0x1b
+	.long	.LASF95
+	.byte	0x1f
+	.long	0x4d
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF99
+	.long	.LASF99
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU129
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU134
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU147
+	.uleb128 .LVU155
+	.uleb128 .LVU156
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 104
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU123
+	.uleb128 .LVU129
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80441
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU123
+	.uleb128 .LVU129
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU24
+	.uleb128 .LVU37
+	.uleb128 .LVU40
+	.uleb128 .LVU41
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU26
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+	.uleb128 .LVU40
+	.uleb128 .LVU41
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x34
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x34
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 .LVU13
+	.uleb128 .LVU14
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF75:
+	.string	"close"
+.LASF97:
+	.string	"__errno_location"
+.LASF58:
+	.string	"BEEP_TRACE_BEGIN_TONE"
+.LASF69:
+	.string	"__open_missing_mode"
+.LASF13:
+	.string	"__uint64_t"
+.LASF20:
+	.string	"tv_sec"
+.LASF25:
+	.string	"uint64_t"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF72:
+	.string	"malloc"
+.LASF40:
+	.string	"default_devices"
+.LASF92:
+	.string	"__open_alias"
+.LASF35:
+	.string	"begin_tone"
+.LASF81:
+	.string	"log_deferred"
+.LASF87:
+	.string	"console_device"
+.LASF4:
+	.string	"long long int"
+.LASF16:
+	.string	"__syscall_slong_t"
+.LASF46:
+	.string	"delay"
+.LASF62:
+	.string	"event"
+.LASF11:
+	.string	"__uint16_t"
+.LASF74:
+	.string	"strncmp"
+.LASF49:
+	.string	"beep_driver_detect_func"
+.LASF56:
+	.string	"beep_driver_wait_func"
+.LASF73:
+	.string	"strerror"
+.LASF91:
+	.string	"trace_flush"
+.LASF85:
+	.string	"driver_fini"
+.LASF41:
+	.string	"device_fd"
+.LASF59:
+	.string	"BEEP_TRACE_END_TONE"
+.LASF55:
+	.string	"beep_driver_end_tone_func"
+.LASF61:
+	.string	"timestamp_ns"
+.LASF64:
+	.string	"trace_driver"
+.LASF37:
+	.string	"wait"
+.LASF90:
+	.string	"trace_record"
+.LASF60:
+	.string	"beep_trace_event_E"
+.LASF32:
+	.string	"detect"
+.LASF19:
+	.string	"clockid_t"
+.LASF79:
+	.string	"write_all"
+.LASF44:
+	.string	"freq"
+.LASF63:
+	.string	"beep_trace_record"
+.LASF2:
+	.string	"long int"
+.LASF88:
+	.string	"trace_name"
+.LASF27:
+	.string	"beep_driver"
+.LASF86:
+	.string	"driver_init"
+.LASF26:
+	.string	"sig_atomic_t"
+.LASF30:
+	.string	"name"
+.LASF83:
+	.string	"driver_begin_tone"
+.LASF45:
+	.string	"length"
+.LASF43:
+	.string	"driver_data"
+.LASF18:
+	.string	"__sig_atomic_t"
+.LASF5:
+	.string	"unsigned char"
+.LASF42:
+	.string	"device_name"
+.LASF21:
+	.string	"tv_nsec"
+.LASF8:
+	.string	"signed char"
+.LASF47:
+	.string	"flags"
+.LASF22:
+	.string	"long long unsigned int"
+.LASF24:
+	.string	"uint32_t"
+.LASF7:
+	.string	"unsigned int"
+.LASF23:
+	.string	"uint16_t"
+.LASF80:
+	.string	"clock_gettime"
+.LASF29:
+	.string	"_beep_driver"
+.LASF95:
+	.string	"__oflag"
+.LASF39:
+	.string	"probe"
+.LASF84:
+	.string	"driver"
+.LASF94:
+	.string	"__path"
+.LASF77:
+	.string	"log_verbose"
+.LASF67:
+	.string	"records"
+.LASF53:
+	.string	"beep_driver_fini_func"
+.LASF68:
+	.string	"trace_data"
+.LASF17:
+	.string	"char"
+.LASF33:
+	.string	"init"
+.LASF52:
+	.string	"beep_driver_init_func"
+.LASF65:
+	.string	"log_level"
+.LASF6:
+	.string	"short unsigned int"
+.LASF82:
+	.string	"driver_end_tone"
+.LASF48:
+	.string	"beep_tone"
+.LASF36:
+	.string	"end_tone"
+.LASF50:
+	.string	"_Bool"
+.LASF54:
+	.string	"beep_driver_begin_tone_func"
+.LASF38:
+	.string	"play_sequence"
+.LASF89:
+	.string	"data"
+.LASF34:
+	.string	"fini"
+.LASF3:
+	.string	"long unsigned int"
+.LASF14:
+	.string	"__time_t"
+.LASF12:
+	.string	"__uint32_t"
+.LASF57:
+	.string	"beep_driver_play_sequence_func"
+.LASF66:
+	.string	"count"
+.LASF98:
+	.string	"driver_detect"
+.LASF70:
+	.string	"__open_too_many_args"
+.LASF15:
+	.string	"__clockid_t"
+.LASF78:
+	.string	"safe_error_exit"
+.LASF51:
+	.string	"beep_driver_probe_func"
+.LASF93:
+	.string	"open"
+.LASF28:
+	.string	"timespec"
+.LASF71:
+	.string	"__open_2"
+.LASF99:
+	.string	"__stack_chk_fail"
+.LASF76:
+	.string	"free"
+.LASF96:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF31:
+	.string	"next"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-driver-trace.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -21,20 +21,47 @@
 #define BEEP_DRIVER_H
 
 
+#include <signal.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 
 typedef struct _beep_driver beep_driver;
 
 
+/** One tone of a compiled tone sequence */
+typedef struct {
+    uint32_t freq;    /* tone frequency (Hz), 0 for silence */
+    uint32_t length;  /* tone length (ms) */
+    uint32_t delay;   /* silence after the tone (ms) */
+    uint32_t flags;   /* BEEP_TONE_NOTE or 0 */
+} beep_tone;
+
+
+/** Set in beep_tone.flags for a tone given as a note name, with the
+ * MIDI note number in the lowest 7 bits.  Drivers which can play the
+ * exact pitch of the note instead of freq may use the note number.
+ */
+#define BEEP_TONE_NOTE      0x100U
+#define BEEP_TONE_NOTE_MASK 0x7fU
+
+
 typedef bool (*beep_driver_detect_func)     (beep_driver *driver,
                                              const char *console_device);
+typedef bool (*beep_driver_probe_func)      (beep_driver *driver,
+                                             const int device_fd);
 typedef void (*beep_driver_init_func)       (beep_driver *driver);
 typedef void (*beep_driver_fini_func)       (beep_driver *driver);
 typedef void (*beep_driver_begin_tone_func) (beep_driver *driver,
                                              const uint16_t freq);
 typedef void (*beep_driver_end_tone_func)   (beep_driver *driver);
+typedef void (*beep_driver_wait_func)       (beep_driver *driver,
+                                             const unsigned int milliseconds);
+typedef void (*beep_driver_play_sequence_func)
+    (beep_driver *driver,
+     const beep_tone *const tones, const size_t count,
+     const volatile sig_atomic_t *const abort_flag);
 
 
 struct _beep_driver {
@@ -47,11 +74,39 @@ struct _beep_driver {
     beep_driver_begin_tone_func begin_tone;
     beep_driver_end_tone_func   end_tone;
 
+    /* Optional.  Drivers which do not produce sound in real time
+     * (e.g. because they render it into a file) set this to account
+     * for the given amount of time themselves instead of having beep
+     * sleep for it.
+     */
+    beep_driver_wait_func       wait;
+
+    /* Optional.  Drivers which can play a whole tone sequence more
+     * efficiently than edge by edge (e.g. by having the kernel time
+     * the tones) set this.  It must return early and silent once
+     * *abort_flag becomes true.
+     */
+    beep_driver_play_sequence_func play_sequence;
+
+    /* Optional.  Drivers for character devices set these instead of
+     * detect.  beep_drivers_detect() then opens and checks every
+     * device file only once, and probe only checks whether the open
+     * device_fd implements the driver's API.  Without a device given,
+     * the NULL terminated default_devices are tried in order.
+     */
+    beep_driver_probe_func      probe;
+    const char *const          *default_devices;
+
     /* As long as all drivers need these data items, we do not need to
      * hide them in the driver implementation.
      */
     int         device_fd;
     const char *device_name;
+
+    /* Driver specific state, for drivers which need more than the
+     * device fd.
+     */
+    void       *driver_data;
 };
 
 
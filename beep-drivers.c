@@ -17,10 +17,30 @@
  */
 
 
+#ifdef BEEP_STATIC_DRIVER
+/* Build variant with exactly one driver (make STATIC_DRIVER=...).
+ * The driver source is compiled into this file, so that the tone
+ * edges below become direct calls which the compiler can inline.
+ * This comes first, as the driver source may define feature test
+ * macros like _GNU_SOURCE.
+ */
+# include BEEP_STATIC_DRIVER_SOURCE
+#endif
+
+
 #include <stddef.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "beep-drivers.h"
+#include "beep-library.h"
 #include "beep-log.h"
+#include "beep-timeline.h"
+#include "beep-usdt.h"
 
 
 static
@@ -41,11 +61,95 @@ void beep_drivers_register(beep_driver *driver)
 }
 
 
+/* Try the driver's default devices one after the other */
+static
+bool probe_default_devices(beep_driver *instance)
+{
+    for (const char *const *name = instance->default_devices;
+         *name; ++name) {
+        const int fd = open_checked_char_device(*name);
+        if (fd != -1) {
+            if (instance->probe(instance, fd)) {
+                instance->device_fd = fd;
+                instance->device_name = *name;
+                return true;
+            }
+            COUNT_SYSCALL(close(fd));
+        }
+    }
+    return false;
+}
+
+
 beep_driver *beep_drivers_detect(const char *const console_device)
+{
+    /* A given character device is opened only once, for the first
+     * driver which can probe it, and then probed by all those drivers.
+     */
+    int  shared_fd = -1;
+    bool shared_opened = false;
+
+    for (beep_driver *driver = first_driver; driver; driver=driver->next) {
+        /* Detect on a copy of the registered driver, so that the same
+         * driver can drive more than one device at the same time.
+         */
+        beep_driver *const instance = malloc(sizeof(beep_driver));
+        if (!instance) {
+            break;
+        }
+        *instance = *driver;
+        instance->next = NULL;
+
+        if (!instance->probe) {
+            if (instance->detect(instance, console_device)) {
+                if (shared_fd != -1) {
+                    COUNT_SYSCALL(close(shared_fd));
+                }
+                return instance;
+            }
+        } else if (!console_device) {
+            if (probe_default_devices(instance)) {
+                return instance;
+            }
+        } else {
+            if (!shared_opened) {
+                shared_fd = open_checked_char_device(console_device);
+                shared_opened = true;
+            }
+            if ((shared_fd != -1) && instance->probe(instance, shared_fd)) {
+                instance->device_fd = shared_fd;
+                instance->device_name = console_device;
+                return instance;
+            }
+        }
+        free(instance);
+    }
+
+    if (shared_fd != -1) {
+        const int saved_errno = errno;
+        COUNT_SYSCALL(close(shared_fd));
+        errno = saved_errno;
+    }
+    return NULL;
+}
+
+
+beep_driver *beep_drivers_adopt(const char *const driver_name,
+                                const int device_fd,
+                                const char *const device_name)
 {
     for (beep_driver *driver = first_driver; driver; driver=driver->next) {
-        if (driver->detect(driver, console_device)) {
-            return driver;
+        if (0 == strcmp(driver->name, driver_name)) {
+            beep_driver *const instance = malloc(sizeof(beep_driver));
+            if (!instance) {
+                return NULL;
+            }
+            *instance = *driver;
+            instance->next = NULL;
+            instance->device_fd = device_fd;
+            instance->device_name = device_name;
+            instance->driver_data = NULL;
+            return instance;
         }
     }
     return NULL;
@@ -54,25 +158,93 @@ beep_driver *beep_drivers_detect(const char *const console_device)
 
 void beep_drivers_init(beep_driver *driver)
 {
+#ifdef BEEP_STATIC_DRIVER
+    driver_init(driver);
+#else
     driver->init(driver);
+#endif
 }
 
 
 void beep_drivers_fini(beep_driver *driver)
 {
+#ifdef BEEP_STATIC_DRIVER
+    driver_fini(driver);
+#else
     driver->fini(driver);
+#endif
+    free(driver);
 }
 
 
 void beep_drivers_begin_tone(beep_driver *driver, const uint16_t freq)
 {
+    BEEP_PROBE2(begin_tone, driver->name, freq);
+    TIMELINE_BEGIN(start_ns);
+#ifdef BEEP_STATIC_DRIVER
+    driver_begin_tone(driver, freq);
+#else
     driver->begin_tone(driver, freq);
+#endif
+    TIMELINE_END(start_ns, "begin_tone", "driver", "freq", freq);
 }
 
 
 void beep_drivers_end_tone(beep_driver *driver)
 {
+    BEEP_PROBE1(end_tone, driver->name);
+    TIMELINE_BEGIN(start_ns);
+#ifdef BEEP_STATIC_DRIVER
+    driver_end_tone(driver);
+#else
     driver->end_tone(driver);
+#endif
+    TIMELINE_END(start_ns, "end_tone", "driver", NULL, 0);
+}
+
+
+int beep_drivers_wait(beep_driver *driver, const unsigned int milliseconds)
+{
+    BEEP_PROBE1(wait_enter, milliseconds);
+    TIMELINE_BEGIN(start_ns);
+    int retval = 0;
+    if (driver->wait) {
+        driver->wait(driver, milliseconds);
+    } else if (milliseconds > 0) {
+        const time_t seconds = milliseconds / 1000U;
+        const long   nanoseconds = (milliseconds % 1000UL) * 1000UL * 1000UL;
+        const struct timespec request =
+            { seconds,
+              nanoseconds };
+        retval = nanosleep(&request, NULL);
+    }
+    TIMELINE_END(start_ns, "wait", "sleep", "ms", milliseconds);
+    BEEP_PROBE1(wait_exit, milliseconds);
+    return retval;
+}
+
+
+void beep_drivers_play_sequence(beep_driver *driver,
+                                const beep_tone *const tones,
+                                const size_t count,
+                                const volatile sig_atomic_t *const abort_flag)
+{
+    BEEP_PROBE1(sequence_enter, count);
+    TIMELINE_BEGIN(start_ns);
+    if (driver->play_sequence) {
+        driver->play_sequence(driver, tones, count, abort_flag);
+    } else {
+        for (size_t i=0; (!*abort_flag) && (i<count); ++i) {
+            beep_drivers_begin_tone(driver, tones[i].freq & 0xffff);
+            beep_drivers_wait(driver, tones[i].length);
+            beep_drivers_end_tone(driver);
+            if ((!*abort_flag) && (tones[i].delay > 0)) {
+                beep_drivers_wait(driver, tones[i].delay);
+            }
+        }
+    }
+    TIMELINE_END(start_ns, "play_sequence", "tones", "count", count);
+    BEEP_PROBE1(sequence_exit, count);
 }
 
 
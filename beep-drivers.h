@@ -27,8 +27,20 @@
 void beep_drivers_register(beep_driver *driver)
     __attribute__(( nonnull(1) ));
 
+/** Return a new instance of the first registered driver which can
+ * use console_device, or NULL.  beep_drivers_fini() frees it.
+ */
 beep_driver *beep_drivers_detect(const char *const console_device);
 
+/** Return a new instance of the registered driver called driver_name
+ * using the already opened device_fd, without running its detect
+ * function.  Only for drivers which keep no driver_data.
+ */
+beep_driver *beep_drivers_adopt(const char *const driver_name,
+                                const int device_fd,
+                                const char *const device_name)
+    __attribute__(( nonnull(1, 3) ));
+
 void beep_drivers_init(beep_driver *driver)
     __attribute__(( nonnull(1) ));
 
@@ -41,6 +53,19 @@ void beep_drivers_begin_tone(beep_driver *driver, const uint16_t freq)
 void beep_drivers_end_tone(beep_driver *driver)
     __attribute__(( nonnull(1) ));
 
+int beep_drivers_wait(beep_driver *driver, const unsigned int milliseconds)
+    __attribute__(( nonnull(1) ));
+
+/** Play a compiled tone sequence, using the driver's play_sequence
+ * operation if it has one, and edge by edge otherwise.  Returns early
+ * once *abort_flag becomes true.
+ */
+void beep_drivers_play_sequence(beep_driver *driver,
+                                const beep_tone *const tones,
+                                const size_t count,
+                                const volatile sig_atomic_t *const abort_flag)
+    __attribute__(( nonnull(1, 4) ));
+
 #endif /* BEEP_DRIVERS_H */
 
 
@@ -0,0 +1,4573 @@
+	.file	"beep-drivers.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-drivers.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"beep_drivers_register %p (%s)"
+	.text
+	.globl	beep_drivers_register
+	.type	beep_drivers_register, @function
+beep_drivers_register:
+.LVL0:
+.LFB41:
+	.file 1 "beep-drivers.c"
+	.loc 1 51 1 view -0
+	.cfi_startproc
+	.loc 1 51 1 is_stmt 0 view .LVU1
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 52 5 is_stmt 1 view .LVU2
+	.loc 1 52 10 view .LVU3
+	.loc 1 52 13 is_stmt 0 view .LVU4
+	cmpl	$0, log_level(%rip)
+	jg	.L4
+.LVL1:
+.L2:
+	.loc 1 52 8 is_stmt 1 discriminator 3 view .LVU5
+	.loc 1 54 5 discriminator 3 view .LVU6
+	.loc 1 55 22 is_stmt 0 discriminator 3 view .LVU7
+	movq	first_driver(%rip), %rax
+	movq	%rax, 8(%rbx)
+	.loc 1 56 22 discriminator 3 view .LVU8
+	movq	%rbx, first_driver(%rip)
+	.loc 1 61 1 discriminator 3 view .LVU9
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL2:
+	.loc 1 61 1 discriminator 3 view .LVU10
+	ret
+.LVL3:
+.L4:
+	.cfi_restore_state
+	.loc 1 52 46 is_stmt 1 discriminator 1 view .LVU11
+	movq	(%rdi), %rdx
+	movq	%rdi, %rsi
+	leaq	.LC0(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL4:
+	jmp	.L2
+	.cfi_endproc
+.LFE41:
+	.size	beep_drivers_register, .-beep_drivers_register
+	.globl	beep_drivers_detect
+	.type	beep_drivers_detect, @function
+beep_drivers_detect:
+.LVL5:
+.LFB43:
+	.loc 1 85 1 view -0
+	.cfi_startproc
+	.loc 1 85 1 is_stmt 0 view .LVU13
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 89 5 is_stmt 1 view .LVU14
+.LVL6:
+	.loc 1 90 4 view .LVU15
+	.loc 1 92 5 view .LVU16
+.LBB9:
+	.loc 1 92 10 view .LVU17
+	.loc 1 92 23 is_stmt 0 view .LVU18
+	movq	first_driver(%rip), %rbp
+.LVL7:
+	.loc 1 92 46 is_stmt 1 view .LVU19
+	testq	%rbp, %rbp
+	je	.L16
+	movq	%rdi, %r15
+.LBE9:
+	.loc 1 90 9 is_stmt 0 view .LVU20
+	movb	$0, 15(%rsp)
+	.loc 1 89 9 view .LVU21
+	movl	$-1, %r14d
+	jmp	.L15
+.LVL8:
+.L24:
+.LBB17:
+.LBB10:
+	.loc 1 104 13 is_stmt 1 view .LVU22
+	.loc 1 104 17 is_stmt 0 view .LVU23
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	*16(%rax)
+.LVL9:
+	.loc 1 104 16 view .LVU24
+	testb	%al, %al
+	jne	.L23
+.LVL10:
+.L9:
+	.loc 1 125 9 is_stmt 1 discriminator 2 view .LVU25
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL11:
+.LBE10:
+	.loc 1 92 60 discriminator 2 view .LVU26
+	movq	8(%rbp), %rbp
+.LVL12:
+	.loc 1 92 46 discriminator 2 view .LVU27
+	testq	%rbp, %rbp
+	je	.L7
+.LVL13:
+.L15:
+.LBB15:
+	.loc 1 96 9 view .LVU28
+	.loc 1 96 39 is_stmt 0 view .LVU29
+	movl	$112, %edi
+	call	malloc@PLT
+.LVL14:
+	movq	%rax, %rbx
+.LVL15:
+	.loc 1 97 9 is_stmt 1 view .LVU30
+	.loc 1 97 12 is_stmt 0 view .LVU31
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 100 9 is_stmt 1 view .LVU32
+	.loc 1 100 19 is_stmt 0 view .LVU33
+	movdqu	0(%rbp), %xmm0
+	movups	%xmm0, (%rax)
+	movdqu	16(%rbp), %xmm1
+	movups	%xmm1, 16(%rax)
+	movdqu	32(%rbp), %xmm2
+	movups	%xmm2, 32(%rax)
+	movdqu	48(%rbp), %xmm3
+	movups	%xmm3, 48(%rax)
+	movdqu	64(%rbp), %xmm4
+	movups	%xmm4, 64(%rax)
+	movdqu	80(%rbp), %xmm5
+	movups	%xmm5, 80(%rax)
+	movdqu	96(%rbp), %xmm6
+	movups	%xmm6, 96(%rax)
+	.loc 1 101 9 is_stmt 1 view .LVU34
+	.loc 1 101 24 is_stmt 0 view .LVU35
+	movq	$0, 8(%rax)
+	.loc 1 103 9 is_stmt 1 view .LVU36
+	.loc 1 103 12 is_stmt 0 view .LVU37
+	cmpq	$0, 72(%rax)
+	je	.L24
+	.loc 1 110 16 is_stmt 1 view .LVU38
+	.loc 1 110 19 is_stmt 0 view .LVU39
+	testq	%r15, %r15
+	je	.L25
+	.loc 1 115 13 is_stmt 1 view .LVU40
+	.loc 1 115 16 is_stmt 0 view .LVU41
+	cmpb	$0, 15(%rsp)
+	je	.L26
+.LVL16:
+.L14:
+	.loc 1 119 13 is_stmt 1 view .LVU42
+	.loc 1 119 16 is_stmt 0 view .LVU43
+	cmpl	$-1, %r14d
+	je	.L17
+	.loc 1 119 38 discriminator 1 view .LVU44
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	*72(%rbx)
+.LVL17:
+	.loc 1 119 35 discriminator 1 view .LVU45
+	testb	%al, %al
+	jne	.L27
+	movb	$1, 15(%rsp)
+	jmp	.L9
+.LVL18:
+.L23:
+	.loc 1 105 17 is_stmt 1 view .LVU46
+	.loc 1 105 20 is_stmt 0 view .LVU47
+	cmpl	$-1, %r14d
+	je	.L5
+	.loc 1 106 21 is_stmt 1 view .LVU48
+	.loc 1 106 22 is_stmt 0 view .LVU49
+	addl	$1, syscall_count(%rip)
+	.loc 1 106 40 view .LVU50
+	movl	%r14d, %edi
+	call	close@PLT
+.LVL19:
+	jmp	.L5
+.LVL20:
+.L25:
+	.loc 1 111 13 is_stmt 1 view .LVU51
+.LBB11:
+.LBI11:
+	.loc 1 66 5 view .LVU52
+	.loc 1 68 5 view .LVU53
+.LBB12:
+	.loc 1 68 10 view .LVU54
+	.loc 1 68 29 is_stmt 0 view .LVU55
+	movq	80(%rax), %r13
+.LVL21:
+	.loc 1 69 10 is_stmt 1 view .LVU56
+	movq	0(%r13), %rdi
+	testq	%rdi, %rdi
+	jne	.L13
+	jmp	.L9
+.LVL22:
+.L12:
+.LBB13:
+	.loc 1 77 13 view .LVU57
+	.loc 1 77 14 is_stmt 0 view .LVU58
+	addl	$1, syscall_count(%rip)
+	.loc 1 77 32 view .LVU59
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL23:
+.L11:
+	.loc 1 77 32 view .LVU60
+.LBE13:
+	.loc 1 69 17 is_stmt 1 view .LVU61
+	addq	$8, %r13
+.LVL24:
+	.loc 1 69 10 view .LVU62
+	movq	0(%r13), %rdi
+	testq	%rdi, %rdi
+	je	.L9
+.LVL25:
+.L13:
+.LBB14:
+	.loc 1 70 9 view .LVU63
+	.loc 1 70 24 is_stmt 0 view .LVU64
+	call	open_checked_char_device@PLT
+.LVL26:
+	movl	%eax, %r12d
+.LVL27:
+	.loc 1 71 9 is_stmt 1 view .LVU65
+	.loc 1 71 12 is_stmt 0 view .LVU66
+	cmpl	$-1, %eax
+	je	.L11
+	.loc 1 72 13 is_stmt 1 view .LVU67
+	.loc 1 72 17 is_stmt 0 view .LVU68
+	movl	%eax, %esi
+	movq	%rbx, %rdi
+	call	*72(%rbx)
+.LVL28:
+	.loc 1 72 16 view .LVU69
+	testb	%al, %al
+	je	.L12
+	.loc 1 73 17 is_stmt 1 view .LVU70
+	.loc 1 73 37 is_stmt 0 view .LVU71
+	movl	%r12d, 88(%rbx)
+	.loc 1 74 17 is_stmt 1 view .LVU72
+	.loc 1 74 41 is_stmt 0 view .LVU73
+	movq	0(%r13), %rax
+	.loc 1 74 39 view .LVU74
+	movq	%rax, 96(%rbx)
+	.loc 1 75 17 is_stmt 1 view .LVU75
+.LVL29:
+.L5:
+	.loc 1 75 17 is_stmt 0 view .LVU76
+.LBE14:
+.LBE12:
+.LBE11:
+.LBE15:
+.LBE17:
+	.loc 1 134 1 view .LVU77
+	movq	%rbx, %rax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL30:
+.L26:
+	.cfi_restore_state
+.LBB18:
+.LBB16:
+	.loc 1 116 17 is_stmt 1 view .LVU78
+	.loc 1 116 29 is_stmt 0 view .LVU79
+	movq	%r15, %rdi
+	call	open_checked_char_device@PLT
+.LVL31:
+	.loc 1 116 29 view .LVU80
+	movl	%eax, %r14d
+.LVL32:
+	.loc 1 117 17 is_stmt 1 view .LVU81
+	.loc 1 117 17 is_stmt 0 view .LVU82
+	jmp	.L14
+.LVL33:
+.L27:
+	.loc 1 120 17 is_stmt 1 view .LVU83
+	.loc 1 120 37 is_stmt 0 view .LVU84
+	movl	%r14d, 88(%rbx)
+	.loc 1 121 17 is_stmt 1 view .LVU85
+	.loc 1 121 39 is_stmt 0 view .LVU86
+	movq	%r15, 96(%rbx)
+	.loc 1 122 17 is_stmt 1 view .LVU87
+	.loc 1 122 24 is_stmt 0 view .LVU88
+	jmp	.L5
+.L17:
+	.loc 1 122 24 view .LVU89
+	movb	$1, 15(%rsp)
+	jmp	.L9
+.LVL34:
+.L7:
+	.loc 1 122 24 view .LVU90
+.LBE16:
+.LBE18:
+	.loc 1 128 5 is_stmt 1 view .LVU91
+	.loc 1 133 11 is_stmt 0 view .LVU92
+	movl	$0, %ebx
+.LVL35:
+	.loc 1 128 8 view .LVU93
+	cmpl	$-1, %r14d
+	je	.L5
+.LBB19:
+	.loc 1 129 9 is_stmt 1 view .LVU94
+	.loc 1 129 34 is_stmt 0 view .LVU95
+	call	__errno_location@PLT
+.LVL36:
+	movq	%rax, %rbx
+	.loc 1 129 19 view .LVU96
+	movl	(%rax), %ebp
+.LVL37:
+	.loc 1 130 9 is_stmt 1 view .LVU97
+	.loc 1 130 10 is_stmt 0 view .LVU98
+	addl	$1, syscall_count(%rip)
+	.loc 1 130 28 view .LVU99
+	movl	%r14d, %edi
+	call	close@PLT
+.LVL38:
+	.loc 1 131 8 is_stmt 1 view .LVU100
+	.loc 1 131 14 is_stmt 0 view .LVU101
+	movl	%ebp, (%rbx)
+.LBE19:
+	.loc 1 133 11 view .LVU102
+	movl	$0, %ebx
+	jmp	.L5
+.LVL39:
+.L16:
+	.loc 1 133 11 view .LVU103
+	movq	%rbp, %rbx
+	jmp	.L5
+	.cfi_endproc
+.LFE43:
+	.size	beep_drivers_detect, .-beep_drivers_detect
+	.globl	beep_drivers_adopt
+	.type	beep_drivers_adopt, @function
+beep_drivers_adopt:
+.LVL40:
+.LFB44:
+	.loc 1 140 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 140 1 is_stmt 0 view .LVU105
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbp
+	movl	%esi, %r13d
+	movq	%rdx, %r12
+	.loc 1 141 5 is_stmt 1 view .LVU106
+.LBB20:
+	.loc 1 141 10 view .LVU107
+	.loc 1 141 23 is_stmt 0 view .LVU108
+	movq	first_driver(%rip), %rbx
+.LVL41:
+	.loc 1 141 46 is_stmt 1 view .LVU109
+	testq	%rbx, %rbx
+	je	.L28
+.LVL42:
+.L31:
+	.loc 1 142 9 view .LVU110
+	.loc 1 142 18 is_stmt 0 view .LVU111
+	movq	(%rbx), %rdi
+	movq	%rbp, %rsi
+	call	strcmp@PLT
+.LVL43:
+	.loc 1 142 12 view .LVU112
+	testl	%eax, %eax
+	je	.L35
+	.loc 1 141 60 is_stmt 1 discriminator 2 view .LVU113
+	movq	8(%rbx), %rbx
+.LVL44:
+	.loc 1 141 46 discriminator 2 view .LVU114
+	testq	%rbx, %rbx
+	jne	.L31
+	jmp	.L28
+.L35:
+.LBB21:
+	.loc 1 143 13 view .LVU115
+	.loc 1 143 43 is_stmt 0 view .LVU116
+	movl	$112, %edi
+	call	malloc@PLT
+.LVL45:
+	.loc 1 144 13 is_stmt 1 view .LVU117
+	.loc 1 144 16 is_stmt 0 view .LVU118
+	testq	%rax, %rax
+	je	.L32
+	.loc 1 147 13 is_stmt 1 view .LVU119
+	.loc 1 147 23 is_stmt 0 view .LVU120
+	movdqu	(%rbx), %xmm0
+	movups	%xmm0, (%rax)
+	movdqu	16(%rbx), %xmm1
+	movups	%xmm1, 16(%rax)
+	movdqu	32(%rbx), %xmm2
+	movups	%xmm2, 32(%rax)
+	movdqu	48(%rbx), %xmm3
+	movups	%xmm3, 48(%rax)
+	movdqu	64(%rbx), %xmm4
+	movups	%xmm4, 64(%rax)
+	movdqu	80(%rbx), %xmm5
+	movups	%xmm5, 80(%rax)
+	.loc 1 148 13 is_stmt 1 view .LVU121
+	.loc 1 148 28 is_stmt 0 view .LVU122
+	movq	$0, 8(%rax)
+	.loc 1 149 13 is_stmt 1 view .LVU123
+	.loc 1 149 33 is_stmt 0 view .LVU124
+	movl	%r13d, 88(%rax)
+	.loc 1 150 13 is_stmt 1 view .LVU125
+	.loc 1 150 35 is_stmt 0 view .LVU126
+	movq	%r12, 96(%rax)
+	.loc 1 151 13 is_stmt 1 view .LVU127
+	.loc 1 151 35 is_stmt 0 view .LVU128
+	movq	$0, 104(%rax)
+	.loc 1 152 13 is_stmt 1 view .LVU129
+	.loc 1 152 20 is_stmt 0 view .LVU130
+	movq	%rax, %rbx
+.LVL46:
+.L28:
+	.loc 1 152 20 view .LVU131
+.LBE21:
+.LBE20:
+	.loc 1 156 1 view .LVU132
+	movq	%rbx, %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL47:
+	.loc 1 156 1 view .LVU133
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 156 1 view .LVU134
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 156 1 view .LVU135
+	ret
+.LVL50:
+.L32:
+	.cfi_restore_state
+.LBB23:
+.LBB22:
+	.loc 1 145 23 view .LVU136
+	movq	%rax, %rbx
+.LVL51:
+	.loc 1 145 23 view .LVU137
+	jmp	.L28
+.LBE22:
+.LBE23:
+	.cfi_endproc
+.LFE44:
+	.size	beep_drivers_adopt, .-beep_drivers_adopt
+	.globl	beep_drivers_init
+	.type	beep_drivers_init, @function
+beep_drivers_init:
+.LVL52:
+.LFB45:
+	.loc 1 160 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 160 1 is_stmt 0 view .LVU139
+	endbr64
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 164 5 is_stmt 1 view .LVU140
+	call	*24(%rdi)
+.LVL53:
+	.loc 1 166 1 is_stmt 0 view .LVU141
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	beep_drivers_init, .-beep_drivers_init
+	.globl	beep_drivers_fini
+	.type	beep_drivers_fini, @function
+beep_drivers_fini:
+.LVL54:
+.LFB46:
+	.loc 1 170 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 170 1 is_stmt 0 view .LVU143
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 174 5 is_stmt 1 view .LVU144
+	call	*32(%rdi)
+.LVL55:
+	.loc 1 176 5 view .LVU145
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL56:
+	.loc 1 177 1 is_stmt 0 view .LVU146
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL57:
+	.loc 1 177 1 view .LVU147
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	beep_drivers_fini, .-beep_drivers_fini
+	.section	.rodata.str1.1
+.LC1:
+	.string	"freq"
+.LC2:
+	.string	"driver"
+.LC3:
+	.string	"begin_tone"
+	.text
+	.globl	beep_drivers_begin_tone
+	.type	beep_drivers_begin_tone, @function
+beep_drivers_begin_tone:
+.LVL58:
+.LFB47:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 181 1 is_stmt 0 view .LVU149
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	movl	%esi, %ebp
+	.loc 1 182 5 is_stmt 1 view .LVU150
+	.loc 1 182 9 view .LVU151
+	.loc 1 182 8 view .LVU152
+	.loc 1 183 5 view .LVU153
+	.loc 1 183 70 is_stmt 0 view .LVU154
+	movl	$0, %r12d
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L45
+.LVL59:
+.L41:
+	.loc 1 187 5 is_stmt 1 discriminator 4 view .LVU155
+	movzwl	%bp, %esi
+	movq	%rbx, %rdi
+	call	*40(%rbx)
+.LVL60:
+	.loc 1 189 5 discriminator 4 view .LVU156
+	.loc 1 189 10 discriminator 4 view .LVU157
+	.loc 1 189 13 is_stmt 0 discriminator 4 view .LVU158
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L46
+.L40:
+	.loc 1 190 1 view .LVU159
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL61:
+	.loc 1 190 1 view .LVU160
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 190 1 view .LVU161
+	ret
+.LVL63:
+.L45:
+	.cfi_restore_state
+	.loc 1 183 50 discriminator 1 view .LVU162
+	call	beep_timeline_now@PLT
+.LVL64:
+	.loc 1 183 50 discriminator 1 view .LVU163
+	movq	%rax, %r12
+	jmp	.L41
+.LVL65:
+.L46:
+	.loc 1 189 34 is_stmt 1 discriminator 1 view .LVU164
+	movzwl	%bp, %r8d
+	leaq	.LC1(%rip), %rcx
+	movq	%r12, %rdx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL66:
+	.loc 1 189 8 discriminator 1 view .LVU165
+	.loc 1 190 1 is_stmt 0 discriminator 1 view .LVU166
+	jmp	.L40
+	.cfi_endproc
+.LFE47:
+	.size	beep_drivers_begin_tone, .-beep_drivers_begin_tone
+	.section	.rodata.str1.1
+.LC4:
+	.string	"end_tone"
+	.text
+	.globl	beep_drivers_end_tone
+	.type	beep_drivers_end_tone, @function
+beep_drivers_end_tone:
+.LVL67:
+.LFB48:
+	.loc 1 194 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 194 1 is_stmt 0 view .LVU168
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 195 5 is_stmt 1 view .LVU169
+	.loc 1 195 9 view .LVU170
+	.loc 1 195 8 view .LVU171
+	.loc 1 196 5 view .LVU172
+	.loc 1 196 70 is_stmt 0 view .LVU173
+	movl	$0, %ebp
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L52
+.LVL68:
+.L48:
+	.loc 1 200 5 is_stmt 1 discriminator 4 view .LVU174
+	movq	%rbx, %rdi
+	call	*48(%rbx)
+.LVL69:
+	.loc 1 202 5 discriminator 4 view .LVU175
+	.loc 1 202 10 discriminator 4 view .LVU176
+	.loc 1 202 13 is_stmt 0 discriminator 4 view .LVU177
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L53
+.L47:
+	.loc 1 203 1 view .LVU178
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL70:
+	.loc 1 203 1 view .LVU179
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL71:
+	.loc 1 203 1 view .LVU180
+	ret
+.LVL72:
+.L52:
+	.cfi_restore_state
+	.loc 1 196 50 discriminator 1 view .LVU181
+	call	beep_timeline_now@PLT
+.LVL73:
+	movq	%rax, %rbp
+	jmp	.L48
+.LVL74:
+.L53:
+	.loc 1 202 34 is_stmt 1 discriminator 1 view .LVU182
+	movl	$0, %r8d
+	movl	$0, %ecx
+	movq	%rbp, %rdx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL75:
+	.loc 1 202 8 discriminator 1 view .LVU183
+	.loc 1 203 1 is_stmt 0 discriminator 1 view .LVU184
+	jmp	.L47
+	.cfi_endproc
+.LFE48:
+	.size	beep_drivers_end_tone, .-beep_drivers_end_tone
+	.section	.rodata.str1.1
+.LC5:
+	.string	"ms"
+.LC6:
+	.string	"sleep"
+.LC7:
+	.string	"wait"
+	.text
+	.globl	beep_drivers_wait
+	.type	beep_drivers_wait, @function
+beep_drivers_wait:
+.LVL76:
+.LFB49:
+	.loc 1 207 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 207 1 is_stmt 0 view .LVU186
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbx
+	movl	%esi, %ebp
+	.loc 1 207 1 view .LVU187
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 208 5 is_stmt 1 view .LVU188
+	.loc 1 208 9 view .LVU189
+	.loc 1 208 8 view .LVU190
+	.loc 1 209 5 view .LVU191
+	.loc 1 209 70 is_stmt 0 view .LVU192
+	movl	$0, %r12d
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L63
+.LVL77:
+.L55:
+	.loc 1 210 5 is_stmt 1 discriminator 4 view .LVU193
+	.loc 1 211 5 discriminator 4 view .LVU194
+	.loc 1 211 15 is_stmt 0 discriminator 4 view .LVU195
+	movq	56(%rbx), %rax
+	.loc 1 211 8 discriminator 4 view .LVU196
+	testq	%rax, %rax
+	je	.L56
+	.loc 1 212 9 is_stmt 1 view .LVU197
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL78:
+	.loc 1 210 9 is_stmt 0 view .LVU198
+	movl	$0, %ebx
+.LVL79:
+.L57:
+	.loc 1 221 5 is_stmt 1 view .LVU199
+	.loc 1 221 10 view .LVU200
+	.loc 1 221 13 is_stmt 0 view .LVU201
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L64
+.L54:
+	.loc 1 224 1 view .LVU202
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L65
+	movl	%ebx, %eax
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL80:
+	.loc 1 224 1 view .LVU203
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL81:
+	.loc 1 224 1 view .LVU204
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL82:
+	.loc 1 224 1 view .LVU205
+	ret
+.LVL83:
+.L63:
+	.cfi_restore_state
+	.loc 1 209 50 discriminator 1 view .LVU206
+	call	beep_timeline_now@PLT
+.LVL84:
+	.loc 1 209 50 discriminator 1 view .LVU207
+	movq	%rax, %r12
+	jmp	.L55
+.LVL85:
+.L56:
+	.loc 1 213 12 is_stmt 1 view .LVU208
+	.loc 1 210 9 is_stmt 0 view .LVU209
+	movl	$0, %ebx
+.LVL86:
+	.loc 1 213 15 view .LVU210
+	testl	%ebp, %ebp
+	je	.L57
+.LBB24:
+	.loc 1 214 9 is_stmt 1 view .LVU211
+.LVL87:
+	.loc 1 215 9 view .LVU212
+	.loc 1 216 9 view .LVU213
+	.loc 1 214 45 is_stmt 0 view .LVU214
+	movl	%ebp, %eax
+	imulq	$274877907, %rax, %rax
+	shrq	$38, %rax
+	.loc 1 214 22 view .LVU215
+	movl	%eax, %edx
+	movq	%rdx, (%rsp)
+	.loc 1 215 48 view .LVU216
+	imull	$1000, %eax, %eax
+	movl	%ebp, %edx
+	subl	%eax, %edx
+	.loc 1 215 67 view .LVU217
+	imulq	$1000000, %rdx, %rax
+	.loc 1 216 31 view .LVU218
+	movq	%rax, 8(%rsp)
+	.loc 1 219 9 is_stmt 1 view .LVU219
+	.loc 1 219 18 is_stmt 0 view .LVU220
+	movq	%rsp, %rdi
+	movl	$0, %esi
+	call	nanosleep@PLT
+.LVL88:
+	movl	%eax, %ebx
+.LVL89:
+	.loc 1 219 18 view .LVU221
+	jmp	.L57
+.LVL90:
+.L64:
+	.loc 1 219 18 view .LVU222
+.LBE24:
+	.loc 1 221 34 is_stmt 1 discriminator 1 view .LVU223
+	movl	%ebp, %r8d
+	leaq	.LC5(%rip), %rcx
+	movq	%r12, %rdx
+	leaq	.LC6(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL91:
+	.loc 1 221 8 discriminator 1 view .LVU224
+	.loc 1 222 5 discriminator 1 view .LVU225
+	.loc 1 222 9 discriminator 1 view .LVU226
+	.loc 1 222 8 discriminator 1 view .LVU227
+	.loc 1 223 5 discriminator 1 view .LVU228
+	.loc 1 223 12 is_stmt 0 discriminator 1 view .LVU229
+	jmp	.L54
+.L65:
+	.loc 1 224 1 view .LVU230
+	call	__stack_chk_fail@PLT
+.LVL92:
+	.cfi_endproc
+.LFE49:
+	.size	beep_drivers_wait, .-beep_drivers_wait
+	.section	.rodata.str1.1
+.LC8:
+	.string	"count"
+.LC9:
+	.string	"tones"
+.LC10:
+	.string	"play_sequence"
+	.text
+	.globl	beep_drivers_play_sequence
+	.type	beep_drivers_play_sequence, @function
+beep_drivers_play_sequence:
+.LVL93:
+.LFB50:
+	.loc 1 231 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 231 1 is_stmt 0 view .LVU232
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	movq	%rdx, %r14
+	movq	%rcx, %r12
+	.loc 1 232 5 is_stmt 1 view .LVU233
+	.loc 1 232 9 view .LVU234
+	.loc 1 232 8 view .LVU235
+	.loc 1 233 5 view .LVU236
+	.loc 1 233 70 is_stmt 0 view .LVU237
+	movl	$0, %r15d
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L80
+.LVL94:
+.L67:
+	.loc 1 234 5 is_stmt 1 discriminator 4 view .LVU238
+	.loc 1 234 15 is_stmt 0 discriminator 4 view .LVU239
+	movq	64(%rbp), %rax
+	.loc 1 234 8 discriminator 4 view .LVU240
+	testq	%rax, %rax
+	je	.L81
+	.loc 1 235 9 is_stmt 1 view .LVU241
+	movq	%r12, %rcx
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	*%rax
+.LVL95:
+.L71:
+	.loc 1 246 5 view .LVU242
+	.loc 1 246 10 view .LVU243
+	.loc 1 246 13 is_stmt 0 view .LVU244
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L82
+.L66:
+	.loc 1 248 1 view .LVU245
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL96:
+	.loc 1 248 1 view .LVU246
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL97:
+	.loc 1 248 1 view .LVU247
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL98:
+	.loc 1 248 1 view .LVU248
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL99:
+	.loc 1 248 1 view .LVU249
+	ret
+.LVL100:
+.L80:
+	.cfi_restore_state
+	.loc 1 233 50 discriminator 1 view .LVU250
+	call	beep_timeline_now@PLT
+.LVL101:
+	.loc 1 233 50 discriminator 1 view .LVU251
+	movq	%rax, %r15
+	jmp	.L67
+.LVL102:
+.L81:
+.LBB25:
+	.loc 1 237 41 is_stmt 1 view .LVU252
+	.loc 1 237 28 is_stmt 0 view .LVU253
+	movl	(%r12), %eax
+	.loc 1 237 41 view .LVU254
+	testq	%r14, %r14
+	je	.L71
+	.loc 1 237 21 view .LVU255
+	movl	$0, %r13d
+	.loc 1 237 41 view .LVU256
+	testl	%eax, %eax
+	je	.L73
+	jmp	.L71
+.LVL103:
+.L72:
+	.loc 1 237 55 is_stmt 1 discriminator 2 view .LVU257
+	addq	$1, %r13
+.LVL104:
+	.loc 1 237 41 discriminator 2 view .LVU258
+	.loc 1 237 28 is_stmt 0 discriminator 2 view .LVU259
+	movl	(%r12), %eax
+	.loc 1 237 41 discriminator 2 view .LVU260
+	addq	$16, %rbx
+	cmpq	%r14, %r13
+	jnb	.L71
+	testl	%eax, %eax
+	jne	.L71
+.LVL105:
+.L73:
+	.loc 1 238 13 is_stmt 1 view .LVU261
+	movzwl	(%rbx), %esi
+	movq	%rbp, %rdi
+	call	beep_drivers_begin_tone
+.LVL106:
+	.loc 1 239 13 view .LVU262
+	movl	4(%rbx), %esi
+	movq	%rbp, %rdi
+	call	beep_drivers_wait
+.LVL107:
+	.loc 1 240 13 view .LVU263
+	movq	%rbp, %rdi
+	call	beep_drivers_end_tone
+.LVL108:
+	.loc 1 241 13 view .LVU264
+	.loc 1 241 19 is_stmt 0 view .LVU265
+	movl	(%r12), %eax
+	.loc 1 241 16 view .LVU266
+	testl	%eax, %eax
+	jne	.L72
+	.loc 1 241 44 discriminator 1 view .LVU267
+	movl	8(%rbx), %esi
+	.loc 1 241 32 discriminator 1 view .LVU268
+	testl	%esi, %esi
+	je	.L72
+	.loc 1 242 17 is_stmt 1 view .LVU269
+	movq	%rbp, %rdi
+	call	beep_drivers_wait
+.LVL109:
+	jmp	.L72
+.LVL110:
+.L82:
+	.loc 1 242 17 is_stmt 0 view .LVU270
+.LBE25:
+	.loc 1 246 34 is_stmt 1 discriminator 1 view .LVU271
+	movl	%r14d, %r8d
+	leaq	.LC8(%rip), %rcx
+	movq	%r15, %rdx
+	leaq	.LC9(%rip), %rsi
+	leaq	.LC10(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL111:
+	.loc 1 246 8 discriminator 1 view .LVU272
+	.loc 1 247 5 discriminator 1 view .LVU273
+	.loc 1 247 9 discriminator 1 view .LVU274
+	.loc 1 247 8 discriminator 1 view .LVU275
+	.loc 1 248 1 is_stmt 0 discriminator 1 view .LVU276
+	jmp	.L66
+	.cfi_endproc
+.LFE50:
+	.size	beep_drivers_play_sequence, .-beep_drivers_play_sequence
+	.local	first_driver
+	.comm	first_driver,8,8
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "beep-driver.h"
+	.file 9 "beep-library.h"
+	.file 10 "beep-log.h"
+	.file 11 "beep-timeline.h"
+	.file 12 "/usr/include/time.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/errno.h"
+	.file 15 "/usr/include/stdlib.h"
+	.file 16 "/usr/include/unistd.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xce3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF96
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x6
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x4b
+	.uleb128 0x6
+	.long	0x3a
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	0x52
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x6
+	.long	0x73
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x3
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x6c
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x73
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x4b
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x7
+	.long	0xd0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0x6
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x3
+	.byte	0xd7
+	.byte	0xd
+	.long	0x52
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x4
+	.byte	0xa
+	.byte	0x12
+	.long	0xb1
+	.uleb128 0x6
+	.long	0xe8
+	.uleb128 0x13
+	.long	.LASF27
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb
+	.long	0x120
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x10
+	.byte	0xc
+	.long	0xb1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x15
+	.byte	0x15
+	.long	0xbf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xf9
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF21
+	.uleb128 0x7
+	.long	0xd7
+	.uleb128 0x6
+	.long	0x12c
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x8
+	.byte	0x18
+	.long	0xdc
+	.uleb128 0x6
+	.long	0x136
+	.uleb128 0x22
+	.long	0x142
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x19
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x6
+	.long	0x14c
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0x99
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa5
+	.uleb128 0x6
+	.long	0x169
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x186
+	.uleb128 0x13
+	.long	.LASF28
+	.byte	0x70
+	.byte	0x8
+	.byte	0x43
+	.long	0x249
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x44
+	.byte	0xb
+	.long	0xcb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x45
+	.byte	0x12
+	.long	0x2c4
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x47
+	.byte	0x1d
+	.long	0x298
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1b
+	.long	0x2f3
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x49
+	.byte	0x1b
+	.long	0x30f
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x21
+	.long	0x31b
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x33c
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x52
+	.byte	0x1b
+	.long	0x348
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x59
+	.byte	0x24
+	.long	0x369
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x61
+	.byte	0x1c
+	.long	0x2ce
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x62
+	.byte	0x18
+	.long	0x3a8
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x8
+	.byte	0x67
+	.byte	0x9
+	.long	0x52
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x68
+	.byte	0x11
+	.long	0x12c
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xb
+	.long	0xbd
+	.byte	0x68
+	.byte	0
+	.uleb128 0x23
+	.byte	0x10
+	.byte	0x8
+	.byte	0x22
+	.byte	0x9
+	.long	0x287
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x23
+	.byte	0xe
+	.long	0x15d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x24
+	.byte	0xe
+	.long	0x15d
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0x15d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0x15d
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x249
+	.uleb128 0x6
+	.long	0x287
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x32
+	.byte	0xf
+	.long	0x2a4
+	.uleb128 0x7
+	.long	0x2a9
+	.uleb128 0x14
+	.long	0x2bd
+	.long	0x2bd
+	.uleb128 0x2
+	.long	0x2c4
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF49
+	.uleb128 0x7
+	.long	0x17a
+	.uleb128 0x6
+	.long	0x2c4
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x2da
+	.uleb128 0x7
+	.long	0x2df
+	.uleb128 0x14
+	.long	0x2bd
+	.long	0x2f3
+	.uleb128 0x2
+	.long	0x2c4
+	.uleb128 0x2
+	.long	0x59
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x36
+	.byte	0x10
+	.long	0x2ff
+	.uleb128 0x7
+	.long	0x304
+	.uleb128 0xf
+	.long	0x30f
+	.uleb128 0x2
+	.long	0x2c4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x37
+	.byte	0x10
+	.long	0x2ff
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x38
+	.byte	0x10
+	.long	0x327
+	.uleb128 0x7
+	.long	0x32c
+	.uleb128 0xf
+	.long	0x33c
+	.uleb128 0x2
+	.long	0x2c4
+	.uleb128 0x2
+	.long	0x158
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x10
+	.long	0x2ff
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x10
+	.long	0x354
+	.uleb128 0x7
+	.long	0x359
+	.uleb128 0xf
+	.long	0x369
+	.uleb128 0x2
+	.long	0x2c4
+	.uleb128 0x2
+	.long	0x7a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x10
+	.long	0x375
+	.uleb128 0x7
+	.long	0x37a
+	.uleb128 0xf
+	.long	0x394
+	.uleb128 0x2
+	.long	0x2c4
+	.uleb128 0x2
+	.long	0x399
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x3a3
+	.byte	0
+	.uleb128 0x7
+	.long	0x293
+	.uleb128 0x6
+	.long	0x394
+	.uleb128 0x7
+	.long	0x147
+	.uleb128 0x6
+	.long	0x39e
+	.uleb128 0x7
+	.long	0x131
+	.uleb128 0x10
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x15
+	.long	0x73
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0x52
+	.uleb128 0x10
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x21
+	.byte	0xc
+	.long	0x2bd
+	.uleb128 0x15
+	.long	.LASF79
+	.byte	0x2f
+	.byte	0xe
+	.long	0x2c4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	first_driver
+	.uleb128 0x11
+	.long	.LASF60
+	.byte	0xc
+	.value	0x119
+	.byte	0xc
+	.long	0x52
+	.long	0x402
+	.uleb128 0x2
+	.long	0x402
+	.uleb128 0x2
+	.long	0x407
+	.byte	0
+	.uleb128 0x7
+	.long	0x120
+	.uleb128 0x7
+	.long	0xf9
+	.uleb128 0x16
+	.long	.LASF64
+	.byte	0xb
+	.byte	0x35
+	.long	0x431
+	.uleb128 0x2
+	.long	0x131
+	.uleb128 0x2
+	.long	0x131
+	.uleb128 0x2
+	.long	0x175
+	.uleb128 0x2
+	.long	0x131
+	.uleb128 0x2
+	.long	0x7a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xa
+	.long	0x169
+	.uleb128 0x18
+	.long	.LASF61
+	.byte	0xd
+	.byte	0x9c
+	.byte	0xc
+	.long	0x52
+	.long	0x458
+	.uleb128 0x2
+	.long	0x12c
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF63
+	.byte	0xe
+	.byte	0x25
+	.byte	0xd
+	.long	0x464
+	.uleb128 0x7
+	.long	0x52
+	.uleb128 0x24
+	.long	.LASF65
+	.byte	0xf
+	.value	0x238
+	.byte	0xd
+	.long	0x47c
+	.uleb128 0x2
+	.long	0xbd
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF66
+	.byte	0x9
+	.byte	0x27
+	.byte	0x5
+	.long	0x52
+	.long	0x492
+	.uleb128 0x2
+	.long	0x131
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF67
+	.byte	0x10
+	.value	0x166
+	.byte	0xc
+	.long	0x52
+	.long	0x4a9
+	.uleb128 0x2
+	.long	0x52
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF68
+	.byte	0xf
+	.value	0x229
+	.byte	0xe
+	.long	0xbd
+	.long	0x4c0
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x43
+	.long	0x4d2
+	.uleb128 0x2
+	.long	0x131
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF81
+	.byte	0xe3
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x646
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xe3
+	.byte	0x2e
+	.long	0x2c4
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0xe4
+	.byte	0x38
+	.long	0x399
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0xe5
+	.byte	0x2e
+	.long	0x46
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x5
+	.long	.LASF73
+	.byte	0xe6
+	.byte	0x44
+	.long	0x3a3
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0xe9
+	.byte	0x14
+	.long	0x175
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x19
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.long	0x5d1
+	.uleb128 0x26
+	.string	"i"
+	.byte	0x1
+	.byte	0xed
+	.byte	0x15
+	.long	0x3a
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0xb
+	.quad	.LVL106
+	.long	0x82c
+	.long	0x58c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL107
+	.long	0x646
+	.long	0x5a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL108
+	.long	0x790
+	.long	0x5bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL109
+	.long	0x646
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL95
+	.long	0x5f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL101
+	.long	0x431
+	.uleb128 0xa
+	.quad	.LVL111
+	.long	0x40c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF86
+	.byte	0xce
+	.byte	0x5
+	.long	0x52
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x790
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xce
+	.byte	0x24
+	.long	0x2c4
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x5
+	.long	.LASF75
+	.byte	0xce
+	.byte	0x3f
+	.long	0x7a
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0xd1
+	.byte	0x14
+	.long	0x175
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x8
+	.long	.LASF76
+	.byte	0xd2
+	.byte	0x9
+	.long	0x52
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.long	0x716
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0xd6
+	.byte	0x16
+	.long	0xf4
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.long	.LASF78
+	.byte	0xd7
+	.byte	0x14
+	.long	0x35
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x15
+	.long	.LASF80
+	.byte	0xd8
+	.byte	0x1f
+	.long	0x120
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.quad	.LVL88
+	.long	0x3e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL78
+	.long	0x730
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL84
+	.long	0x431
+	.uleb128 0xb
+	.quad	.LVL91
+	.long	0x40c
+	.long	0x782
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL92
+	.long	0xcdd
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF82
+	.byte	0xc1
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82c
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xc1
+	.byte	0x29
+	.long	0x2c4
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0xc4
+	.byte	0x14
+	.long	0x175
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xc
+	.quad	.LVL69
+	.long	0x7e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL73
+	.long	0x431
+	.uleb128 0xa
+	.quad	.LVL75
+	.long	0x40c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF83
+	.byte	0xb4
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f2
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xb4
+	.byte	0x2b
+	.long	0x2c4
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0xb4
+	.byte	0x42
+	.long	0x158
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0xb7
+	.byte	0x14
+	.long	0x175
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xc
+	.quad	.LVL60
+	.long	0x89f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL64
+	.long	0x431
+	.uleb128 0xa
+	.quad	.LVL66
+	.long	0x40c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF84
+	.byte	0xa9
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x94a
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xa9
+	.byte	0x25
+	.long	0x2c4
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xc
+	.quad	.LVL55
+	.long	0x935
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL56
+	.long	0x469
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF85
+	.byte	0x9f
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x98b
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0x9f
+	.byte	0x25
+	.long	0x2c4
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1a
+	.quad	.LVL53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF87
+	.byte	0x89
+	.byte	0xe
+	.long	0x2c4
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa44
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0x89
+	.byte	0x33
+	.long	0x131
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x5
+	.long	.LASF40
+	.byte	0x8a
+	.byte	0x2b
+	.long	0x59
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0x8b
+	.byte	0x33
+	.long	0x131
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1b
+	.long	.LLRL16
+	.uleb128 0x8
+	.long	.LASF70
+	.byte	0x8d
+	.byte	0x17
+	.long	0x2c4
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1c
+	.long	.LLRL18
+	.long	0xa2e
+	.uleb128 0x8
+	.long	.LASF89
+	.byte	0x8f
+	.byte	0x20
+	.long	0x2c9
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xa
+	.quad	.LVL45
+	.long	0x4a9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL43
+	.long	0x43d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF90
+	.byte	0x54
+	.byte	0xe
+	.long	0x2c4
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc53
+	.uleb128 0x5
+	.long	.LASF91
+	.byte	0x54
+	.byte	0x34
+	.long	0x131
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x8
+	.long	.LASF92
+	.byte	0x59
+	.byte	0x9
+	.long	0x52
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.long	.LASF93
+	.byte	0x5a
+	.byte	0x9
+	.long	0x2bd
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1c
+	.long	.LLRL4
+	.long	0xc0c
+	.uleb128 0x8
+	.long	.LASF70
+	.byte	0x5c
+	.byte	0x17
+	.long	0x2c4
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1b
+	.long	.LLRL6
+	.uleb128 0x8
+	.long	.LASF89
+	.byte	0x60
+	.byte	0x1c
+	.long	0x2c9
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x27
+	.long	0xc53
+	.quad	.LBI11
+	.byte	.LVU52
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.byte	0x1
+	.byte	0x6f
+	.byte	0x11
+	.long	0xb7a
+	.uleb128 0x28
+	.long	0xc64
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x29
+	.long	0xc70
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x1d
+	.long	0xc71
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2a
+	.long	0xc7d
+	.long	.LLRL10
+	.uleb128 0x1d
+	.long	0xc7e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xb
+	.quad	.LVL23
+	.long	0x492
+	.long	0xb54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL26
+	.long	0x47c
+	.uleb128 0x1a
+	.quad	.LVL28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL9
+	.long	0xb94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL11
+	.long	0x469
+	.long	0xbac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL14
+	.long	0x4a9
+	.long	0xbc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x70
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL17
+	.long	0xbde
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL19
+	.long	0x492
+	.long	0xbf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL31
+	.long	0x47c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x8
+	.long	.LASF94
+	.byte	0x81
+	.byte	0x13
+	.long	0x59
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xd
+	.quad	.LVL36
+	.long	0x458
+	.uleb128 0xa
+	.quad	.LVL38
+	.long	0x492
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF97
+	.byte	0x1
+	.byte	0x42
+	.byte	0x5
+	.long	0x2bd
+	.byte	0x1
+	.long	0xc8c
+	.uleb128 0x2d
+	.long	.LASF89
+	.byte	0x1
+	.byte	0x42
+	.byte	0x28
+	.long	0x2c4
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x44
+	.byte	0x1d
+	.long	0x3a8
+	.uleb128 0x1e
+	.uleb128 0x2f
+	.string	"fd"
+	.byte	0x1
+	.byte	0x46
+	.byte	0x13
+	.long	0x59
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF95
+	.byte	0x32
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcdd
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0x32
+	.byte	0x29
+	.long	0x2c4
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.quad	.LVL4
+	.long	0x4c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF98
+	.long	.LASF98
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU238
+	.uleb128 .LVU249
+	.uleb128 .LVU252
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU252
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU270
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU193
+	.uleb128 .LVU205
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU194
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU212
+	.uleb128 .LVU222
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x1b
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU213
+	.uleb128 .LVU222
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x13
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x1d
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xf4240
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU174
+	.uleb128 .LVU180
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU155
+	.uleb128 .LVU161
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU109
+	.uleb128 .LVU131
+	.uleb128 .LVU136
+	.uleb128 .LVU137
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU117
+	.uleb128 .LVU131
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU15
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU16
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU19
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU97
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU22
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU28
+	.uleb128 .LVU30
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU93
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU52
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU76
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU56
+	.uleb128 .LVU76
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU57
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU76
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU97
+	.uleb128 .LVU103
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	first_driver
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF67:
+	.string	"close"
+.LASF63:
+	.string	"__errno_location"
+.LASF87:
+	.string	"beep_drivers_adopt"
+.LASF20:
+	.string	"tv_nsec"
+.LASF66:
+	.string	"open_checked_char_device"
+.LASF43:
+	.string	"freq"
+.LASF13:
+	.string	"__uint64_t"
+.LASF19:
+	.string	"tv_sec"
+.LASF25:
+	.string	"uint64_t"
+.LASF90:
+	.string	"beep_drivers_detect"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF68:
+	.string	"malloc"
+.LASF39:
+	.string	"default_devices"
+.LASF34:
+	.string	"begin_tone"
+.LASF91:
+	.string	"console_device"
+.LASF93:
+	.string	"shared_opened"
+.LASF15:
+	.string	"__syscall_slong_t"
+.LASF45:
+	.string	"delay"
+.LASF79:
+	.string	"first_driver"
+.LASF11:
+	.string	"__uint16_t"
+.LASF76:
+	.string	"retval"
+.LASF48:
+	.string	"beep_driver_detect_func"
+.LASF55:
+	.string	"beep_driver_wait_func"
+.LASF71:
+	.string	"tones"
+.LASF61:
+	.string	"strcmp"
+.LASF18:
+	.string	"time_t"
+.LASF59:
+	.string	"timeline_enabled"
+.LASF40:
+	.string	"device_fd"
+.LASF54:
+	.string	"beep_driver_end_tone_func"
+.LASF65:
+	.string	"free"
+.LASF95:
+	.string	"beep_drivers_register"
+.LASF44:
+	.string	"length"
+.LASF92:
+	.string	"shared_fd"
+.LASF31:
+	.string	"detect"
+.LASF75:
+	.string	"milliseconds"
+.LASF4:
+	.string	"long long int"
+.LASF74:
+	.string	"start_ns"
+.LASF53:
+	.string	"beep_driver_begin_tone_func"
+.LASF2:
+	.string	"long int"
+.LASF26:
+	.string	"beep_driver"
+.LASF22:
+	.string	"sig_atomic_t"
+.LASF83:
+	.string	"beep_drivers_begin_tone"
+.LASF57:
+	.string	"syscall_count"
+.LASF29:
+	.string	"name"
+.LASF97:
+	.string	"probe_default_devices"
+.LASF42:
+	.string	"driver_data"
+.LASF73:
+	.string	"abort_flag"
+.LASF17:
+	.string	"__sig_atomic_t"
+.LASF5:
+	.string	"unsigned char"
+.LASF41:
+	.string	"device_name"
+.LASF88:
+	.string	"driver_name"
+.LASF8:
+	.string	"signed char"
+.LASF46:
+	.string	"flags"
+.LASF21:
+	.string	"long long unsigned int"
+.LASF24:
+	.string	"uint32_t"
+.LASF7:
+	.string	"unsigned int"
+.LASF23:
+	.string	"uint16_t"
+.LASF28:
+	.string	"_beep_driver"
+.LASF89:
+	.string	"instance"
+.LASF38:
+	.string	"probe"
+.LASF70:
+	.string	"driver"
+.LASF80:
+	.string	"request"
+.LASF69:
+	.string	"log_verbose"
+.LASF64:
+	.string	"beep_timeline_span"
+.LASF77:
+	.string	"seconds"
+.LASF52:
+	.string	"beep_driver_fini_func"
+.LASF94:
+	.string	"saved_errno"
+.LASF16:
+	.string	"char"
+.LASF32:
+	.string	"init"
+.LASF81:
+	.string	"beep_drivers_play_sequence"
+.LASF51:
+	.string	"beep_driver_init_func"
+.LASF58:
+	.string	"log_level"
+.LASF6:
+	.string	"short unsigned int"
+.LASF47:
+	.string	"beep_tone"
+.LASF35:
+	.string	"end_tone"
+.LASF49:
+	.string	"_Bool"
+.LASF78:
+	.string	"nanoseconds"
+.LASF37:
+	.string	"play_sequence"
+.LASF85:
+	.string	"beep_drivers_init"
+.LASF33:
+	.string	"fini"
+.LASF3:
+	.string	"long unsigned int"
+.LASF14:
+	.string	"__time_t"
+.LASF12:
+	.string	"__uint32_t"
+.LASF84:
+	.string	"beep_drivers_fini"
+.LASF56:
+	.string	"beep_driver_play_sequence_func"
+.LASF62:
+	.string	"beep_timeline_now"
+.LASF72:
+	.string	"count"
+.LASF86:
+	.string	"beep_drivers_wait"
+.LASF60:
+	.string	"nanosleep"
+.LASF50:
+	.string	"beep_driver_probe_func"
+.LASF27:
+	.string	"timespec"
+.LASF82:
+	.string	"beep_drivers_end_tone"
+.LASF98:
+	.string	"__stack_chk_fail"
+.LASF96:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF30:
+	.string	"next"
+.LASF36:
+	.string	"wait"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-drivers.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -17,6 +17,8 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -30,11 +32,14 @@
 #include "beep-log.h"
 
 
+unsigned int syscall_count = 0;
+
+
 int open_checked_char_device(const char *const device_name)
 {
     struct stat sb;
 
-    if (-1 == stat(device_name, &sb)) {
+    if (-1 == COUNT_SYSCALL(stat(device_name, &sb))) {
         log_verbose("b-lib: could not stat(2) %s: %s",
                     device_name, strerror(errno));
         return -1;
@@ -46,7 +51,7 @@ int open_checked_char_device(const char *const device_name)
         return -1;
     }
 
-    const int fd = open(device_name, O_WRONLY);
+    const int fd = COUNT_SYSCALL(open(device_name, O_WRONLY));
     if (fd == -1) {
         log_verbose("b-lib: could not open(2) %s: %s",
                     device_name, strerror(errno));
@@ -54,14 +59,16 @@ int open_checked_char_device(const char *const device_name)
     }
     log_verbose("b-lib: opened %s as %d", device_name, fd);
 
-    if (-1 == fstat(fd, &sb)) {
+    if (-1 == COUNT_SYSCALL(fstat(fd, &sb))) {
         log_verbose("b-lib: could not fstat(2) %d: %s",
                     fd, strerror(errno));
+        COUNT_SYSCALL(close(fd));
         return -1;
     }
 
     if (!S_ISCHR(sb.st_mode)) {
         log_verbose("b-lib: %d is not a character device", fd);
+        COUNT_SYSCALL(close(fd));
         return -1;
     }
 
@@ -69,6 +76,130 @@ int open_checked_char_device(const char *const device_name)
 }
 
 
+int write_all(const int fd, const void *const buf, const size_t count)
+{
+    const char *ptr = buf;
+    size_t remaining = count;
+
+    while (remaining > 0) {
+        const ssize_t written = COUNT_SYSCALL(write(fd, ptr, remaining));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        ptr += written;
+        remaining -= (size_t)written;
+    }
+    return 0;
+}
+
+
+static
+const char *skip_space(const char *str)
+{
+    while ((*str == ' ') || ((*str >= '\t') && (*str <= '\r'))) {
+        ++str;
+    }
+    return str;
+}
+
+
+const char *parse_uint_value(const char *str, const unsigned int max,
+                             unsigned int *const result)
+{
+    str = skip_space(str);
+    if (*str == '+') {
+        ++str;
+    }
+    if ((*str < '0') || (*str > '9')) {
+        return NULL;
+    }
+    unsigned long value = 0;
+    for (; (*str >= '0') && (*str <= '9'); ++str) {
+        value = 10 * value + (unsigned long)(*str - '0');
+        if (value > max) {
+            return NULL;
+        }
+    }
+    *result = (unsigned int)value;
+    return str;
+}
+
+
+const char *parse_rounded_value(const char *str, const unsigned int max,
+                                unsigned int *const result)
+{
+    str = skip_space(str);
+    bool negative = false;
+    if ((*str == '+') || (*str == '-')) {
+        negative = (*str == '-');
+        ++str;
+    }
+
+    /* Up to 19 significant digits fit into the mantissa */
+    uint64_t mantissa = 0;
+    int      digits   = 0;
+    int      exponent = 0;
+    bool     seen_digit = false;
+    for (; (*str >= '0') && (*str <= '9'); ++str) {
+        seen_digit = true;
+        if (digits < 19) {
+            mantissa = 10 * mantissa + (uint64_t)(*str - '0');
+            digits += (mantissa > 0);
+        } else {
+            ++exponent;
+        }
+    }
+    if (*str == '.') {
+        for (++str; (*str >= '0') && (*str <= '9'); ++str) {
+            seen_digit = true;
+            if (digits < 19) {
+                mantissa = 10 * mantissa + (uint64_t)(*str - '0');
+                digits += (mantissa > 0);
+                --exponent;
+            }
+        }
+    }
+    if (!seen_digit) {
+        return NULL;
+    }
+    if ((*str == 'e') || (*str == 'E')) {
+        const char *exp_str = str + 1;
+        bool exp_negative = false;
+        if ((*exp_str == '+') || (*exp_str == '-')) {
+            exp_negative = (*exp_str == '-');
+            ++exp_str;
+        }
+        if ((*exp_str >= '0') && (*exp_str <= '9')) {
+            int exp_value = 0;
+            for (; (*exp_str >= '0') && (*exp_str <= '9'); ++exp_str) {
+                if (exp_value < 1000) {
+                    exp_value = 10 * exp_value + (*exp_str - '0');
+                }
+            }
+            exponent += exp_negative ? -exp_value : exp_value;
+            str = exp_str;
+        }
+    }
+
+    double value = (double)mantissa;
+    for (; (exponent > 0) && (value <= max); --exponent) {
+        value *= 10.0;
+    }
+    for (; (exponent < 0) && (value > 0.0); ++exponent) {
+        value /= 10.0;
+    }
+    if ((negative && (value > 0.0)) || (value > max)) {
+        return NULL;
+    }
+    /* Round like the (int)(f + 0.5f) the sscanf(3) "%f" code used */
+    *result = (unsigned int)((float)value + 0.5f);
+    return str;
+}
+
+
 /* We do not know for certain whether perror does strange things with
  * global variables or malloc/free inside its code.
  */
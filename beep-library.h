@@ -21,10 +21,53 @@
 #define BEEP_LIBRARY_H
 
 
+#include <stddef.h>
+
+
+/* Number of system calls made through COUNT_SYSCALL() so far, which
+ * --verbose reports for the device detection at startup.
+ */
+extern unsigned int syscall_count;
+
+#define COUNT_SYSCALL(call) (++syscall_count, (call))
+
+
+/* Open device_name for writing if it is a character device, checking
+ * with stat(2) before and fstat(2) after the open(2).  Returns the fd,
+ * or -1 without leaving anything open.
+ */
 int open_checked_char_device(const char *const device_name)
     __attribute__(( nonnull(1) ));
 
 
+/* Write all count bytes, retrying on short writes and EINTR.
+ * Returns 0 on success, and -1 with errno set on error.
+ */
+int write_all(const int fd, const void *const buf, const size_t count)
+    __attribute__(( nonnull(2) ));
+
+
+/* Parse an unsigned decimal number like sscanf(3) "%u" does, i.e.
+ * skipping leading white space and stopping at the first non-digit,
+ * without the locale and stdio machinery.  Returns a pointer to the
+ * first character after the number, or NULL for values above max and
+ * if there is no digit.
+ */
+const char *parse_uint_value(const char *str, const unsigned int max,
+                             unsigned int *const result)
+    __attribute__(( nonnull(1, 3) ));
+
+
+/* Parse a decimal number with optional fraction and exponent like
+ * "523.25" or "1.5e3", rounded to the nearest integer.  Returns a
+ * pointer to the first character after the number, or NULL for
+ * negative values, values above max, and if there is no digit.
+ */
+const char *parse_rounded_value(const char *str, const unsigned int max,
+                                unsigned int *const result)
+    __attribute__(( nonnull(1, 3) ));
+
+
 void safe_error_exit(const char *const msg)
     __attribute__(( nonnull(1), noreturn ));
 
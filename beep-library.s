@@ -0,0 +1,4435 @@
+	.file	"beep-library.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-library.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"b-lib: could not stat(2) %s: %s"
+	.align 8
+.LC1:
+	.string	"b-lib: %s is not a character device"
+	.align 8
+.LC2:
+	.string	"b-lib: could not open(2) %s: %s"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"b-lib: opened %s as %d"
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"b-lib: could not fstat(2) %d: %s"
+	.align 8
+.LC5:
+	.string	"b-lib: %d is not a character device"
+	.text
+	.globl	open_checked_char_device
+	.type	open_checked_char_device, @function
+open_checked_char_device:
+.LVL0:
+.LFB43:
+	.file 1 "beep-library.c"
+	.loc 1 39 1 view -0
+	.cfi_startproc
+	.loc 1 39 1 is_stmt 0 view .LVU1
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movq	%rdi, %rbp
+	.loc 1 39 1 view .LVU2
+	movq	%fs:40, %rax
+	movq	%rax, 152(%rsp)
+	xorl	%eax, %eax
+	.loc 1 40 5 is_stmt 1 view .LVU3
+	.loc 1 42 5 view .LVU4
+	.loc 1 42 16 is_stmt 0 view .LVU5
+	addl	$1, syscall_count(%rip)
+	.loc 1 42 34 view .LVU6
+	movq	%rsp, %rsi
+	call	stat@PLT
+.LVL1:
+	.loc 1 42 8 view .LVU7
+	cmpl	$-1, %eax
+	je	.L13
+	.loc 1 48 5 is_stmt 1 view .LVU8
+	.loc 1 48 12 is_stmt 0 view .LVU9
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 48 8 view .LVU10
+	cmpl	$8192, %eax
+	jne	.L14
+	.loc 1 54 5 is_stmt 1 view .LVU11
+	.loc 1 54 21 is_stmt 0 view .LVU12
+	addl	$1, syscall_count(%rip)
+.LVL2:
+.LBB4:
+.LBI4:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 2 41 1 is_stmt 1 view .LVU13
+.LBB5:
+	.loc 2 43 3 view .LVU14
+	.loc 2 46 3 view .LVU15
+	.loc 2 48 7 view .LVU16
+	.loc 2 53 7 view .LVU17
+	.loc 2 53 14 is_stmt 0 view .LVU18
+	movl	$1, %esi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL3:
+	movl	%eax, %ebx
+.LVL4:
+	.loc 2 53 14 view .LVU19
+.LBE5:
+.LBE4:
+	.loc 1 55 5 is_stmt 1 view .LVU20
+	.loc 1 55 8 is_stmt 0 view .LVU21
+	cmpl	$-1, %eax
+	je	.L15
+	.loc 1 60 5 is_stmt 1 view .LVU22
+	.loc 1 60 10 view .LVU23
+	.loc 1 60 13 is_stmt 0 view .LVU24
+	cmpl	$0, log_level(%rip)
+	jg	.L16
+.LVL5:
+.L6:
+	.loc 1 60 8 is_stmt 1 discriminator 3 view .LVU25
+	.loc 1 62 5 discriminator 3 view .LVU26
+	.loc 1 62 16 is_stmt 0 discriminator 3 view .LVU27
+	addl	$1, syscall_count(%rip)
+	.loc 1 62 34 discriminator 3 view .LVU28
+	movq	%rsp, %rsi
+	movl	%ebx, %edi
+	call	fstat@PLT
+.LVL6:
+	movl	%eax, %ebp
+.LVL7:
+	.loc 1 62 8 discriminator 3 view .LVU29
+	cmpl	$-1, %eax
+	je	.L17
+	.loc 1 69 5 is_stmt 1 view .LVU30
+	.loc 1 69 12 is_stmt 0 view .LVU31
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 69 8 view .LVU32
+	cmpl	$8192, %eax
+	jne	.L18
+.LVL8:
+.L1:
+	.loc 1 76 1 view .LVU33
+	movq	152(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L19
+	movl	%ebx, %eax
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL9:
+.L13:
+	.cfi_restore_state
+	.loc 1 76 1 view .LVU34
+	movl	%eax, %ebx
+	.loc 1 43 9 is_stmt 1 view .LVU35
+	.loc 1 43 14 view .LVU36
+	.loc 1 43 17 is_stmt 0 view .LVU37
+	cmpl	$0, log_level(%rip)
+	jle	.L1
+	.loc 1 43 50 is_stmt 1 discriminator 1 view .LVU38
+	.loc 1 43 10 is_stmt 0 discriminator 1 view .LVU39
+	call	__errno_location@PLT
+.LVL10:
+	.loc 1 43 50 discriminator 1 view .LVU40
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL11:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC0(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL12:
+	jmp	.L1
+.L14:
+	.loc 1 49 9 is_stmt 1 view .LVU41
+	.loc 1 49 14 view .LVU42
+	.loc 1 51 16 is_stmt 0 view .LVU43
+	movl	$-1, %ebx
+	.loc 1 49 17 view .LVU44
+	cmpl	$0, log_level(%rip)
+	jle	.L1
+	.loc 1 49 50 is_stmt 1 discriminator 1 view .LVU45
+	movq	%rbp, %rsi
+	leaq	.LC1(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL13:
+	jmp	.L1
+.LVL14:
+.L15:
+	.loc 1 56 9 view .LVU46
+	.loc 1 56 14 view .LVU47
+	.loc 1 56 17 is_stmt 0 view .LVU48
+	cmpl	$0, log_level(%rip)
+	jle	.L1
+	.loc 1 56 50 is_stmt 1 discriminator 1 view .LVU49
+	.loc 1 56 10 is_stmt 0 discriminator 1 view .LVU50
+	call	__errno_location@PLT
+.LVL15:
+	.loc 1 56 50 discriminator 1 view .LVU51
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL16:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC2(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL17:
+	jmp	.L1
+.LVL18:
+.L16:
+	.loc 1 60 46 is_stmt 1 discriminator 1 view .LVU52
+	movl	%eax, %edx
+	movq	%rbp, %rsi
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+.LVL19:
+	.loc 1 60 46 is_stmt 0 discriminator 1 view .LVU53
+	call	log_verbose@PLT
+.LVL20:
+	jmp	.L6
+.LVL21:
+.L17:
+	.loc 1 63 9 is_stmt 1 view .LVU54
+	.loc 1 63 14 view .LVU55
+	.loc 1 63 17 is_stmt 0 view .LVU56
+	cmpl	$0, log_level(%rip)
+	jg	.L20
+.L8:
+	.loc 1 63 12 is_stmt 1 discriminator 3 view .LVU57
+	.loc 1 65 9 discriminator 3 view .LVU58
+	.loc 1 65 10 is_stmt 0 discriminator 3 view .LVU59
+	addl	$1, syscall_count(%rip)
+	.loc 1 65 28 discriminator 3 view .LVU60
+	movl	%ebx, %edi
+	call	close@PLT
+.LVL22:
+	.loc 1 66 9 is_stmt 1 discriminator 3 view .LVU61
+	.loc 1 66 16 is_stmt 0 discriminator 3 view .LVU62
+	movl	%ebp, %ebx
+.LVL23:
+	.loc 1 66 16 discriminator 3 view .LVU63
+	jmp	.L1
+.LVL24:
+.L20:
+	.loc 1 63 50 is_stmt 1 discriminator 1 view .LVU64
+	.loc 1 63 10 is_stmt 0 discriminator 1 view .LVU65
+	call	__errno_location@PLT
+.LVL25:
+	.loc 1 63 50 discriminator 1 view .LVU66
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL26:
+	movq	%rax, %rdx
+	movl	%ebx, %esi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL27:
+	jmp	.L8
+.L18:
+	.loc 1 70 9 is_stmt 1 view .LVU67
+	.loc 1 70 14 view .LVU68
+	.loc 1 70 17 is_stmt 0 view .LVU69
+	cmpl	$0, log_level(%rip)
+	jg	.L21
+.L9:
+	.loc 1 70 12 is_stmt 1 discriminator 3 view .LVU70
+	.loc 1 71 9 discriminator 3 view .LVU71
+	.loc 1 71 10 is_stmt 0 discriminator 3 view .LVU72
+	addl	$1, syscall_count(%rip)
+	.loc 1 71 28 discriminator 3 view .LVU73
+	movl	%ebx, %edi
+	call	close@PLT
+.LVL28:
+	.loc 1 72 9 is_stmt 1 discriminator 3 view .LVU74
+	.loc 1 72 16 is_stmt 0 discriminator 3 view .LVU75
+	movl	$-1, %ebx
+.LVL29:
+	.loc 1 72 16 discriminator 3 view .LVU76
+	jmp	.L1
+.LVL30:
+.L21:
+	.loc 1 70 50 is_stmt 1 discriminator 1 view .LVU77
+	movl	%ebx, %esi
+	leaq	.LC5(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL31:
+	jmp	.L9
+.LVL32:
+.L19:
+	.loc 1 76 1 is_stmt 0 view .LVU78
+	call	__stack_chk_fail@PLT
+.LVL33:
+	.cfi_endproc
+.LFE43:
+	.size	open_checked_char_device, .-open_checked_char_device
+	.globl	write_all
+	.type	write_all, @function
+write_all:
+.LVL34:
+.LFB44:
+	.loc 1 80 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 1 is_stmt 0 view .LVU80
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%edi, %r12d
+	movq	%rsi, %rbp
+	movq	%rdx, %rbx
+	.loc 1 81 5 is_stmt 1 view .LVU81
+.LVL35:
+	.loc 1 82 5 view .LVU82
+	.loc 1 84 5 view .LVU83
+	.loc 1 84 22 view .LVU84
+	testq	%rdx, %rdx
+	jne	.L26
+	.loc 1 95 12 is_stmt 0 view .LVU85
+	movl	$0, %eax
+	jmp	.L22
+.LVL36:
+.L24:
+.LBB6:
+	.loc 1 92 9 is_stmt 1 view .LVU86
+	.loc 1 92 13 is_stmt 0 view .LVU87
+	addq	%rax, %rbp
+.LVL37:
+	.loc 1 93 9 is_stmt 1 view .LVU88
+	.loc 1 93 19 is_stmt 0 view .LVU89
+	subq	%rax, %rbx
+.LVL38:
+.L25:
+	.loc 1 93 19 view .LVU90
+.LBE6:
+	.loc 1 84 22 is_stmt 1 view .LVU91
+	testq	%rbx, %rbx
+	je	.L30
+.LVL39:
+.L26:
+.LBB7:
+	.loc 1 85 9 view .LVU92
+	.loc 1 85 34 is_stmt 0 view .LVU93
+	addl	$1, syscall_count(%rip)
+	.loc 1 85 52 view .LVU94
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+.LVL40:
+	.loc 1 86 9 is_stmt 1 view .LVU95
+	.loc 1 86 12 is_stmt 0 view .LVU96
+	testq	%rax, %rax
+	jns	.L24
+	.loc 1 87 13 is_stmt 1 view .LVU97
+	.loc 1 87 18 is_stmt 0 view .LVU98
+	call	__errno_location@PLT
+.LVL41:
+	.loc 1 87 16 view .LVU99
+	cmpl	$4, (%rax)
+	je	.L25
+	.loc 1 90 20 view .LVU100
+	movl	$-1, %eax
+	jmp	.L22
+.L30:
+	.loc 1 90 20 view .LVU101
+.LBE7:
+	.loc 1 95 12 view .LVU102
+	movl	$0, %eax
+.LVL42:
+.L22:
+	.loc 1 96 1 view .LVU103
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL43:
+	.loc 1 96 1 view .LVU104
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL44:
+	.loc 1 96 1 view .LVU105
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL45:
+	.loc 1 96 1 view .LVU106
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	write_all, .-write_all
+	.globl	parse_uint_value
+	.type	parse_uint_value, @function
+parse_uint_value:
+.LVL46:
+.LFB46:
+	.loc 1 111 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 111 1 is_stmt 0 view .LVU108
+	endbr64
+	movq	%rdi, %rax
+	movq	%rdx, %r8
+	.loc 1 112 5 is_stmt 1 view .LVU109
+.LVL47:
+.LBB10:
+.LBI10:
+	.loc 1 100 13 view .LVU110
+.LBB11:
+	.loc 1 102 5 view .LVU111
+	.loc 1 102 26 view .LVU112
+	.loc 1 102 13 is_stmt 0 view .LVU113
+	movzbl	(%rdi), %edx
+.LVL48:
+	.loc 1 102 26 view .LVU114
+	leal	-9(%rdx), %ecx
+	cmpb	$4, %cl
+	jbe	.L42
+	cmpb	$32, %dl
+	jne	.L32
+.LVL49:
+.L42:
+	.loc 1 103 9 is_stmt 1 view .LVU115
+	addq	$1, %rax
+.LVL50:
+	.loc 1 102 26 view .LVU116
+	.loc 1 102 13 is_stmt 0 view .LVU117
+	movzbl	(%rax), %edx
+	.loc 1 102 26 view .LVU118
+	leal	-9(%rdx), %ecx
+	cmpb	$4, %cl
+	jbe	.L42
+	cmpb	$32, %dl
+	je	.L42
+.L32:
+	.loc 1 105 5 is_stmt 1 view .LVU119
+.LVL51:
+	.loc 1 105 5 is_stmt 0 view .LVU120
+.LBE11:
+.LBE10:
+	.loc 1 113 5 is_stmt 1 view .LVU121
+	.loc 1 114 9 is_stmt 0 view .LVU122
+	cmpb	$43, %dl
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.LVL52:
+	.loc 1 116 5 is_stmt 1 view .LVU123
+	.loc 1 116 10 is_stmt 0 view .LVU124
+	movzbl	(%rax), %ecx
+	.loc 1 116 22 view .LVU125
+	leal	-48(%rcx), %edx
+	.loc 1 116 8 view .LVU126
+	cmpb	$9, %dl
+	ja	.L39
+.LVL53:
+	.loc 1 120 26 is_stmt 1 view .LVU127
+	.loc 1 121 9 view .LVU128
+	.loc 1 121 46 is_stmt 0 view .LVU129
+	movsbl	%cl, %ecx
+	.loc 1 121 51 view .LVU130
+	subl	$48, %ecx
+	.loc 1 121 30 view .LVU131
+	movslq	%ecx, %rcx
+.LVL54:
+	.loc 1 122 9 is_stmt 1 view .LVU132
+	.loc 1 122 19 is_stmt 0 view .LVU133
+	movl	%esi, %esi
+	.loc 1 122 12 view .LVU134
+	cmpq	%rcx, %rsi
+	jb	.L43
+.L37:
+	.loc 1 120 44 is_stmt 1 view .LVU135
+	addq	$1, %rax
+.LVL55:
+	.loc 1 120 26 view .LVU136
+	.loc 1 120 13 is_stmt 0 view .LVU137
+	movzbl	(%rax), %edx
+	.loc 1 120 26 view .LVU138
+	leal	-48(%rdx), %edi
+	cmpb	$9, %dil
+	ja	.L44
+	.loc 1 121 9 is_stmt 1 view .LVU139
+	.loc 1 121 20 is_stmt 0 view .LVU140
+	leaq	(%rcx,%rcx,4), %rcx
+.LVL56:
+	.loc 1 121 46 view .LVU141
+	movsbl	%dl, %edx
+	.loc 1 121 51 view .LVU142
+	subl	$48, %edx
+	.loc 1 121 30 view .LVU143
+	movslq	%edx, %rdx
+	.loc 1 121 15 view .LVU144
+	leaq	(%rdx,%rcx,2), %rcx
+.LVL57:
+	.loc 1 122 9 is_stmt 1 view .LVU145
+	.loc 1 122 12 is_stmt 0 view .LVU146
+	cmpq	%rcx, %rsi
+	jnb	.L37
+	.loc 1 123 19 view .LVU147
+	movl	$0, %eax
+.LVL58:
+	.loc 1 128 1 view .LVU148
+	ret
+.LVL59:
+.L44:
+	.loc 1 126 5 is_stmt 1 view .LVU149
+	.loc 1 126 15 is_stmt 0 view .LVU150
+	movl	%ecx, (%r8)
+	.loc 1 127 5 is_stmt 1 view .LVU151
+	.loc 1 127 12 is_stmt 0 view .LVU152
+	ret
+.LVL60:
+.L39:
+	.loc 1 117 15 view .LVU153
+	movl	$0, %eax
+.LVL61:
+	.loc 1 117 15 view .LVU154
+	ret
+.LVL62:
+.L43:
+	.loc 1 123 19 view .LVU155
+	movl	$0, %eax
+.LVL63:
+	.loc 1 123 19 view .LVU156
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	parse_uint_value, .-parse_uint_value
+	.globl	parse_rounded_value
+	.type	parse_rounded_value, @function
+parse_rounded_value:
+.LVL64:
+.LFB47:
+	.loc 1 133 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 1 is_stmt 0 view .LVU158
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rax
+	movl	%esi, %r9d
+	movq	%rdx, %r10
+	.loc 1 134 5 is_stmt 1 view .LVU159
+.LVL65:
+.LBB16:
+.LBI16:
+	.loc 1 100 13 view .LVU160
+.LBB17:
+	.loc 1 102 5 view .LVU161
+	.loc 1 102 26 view .LVU162
+	.loc 1 102 13 is_stmt 0 view .LVU163
+	movzbl	(%rdi), %edx
+.LVL66:
+	.loc 1 102 26 view .LVU164
+	leal	-9(%rdx), %ecx
+	cmpb	$4, %cl
+	jbe	.L90
+	cmpb	$32, %dl
+	jne	.L46
+.LVL67:
+.L90:
+	.loc 1 103 9 is_stmt 1 view .LVU165
+	addq	$1, %rax
+.LVL68:
+	.loc 1 102 26 view .LVU166
+	.loc 1 102 13 is_stmt 0 view .LVU167
+	movzbl	(%rax), %edx
+	.loc 1 102 26 view .LVU168
+	leal	-9(%rdx), %ecx
+	cmpb	$4, %cl
+	jbe	.L90
+	cmpb	$32, %dl
+	je	.L90
+.L46:
+	.loc 1 105 5 is_stmt 1 view .LVU169
+.LVL69:
+	.loc 1 105 5 is_stmt 0 view .LVU170
+.LBE17:
+.LBE16:
+	.loc 1 135 4 is_stmt 1 view .LVU171
+	.loc 1 136 5 view .LVU172
+	.loc 1 136 23 is_stmt 0 view .LVU173
+	leal	-43(%rdx), %ecx
+	.loc 1 135 9 view .LVU174
+	movl	$0, %r11d
+	.loc 1 136 8 view .LVU175
+	testb	$-3, %cl
+	jne	.L49
+	.loc 1 136 23 view .LVU176
+	cmpb	$45, %dl
+	sete	%r11b
+	.loc 1 137 9 is_stmt 1 view .LVU177
+.LVL70:
+	.loc 1 138 9 view .LVU178
+	addq	$1, %rax
+.LVL71:
+.L49:
+	.loc 1 142 5 view .LVU179
+	.loc 1 143 5 view .LVU180
+	.loc 1 144 5 view .LVU181
+	.loc 1 145 4 view .LVU182
+	.loc 1 146 5 view .LVU183
+	.loc 1 146 26 view .LVU184
+	.loc 1 146 13 is_stmt 0 view .LVU185
+	movzbl	(%rax), %ecx
+	.loc 1 146 26 view .LVU186
+	leal	-48(%rcx), %edx
+	cmpb	$9, %dl
+	ja	.L50
+	.loc 1 144 9 view .LVU187
+	movl	$0, %edx
+	.loc 1 143 9 view .LVU188
+	movl	$0, %edi
+	.loc 1 142 14 view .LVU189
+	movl	$0, %esi
+.LVL72:
+	.loc 1 142 14 view .LVU190
+	jmp	.L53
+.LVL73:
+.L51:
+	.loc 1 152 13 is_stmt 1 view .LVU191
+	addl	$1, %edx
+.LVL74:
+.L52:
+	.loc 1 146 44 view .LVU192
+	addq	$1, %rax
+.LVL75:
+	.loc 1 146 26 view .LVU193
+	.loc 1 146 13 is_stmt 0 view .LVU194
+	movzbl	(%rax), %ecx
+	.loc 1 146 26 view .LVU195
+	leal	-48(%rcx), %r8d
+	cmpb	$9, %r8b
+	ja	.L92
+.LVL76:
+.L53:
+	.loc 1 147 9 is_stmt 1 view .LVU196
+	.loc 1 148 9 view .LVU197
+	.loc 1 148 12 is_stmt 0 view .LVU198
+	cmpl	$18, %edi
+	jg	.L51
+	.loc 1 149 13 is_stmt 1 view .LVU199
+	.loc 1 149 27 is_stmt 0 view .LVU200
+	leaq	(%rsi,%rsi,4), %rsi
+.LVL77:
+	.loc 1 149 51 view .LVU201
+	movsbl	%cl, %ecx
+	.loc 1 149 56 view .LVU202
+	subl	$48, %ecx
+	.loc 1 149 40 view .LVU203
+	movslq	%ecx, %rcx
+	.loc 1 149 22 view .LVU204
+	leaq	(%rcx,%rsi,2), %rsi
+.LVL78:
+	.loc 1 150 13 is_stmt 1 view .LVU205
+	.loc 1 150 20 is_stmt 0 view .LVU206
+	cmpq	$1, %rsi
+	sbbl	$-1, %edi
+.LVL79:
+	.loc 1 150 20 view .LVU207
+	jmp	.L52
+.L92:
+	.loc 1 155 5 is_stmt 1 view .LVU208
+	.loc 1 147 20 is_stmt 0 view .LVU209
+	movl	$1, %ebx
+	.loc 1 155 8 view .LVU210
+	cmpb	$46, %cl
+	je	.L78
+.LVL80:
+.L79:
+	.loc 1 168 5 is_stmt 1 view .LVU211
+	.loc 1 168 23 is_stmt 0 view .LVU212
+	movzbl	(%rax), %ecx
+	andl	$-33, %ecx
+	.loc 1 168 8 view .LVU213
+	cmpb	$69, %cl
+	jne	.L59
+.LBB18:
+	.loc 1 169 9 is_stmt 1 view .LVU214
+.LVL81:
+	.loc 1 170 8 view .LVU215
+	.loc 1 171 9 view .LVU216
+	.loc 1 171 14 is_stmt 0 view .LVU217
+	movzbl	1(%rax), %ecx
+	.loc 1 171 31 view .LVU218
+	leal	-43(%rcx), %edi
+.LVL82:
+	.loc 1 171 12 view .LVU219
+	testb	$-3, %dil
+	je	.L60
+	.loc 1 169 21 view .LVU220
+	leaq	1(%rax), %rdi
+.LVL83:
+	.loc 1 170 13 view .LVU221
+	movl	$0, %ebx
+.LVL84:
+.L61:
+	.loc 1 175 9 is_stmt 1 view .LVU222
+	.loc 1 175 14 is_stmt 0 view .LVU223
+	movzbl	(%rdi), %ecx
+	.loc 1 175 31 view .LVU224
+	leal	-48(%rcx), %r8d
+	.loc 1 175 12 view .LVU225
+	cmpb	$9, %r8b
+	ja	.L59
+.LBB19:
+	.loc 1 176 17 view .LVU226
+	movl	$0, %eax
+.LVL85:
+	.loc 1 176 17 view .LVU227
+	jmp	.L63
+.LVL86:
+.L84:
+	.loc 1 176 17 view .LVU228
+.LBE19:
+.LBE18:
+	.loc 1 145 13 view .LVU229
+	movl	$0, %ebx
+	.loc 1 144 9 view .LVU230
+	movl	$0, %edx
+	.loc 1 143 9 view .LVU231
+	movl	$0, %edi
+	.loc 1 142 14 view .LVU232
+	movl	$0, %esi
+.LVL87:
+.L78:
+	.loc 1 156 9 is_stmt 1 view .LVU233
+	.loc 1 156 14 is_stmt 0 view .LVU234
+	leaq	1(%rax), %rcx
+.LVL88:
+	.loc 1 156 35 is_stmt 1 view .LVU235
+	.loc 1 156 22 is_stmt 0 view .LVU236
+	movzbl	1(%rax), %eax
+	.loc 1 156 35 view .LVU237
+	leal	-48(%rax), %r8d
+	cmpb	$9, %r8b
+	jbe	.L57
+	.loc 1 165 5 is_stmt 1 view .LVU238
+	.loc 1 165 8 is_stmt 0 view .LVU239
+	testb	%bl, %bl
+	jne	.L93
+	.loc 1 166 15 view .LVU240
+	movl	$0, %edx
+.LVL89:
+	.loc 1 166 15 view .LVU241
+	jmp	.L45
+.LVL90:
+.L56:
+	.loc 1 156 53 is_stmt 1 discriminator 2 view .LVU242
+	addq	$1, %rcx
+.LVL91:
+	.loc 1 156 35 discriminator 2 view .LVU243
+	.loc 1 156 22 is_stmt 0 discriminator 2 view .LVU244
+	movzbl	(%rcx), %eax
+	.loc 1 156 35 discriminator 2 view .LVU245
+	leal	-48(%rax), %r8d
+	cmpb	$9, %r8b
+	ja	.L94
+.LVL92:
+.L57:
+	.loc 1 157 13 is_stmt 1 view .LVU246
+	.loc 1 158 13 view .LVU247
+	.loc 1 158 16 is_stmt 0 view .LVU248
+	cmpl	$18, %edi
+	jg	.L56
+	.loc 1 159 17 is_stmt 1 view .LVU249
+	.loc 1 159 31 is_stmt 0 view .LVU250
+	leaq	(%rsi,%rsi,4), %rsi
+.LVL93:
+	.loc 1 159 55 view .LVU251
+	movsbl	%al, %eax
+	.loc 1 159 60 view .LVU252
+	subl	$48, %eax
+	.loc 1 159 44 view .LVU253
+	cltq
+	.loc 1 159 26 view .LVU254
+	leaq	(%rax,%rsi,2), %rsi
+.LVL94:
+	.loc 1 160 17 is_stmt 1 view .LVU255
+	.loc 1 160 24 is_stmt 0 view .LVU256
+	cmpq	$1, %rsi
+	sbbl	$-1, %edi
+.LVL95:
+	.loc 1 161 17 is_stmt 1 view .LVU257
+	subl	$1, %edx
+.LVL96:
+	.loc 1 161 17 is_stmt 0 view .LVU258
+	jmp	.L56
+.L94:
+	.loc 1 156 53 view .LVU259
+	movq	%rcx, %rax
+	jmp	.L79
+.LVL97:
+.L93:
+	.loc 1 156 14 view .LVU260
+	movq	%rcx, %rax
+	jmp	.L79
+.LVL98:
+.L60:
+.LBB21:
+	.loc 1 171 31 view .LVU261
+	cmpb	$45, %cl
+	sete	%bl
+	.loc 1 172 13 is_stmt 1 view .LVU262
+.LVL99:
+	.loc 1 173 13 view .LVU263
+	leaq	2(%rax), %rdi
+.LVL100:
+	.loc 1 173 13 is_stmt 0 view .LVU264
+	jmp	.L61
+.LVL101:
+.L62:
+.LBB20:
+	.loc 1 177 60 is_stmt 1 view .LVU265
+	addq	$1, %rdi
+.LVL102:
+	.loc 1 177 38 view .LVU266
+	.loc 1 177 21 is_stmt 0 view .LVU267
+	movzbl	(%rdi), %ecx
+	.loc 1 177 38 view .LVU268
+	leal	-48(%rcx), %r8d
+	cmpb	$9, %r8b
+	ja	.L95
+.LVL103:
+.L63:
+	.loc 1 178 17 is_stmt 1 view .LVU269
+	.loc 1 178 20 is_stmt 0 view .LVU270
+	cmpl	$999, %eax
+	jg	.L62
+	.loc 1 179 21 is_stmt 1 view .LVU271
+	.loc 1 179 36 is_stmt 0 view .LVU272
+	leal	(%rax,%rax,4), %eax
+.LVL104:
+	.loc 1 179 51 view .LVU273
+	movsbl	%cl, %ecx
+	.loc 1 179 31 view .LVU274
+	leal	-48(%rcx,%rax,2), %eax
+.LVL105:
+	.loc 1 179 31 view .LVU275
+	jmp	.L62
+.L95:
+	.loc 1 182 13 is_stmt 1 view .LVU276
+	.loc 1 182 51 is_stmt 0 view .LVU277
+	movl	%eax, %ecx
+	negl	%ecx
+	testb	%bl, %bl
+	cmovne	%ecx, %eax
+.LVL106:
+	.loc 1 182 22 view .LVU278
+	addl	%eax, %edx
+.LVL107:
+	.loc 1 183 13 is_stmt 1 view .LVU279
+	.loc 1 177 60 is_stmt 0 view .LVU280
+	movq	%rdi, %rax
+.LVL108:
+.L59:
+	.loc 1 177 60 view .LVU281
+.LBE20:
+.LBE21:
+	.loc 1 187 5 is_stmt 1 view .LVU282
+	.loc 1 187 12 is_stmt 0 view .LVU283
+	testq	%rsi, %rsi
+	js	.L65
+	.loc 1 187 12 view .LVU284
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rsi, %xmm0
+.LVL109:
+.L66:
+	.loc 1 188 5 is_stmt 1 view .LVU285
+	.loc 1 188 27 view .LVU286
+	testl	%edx, %edx
+	jle	.L68
+	.loc 1 188 37 is_stmt 0 view .LVU287
+	movl	%r9d, %ecx
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rcx, %xmm1
+	.loc 1 189 15 view .LVU288
+	movsd	.LC6(%rip), %xmm2
+.L67:
+	.loc 1 188 27 discriminator 2 view .LVU289
+	comisd	%xmm0, %xmm1
+	jb	.L68
+	.loc 1 189 9 is_stmt 1 discriminator 3 view .LVU290
+	.loc 1 189 15 is_stmt 0 discriminator 3 view .LVU291
+	mulsd	%xmm2, %xmm0
+.LVL110:
+	.loc 1 188 46 is_stmt 1 discriminator 3 view .LVU292
+	.loc 1 188 27 discriminator 3 view .LVU293
+	subl	$1, %edx
+.LVL111:
+	.loc 1 188 27 is_stmt 0 discriminator 3 view .LVU294
+	jne	.L67
+.L69:
+.LVL112:
+	.loc 1 194 5 is_stmt 1 view .LVU295
+	.loc 1 194 8 is_stmt 0 view .LVU296
+	testb	%r11b, %r11b
+	je	.L75
+	.loc 1 195 15 discriminator 1 view .LVU297
+	movl	$0, %edx
+	.loc 1 194 19 discriminator 1 view .LVU298
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	ja	.L45
+.L75:
+	.loc 1 194 47 discriminator 3 view .LVU299
+	movl	%r9d, %r9d
+	.loc 1 194 47 discriminator 3 view .LVU300
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r9, %xmm1
+	.loc 1 194 37 discriminator 3 view .LVU301
+	comisd	%xmm1, %xmm0
+	ja	.L83
+	.loc 1 198 5 is_stmt 1 view .LVU302
+	.loc 1 198 30 is_stmt 0 view .LVU303
+	cvtsd2ss	%xmm0, %xmm0
+	.loc 1 198 43 view .LVU304
+	addss	.LC8(%rip), %xmm0
+	.loc 1 198 15 view .LVU305
+	cvttss2siq	%xmm0, %rdx
+	movl	%edx, (%r10)
+	.loc 1 199 5 is_stmt 1 view .LVU306
+	.loc 1 199 12 is_stmt 0 view .LVU307
+	movq	%rax, %rdx
+.LVL113:
+.L45:
+	.loc 1 200 1 view .LVU308
+	movq	%rdx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL114:
+.L65:
+	.cfi_restore_state
+	.loc 1 187 12 view .LVU309
+	movq	%rsi, %rcx
+	shrq	%rcx
+	andl	$1, %esi
+.LVL115:
+	.loc 1 187 12 view .LVU310
+	orq	%rsi, %rcx
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rcx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L66
+.LVL116:
+.L68:
+	.loc 1 191 27 is_stmt 1 discriminator 1 view .LVU311
+	testl	%edx, %edx
+	jns	.L69
+	.loc 1 191 27 is_stmt 0 view .LVU312
+	pxor	%xmm1, %xmm1
+	.loc 1 192 15 view .LVU313
+	movsd	.LC6(%rip), %xmm2
+.L73:
+	.loc 1 191 27 discriminator 2 view .LVU314
+	comisd	%xmm1, %xmm0
+	jbe	.L69
+	.loc 1 192 9 is_stmt 1 discriminator 3 view .LVU315
+	.loc 1 192 15 is_stmt 0 discriminator 3 view .LVU316
+	divsd	%xmm2, %xmm0
+.LVL117:
+	.loc 1 191 45 is_stmt 1 discriminator 3 view .LVU317
+	.loc 1 191 27 discriminator 3 view .LVU318
+	addl	$1, %edx
+.LVL118:
+	.loc 1 191 27 is_stmt 0 discriminator 3 view .LVU319
+	jne	.L73
+	jmp	.L69
+.LVL119:
+.L83:
+	.loc 1 195 15 view .LVU320
+	movl	$0, %edx
+.LVL120:
+	.loc 1 195 15 view .LVU321
+	jmp	.L45
+.LVL121:
+.L50:
+	.loc 1 155 5 is_stmt 1 view .LVU322
+	.loc 1 155 8 is_stmt 0 view .LVU323
+	cmpb	$46, %cl
+	je	.L84
+	.loc 1 166 15 view .LVU324
+	movl	$0, %edx
+	jmp	.L45
+	.cfi_endproc
+.LFE47:
+	.size	parse_rounded_value, .-parse_rounded_value
+	.section	.rodata.str1.1
+.LC9:
+	.string	"strerror_r error\n"
+.LC10:
+	.string	": "
+.LC11:
+	.string	"\n"
+	.text
+	.globl	safe_error_exit
+	.type	safe_error_exit, @function
+safe_error_exit:
+.LVL122:
+.LFB48:
+	.loc 1 207 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 207 1 is_stmt 0 view .LVU326
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 192
+	movq	%rdi, %rbx
+	.loc 1 207 1 view .LVU327
+	movq	%fs:40, %rax
+	movq	%rax, 136(%rsp)
+	xorl	%eax, %eax
+	.loc 1 208 5 is_stmt 1 view .LVU328
+	.loc 1 208 30 is_stmt 0 view .LVU329
+	call	__errno_location@PLT
+.LVL123:
+	.loc 1 209 5 is_stmt 1 view .LVU330
+	.loc 1 210 5 view .LVU331
+	.loc 1 210 21 is_stmt 0 view .LVU332
+	movq	%rsp, %rsi
+	movl	(%rax), %edi
+	movl	$128, %edx
+	call	__xpg_strerror_r@PLT
+.LVL124:
+	.loc 1 211 5 is_stmt 1 view .LVU333
+	.loc 1 211 8 is_stmt 0 view .LVU334
+	testl	%eax, %eax
+	je	.L97
+	.loc 1 212 9 is_stmt 1 view .LVU335
+	.loc 1 212 13 is_stmt 0 view .LVU336
+	movl	$17, %edx
+	leaq	.LC9(%rip), %rsi
+	movl	$2, %edi
+	call	write@PLT
+.LVL125:
+	.loc 1 215 9 is_stmt 1 view .LVU337
+	.loc 1 216 9 view .LVU338
+	movl	$1, %edi
+	call	_exit@PLT
+.LVL126:
+.L97:
+	.loc 1 218 5 view .LVU339
+	.loc 1 218 27 is_stmt 0 view .LVU340
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL127:
+	.loc 1 218 27 view .LVU341
+	movq	%rax, %r12
+.LVL128:
+	.loc 1 219 5 is_stmt 1 view .LVU342
+	.loc 1 219 27 is_stmt 0 view .LVU343
+	movq	%rsp, %r13
+	movq	%r13, %rdi
+	call	strlen@PLT
+.LVL129:
+	.loc 1 219 27 view .LVU344
+	movq	%rax, %rbp
+.LVL130:
+	.loc 1 220 5 is_stmt 1 view .LVU345
+	.loc 1 220 9 is_stmt 0 view .LVU346
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	$2, %edi
+	call	write@PLT
+.LVL131:
+	.loc 1 222 5 is_stmt 1 view .LVU347
+	.loc 1 223 5 view .LVU348
+	.loc 1 223 9 is_stmt 0 view .LVU349
+	movl	$2, %edx
+	leaq	.LC10(%rip), %rsi
+	movl	$2, %edi
+	call	write@PLT
+.LVL132:
+	.loc 1 225 5 is_stmt 1 view .LVU350
+	.loc 1 226 5 view .LVU351
+	.loc 1 226 9 is_stmt 0 view .LVU352
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	$2, %edi
+	call	write@PLT
+.LVL133:
+	.loc 1 228 5 is_stmt 1 view .LVU353
+	.loc 1 229 5 view .LVU354
+	.loc 1 229 9 is_stmt 0 view .LVU355
+	movl	$1, %edx
+	leaq	.LC11(%rip), %rsi
+	movl	$2, %edi
+	call	write@PLT
+.LVL134:
+	.loc 1 231 5 is_stmt 1 view .LVU356
+	.loc 1 232 5 view .LVU357
+	movl	$1, %edi
+	call	_exit@PLT
+.LVL135:
+	.cfi_endproc
+.LFE48:
+	.size	safe_error_exit, .-safe_error_exit
+	.globl	syscall_count
+	.bss
+	.align 4
+	.type	syscall_count, @object
+	.size	syscall_count, 4
+syscall_count:
+	.zero	4
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC6:
+	.long	0
+	.long	1076101120
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC8:
+	.long	1056964608
+	.text
+.Letext0:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 9 "beep-library.h"
+	.file 10 "beep-log.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 "/usr/include/unistd.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 14 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb31
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF88
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x9
+	.long	0x3c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x91
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x92
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x93
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x94
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x96
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x97
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x12
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xaf
+	.byte	0x12
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x3
+	.byte	0xb4
+	.byte	0x12
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x12
+	.long	0x69
+	.uleb128 0xa
+	.long	0x111
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF22
+	.uleb128 0x9
+	.long	0x111
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x9
+	.long	0x129
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF25
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x6c
+	.byte	0x13
+	.long	0xf4
+	.uleb128 0x9
+	.long	0x141
+	.uleb128 0x13
+	.long	.LASF30
+	.byte	0x10
+	.byte	0x7
+	.byte	0xb
+	.long	0x179
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x10
+	.byte	0xc
+	.long	0xd0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x15
+	.byte	0x15
+	.long	0x100
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF29
+	.uleb128 0xa
+	.long	0x18a
+	.uleb128 0x9
+	.long	0x180
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	0x118
+	.uleb128 0x9
+	.long	0x18b
+	.uleb128 0x14
+	.long	0x18b
+	.uleb128 0x13
+	.long	.LASF31
+	.byte	0x90
+	.byte	0x8
+	.byte	0x1a
+	.long	0x26a
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xd
+	.long	0x7c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0xa0
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xf
+	.long	0xb8
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xe
+	.long	0xac
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xd
+	.long	0x88
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x30
+	.byte	0xd
+	.long	0x94
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x32
+	.byte	0x9
+	.long	0x5d
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x34
+	.byte	0xd
+	.long	0x7c
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x8
+	.byte	0x39
+	.byte	0xd
+	.long	0xc4
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x11
+	.long	0xdc
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x10
+	.long	0xe8
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x15
+	.long	0x152
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x15
+	.long	0x152
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x15
+	.long	0x152
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x59
+	.byte	0x17
+	.long	0x26a
+	.byte	0x78
+	.byte	0
+	.uleb128 0x15
+	.long	0x100
+	.long	0x27a
+	.uleb128 0x16
+	.long	0x48
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x15
+	.long	0x3c
+	.uleb128 0x17
+	.long	.LASF48
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0x5d
+	.uleb128 0x20
+	.long	0x27a
+	.byte	0x1
+	.byte	0x23
+	.byte	0xe
+	.uleb128 0x9
+	.byte	0x3
+	.quad	syscall_count
+	.uleb128 0xc
+	.long	.LASF49
+	.byte	0xb
+	.value	0x197
+	.byte	0xf
+	.long	0x129
+	.long	0x2bb
+	.uleb128 0x3
+	.long	0x18b
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF50
+	.byte	0xc
+	.value	0x270
+	.byte	0xd
+	.long	0x2ce
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF52
+	.byte	0xb
+	.value	0x1b0
+	.byte	0xc
+	.long	.LASF89
+	.long	0x5d
+	.long	0x2f3
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x3
+	.long	0x10c
+	.uleb128 0x3
+	.long	0x129
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF51
+	.byte	0xc
+	.value	0x17a
+	.byte	0x10
+	.long	0x141
+	.long	0x314
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x3
+	.long	0x180
+	.uleb128 0x3
+	.long	0x129
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF53
+	.byte	0x2
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF85
+	.long	0x5d
+	.long	0x334
+	.uleb128 0x3
+	.long	0x18b
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF54
+	.byte	0x2
+	.byte	0x1a
+	.long	0x5d
+	.long	0x34e
+	.uleb128 0x3
+	.long	0x18b
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF55
+	.byte	0x25
+	.uleb128 0x18
+	.long	.LASF56
+	.byte	0x23
+	.uleb128 0xc
+	.long	.LASF57
+	.byte	0xc
+	.value	0x166
+	.byte	0xc
+	.long	0x5d
+	.long	0x371
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF58
+	.byte	0xd
+	.byte	0xd2
+	.long	0x5d
+	.long	0x38b
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x3
+	.long	0x38b
+	.byte	0
+	.uleb128 0xa
+	.long	0x19a
+	.uleb128 0x14
+	.long	0x38b
+	.uleb128 0x24
+	.long	.LASF90
+	.byte	0xa
+	.byte	0x43
+	.byte	0x6
+	.long	0x3a8
+	.uleb128 0x3
+	.long	0x190
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF59
+	.byte	0xb
+	.value	0x1a3
+	.byte	0xe
+	.long	0x10c
+	.long	0x3bf
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF91
+	.byte	0xe
+	.byte	0x25
+	.byte	0xd
+	.long	0x3cb
+	.uleb128 0xa
+	.long	0x5d
+	.uleb128 0x11
+	.long	.LASF31
+	.byte	0xd
+	.byte	0xcd
+	.long	0x5d
+	.long	0x3ea
+	.uleb128 0x3
+	.long	0x195
+	.uleb128 0x3
+	.long	0x390
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF63
+	.byte	0x1
+	.byte	0xce
+	.byte	0x6
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5bf
+	.uleb128 0xb
+	.string	"msg"
+	.byte	0xce
+	.byte	0x28
+	.long	0x190
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	.LASF60
+	.byte	0xd0
+	.byte	0xf
+	.long	0x64
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x27
+	.long	.LASF84
+	.byte	0x1
+	.byte	0xd1
+	.byte	0xa
+	.long	0x5bf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x12
+	.string	"ret"
+	.byte	0xd2
+	.byte	0xf
+	.long	0x64
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xda
+	.byte	0x12
+	.long	0x135
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xdb
+	.byte	0x12
+	.long	0x135
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x8
+	.quad	.LVL123
+	.long	0x3bf
+	.uleb128 0x2
+	.quad	.LVL124
+	.long	0x2ce
+	.long	0x4a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL125
+	.long	0x2f3
+	.long	0x4cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x41
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL126
+	.long	0x2bb
+	.long	0x4e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL127
+	.long	0x2a4
+	.long	0x4fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL129
+	.long	0x2a4
+	.long	0x513
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL131
+	.long	0x2f3
+	.long	0x536
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL132
+	.long	0x2f3
+	.long	0x55f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL133
+	.long	0x2f3
+	.long	0x582
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL134
+	.long	0x2f3
+	.long	0x5ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL135
+	.long	0x2bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x111
+	.long	0x5cf
+	.uleb128 0x16
+	.long	0x48
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF64
+	.byte	0x83
+	.byte	0xd
+	.long	0x18b
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x712
+	.uleb128 0xb
+	.string	"str"
+	.byte	0x83
+	.byte	0x2d
+	.long	0x18b
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xb
+	.string	"max"
+	.byte	0x83
+	.byte	0x45
+	.long	0x43
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xe
+	.long	.LASF65
+	.byte	0x84
+	.byte	0x35
+	.long	0x717
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x6
+	.long	.LASF66
+	.byte	0x87
+	.byte	0x9
+	.long	0x71c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0x8e
+	.byte	0xe
+	.long	0x11d
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x6
+	.long	.LASF68
+	.byte	0x8f
+	.byte	0x9
+	.long	0x5d
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x6
+	.long	.LASF69
+	.byte	0x90
+	.byte	0x9
+	.long	0x5d
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0x91
+	.byte	0xd
+	.long	0x71c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0xbb
+	.byte	0xc
+	.long	0x723
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x28
+	.long	.LLRL25
+	.long	0x6e4
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0xa9
+	.byte	0x15
+	.long	0x18b
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0xaa
+	.byte	0xd
+	.long	0x71c
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1a
+	.long	.LLRL28
+	.uleb128 0x6
+	.long	.LASF74
+	.byte	0xb0
+	.byte	0x11
+	.long	0x5d
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0x7c0
+	.quad	.LBI16
+	.byte	.LVU160
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.byte	0x86
+	.uleb128 0xf
+	.long	0x7d1
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x3c
+	.uleb128 0x9
+	.long	0x712
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF75
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF76
+	.uleb128 0xd
+	.long	.LASF77
+	.byte	0x6d
+	.byte	0xd
+	.long	0x18b
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c0
+	.uleb128 0xb
+	.string	"str"
+	.byte	0x6d
+	.byte	0x2a
+	.long	0x18b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x29
+	.string	"max"
+	.byte	0x1
+	.byte	0x6d
+	.byte	0x42
+	.long	0x43
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xe
+	.long	.LASF65
+	.byte	0x6e
+	.byte	0x32
+	.long	0x717
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x77
+	.byte	0x13
+	.long	0x48
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1b
+	.long	0x7c0
+	.quad	.LBI10
+	.byte	.LVU110
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.byte	0x70
+	.uleb128 0xf
+	.long	0x7d1
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x64
+	.byte	0xd
+	.long	0x18b
+	.byte	0x1
+	.long	0x7de
+	.uleb128 0x2b
+	.string	"str"
+	.byte	0x1
+	.byte	0x64
+	.byte	0x24
+	.long	0x18b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF78
+	.byte	0x4f
+	.byte	0x5
+	.long	0x5d
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8a8
+	.uleb128 0xb
+	.string	"fd"
+	.byte	0x4f
+	.byte	0x19
+	.long	0x64
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x4f
+	.byte	0x2f
+	.long	0x185
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xe
+	.long	.LASF79
+	.byte	0x4f
+	.byte	0x41
+	.long	0x135
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x51
+	.byte	0x11
+	.long	0x18b
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	.LASF80
+	.byte	0x52
+	.byte	0xc
+	.long	0x129
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1a
+	.long	.LLRL9
+	.uleb128 0x6
+	.long	.LASF81
+	.byte	0x55
+	.byte	0x17
+	.long	0x14d
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.quad	.LVL40
+	.long	0x2f3
+	.long	0x899
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL41
+	.long	0x3bf
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF82
+	.byte	0x26
+	.byte	0x5
+	.long	0x5d
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb04
+	.uleb128 0xe
+	.long	.LASF83
+	.byte	0x26
+	.byte	0x30
+	.long	0x190
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2c
+	.string	"sb"
+	.byte	0x1
+	.byte	0x28
+	.byte	0x11
+	.long	0x19a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x12
+	.string	"fd"
+	.byte	0x36
+	.byte	0xf
+	.long	0x64
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2d
+	.long	0xb04
+	.quad	.LBI4
+	.byte	.LVU13
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.byte	0x1
+	.byte	0x36
+	.byte	0x27
+	.long	0x956
+	.uleb128 0xf
+	.long	0xb1f
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.long	0xb15
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x19
+	.quad	.LVL3
+	.long	0x314
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1
+	.long	0x3d0
+	.long	0x975
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL6
+	.long	0x371
+	.long	0x994
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL10
+	.long	0x3bf
+	.uleb128 0x8
+	.quad	.LVL11
+	.long	0x3a8
+	.uleb128 0x2
+	.quad	.LVL12
+	.long	0x395
+	.long	0x9d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x395
+	.long	0x9f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL15
+	.long	0x3bf
+	.uleb128 0x8
+	.quad	.LVL16
+	.long	0x3a8
+	.uleb128 0x2
+	.quad	.LVL17
+	.long	0x395
+	.long	0xa37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x395
+	.long	0xa62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL22
+	.long	0x35a
+	.long	0xa7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL25
+	.long	0x3bf
+	.uleb128 0x8
+	.quad	.LVL26
+	.long	0x3a8
+	.uleb128 0x2
+	.quad	.LVL27
+	.long	0x395
+	.long	0xab9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL28
+	.long	0x35a
+	.long	0xad1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL31
+	.long	0x395
+	.long	0xaf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL33
+	.long	0xb2b
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF85
+	.byte	0x2
+	.byte	0x29
+	.byte	0x1
+	.long	0x5d
+	.byte	0x3
+	.long	0xb2b
+	.uleb128 0x1c
+	.long	.LASF86
+	.byte	0x13
+	.long	0x18b
+	.uleb128 0x1c
+	.long	.LASF87
+	.byte	0x1f
+	.long	0x5d
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF93
+	.long	.LASF93
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 11
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL123-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU330
+	.uleb128 .LVU333
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU333
+	.uleb128 .LVU337
+	.uleb128 .LVU339
+	.uleb128 .LVU341
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU342
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU345
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL131-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU265
+	.uleb128 .LVU280
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU321
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU172
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU180
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU201
+	.uleb128 .LVU205
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU251
+	.uleb128 .LVU255
+	.uleb128 .LVU285
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU181
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU219
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU261
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU182
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 .LVU295
+	.uleb128 .LVU309
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU320
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU183
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU197
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU246
+	.uleb128 .LVU247
+	.uleb128 .LVU260
+	.uleb128 .LVU260
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU321
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU285
+	.uleb128 .LVU295
+	.uleb128 .LVU311
+	.uleb128 .LVU320
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU215
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU228
+	.uleb128 .LVU261
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU281
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU216
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU228
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU281
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU265
+	.uleb128 .LVU273
+	.uleb128 .LVU275
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU281
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU160
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+	.uleb128 .LVU156
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU127
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU141
+	.uleb128 .LVU145
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU110
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU120
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU82
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU105
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU104
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU86
+	.uleb128 .LVU90
+	.uleb128 .LVU95
+	.uleb128 .LVU99
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU19
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU33
+	.uleb128 .LVU46
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU76
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF72:
+	.string	"exp_str"
+.LASF57:
+	.string	"close"
+.LASF91:
+	.string	"__errno_location"
+.LASF65:
+	.string	"result"
+.LASF82:
+	.string	"open_checked_char_device"
+.LASF89:
+	.string	"__xpg_strerror_r"
+.LASF62:
+	.string	"errlen"
+.LASF27:
+	.string	"tv_sec"
+.LASF23:
+	.string	"uint64_t"
+.LASF14:
+	.string	"__mode_t"
+.LASF24:
+	.string	"size_t"
+.LASF45:
+	.string	"st_ctim"
+.LASF70:
+	.string	"seen_digit"
+.LASF81:
+	.string	"written"
+.LASF25:
+	.string	"long long int"
+.LASF21:
+	.string	"__syscall_slong_t"
+.LASF86:
+	.string	"__path"
+.LASF32:
+	.string	"st_dev"
+.LASF67:
+	.string	"mantissa"
+.LASF34:
+	.string	"st_nlink"
+.LASF39:
+	.string	"st_rdev"
+.LASF7:
+	.string	"short int"
+.LASF59:
+	.string	"strerror"
+.LASF51:
+	.string	"write"
+.LASF56:
+	.string	"__open_too_many_args"
+.LASF74:
+	.string	"exp_value"
+.LASF64:
+	.string	"parse_rounded_value"
+.LASF69:
+	.string	"exponent"
+.LASF41:
+	.string	"st_blksize"
+.LASF78:
+	.string	"write_all"
+.LASF30:
+	.string	"timespec"
+.LASF83:
+	.string	"device_name"
+.LASF37:
+	.string	"st_gid"
+.LASF20:
+	.string	"__ssize_t"
+.LASF8:
+	.string	"long int"
+.LASF84:
+	.string	"strerr_buf"
+.LASF15:
+	.string	"__nlink_t"
+.LASF66:
+	.string	"negative"
+.LASF53:
+	.string	"__open_alias"
+.LASF68:
+	.string	"digits"
+.LASF92:
+	.string	"skip_space"
+.LASF47:
+	.string	"syscall_count"
+.LASF2:
+	.string	"unsigned char"
+.LASF85:
+	.string	"open"
+.LASF33:
+	.string	"st_ino"
+.LASF88:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF61:
+	.string	"msglen"
+.LASF28:
+	.string	"tv_nsec"
+.LASF6:
+	.string	"signed char"
+.LASF29:
+	.string	"long long unsigned int"
+.LASF58:
+	.string	"fstat"
+.LASF4:
+	.string	"unsigned int"
+.LASF87:
+	.string	"__oflag"
+.LASF18:
+	.string	"__blksize_t"
+.LASF43:
+	.string	"st_atim"
+.LASF90:
+	.string	"log_verbose"
+.LASF60:
+	.string	"saved_errno"
+.LASF22:
+	.string	"char"
+.LASF52:
+	.string	"strerror_r"
+.LASF49:
+	.string	"strlen"
+.LASF48:
+	.string	"log_level"
+.LASF38:
+	.string	"__pad0"
+.LASF75:
+	.string	"_Bool"
+.LASF42:
+	.string	"st_blocks"
+.LASF9:
+	.string	"__uint64_t"
+.LASF13:
+	.string	"__ino_t"
+.LASF36:
+	.string	"st_uid"
+.LASF3:
+	.string	"short unsigned int"
+.LASF40:
+	.string	"st_size"
+.LASF5:
+	.string	"long unsigned int"
+.LASF76:
+	.string	"double"
+.LASF73:
+	.string	"exp_negative"
+.LASF16:
+	.string	"__off_t"
+.LASF50:
+	.string	"_exit"
+.LASF79:
+	.string	"count"
+.LASF10:
+	.string	"__dev_t"
+.LASF17:
+	.string	"__time_t"
+.LASF46:
+	.string	"__glibc_reserved"
+.LASF63:
+	.string	"safe_error_exit"
+.LASF44:
+	.string	"st_mtim"
+.LASF26:
+	.string	"ssize_t"
+.LASF55:
+	.string	"__open_missing_mode"
+.LASF54:
+	.string	"__open_2"
+.LASF11:
+	.string	"__uid_t"
+.LASF31:
+	.string	"stat"
+.LASF35:
+	.string	"st_mode"
+.LASF93:
+	.string	"__stack_chk_fail"
+.LASF71:
+	.string	"value"
+.LASF80:
+	.string	"remaining"
+.LASF77:
+	.string	"parse_uint_value"
+.LASF19:
+	.string	"__blkcnt_t"
+.LASF12:
+	.string	"__gid_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"beep-library.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -18,6 +18,7 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "beep-log.h"
@@ -29,18 +30,83 @@ int log_level = 0;
 const char *progname = "beep-log";
 
 
+/* 4096 entries are 96KiB, i.e. 2048 tone edges before the oldest
+ * messages are overwritten
+ */
+#define LOG_RING_ENTRIES 4096
+
+
+typedef struct {
+    const char   *format;
+    const void   *ptr;
+    int           has_value;
+    unsigned int  value;
+} log_ring_entry;
+
+
+static log_ring_entry log_ring[LOG_RING_ENTRIES];
+static size_t         log_ring_start = 0;
+static size_t         log_ring_count = 0;
+static unsigned long  log_ring_dropped = 0;
+
+
 /** beep-log internal function to actually print a message */
 static
-void log_internal_vf(const char *levelstr, const char *const format, va_list args)
-    __attribute__ ((nonnull (1,2)));
+void log_internal_vf(FILE *stream, const char *levelstr,
+                     const char *const format, va_list args)
+    __attribute__ ((nonnull (1,2,3)));
 
 
 static
-void log_internal_vf(const char *levelstr, const char *const format, va_list args)
+void log_internal_vf(FILE *stream, const char *levelstr,
+                     const char *const format, va_list args)
 {
-    fprintf(stdout, "%s: %s: ", progname, levelstr);
-    vfprintf(stdout, format, args);
-    fputc('\n', stdout);
+    log_flush();
+    fprintf(stream, "%s: %s: ", progname, levelstr);
+    vfprintf(stream, format, args);
+    fputc('\n', stream);
+}
+
+
+/* No I/O here: when the ring is full, overwrite the oldest message */
+void log_deferred(const char *const format, const void *const ptr,
+                  const int has_value, const unsigned int value)
+{
+    log_ring_entry *const entry =
+        &log_ring[(log_ring_start + log_ring_count) % LOG_RING_ENTRIES];
+    entry->format    = format;
+    entry->ptr       = ptr;
+    entry->has_value = has_value;
+    entry->value     = value;
+    if (log_ring_count < LOG_RING_ENTRIES) {
+        ++log_ring_count;
+    } else {
+        log_ring_start = (log_ring_start + 1) % LOG_RING_ENTRIES;
+        ++log_ring_dropped;
+    }
+}
+
+
+void log_flush(void)
+{
+    if (log_ring_dropped > 0) {
+        fprintf(stderr, "%s: %s: %lu earlier messages dropped\n",
+                progname, "Verbose", log_ring_dropped);
+        log_ring_dropped = 0;
+    }
+    for (size_t i=0; i<log_ring_count; ++i) {
+        const log_ring_entry *const entry =
+            &log_ring[(log_ring_start + i) % LOG_RING_ENTRIES];
+        fprintf(stderr, "%s: %s: ", progname, "Verbose");
+        if (entry->has_value) {
+            fprintf(stderr, entry->format, entry->ptr, entry->value);
+        } else {
+            fprintf(stderr, entry->format, entry->ptr);
+        }
+        fputc('\n', stderr);
+    }
+    log_ring_start = 0;
+    log_ring_count = 0;
 }
 
 
@@ -59,7 +125,7 @@ void log_error(const char *const format, ...)
     va_list args;
 
     va_start(args, format);
-    log_internal_vf("Error", format, args);
+    log_internal_vf(stdout, "Error", format, args);
     va_end(args);
 }
 
@@ -69,17 +135,19 @@ void log_warning(const char *const format, ...)
     va_list args;
 
     va_start(args, format);
-    log_internal_vf("Warning", format, args);
+    log_internal_vf(stdout, "Warning", format, args);
     va_end(args);
 }
 
-void log_verbose(const char *const format, ...)
+/* In parentheses, in case log_verbose() is compiled out as a macro */
+void (log_verbose)(const char *const format, ...)
 {
     va_list args;
 
     if (log_level > 0) {
         va_start(args, format);
-        log_internal_vf("Verbose", format, args);
+        /* Not stdout, which is the data pipe for -s, -c and pcm:- */
+        log_internal_vf(stderr, "Verbose", format, args);
         va_end(args);
     }
 }
@@ -91,6 +159,7 @@ void log_data(const void *const buf, const size_t start_ofs, const size_t size)
     if (log_level <= 1) {
         return;
     }
+    log_flush();
     const unsigned char *const ucbuf = buf;
     static const char hexchar[] = "0123456789abcdef";
     char linebuf[80] =
@@ -119,12 +188,14 @@ void log_data(const void *const buf, const size_t start_ofs, const size_t size)
             linebuf[6+3*8-1]    = ' ';
             linebuf[6+3*16+1+8] = ' ';
         }
-        fprintf(stdout, "%s: %s: %s\n", progname, "Data", linebuf);
+        fprintf(stderr, "%s: %s: %s\n", progname, "Data", linebuf);
     }
 }
 
 
 void log_init(const int argc, char *const argv[]) {
+    atexit(log_flush);
+
     /* if argv[0] is "./foo/bar/beep", set progname to "beep" */
     if (argc >= 1) {
         const char *last_slash = strrchr(argv[0], '/');
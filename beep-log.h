@@ -53,11 +53,82 @@ void log_warning(const char *const format, ...)
     __attribute__ ((format (printf, 1, 2)));
 
 
+/** Highest log level compiled in.
+ *
+ * Messages above this level are compiled out completely, while their
+ * arguments are still type checked.  0 removes all verbose messages.
+ */
+#ifndef BEEP_LOG_MAX_LEVEL
+#define BEEP_LOG_MAX_LEVEL 999
+#endif
+
+
 /** Log a verbose message */
 void log_verbose(const char *const format, ...)
     __attribute__ ((nonnull (1)))
     __attribute__ ((format (printf, 1, 2)));
 
+/* Check the level before making the call */
+#define log_verbose(...)                                        \
+    do {                                                        \
+        if ((BEEP_LOG_MAX_LEVEL > 0) && (log_level > 0)) {      \
+            log_verbose(__VA_ARGS__);                           \
+        }                                                       \
+    } while (0)
+
+
+/** Record a verbose message from a timing critical path.
+ *
+ * Only the format string and the raw arguments are stored in a ring
+ * buffer, to be formatted by log_flush().  Use the macros below, which
+ * have the compiler check the format against the arguments: a
+ * pointer, and for log_verbose_deferred_u() an unsigned int, e.g.
+ * "foo driver_begin_tone %p %u".
+ */
+void log_deferred(const char *const format, const void *const ptr,
+                  const int has_value, const unsigned int value)
+    __attribute__ ((nonnull (1)));
+
+/* Never called, only there for the format check */
+static inline
+void log_deferred_format_check(const char *const format, ...)
+    __attribute__ ((format (printf, 1, 2)));
+
+static inline
+void log_deferred_format_check(const char *const format, ...)
+{
+    (void)format;
+}
+
+#define log_verbose_deferred(format, ptr)                       \
+    do {                                                        \
+        if (0) {                                                \
+            log_deferred_format_check(format, ptr);             \
+        }                                                       \
+        if ((BEEP_LOG_MAX_LEVEL > 0) && (log_level > 0)) {      \
+            log_deferred(format, ptr, 0, 0U);                   \
+        }                                                       \
+    } while (0)
+
+#define log_verbose_deferred_u(format, ptr, value)              \
+    do {                                                        \
+        if (0) {                                                \
+            log_deferred_format_check(format, ptr, value);      \
+        }                                                       \
+        if ((BEEP_LOG_MAX_LEVEL > 0) && (log_level > 0)) {      \
+            log_deferred(format, ptr, 1, value);                \
+        }                                                       \
+    } while (0)
+
+
+/** Format and write out all messages recorded by log_deferred().
+ *
+ * This happens automatically before any other message is written
+ * and at exit(3).  When the ring buffer is full, new messages
+ * overwrite the oldest ones, which log_flush() reports as dropped.
+ */
+void log_flush(void);
+
 
 /** Log a range of data */
 void log_data(const void *const buf, const size_t start_ofs, const size_t size)
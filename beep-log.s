@@ -0,0 +1,4741 @@
+	.file	"beep-log.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-log.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Verbose"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"%s: %s: %lu earlier messages dropped\n"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"%s: %s: "
+	.text
+	.globl	log_flush
+	.type	log_flush, @function
+log_flush:
+.LFB55:
+	.file 1 "beep-log.c"
+	.loc 1 91 1 view -0
+	.cfi_startproc
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 92 5 view .LVU1
+	.loc 1 92 26 is_stmt 0 view .LVU2
+	movq	log_ring_dropped(%rip), %r9
+	.loc 1 92 8 view .LVU3
+	testq	%r9, %r9
+	jne	.L9
+.L2:
+.LVL0:
+.LBB25:
+	.loc 1 97 23 is_stmt 1 discriminator 1 view .LVU4
+	cmpq	$0, log_ring_count(%rip)
+	je	.L3
+	.loc 1 97 23 is_stmt 0 view .LVU5
+	movl	$0, %ebp
+.LBB26:
+.LBB27:
+.LBB28:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdio2.h"
+	.loc 2 79 10 view .LVU6
+	leaq	.LC2(%rip), %r13
+.LBE28:
+.LBE27:
+	.loc 1 101 18 view .LVU7
+	leaq	log_ring(%rip), %r12
+	jmp	.L6
+.LVL1:
+.L9:
+	.loc 1 101 18 view .LVU8
+.LBE26:
+.LBE25:
+	.loc 1 93 9 is_stmt 1 view .LVU9
+.LBB43:
+.LBI43:
+	.loc 2 77 1 view .LVU10
+.LBB44:
+	.loc 2 79 3 view .LVU11
+	.loc 2 79 10 is_stmt 0 view .LVU12
+	leaq	.LC0(%rip), %r8
+	movq	progname(%rip), %rcx
+	leaq	.LC1(%rip), %rdx
+	movl	$1, %esi
+	movq	stderr(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL2:
+	.loc 2 79 10 view .LVU13
+.LBE44:
+.LBE43:
+	.loc 1 95 9 is_stmt 1 view .LVU14
+	.loc 1 95 26 is_stmt 0 view .LVU15
+	movq	$0, log_ring_dropped(%rip)
+	jmp	.L2
+.LVL3:
+.L4:
+.LBB45:
+.LBB41:
+	.loc 1 104 13 is_stmt 1 view .LVU16
+.LBB30:
+.LBI30:
+	.loc 2 77 1 view .LVU17
+.LBB31:
+	.loc 2 79 3 view .LVU18
+.LBE31:
+.LBE30:
+	.loc 1 104 48 is_stmt 0 view .LVU19
+	leaq	(%rbx,%rbx), %rax
+	leaq	(%rax,%rbx), %rdx
+.LBB33:
+.LBB32:
+	.loc 2 79 10 view .LVU20
+	movq	8(%r12,%rdx,8), %rcx
+	movq	(%r12,%rdx,8), %rdx
+	movl	$1, %esi
+	movq	stderr(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL4:
+.L5:
+	.loc 2 79 10 view .LVU21
+.LBE32:
+.LBE33:
+	.loc 1 106 9 is_stmt 1 discriminator 2 view .LVU22
+	movq	stderr(%rip), %rsi
+	movl	$10, %edi
+	call	fputc@PLT
+.LVL5:
+.LBE41:
+	.loc 1 97 40 discriminator 2 view .LVU23
+	addq	$1, %rbp
+.LVL6:
+	.loc 1 97 23 discriminator 2 view .LVU24
+	cmpq	log_ring_count(%rip), %rbp
+	jnb	.L3
+.LVL7:
+.L6:
+.LBB42:
+	.loc 1 98 9 view .LVU25
+	.loc 1 99 39 is_stmt 0 view .LVU26
+	movq	%rbp, %rbx
+	addq	log_ring_start(%rip), %rbx
+	.loc 1 99 44 view .LVU27
+	andl	$4095, %ebx
+.LVL8:
+	.loc 1 100 9 is_stmt 1 view .LVU28
+.LBB34:
+.LBI27:
+	.loc 2 77 1 view .LVU29
+.LBB29:
+	.loc 2 79 3 view .LVU30
+	.loc 2 79 10 is_stmt 0 view .LVU31
+	leaq	.LC0(%rip), %r8
+	movq	progname(%rip), %rcx
+	movq	%r13, %rdx
+	movl	$1, %esi
+	movq	stderr(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL9:
+	.loc 2 79 10 view .LVU32
+.LBE29:
+.LBE34:
+	.loc 1 101 9 is_stmt 1 view .LVU33
+	.loc 1 101 18 is_stmt 0 view .LVU34
+	leaq	(%rbx,%rbx,2), %rax
+	.loc 1 101 12 view .LVU35
+	cmpl	$0, 16(%r12,%rax,8)
+	je	.L4
+	.loc 1 102 13 is_stmt 1 view .LVU36
+.LVL10:
+.LBB35:
+.LBI35:
+	.loc 2 77 1 view .LVU37
+.LBB36:
+	.loc 2 79 3 view .LVU38
+.LBE36:
+.LBE35:
+	.loc 1 102 60 is_stmt 0 view .LVU39
+	leaq	(%rbx,%rbx), %rax
+	leaq	(%rax,%rbx), %rdx
+	leaq	(%r12,%rdx,8), %rdx
+.LBB39:
+.LBB37:
+	.loc 2 79 10 view .LVU40
+	movq	8(%rdx), %rcx
+.LBE37:
+.LBE39:
+	.loc 1 102 33 view .LVU41
+	addq	%rbx, %rax
+.LBB40:
+.LBB38:
+	.loc 2 79 10 view .LVU42
+	movq	(%r12,%rax,8), %rax
+	movl	20(%rdx), %r8d
+	movq	%rax, %rdx
+	movl	$1, %esi
+	movq	stderr(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL11:
+	.loc 2 79 10 view .LVU43
+	jmp	.L5
+.LVL12:
+.L3:
+	.loc 2 79 10 view .LVU44
+.LBE38:
+.LBE40:
+.LBE42:
+.LBE45:
+	.loc 1 108 5 is_stmt 1 view .LVU45
+	.loc 1 108 20 is_stmt 0 view .LVU46
+	movq	$0, log_ring_start(%rip)
+	.loc 1 109 5 is_stmt 1 view .LVU47
+	.loc 1 109 20 is_stmt 0 view .LVU48
+	movq	$0, log_ring_count(%rip)
+	.loc 1 110 1 view .LVU49
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	log_flush, .-log_flush
+	.type	log_internal_vf, @function
+log_internal_vf:
+.LVL13:
+.LFB53:
+	.loc 1 63 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 63 1 is_stmt 0 view .LVU51
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	movq	%rsi, %r13
+	movq	%rdx, %rbp
+	movq	%rcx, %r12
+	.loc 1 64 5 is_stmt 1 view .LVU52
+	call	log_flush
+.LVL14:
+	.loc 1 65 5 view .LVU53
+.LBB46:
+.LBI46:
+	.loc 2 77 1 view .LVU54
+.LBB47:
+	.loc 2 79 3 view .LVU55
+	.loc 2 79 10 is_stmt 0 view .LVU56
+	movq	%r13, %r8
+	movq	progname(%rip), %rcx
+	leaq	.LC2(%rip), %rdx
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL15:
+	.loc 2 79 10 view .LVU57
+.LBE47:
+.LBE46:
+	.loc 1 66 5 is_stmt 1 view .LVU58
+.LBB48:
+.LBI48:
+	.loc 2 106 1 view .LVU59
+.LBB49:
+	.loc 2 109 3 view .LVU60
+	.loc 2 109 10 is_stmt 0 view .LVU61
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	__vfprintf_chk@PLT
+.LVL16:
+	.loc 2 109 10 view .LVU62
+.LBE49:
+.LBE48:
+	.loc 1 67 5 is_stmt 1 view .LVU63
+	movq	%rbx, %rsi
+	movl	$10, %edi
+	call	fputc@PLT
+.LVL17:
+	.loc 1 68 1 is_stmt 0 view .LVU64
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL18:
+	.loc 1 68 1 view .LVU65
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL19:
+	.loc 1 68 1 view .LVU66
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL20:
+	.loc 1 68 1 view .LVU67
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL21:
+	.loc 1 68 1 view .LVU68
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	log_internal_vf, .-log_internal_vf
+	.globl	log_deferred
+	.type	log_deferred, @function
+log_deferred:
+.LVL22:
+.LFB54:
+	.loc 1 74 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 74 1 is_stmt 0 view .LVU70
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	%rsi, %r11
+	movl	%edx, %r10d
+	movl	%ecx, %r9d
+	.loc 1 75 5 is_stmt 1 view .LVU71
+	.loc 1 76 35 is_stmt 0 view .LVU72
+	movq	log_ring_start(%rip), %rcx
+.LVL23:
+	.loc 1 76 35 view .LVU73
+	movq	log_ring_count(%rip), %rsi
+.LVL24:
+	.loc 1 76 35 view .LVU74
+	leaq	(%rcx,%rsi), %rax
+	.loc 1 76 53 view .LVU75
+	andl	$4095, %eax
+.LVL25:
+	.loc 1 77 5 is_stmt 1 view .LVU76
+	.loc 1 77 19 is_stmt 0 view .LVU77
+	leaq	log_ring(%rip), %r8
+	leaq	(%rax,%rax), %rdx
+.LVL26:
+	.loc 1 77 19 view .LVU78
+	leaq	(%rdx,%rax), %rdi
+.LVL27:
+	.loc 1 77 19 view .LVU79
+	leaq	(%r8,%rdi,8), %rdi
+	movq	%rbx, (%rdi)
+	.loc 1 78 5 is_stmt 1 view .LVU80
+	.loc 1 78 16 is_stmt 0 view .LVU81
+	movq	%r11, 8(%rdi)
+	.loc 1 79 5 is_stmt 1 view .LVU82
+	.loc 1 79 22 is_stmt 0 view .LVU83
+	movl	%r10d, 16(%rdi)
+	.loc 1 80 5 is_stmt 1 view .LVU84
+	.loc 1 80 18 is_stmt 0 view .LVU85
+	addq	%rax, %rdx
+	movl	%r9d, 20(%r8,%rdx,8)
+	.loc 1 81 5 is_stmt 1 view .LVU86
+	.loc 1 81 8 is_stmt 0 view .LVU87
+	cmpq	$4095, %rsi
+	ja	.L13
+	.loc 1 82 9 is_stmt 1 view .LVU88
+	addq	$1, %rsi
+	movq	%rsi, log_ring_count(%rip)
+.L12:
+	.loc 1 87 1 is_stmt 0 view .LVU89
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL28:
+	.loc 1 87 1 view .LVU90
+	ret
+.LVL29:
+.L13:
+	.cfi_restore_state
+	.loc 1 84 9 is_stmt 1 view .LVU91
+	.loc 1 84 42 is_stmt 0 view .LVU92
+	addq	$1, %rcx
+	.loc 1 84 47 view .LVU93
+	andl	$4095, %ecx
+	movq	%rcx, log_ring_start(%rip)
+	.loc 1 85 9 is_stmt 1 view .LVU94
+	addq	$1, log_ring_dropped(%rip)
+	.loc 1 87 1 is_stmt 0 view .LVU95
+	jmp	.L12
+	.cfi_endproc
+.LFE54:
+	.size	log_deferred, .-log_deferred
+	.globl	log_output
+	.type	log_output, @function
+log_output:
+.LVL30:
+.LFB56:
+	.loc 1 114 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 114 1 is_stmt 0 view .LVU97
+	endbr64
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L17
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L17:
+	.loc 1 114 1 view .LVU98
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 115 5 is_stmt 1 view .LVU99
+	.loc 1 117 4 view .LVU100
+	movl	$8, (%rsp)
+	movl	$48, 4(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 118 5 view .LVU101
+.LVL31:
+.LBB50:
+.LBI50:
+	.loc 2 106 1 view .LVU102
+.LBB51:
+	.loc 2 109 3 view .LVU103
+	.loc 2 109 10 is_stmt 0 view .LVU104
+	movq	%rsp, %rcx
+.LVL32:
+	.loc 2 109 10 view .LVU105
+	movq	%rdi, %rdx
+	movl	$1, %esi
+	movq	stdout(%rip), %rdi
+.LVL33:
+	.loc 2 109 10 view .LVU106
+	call	__vfprintf_chk@PLT
+.LVL34:
+	.loc 2 109 10 view .LVU107
+.LBE51:
+.LBE50:
+	.loc 1 119 4 is_stmt 1 view .LVU108
+	.loc 1 120 1 is_stmt 0 view .LVU109
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L20
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L20:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL35:
+	.cfi_endproc
+.LFE56:
+	.size	log_output, .-log_output
+	.section	.rodata.str1.1
+.LC3:
+	.string	"Error"
+	.text
+	.globl	log_error
+	.type	log_error, @function
+log_error:
+.LVL36:
+.LFB57:
+	.loc 1 124 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 124 1 is_stmt 0 view .LVU111
+	endbr64
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L22
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L22:
+	.loc 1 124 1 view .LVU112
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 125 5 is_stmt 1 view .LVU113
+	.loc 1 127 4 view .LVU114
+	movl	$8, (%rsp)
+	movl	$48, 4(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 128 5 view .LVU115
+	movq	%rsp, %rcx
+	movq	%rdi, %rdx
+	leaq	.LC3(%rip), %rsi
+	movq	stdout(%rip), %rdi
+.LVL37:
+	.loc 1 128 5 is_stmt 0 view .LVU116
+	call	log_internal_vf
+.LVL38:
+	.loc 1 129 4 is_stmt 1 view .LVU117
+	.loc 1 130 1 is_stmt 0 view .LVU118
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L25
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L25:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL39:
+	.cfi_endproc
+.LFE57:
+	.size	log_error, .-log_error
+	.section	.rodata.str1.1
+.LC4:
+	.string	"Warning"
+	.text
+	.globl	log_warning
+	.type	log_warning, @function
+log_warning:
+.LVL40:
+.LFB58:
+	.loc 1 134 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 134 1 is_stmt 0 view .LVU120
+	endbr64
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L27
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L27:
+	.loc 1 134 1 view .LVU121
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 135 5 is_stmt 1 view .LVU122
+	.loc 1 137 4 view .LVU123
+	movl	$8, (%rsp)
+	movl	$48, 4(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 138 5 view .LVU124
+	movq	%rsp, %rcx
+	movq	%rdi, %rdx
+	leaq	.LC4(%rip), %rsi
+	movq	stdout(%rip), %rdi
+.LVL41:
+	.loc 1 138 5 is_stmt 0 view .LVU125
+	call	log_internal_vf
+.LVL42:
+	.loc 1 139 4 is_stmt 1 view .LVU126
+	.loc 1 140 1 is_stmt 0 view .LVU127
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L30
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L30:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL43:
+	.cfi_endproc
+.LFE58:
+	.size	log_warning, .-log_warning
+	.globl	log_verbose
+	.type	log_verbose, @function
+log_verbose:
+.LVL44:
+.LFB59:
+	.loc 1 144 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 1 is_stmt 0 view .LVU129
+	endbr64
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L32
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L32:
+	.loc 1 144 1 view .LVU130
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 145 5 is_stmt 1 view .LVU131
+	.loc 1 147 5 view .LVU132
+	.loc 1 147 8 is_stmt 0 view .LVU133
+	cmpl	$0, log_level(%rip)
+	jg	.L36
+.LVL45:
+.L31:
+	.loc 1 153 1 view .LVU134
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L37
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL46:
+.L36:
+	.cfi_restore_state
+	.loc 1 148 8 is_stmt 1 view .LVU135
+	movl	$8, (%rsp)
+	movl	$48, 4(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 150 9 view .LVU136
+	movq	%rsp, %rcx
+	movq	%rdi, %rdx
+	leaq	.LC0(%rip), %rsi
+	movq	stderr(%rip), %rdi
+.LVL47:
+	.loc 1 150 9 is_stmt 0 view .LVU137
+	call	log_internal_vf
+.LVL48:
+	.loc 1 151 8 is_stmt 1 view .LVU138
+	.loc 1 153 1 is_stmt 0 view .LVU139
+	jmp	.L31
+.L37:
+	.loc 1 153 1 view .LVU140
+	call	__stack_chk_fail@PLT
+.LVL49:
+	.cfi_endproc
+.LFE59:
+	.size	log_verbose, .-log_verbose
+	.section	.rodata.str1.1
+.LC5:
+	.string	"Data"
+.LC6:
+	.string	"%s: %s: %s\n"
+	.text
+	.globl	log_data
+	.type	log_data, @function
+log_data:
+.LVL50:
+.LFB60:
+	.loc 1 158 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 158 1 is_stmt 0 view .LVU142
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	.loc 1 158 1 view .LVU143
+	movq	%fs:40, %rax
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	.loc 1 159 5 is_stmt 1 view .LVU144
+	.loc 1 159 8 is_stmt 0 view .LVU145
+	cmpl	$1, log_level(%rip)
+	jle	.L38
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	movq	%rdx, %r14
+	.loc 1 162 5 is_stmt 1 view .LVU146
+	call	log_flush
+.LVL51:
+	.loc 1 163 5 view .LVU147
+	.loc 1 164 5 view .LVU148
+	.loc 1 165 5 view .LVU149
+	.loc 1 165 10 is_stmt 0 view .LVU150
+	movabsq	$6872246879010172976, %rax
+	movabsq	$6854583495027547936, %rdx
+	movq	%rax, (%rsp)
+	movq	%rdx, 8(%rsp)
+	movabsq	$2332687724644868191, %rax
+	movabsq	$6872261444031766367, %rdx
+	movq	%rax, 16(%rsp)
+	movq	%rdx, 24(%rsp)
+	movabsq	$6854583495027547936, %rax
+	movabsq	$2332687724644868191, %rdx
+	movq	%rax, 32(%rsp)
+	movq	%rdx, 40(%rsp)
+	movabsq	$3323692118989365087, %rax
+	movabsq	$3255590356513599022, %rdx
+	movq	%rax, 48(%rsp)
+	movq	%rdx, 56(%rsp)
+	movabsq	$3327647950551526958, %rax
+	movl	$0, %edx
+	movq	%rax, 64(%rsp)
+	movq	%rdx, 72(%rsp)
+	.loc 1 167 5 is_stmt 1 view .LVU151
+.LBB52:
+	.loc 1 167 10 view .LVU152
+.LVL52:
+	.loc 1 167 53 view .LVU153
+	testq	%r14, %r14
+	je	.L38
+	addq	%rbx, %rbp
+.LVL53:
+	.loc 1 167 29 is_stmt 0 view .LVU154
+	movq	%r14, %r12
+.LBB53:
+	.loc 1 168 29 view .LVU155
+	leaq	hexchar.0(%rip), %rbx
+.LVL54:
+	.loc 1 168 29 view .LVU156
+	movq	%rsp, %r15
+.LBB54:
+.LBB55:
+	.loc 1 180 51 view .LVU157
+	movl	$46, %r13d
+	jmp	.L47
+.LVL55:
+.L46:
+	.loc 1 180 51 view .LVU158
+.LBE55:
+.LBE54:
+	.loc 1 191 9 is_stmt 1 discriminator 2 view .LVU159
+.LBB57:
+.LBI57:
+	.loc 2 77 1 discriminator 2 view .LVU160
+.LBB58:
+	.loc 2 79 3 discriminator 2 view .LVU161
+	.loc 2 79 10 is_stmt 0 discriminator 2 view .LVU162
+	movq	%r15, %r9
+	leaq	.LC5(%rip), %r8
+	movq	progname(%rip), %rcx
+	leaq	.LC6(%rip), %rdx
+.LVL56:
+	.loc 2 79 10 discriminator 2 view .LVU163
+	movl	$1, %esi
+	movq	stderr(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL57:
+	.loc 2 79 10 discriminator 2 view .LVU164
+.LBE58:
+.LBE57:
+.LBE53:
+	.loc 1 167 72 is_stmt 1 discriminator 2 view .LVU165
+	.loc 1 167 83 is_stmt 0 discriminator 2 view .LVU166
+	subq	$16, %r12
+.LVL58:
+	.loc 1 167 53 is_stmt 1 discriminator 2 view .LVU167
+	addq	$16, %rbp
+	movq	%r14, %rax
+	subq	%r12, %rax
+	cmpq	%r14, %rax
+	jnb	.L38
+.LVL59:
+.L47:
+	.loc 1 167 53 is_stmt 0 discriminator 2 view .LVU168
+	movq	%r14, %rax
+	subq	%r12, %rax
+.LVL60:
+.LBB61:
+	.loc 1 168 9 is_stmt 1 view .LVU169
+	.loc 1 168 39 is_stmt 0 view .LVU170
+	movq	%rax, %rdx
+	shrq	$12, %rdx
+	.loc 1 168 45 view .LVU171
+	andl	$15, %edx
+	.loc 1 168 20 view .LVU172
+	movzbl	(%rbx,%rdx), %edx
+	movb	%dl, (%rsp)
+	.loc 1 169 9 is_stmt 1 view .LVU173
+	.loc 1 169 39 is_stmt 0 view .LVU174
+	movq	%rax, %rdx
+	shrq	$8, %rdx
+	.loc 1 169 45 view .LVU175
+	andl	$15, %edx
+	.loc 1 169 20 view .LVU176
+	movzbl	(%rbx,%rdx), %edx
+	movb	%dl, 1(%rsp)
+	.loc 1 170 9 is_stmt 1 view .LVU177
+	.loc 1 170 39 is_stmt 0 view .LVU178
+	shrq	$4, %rax
+.LVL61:
+	.loc 1 170 45 view .LVU179
+	andl	$15, %eax
+	.loc 1 170 20 view .LVU180
+	movzbl	(%rbx,%rax), %eax
+	movb	%al, 2(%rsp)
+	.loc 1 171 9 is_stmt 1 view .LVU181
+	.loc 1 171 20 is_stmt 0 view .LVU182
+	movb	$48, 3(%rsp)
+	.loc 1 172 9 is_stmt 1 view .LVU183
+	.loc 1 172 22 is_stmt 0 view .LVU184
+	movl	$16, %edx
+	cmpq	%rdx, %r12
+	cmovbe	%r12, %rdx
+.LVL62:
+	.loc 1 173 9 is_stmt 1 view .LVU185
+.LBB59:
+	.loc 1 173 14 view .LVU186
+	.loc 1 173 39 view .LVU187
+	testq	%r12, %r12
+	je	.L41
+	.loc 1 173 39 is_stmt 0 view .LVU188
+	leaq	6(%rsp), %rsi
+	.loc 1 173 21 view .LVU189
+	movl	$0, %ecx
+.LVL63:
+.L43:
+.LBB56:
+	.loc 1 174 13 is_stmt 1 view .LVU190
+	.loc 1 175 13 view .LVU191
+	.loc 1 175 33 is_stmt 0 view .LVU192
+	movzbl	0(%rbp,%rcx), %eax
+.LVL64:
+	.loc 1 176 13 is_stmt 1 view .LVU193
+	.loc 1 177 13 view .LVU194
+	.loc 1 177 24 is_stmt 0 view .LVU195
+	movq	%rax, %rdi
+	andl	$15, %edi
+	movzbl	(%rbx,%rdi), %r8d
+.LVL65:
+	.loc 1 178 13 is_stmt 1 view .LVU196
+	.loc 1 176 51 is_stmt 0 view .LVU197
+	movl	%eax, %edi
+	shrb	$4, %dil
+	.loc 1 176 24 view .LVU198
+	andl	$15, %edi
+	.loc 1 178 36 view .LVU199
+	movzbl	(%rbx,%rdi), %edi
+	movb	%dil, (%rsi)
+	.loc 1 179 13 is_stmt 1 view .LVU200
+	.loc 1 179 36 is_stmt 0 view .LVU201
+	movb	%r8b, 1(%rsi)
+	.loc 1 180 13 is_stmt 1 view .LVU202
+	.loc 1 180 67 is_stmt 0 view .LVU203
+	leal	-32(%rax), %edi
+	.loc 1 180 51 view .LVU204
+	cmpb	$96, %dil
+	cmovnb	%r13d, %eax
+.LVL66:
+	.loc 1 180 46 view .LVU205
+	movq	%rcx, %r8
+.LVL67:
+	.loc 1 180 46 view .LVU206
+	shrq	$3, %r8
+	.loc 1 180 51 view .LVU207
+	leaq	96(%rcx), %rdi
+	addq	%rsp, %rdi
+	movb	%al, -41(%r8,%rdi)
+.LVL68:
+	.loc 1 180 51 view .LVU208
+.LBE56:
+	.loc 1 173 51 is_stmt 1 view .LVU209
+	addq	$1, %rcx
+.LVL69:
+	.loc 1 173 39 view .LVU210
+	addq	$3, %rsi
+	cmpq	%rdx, %rcx
+	jb	.L43
+.LVL70:
+	.loc 1 173 39 is_stmt 0 view .LVU211
+.LBE59:
+.LBB60:
+	.loc 1 182 47 is_stmt 1 view .LVU212
+	cmpq	$15, %r12
+	ja	.L44
+.LVL71:
+.L41:
+	.loc 1 182 47 is_stmt 0 view .LVU213
+	leaq	6(%rdx,%rdx,2), %rax
+	addq	%r15, %rax
+.LVL72:
+.L45:
+	.loc 1 183 13 is_stmt 1 discriminator 3 view .LVU214
+	.loc 1 183 36 is_stmt 0 discriminator 3 view .LVU215
+	movb	$32, (%rax)
+	.loc 1 184 13 is_stmt 1 discriminator 3 view .LVU216
+	.loc 1 184 36 is_stmt 0 discriminator 3 view .LVU217
+	movb	$32, 1(%rax)
+	.loc 1 185 13 is_stmt 1 discriminator 3 view .LVU218
+	.loc 1 185 46 is_stmt 0 discriminator 3 view .LVU219
+	movq	%rdx, %rsi
+	shrq	$3, %rsi
+	.loc 1 185 51 discriminator 3 view .LVU220
+	leaq	96(%rdx), %rcx
+	addq	%rsp, %rcx
+	movb	$32, -41(%rsi,%rcx)
+	.loc 1 182 52 is_stmt 1 discriminator 3 view .LVU221
+	addq	$1, %rdx
+.LVL73:
+	.loc 1 182 47 discriminator 3 view .LVU222
+	addq	$3, %rax
+	cmpq	$15, %rdx
+	jbe	.L45
+.L44:
+	.loc 1 182 47 is_stmt 0 discriminator 3 view .LVU223
+.LBE60:
+	.loc 1 187 9 is_stmt 1 view .LVU224
+	.loc 1 187 12 is_stmt 0 view .LVU225
+	cmpq	$8, %r12
+	ja	.L46
+	.loc 1 188 13 is_stmt 1 view .LVU226
+	.loc 1 188 30 is_stmt 0 view .LVU227
+	movb	$32, 29(%rsp)
+	.loc 1 189 13 is_stmt 1 view .LVU228
+	.loc 1 189 33 is_stmt 0 view .LVU229
+	movb	$32, 63(%rsp)
+	jmp	.L46
+.LVL74:
+.L38:
+	.loc 1 189 33 view .LVU230
+.LBE61:
+.LBE52:
+	.loc 1 193 1 view .LVU231
+	movq	88(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L53
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L53:
+	.cfi_restore_state
+	call	__stack_chk_fail@PLT
+.LVL75:
+	.cfi_endproc
+.LFE60:
+	.size	log_data, .-log_data
+	.globl	log_init
+	.type	log_init, @function
+log_init:
+.LVL76:
+.LFB61:
+	.loc 1 196 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 196 51 is_stmt 0 view .LVU233
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	%edi, %ebx
+	movq	%rsi, %rbp
+	.loc 1 197 5 is_stmt 1 view .LVU234
+	leaq	log_flush(%rip), %rdi
+.LVL77:
+	.loc 1 197 5 is_stmt 0 view .LVU235
+	call	atexit@PLT
+.LVL78:
+	.loc 1 200 5 is_stmt 1 view .LVU236
+	.loc 1 200 8 is_stmt 0 view .LVU237
+	testl	%ebx, %ebx
+	jle	.L54
+.LBB62:
+	.loc 1 201 9 is_stmt 1 view .LVU238
+	.loc 1 201 34 is_stmt 0 view .LVU239
+	movq	0(%rbp), %rbx
+.LVL79:
+	.loc 1 201 34 view .LVU240
+	movl	$47, %esi
+	movq	%rbx, %rdi
+	call	strrchr@PLT
+.LVL80:
+	.loc 1 202 9 is_stmt 1 view .LVU241
+.LBB63:
+	.loc 1 203 25 is_stmt 0 view .LVU242
+	leaq	1(%rax), %rdx
+	testq	%rax, %rax
+	movq	%rbx, %rax
+.LVL81:
+	.loc 1 203 25 view .LVU243
+	cmovne	%rdx, %rax
+	movq	%rax, progname(%rip)
+.LVL82:
+.L54:
+	.loc 1 203 25 view .LVU244
+.LBE63:
+.LBE62:
+	.loc 1 211 1 view .LVU245
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL83:
+	.loc 1 211 1 view .LVU246
+	ret
+	.cfi_endproc
+.LFE61:
+	.size	log_init, .-log_init
+	.section	.rodata
+	.align 16
+	.type	hexchar.0, @object
+	.size	hexchar.0, 17
+hexchar.0:
+	.string	"0123456789abcdef"
+	.local	log_ring_dropped
+	.comm	log_ring_dropped,8,8
+	.local	log_ring_count
+	.comm	log_ring_count,8,8
+	.local	log_ring_start
+	.comm	log_ring_start,8,8
+	.local	log_ring
+	.comm	log_ring,98304,32
+	.globl	progname
+	.section	.rodata.str1.1
+.LC7:
+	.string	"beep-log"
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	progname, @object
+	.size	progname, 8
+progname:
+	.quad	.LC7
+	.globl	log_level
+	.bss
+	.align 4
+	.type	log_level, @object
+	.size	log_level, 4
+log_level:
+	.zero	4
+	.text
+.Letext0:
+	.file 3 "<built-in>"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 9 "/usr/include/stdio.h"
+	.file 10 "beep-log.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 "/usr/include/stdlib.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/stdio2-decl.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xdd0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF102
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x26
+	.long	.LASF103
+	.long	0x43
+	.uleb128 0xf
+	.long	0x5a
+	.long	0x53
+	.uleb128 0x12
+	.long	0x53
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x27
+	.long	.LASF104
+	.byte	0x18
+	.byte	0x3
+	.byte	0
+	.long	0x8f
+	.uleb128 0x14
+	.long	.LASF2
+	.long	0x8f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3
+	.long	0x8f
+	.byte	0x4
+	.uleb128 0x14
+	.long	.LASF4
+	.long	0x9b
+	.byte	0x8
+	.uleb128 0x14
+	.long	.LASF5
+	.long	0x9b
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x5
+	.long	0x8f
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xd
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x2e
+	.uleb128 0xd
+	.long	.LASF10
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x53
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF11
+	.uleb128 0x5
+	.long	0xba
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0xdb
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0xd
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x98
+	.byte	0x12
+	.long	0xe7
+	.uleb128 0xd
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x99
+	.byte	0x12
+	.long	0xe7
+	.uleb128 0x3
+	.long	0x110
+	.uleb128 0x5
+	.long	0x106
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF18
+	.uleb128 0x5
+	.long	0x110
+	.uleb128 0x2a
+	.long	.LASF105
+	.byte	0xd8
+	.byte	0x7
+	.byte	0x31
+	.byte	0x8
+	.long	0x2a3
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x33
+	.byte	0x7
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x7
+	.byte	0x36
+	.byte	0x9
+	.long	0x106
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x7
+	.byte	0x37
+	.byte	0x9
+	.long	0x106
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x38
+	.byte	0x9
+	.long	0x106
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x39
+	.byte	0x9
+	.long	0x106
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x9
+	.long	0x106
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x9
+	.long	0x106
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x9
+	.long	0x106
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x9
+	.long	0x106
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x40
+	.byte	0x9
+	.long	0x106
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x41
+	.byte	0x9
+	.long	0x106
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x42
+	.byte	0x9
+	.long	0x106
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x44
+	.byte	0x16
+	.long	0x2bc
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x46
+	.byte	0x14
+	.long	0x2c1
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x48
+	.byte	0x7
+	.long	0xdb
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x49
+	.byte	0x7
+	.long	0xdb
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xb
+	.long	0xee
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x12
+	.long	0xc6
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xf
+	.long	0xcd
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2c6
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x7
+	.byte	0x51
+	.byte	0xf
+	.long	0x2d6
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x59
+	.byte	0xd
+	.long	0xfa
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2e0
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2ea
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2c1
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x5e
+	.byte	0x9
+	.long	0x9b
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x5f
+	.byte	0xa
+	.long	0xa9
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x60
+	.byte	0x7
+	.long	0xdb
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x7
+	.byte	0x62
+	.byte	0x8
+	.long	0x2ef
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x7
+	.byte	0x19
+	.long	0x11c
+	.uleb128 0x2b
+	.long	.LASF106
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x17
+	.long	.LASF49
+	.uleb128 0x3
+	.long	0x2b7
+	.uleb128 0x3
+	.long	0x11c
+	.uleb128 0xf
+	.long	0x110
+	.long	0x2d6
+	.uleb128 0x12
+	.long	0x53
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x2af
+	.uleb128 0x17
+	.long	.LASF50
+	.uleb128 0x3
+	.long	0x2db
+	.uleb128 0x17
+	.long	.LASF51
+	.uleb128 0x3
+	.long	0x2e5
+	.uleb128 0xf
+	.long	0x110
+	.long	0x2ff
+	.uleb128 0x12
+	.long	0x53
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	0x2a3
+	.uleb128 0x1e
+	.long	0x2ff
+	.uleb128 0x15
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x90
+	.byte	0xe
+	.long	0x2ff
+	.uleb128 0x15
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x91
+	.byte	0xe
+	.long	0x2ff
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF54
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF55
+	.uleb128 0x3
+	.long	0x339
+	.uleb128 0x5
+	.long	0x32f
+	.uleb128 0x2c
+	.uleb128 0x3
+	.long	0x117
+	.uleb128 0x1e
+	.long	0x33a
+	.uleb128 0x5
+	.long	0x33a
+	.uleb128 0x15
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0xdb
+	.uleb128 0x15
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x23
+	.byte	0x14
+	.long	0x33a
+	.uleb128 0x1f
+	.long	0x349
+	.byte	0x1b
+	.byte	0x5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_level
+	.uleb128 0x1f
+	.long	0x355
+	.byte	0x1e
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	progname
+	.uleb128 0x2d
+	.byte	0x18
+	.byte	0x1
+	.byte	0x27
+	.byte	0x9
+	.long	0x3c1
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x28
+	.byte	0x11
+	.long	0x33a
+	.byte	0
+	.uleb128 0x2e
+	.string	"ptr"
+	.byte	0x1
+	.byte	0x29
+	.byte	0x11
+	.long	0x32f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF59
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x9
+	.long	0xdb
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x12
+	.long	0x8f
+	.byte	0x14
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF61
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x3
+	.long	0x383
+	.uleb128 0x5
+	.long	0x3c1
+	.uleb128 0xf
+	.long	0x3c1
+	.long	0x3e3
+	.uleb128 0x2f
+	.long	0x53
+	.value	0xfff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF62
+	.byte	0x2f
+	.byte	0x17
+	.long	0x3d2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_ring
+	.uleb128 0xb
+	.long	.LASF63
+	.byte	0x30
+	.byte	0xf
+	.long	0xa9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_ring_start
+	.uleb128 0xb
+	.long	.LASF64
+	.byte	0x31
+	.byte	0xf
+	.long	0xa9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_ring_count
+	.uleb128 0xb
+	.long	.LASF65
+	.byte	0x32
+	.byte	0x16
+	.long	0x53
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_ring_dropped
+	.uleb128 0x18
+	.long	.LASF66
+	.byte	0xb
+	.value	0x111
+	.byte	0xe
+	.long	0x106
+	.long	0x453
+	.uleb128 0x6
+	.long	0x33a
+	.uleb128 0x6
+	.long	0xdb
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF67
+	.byte	0xc
+	.value	0x267
+	.byte	0xc
+	.long	0xdb
+	.long	0x46a
+	.uleb128 0x6
+	.long	0x46a
+	.byte	0
+	.uleb128 0x3
+	.long	0x46f
+	.uleb128 0x30
+	.uleb128 0x20
+	.long	.LASF68
+	.byte	0x34
+	.long	0xdb
+	.long	0x493
+	.uleb128 0x6
+	.long	0x304
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x6
+	.long	0x33f
+	.uleb128 0x6
+	.long	0x493
+	.byte	0
+	.uleb128 0x3
+	.long	0x5a
+	.uleb128 0x20
+	.long	.LASF69
+	.byte	0x31
+	.long	0xdb
+	.long	0x4b7
+	.uleb128 0x6
+	.long	0x304
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x6
+	.long	0x33f
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF70
+	.byte	0x9
+	.value	0x225
+	.byte	0xc
+	.long	0xdb
+	.long	0x4d3
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x6
+	.long	0x2ff
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF74
+	.byte	0xc4
+	.byte	0x6
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x597
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xc4
+	.byte	0x19
+	.long	0xe2
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xc4
+	.byte	0x2b
+	.long	0x597
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x16
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.long	0x57b
+	.uleb128 0x9
+	.long	.LASF73
+	.byte	0xc9
+	.byte	0x15
+	.long	0x33a
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x16
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.long	0x560
+	.uleb128 0x31
+	.long	.LASF107
+	.byte	0x1
+	.byte	0xcb
+	.byte	0x19
+	.long	0x33a
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL80
+	.long	0x437
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2f
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL78
+	.long	0x453
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	log_flush
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x9d
+	.byte	0x6
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x795
+	.uleb128 0x21
+	.string	"buf"
+	.byte	0x9d
+	.byte	0x21
+	.long	0x334
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0x9d
+	.byte	0x33
+	.long	0xb5
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0x9d
+	.byte	0x4b
+	.long	0xb5
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x9
+	.long	.LASF78
+	.byte	0xa3
+	.byte	0x20
+	.long	0x79a
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xb
+	.long	.LASF79
+	.byte	0xa4
+	.byte	0x17
+	.long	0x7af
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hexchar.0
+	.uleb128 0xb
+	.long	.LASF80
+	.byte	0xa5
+	.byte	0xa
+	.long	0x7b4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x16
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.long	0x77a
+	.uleb128 0x9
+	.long	.LASF81
+	.byte	0xa7
+	.byte	0x11
+	.long	0xa9
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x9
+	.long	.LASF82
+	.byte	0xa7
+	.byte	0x1d
+	.long	0xa9
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x19
+	.long	.LLRL37
+	.uleb128 0x9
+	.long	.LASF83
+	.byte	0xac
+	.byte	0x16
+	.long	0xb5
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x22
+	.long	.LLRL39
+	.long	0x6ea
+	.uleb128 0x9
+	.long	.LASF84
+	.byte	0xad
+	.byte	0x15
+	.long	0xa9
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x19
+	.long	.LLRL41
+	.uleb128 0x1a
+	.string	"ofs"
+	.byte	0xae
+	.byte	0x1a
+	.long	0xb5
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1a
+	.string	"ch"
+	.byte	0xaf
+	.byte	0x21
+	.long	0xc1
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x9
+	.long	.LASF85
+	.byte	0xb0
+	.byte	0x18
+	.long	0x117
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0xb1
+	.byte	0x18
+	.long	0x117
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.long	0x713
+	.uleb128 0x9
+	.long	.LASF84
+	.byte	0xb6
+	.byte	0x15
+	.long	0xa9
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x23
+	.long	0xda4
+	.quad	.LBI57
+	.byte	.LVU160
+	.quad	.LBB57
+	.quad	.LBE57-.LBB57
+	.byte	0xbf
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x11
+	.long	0xdb2
+	.uleb128 0x7
+	.quad	.LVL57
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL51
+	.long	0x9e7
+	.uleb128 0xe
+	.quad	.LVL75
+	.long	0xdca
+	.byte	0
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x5
+	.long	0x795
+	.uleb128 0xf
+	.long	0x117
+	.long	0x7af
+	.uleb128 0x12
+	.long	0x53
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x79f
+	.uleb128 0xf
+	.long	0x110
+	.long	0x7c4
+	.uleb128 0x12
+	.long	0x53
+	.byte	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF87
+	.byte	0x8f
+	.byte	0x7
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x83f
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x8f
+	.byte	0x26
+	.long	0x344
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x10
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0x91
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1b
+	.quad	.LVL48
+	.long	0xc09
+	.long	0x831
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL49
+	.long	0xdca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF89
+	.byte	0x85
+	.byte	0x6
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ba
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x85
+	.byte	0x24
+	.long	0x344
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x10
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0x87
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1b
+	.quad	.LVL42
+	.long	0xc09
+	.long	0x8ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL43
+	.long	0xdca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF90
+	.byte	0x7b
+	.byte	0x6
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x935
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x7b
+	.byte	0x22
+	.long	0x344
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x10
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0x7d
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1b
+	.quad	.LVL38
+	.long	0xc09
+	.long	0x927
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL39
+	.long	0xdca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF91
+	.byte	0x71
+	.byte	0x6
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9e7
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x71
+	.byte	0x23
+	.long	0x344
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x10
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0x73
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1c
+	.long	0xd74
+	.quad	.LBI50
+	.byte	.LVU102
+	.quad	.LBB50
+	.quad	.LBE50-.LBB50
+	.byte	0x76
+	.long	0x9d9
+	.uleb128 0x8
+	.long	0xd98
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.long	0xd8d
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x11
+	.long	0xd82
+	.uleb128 0x7
+	.quad	.LVL34
+	.long	0x470
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL35
+	.long	0xdca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x5a
+	.byte	0x6
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb78
+	.uleb128 0x22
+	.long	.LLRL0
+	.long	0xb18
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x61
+	.byte	0x11
+	.long	0xa9
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x19
+	.long	.LLRL2
+	.uleb128 0x9
+	.long	.LASF93
+	.byte	0x62
+	.byte	0x25
+	.long	0xb7d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1d
+	.long	0xda4
+	.quad	.LBI27
+	.byte	.LVU29
+	.long	.LLRL4
+	.byte	0x64
+	.byte	0x9
+	.long	0xa87
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x11
+	.long	0xdb2
+	.uleb128 0x7
+	.quad	.LVL9
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0xda4
+	.quad	.LBI30
+	.byte	.LVU17
+	.long	.LLRL6
+	.byte	0x68
+	.byte	0xd
+	.long	0xac5
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x11
+	.long	0xdb2
+	.uleb128 0x7
+	.quad	.LVL4
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0xda4
+	.quad	.LBI35
+	.byte	.LVU37
+	.long	.LLRL8
+	.byte	0x66
+	.byte	0xd
+	.long	0xb03
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x11
+	.long	0xdb2
+	.uleb128 0x7
+	.quad	.LVL11
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL5
+	.long	0x4b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0xda4
+	.quad	.LBI43
+	.byte	.LVU10
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0x5d
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x11
+	.long	0xdb2
+	.uleb128 0x7
+	.quad	.LVL2
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x3cd
+	.uleb128 0x5
+	.long	0xb78
+	.uleb128 0xc
+	.long	.LASF94
+	.byte	0x48
+	.byte	0x6
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbff
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x48
+	.byte	0x25
+	.long	0x344
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x21
+	.string	"ptr"
+	.byte	0x48
+	.byte	0x3f
+	.long	0x334
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x4
+	.long	.LASF59
+	.byte	0x49
+	.byte	0x1d
+	.long	0xe2
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x4
+	.long	.LASF60
+	.byte	0x49
+	.byte	0x3b
+	.long	0x96
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x9
+	.long	.LASF93
+	.byte	0x4b
+	.byte	0x1b
+	.long	0xc04
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x3
+	.long	0x3c1
+	.uleb128 0x5
+	.long	0xbff
+	.uleb128 0x32
+	.long	.LASF108
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x6
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd74
+	.uleb128 0x4
+	.long	.LASF95
+	.byte	0x3d
+	.byte	0x1c
+	.long	0x2ff
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.long	.LASF96
+	.byte	0x3d
+	.byte	0x30
+	.long	0x33a
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x3e
+	.byte	0x28
+	.long	0x344
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x4
+	.long	.LASF88
+	.byte	0x3e
+	.byte	0x38
+	.long	0x493
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1c
+	.long	0xda4
+	.quad	.LBI46
+	.byte	.LVU54
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.byte	0x41
+	.long	0xcdd
+	.uleb128 0x8
+	.long	0xdbd
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x8
+	.long	0xdb2
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x7
+	.quad	.LVL15
+	.long	0x498
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xd74
+	.quad	.LBI48
+	.byte	.LVU59
+	.quad	.LBB48
+	.quad	.LBE48-.LBB48
+	.byte	0x42
+	.long	0xd4d
+	.uleb128 0x8
+	.long	0xd98
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x8
+	.long	0xd8d
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.long	0xd82
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.quad	.LVL16
+	.long	0x470
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL14
+	.long	0x9e7
+	.uleb128 0x7
+	.quad	.LVL17
+	.long	0x4b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF100
+	.byte	0x6a
+	.long	0xdb
+	.long	0xda4
+	.uleb128 0x13
+	.long	.LASF97
+	.byte	0x6a
+	.byte	0x1c
+	.long	0x304
+	.uleb128 0x13
+	.long	.LASF98
+	.byte	0x6b
+	.byte	0x1b
+	.long	0x33f
+	.uleb128 0x13
+	.long	.LASF99
+	.byte	0x6b
+	.byte	0x31
+	.long	0x493
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF101
+	.byte	0x4d
+	.long	0xdb
+	.long	0xdca
+	.uleb128 0x13
+	.long	.LASF97
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x304
+	.uleb128 0x13
+	.long	.LASF98
+	.byte	0x4d
+	.byte	0x3c
+	.long	0x33f
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF109
+	.long	.LASF109
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU241
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU244
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU230
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU153
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU166
+	.uleb128 .LVU169
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU230
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU153
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU230
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU158
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU168
+	.uleb128 .LVU185
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU230
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x22
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x40
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775792
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x22
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x40
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775792
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x22
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x40
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775792
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU213
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU191
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0xe
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x20
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU193
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x7
+	.byte	0x72
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU194
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x3
+	.quad	hexchar.0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x16
+	.byte	0x76
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x34
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x3
+	.quad	hexchar.0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x18
+	.byte	0x72
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x94
+	.byte	0x1
+	.byte	0x34
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x3
+	.quad	hexchar.0
+	.byte	0x22
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU196
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 1
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU158
+	.uleb128 .LVU163
+	.uleb128 .LVU211
+	.uleb128 .LVU230
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU160
+	.uleb128 .LVU164
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC6
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 .LFE59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU102
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 .LVU8
+	.uleb128 .LVU16
+	.uleb128 .LVU44
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU16
+	.uleb128 .LVU25
+	.uleb128 .LVU28
+	.uleb128 .LVU44
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	log_ring
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	log_ring
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC2
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU17
+	.uleb128 .LVU21
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	log_ring
+	.byte	0x22
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU37
+	.uleb128 .LVU43
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	log_ring
+	.byte	0x22
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU10
+	.uleb128 .LVU13
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	log_ring
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC2
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF16:
+	.string	"__off_t"
+.LASF102:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF20:
+	.string	"_IO_read_ptr"
+.LASF32:
+	.string	"_chain"
+.LASF10:
+	.string	"size_t"
+.LASF38:
+	.string	"_shortbuf"
+.LASF2:
+	.string	"gp_offset"
+.LASF9:
+	.string	"va_list"
+.LASF95:
+	.string	"stream"
+.LASF26:
+	.string	"_IO_buf_base"
+.LASF56:
+	.string	"log_level"
+.LASF83:
+	.string	"line_cols"
+.LASF93:
+	.string	"entry"
+.LASF55:
+	.string	"long long unsigned int"
+.LASF89:
+	.string	"log_warning"
+.LASF74:
+	.string	"log_init"
+.LASF41:
+	.string	"_codecvt"
+.LASF67:
+	.string	"atexit"
+.LASF54:
+	.string	"long long int"
+.LASF13:
+	.string	"signed char"
+.LASF33:
+	.string	"_fileno"
+.LASF21:
+	.string	"_IO_read_end"
+.LASF91:
+	.string	"log_output"
+.LASF15:
+	.string	"long int"
+.LASF19:
+	.string	"_flags"
+.LASF103:
+	.string	"__builtin_va_list"
+.LASF27:
+	.string	"_IO_buf_end"
+.LASF36:
+	.string	"_cur_column"
+.LASF59:
+	.string	"has_value"
+.LASF50:
+	.string	"_IO_codecvt"
+.LASF35:
+	.string	"_old_offset"
+.LASF40:
+	.string	"_offset"
+.LASF78:
+	.string	"ucbuf"
+.LASF86:
+	.string	"hex_lo"
+.LASF92:
+	.string	"log_flush"
+.LASF107:
+	.string	"post_last_slash"
+.LASF90:
+	.string	"log_error"
+.LASF60:
+	.string	"value"
+.LASF49:
+	.string	"_IO_marker"
+.LASF7:
+	.string	"unsigned int"
+.LASF44:
+	.string	"_freeres_buf"
+.LASF101:
+	.string	"fprintf"
+.LASF4:
+	.string	"overflow_arg_area"
+.LASF6:
+	.string	"long unsigned int"
+.LASF24:
+	.string	"_IO_write_ptr"
+.LASF65:
+	.string	"log_ring_dropped"
+.LASF77:
+	.string	"size"
+.LASF12:
+	.string	"short unsigned int"
+.LASF28:
+	.string	"_IO_save_base"
+.LASF75:
+	.string	"log_data"
+.LASF39:
+	.string	"_lock"
+.LASF34:
+	.string	"_flags2"
+.LASF46:
+	.string	"_mode"
+.LASF96:
+	.string	"levelstr"
+.LASF52:
+	.string	"stdout"
+.LASF81:
+	.string	"line_ofs"
+.LASF8:
+	.string	"__gnuc_va_list"
+.LASF94:
+	.string	"log_deferred"
+.LASF25:
+	.string	"_IO_write_end"
+.LASF70:
+	.string	"fputc"
+.LASF106:
+	.string	"_IO_lock_t"
+.LASF105:
+	.string	"_IO_FILE"
+.LASF66:
+	.string	"strrchr"
+.LASF68:
+	.string	"__vfprintf_chk"
+.LASF63:
+	.string	"log_ring_start"
+.LASF87:
+	.string	"log_verbose"
+.LASF31:
+	.string	"_markers"
+.LASF11:
+	.string	"unsigned char"
+.LASF57:
+	.string	"progname"
+.LASF62:
+	.string	"log_ring"
+.LASF108:
+	.string	"log_internal_vf"
+.LASF14:
+	.string	"short int"
+.LASF51:
+	.string	"_IO_wide_data"
+.LASF37:
+	.string	"_vtable_offset"
+.LASF84:
+	.string	"col_ofs"
+.LASF48:
+	.string	"FILE"
+.LASF5:
+	.string	"reg_save_area"
+.LASF58:
+	.string	"format"
+.LASF69:
+	.string	"__fprintf_chk"
+.LASF109:
+	.string	"__stack_chk_fail"
+.LASF85:
+	.string	"hex_hi"
+.LASF76:
+	.string	"start_ofs"
+.LASF18:
+	.string	"char"
+.LASF73:
+	.string	"last_slash"
+.LASF97:
+	.string	"__stream"
+.LASF17:
+	.string	"__off64_t"
+.LASF22:
+	.string	"_IO_read_base"
+.LASF30:
+	.string	"_IO_save_end"
+.LASF99:
+	.string	"__ap"
+.LASF100:
+	.string	"vfprintf"
+.LASF98:
+	.string	"__fmt"
+.LASF45:
+	.string	"__pad5"
+.LASF79:
+	.string	"hexchar"
+.LASF47:
+	.string	"_unused2"
+.LASF53:
+	.string	"stderr"
+.LASF29:
+	.string	"_IO_backup_base"
+.LASF3:
+	.string	"fp_offset"
+.LASF64:
+	.string	"log_ring_count"
+.LASF71:
+	.string	"argc"
+.LASF43:
+	.string	"_freeres_list"
+.LASF42:
+	.string	"_wide_data"
+.LASF88:
+	.string	"args"
+.LASF72:
+	.string	"argv"
+.LASF23:
+	.string	"_IO_write_base"
+.LASF80:
+	.string	"linebuf"
+.LASF82:
+	.string	"remaining"
+.LASF104:
+	.string	"__va_list_tag"
+.LASF61:
+	.string	"log_ring_entry"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-log.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
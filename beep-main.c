@@ -37,19 +37,31 @@
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/auxv.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <linux/kd.h>
 #include <linux/input.h>
 
-#include "beep-drivers.h"
+#include "beep-device-cache.h"
 #include "beep-drivers.h"
 #include "beep-driver-console.h"
 #include "beep-driver-evdev.h"
+#include "beep-driver-fanout.h"
 #include "beep-driver-noop.h"
+#include "beep-driver-pcm.h"
+#include "beep-driver-pwm.h"
+#include "beep-driver-trace.h"
 #include "beep-library.h"
 #include "beep-log.h"
+#include "beep-notes.h"
+#include "beep-rtttl.h"
+#include "beep-score.h"
+#include "beep-sequence.h"
+#include "beep-sequence-cache.h"
+#include "beep-timeline.h"
+#include "beep-usdt.h"
 #include "beep-usage.h"
 
 
@@ -88,9 +100,10 @@ typedef struct _beep_parms_T beep_parms_T;
 struct _beep_parms_T
 {
     unsigned int freq; /* tone frequency (Hz)      */
-    unsigned int length;     /* tone length    (ms)      */
+    uint32_t     flags;      /* BEEP_TONE_NOTE for -f NOTE */
+    unsigned int length;     /* tone length (ms or ticks, see beep-notes.h) */
     unsigned int reps;       /* # of repetitions         */
-    unsigned int delay;      /* delay between reps  (ms) */
+    unsigned int delay;      /* delay between reps (ms or ticks) */
     end_delay_E  end_delay;  /* do we delay after last rep? */
     stdin_beep_E stdin_beep; /* are we using stdin triggers?  We have three options:
 		     - just beep and terminate (default)
@@ -100,10 +113,47 @@ struct _beep_parms_T
 		     so that beep can be tucked appropriately into a text-
 		     processing pipe.
 		  */
-    beep_parms_T *next;  /* in case -n/--new is used. */
 };
 
 
+/* All tones given on the command line, one more per -n/--new.  The
+ * array grows by doubling, so that even generated command lines with
+ * tens of thousands of tones need only a few malloc(3) calls.
+ */
+typedef struct {
+    size_t        count;
+    size_t        capacity;
+    beep_parms_T *parms;
+} beep_parms_array_T;
+
+
+/* Append a tone with the default parameters */
+static
+beep_parms_T *new_parms(beep_parms_array_T *array)
+{
+    if (array->count == array->capacity) {
+        const size_t capacity = array->capacity ? (2 * array->capacity) : 16;
+        beep_parms_T *const parms =
+            realloc(array->parms, capacity * sizeof(beep_parms_T));
+        if (NULL == parms) {
+            perror("malloc");
+            exit(EXIT_FAILURE);
+        }
+        array->parms    = parms;
+        array->capacity = capacity;
+    }
+    beep_parms_T *const parms = &array->parms[array->count++];
+    parms->freq       = 0;
+    parms->flags      = 0;
+    parms->length     = DEFAULT_LENGTH;
+    parms->reps       = DEFAULT_REPS;
+    parms->delay      = DEFAULT_DELAY;
+    parms->end_delay  = DEFAULT_END_DELAY;
+    parms->stdin_beep = DEFAULT_STDIN_BEEP;
+    return parms;
+}
+
+
 /* Global. Set to true by the signal handlers, read only by the main
  * thread. */
 static volatile sig_atomic_t global_abort = false;
@@ -155,20 +205,53 @@ void usage_bail(void)
 }
 
 
+/* Whether the parse_*_value() result end is the end of the command
+ * line argument but for white space, so that e.g. "-f 0x1F4" is an
+ * error instead of a 0 Hz tone.
+ */
+static
+bool is_end_of_arg(const char *end)
+{
+    if (!end) {
+        return false;
+    }
+    while ((*end == ' ') || ((*end >= '\t') && (*end <= '\r'))) {
+        ++end;
+    }
+    return (*end == '\0');
+}
+
+
+#ifdef BEEP_STATIC_DRIVER
+/* Without the fan-out driver, there can only be one device */
+#define MAX_DEVICES 1
+#else
+#define MAX_DEVICES BEEP_FANOUT_MAX_DEVICES
+#endif
+
+
 /* Global. Written by parse_command_line(), read by main() initialization. */
-static char *param_device_name = NULL;
+static char *param_device_names[MAX_DEVICES];
+static int param_device_args[MAX_DEVICES]; /* argv index of each name */
+static size_t param_device_count = 0;
+static char *param_timeline_name = NULL;
+static char *param_score_name = NULL;
+static char *param_export_name = NULL;
+static char *param_sequence_source = NULL;
+static char *param_rtttl_name = NULL;
+static unsigned int param_bpm = BEEP_DEFAULT_BPM;
 
 
 /* Parse the command line.  argv should be untampered, as passed to main.
- * Beep parameters returned in result, subsequent parameters in argv will over-
+ * Beep parameters appended to array, subsequent parameters in argv will over-
  * ride previous ones.
  *
  * Currently valid parameters:
- *  "-f <frequency in Hz>"
- *  "-l <tone length in ms>"
+ *  "-f <frequency in Hz or note name>"
+ *  "-l <tone length in ms or beats>"
  *  "-r <repetitions>"
- *  "-d <delay in ms>"
- *  "-D <delay in ms>" (similar to -d, but delay after last repetition as well)
+ *  "-d <delay in ms or beats>"
+ *  "-D <delay in ms or beats>" (similar to -d, but delay after last repetition as well)
  *  "-s" (beep after each line of input from stdin, echo line to stdout)
  *  "-c" (beep after each char of input from stdin, echo char to stdout)
  *  "--verbose/--debug"
@@ -180,8 +263,10 @@ static char *param_device_name = NULL;
  * for correctness on platforms with unsigned chars.
  */
 static
-void parse_command_line(const int argc, char *const argv[], beep_parms_T *result)
+void parse_command_line(const int argc, char *const argv[],
+                        beep_parms_array_T *array)
 {
+    beep_parms_T *result = new_parms(array);
     int ch;
 
     static const
@@ -192,64 +277,58 @@ void parse_command_line(const int argc, char *const argv[], beep_parms_T *result
           {"verbose", no_argument,       NULL, 'X'},
           {"debug",   no_argument,       NULL, 'X'},
           {"device",  required_argument, NULL, 'e'},
+          {"timeline", required_argument, NULL, 'T'},
+          {"score",   required_argument, NULL, 'S'},
+          {"export-score", required_argument, NULL, 'E'},
+          {"bpm",     required_argument, NULL, 'B'},
+          {"sequence", required_argument, NULL, 'Q'},
+          {"rtttl",   required_argument, NULL, 'R'},
           {NULL,      0,                 NULL,  0 }
         };
 
     while ((ch = getopt_long(argc, argv, "f:l:r:d:D:schvVne:", opt_list, NULL))
            != EOF) {
         /* handle parsed numbers for various arguments */
-        int          argval_i = -1;
         unsigned int argval_u = ~0U;
-        float        argval_f = -1.0f;
 
         switch (ch) {
         case 'f':  /* freq */
-            if (sscanf(optarg, "%f", &argval_f) != 1) {
+        {
+            unsigned int note;
+            const bool is_note = is_end_of_arg(parse_note_value(optarg, &note));
+            if ((!is_note)
+                && (!is_end_of_arg(parse_rounded_value(optarg, 20000U,
+                                                       &argval_u)))) {
                 usage_bail();
             }
-            if ((0.0f > argval_f) || (argval_f > 20000.0f)) {
-                usage_bail();
-            }
-            argval_i = (int) (argval_f + 0.5f);
-            argval_u = (unsigned int) argval_i;
             if (result->freq != 0) {
                 log_warning("multiple -f values given, only last one is used.");
             }
-            result->freq = argval_u;
+            result->freq  = is_note ? beep_note_freq_hz(note) : argval_u;
+            result->flags = is_note ? (BEEP_TONE_NOTE | note) : 0;
             break;
+        }
         case 'l' : /* length */
-            if (sscanf(optarg, "%u", &argval_u) != 1) {
-                usage_bail();
-            }
-            if (argval_u > 300000U) {
+            if (!is_end_of_arg(parse_duration_value(optarg, 300000U, &argval_u))) {
                 usage_bail();
             }
             result->length = argval_u;
             break;
         case 'r' : /* repetitions */
-            if (sscanf(optarg, "%u", &argval_u) != 1) {
-                usage_bail();
-            }
-            if (argval_u > 300000U) {
+            if (!is_end_of_arg(parse_uint_value(optarg, 300000U, &argval_u))) {
                 usage_bail();
             }
             result->reps = argval_u;
             break;
         case 'd' : /* delay between reps - WITHOUT delay after last beep*/
-            if (sscanf(optarg, "%u", &argval_u) != 1) {
-                usage_bail();
-            }
-            if (argval_u > 300000U) {
+            if (!is_end_of_arg(parse_duration_value(optarg, 300000U, &argval_u))) {
                 usage_bail();
             }
             result->delay = argval_u;
             result->end_delay = END_DELAY_NO;
             break;
         case 'D' : /* delay between reps - WITH delay after last beep */
-            if (sscanf(optarg, "%u", &argval_u) != 1) {
-                usage_bail();
-            }
-            if (argval_u > 300000U) {
+            if (!is_end_of_arg(parse_duration_value(optarg, 300000U, &argval_u))) {
                 usage_bail();
             }
             result->delay = argval_u;
@@ -270,15 +349,7 @@ void parse_command_line(const int argc, char *const argv[], beep_parms_T *result
             if (result->freq == 0) {
                 result->freq = DEFAULT_FREQ;
             }
-            result->next = (beep_parms_T *)malloc(sizeof(beep_parms_T));
-            result->next->freq       = 0;
-            result->next->length     = DEFAULT_LENGTH;
-            result->next->reps       = DEFAULT_REPS;
-            result->next->delay      = DEFAULT_DELAY;
-            result->next->end_delay  = DEFAULT_END_DELAY;
-            result->next->stdin_beep = DEFAULT_STDIN_BEEP;
-            result->next->next       = NULL;
-            result = result->next; /* yes, I meant to do that. */
+            result = new_parms(array);
             break;
         case 'X' : /* --debug / --verbose */
             if (log_level < 999) {
@@ -287,11 +358,38 @@ void parse_command_line(const int argc, char *const argv[], beep_parms_T *result
             }
             break;
         case 'e' : /* also --device */
-            if (param_device_name) {
-                log_error("You cannot give the --device parameter more than once.");
+            if (param_device_count == MAX_DEVICES) {
+                log_error("You cannot give the --device parameter more than %d times.",
+                          MAX_DEVICES);
                 exit(EXIT_FAILURE);
             }
-            param_device_name = optarg;
+            /* getopt has moved optind past the argument with optarg */
+            param_device_args[param_device_count] = optind - 1;
+            param_device_names[param_device_count++] = optarg;
+            break;
+        case 'T' : /* --timeline */
+            param_timeline_name = optarg;
+            break;
+        case 'S' : /* --score */
+            param_score_name = optarg;
+            break;
+        case 'E' : /* --export-score */
+            param_export_name = optarg;
+            break;
+        case 'Q' : /* --sequence */
+            param_sequence_source = optarg;
+            break;
+        case 'R' : /* --rtttl */
+            param_rtttl_name = optarg;
+            break;
+        case 'B' : /* --bpm */
+            if ((!is_end_of_arg(parse_uint_value(optarg, BEEP_MAX_BPM, &argval_u)))
+                || (argval_u < BEEP_MIN_BPM)) {
+                log_error("--bpm must be between %u and %u",
+                          BEEP_MIN_BPM, BEEP_MAX_BPM);
+                usage_bail();
+            }
+            param_bpm = argval_u;
             break;
         case 'h': /* also --help */
             print_usage();
@@ -312,41 +410,279 @@ void parse_command_line(const int argc, char *const argv[], beep_parms_T *result
 }
 
 
+/* Tones are compiled from the beep parms into batches of this size,
+ * which are then played with a single beep_drivers_play_sequence().
+ */
+#define TONE_BATCH_SIZE 256
+
+
+typedef struct {
+    size_t    count;
+    beep_tone tones[TONE_BATCH_SIZE];
+} tone_batch_T;
+
+
+/* With --export-score, and when compiling a command line into the
+ * sequence cache, the tones are written here instead of played.
+ */
+static beep_score_writer *export_writer = NULL;
+
+
 static
-int sleep_ms(beep_driver *driver, unsigned int milliseconds)
+void flush_tones(beep_driver *driver, tone_batch_T *batch)
 {
-    const time_t seconds = milliseconds / 1000U;
-    const long   nanoseconds = (milliseconds % 1000UL) * 1000UL * 1000UL;
-    const struct timespec request =
-        { seconds,
-          nanoseconds };
-    const int retcode = nanosleep(&request, NULL);
-    if (global_abort) {
-        beep_drivers_end_tone(driver);
-        beep_drivers_fini(driver);
-        exit(EXIT_FAILURE);
+    if (batch->count > 0) {
+        if (export_writer) {
+            beep_score_write(export_writer, batch->tones, batch->count);
+        } else {
+            beep_drivers_play_sequence(driver, batch->tones, batch->count,
+                                       &global_abort);
+        }
+        batch->count = 0;
     }
-    return retcode;
 }
 
 
+/* The tempo of the lengths and delays given in beats, for all tones
+ * in the order they are queued.
+ */
+static beep_tempo tone_tempo;
+
+
+/* Append the tones for parms to batch, playing every full batch */
 static
-void play_beep(beep_driver *driver, beep_parms_T parms)
+void queue_beep(beep_driver *driver, tone_batch_T *batch,
+                const beep_parms_T *parms)
 {
-    log_verbose("%d times %d ms beeps (%d ms delay between, "
+    log_verbose("%d times %d %s beeps (%d %s delay between, "
                 "%d ms delay after) @ %d Hz",
-                parms.reps, parms.length, parms.delay, parms.end_delay,
-                parms.freq);
+                parms->reps,
+                parms->length & ~BEEP_DURATION_TICKS,
+                (parms->length & BEEP_DURATION_TICKS) ? "tick" : "ms",
+                parms->delay & ~BEEP_DURATION_TICKS,
+                (parms->delay & BEEP_DURATION_TICKS) ? "tick" : "ms",
+                parms->end_delay, parms->freq);
 
     /* repeat the beep */
-    for (unsigned int i = 0; (!global_abort) && (i < parms.reps); i++) {
-        beep_drivers_begin_tone(driver, parms.freq & 0xffff);
-        sleep_ms(driver, parms.length);
-        beep_drivers_end_tone(driver);
-        if ((parms.end_delay == END_DELAY_YES) || ((i+1) < parms.reps)) {
-            sleep_ms(driver, parms.delay);
+    for (unsigned int i = 0; (!global_abort) && (i < parms->reps); i++) {
+        beep_tone *const tone = &batch->tones[batch->count];
+        tone->freq   = parms->freq & 0xffff;
+        tone->length = beep_tempo_ms(&tone_tempo, parms->length);
+        if ((parms->end_delay == END_DELAY_YES) || ((i+1) < parms->reps)) {
+            tone->delay = beep_tempo_ms(&tone_tempo, parms->delay);
+        } else {
+            tone->delay = 0;
+        }
+        tone->flags  = parms->flags;
+        if (++batch->count == TONE_BATCH_SIZE) {
+            flush_tones(driver, batch);
+        }
+    }
+}
+
+
+/* Whether any of the environment variables set by sudo(8) is set.
+ *
+ * Scans the environment once instead of once per variable.
+ */
+static
+bool running_under_sudo(void)
+{
+    extern char **environ;
+    static const char *const sudo_vars[] =
+        { "COMMAND=", "USER=", "UID=", "GID=", NULL };
+
+    for (char **env = environ; *env; ++env) {
+        if (0 != strncmp(*env, "SUDO_", 5)) {
+            continue;
+        }
+        for (const char *const *var = sudo_vars; *var; ++var) {
+            if (0 == strncmp((*env) + 5, *var, strlen(*var))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+/* The tones of --score, --sequence or --rtttl, which are played
+ * instead of those from the tone options.  At most one is set.
+ */
+typedef struct {
+    beep_score    *score;
+    beep_sequence *sequence;
+    beep_rtttl    *rtttl;
+} tone_source_T;
+
+
+/* Point *tones to the next tones of source.  Returns the number of
+ * tones, 0 at the end, or -1 after logging an error.
+ */
+static
+ssize_t tone_source_next(tone_source_T *source, const beep_tone **tones)
+{
+    if (source->score) {
+        return beep_score_next(source->score, tones);
+    } else if (source->sequence) {
+        return (ssize_t)beep_sequence_next(source->sequence, tones);
+    } else {
+        return beep_rtttl_next(source->rtttl, tones);
+    }
+}
+
+
+static
+void tone_source_close(tone_source_T *source)
+{
+    if (source->score) {
+        beep_score_close(source->score);
+    } else if (source->sequence) {
+        beep_sequence_free(source->sequence);
+    } else {
+        beep_rtttl_close(source->rtttl);
+    }
+}
+
+
+/* Play the tones of source while reading them */
+static
+bool play_source(beep_driver *driver, tone_source_T *source)
+{
+    while (!global_abort) {
+        const beep_tone *tones;
+        const ssize_t count = tone_source_next(source, &tones);
+        if (count <= 0) {
+            return (count == 0);
+        }
+        beep_drivers_play_sequence(driver, tones, (size_t)count,
+                                   &global_abort);
+    }
+    return true;
+}
+
+
+/* Write the tones from source, or from the tone options without a
+ * source, to a binary score file instead of playing them.
+ */
+static
+bool export_score(tone_source_T *source, const beep_parms_array_T *parms_array)
+{
+    for (size_t i=0; (!source) && (i<parms_array->count); ++i) {
+        if (parms_array->parms[i].stdin_beep != STDIN_BEEP_NONE) {
+            log_error("--export-score cannot record the -s and -c options");
+            return false;
+        }
+    }
+
+    export_writer = beep_score_create(param_export_name);
+    if (!export_writer) {
+        log_error("Could not open %s for writing: %s",
+                  param_export_name, strerror(errno));
+        return false;
+    }
+
+    bool source_ok = true;
+    if (source) {
+        const beep_tone *tones;
+        ssize_t count;
+        while (0 < (count = tone_source_next(source, &tones))) {
+            beep_score_write(export_writer, tones, (size_t)count);
+        }
+        source_ok = (count == 0);
+        tone_source_close(source);
+    } else {
+        static tone_batch_T batch;
+        batch.count = 0;
+        for (size_t i=0; i<parms_array->count; ++i) {
+            queue_beep(NULL, &batch, &parms_array->parms[i]);
+        }
+        flush_tones(NULL, &batch);
+    }
+
+    if (!beep_score_finish(export_writer)) {
+        log_error("Could not write %s: %s",
+                  param_export_name, strerror(errno));
+        return false;
+    }
+    return source_ok;
+}
+
+
+/* Whether the command line has nothing but tone, --device and
+ * --verbose options, so that the sequence cache can replay it without
+ * parsing it.
+ */
+static
+bool cacheable_command_line(const beep_parms_array_T *parms_array)
+{
+    if (param_timeline_name || param_score_name || param_export_name
+        || param_sequence_source || param_rtttl_name) {
+        return false;
+    }
+    for (size_t i=0; i<parms_array->count; ++i) {
+        if (parms_array->parms[i].stdin_beep != STDIN_BEEP_NONE) {
+            return false;
         }
     }
+    return true;
+}
+
+
+/* Compile the tones into the sequence cache, and return the cache
+ * entry to be played.
+ */
+static
+beep_score *cache_sequence(const int argc, char *const argv[],
+                           const beep_parms_array_T *parms_array)
+{
+    beep_sequence_settings settings;
+    settings.log_level    = log_level;
+    settings.device_count = param_device_count;
+    for (size_t i=0; i<param_device_count; ++i) {
+        const int arg = param_device_args[i];
+        settings.device_arg[i]    = (uint32_t)arg;
+        settings.device_offset[i] =
+            (uint32_t)(param_device_names[i] - argv[arg]);
+    }
+
+    export_writer = beep_sequence_cache_create(argc, argv, &settings);
+    if (!export_writer) {
+        return NULL;
+    }
+    static tone_batch_T batch;
+    batch.count = 0;
+    for (size_t i=0; i<parms_array->count; ++i) {
+        queue_beep(NULL, &batch, &parms_array->parms[i]);
+    }
+    flush_tones(NULL, &batch);
+
+    const bool stored = beep_sequence_cache_commit(export_writer);
+    export_writer = NULL;
+    return stored ? beep_sequence_cache_open(argc, argv, &settings) : NULL;
+}
+
+
+/* Use the sequence cache entry for this command line, if there is one */
+static
+beep_score *cached_sequence(const int argc, char *const argv[])
+{
+    beep_sequence_settings settings;
+    beep_score *const score = beep_sequence_cache_open(argc, argv, &settings);
+    if (!score) {
+        return NULL;
+    }
+    if (settings.device_count > MAX_DEVICES) {
+        beep_score_close(score);
+        return NULL;
+    }
+    log_level = settings.log_level;
+    param_device_count = settings.device_count;
+    for (size_t i=0; i<settings.device_count; ++i) {
+        param_device_names[i] =
+            argv[settings.device_arg[i]] + settings.device_offset[i];
+    }
+    return score;
 }
 
 
@@ -374,8 +710,12 @@ int main(const int argc, char *const argv[])
      *   * Checking the device file with realpath leaks information.
      *
      * So we refuse running setuid or setgid.
+     *
+     * The kernel sets AT_SECURE whenever the effective IDs differ from
+     * the real IDs of the process calling execve(2), which saves the
+     * four get*id(2) system calls on every start.
      */
-    if ((getuid() != geteuid()) || (getgid() != getegid())) {
+    if (getauxval(AT_SECURE)) {
         log_error("Running setuid or setgid, "
                   "which is not supported for security reasons.");
         log_error("Set up permissions for the pcspkr evdev device file instead.");
@@ -386,61 +726,157 @@ int main(const int argc, char *const argv[])
      *
      * For the reasoning, see the setuid comment above.
      */
-    if (getenv("SUDO_COMMAND") || getenv("SUDO_USER") || getenv("SUDO_UID") || getenv("SUDO_GID")) {
+    if (running_under_sudo()) {
         log_error("Running under sudo, "
                   "which is not supported for security reasons.");
         log_error("Set up permissions for the pcspkr evdev device file instead.");
         exit(EXIT_FAILURE);
     }
 
-    /* Parse command line */
-    beep_parms_T *parms = (beep_parms_T *)malloc(sizeof(beep_parms_T));
-    if (NULL == parms) {
-        perror("malloc");
-        exit(EXIT_FAILURE);
+    /* Parse command line, unless its tones are in the sequence cache */
+    beep_parms_array_T parms_array = { 0, 0, NULL };
+    beep_score *score = NULL;
+    if (argc >= BEEP_SEQUENCE_CACHE_MIN_ARGS) {
+        score = cached_sequence(argc, argv);
     }
-    parms->freq       = 0;
-    parms->length     = DEFAULT_LENGTH;
-    parms->reps       = DEFAULT_REPS;
-    parms->delay      = DEFAULT_DELAY;
-    parms->end_delay  = DEFAULT_END_DELAY;
-    parms->stdin_beep = DEFAULT_STDIN_BEEP;
-    parms->next       = NULL;
-
-    parse_command_line(argc, argv, parms);
+    if (!score) {
+        parse_command_line(argc, argv, &parms_array);
+    }
+    beep_tempo_init(&tone_tempo, param_bpm);
 
     /* Register drivers.  If we do that after parse_command_line, we may
      * have set the logging verbosity.  If we do that before
      * parse_command_line, parse_command_line might use some driver
      * functions.  Not sure yet which option we prefer.
      */
+#ifdef BEEP_STATIC_DRIVER
+    beep_drivers_register(&BEEP_STATIC_DRIVER);
+#else
     /* beep_drivers_register(&noop_driver); */
     beep_drivers_register(&console_driver);
     beep_drivers_register(&evdev_driver);
+    beep_drivers_register(&trace_driver);
+    beep_drivers_register(&pcm_driver);
+    beep_drivers_register(&pwm_driver);
+#endif
+
+    if (param_timeline_name && !beep_timeline_open(param_timeline_name)) {
+        log_error("Could not open %s for writing: %s",
+                  param_timeline_name, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
 
-    beep_driver *driver = NULL;
+    if ((!!param_score_name + !!param_sequence_source + !!param_rtttl_name) > 1) {
+        log_error("Only one of --score, --sequence and --rtttl can be given");
+        exit(EXIT_FAILURE);
+    }
 
-    if (param_device_name) {
-        driver = beep_drivers_detect(param_device_name);
-        if (!driver) {
-            const int saved_errno = errno;
-            log_error("Could not open %s for writing: %s",
-                      param_device_name, strerror(saved_errno));
+    /* The tone options on the command line only give the default
+     * length and delay of the score tones.
+     */
+    if (param_score_name) {
+        score = beep_score_open(param_score_name,
+                                parms_array.parms[0].length,
+                                parms_array.parms[0].delay);
+        if (!score) {
+            log_error("Could not open %s for reading: %s",
+                      param_score_name, strerror(errno));
             exit(EXIT_FAILURE);
         }
+        beep_score_set_bpm(score, param_bpm);
+    }
+
+    /* Just like for a score, the tone options only give the default
+     * length and delay of the sequence tones.
+     */
+    beep_sequence *sequence = NULL;
+    if (param_sequence_source) {
+        sequence = beep_sequence_compile(param_sequence_source,
+                                         parms_array.parms[0].length,
+                                         parms_array.parms[0].delay,
+                                         param_bpm);
+        if (!sequence) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /* RTTTL ringtones have their own defaults and tempo */
+    beep_rtttl *rtttl = NULL;
+    if (param_rtttl_name) {
+        rtttl = beep_rtttl_open(param_rtttl_name);
+        if (!rtttl) {
+            log_error("Could not open %s for reading: %s",
+                      param_rtttl_name, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if ((!score) && (argc >= BEEP_SEQUENCE_CACHE_MIN_ARGS)
+        && cacheable_command_line(&parms_array)) {
+        score = cache_sequence(argc, argv, &parms_array);
+    }
+
+    tone_source_T source = { score, sequence, rtttl };
+    const bool have_source = (score || sequence || rtttl);
+
+    if (param_export_name) {
+        const bool export_ok = export_score(have_source ? &source : NULL,
+                                            &parms_array);
+        free(parms_array.parms);
+        beep_timeline_close();
+        return export_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    beep_driver *driver = NULL;
+
+    BEEP_PROBE1(detect_enter, param_device_count);
+    TIMELINE_BEGIN(detect_ns);
+    if (param_device_count > 0) {
+        beep_driver *devices[MAX_DEVICES];
+        for (size_t i=0; i<param_device_count; ++i) {
+            devices[i] = beep_drivers_detect(param_device_names[i]);
+            if (!devices[i]) {
+                const int saved_errno = errno;
+                log_error("Could not open %s for writing: %s",
+                          param_device_names[i], strerror(saved_errno));
+                while (i > 0) {
+                    beep_drivers_fini(devices[--i]);
+                }
+                exit(EXIT_FAILURE);
+            }
+        }
+        if (param_device_count == 1) {
+            driver = devices[0];
+        } else {
+#ifndef BEEP_STATIC_DRIVER
+            driver = fanout_driver_new(devices, param_device_count);
+#endif
+            if (!driver) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+            }
+        }
     } else {
-        driver = beep_drivers_detect(NULL);
+        driver = beep_device_cache_detect();
         if (!driver) {
-            log_error("Could not open any device");
-            /* Output the only beep we can, in an effort to fall back on usefulness */
-            fallback_beep();
-            exit(EXIT_FAILURE);
+            driver = beep_drivers_detect(NULL);
+            if (!driver) {
+                log_error("Could not open any device");
+                /* Output the only beep we can, in an effort to fall back on usefulness */
+                fallback_beep();
+                exit(EXIT_FAILURE);
+            }
+            beep_device_cache_store(driver);
         }
     }
 
+    TIMELINE_END(detect_ns, "find_device", "setup", "syscalls", syscall_count);
+    BEEP_PROBE2(detect_exit, driver->name, syscall_count);
+
     log_verbose("beep: using driver %p (name=%s, fd=%d, dev=%s)",
                 (void *)driver, driver->name,
                 driver->device_fd, driver->device_name);
+    log_verbose("beep: %u system calls to find the device", syscall_count);
 
     /* At this time, we know what API to use on which device, and we do
      * not have to fall back onto printing '\a' any more.
@@ -463,11 +899,20 @@ int main(const int argc, char *const argv[])
     signal(SIGINT,  handle_signal);
     signal(SIGTERM, handle_signal);
 
-    /* this outermost while loop handles the possibility that -n/--new
+    bool source_ok = true;
+    if (have_source) {
+        source_ok = play_source(driver, &source);
+        tone_source_close(&source);
+        parms_array.count = 0;
+    }
+
+    /* this outermost loop handles the possibility that -n/--new
        has been used, i.e. that we have multiple beeps specified. Each
-       iteration will play, then free() one parms instance. */
-    while ((!global_abort) && parms) {
-        beep_parms_T *next = parms->next;
+       iteration will queue one parms instance. */
+    static tone_batch_T batch;
+    batch.count = 0;
+    for (size_t i=0; (!global_abort) && (i<parms_array.count); ++i) {
+        const beep_parms_T *const parms = &parms_array.parms[i];
 
         if (parms->stdin_beep != STDIN_BEEP_NONE) {
             /* In this case, beep is probably part of a pipe, in which
@@ -482,32 +927,46 @@ int main(const int argc, char *const argv[])
             setvbuf(stdin, NULL, _IONBF, 0);
             setvbuf(stdout, NULL, _IONBF, 0);
 
+            /* Play what has been queued before waiting for input */
+            flush_tones(driver, &batch);
+
             char sin[4096];
-            while ((!global_abort) && (fgets(sin, 4096, stdin))) {
+            while (!global_abort) {
+                TIMELINE_BEGIN(read_ns);
+                const bool have_input = (NULL != fgets(sin, 4096, stdin));
+                TIMELINE_END(read_ns, "stdin_read", "stdin", "bytes",
+                             have_input ? (unsigned int)strlen(sin) : 0U);
+                if (!have_input) {
+                    break;
+                }
                 if (parms->stdin_beep == STDIN_BEEP_CHAR) {
                     for (char *ptr=sin; (!global_abort) && (*ptr); ptr++) {
                         putchar(*ptr);
                         fflush(stdout);
-                        play_beep(driver, *parms);
+                        BEEP_PROBE1(stdin_trigger, 1);
+                        queue_beep(driver, &batch, parms);
+                        flush_tones(driver, &batch);
                     }
                 } else { /* STDIN_BEEP_LINE */
                     fputs(sin, stdout);
-                    play_beep(driver, *parms);
+                    BEEP_PROBE1(stdin_trigger, strlen(sin));
+                    queue_beep(driver, &batch, parms);
+                    flush_tones(driver, &batch);
                 }
             }
         } else {
-            play_beep(driver, *parms);
+            queue_beep(driver, &batch, parms);
         }
-
-        /* Junk each parms struct after playing it */
-        free(parms);
-        parms = next;
     }
+    flush_tones(driver, &batch);
+    free(parms_array.parms);
 
     beep_drivers_end_tone(driver);
     beep_drivers_fini(driver);
 
-    if (global_abort) {
+    beep_timeline_close();
+
+    if (global_abort || (!source_ok)) {
         return EXIT_FAILURE;
     } else {
         return EXIT_SUCCESS;
@@ -0,0 +1,11899 @@
+	.file	"beep-main.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-main.c"
+	.globl	handle_signal
+	.type	handle_signal, @function
+handle_signal:
+.LVL0:
+.LFB68:
+	.file 1 "beep-main.c"
+	.loc 1 182 1 view -0
+	.cfi_startproc
+	.loc 1 182 1 is_stmt 0 view .LVU1
+	endbr64
+	.loc 1 183 5 is_stmt 1 view .LVU2
+	.loc 1 183 18 is_stmt 0 view .LVU3
+	movl	$1, global_abort(%rip)
+	.loc 1 184 1 view .LVU4
+	ret
+	.cfi_endproc
+.LFE68:
+	.size	handle_signal, .-handle_signal
+	.type	is_end_of_arg, @function
+is_end_of_arg:
+.LVL1:
+.LFB71:
+	.loc 1 214 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 215 5 view .LVU6
+	.loc 1 215 8 is_stmt 0 view .LVU7
+	testq	%rdi, %rdi
+	je	.L7
+	.loc 1 218 26 is_stmt 1 view .LVU8
+	.loc 1 218 13 is_stmt 0 view .LVU9
+	movzbl	(%rdi), %eax
+	.loc 1 218 26 view .LVU10
+	leal	-9(%rax), %edx
+	cmpb	$4, %dl
+	jbe	.L8
+	cmpb	$32, %al
+	jne	.L4
+.L8:
+	.loc 1 219 9 is_stmt 1 view .LVU11
+	addq	$1, %rdi
+.LVL2:
+	.loc 1 218 26 view .LVU12
+	.loc 1 218 13 is_stmt 0 view .LVU13
+	movzbl	(%rdi), %eax
+	.loc 1 218 26 view .LVU14
+	leal	-9(%rax), %edx
+	cmpb	$4, %dl
+	jbe	.L8
+	cmpb	$32, %al
+	je	.L8
+.L4:
+	.loc 1 221 5 is_stmt 1 view .LVU15
+	.loc 1 221 18 is_stmt 0 view .LVU16
+	testb	%al, %al
+	sete	%al
+	ret
+.L7:
+	.loc 1 216 15 view .LVU17
+	movl	$0, %eax
+	.loc 1 222 1 view .LVU18
+	ret
+	.cfi_endproc
+.LFE71:
+	.size	is_end_of_arg, .-is_end_of_arg
+	.type	usage_bail, @function
+usage_bail:
+.LFB70:
+	.loc 1 202 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	popq	%rax
+	.cfi_def_cfa_offset 8
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 203 5 view .LVU20
+.LBB17:
+.LBI17:
+	.loc 1 189 6 view .LVU21
+.LBB18:
+	.loc 1 191 5 view .LVU22
+	movq	stdout(%rip), %rsi
+	leaq	beep_usage(%rip), %rdi
+	call	fputs@PLT
+.LVL3:
+.LBE18:
+.LBE17:
+	.loc 1 204 5 view .LVU23
+	movl	$1, %edi
+	call	exit@PLT
+.LVL4:
+	.cfi_endproc
+.LFE70:
+	.size	usage_bail, .-usage_bail
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"malloc"
+	.text
+	.type	new_parms, @function
+new_parms:
+.LVL5:
+.LFB67:
+	.loc 1 133 1 view -0
+	.cfi_startproc
+	.loc 1 133 1 is_stmt 0 view .LVU25
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 134 5 is_stmt 1 view .LVU26
+	.loc 1 134 30 is_stmt 0 view .LVU27
+	movq	8(%rdi), %rax
+	.loc 1 134 8 view .LVU28
+	cmpq	%rax, (%rdi)
+	je	.L17
+.LVL6:
+.L12:
+	.loc 1 145 5 is_stmt 1 view .LVU29
+	.loc 1 145 52 is_stmt 0 view .LVU30
+	movq	(%rbx), %rdx
+	.loc 1 145 59 view .LVU31
+	leaq	1(%rdx), %rax
+	movq	%rax, (%rbx)
+	.loc 1 145 46 view .LVU32
+	leaq	0(,%rdx,8), %rax
+	subq	%rdx, %rax
+	salq	$2, %rax
+	.loc 1 145 25 view .LVU33
+	addq	16(%rbx), %rax
+.LVL7:
+	.loc 1 146 5 is_stmt 1 view .LVU34
+	.loc 1 146 17 is_stmt 0 view .LVU35
+	movl	$0, (%rax)
+	.loc 1 147 5 is_stmt 1 view .LVU36
+	.loc 1 147 18 is_stmt 0 view .LVU37
+	movl	$0, 4(%rax)
+	.loc 1 148 5 is_stmt 1 view .LVU38
+	.loc 1 148 19 is_stmt 0 view .LVU39
+	movl	$200, 8(%rax)
+	.loc 1 149 5 is_stmt 1 view .LVU40
+	.loc 1 149 17 is_stmt 0 view .LVU41
+	movl	$1, 12(%rax)
+	.loc 1 150 5 is_stmt 1 view .LVU42
+	.loc 1 150 18 is_stmt 0 view .LVU43
+	movl	$100, 16(%rax)
+	.loc 1 151 5 is_stmt 1 view .LVU44
+	.loc 1 151 22 is_stmt 0 view .LVU45
+	movl	$0, 20(%rax)
+	.loc 1 152 5 is_stmt 1 view .LVU46
+	.loc 1 152 23 is_stmt 0 view .LVU47
+	movl	$0, 24(%rax)
+	.loc 1 153 5 is_stmt 1 view .LVU48
+	.loc 1 154 1 is_stmt 0 view .LVU49
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL8:
+	.loc 1 154 1 view .LVU50
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL9:
+.L17:
+	.cfi_restore_state
+.LBB19:
+	.loc 1 135 9 is_stmt 1 view .LVU51
+	.loc 1 135 73 is_stmt 0 view .LVU52
+	leaq	(%rax,%rax), %rbp
+	testq	%rax, %rax
+	movl	$16, %eax
+	cmove	%rax, %rbp
+.LVL10:
+	.loc 1 136 9 is_stmt 1 view .LVU53
+	.loc 1 137 13 is_stmt 0 view .LVU54
+	leaq	0(,%rbp,8), %rsi
+	subq	%rbp, %rsi
+	salq	$2, %rsi
+	movq	16(%rdi), %rdi
+	call	realloc@PLT
+.LVL11:
+	.loc 1 138 9 is_stmt 1 view .LVU55
+	.loc 1 138 12 is_stmt 0 view .LVU56
+	testq	%rax, %rax
+	je	.L18
+	.loc 1 142 9 is_stmt 1 view .LVU57
+	.loc 1 142 22 is_stmt 0 view .LVU58
+	movq	%rax, 16(%rbx)
+	.loc 1 143 9 is_stmt 1 view .LVU59
+	.loc 1 143 25 is_stmt 0 view .LVU60
+	movq	%rbp, 8(%rbx)
+	jmp	.L12
+.L18:
+	.loc 1 139 13 is_stmt 1 view .LVU61
+	leaq	.LC0(%rip), %rdi
+	call	perror@PLT
+.LVL12:
+	.loc 1 140 13 view .LVU62
+	movl	$1, %edi
+	call	exit@PLT
+.LVL13:
+.LBE19:
+	.cfi_endproc
+.LFE67:
+	.size	new_parms, .-new_parms
+	.type	tone_source_next, @function
+tone_source_next:
+.LVL14:
+.LFB76:
+	.loc 1 524 1 view -0
+	.cfi_startproc
+	.loc 1 524 1 is_stmt 0 view .LVU64
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 525 5 is_stmt 1 view .LVU65
+	.loc 1 525 15 is_stmt 0 view .LVU66
+	movq	(%rdi), %rax
+	.loc 1 525 8 view .LVU67
+	testq	%rax, %rax
+	jne	.L24
+	.loc 1 527 12 is_stmt 1 view .LVU68
+	.loc 1 527 22 is_stmt 0 view .LVU69
+	movq	8(%rdi), %rax
+	.loc 1 527 15 view .LVU70
+	testq	%rax, %rax
+	je	.L22
+	.loc 1 528 9 is_stmt 1 view .LVU71
+	.loc 1 528 25 is_stmt 0 view .LVU72
+	movq	%rax, %rdi
+.LVL15:
+	.loc 1 528 25 view .LVU73
+	call	beep_sequence_next@PLT
+.LVL16:
+.L19:
+	.loc 1 532 1 view .LVU74
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+.L24:
+	.cfi_restore_state
+	.loc 1 526 9 is_stmt 1 view .LVU75
+	.loc 1 526 16 is_stmt 0 view .LVU76
+	movq	%rax, %rdi
+.LVL18:
+	.loc 1 526 16 view .LVU77
+	call	beep_score_next@PLT
+.LVL19:
+	.loc 1 526 16 view .LVU78
+	jmp	.L19
+.LVL20:
+.L22:
+	.loc 1 530 9 is_stmt 1 view .LVU79
+	.loc 1 530 16 is_stmt 0 view .LVU80
+	movq	16(%rdi), %rdi
+.LVL21:
+	.loc 1 530 16 view .LVU81
+	call	beep_rtttl_next@PLT
+.LVL22:
+	.loc 1 530 16 view .LVU82
+	jmp	.L19
+	.cfi_endproc
+.LFE76:
+	.size	tone_source_next, .-tone_source_next
+	.type	flush_tones, @function
+flush_tones:
+.LVL23:
+.LFB73:
+	.loc 1 433 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 434 5 view .LVU84
+	.loc 1 434 14 is_stmt 0 view .LVU85
+	movq	(%rsi), %rdx
+	.loc 1 434 8 view .LVU86
+	testq	%rdx, %rdx
+	je	.L30
+	.loc 1 433 1 view .LVU87
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rsi, %rbx
+	.loc 1 435 9 is_stmt 1 view .LVU88
+	.loc 1 435 13 is_stmt 0 view .LVU89
+	movq	export_writer(%rip), %rax
+	.loc 1 435 12 view .LVU90
+	testq	%rax, %rax
+	je	.L27
+	.loc 1 436 13 is_stmt 1 view .LVU91
+	.loc 1 436 50 is_stmt 0 view .LVU92
+	leaq	8(%rsi), %rsi
+.LVL24:
+	.loc 1 436 13 view .LVU93
+	movq	%rax, %rdi
+.LVL25:
+	.loc 1 436 13 view .LVU94
+	call	beep_score_write@PLT
+.LVL26:
+.L28:
+	.loc 1 441 9 is_stmt 1 view .LVU95
+	.loc 1 441 22 is_stmt 0 view .LVU96
+	movq	$0, (%rbx)
+	.loc 1 443 1 view .LVU97
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL27:
+	.loc 1 443 1 view .LVU98
+	ret
+.LVL28:
+.L27:
+	.cfi_restore_state
+	.loc 1 438 13 is_stmt 1 view .LVU99
+	.loc 1 438 53 is_stmt 0 view .LVU100
+	leaq	8(%rsi), %rsi
+	.loc 1 438 13 view .LVU101
+	leaq	global_abort(%rip), %rcx
+	call	beep_drivers_play_sequence@PLT
+.LVL29:
+	.loc 1 438 13 view .LVU102
+	jmp	.L28
+.LVL30:
+.L30:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.loc 1 438 13 view .LVU103
+	ret
+	.cfi_endproc
+.LFE73:
+	.size	flush_tones, .-flush_tones
+	.type	tone_source_close, @function
+tone_source_close:
+.LVL31:
+.LFB77:
+	.loc 1 537 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 537 1 is_stmt 0 view .LVU105
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 538 5 is_stmt 1 view .LVU106
+	.loc 1 538 15 is_stmt 0 view .LVU107
+	movq	(%rdi), %rax
+	.loc 1 538 8 view .LVU108
+	testq	%rax, %rax
+	je	.L34
+	.loc 1 539 9 is_stmt 1 view .LVU109
+	movq	%rax, %rdi
+.LVL32:
+	.loc 1 539 9 is_stmt 0 view .LVU110
+	call	beep_score_close@PLT
+.LVL33:
+.L33:
+	.loc 1 545 1 view .LVU111
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL34:
+.L34:
+	.cfi_restore_state
+	.loc 1 540 12 is_stmt 1 view .LVU112
+	.loc 1 540 22 is_stmt 0 view .LVU113
+	movq	8(%rdi), %rax
+	.loc 1 540 15 view .LVU114
+	testq	%rax, %rax
+	je	.L36
+	.loc 1 541 9 is_stmt 1 view .LVU115
+	movq	%rax, %rdi
+.LVL35:
+	.loc 1 541 9 is_stmt 0 view .LVU116
+	call	beep_sequence_free@PLT
+.LVL36:
+	jmp	.L33
+.LVL37:
+.L36:
+	.loc 1 543 9 is_stmt 1 view .LVU117
+	movq	16(%rdi), %rdi
+.LVL38:
+	.loc 1 543 9 is_stmt 0 view .LVU118
+	call	beep_rtttl_close@PLT
+.LVL39:
+	.loc 1 545 1 view .LVU119
+	jmp	.L33
+	.cfi_endproc
+.LFE77:
+	.size	tone_source_close, .-tone_source_close
+	.section	.rodata.str1.1
+.LC1:
+	.string	"tick"
+.LC2:
+	.string	"ms"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"%d times %d %s beeps (%d %s delay between, %d ms delay after) @ %d Hz"
+	.text
+	.type	queue_beep, @function
+queue_beep:
+.LVL40:
+.LFB74:
+	.loc 1 456 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 456 1 is_stmt 0 view .LVU121
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r15
+	movq	%rsi, %r12
+	movq	%rdx, %rbp
+	.loc 1 457 5 is_stmt 1 view .LVU122
+	.loc 1 457 10 view .LVU123
+	.loc 1 457 13 is_stmt 0 view .LVU124
+	cmpl	$0, log_level(%rip)
+	jle	.L39
+	.loc 1 457 46 is_stmt 1 discriminator 1 view .LVU125
+	.loc 1 457 322 is_stmt 0 discriminator 1 view .LVU126
+	movl	(%rdx), %edi
+.LVL41:
+	.loc 1 457 304 discriminator 1 view .LVU127
+	movl	20(%rdx), %eax
+	.loc 1 457 259 discriminator 1 view .LVU128
+	movl	16(%rdx), %r8d
+	.loc 1 457 46 discriminator 1 view .LVU129
+	testl	%r8d, %r8d
+	leaq	.LC2(%rip), %r9
+	leaq	.LC1(%rip), %rdx
+.LVL42:
+	.loc 1 457 46 discriminator 1 view .LVU130
+	cmovs	%rdx, %r9
+	.loc 1 457 183 discriminator 1 view .LVU131
+	movl	8(%rbp), %edx
+	.loc 1 457 46 discriminator 1 view .LVU132
+	testl	%edx, %edx
+	leaq	.LC2(%rip), %rcx
+	leaq	.LC1(%rip), %rsi
+.LVL43:
+	.loc 1 457 46 discriminator 1 view .LVU133
+	cmovs	%rsi, %rcx
+	andl	$2147483647, %edx
+	movl	12(%rbp), %esi
+	pushq	%rdi
+	.cfi_def_cfa_offset 72
+	pushq	%rax
+	.cfi_def_cfa_offset 80
+	andl	$2147483647, %r8d
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL44:
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 64
+.L39:
+.LVL45:
+.LBB20:
+	.loc 1 467 46 is_stmt 1 discriminator 1 view .LVU134
+	.loc 1 467 31 is_stmt 0 discriminator 1 view .LVU135
+	movl	global_abort(%rip), %eax
+	.loc 1 467 46 discriminator 1 view .LVU136
+	movl	$0, %r13d
+.LBB21:
+	.loc 1 470 24 discriminator 1 view .LVU137
+	leaq	tone_tempo(%rip), %r14
+.LBE21:
+	.loc 1 467 46 discriminator 1 view .LVU138
+	testl	%eax, %eax
+	je	.L42
+.LVL46:
+.L38:
+	.loc 1 467 46 discriminator 1 view .LVU139
+.LBE20:
+	.loc 1 481 1 view .LVU140
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL47:
+	.loc 1 481 1 view .LVU141
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL48:
+	.loc 1 481 1 view .LVU142
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 481 1 view .LVU143
+	ret
+.LVL50:
+.L44:
+	.cfi_restore_state
+.LBB24:
+.LBB22:
+	.loc 1 472 13 is_stmt 1 view .LVU144
+	.loc 1 472 27 is_stmt 0 view .LVU145
+	movl	16(%rbp), %esi
+	movq	%r14, %rdi
+	call	beep_tempo_ms@PLT
+.LVL51:
+.L45:
+	.loc 1 472 25 view .LVU146
+	movl	%eax, 16(%rbx)
+	.loc 1 476 9 is_stmt 1 view .LVU147
+	.loc 1 476 28 is_stmt 0 view .LVU148
+	movl	4(%rbp), %eax
+	.loc 1 476 21 view .LVU149
+	movl	%eax, 20(%rbx)
+	.loc 1 477 9 is_stmt 1 view .LVU150
+	.loc 1 477 13 is_stmt 0 view .LVU151
+	movq	(%r12), %rax
+	addq	$1, %rax
+	.loc 1 477 12 view .LVU152
+	movq	%rax, (%r12)
+	cmpq	$256, %rax
+	je	.L54
+.L46:
+.LBE22:
+	.loc 1 467 69 is_stmt 1 discriminator 2 view .LVU153
+	addl	$1, %r13d
+.LVL52:
+	.loc 1 467 46 discriminator 2 view .LVU154
+	.loc 1 467 31 is_stmt 0 discriminator 2 view .LVU155
+	movl	global_abort(%rip), %eax
+	.loc 1 467 46 discriminator 2 view .LVU156
+	testl	%eax, %eax
+	jne	.L38
+.LVL53:
+.L42:
+	.loc 1 467 46 discriminator 3 view .LVU157
+	cmpl	12(%rbp), %r13d
+	jnb	.L38
+.LBB23:
+	.loc 1 468 9 is_stmt 1 view .LVU158
+.LVL54:
+	.loc 1 469 9 view .LVU159
+	movq	(%r12), %rbx
+	salq	$4, %rbx
+	addq	%r12, %rbx
+	.loc 1 469 34 is_stmt 0 view .LVU160
+	movzwl	0(%rbp), %eax
+	.loc 1 469 20 view .LVU161
+	movl	%eax, 8(%rbx)
+.LVL55:
+	.loc 1 470 9 is_stmt 1 view .LVU162
+	.loc 1 470 24 is_stmt 0 view .LVU163
+	movl	8(%rbp), %esi
+	movq	%r14, %rdi
+	call	beep_tempo_ms@PLT
+.LVL56:
+	.loc 1 470 22 view .LVU164
+	movl	%eax, 12(%rbx)
+	.loc 1 471 9 is_stmt 1 view .LVU165
+	.loc 1 471 12 is_stmt 0 view .LVU166
+	cmpl	$1, 20(%rbp)
+	je	.L44
+	.loc 1 471 49 discriminator 1 view .LVU167
+	leal	1(%r13), %edx
+	movl	$0, %eax
+	cmpl	12(%rbp), %edx
+	jnb	.L45
+	jmp	.L44
+.L54:
+	.loc 1 478 13 is_stmt 1 view .LVU168
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	flush_tones
+.LVL57:
+	jmp	.L46
+.LBE23:
+.LBE24:
+	.cfi_endproc
+.LFE74:
+	.size	queue_beep, .-queue_beep
+	.section	.rodata.str1.1
+.LC4:
+	.string	"COMMAND="
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"Running setuid or setgid, which is not supported for security reasons."
+	.align 8
+.LC6:
+	.string	"Set up permissions for the pcspkr evdev device file instead."
+	.section	.rodata.str1.1
+.LC7:
+	.string	"SUDO_"
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"You cannot give the --device parameter more than %d times."
+	.align 8
+.LC9:
+	.string	"--bpm must be between %u and %u"
+	.section	.rodata.str1.1
+.LC10:
+	.string	"f:l:r:d:D:schvVne:"
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"non-option arguments left on command line"
+	.align 8
+.LC12:
+	.string	"Could not open %s for writing: %s"
+	.align 8
+.LC13:
+	.string	"Only one of --score, --sequence and --rtttl can be given"
+	.align 8
+.LC14:
+	.string	"Could not open %s for reading: %s"
+	.align 8
+.LC15:
+	.string	"--export-score cannot record the -s and -c options"
+	.section	.rodata.str1.1
+.LC16:
+	.string	"Could not write %s: %s"
+.LC17:
+	.string	"Could not open any device"
+.LC18:
+	.string	"syscalls"
+.LC19:
+	.string	"setup"
+.LC20:
+	.string	"find_device"
+	.section	.rodata.str1.8
+	.align 8
+.LC21:
+	.string	"beep: using driver %p (name=%s, fd=%d, dev=%s)"
+	.align 8
+.LC22:
+	.string	"beep: %u system calls to find the device"
+	.section	.rodata.str1.1
+.LC23:
+	.string	"bytes"
+.LC24:
+	.string	"stdin"
+.LC25:
+	.string	"stdin_read"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"multiple -f values given, only last one is used."
+	.align 8
+.LC27:
+	.string	"Running under sudo, which is not supported for security reasons."
+	.text
+	.globl	main
+	.type	main, @function
+main:
+.LVL58:
+.LFB84:
+	.loc 1 701 1 view -0
+	.cfi_startproc
+	.loc 1 701 1 is_stmt 0 view .LVU170
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4152
+	orq	$0, (%rsp)
+	subq	$280, %rsp
+	.cfi_def_cfa_offset 4432
+	movl	%edi, %r14d
+	movq	%rsi, %r13
+	.loc 1 701 1 view .LVU171
+	movq	%fs:40, %rax
+	movq	%rax, 4360(%rsp)
+	xorl	%eax, %eax
+	.loc 1 702 5 is_stmt 1 view .LVU172
+	call	log_init@PLT
+.LVL59:
+	.loc 1 718 5 view .LVU173
+	.loc 1 718 9 is_stmt 0 view .LVU174
+	movl	$23, %edi
+	call	getauxval@PLT
+.LVL60:
+	movq	%rax, 8(%rsp)
+	.loc 1 718 8 view .LVU175
+	testq	%rax, %rax
+	jne	.L193
+	.loc 1 729 5 is_stmt 1 view .LVU176
+.LBB70:
+.LBI70:
+	.loc 1 489 5 view .LVU177
+.LBB71:
+	.loc 1 491 5 view .LVU178
+	.loc 1 492 5 view .LVU179
+	.loc 1 495 5 view .LVU180
+.LBB72:
+	.loc 1 495 10 view .LVU181
+	.loc 1 495 17 is_stmt 0 view .LVU182
+	movq	environ(%rip), %r15
+.LVL61:
+	.loc 1 495 32 is_stmt 1 view .LVU183
+	movq	(%r15), %r12
+	testq	%r12, %r12
+	jne	.L61
+.L57:
+.LVL62:
+	.loc 1 495 32 is_stmt 0 view .LVU184
+.LBE72:
+.LBE71:
+.LBE70:
+	.loc 1 737 5 is_stmt 1 view .LVU185
+	.loc 1 737 24 is_stmt 0 view .LVU186
+	movq	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	.loc 1 738 5 is_stmt 1 view .LVU187
+.LVL63:
+	.loc 1 739 5 view .LVU188
+	.loc 1 739 8 is_stmt 0 view .LVU189
+	cmpl	$63, %r14d
+	jle	.L62
+	.loc 1 740 9 is_stmt 1 view .LVU190
+.LVL64:
+.LBB76:
+.LBI76:
+	.loc 1 668 13 view .LVU191
+.LBB77:
+	.loc 1 670 5 view .LVU192
+	.loc 1 671 5 view .LVU193
+	.loc 1 671 31 is_stmt 0 view .LVU194
+	leaq	112(%rsp), %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	beep_sequence_cache_open@PLT
+.LVL65:
+	movq	%rax, %rbx
+.LVL66:
+	.loc 1 672 5 is_stmt 1 view .LVU195
+	.loc 1 672 8 is_stmt 0 view .LVU196
+	testq	%rax, %rax
+	je	.L62
+	.loc 1 675 5 is_stmt 1 view .LVU197
+	.loc 1 675 17 is_stmt 0 view .LVU198
+	movq	120(%rsp), %rcx
+	.loc 1 675 8 view .LVU199
+	cmpq	$16, %rcx
+	ja	.L194
+	.loc 1 679 5 is_stmt 1 view .LVU200
+	.loc 1 679 15 is_stmt 0 view .LVU201
+	movl	112(%rsp), %eax
+.LVL67:
+	.loc 1 679 15 view .LVU202
+	movl	%eax, log_level(%rip)
+	.loc 1 680 5 is_stmt 1 view .LVU203
+	.loc 1 680 24 is_stmt 0 view .LVU204
+	movq	%rcx, param_device_count(%rip)
+	.loc 1 681 5 is_stmt 1 view .LVU205
+.LBB78:
+	.loc 1 681 10 view .LVU206
+.LVL68:
+	.loc 1 681 23 view .LVU207
+	testq	%rcx, %rcx
+	je	.L67
+	leaq	param_device_names(%rip), %rax
+	leaq	192(%rsp), %rdx
+	leaq	(%rax,%rcx,8), %rdi
+.LVL69:
+.L66:
+	.loc 1 682 9 view .LVU208
+	.loc 1 683 37 is_stmt 0 view .LVU209
+	movl	-64(%rdx), %esi
+	.loc 1 683 66 view .LVU210
+	movl	(%rdx), %ecx
+	.loc 1 683 42 view .LVU211
+	addq	0(%r13,%rsi,8), %rcx
+	.loc 1 682 31 view .LVU212
+	movq	%rcx, (%rax)
+	.loc 1 681 47 is_stmt 1 view .LVU213
+	.loc 1 681 23 view .LVU214
+	addq	$8, %rax
+	addq	$4, %rdx
+	cmpq	%rdi, %rax
+	jne	.L66
+.LVL70:
+.L67:
+	.loc 1 681 23 is_stmt 0 view .LVU215
+.LBE78:
+.LBE77:
+.LBE76:
+	.loc 1 745 5 is_stmt 1 view .LVU216
+	movl	param_bpm(%rip), %esi
+	leaq	tone_tempo(%rip), %rdi
+	call	beep_tempo_init@PLT
+.LVL71:
+	.loc 1 756 5 view .LVU217
+	leaq	console_driver(%rip), %rdi
+	call	beep_drivers_register@PLT
+.LVL72:
+	.loc 1 757 5 view .LVU218
+	leaq	evdev_driver(%rip), %rdi
+	call	beep_drivers_register@PLT
+.LVL73:
+	.loc 1 758 5 view .LVU219
+	leaq	trace_driver(%rip), %rdi
+	call	beep_drivers_register@PLT
+.LVL74:
+	.loc 1 759 5 view .LVU220
+	leaq	pcm_driver(%rip), %rdi
+	call	beep_drivers_register@PLT
+.LVL75:
+	.loc 1 760 5 view .LVU221
+	leaq	pwm_driver(%rip), %rdi
+	call	beep_drivers_register@PLT
+.LVL76:
+	.loc 1 763 5 view .LVU222
+	.loc 1 763 9 is_stmt 0 view .LVU223
+	movq	param_timeline_name(%rip), %rdi
+	.loc 1 763 8 view .LVU224
+	testq	%rdi, %rdi
+	je	.L103
+	.loc 1 763 33 discriminator 1 view .LVU225
+	call	beep_timeline_open@PLT
+.LVL77:
+	.loc 1 763 29 discriminator 1 view .LVU226
+	testb	%al, %al
+	je	.L195
+.L103:
+	.loc 1 769 5 is_stmt 1 view .LVU227
+	.loc 1 769 10 is_stmt 0 view .LVU228
+	movq	param_score_name(%rip), %rdi
+	.loc 1 769 31 view .LVU229
+	cmpq	$0, param_sequence_source(%rip)
+	setne	%al
+	movzbl	%al, %eax
+	.loc 1 769 29 view .LVU230
+	cmpq	$1, %rdi
+	sbbl	$-1, %eax
+	.loc 1 769 55 view .LVU231
+	cmpq	$1, param_rtttl_name(%rip)
+	sbbl	$-1, %eax
+	.loc 1 769 8 view .LVU232
+	cmpl	$1, %eax
+	jg	.L196
+	.loc 1 777 5 is_stmt 1 view .LVU233
+	.loc 1 777 8 is_stmt 0 view .LVU234
+	testq	%rdi, %rdi
+	je	.L105
+	.loc 1 778 9 is_stmt 1 view .LVU235
+	.loc 1 780 44 is_stmt 0 view .LVU236
+	movq	64(%rsp), %rax
+	.loc 1 778 17 view .LVU237
+	movl	16(%rax), %edx
+	movl	8(%rax), %esi
+	call	beep_score_open@PLT
+.LVL78:
+	movq	%rax, %rbx
+.LVL79:
+	.loc 1 781 9 is_stmt 1 view .LVU238
+	.loc 1 781 12 is_stmt 0 view .LVU239
+	testq	%rax, %rax
+	je	.L197
+	.loc 1 786 9 is_stmt 1 view .LVU240
+	movl	param_bpm(%rip), %esi
+	movq	%rax, %rdi
+	call	beep_score_set_bpm@PLT
+.LVL80:
+.L105:
+	.loc 1 792 5 view .LVU241
+	.loc 1 793 5 view .LVU242
+	.loc 1 793 9 is_stmt 0 view .LVU243
+	movq	param_sequence_source(%rip), %rbp
+	.loc 1 793 8 view .LVU244
+	testq	%rbp, %rbp
+	je	.L107
+	.loc 1 794 9 is_stmt 1 view .LVU245
+	.loc 1 796 53 is_stmt 0 view .LVU246
+	movq	64(%rsp), %rax
+	.loc 1 794 20 view .LVU247
+	movl	16(%rax), %edx
+	movl	8(%rax), %esi
+	movl	param_bpm(%rip), %ecx
+	movq	%rbp, %rdi
+	call	beep_sequence_compile@PLT
+.LVL81:
+	movq	%rax, %rbp
+.LVL82:
+	.loc 1 798 9 is_stmt 1 view .LVU248
+	.loc 1 798 12 is_stmt 0 view .LVU249
+	testq	%rax, %rax
+	je	.L198
+.LVL83:
+.L107:
+	.loc 1 804 5 is_stmt 1 view .LVU250
+	.loc 1 805 5 view .LVU251
+	.loc 1 805 9 is_stmt 0 view .LVU252
+	movq	param_rtttl_name(%rip), %r12
+	.loc 1 805 8 view .LVU253
+	testq	%r12, %r12
+	je	.L108
+	.loc 1 806 9 is_stmt 1 view .LVU254
+	.loc 1 806 17 is_stmt 0 view .LVU255
+	movq	%r12, %rdi
+	call	beep_rtttl_open@PLT
+.LVL84:
+	movq	%rax, %r12
+.LVL85:
+	.loc 1 807 9 is_stmt 1 view .LVU256
+	.loc 1 807 12 is_stmt 0 view .LVU257
+	testq	%rax, %rax
+	je	.L199
+.LVL86:
+.L108:
+	.loc 1 814 5 is_stmt 1 view .LVU258
+	.loc 1 814 8 is_stmt 0 view .LVU259
+	testq	%rbx, %rbx
+	jne	.L109
+	cmpl	$63, %r14d
+	jg	.L200
+.LVL87:
+.L109:
+	.loc 1 819 5 is_stmt 1 view .LVU260
+	.loc 1 819 19 is_stmt 0 view .LVU261
+	movq	%rbx, 80(%rsp)
+	movq	%rbp, 88(%rsp)
+	movq	%r12, 96(%rsp)
+	.loc 1 820 5 is_stmt 1 view .LVU262
+	orq	%r12, %rbp
+.LVL88:
+	.loc 1 820 5 is_stmt 0 view .LVU263
+	orq	%rbx, %rbp
+.LVL89:
+	.loc 1 822 5 is_stmt 1 view .LVU264
+	.loc 1 822 9 is_stmt 0 view .LVU265
+	movq	param_export_name(%rip), %rdi
+	.loc 1 822 8 view .LVU266
+	testq	%rdi, %rdi
+	je	.L117
+.LBB80:
+	.loc 1 823 9 is_stmt 1 view .LVU267
+	.loc 1 823 31 is_stmt 0 view .LVU268
+	testq	%rbp, %rbp
+	jne	.L118
+.LBB81:
+.LBB82:
+.LBB83:
+	.loc 1 571 49 view .LVU269
+	movq	48(%rsp), %rcx
+	movq	64(%rsp), %rax
+	addq	$24, %rax
+	.loc 1 571 17 view .LVU270
+	movq	8(%rsp), %rdx
+.L119:
+.LVL90:
+	.loc 1 571 32 view .LVU271
+	cmpq	%rdx, %rcx
+	je	.L201
+	.loc 1 572 9 is_stmt 1 view .LVU272
+	.loc 1 572 12 is_stmt 0 view .LVU273
+	addq	$28, %rax
+	cmpl	$0, -28(%rax)
+	jne	.L202
+	.loc 1 571 59 is_stmt 1 view .LVU274
+	addq	$1, %rdx
+.LVL91:
+	.loc 1 571 32 view .LVU275
+	jmp	.L119
+.LVL92:
+.L193:
+	.loc 1 571 32 is_stmt 0 view .LVU276
+.LBE83:
+.LBE82:
+.LBE81:
+.LBE80:
+	.loc 1 719 9 is_stmt 1 view .LVU277
+	leaq	.LC5(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL93:
+	.loc 1 721 9 view .LVU278
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL94:
+	.loc 1 722 9 view .LVU279
+	movl	$1, %edi
+	call	exit@PLT
+.LVL95:
+.L58:
+.LBB97:
+.LBB75:
+.LBB74:
+	.loc 1 495 38 view .LVU280
+	addq	$8, %r15
+.LVL96:
+	.loc 1 495 32 view .LVU281
+	movq	(%r15), %r12
+	testq	%r12, %r12
+	je	.L57
+.L61:
+	.loc 1 496 9 view .LVU282
+	.loc 1 496 18 is_stmt 0 view .LVU283
+	movl	$5, %edx
+	leaq	.LC7(%rip), %rsi
+	movq	%r12, %rdi
+	call	strncmp@PLT
+.LVL97:
+	.loc 1 496 12 view .LVU284
+	testl	%eax, %eax
+	jne	.L58
+.LBB73:
+	.loc 1 499 33 view .LVU285
+	leaq	sudo_vars.3(%rip), %rbp
+	.loc 1 499 50 view .LVU286
+	leaq	.LC4(%rip), %rbx
+	.loc 1 500 37 view .LVU287
+	addq	$5, %r12
+.L60:
+.LVL98:
+	.loc 1 500 13 is_stmt 1 view .LVU288
+	.loc 1 500 22 is_stmt 0 view .LVU289
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL99:
+	movq	%rax, %rdx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	strncmp@PLT
+.LVL100:
+	.loc 1 500 16 view .LVU290
+	testl	%eax, %eax
+	je	.L59
+	.loc 1 499 56 is_stmt 1 view .LVU291
+	addq	$8, %rbp
+.LVL101:
+	.loc 1 499 50 view .LVU292
+	movq	0(%rbp), %rbx
+	testq	%rbx, %rbx
+	jne	.L60
+	jmp	.L58
+.LVL102:
+.L194:
+	.loc 1 499 50 is_stmt 0 view .LVU293
+.LBE73:
+.LBE74:
+.LBE75:
+.LBE97:
+.LBB98:
+.LBB79:
+	.loc 1 676 9 is_stmt 1 view .LVU294
+	movq	%rax, %rdi
+	call	beep_score_close@PLT
+.LVL103:
+	.loc 1 677 9 view .LVU295
+.L62:
+	.loc 1 677 9 is_stmt 0 view .LVU296
+.LBE79:
+.LBE98:
+	.loc 1 743 9 is_stmt 1 view .LVU297
+.LBB99:
+.LBI99:
+	.loc 1 266 6 view .LVU298
+.LBB100:
+	.loc 1 269 5 view .LVU299
+	.loc 1 269 28 is_stmt 0 view .LVU300
+	leaq	48(%rsp), %rdi
+.LVL104:
+	.loc 1 269 28 view .LVU301
+	call	new_parms
+.LVL105:
+	.loc 1 269 28 view .LVU302
+	movq	%rax, %r15
+.LVL106:
+	.loc 1 270 5 is_stmt 1 view .LVU303
+	.loc 1 272 5 view .LVU304
+	.loc 1 289 5 view .LVU305
+	.loc 1 289 18 is_stmt 0 view .LVU306
+	leaq	opt_list.2(%rip), %r12
+	leaq	.LC10(%rip), %rbp
+.LBB101:
+	.loc 1 294 9 view .LVU307
+	leaq	.L71(%rip), %rbx
+.LVL107:
+.L68:
+	.loc 1 294 9 view .LVU308
+.LBE101:
+	.loc 1 290 12 is_stmt 1 view .LVU309
+	.loc 1 289 18 is_stmt 0 view .LVU310
+	movl	$0, %r8d
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	getopt_long@PLT
+.LVL108:
+	.loc 1 290 12 view .LVU311
+	cmpl	$-1, %eax
+	je	.L203
+.LBB106:
+	.loc 1 292 9 is_stmt 1 view .LVU312
+	.loc 1 292 22 is_stmt 0 view .LVU313
+	movl	$-1, 40(%rsp)
+	.loc 1 294 9 is_stmt 1 view .LVU314
+	subl	$66, %eax
+.LVL109:
+	.loc 1 294 9 is_stmt 0 view .LVU315
+	cmpl	$52, %eax
+	ja	.L69
+	movl	%eax, %eax
+	.loc 1 294 9 view .LVU316
+	movslq	(%rbx,%rax,4), %rax
+.LVL110:
+	.loc 1 294 9 view .LVU317
+	addq	%rbx, %rax
+	notrack jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L71:
+	.long	.L88-.L71
+	.long	.L69-.L71
+	.long	.L87-.L71
+	.long	.L86-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L85-.L71
+	.long	.L84-.L71
+	.long	.L83-.L71
+	.long	.L82-.L71
+	.long	.L69-.L71
+	.long	.L70-.L71
+	.long	.L69-.L71
+	.long	.L81-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L80-.L71
+	.long	.L79-.L71
+	.long	.L78-.L71
+	.long	.L77-.L71
+	.long	.L69-.L71
+	.long	.L76-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L75-.L71
+	.long	.L69-.L71
+	.long	.L74-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L73-.L71
+	.long	.L72-.L71
+	.long	.L69-.L71
+	.long	.L69-.L71
+	.long	.L70-.L71
+	.text
+.L77:
+.LBB102:
+	.loc 1 297 13 is_stmt 1 view .LVU318
+	.loc 1 298 13 view .LVU319
+	.loc 1 298 33 is_stmt 0 view .LVU320
+	leaq	80(%rsp), %rsi
+	movq	optarg(%rip), %rdi
+	call	parse_note_value@PLT
+.LVL111:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL112:
+	.loc 1 299 13 is_stmt 1 view .LVU321
+	.loc 1 299 16 is_stmt 0 view .LVU322
+	testb	%al, %al
+	je	.L204
+	.loc 1 304 13 is_stmt 1 view .LVU323
+	.loc 1 304 16 is_stmt 0 view .LVU324
+	cmpl	$0, (%r15)
+	je	.L162
+	.loc 1 305 17 is_stmt 1 view .LVU325
+	leaq	.LC26(%rip), %rdi
+	movl	$0, %eax
+.LVL113:
+	.loc 1 305 17 is_stmt 0 view .LVU326
+	call	log_warning@PLT
+.LVL114:
+	.loc 1 307 13 is_stmt 1 view .LVU327
+.L162:
+	.loc 1 307 38 is_stmt 0 view .LVU328
+	movl	80(%rsp), %edi
+	call	beep_note_freq_hz@PLT
+.LVL115:
+	.loc 1 307 26 view .LVU329
+	movl	%eax, (%r15)
+	.loc 1 308 13 is_stmt 1 view .LVU330
+	.loc 1 308 55 is_stmt 0 view .LVU331
+	movl	80(%rsp), %eax
+	orb	$1, %ah
+	jmp	.L91
+.LVL116:
+.L204:
+	.loc 1 300 22 view .LVU332
+	leaq	40(%rsp), %rdx
+	movl	$20000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_rounded_value@PLT
+.LVL117:
+	.loc 1 300 22 view .LVU333
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL118:
+	.loc 1 300 17 view .LVU334
+	testb	%al, %al
+	je	.L205
+	.loc 1 304 13 is_stmt 1 view .LVU335
+	.loc 1 304 16 is_stmt 0 view .LVU336
+	cmpl	$0, (%r15)
+	jne	.L206
+.L164:
+	.loc 1 307 62 view .LVU337
+	movl	40(%rsp), %eax
+	.loc 1 307 26 view .LVU338
+	movl	%eax, (%r15)
+	.loc 1 308 13 is_stmt 1 view .LVU339
+	.loc 1 308 55 is_stmt 0 view .LVU340
+	movl	$0, %eax
+.L91:
+	.loc 1 308 27 view .LVU341
+	movl	%eax, 4(%r15)
+	.loc 1 309 13 is_stmt 1 view .LVU342
+	jmp	.L68
+.L205:
+	.loc 1 302 17 view .LVU343
+	call	usage_bail
+.LVL119:
+.L75:
+	.loc 1 302 17 is_stmt 0 view .LVU344
+.LBE102:
+	.loc 1 312 13 is_stmt 1 view .LVU345
+	.loc 1 312 18 is_stmt 0 view .LVU346
+	leaq	40(%rsp), %rdx
+	movl	$300000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_duration_value@PLT
+.LVL120:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL121:
+	.loc 1 312 16 view .LVU347
+	testb	%al, %al
+	je	.L207
+	.loc 1 315 13 is_stmt 1 view .LVU348
+	.loc 1 315 28 is_stmt 0 view .LVU349
+	movl	40(%rsp), %eax
+	movl	%eax, 8(%r15)
+	.loc 1 316 13 is_stmt 1 view .LVU350
+	jmp	.L68
+.L207:
+	.loc 1 313 17 view .LVU351
+	call	usage_bail
+.LVL122:
+.L73:
+	.loc 1 318 13 view .LVU352
+	.loc 1 318 18 is_stmt 0 view .LVU353
+	leaq	40(%rsp), %rdx
+	movl	$300000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_uint_value@PLT
+.LVL123:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL124:
+	.loc 1 318 16 view .LVU354
+	testb	%al, %al
+	je	.L208
+	.loc 1 321 13 is_stmt 1 view .LVU355
+	.loc 1 321 26 is_stmt 0 view .LVU356
+	movl	40(%rsp), %eax
+	movl	%eax, 12(%r15)
+	.loc 1 322 13 is_stmt 1 view .LVU357
+	jmp	.L68
+.L208:
+	.loc 1 319 17 view .LVU358
+	call	usage_bail
+.LVL125:
+.L79:
+	.loc 1 324 13 view .LVU359
+	.loc 1 324 18 is_stmt 0 view .LVU360
+	leaq	40(%rsp), %rdx
+	movl	$300000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_duration_value@PLT
+.LVL126:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL127:
+	.loc 1 324 16 view .LVU361
+	testb	%al, %al
+	je	.L209
+	.loc 1 327 13 is_stmt 1 view .LVU362
+	.loc 1 327 27 is_stmt 0 view .LVU363
+	movl	40(%rsp), %eax
+	movl	%eax, 16(%r15)
+	.loc 1 328 13 is_stmt 1 view .LVU364
+	.loc 1 328 31 is_stmt 0 view .LVU365
+	movl	$0, 20(%r15)
+	.loc 1 329 13 is_stmt 1 view .LVU366
+	jmp	.L68
+.L209:
+	.loc 1 325 17 view .LVU367
+	call	usage_bail
+.LVL128:
+.L87:
+	.loc 1 331 13 view .LVU368
+	.loc 1 331 18 is_stmt 0 view .LVU369
+	leaq	40(%rsp), %rdx
+	movl	$300000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_duration_value@PLT
+.LVL129:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL130:
+	.loc 1 331 16 view .LVU370
+	testb	%al, %al
+	je	.L210
+	.loc 1 334 13 is_stmt 1 view .LVU371
+	.loc 1 334 27 is_stmt 0 view .LVU372
+	movl	40(%rsp), %eax
+	movl	%eax, 16(%r15)
+	.loc 1 335 13 is_stmt 1 view .LVU373
+	.loc 1 335 31 is_stmt 0 view .LVU374
+	movl	$1, 20(%r15)
+	.loc 1 336 13 is_stmt 1 view .LVU375
+	jmp	.L68
+.L210:
+	.loc 1 332 17 view .LVU376
+	call	usage_bail
+.LVL131:
+.L72:
+	.loc 1 338 13 view .LVU377
+	.loc 1 338 32 is_stmt 0 view .LVU378
+	movl	$1, 24(%r15)
+	.loc 1 339 13 is_stmt 1 view .LVU379
+	jmp	.L68
+.L80:
+	.loc 1 341 13 view .LVU380
+	.loc 1 341 32 is_stmt 0 view .LVU381
+	movl	$2, 24(%r15)
+	.loc 1 342 13 is_stmt 1 view .LVU382
+	jmp	.L68
+.L70:
+	.loc 1 345 13 view .LVU383
+	movq	stdout(%rip), %rcx
+	movl	$188, %edx
+	movl	$1, %esi
+	leaq	version_message(%rip), %rdi
+	call	fwrite@PLT
+.LVL132:
+	.loc 1 346 13 view .LVU384
+	movl	$0, %edi
+	call	exit@PLT
+.LVL133:
+.L74:
+	.loc 1 349 13 view .LVU385
+	.loc 1 349 16 is_stmt 0 view .LVU386
+	cmpl	$0, (%r15)
+	jne	.L97
+	.loc 1 350 17 is_stmt 1 view .LVU387
+	.loc 1 350 30 is_stmt 0 view .LVU388
+	movl	$440, (%r15)
+.L97:
+	.loc 1 352 13 is_stmt 1 view .LVU389
+	.loc 1 352 22 is_stmt 0 view .LVU390
+	leaq	48(%rsp), %rdi
+.LVL134:
+	.loc 1 352 22 view .LVU391
+	call	new_parms
+.LVL135:
+	.loc 1 352 22 view .LVU392
+	movq	%rax, %r15
+.LVL136:
+	.loc 1 353 13 is_stmt 1 view .LVU393
+	jmp	.L68
+.LVL137:
+.L81:
+	.loc 1 355 13 view .LVU394
+	.loc 1 355 27 is_stmt 0 view .LVU395
+	movl	log_level(%rip), %eax
+	.loc 1 355 16 view .LVU396
+	cmpl	$998, %eax
+	jg	.L68
+	.loc 1 357 17 is_stmt 1 view .LVU397
+	.loc 1 357 26 is_stmt 0 view .LVU398
+	addl	$1, %eax
+	movl	%eax, log_level(%rip)
+	jmp	.L68
+.L78:
+	.loc 1 361 13 is_stmt 1 view .LVU399
+	.loc 1 361 36 is_stmt 0 view .LVU400
+	movq	param_device_count(%rip), %rax
+	.loc 1 361 16 view .LVU401
+	cmpq	$16, %rax
+	je	.L211
+	.loc 1 367 13 is_stmt 1 view .LVU402
+	.loc 1 367 60 is_stmt 0 view .LVU403
+	movl	optind(%rip), %ecx
+	leal	-1(%rcx), %edx
+	.loc 1 367 51 view .LVU404
+	leaq	param_device_args(%rip), %rcx
+	movl	%edx, (%rcx,%rax,4)
+	.loc 1 368 13 is_stmt 1 view .LVU405
+	.loc 1 368 50 is_stmt 0 view .LVU406
+	leaq	1(%rax), %rdx
+	movq	%rdx, param_device_count(%rip)
+	.loc 1 368 54 view .LVU407
+	leaq	param_device_names(%rip), %rdx
+	movq	optarg(%rip), %rcx
+	movq	%rcx, (%rdx,%rax,8)
+	.loc 1 369 13 is_stmt 1 view .LVU408
+	jmp	.L68
+.L211:
+	.loc 1 362 17 view .LVU409
+	movl	$16, %esi
+	leaq	.LC8(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL138:
+	.loc 1 364 17 view .LVU410
+	movl	$1, %edi
+	call	exit@PLT
+.LVL139:
+.L82:
+	.loc 1 371 13 view .LVU411
+	.loc 1 371 33 is_stmt 0 view .LVU412
+	movq	optarg(%rip), %rax
+	movq	%rax, param_timeline_name(%rip)
+	.loc 1 372 13 is_stmt 1 view .LVU413
+	jmp	.L68
+.L83:
+	.loc 1 374 13 view .LVU414
+	.loc 1 374 30 is_stmt 0 view .LVU415
+	movq	optarg(%rip), %rax
+	movq	%rax, param_score_name(%rip)
+	.loc 1 375 13 is_stmt 1 view .LVU416
+	jmp	.L68
+.L86:
+	.loc 1 377 13 view .LVU417
+	.loc 1 377 31 is_stmt 0 view .LVU418
+	movq	optarg(%rip), %rax
+	movq	%rax, param_export_name(%rip)
+	.loc 1 378 13 is_stmt 1 view .LVU419
+	jmp	.L68
+.L85:
+	.loc 1 380 13 view .LVU420
+	.loc 1 380 35 is_stmt 0 view .LVU421
+	movq	optarg(%rip), %rax
+	movq	%rax, param_sequence_source(%rip)
+	.loc 1 381 13 is_stmt 1 view .LVU422
+	jmp	.L68
+.L84:
+	.loc 1 383 13 view .LVU423
+	.loc 1 383 30 is_stmt 0 view .LVU424
+	movq	optarg(%rip), %rax
+	movq	%rax, param_rtttl_name(%rip)
+	.loc 1 384 13 is_stmt 1 view .LVU425
+	jmp	.L68
+.L88:
+	.loc 1 386 13 view .LVU426
+	.loc 1 386 19 is_stmt 0 view .LVU427
+	leaq	40(%rsp), %rdx
+	movl	$1000, %esi
+	movq	optarg(%rip), %rdi
+	call	parse_uint_value@PLT
+.LVL140:
+	movq	%rax, %rdi
+	call	is_end_of_arg
+.LVL141:
+	.loc 1 386 16 view .LVU428
+	testb	%al, %al
+	je	.L99
+	.loc 1 387 30 view .LVU429
+	movl	40(%rsp), %eax
+	.loc 1 387 17 view .LVU430
+	cmpl	$19, %eax
+	jbe	.L99
+	.loc 1 392 13 is_stmt 1 view .LVU431
+	.loc 1 392 23 is_stmt 0 view .LVU432
+	movl	%eax, param_bpm(%rip)
+	.loc 1 393 13 is_stmt 1 view .LVU433
+	.loc 1 393 13 is_stmt 0 view .LVU434
+	jmp	.L68
+.L99:
+	.loc 1 388 17 is_stmt 1 view .LVU435
+	movl	$1000, %edx
+	movl	$20, %esi
+	leaq	.LC9(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL142:
+	.loc 1 390 17 view .LVU436
+	call	usage_bail
+.LVL143:
+.L76:
+	.loc 1 395 13 view .LVU437
+.LBB103:
+.LBI103:
+	.loc 1 189 6 view .LVU438
+.LBB104:
+	.loc 1 191 5 view .LVU439
+	movq	stdout(%rip), %rsi
+	leaq	beep_usage(%rip), %rdi
+	call	fputs@PLT
+.LVL144:
+.LBE104:
+.LBE103:
+	.loc 1 396 13 view .LVU440
+	movl	$0, %edi
+	call	exit@PLT
+.LVL145:
+.L69:
+	.loc 1 399 13 view .LVU441
+	call	usage_bail
+.LVL146:
+.L203:
+	.loc 1 399 13 is_stmt 0 view .LVU442
+.LBE106:
+	.loc 1 403 5 is_stmt 1 view .LVU443
+	.loc 1 403 8 is_stmt 0 view .LVU444
+	cmpl	optind(%rip), %r14d
+	jg	.L212
+	.loc 1 407 5 is_stmt 1 view .LVU445
+	movl	$0, %ebx
+	.loc 1 407 8 is_stmt 0 view .LVU446
+	cmpl	$0, (%r15)
+	jne	.L67
+	.loc 1 408 9 is_stmt 1 view .LVU447
+	.loc 1 408 22 is_stmt 0 view .LVU448
+	movl	$440, (%r15)
+	jmp	.L67
+.L212:
+	.loc 1 404 9 is_stmt 1 view .LVU449
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+.LVL147:
+	.loc 1 404 9 is_stmt 0 view .LVU450
+	call	log_error@PLT
+.LVL148:
+	.loc 1 405 9 is_stmt 1 view .LVU451
+	call	usage_bail
+.LVL149:
+.L195:
+	.loc 1 405 9 is_stmt 0 view .LVU452
+.LBE100:
+.LBE99:
+	.loc 1 764 9 is_stmt 1 view .LVU453
+	.loc 1 765 50 is_stmt 0 view .LVU454
+	call	__errno_location@PLT
+.LVL150:
+	.loc 1 764 9 view .LVU455
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL151:
+	movq	%rax, %rdx
+	movq	param_timeline_name(%rip), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL152:
+	.loc 1 766 9 is_stmt 1 view .LVU456
+	movl	$1, %edi
+	call	exit@PLT
+.LVL153:
+.L196:
+	.loc 1 770 9 view .LVU457
+	leaq	.LC13(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL154:
+	.loc 1 771 9 view .LVU458
+	movl	$1, %edi
+	call	exit@PLT
+.LVL155:
+.L197:
+	.loc 1 782 13 view .LVU459
+	.loc 1 783 51 is_stmt 0 view .LVU460
+	call	__errno_location@PLT
+.LVL156:
+	.loc 1 782 13 view .LVU461
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL157:
+	movq	%rax, %rdx
+	movq	param_score_name(%rip), %rsi
+	leaq	.LC14(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL158:
+	.loc 1 784 13 is_stmt 1 view .LVU462
+	movl	$1, %edi
+	call	exit@PLT
+.LVL159:
+.L198:
+	.loc 1 799 13 view .LVU463
+	movl	$1, %edi
+	call	exit@PLT
+.LVL160:
+.L199:
+	.loc 1 808 13 view .LVU464
+	.loc 1 809 51 is_stmt 0 view .LVU465
+	call	__errno_location@PLT
+.LVL161:
+	.loc 1 808 13 view .LVU466
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL162:
+	movq	%rax, %rdx
+	movq	param_rtttl_name(%rip), %rsi
+	leaq	.LC14(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL163:
+	.loc 1 810 13 is_stmt 1 view .LVU467
+	movl	$1, %edi
+	call	exit@PLT
+.LVL164:
+.L200:
+.LBB109:
+.LBI109:
+	.loc 1 617 5 view .LVU468
+.LBB110:
+	.loc 1 619 5 view .LVU469
+	.loc 1 619 9 is_stmt 0 view .LVU470
+	movq	param_timeline_name(%rip), %rbx
+.LVL165:
+	.loc 1 619 8 view .LVU471
+	testq	%rbx, %rbx
+	je	.L213
+	movl	$0, %ebx
+	jmp	.L109
+.L213:
+	.loc 1 619 29 view .LVU472
+	movq	param_score_name(%rip), %rax
+	testq	%rax, %rax
+	jne	.L109
+	.loc 1 619 49 view .LVU473
+	movq	param_export_name(%rip), %rbx
+	testq	%rbx, %rbx
+	je	.L214
+	movq	%rax, %rbx
+	jmp	.L109
+.L214:
+	.loc 1 620 9 view .LVU474
+	movq	param_sequence_source(%rip), %rax
+	testq	%rax, %rax
+	jne	.L109
+	.loc 1 620 34 view .LVU475
+	movq	param_rtttl_name(%rip), %rbx
+	testq	%rbx, %rbx
+	je	.L215
+	movq	%rax, %rbx
+	jmp	.L109
+.L215:
+.LBB111:
+	.loc 1 623 35 view .LVU476
+	movq	48(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 624 24 view .LVU477
+	movq	64(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	.loc 1 623 17 view .LVU478
+	movq	8(%rsp), %rax
+.L110:
+.LVL166:
+	.loc 1 623 23 is_stmt 1 view .LVU479
+	movq	16(%rsp), %rcx
+	cmpq	%rcx, %rax
+	je	.L216
+	.loc 1 624 9 view .LVU480
+	.loc 1 624 34 is_stmt 0 view .LVU481
+	imulq	$28, %rax, %rdx
+	.loc 1 624 12 view .LVU482
+	movq	24(%rsp), %rcx
+	cmpl	$0, 24(%rcx,%rdx)
+	jne	.L109
+	.loc 1 623 44 is_stmt 1 view .LVU483
+	addq	$1, %rax
+.LVL167:
+	.loc 1 623 44 is_stmt 0 view .LVU484
+	jmp	.L110
+.LVL168:
+.L113:
+	.loc 1 623 44 view .LVU485
+.LBE111:
+.LBE110:
+.LBE109:
+.LBB112:
+.LBB113:
+.LBB114:
+.LBB115:
+	.loc 1 643 9 is_stmt 1 view .LVU486
+	.loc 1 643 19 is_stmt 0 view .LVU487
+	movl	(%r8,%rax,4), %edx
+.LVL169:
+	.loc 1 644 9 is_stmt 1 view .LVU488
+	.loc 1 644 32 is_stmt 0 view .LVU489
+	movl	%edx, 128(%rsp,%rax,4)
+	.loc 1 645 9 is_stmt 1 view .LVU490
+	.loc 1 646 52 is_stmt 0 view .LVU491
+	movslq	%edx, %rdx
+.LVL170:
+	.loc 1 646 46 view .LVU492
+	movq	(%rdi,%rax,8), %rcx
+	subq	0(%r13,%rdx,8), %rcx
+	.loc 1 646 13 view .LVU493
+	movl	%ecx, 192(%rsp,%rax,4)
+.LBE115:
+	.loc 1 642 44 is_stmt 1 view .LVU494
+	addq	$1, %rax
+.LVL171:
+.L168:
+	.loc 1 642 23 view .LVU495
+	cmpq	%rax, %rsi
+	jne	.L113
+.LBE114:
+	.loc 1 649 5 view .LVU496
+	.loc 1 649 21 is_stmt 0 view .LVU497
+	leaq	112(%rsp), %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	beep_sequence_cache_create@PLT
+.LVL172:
+	.loc 1 649 19 view .LVU498
+	movq	%rax, export_writer(%rip)
+	.loc 1 650 5 is_stmt 1 view .LVU499
+	.loc 1 650 8 is_stmt 0 view .LVU500
+	testq	%rax, %rax
+	je	.L114
+	.loc 1 653 5 is_stmt 1 view .LVU501
+	.loc 1 654 5 view .LVU502
+	.loc 1 654 17 is_stmt 0 view .LVU503
+	movq	$0, batch.1(%rip)
+	.loc 1 655 5 is_stmt 1 view .LVU504
+.LBB117:
+	.loc 1 655 10 view .LVU505
+.LVL173:
+	.loc 1 655 17 is_stmt 0 view .LVU506
+	movq	8(%rsp), %r15
+	.loc 1 655 5 view .LVU507
+	jmp	.L115
+.LVL174:
+.L116:
+	.loc 1 656 9 is_stmt 1 view .LVU508
+	.loc 1 656 33 is_stmt 0 view .LVU509
+	imulq	$28, %r15, %rdx
+	movq	24(%rsp), %rax
+	addq	%rax, %rdx
+	.loc 1 656 9 view .LVU510
+	leaq	batch.1(%rip), %rsi
+	movl	$0, %edi
+	call	queue_beep
+.LVL175:
+	.loc 1 655 44 is_stmt 1 view .LVU511
+	addq	$1, %r15
+.LVL176:
+.L115:
+	.loc 1 655 23 view .LVU512
+	movq	16(%rsp), %rax
+	cmpq	%rax, %r15
+	jb	.L116
+.LBE117:
+	.loc 1 658 5 view .LVU513
+	leaq	batch.1(%rip), %rsi
+	movl	$0, %edi
+	call	flush_tones
+.LVL177:
+	.loc 1 660 5 view .LVU514
+	.loc 1 660 24 is_stmt 0 view .LVU515
+	movq	export_writer(%rip), %rdi
+	call	beep_sequence_cache_commit@PLT
+.LVL178:
+	movl	%eax, %edx
+.LVL179:
+	.loc 1 661 5 is_stmt 1 view .LVU516
+	.loc 1 661 19 is_stmt 0 view .LVU517
+	movq	$0, export_writer(%rip)
+	.loc 1 662 5 is_stmt 1 view .LVU518
+	.loc 1 662 69 is_stmt 0 view .LVU519
+	movq	%rbx, %rax
+.LVL180:
+	.loc 1 662 69 view .LVU520
+	testb	%dl, %dl
+	je	.L114
+	.loc 1 662 21 view .LVU521
+	leaq	112(%rsp), %rdx
+.LVL181:
+	.loc 1 662 21 view .LVU522
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	beep_sequence_cache_open@PLT
+.LVL182:
+.L114:
+	.loc 1 662 21 view .LVU523
+.LBE113:
+.LBE112:
+	.loc 1 816 17 view .LVU524
+	movq	%rax, %rbx
+	jmp	.L109
+.LVL183:
+.L202:
+.LBB120:
+.LBB94:
+.LBB91:
+.LBB84:
+	.loc 1 573 13 is_stmt 1 view .LVU525
+	leaq	.LC15(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL184:
+	.loc 1 574 13 view .LVU526
+	.loc 1 574 19 is_stmt 0 view .LVU527
+	movl	$0, %ebx
+.LVL185:
+	.loc 1 574 19 view .LVU528
+	jmp	.L121
+.LVL186:
+.L165:
+	.loc 1 574 19 view .LVU529
+.LBE84:
+	.loc 1 580 9 is_stmt 1 view .LVU530
+	.loc 1 581 48 is_stmt 0 view .LVU531
+	call	__errno_location@PLT
+.LVL187:
+	.loc 1 580 9 view .LVU532
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL188:
+	movq	%rax, %rdx
+	movq	param_export_name(%rip), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL189:
+	.loc 1 582 9 is_stmt 1 view .LVU533
+	.loc 1 582 15 is_stmt 0 view .LVU534
+	movl	$0, %ebx
+.LVL190:
+	.loc 1 582 15 view .LVU535
+	jmp	.L121
+.LVL191:
+.L124:
+.LBB85:
+	.loc 1 590 13 is_stmt 1 view .LVU536
+	movq	40(%rsp), %rsi
+	movq	export_writer(%rip), %rdi
+	call	beep_score_write@PLT
+.LVL192:
+.L166:
+	.loc 1 589 18 view .LVU537
+	.loc 1 589 29 is_stmt 0 view .LVU538
+	leaq	80(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	tone_source_next
+.LVL193:
+	movq	%rax, %rdx
+.LVL194:
+	.loc 1 589 18 view .LVU539
+	testq	%rax, %rax
+	jg	.L124
+	.loc 1 592 9 is_stmt 1 view .LVU540
+	.loc 1 592 19 is_stmt 0 view .LVU541
+	sete	%bl
+.LVL195:
+	.loc 1 593 9 is_stmt 1 view .LVU542
+	leaq	80(%rsp), %rdi
+	call	tone_source_close
+.LVL196:
+.L125:
+	.loc 1 593 9 is_stmt 0 view .LVU543
+.LBE85:
+	.loc 1 603 5 is_stmt 1 view .LVU544
+	.loc 1 603 10 is_stmt 0 view .LVU545
+	movq	export_writer(%rip), %rdi
+	call	beep_score_finish@PLT
+.LVL197:
+	movl	%eax, %ebp
+.LVL198:
+	.loc 1 603 8 view .LVU546
+	testb	%al, %al
+	je	.L217
+.LVL199:
+.L121:
+	.loc 1 603 8 view .LVU547
+.LBE91:
+.LBE94:
+	.loc 1 825 9 is_stmt 1 view .LVU548
+	movq	64(%rsp), %rdi
+	call	free@PLT
+.LVL200:
+	.loc 1 826 9 view .LVU549
+	call	beep_timeline_close@PLT
+.LVL201:
+	.loc 1 827 9 view .LVU550
+	.loc 1 827 40 is_stmt 0 view .LVU551
+	xorl	$1, %ebx
+.LVL202:
+	.loc 1 827 40 view .LVU552
+	movzbl	%bl, %eax
+.LVL203:
+.L55:
+	.loc 1 827 40 view .LVU553
+.LBE120:
+	.loc 1 974 1 view .LVU554
+	movq	4360(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L218
+	addq	$4376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL204:
+.L127:
+	.cfi_restore_state
+.LBB121:
+.LBB95:
+.LBB92:
+.LBB86:
+.LBB87:
+	.loc 1 598 13 is_stmt 1 view .LVU555
+	.loc 1 598 37 is_stmt 0 view .LVU556
+	movq	8(%rsp), %r14
+	imulq	$28, %r14, %rdx
+	addq	64(%rsp), %rdx
+	.loc 1 598 13 view .LVU557
+	movq	%rbx, %rsi
+	movl	$0, %edi
+	call	queue_beep
+.LVL205:
+	.loc 1 597 48 is_stmt 1 view .LVU558
+	addq	$1, %r14
+	movq	%r14, 8(%rsp)
+.LVL206:
+.L126:
+	.loc 1 597 27 view .LVU559
+	movq	8(%rsp), %rax
+	cmpq	48(%rsp), %rax
+	jb	.L127
+.LBE87:
+	.loc 1 600 9 view .LVU560
+	leaq	batch.0(%rip), %rsi
+	movl	$0, %edi
+	call	flush_tones
+.LVL207:
+.LBE86:
+	.loc 1 585 9 is_stmt 0 view .LVU561
+	movl	$1, %ebx
+	jmp	.L125
+.LVL208:
+.L217:
+	.loc 1 604 9 is_stmt 1 view .LVU562
+	.loc 1 605 48 is_stmt 0 view .LVU563
+	call	__errno_location@PLT
+.LVL209:
+	.loc 1 604 9 view .LVU564
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL210:
+	movq	%rax, %rdx
+	movq	param_export_name(%rip), %rsi
+	leaq	.LC16(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL211:
+	.loc 1 606 9 is_stmt 1 view .LVU565
+	.loc 1 606 15 is_stmt 0 view .LVU566
+	movl	%ebp, %ebx
+.LVL212:
+	.loc 1 606 15 view .LVU567
+	jmp	.L121
+.LVL213:
+.L117:
+	.loc 1 606 15 view .LVU568
+.LBE92:
+.LBE95:
+.LBE121:
+	.loc 1 830 5 is_stmt 1 view .LVU569
+	.loc 1 832 5 view .LVU570
+	.loc 1 832 9 view .LVU571
+	.loc 1 832 8 view .LVU572
+	.loc 1 833 5 view .LVU573
+	.loc 1 833 71 is_stmt 0 view .LVU574
+	movq	8(%rsp), %r12
+.LVL214:
+	.loc 1 833 71 view .LVU575
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L219
+.LVL215:
+.L129:
+	.loc 1 834 5 is_stmt 1 discriminator 4 view .LVU576
+	.loc 1 834 8 is_stmt 0 discriminator 4 view .LVU577
+	cmpq	$0, param_device_count(%rip)
+	je	.L130
+.LBB122:
+.LBB123:
+	.loc 1 836 21 view .LVU578
+	movq	8(%rsp), %rbx
+.LVL216:
+	.loc 1 837 64 view .LVU579
+	leaq	param_device_names(%rip), %r13
+.LVL217:
+.L134:
+	.loc 1 837 13 is_stmt 1 view .LVU580
+	.loc 1 837 26 is_stmt 0 view .LVU581
+	movq	0(%r13,%rbx,8), %rdi
+	call	beep_drivers_detect@PLT
+.LVL218:
+	.loc 1 837 24 view .LVU582
+	movq	%rax, 112(%rsp,%rbx,8)
+	.loc 1 838 13 is_stmt 1 view .LVU583
+	.loc 1 838 16 is_stmt 0 view .LVU584
+	testq	%rax, %rax
+	je	.L220
+	.loc 1 836 48 is_stmt 1 discriminator 2 view .LVU585
+	addq	$1, %rbx
+.LVL219:
+	.loc 1 836 27 discriminator 2 view .LVU586
+	movq	param_device_count(%rip), %rsi
+	cmpq	%rsi, %rbx
+	jb	.L134
+.LBE123:
+	.loc 1 848 9 view .LVU587
+	.loc 1 848 12 is_stmt 0 view .LVU588
+	cmpq	$1, %rsi
+	jne	.L135
+	.loc 1 849 13 is_stmt 1 view .LVU589
+	.loc 1 849 20 is_stmt 0 view .LVU590
+	movq	112(%rsp), %rbx
+.LVL220:
+.L137:
+	.loc 1 849 20 view .LVU591
+.LBE122:
+	.loc 1 873 5 is_stmt 1 view .LVU592
+	.loc 1 873 10 view .LVU593
+	.loc 1 873 13 is_stmt 0 view .LVU594
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L221
+.L140:
+	.loc 1 873 8 is_stmt 1 discriminator 3 view .LVU595
+	.loc 1 874 5 discriminator 3 view .LVU596
+	.loc 1 874 9 discriminator 3 view .LVU597
+	.loc 1 874 8 discriminator 3 view .LVU598
+	.loc 1 876 5 discriminator 3 view .LVU599
+	.loc 1 876 10 discriminator 3 view .LVU600
+	.loc 1 876 13 is_stmt 0 discriminator 3 view .LVU601
+	cmpl	$0, log_level(%rip)
+	jg	.L222
+.L141:
+	.loc 1 879 8 is_stmt 1 discriminator 3 view .LVU602
+	.loc 1 891 5 discriminator 3 view .LVU603
+	.loc 1 899 5 discriminator 3 view .LVU604
+	leaq	handle_signal(%rip), %r12
+.LVL221:
+	.loc 1 899 5 is_stmt 0 discriminator 3 view .LVU605
+	movq	%r12, %rsi
+	movl	$2, %edi
+	call	signal@PLT
+.LVL222:
+	.loc 1 900 5 is_stmt 1 discriminator 3 view .LVU606
+	movq	%r12, %rsi
+	movl	$15, %edi
+	call	signal@PLT
+.LVL223:
+	.loc 1 902 4 discriminator 3 view .LVU607
+	.loc 1 903 5 discriminator 3 view .LVU608
+	.loc 1 903 8 is_stmt 0 discriminator 3 view .LVU609
+	testq	%rbp, %rbp
+	jne	.L223
+	.loc 1 902 9 view .LVU610
+	movb	$1, 16(%rsp)
+.LVL224:
+.L143:
+	.loc 1 912 5 is_stmt 1 view .LVU611
+	.loc 1 913 5 view .LVU612
+	.loc 1 913 17 is_stmt 0 view .LVU613
+	movq	$0, batch.4(%rip)
+	.loc 1 914 5 is_stmt 1 view .LVU614
+.LBB126:
+	.loc 1 914 10 view .LVU615
+.LVL225:
+	.loc 1 914 38 view .LVU616
+	.loc 1 914 23 is_stmt 0 view .LVU617
+	movl	global_abort(%rip), %eax
+	.loc 1 914 17 view .LVU618
+	movq	8(%rsp), %r14
+.LVL226:
+.LBB127:
+	.loc 1 958 13 view .LVU619
+	leaq	batch.4(%rip), %rbp
+.LBE127:
+	.loc 1 914 38 view .LVU620
+	testl	%eax, %eax
+	je	.L147
+.LVL227:
+.L148:
+	.loc 1 914 38 view .LVU621
+.LBE126:
+	.loc 1 961 5 is_stmt 1 view .LVU622
+	leaq	batch.4(%rip), %rsi
+	movq	%rbx, %rdi
+	call	flush_tones
+.LVL228:
+	.loc 1 962 5 view .LVU623
+	movq	64(%rsp), %rdi
+	call	free@PLT
+.LVL229:
+	.loc 1 964 5 view .LVU624
+	movq	%rbx, %rdi
+	call	beep_drivers_end_tone@PLT
+.LVL230:
+	.loc 1 965 5 view .LVU625
+	movq	%rbx, %rdi
+	call	beep_drivers_fini@PLT
+.LVL231:
+	.loc 1 967 5 view .LVU626
+	call	beep_timeline_close@PLT
+.LVL232:
+	.loc 1 969 5 view .LVU627
+	.loc 1 969 9 is_stmt 0 view .LVU628
+	movl	global_abort(%rip), %eax
+	.loc 1 969 8 view .LVU629
+	testl	%eax, %eax
+	sete	%al
+	.loc 1 969 22 view .LVU630
+	andl	16(%rsp), %eax
+	xorl	$1, %eax
+	movzbl	%al, %eax
+	jmp	.L55
+.LVL233:
+.L219:
+	.loc 1 833 51 discriminator 1 view .LVU631
+	call	beep_timeline_now@PLT
+.LVL234:
+	.loc 1 833 51 discriminator 1 view .LVU632
+	movq	%rax, %r12
+	jmp	.L129
+.LVL235:
+.L220:
+.LBB141:
+.LBB125:
+.LBB124:
+	.loc 1 839 17 is_stmt 1 view .LVU633
+	.loc 1 839 42 is_stmt 0 view .LVU634
+	call	__errno_location@PLT
+.LVL236:
+	.loc 1 840 17 is_stmt 1 view .LVU635
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL237:
+	.loc 1 840 17 is_stmt 0 view .LVU636
+	movq	%rax, %rdx
+	leaq	param_device_names(%rip), %rax
+	movq	(%rax,%rbx,8), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL238:
+	.loc 1 842 17 is_stmt 1 view .LVU637
+	.loc 1 842 23 is_stmt 0 view .LVU638
+	jmp	.L132
+.L133:
+	.loc 1 843 21 is_stmt 1 view .LVU639
+	subq	$1, %rbx
+.LVL239:
+	.loc 1 843 21 is_stmt 0 view .LVU640
+	movq	112(%rsp,%rbx,8), %rdi
+	call	beep_drivers_fini@PLT
+.LVL240:
+.L132:
+	.loc 1 842 26 is_stmt 1 view .LVU641
+	testq	%rbx, %rbx
+	jne	.L133
+	.loc 1 845 17 view .LVU642
+	movl	$1, %edi
+	call	exit@PLT
+.LVL241:
+.L135:
+	.loc 1 845 17 is_stmt 0 view .LVU643
+.LBE124:
+.LBE125:
+	.loc 1 852 13 is_stmt 1 view .LVU644
+	.loc 1 852 22 is_stmt 0 view .LVU645
+	leaq	112(%rsp), %rdi
+	call	fanout_driver_new@PLT
+.LVL242:
+	movq	%rax, %rbx
+.LVL243:
+	.loc 1 854 13 is_stmt 1 view .LVU646
+	.loc 1 854 16 is_stmt 0 view .LVU647
+	testq	%rax, %rax
+	jne	.L137
+	.loc 1 855 17 is_stmt 1 view .LVU648
+	leaq	.LC0(%rip), %rdi
+	call	perror@PLT
+.LVL244:
+	.loc 1 856 17 view .LVU649
+	movl	$1, %edi
+	call	exit@PLT
+.LVL245:
+.L130:
+	.loc 1 856 17 is_stmt 0 view .LVU650
+.LBE141:
+	.loc 1 860 9 is_stmt 1 view .LVU651
+	.loc 1 860 18 is_stmt 0 view .LVU652
+	call	beep_device_cache_detect@PLT
+.LVL246:
+	movq	%rax, %rbx
+.LVL247:
+	.loc 1 861 9 is_stmt 1 view .LVU653
+	.loc 1 861 12 is_stmt 0 view .LVU654
+	testq	%rax, %rax
+	jne	.L137
+	.loc 1 862 13 is_stmt 1 view .LVU655
+	.loc 1 862 22 is_stmt 0 view .LVU656
+	movl	$0, %edi
+	call	beep_drivers_detect@PLT
+.LVL248:
+	.loc 1 862 22 view .LVU657
+	movq	%rax, %rbx
+.LVL249:
+	.loc 1 863 13 is_stmt 1 view .LVU658
+	.loc 1 863 16 is_stmt 0 view .LVU659
+	testq	%rax, %rax
+	je	.L224
+	.loc 1 869 13 is_stmt 1 view .LVU660
+	movq	%rax, %rdi
+	call	beep_device_cache_store@PLT
+.LVL250:
+	.loc 1 869 13 is_stmt 0 view .LVU661
+	jmp	.L137
+.LVL251:
+.L224:
+	.loc 1 864 17 is_stmt 1 view .LVU662
+	leaq	.LC17(%rip), %rdi
+	movl	$0, %eax
+.LVL252:
+	.loc 1 864 17 is_stmt 0 view .LVU663
+	call	log_error@PLT
+.LVL253:
+	.loc 1 866 17 is_stmt 1 view .LVU664
+.LBB142:
+.LBI142:
+	.loc 1 691 6 view .LVU665
+.LBB143:
+	.loc 1 694 5 view .LVU666
+	.loc 1 694 9 is_stmt 0 view .LVU667
+	movl	$1, %edi
+	call	isatty@PLT
+.LVL254:
+	.loc 1 694 8 view .LVU668
+	testl	%eax, %eax
+	jne	.L225
+.L139:
+.LBE143:
+.LBE142:
+	.loc 1 867 17 is_stmt 1 view .LVU669
+	movl	$1, %edi
+	call	exit@PLT
+.LVL255:
+.L225:
+.LBB145:
+.LBB144:
+	.loc 1 695 9 view .LVU670
+	movq	stdout(%rip), %rsi
+	movl	$7, %edi
+	call	fputc@PLT
+.LVL256:
+	jmp	.L139
+.LVL257:
+.L221:
+	.loc 1 695 9 is_stmt 0 view .LVU671
+.LBE144:
+.LBE145:
+	.loc 1 873 34 is_stmt 1 discriminator 1 view .LVU672
+	movl	syscall_count(%rip), %r8d
+	leaq	.LC18(%rip), %rcx
+	movq	%r12, %rdx
+	leaq	.LC19(%rip), %rsi
+	leaq	.LC20(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL258:
+	jmp	.L140
+.L222:
+	.loc 1 876 46 discriminator 1 view .LVU673
+	movl	88(%rbx), %ecx
+	movq	96(%rbx), %r8
+	movq	(%rbx), %rdx
+	movq	%rbx, %rsi
+	leaq	.LC21(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL259:
+	.loc 1 876 8 discriminator 1 view .LVU674
+	.loc 1 879 5 discriminator 1 view .LVU675
+	.loc 1 879 10 discriminator 1 view .LVU676
+	.loc 1 879 13 is_stmt 0 discriminator 1 view .LVU677
+	cmpl	$0, log_level(%rip)
+	jle	.L141
+	.loc 1 879 46 is_stmt 1 discriminator 1 view .LVU678
+	movl	syscall_count(%rip), %esi
+	leaq	.LC22(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL260:
+	jmp	.L141
+.LVL261:
+.L223:
+.LBB146:
+.LBB147:
+.LBB148:
+	.loc 1 558 9 is_stmt 0 view .LVU679
+	leaq	global_abort(%rip), %rbp
+.LVL262:
+.L142:
+	.loc 1 558 9 view .LVU680
+.LBE148:
+	.loc 1 552 12 is_stmt 1 view .LVU681
+	movl	global_abort(%rip), %eax
+	testl	%eax, %eax
+	jne	.L226
+.LBB149:
+	.loc 1 553 9 view .LVU682
+	.loc 1 554 9 view .LVU683
+	.loc 1 554 31 is_stmt 0 view .LVU684
+	leaq	40(%rsp), %rsi
+	leaq	80(%rsp), %rdi
+	call	tone_source_next
+.LVL263:
+	movq	%rax, %rdx
+.LVL264:
+	.loc 1 555 9 is_stmt 1 view .LVU685
+	.loc 1 555 12 is_stmt 0 view .LVU686
+	testq	%rax, %rax
+	jle	.L227
+	.loc 1 558 9 is_stmt 1 view .LVU687
+	movq	%rbp, %rcx
+	movq	40(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	beep_drivers_play_sequence@PLT
+.LVL265:
+	.loc 1 558 9 is_stmt 0 view .LVU688
+	jmp	.L142
+.LVL266:
+.L227:
+	.loc 1 556 13 is_stmt 1 view .LVU689
+	.loc 1 556 27 is_stmt 0 view .LVU690
+	sete	16(%rsp)
+	jmp	.L145
+.LVL267:
+.L226:
+	.loc 1 556 27 view .LVU691
+.LBE149:
+	.loc 1 561 11 view .LVU692
+	movb	$1, 16(%rsp)
+.L145:
+.LVL268:
+	.loc 1 561 11 view .LVU693
+.LBE147:
+.LBE146:
+	.loc 1 905 9 is_stmt 1 view .LVU694
+	leaq	80(%rsp), %rdi
+	call	tone_source_close
+.LVL269:
+	.loc 1 906 9 view .LVU695
+	.loc 1 906 27 is_stmt 0 view .LVU696
+	movq	$0, 48(%rsp)
+	jmp	.L143
+.LVL270:
+.L228:
+.LBB150:
+.LBB139:
+.LBB128:
+	.loc 1 927 13 is_stmt 1 view .LVU697
+	movl	$0, %ecx
+	movl	$2, %edx
+	movl	$0, %esi
+	movq	stdin(%rip), %rdi
+	call	setvbuf@PLT
+.LVL271:
+	.loc 1 928 13 view .LVU698
+	movl	$0, %ecx
+	movl	$2, %edx
+	movl	$0, %esi
+	movq	stdout(%rip), %rdi
+	call	setvbuf@PLT
+.LVL272:
+	.loc 1 931 13 view .LVU699
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	flush_tones
+.LVL273:
+	.loc 1 933 13 view .LVU700
+	.loc 1 934 13 view .LVU701
+	.loc 1 934 20 view .LVU702
+	movl	global_abort(%rip), %eax
+	testl	%eax, %eax
+	je	.L158
+.L159:
+	.loc 1 934 20 is_stmt 0 view .LVU703
+.LBE128:
+.LBE139:
+	.loc 1 914 64 is_stmt 1 discriminator 2 view .LVU704
+	addq	$1, %r14
+.LVL274:
+	.loc 1 914 38 discriminator 2 view .LVU705
+	.loc 1 914 23 is_stmt 0 discriminator 2 view .LVU706
+	movl	global_abort(%rip), %eax
+	.loc 1 914 38 discriminator 2 view .LVU707
+	testl	%eax, %eax
+	jne	.L148
+.LVL275:
+.L147:
+	.loc 1 914 38 discriminator 3 view .LVU708
+	cmpq	48(%rsp), %r14
+	jnb	.L148
+.LBB140:
+	.loc 1 915 9 is_stmt 1 view .LVU709
+	.loc 1 915 35 is_stmt 0 view .LVU710
+	leaq	0(,%r14,8), %rax
+	subq	%r14, %rax
+	movq	64(%rsp), %rdx
+	leaq	(%rdx,%rax,4), %r12
+.LVL276:
+	.loc 1 917 9 is_stmt 1 view .LVU711
+	.loc 1 917 12 is_stmt 0 view .LVU712
+	cmpl	$0, 24(%r12)
+	jne	.L228
+	.loc 1 958 13 is_stmt 1 view .LVU713
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	queue_beep
+.LVL277:
+	jmp	.L159
+.L230:
+.LBB138:
+.LBB129:
+	.loc 1 935 61 is_stmt 0 discriminator 1 view .LVU714
+	call	beep_timeline_now@PLT
+.LVL278:
+	movq	%rax, %r15
+	jmp	.L151
+.LVL279:
+.L153:
+	.loc 1 937 46 discriminator 6 view .LVU715
+	leaq	.LC23(%rip), %rcx
+	movq	%r15, %rdx
+	leaq	.LC24(%rip), %rsi
+	leaq	.LC25(%rip), %rdi
+	call	beep_timeline_span@PLT
+.LVL280:
+.L152:
+	.loc 1 937 20 is_stmt 1 discriminator 7 view .LVU716
+	.loc 1 939 17 discriminator 7 view .LVU717
+	.loc 1 939 20 is_stmt 0 discriminator 7 view .LVU718
+	testq	%r13, %r13
+	je	.L159
+	.loc 1 942 17 is_stmt 1 view .LVU719
+	.loc 1 942 20 is_stmt 0 view .LVU720
+	cmpl	$2, 24(%r12)
+	je	.L229
+	.loc 1 951 21 is_stmt 1 view .LVU721
+	leaq	256(%rsp), %rdi
+	movq	stdout(%rip), %rsi
+	call	fputs@PLT
+.LVL281:
+	.loc 1 952 21 view .LVU722
+	.loc 1 952 25 view .LVU723
+	.loc 1 952 24 view .LVU724
+	.loc 1 953 21 view .LVU725
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	queue_beep
+.LVL282:
+	.loc 1 954 21 view .LVU726
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	flush_tones
+.LVL283:
+.L156:
+	.loc 1 954 21 is_stmt 0 view .LVU727
+.LBE129:
+	.loc 1 934 20 is_stmt 1 view .LVU728
+	movl	global_abort(%rip), %eax
+	testl	%eax, %eax
+	jne	.L159
+.LVL284:
+.L158:
+.LBB137:
+	.loc 1 935 17 view .LVU729
+	.loc 1 935 81 is_stmt 0 view .LVU730
+	movq	8(%rsp), %r15
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L230
+.L151:
+.LVL285:
+	.loc 1 936 17 is_stmt 1 discriminator 4 view .LVU731
+.LBB130:
+.LBI130:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdio2.h"
+	.loc 2 209 1 discriminator 4 view .LVU732
+.LBB131:
+	.loc 2 211 3 discriminator 4 view .LVU733
+	.loc 2 212 3 discriminator 4 view .LVU734
+	.loc 2 213 5 discriminator 4 view .LVU735
+	.loc 2 213 12 is_stmt 0 discriminator 4 view .LVU736
+	leaq	256(%rsp), %rdi
+.LVL286:
+	.loc 2 213 12 discriminator 4 view .LVU737
+	movq	stdin(%rip), %rdx
+	movl	$4096, %esi
+	call	fgets@PLT
+.LVL287:
+	.loc 2 213 12 discriminator 4 view .LVU738
+	movq	%rax, %r13
+.LVL288:
+	.loc 2 213 12 discriminator 4 view .LVU739
+.LBE131:
+.LBE130:
+	.loc 1 937 17 is_stmt 1 discriminator 4 view .LVU740
+	.loc 1 937 22 discriminator 4 view .LVU741
+	.loc 1 937 25 is_stmt 0 discriminator 4 view .LVU742
+	cmpb	$0, timeline_enabled(%rip)
+	je	.L152
+	.loc 1 937 46 is_stmt 1 discriminator 1 view .LVU743
+	movl	$0, %r8d
+	testq	%rax, %rax
+	je	.L153
+	.loc 1 937 133 is_stmt 0 discriminator 3 view .LVU744
+	leaq	256(%rsp), %rdi
+	call	strlen@PLT
+.LVL289:
+	.loc 1 937 46 discriminator 3 view .LVU745
+	movl	%eax, %r8d
+	jmp	.L153
+.L229:
+.LVL290:
+.LBB132:
+	.loc 1 943 57 is_stmt 1 view .LVU746
+	.loc 1 943 42 is_stmt 0 view .LVU747
+	movl	global_abort(%rip), %eax
+	.loc 1 943 32 view .LVU748
+	leaq	256(%rsp), %r13
+.LVL291:
+	.loc 1 943 57 view .LVU749
+	testl	%eax, %eax
+	jne	.L156
+.L155:
+	.loc 1 943 61 discriminator 3 view .LVU750
+	movzbl	0(%r13), %edi
+	.loc 1 943 57 discriminator 3 view .LVU751
+	testb	%dil, %dil
+	je	.L156
+	.loc 1 944 25 is_stmt 1 discriminator 4 view .LVU752
+.LVL292:
+.LBB133:
+.LBI133:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.loc 3 82 1 discriminator 4 view .LVU753
+.LBB134:
+	.loc 3 84 3 discriminator 4 view .LVU754
+.LBE134:
+.LBE133:
+	.loc 1 944 25 is_stmt 0 discriminator 4 view .LVU755
+	movsbl	%dil, %edi
+.LVL293:
+.LBB136:
+.LBB135:
+	.loc 3 84 10 discriminator 4 view .LVU756
+	movq	stdout(%rip), %rsi
+	call	putc@PLT
+.LVL294:
+	.loc 3 84 10 discriminator 4 view .LVU757
+.LBE135:
+.LBE136:
+	.loc 1 945 25 is_stmt 1 discriminator 4 view .LVU758
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+.LVL295:
+	.loc 1 946 25 discriminator 4 view .LVU759
+	.loc 1 946 29 discriminator 4 view .LVU760
+	.loc 1 946 28 discriminator 4 view .LVU761
+	.loc 1 947 25 discriminator 4 view .LVU762
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	queue_beep
+.LVL296:
+	.loc 1 948 25 discriminator 4 view .LVU763
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	flush_tones
+.LVL297:
+	.loc 1 943 71 discriminator 4 view .LVU764
+	addq	$1, %r13
+.LVL298:
+	.loc 1 943 57 discriminator 4 view .LVU765
+	.loc 1 943 42 is_stmt 0 discriminator 4 view .LVU766
+	movl	global_abort(%rip), %eax
+	.loc 1 943 57 discriminator 4 view .LVU767
+	testl	%eax, %eax
+	je	.L155
+	jmp	.L156
+.LVL299:
+.L206:
+	.loc 1 943 57 discriminator 4 view .LVU768
+.LBE132:
+.LBE137:
+.LBE138:
+.LBE140:
+.LBE150:
+.LBB151:
+.LBB108:
+.LBB107:
+.LBB105:
+	.loc 1 305 17 is_stmt 1 view .LVU769
+	leaq	.LC26(%rip), %rdi
+	movl	$0, %eax
+	call	log_warning@PLT
+.LVL300:
+	.loc 1 307 13 view .LVU770
+	jmp	.L164
+.LVL301:
+.L118:
+	.loc 1 307 13 is_stmt 0 view .LVU771
+.LBE105:
+.LBE107:
+.LBE108:
+.LBE151:
+.LBB152:
+.LBB96:
+.LBB93:
+	.loc 1 578 5 is_stmt 1 view .LVU772
+	.loc 1 578 21 is_stmt 0 view .LVU773
+	call	beep_score_create@PLT
+.LVL302:
+	.loc 1 578 19 view .LVU774
+	movq	%rax, export_writer(%rip)
+	.loc 1 579 5 is_stmt 1 view .LVU775
+	.loc 1 579 8 is_stmt 0 view .LVU776
+	testq	%rax, %rax
+	je	.L165
+.LBB89:
+	.loc 1 589 29 view .LVU777
+	leaq	40(%rsp), %rbx
+.LVL303:
+	.loc 1 589 29 view .LVU778
+	jmp	.L166
+.LVL304:
+.L201:
+	.loc 1 589 29 view .LVU779
+.LBE89:
+	.loc 1 578 5 is_stmt 1 view .LVU780
+	.loc 1 578 21 is_stmt 0 view .LVU781
+	call	beep_score_create@PLT
+.LVL305:
+	.loc 1 578 19 view .LVU782
+	movq	%rax, export_writer(%rip)
+	.loc 1 579 5 is_stmt 1 view .LVU783
+	.loc 1 579 8 is_stmt 0 view .LVU784
+	testq	%rax, %rax
+	je	.L165
+.LVL306:
+.LBB90:
+	.loc 1 595 9 is_stmt 1 view .LVU785
+	.loc 1 596 9 view .LVU786
+	.loc 1 596 21 is_stmt 0 view .LVU787
+	movq	$0, batch.0(%rip)
+	.loc 1 597 9 is_stmt 1 view .LVU788
+.LBB88:
+	.loc 1 597 14 view .LVU789
+.LVL307:
+	.loc 1 598 13 is_stmt 0 view .LVU790
+	leaq	batch.0(%rip), %rbx
+.LVL308:
+	.loc 1 597 9 view .LVU791
+	jmp	.L126
+.LVL309:
+.L216:
+	.loc 1 597 9 view .LVU792
+.LBE88:
+.LBE90:
+.LBE93:
+.LBE96:
+.LBE152:
+	.loc 1 816 9 is_stmt 1 view .LVU793
+.LBB153:
+.LBI112:
+	.loc 1 636 13 view .LVU794
+.LBB119:
+	.loc 1 639 5 view .LVU795
+	.loc 1 640 5 view .LVU796
+	.loc 1 640 24 is_stmt 0 view .LVU797
+	movl	log_level(%rip), %eax
+	movl	%eax, 112(%rsp)
+	.loc 1 641 5 is_stmt 1 view .LVU798
+	.loc 1 641 27 is_stmt 0 view .LVU799
+	movq	param_device_count(%rip), %rsi
+	movq	%rsi, 120(%rsp)
+	.loc 1 642 5 is_stmt 1 view .LVU800
+.LBB118:
+	.loc 1 642 10 view .LVU801
+.LVL310:
+	.loc 1 642 17 is_stmt 0 view .LVU802
+	movq	8(%rsp), %rax
+.LBB116:
+	.loc 1 643 19 view .LVU803
+	leaq	param_device_args(%rip), %r8
+	.loc 1 646 42 view .LVU804
+	leaq	param_device_names(%rip), %rdi
+.LBE116:
+	.loc 1 642 5 view .LVU805
+	jmp	.L168
+.LVL311:
+.L59:
+	.loc 1 642 5 view .LVU806
+.LBE118:
+.LBE119:
+.LBE153:
+	.loc 1 730 9 is_stmt 1 view .LVU807
+	leaq	.LC27(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL312:
+	.loc 1 732 9 view .LVU808
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL313:
+	.loc 1 733 9 view .LVU809
+	movl	$1, %edi
+	call	exit@PLT
+.LVL314:
+.L218:
+	.loc 1 974 1 is_stmt 0 view .LVU810
+	call	__stack_chk_fail@PLT
+.LVL315:
+	.cfi_endproc
+.LFE84:
+	.size	main, .-main
+	.local	batch.0
+	.comm	batch.0,4104,32
+	.local	batch.1
+	.comm	batch.1,4104,32
+	.section	.rodata.str1.1
+.LC28:
+	.string	"help"
+.LC29:
+	.string	"version"
+.LC30:
+	.string	"new"
+.LC31:
+	.string	"verbose"
+.LC32:
+	.string	"debug"
+.LC33:
+	.string	"device"
+.LC34:
+	.string	"timeline"
+.LC35:
+	.string	"score"
+.LC36:
+	.string	"export-score"
+.LC37:
+	.string	"bpm"
+.LC38:
+	.string	"sequence"
+.LC39:
+	.string	"rtttl"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	opt_list.2, @object
+	.size	opt_list.2, 416
+opt_list.2:
+	.quad	.LC28
+	.long	0
+	.zero	4
+	.quad	0
+	.long	104
+	.zero	4
+	.quad	.LC29
+	.long	0
+	.zero	4
+	.quad	0
+	.long	86
+	.zero	4
+	.quad	.LC30
+	.long	0
+	.zero	4
+	.quad	0
+	.long	110
+	.zero	4
+	.quad	.LC31
+	.long	0
+	.zero	4
+	.quad	0
+	.long	88
+	.zero	4
+	.quad	.LC32
+	.long	0
+	.zero	4
+	.quad	0
+	.long	88
+	.zero	4
+	.quad	.LC33
+	.long	1
+	.zero	4
+	.quad	0
+	.long	101
+	.zero	4
+	.quad	.LC34
+	.long	1
+	.zero	4
+	.quad	0
+	.long	84
+	.zero	4
+	.quad	.LC35
+	.long	1
+	.zero	4
+	.quad	0
+	.long	83
+	.zero	4
+	.quad	.LC36
+	.long	1
+	.zero	4
+	.quad	0
+	.long	69
+	.zero	4
+	.quad	.LC37
+	.long	1
+	.zero	4
+	.quad	0
+	.long	66
+	.zero	4
+	.quad	.LC38
+	.long	1
+	.zero	4
+	.quad	0
+	.long	81
+	.zero	4
+	.quad	.LC39
+	.long	1
+	.zero	4
+	.quad	0
+	.long	82
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.section	.rodata.str1.1
+.LC40:
+	.string	"USER="
+.LC41:
+	.string	"UID="
+.LC42:
+	.string	"GID="
+	.section	.data.rel.ro.local
+	.align 32
+	.type	sudo_vars.3, @object
+	.size	sudo_vars.3, 40
+sudo_vars.3:
+	.quad	.LC4
+	.quad	.LC40
+	.quad	.LC41
+	.quad	.LC42
+	.quad	0
+	.local	batch.4
+	.comm	batch.4,4104,32
+	.local	tone_tempo
+	.comm	tone_tempo,16,16
+	.local	export_writer
+	.comm	export_writer,8,8
+	.data
+	.align 4
+	.type	param_bpm, @object
+	.size	param_bpm, 4
+param_bpm:
+	.long	120
+	.local	param_rtttl_name
+	.comm	param_rtttl_name,8,8
+	.local	param_sequence_source
+	.comm	param_sequence_source,8,8
+	.local	param_export_name
+	.comm	param_export_name,8,8
+	.local	param_score_name
+	.comm	param_score_name,8,8
+	.local	param_timeline_name
+	.comm	param_timeline_name,8,8
+	.local	param_device_count
+	.comm	param_device_count,8,8
+	.local	param_device_args
+	.comm	param_device_args,64,32
+	.local	param_device_names
+	.comm	param_device_names,128,32
+	.local	global_abort
+	.comm	global_abort,4,4
+	.section	.rodata
+	.align 32
+	.type	version_message, @object
+	.size	version_message, 189
+version_message:
+	.string	"beep 1.4.3\nCopyright (C) 2002-2016 Johnathan Nightingale\nCopyright (C) 2013-2018 Hans Ulrich Niedermann\nUse and Distribution subject to GPL.\nFor information: http://www.gnu.org/copyleft/.\n"
+	.text
+.Letext0:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/getopt_ext.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 8 "/usr/include/signal.h"
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 13 "/usr/include/stdio.h"
+	.file 14 "beep-driver.h"
+	.file 15 "beep-driver-console.h"
+	.file 16 "beep-driver-evdev.h"
+	.file 17 "beep-driver-pcm.h"
+	.file 18 "beep-driver-pwm.h"
+	.file 19 "beep-driver-trace.h"
+	.file 20 "beep-library.h"
+	.file 21 "beep-log.h"
+	.file 22 "beep-notes.h"
+	.file 23 "beep-rtttl.h"
+	.file 24 "beep-score.h"
+	.file 25 "beep-sequence.h"
+	.file 26 "beep-sequence-cache.h"
+	.file 27 "beep-timeline.h"
+	.file 28 "beep-usage.h"
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdio2-decl.h"
+	.file 30 "beep-drivers.h"
+	.file 31 "/usr/include/unistd.h"
+	.file 32 "/usr/include/stdlib.h"
+	.file 33 "/usr/include/string.h"
+	.file 34 "beep-device-cache.h"
+	.file 35 "beep-driver-fanout.h"
+	.file 36 "/usr/include/errno.h"
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/auxv.h"
+	.file 38 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2b50
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3c
+	.long	.LASF257
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x8
+	.long	0x3c
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x7
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x69
+	.uleb128 0x7
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x81
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x99
+	.byte	0x12
+	.long	0x81
+	.uleb128 0x3e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x81
+	.uleb128 0x6
+	.long	0xc9
+	.uleb128 0x29
+	.long	0xba
+	.uleb128 0x8
+	.long	0xba
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x8
+	.long	0xc9
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xd7
+	.byte	0xd
+	.long	0x69
+	.uleb128 0xd
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x24
+	.byte	0xe
+	.long	0xba
+	.uleb128 0xd
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x32
+	.byte	0xc
+	.long	0x69
+	.uleb128 0x26
+	.long	.LASF30
+	.byte	0x20
+	.byte	0x6
+	.byte	0x32
+	.long	0x13a
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x34
+	.byte	0xf
+	.long	0x13f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x37
+	.byte	0x7
+	.long	0x69
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x38
+	.byte	0x8
+	.long	0x14e
+	.byte	0x10
+	.uleb128 0x33
+	.string	"val"
+	.byte	0x6
+	.byte	0x39
+	.byte	0x7
+	.long	0x69
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	0xf9
+	.uleb128 0x6
+	.long	0xd0
+	.uleb128 0x8
+	.long	0x13f
+	.uleb128 0x29
+	.long	0x13f
+	.uleb128 0x6
+	.long	0x69
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x8
+	.byte	0x18
+	.long	0xd5
+	.uleb128 0x8
+	.long	0x153
+	.uleb128 0x34
+	.long	0x15f
+	.uleb128 0x34
+	.long	0x153
+	.uleb128 0x7
+	.long	.LASF23
+	.byte	0x8
+	.byte	0x48
+	.byte	0x10
+	.long	0x17a
+	.uleb128 0x6
+	.long	0x17f
+	.uleb128 0x22
+	.long	0x18a
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF24
+	.byte	0x9
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x8
+	.long	0x18a
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF25
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF26
+	.uleb128 0x7
+	.long	.LASF27
+	.byte	0xa
+	.byte	0x19
+	.byte	0x14
+	.long	0x5d
+	.uleb128 0x8
+	.long	0x1a9
+	.uleb128 0x7
+	.long	.LASF28
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x14
+	.long	0x75
+	.uleb128 0x7
+	.long	.LASF29
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x8
+	.long	0x1c6
+	.uleb128 0x26
+	.long	.LASF31
+	.byte	0xd8
+	.byte	0xb
+	.byte	0x31
+	.long	0x35d
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0xb
+	.byte	0x33
+	.byte	0x7
+	.long	0x69
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0xb
+	.byte	0x36
+	.byte	0x9
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0xb
+	.byte	0x37
+	.byte	0x9
+	.long	0xba
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0xb
+	.byte	0x38
+	.byte	0x9
+	.long	0xba
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0xb
+	.byte	0x39
+	.byte	0x9
+	.long	0xba
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x9
+	.long	0xba
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x9
+	.long	0xba
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x9
+	.long	0xba
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x9
+	.long	0xba
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0xb
+	.byte	0x40
+	.byte	0x9
+	.long	0xba
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0xb
+	.byte	0x41
+	.byte	0x9
+	.long	0xba
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0xb
+	.byte	0x42
+	.byte	0x9
+	.long	0xba
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0xb
+	.byte	0x44
+	.byte	0x16
+	.long	0x376
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0xb
+	.byte	0x46
+	.byte	0x14
+	.long	0x37b
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0xb
+	.byte	0x48
+	.byte	0x7
+	.long	0x69
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0xb
+	.byte	0x49
+	.byte	0x7
+	.long	0x69
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xb
+	.long	0x94
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x12
+	.long	0x35
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0xb
+	.byte	0x4e
+	.byte	0xf
+	.long	0x4f
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x8
+	.long	0x380
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0xb
+	.byte	0x51
+	.byte	0xf
+	.long	0x390
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0xb
+	.byte	0x59
+	.byte	0xd
+	.long	0xa0
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x17
+	.long	0x39a
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x19
+	.long	0x3a4
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x14
+	.long	0x37b
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0xb
+	.byte	0x5e
+	.byte	0x9
+	.long	0xac
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x5f
+	.byte	0xa
+	.long	0x18a
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x60
+	.byte	0x7
+	.long	0x69
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x62
+	.byte	0x8
+	.long	0x3a9
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF61
+	.byte	0xc
+	.byte	0x7
+	.byte	0x19
+	.long	0x1d7
+	.uleb128 0x3f
+	.long	.LASF258
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1b
+	.long	.LASF62
+	.uleb128 0x6
+	.long	0x371
+	.uleb128 0x6
+	.long	0x1d7
+	.uleb128 0x11
+	.long	0xc9
+	.long	0x390
+	.uleb128 0x16
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x369
+	.uleb128 0x1b
+	.long	.LASF63
+	.uleb128 0x6
+	.long	0x395
+	.uleb128 0x1b
+	.long	.LASF64
+	.uleb128 0x6
+	.long	0x39f
+	.uleb128 0x11
+	.long	0xc9
+	.long	0x3b9
+	.uleb128 0x16
+	.long	0x48
+	.byte	0x13
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x8
+	.long	0x3b9
+	.uleb128 0xd
+	.long	.LASF66
+	.byte	0xd
+	.byte	0x8f
+	.byte	0xe
+	.long	0x3d6
+	.uleb128 0x6
+	.long	0x35d
+	.uleb128 0x29
+	.long	0x3d6
+	.uleb128 0xd
+	.long	.LASF67
+	.byte	0xd
+	.byte	0x90
+	.byte	0xe
+	.long	0x3d6
+	.uleb128 0x6
+	.long	0xba
+	.uleb128 0x7
+	.long	.LASF68
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x1d
+	.long	0x402
+	.uleb128 0x8
+	.long	0x3f1
+	.uleb128 0x26
+	.long	.LASF69
+	.byte	0x70
+	.byte	0xe
+	.byte	0x43
+	.long	0x4c5
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0xe
+	.byte	0x44
+	.byte	0xb
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0xe
+	.byte	0x45
+	.byte	0x12
+	.long	0x544
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xe
+	.byte	0x47
+	.byte	0x1d
+	.long	0x513
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xe
+	.byte	0x48
+	.byte	0x1b
+	.long	0x573
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xe
+	.byte	0x49
+	.byte	0x1b
+	.long	0x58f
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0xe
+	.byte	0x4a
+	.byte	0x21
+	.long	0x59b
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0xe
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x5bc
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xe
+	.byte	0x52
+	.byte	0x1b
+	.long	0x5c8
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xe
+	.byte	0x59
+	.byte	0x24
+	.long	0x5e9
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xe
+	.byte	0x61
+	.byte	0x1c
+	.long	0x54e
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xe
+	.byte	0x62
+	.byte	0x18
+	.long	0x628
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x67
+	.byte	0x9
+	.long	0x69
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xe
+	.byte	0x68
+	.byte	0x11
+	.long	0x13f
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0xe
+	.byte	0x6d
+	.byte	0xb
+	.long	0xac
+	.byte	0x68
+	.byte	0
+	.uleb128 0x27
+	.byte	0x10
+	.byte	0xe
+	.byte	0x22
+	.long	0x502
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0xe
+	.byte	0x23
+	.byte	0xe
+	.long	0x1ba
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0x1ba
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0xe
+	.byte	0x25
+	.byte	0xe
+	.long	0x1ba
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0xe
+	.byte	0x26
+	.byte	0xe
+	.long	0x1ba
+	.byte	0xc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF87
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x4c5
+	.uleb128 0x8
+	.long	0x502
+	.uleb128 0x7
+	.long	.LASF88
+	.byte	0xe
+	.byte	0x32
+	.byte	0xf
+	.long	0x51f
+	.uleb128 0x6
+	.long	0x524
+	.uleb128 0x35
+	.long	0x538
+	.long	0x538
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x13f
+	.byte	0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF89
+	.uleb128 0x8
+	.long	0x538
+	.uleb128 0x6
+	.long	0x3f1
+	.uleb128 0x8
+	.long	0x544
+	.uleb128 0x7
+	.long	.LASF90
+	.byte	0xe
+	.byte	0x34
+	.byte	0xf
+	.long	0x55a
+	.uleb128 0x6
+	.long	0x55f
+	.uleb128 0x35
+	.long	0x538
+	.long	0x573
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF91
+	.byte	0xe
+	.byte	0x36
+	.byte	0x10
+	.long	0x57f
+	.uleb128 0x6
+	.long	0x584
+	.uleb128 0x22
+	.long	0x58f
+	.uleb128 0x2
+	.long	0x544
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF92
+	.byte	0xe
+	.byte	0x37
+	.byte	0x10
+	.long	0x57f
+	.uleb128 0x7
+	.long	.LASF93
+	.byte	0xe
+	.byte	0x38
+	.byte	0x10
+	.long	0x5a7
+	.uleb128 0x6
+	.long	0x5ac
+	.uleb128 0x22
+	.long	0x5bc
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x1b5
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF94
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x10
+	.long	0x57f
+	.uleb128 0x7
+	.long	.LASF95
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x10
+	.long	0x5d4
+	.uleb128 0x6
+	.long	0x5d9
+	.uleb128 0x22
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF96
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x10
+	.long	0x5f5
+	.uleb128 0x6
+	.long	0x5fa
+	.uleb128 0x22
+	.long	0x614
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x619
+	.uleb128 0x2
+	.long	0x196
+	.uleb128 0x2
+	.long	0x623
+	.byte	0
+	.uleb128 0x6
+	.long	0x50e
+	.uleb128 0x8
+	.long	0x614
+	.uleb128 0x6
+	.long	0x164
+	.uleb128 0x8
+	.long	0x61e
+	.uleb128 0x6
+	.long	0x144
+	.uleb128 0xd
+	.long	.LASF97
+	.byte	0xf
+	.byte	0x1a
+	.byte	0x14
+	.long	0x3f1
+	.uleb128 0xd
+	.long	.LASF98
+	.byte	0x10
+	.byte	0x19
+	.byte	0x14
+	.long	0x3f1
+	.uleb128 0xd
+	.long	.LASF99
+	.byte	0x11
+	.byte	0x25
+	.byte	0x14
+	.long	0x3f1
+	.uleb128 0xd
+	.long	.LASF100
+	.byte	0x12
+	.byte	0x21
+	.byte	0x14
+	.long	0x3f1
+	.uleb128 0xd
+	.long	.LASF101
+	.byte	0x13
+	.byte	0x35
+	.byte	0x14
+	.long	0x3f1
+	.uleb128 0xd
+	.long	.LASF102
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x15
+	.long	0x3c
+	.uleb128 0xd
+	.long	.LASF103
+	.byte	0x15
+	.byte	0x1a
+	.byte	0xc
+	.long	0x69
+	.uleb128 0x27
+	.byte	0x10
+	.byte	0x16
+	.byte	0x35
+	.long	0x6a4
+	.uleb128 0x33
+	.string	"bpm"
+	.byte	0x16
+	.byte	0x36
+	.byte	0x12
+	.long	0x3c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF104
+	.byte	0x16
+	.byte	0x37
+	.byte	0xe
+	.long	0x1c6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF105
+	.byte	0x16
+	.byte	0x38
+	.byte	0x3
+	.long	0x681
+	.uleb128 0x7
+	.long	.LASF106
+	.byte	0x17
+	.byte	0x21
+	.byte	0x1c
+	.long	0x6bc
+	.uleb128 0x1b
+	.long	.LASF107
+	.uleb128 0x7
+	.long	.LASF108
+	.byte	0x18
+	.byte	0x3e
+	.byte	0x1c
+	.long	0x6cd
+	.uleb128 0x1b
+	.long	.LASF109
+	.uleb128 0x7
+	.long	.LASF110
+	.byte	0x18
+	.byte	0x3f
+	.byte	0x23
+	.long	0x6de
+	.uleb128 0x1b
+	.long	.LASF111
+	.uleb128 0x7
+	.long	.LASF112
+	.byte	0x19
+	.byte	0x28
+	.byte	0x1f
+	.long	0x6ef
+	.uleb128 0x1b
+	.long	.LASF113
+	.uleb128 0x27
+	.byte	0x90
+	.byte	0x1a
+	.byte	0x32
+	.long	0x731
+	.uleb128 0x4
+	.long	.LASF103
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x9
+	.long	0x69
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF114
+	.byte	0x1a
+	.byte	0x34
+	.byte	0xc
+	.long	0x18a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF115
+	.byte	0x1a
+	.byte	0x35
+	.byte	0xe
+	.long	0x731
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x36
+	.byte	0xe
+	.long	0x731
+	.byte	0x50
+	.byte	0
+	.uleb128 0x11
+	.long	0x1ba
+	.long	0x741
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF117
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x3
+	.long	0x6f4
+	.uleb128 0x8
+	.long	0x741
+	.uleb128 0xd
+	.long	.LASF118
+	.byte	0x1b
+	.byte	0x21
+	.byte	0xc
+	.long	0x538
+	.uleb128 0x11
+	.long	0xc9
+	.long	0x769
+	.uleb128 0x40
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF119
+	.byte	0x1c
+	.byte	0x16
+	.byte	0xd
+	.long	0x75e
+	.uleb128 0x11
+	.long	0xd0
+	.long	0x785
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xbc
+	.byte	0
+	.uleb128 0x8
+	.long	0x775
+	.uleb128 0x14
+	.long	.LASF136
+	.byte	0x45
+	.byte	0xc
+	.long	0x785
+	.uleb128 0x9
+	.byte	0x3
+	.quad	version_message
+	.uleb128 0x36
+	.long	0x3c
+	.byte	0x4e
+	.long	0x7b6
+	.uleb128 0x23
+	.long	.LASF120
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF121
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF122
+	.byte	0x1
+	.byte	0x51
+	.byte	0x7
+	.long	0x79f
+	.uleb128 0x36
+	.long	0x3c
+	.byte	0x54
+	.long	0x7df
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF124
+	.byte	0x1
+	.uleb128 0x23
+	.long	.LASF125
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF126
+	.byte	0x1
+	.byte	0x58
+	.byte	0x7
+	.long	0x7c2
+	.uleb128 0x7
+	.long	.LASF127
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x1e
+	.long	0x7fc
+	.uleb128 0x8
+	.long	0x7eb
+	.uleb128 0x26
+	.long	.LASF128
+	.byte	0x1c
+	.byte	0x1
+	.byte	0x64
+	.long	0x864
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0x1
+	.byte	0x66
+	.byte	0x12
+	.long	0x3c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x1
+	.byte	0x67
+	.byte	0xe
+	.long	0x1ba
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0x1
+	.byte	0x68
+	.byte	0x12
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF129
+	.byte	0x1
+	.byte	0x69
+	.byte	0x12
+	.long	0x3c
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x12
+	.long	0x3c
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF130
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x11
+	.long	0x7b6
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF131
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x12
+	.long	0x7df
+	.byte	0x18
+	.byte	0
+	.uleb128 0x27
+	.byte	0x18
+	.byte	0x1
+	.byte	0x7b
+	.long	0x894
+	.uleb128 0x4
+	.long	.LASF132
+	.byte	0x1
+	.byte	0x7c
+	.byte	0xc
+	.long	0x18a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF133
+	.byte	0x1
+	.byte	0x7d
+	.byte	0xc
+	.long	0x18a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF134
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x13
+	.long	0x894
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0x7eb
+	.uleb128 0x8
+	.long	0x894
+	.uleb128 0x7
+	.long	.LASF135
+	.byte	0x1
+	.byte	0x7f
+	.byte	0x3
+	.long	0x864
+	.uleb128 0x8
+	.long	0x89e
+	.uleb128 0x14
+	.long	.LASF137
+	.byte	0x9f
+	.byte	0x1e
+	.long	0x169
+	.uleb128 0x9
+	.byte	0x3
+	.quad	global_abort
+	.uleb128 0x11
+	.long	0xba
+	.long	0x8d4
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xf
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF138
+	.byte	0xea
+	.byte	0xe
+	.long	0x8c4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_device_names
+	.uleb128 0x11
+	.long	0x69
+	.long	0x8f9
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xf
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF139
+	.byte	0xeb
+	.byte	0xc
+	.long	0x8e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_device_args
+	.uleb128 0x14
+	.long	.LASF140
+	.byte	0xec
+	.byte	0xf
+	.long	0x18a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_device_count
+	.uleb128 0x14
+	.long	.LASF141
+	.byte	0xed
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_timeline_name
+	.uleb128 0x14
+	.long	.LASF142
+	.byte	0xee
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_score_name
+	.uleb128 0x14
+	.long	.LASF143
+	.byte	0xef
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_export_name
+	.uleb128 0x14
+	.long	.LASF144
+	.byte	0xf0
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_sequence_source
+	.uleb128 0x14
+	.long	.LASF145
+	.byte	0xf1
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_rtttl_name
+	.uleb128 0x14
+	.long	.LASF146
+	.byte	0xf2
+	.byte	0x15
+	.long	0x3c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_bpm
+	.uleb128 0x41
+	.value	0x1008
+	.byte	0x1
+	.value	0x1a3
+	.byte	0x9
+	.long	0x9c7
+	.uleb128 0x24
+	.long	.LASF132
+	.value	0x1a4
+	.byte	0xc
+	.long	0x18a
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF147
+	.value	0x1a5
+	.byte	0xf
+	.long	0x9c7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	0x502
+	.long	0x9d7
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xff
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF148
+	.value	0x1a6
+	.long	0x9a1
+	.uleb128 0x17
+	.long	.LASF149
+	.value	0x1ac
+	.byte	0x1b
+	.long	0x9f8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	export_writer
+	.uleb128 0x6
+	.long	0x6d2
+	.uleb128 0x17
+	.long	.LASF150
+	.value	0x1c1
+	.byte	0x13
+	.long	0x6a4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tone_tempo
+	.uleb128 0x42
+	.byte	0x18
+	.byte	0x1
+	.value	0x200
+	.byte	0x9
+	.long	0xa45
+	.uleb128 0x24
+	.long	.LASF151
+	.value	0x201
+	.byte	0x11
+	.long	0xa45
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF152
+	.value	0x202
+	.byte	0x14
+	.long	0xa4f
+	.byte	0x8
+	.uleb128 0x24
+	.long	.LASF153
+	.value	0x203
+	.byte	0x11
+	.long	0xa54
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0x6c1
+	.uleb128 0x8
+	.long	0xa45
+	.uleb128 0x6
+	.long	0x6e3
+	.uleb128 0x6
+	.long	0x6b0
+	.uleb128 0x37
+	.long	.LASF154
+	.value	0x204
+	.long	0xa13
+	.uleb128 0x9
+	.long	.LASF155
+	.byte	0x16
+	.byte	0x5a
+	.byte	0xe
+	.long	0x3c
+	.long	0xa7f
+	.uleb128 0x2
+	.long	0xa7f
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x6
+	.long	0x6a4
+	.uleb128 0x1a
+	.long	.LASF156
+	.byte	0xd
+	.value	0x226
+	.byte	0xc
+	.long	0x69
+	.long	0xaa0
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x3d6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF157
+	.byte	0x1d
+	.byte	0x5a
+	.byte	0xe
+	.long	0xba
+	.long	0xac5
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x18a
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x3db
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF158
+	.byte	0xca
+	.long	.LASF157
+	.long	0xba
+	.long	0xaec
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x18a
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x3db
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF159
+	.byte	0xc6
+	.long	.LASF160
+	.long	0xba
+	.long	0xb0e
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x3db
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF161
+	.byte	0x17
+	.byte	0x37
+	.long	0xb1f
+	.uleb128 0x2
+	.long	0xa54
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF162
+	.byte	0x19
+	.byte	0x42
+	.long	0xb30
+	.uleb128 0x2
+	.long	0xa4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF163
+	.byte	0x1e
+	.byte	0x3f
+	.long	0xb50
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x619
+	.uleb128 0x2
+	.long	0x196
+	.uleb128 0x2
+	.long	0x623
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF164
+	.byte	0xd
+	.value	0x225
+	.byte	0xc
+	.long	0x69
+	.long	0xb6c
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x3d6
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF165
+	.byte	0x1f
+	.value	0x329
+	.byte	0xc
+	.long	0x69
+	.long	0xb83
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF166
+	.byte	0x17
+	.byte	0x32
+	.byte	0x9
+	.long	0x3b9
+	.long	0xb9e
+	.uleb128 0x2
+	.long	0xa54
+	.uleb128 0x2
+	.long	0xba3
+	.byte	0
+	.uleb128 0x6
+	.long	0x614
+	.uleb128 0x8
+	.long	0xb9e
+	.uleb128 0x9
+	.long	.LASF167
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x8
+	.long	0x18a
+	.long	0xbc3
+	.uleb128 0x2
+	.long	0xa4f
+	.uleb128 0x2
+	.long	0xba3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF168
+	.byte	0x18
+	.byte	0x68
+	.byte	0x9
+	.long	0x3b9
+	.long	0xbde
+	.uleb128 0x2
+	.long	0xa45
+	.uleb128 0x2
+	.long	0xba3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF169
+	.byte	0x18
+	.byte	0x8c
+	.byte	0x5
+	.long	0x538
+	.long	0xbf4
+	.uleb128 0x2
+	.long	0x9f8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF170
+	.byte	0x18
+	.byte	0x83
+	.long	0xc0f
+	.uleb128 0x2
+	.long	0x9f8
+	.uleb128 0x2
+	.long	0x619
+	.uleb128 0x2
+	.long	0x196
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF171
+	.byte	0x18
+	.byte	0x74
+	.byte	0x14
+	.long	0x9f8
+	.long	0xc25
+	.uleb128 0x2
+	.long	0x144
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF172
+	.byte	0x1a
+	.byte	0x50
+	.byte	0x5
+	.long	0x538
+	.long	0xc3b
+	.uleb128 0x2
+	.long	0x9f8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF173
+	.byte	0x1a
+	.byte	0x4a
+	.byte	0x14
+	.long	0x9f8
+	.long	0xc5b
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xc5b
+	.uleb128 0x2
+	.long	0xc65
+	.byte	0
+	.uleb128 0x6
+	.long	0xc4
+	.uleb128 0x6
+	.long	0x74d
+	.uleb128 0x8
+	.long	0xc60
+	.uleb128 0x1a
+	.long	.LASF174
+	.byte	0x20
+	.value	0x234
+	.byte	0xe
+	.long	0xac
+	.long	0xc86
+	.uleb128 0x2
+	.long	0xac
+	.uleb128 0x2
+	.long	0x18a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF175
+	.byte	0x6
+	.byte	0x42
+	.byte	0xc
+	.long	0x69
+	.long	0xcb0
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0xc5b
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0xcb0
+	.uleb128 0x2
+	.long	0x14e
+	.byte	0
+	.uleb128 0x6
+	.long	0x13a
+	.uleb128 0x9
+	.long	.LASF176
+	.byte	0x14
+	.byte	0x38
+	.byte	0xd
+	.long	0x13f
+	.long	0xcd5
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0xcda
+	.byte	0
+	.uleb128 0x6
+	.long	0x3c
+	.uleb128 0x8
+	.long	0xcd5
+	.uleb128 0x9
+	.long	.LASF177
+	.byte	0x16
+	.byte	0x4d
+	.byte	0xd
+	.long	0x13f
+	.long	0xcff
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0xcda
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF178
+	.byte	0x16
+	.byte	0x45
+	.byte	0xe
+	.long	0x3c
+	.long	0xd15
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF179
+	.byte	0x15
+	.byte	0x33
+	.long	0xd27
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF180
+	.byte	0x14
+	.byte	0x42
+	.byte	0xd
+	.long	0x13f
+	.long	0xd47
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0xcda
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF181
+	.byte	0x16
+	.byte	0x40
+	.byte	0xd
+	.long	0x13f
+	.long	0xd62
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0xcda
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF182
+	.byte	0x18
+	.byte	0x6d
+	.long	0xd73
+	.uleb128 0x2
+	.long	0xa45
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF183
+	.byte	0x1a
+	.byte	0x40
+	.byte	0xd
+	.long	0xa45
+	.long	0xd93
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xc5b
+	.uleb128 0x2
+	.long	0xd98
+	.byte	0
+	.uleb128 0x6
+	.long	0x741
+	.uleb128 0x8
+	.long	0xd93
+	.uleb128 0x9
+	.long	.LASF184
+	.byte	0x21
+	.byte	0x9f
+	.byte	0xc
+	.long	0x69
+	.long	0xdbd
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x2
+	.long	0x18a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF185
+	.byte	0x1e
+	.byte	0x35
+	.long	0xdce
+	.uleb128 0x2
+	.long	0x544
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF186
+	.byte	0xd
+	.value	0x28f
+	.byte	0xc
+	.long	0x69
+	.long	0xdea
+	.uleb128 0x2
+	.long	0x149
+	.uleb128 0x2
+	.long	0x3db
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF187
+	.byte	0xd
+	.byte	0xe6
+	.byte	0xc
+	.long	0x69
+	.long	0xe00
+	.uleb128 0x2
+	.long	0x3d6
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF188
+	.byte	0x21
+	.value	0x197
+	.byte	0xf
+	.long	0x18a
+	.long	0xe17
+	.uleb128 0x2
+	.long	0x13f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF189
+	.byte	0xd
+	.value	0x14c
+	.byte	0xc
+	.long	0x69
+	.long	0xe3d
+	.uleb128 0x2
+	.long	0x3db
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x18a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF190
+	.byte	0x8
+	.byte	0x58
+	.byte	0x17
+	.long	0x16e
+	.long	0xe58
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x16e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF191
+	.byte	0x15
+	.byte	0x43
+	.long	0xe6a
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF192
+	.byte	0x1b
+	.byte	0x35
+	.long	0xe8f
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2
+	.long	0x1d2
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF193
+	.byte	0x22
+	.byte	0x27
+	.long	0xea0
+	.uleb128 0x2
+	.long	0xea5
+	.byte	0
+	.uleb128 0x6
+	.long	0x3fd
+	.uleb128 0x8
+	.long	0xea0
+	.uleb128 0x2b
+	.long	.LASF198
+	.byte	0x22
+	.byte	0x24
+	.byte	0xe
+	.long	0x544
+	.uleb128 0x39
+	.long	.LASF194
+	.byte	0xd
+	.value	0x324
+	.long	0xec8
+	.uleb128 0x2
+	.long	0x13f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF195
+	.byte	0x23
+	.byte	0x29
+	.byte	0xe
+	.long	0x544
+	.long	0xee3
+	.uleb128 0x2
+	.long	0xee8
+	.uleb128 0x2
+	.long	0x196
+	.byte	0
+	.uleb128 0x6
+	.long	0x549
+	.uleb128 0x8
+	.long	0xee3
+	.uleb128 0xc
+	.long	.LASF196
+	.byte	0x1e
+	.byte	0x2f
+	.long	0xefe
+	.uleb128 0x2
+	.long	0x544
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF197
+	.byte	0x1e
+	.byte	0x21
+	.byte	0xe
+	.long	0x544
+	.long	0xf14
+	.uleb128 0x2
+	.long	0x144
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF199
+	.byte	0x1b
+	.byte	0x2d
+	.byte	0xa
+	.long	0x1c6
+	.uleb128 0x43
+	.long	.LASF259
+	.byte	0x1b
+	.byte	0x3c
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF200
+	.byte	0x20
+	.value	0x238
+	.long	0xf3a
+	.uleb128 0x2
+	.long	0xac
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF201
+	.byte	0x17
+	.byte	0x27
+	.byte	0xd
+	.long	0xa54
+	.long	0xf50
+	.uleb128 0x2
+	.long	0x144
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF202
+	.byte	0x19
+	.byte	0x31
+	.byte	0x10
+	.long	0xa4f
+	.long	0xf75
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF203
+	.byte	0x18
+	.byte	0x5b
+	.long	0xf8b
+	.uleb128 0x2
+	.long	0xa45
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF204
+	.byte	0x18
+	.byte	0x48
+	.byte	0xd
+	.long	0xa45
+	.long	0xfab
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF205
+	.byte	0x21
+	.value	0x1a3
+	.byte	0xe
+	.long	0xba
+	.long	0xfc2
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF206
+	.byte	0x24
+	.byte	0x25
+	.byte	0xd
+	.long	0x14e
+	.uleb128 0x9
+	.long	.LASF207
+	.byte	0x1b
+	.byte	0x28
+	.byte	0x5
+	.long	0x538
+	.long	0xfe4
+	.uleb128 0x2
+	.long	0x144
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF208
+	.byte	0x1e
+	.byte	0x1b
+	.long	0xff5
+	.uleb128 0x2
+	.long	0x544
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF209
+	.byte	0x16
+	.byte	0x53
+	.long	0x100b
+	.uleb128 0x2
+	.long	0xa7f
+	.uleb128 0x2
+	.long	0x43
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF210
+	.byte	0x20
+	.value	0x27d
+	.byte	0xd
+	.long	0x101e
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF211
+	.byte	0x15
+	.byte	0x2d
+	.long	0x1030
+	.uleb128 0x2
+	.long	0x144
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF212
+	.byte	0x25
+	.byte	0x20
+	.byte	0x1a
+	.long	0x48
+	.long	0x1046
+	.uleb128 0x2
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF213
+	.byte	0x15
+	.byte	0x8b
+	.long	0x105c
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xc5b
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF260
+	.byte	0x1
+	.value	0x2bc
+	.byte	0x5
+	.long	0x69
+	.quad	.LFB84
+	.quad	.LFE84-.LFB84
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x23cd
+	.uleb128 0x18
+	.long	.LASF214
+	.value	0x2bc
+	.byte	0x14
+	.long	0x70
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x18
+	.long	.LASF215
+	.value	0x2bc
+	.byte	0x26
+	.long	0xc5b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x17
+	.long	.LASF216
+	.value	0x2e1
+	.byte	0x18
+	.long	0x89e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4384
+	.uleb128 0xe
+	.long	.LASF151
+	.value	0x2e2
+	.byte	0x11
+	.long	0xa45
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xe
+	.long	.LASF152
+	.value	0x318
+	.byte	0x14
+	.long	0xa4f
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xe
+	.long	.LASF153
+	.value	0x324
+	.byte	0x11
+	.long	0xa54
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x17
+	.long	.LASF217
+	.value	0x333
+	.byte	0x13
+	.long	0xa59
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.uleb128 0xe
+	.long	.LASF218
+	.value	0x334
+	.byte	0xf
+	.long	0x53f
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xe
+	.long	.LASF219
+	.value	0x33e
+	.byte	0x12
+	.long	0x544
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xe
+	.long	.LASF220
+	.value	0x341
+	.byte	0x14
+	.long	0x1d2
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xe
+	.long	.LASF221
+	.value	0x386
+	.byte	0x9
+	.long	0x538
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x17
+	.long	.LASF222
+	.value	0x390
+	.byte	0x19
+	.long	0x9d7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batch.4
+	.uleb128 0x1c
+	.long	.LLRL34
+	.long	0x135f
+	.uleb128 0xe
+	.long	.LASF223
+	.value	0x337
+	.byte	0x13
+	.long	0x53f
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x46
+	.long	0x250a
+	.long	.LLRL36
+	.byte	0x1
+	.value	0x337
+	.byte	0x1f
+	.long	0x1344
+	.uleb128 0x25
+	.long	0x2526
+	.uleb128 0x25
+	.long	0x251a
+	.uleb128 0x1d
+	.long	.LLRL36
+	.uleb128 0xb
+	.long	0x2532
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1e
+	.long	0x253e
+	.long	.LLRL38
+	.long	0x11e9
+	.uleb128 0xb
+	.long	0x2543
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xa
+	.quad	.LVL184
+	.long	0x101e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x254e
+	.long	.LLRL40
+	.long	0x124e
+	.uleb128 0x1f
+	.long	0x2553
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.uleb128 0xb
+	.long	0x255f
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x5
+	.quad	.LVL192
+	.long	0xbf4
+	.uleb128 0x3
+	.quad	.LVL193
+	.long	0x2632
+	.long	0x1238
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL196
+	.long	0x25d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x256c
+	.long	.LLRL42
+	.long	0x12a9
+	.uleb128 0x1e
+	.long	0x2583
+	.long	.LLRL43
+	.long	0x128f
+	.uleb128 0xb
+	.long	0x2584
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xa
+	.quad	.LVL205
+	.long	0x2716
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL207
+	.long	0x281a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL187
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL188
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL189
+	.long	0x101e
+	.long	0x12e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL197
+	.long	0xbde
+	.uleb128 0x5
+	.quad	.LVL209
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL210
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL211
+	.long	0x101e
+	.long	0x1328
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL302
+	.long	0xc0f
+	.uleb128 0x5
+	.quad	.LVL305
+	.long	0xc0f
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL200
+	.long	0xf28
+	.uleb128 0x5
+	.quad	.LVL201
+	.long	0xf20
+	.byte	0
+	.uleb128 0x1c
+	.long	.LLRL66
+	.long	0x1470
+	.uleb128 0x17
+	.long	.LASF224
+	.value	0x343
+	.byte	0x16
+	.long	0x23cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0x1c
+	.long	.LLRL67
+	.long	0x1424
+	.uleb128 0x28
+	.string	"i"
+	.value	0x344
+	.byte	0x15
+	.long	0x18a
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x3a
+	.quad	.LBB124
+	.quad	.LBE124-.LBB124
+	.long	0x1416
+	.uleb128 0xe
+	.long	.LASF225
+	.value	0x347
+	.byte	0x1b
+	.long	0x70
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x5
+	.quad	.LVL236
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL237
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL238
+	.long	0x101e
+	.long	0x13f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL240
+	.long	0xeed
+	.uleb128 0xa
+	.quad	.LVL241
+	.long	0x100b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL218
+	.long	0xefe
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL242
+	.long	0xec8
+	.long	0x143d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL244
+	.long	0xeb6
+	.long	0x145c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL245
+	.long	0x100b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LLRL70
+	.long	0x1744
+	.uleb128 0x28
+	.string	"i"
+	.value	0x392
+	.byte	0x11
+	.long	0x18a
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x1d
+	.long	.LLRL72
+	.uleb128 0xe
+	.long	.LASF134
+	.value	0x393
+	.byte	0x23
+	.long	0x23e2
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1c
+	.long	.LLRL74
+	.long	0x1722
+	.uleb128 0x47
+	.string	"sin"
+	.byte	0x1
+	.value	0x3a5
+	.byte	0x12
+	.long	0x23e7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0x1c
+	.long	.LLRL75
+	.long	0x16c5
+	.uleb128 0xe
+	.long	.LASF226
+	.value	0x3a7
+	.byte	0x20
+	.long	0x1d2
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xe
+	.long	.LASF227
+	.value	0x3a8
+	.byte	0x1b
+	.long	0x53f
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x3a
+	.quad	.LBB132
+	.quad	.LBE132-.LBB132
+	.long	0x1599
+	.uleb128 0x28
+	.string	"ptr"
+	.value	0x3af
+	.byte	0x20
+	.long	0xba
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x20
+	.long	0x2b21
+	.quad	.LBI133
+	.value	.LVU753
+	.long	.LLRL82
+	.value	0x3b0
+	.byte	0x19
+	.long	0x154d
+	.uleb128 0x12
+	.long	0x2b32
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x5
+	.quad	.LVL294
+	.long	0xa84
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL295
+	.long	0xdea
+	.uleb128 0x3
+	.quad	.LVL296
+	.long	0x2716
+	.long	0x157e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL297
+	.long	0x281a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x2adf
+	.quad	.LBI130
+	.value	.LVU732
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.value	0x3a8
+	.byte	0x31
+	.long	0x1608
+	.uleb128 0x25
+	.long	0x2b08
+	.uleb128 0x12
+	.long	0x2afc
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x12
+	.long	0x2af0
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xb
+	.long	0x2b14
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0xa
+	.quad	.LVL287
+	.long	0xaec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL278
+	.long	0xf14
+	.uleb128 0x3
+	.quad	.LVL280
+	.long	0xe6a
+	.long	0x1654
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL281
+	.long	0xdce
+	.long	0x166d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL282
+	.long	0x2716
+	.long	0x1691
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL283
+	.long	0x281a
+	.long	0x16af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL289
+	.long	0xe00
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL271
+	.long	0xe17
+	.long	0x16e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL272
+	.long	0xe17
+	.long	0x1707
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL273
+	.long	0x281a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL277
+	.long	0x2716
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x26b1
+	.quad	.LBI70
+	.value	.LVU177
+	.long	.LLRL26
+	.value	0x2d9
+	.byte	0x9
+	.long	0x1800
+	.uleb128 0x1d
+	.long	.LLRL26
+	.uleb128 0x48
+	.long	0x26c1
+	.uleb128 0x2d
+	.long	0x26e4
+	.long	.LLRL26
+	.uleb128 0xb
+	.long	0x26e5
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x2e
+	.long	0x26f1
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.long	0x17d7
+	.uleb128 0xb
+	.long	0x26f2
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x3
+	.quad	.LVL99
+	.long	0xe00
+	.long	0x17bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL100
+	.long	0xd9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL97
+	.long	0xd9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x2402
+	.quad	.LBI76
+	.value	.LVU191
+	.long	.LLRL29
+	.value	0x2e4
+	.byte	0x11
+	.long	0x18b1
+	.uleb128 0x12
+	.long	0x241e
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x12
+	.long	0x2412
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1d
+	.long	.LLRL29
+	.uleb128 0x1f
+	.long	0x242a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0xb
+	.long	0x2436
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2e
+	.long	0x2442
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.long	0x1876
+	.uleb128 0xb
+	.long	0x2443
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL65
+	.long	0xd73
+	.long	0x189b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL103
+	.long	0xd62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x2899
+	.quad	.LBI99
+	.value	.LVU298
+	.long	.LLRL45
+	.value	0x2e7
+	.byte	0x9
+	.long	0x1cab
+	.uleb128 0x12
+	.long	0x28bf
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x12
+	.long	0x28b3
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x12
+	.long	0x28a7
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1d
+	.long	.LLRL45
+	.uleb128 0xb
+	.long	0x28cb
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xb
+	.long	0x28d7
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1e
+	.long	0x28f8
+	.long	.LLRL51
+	.long	0x1c35
+	.uleb128 0x1f
+	.long	0x28f9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.uleb128 0x1e
+	.long	0x2905
+	.long	.LLRL52
+	.long	0x19f2
+	.uleb128 0x1f
+	.long	0x2906
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.uleb128 0xb
+	.long	0x2912
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x3
+	.quad	.LVL111
+	.long	0xd47
+	.long	0x1963
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL112
+	.long	0x293b
+	.uleb128 0x3
+	.quad	.LVL114
+	.long	0xd15
+	.long	0x198f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL115
+	.long	0xcff
+	.uleb128 0x3
+	.quad	.LVL117
+	.long	0xd27
+	.long	0x19bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4e20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL118
+	.long	0x293b
+	.uleb128 0x5
+	.quad	.LVL119
+	.long	0x2971
+	.uleb128 0xa
+	.quad	.LVL300
+	.long	0xd15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x29d7
+	.quad	.LBI103
+	.value	.LVU438
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.value	0x18b
+	.byte	0xd
+	.long	0x1a26
+	.uleb128 0x5
+	.quad	.LVL144
+	.long	0xdce
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL120
+	.long	0xcdf
+	.long	0x1a48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL121
+	.long	0x293b
+	.uleb128 0x5
+	.quad	.LVL122
+	.long	0x2971
+	.uleb128 0x3
+	.quad	.LVL123
+	.long	0xcb5
+	.long	0x1a84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL124
+	.long	0x293b
+	.uleb128 0x5
+	.quad	.LVL125
+	.long	0x2971
+	.uleb128 0x3
+	.quad	.LVL126
+	.long	0xcdf
+	.long	0x1ac0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL127
+	.long	0x293b
+	.uleb128 0x5
+	.quad	.LVL128
+	.long	0x2971
+	.uleb128 0x3
+	.quad	.LVL129
+	.long	0xcdf
+	.long	0x1afc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL130
+	.long	0x293b
+	.uleb128 0x5
+	.quad	.LVL131
+	.long	0x2971
+	.uleb128 0x3
+	.quad	.LVL132
+	.long	0x2b3f
+	.long	0x1b40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	version_message
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xbc
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL133
+	.long	0x100b
+	.long	0x1b57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL135
+	.long	0x2a0d
+	.long	0x1b70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL138
+	.long	0x101e
+	.long	0x1b94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL139
+	.long	0x100b
+	.long	0x1bab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL140
+	.long	0xcb5
+	.long	0x1bcb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL141
+	.long	0x293b
+	.uleb128 0x3
+	.quad	.LVL142
+	.long	0x101e
+	.long	0x1c03
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL143
+	.long	0x2971
+	.uleb128 0x3
+	.quad	.LVL145
+	.long	0x100b
+	.long	0x1c27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL146
+	.long	0x2971
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL105
+	.long	0x2a0d
+	.long	0x1c4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL108
+	.long	0xc86
+	.long	0x1c7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL148
+	.long	0x101e
+	.long	0x1c9c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL149
+	.long	0x2971
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x24e1
+	.quad	.LBI109
+	.value	.LVU468
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.value	0x32f
+	.byte	0xc
+	.long	0x1d02
+	.uleb128 0x12
+	.long	0x24f1
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x49
+	.long	0x24fd
+	.quad	.LBB111
+	.quad	.LBE111-.LBB111
+	.uleb128 0xb
+	.long	0x24fe
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x244f
+	.quad	.LBI112
+	.value	.LVU794
+	.long	.LLRL56
+	.value	0x330
+	.byte	0x11
+	.long	0x1e5d
+	.uleb128 0x12
+	.long	0x2477
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x12
+	.long	0x246b
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x12
+	.long	0x245f
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1d
+	.long	.LLRL56
+	.uleb128 0x1f
+	.long	0x2483
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0xb
+	.long	0x24a5
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1e
+	.long	0x24b1
+	.long	.LLRL61
+	.long	0x1d90
+	.uleb128 0xb
+	.long	0x24b6
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x2d
+	.long	0x24c0
+	.long	.LLRL63
+	.uleb128 0xb
+	.long	0x24c1
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x24cf
+	.quad	.LBB117
+	.quad	.LBE117-.LBB117
+	.long	0x1de4
+	.uleb128 0xb
+	.long	0x24d0
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xa
+	.quad	.LVL175
+	.long	0x2716
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batch.1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x4c
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -4408
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL172
+	.long	0xc3b
+	.long	0x1e09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL177
+	.long	0x281a
+	.long	0x1e2d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batch.1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL178
+	.long	0xc25
+	.uleb128 0xa
+	.quad	.LVL182
+	.long	0xd73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x23f8
+	.quad	.LBI142
+	.value	.LVU665
+	.long	.LLRL84
+	.value	0x362
+	.byte	0x11
+	.long	0x1ea2
+	.uleb128 0x3
+	.quad	.LVL254
+	.long	0xb6c
+	.long	0x1e8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL256
+	.long	0xb50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.long	0x2596
+	.quad	.LBB146
+	.quad	.LBE146-.LBB146
+	.byte	0x1
+	.value	0x388
+	.byte	0x15
+	.long	0x1f24
+	.uleb128 0x25
+	.long	0x25b2
+	.uleb128 0x25
+	.long	0x25a6
+	.uleb128 0x2d
+	.long	0x25be
+	.long	.LLRL85
+	.uleb128 0x1f
+	.long	0x25bf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.uleb128 0xb
+	.long	0x25cb
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x3
+	.quad	.LVL263
+	.long	0x2632
+	.long	0x1f08
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4392
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL265
+	.long	0xb30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL59
+	.long	0x1046
+	.long	0x1f42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL60
+	.long	0x1030
+	.long	0x1f59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x47
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL71
+	.long	0xff5
+	.long	0x1f78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tone_tempo
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL72
+	.long	0xfe4
+	.uleb128 0x5
+	.quad	.LVL73
+	.long	0xfe4
+	.uleb128 0x5
+	.quad	.LVL74
+	.long	0xfe4
+	.uleb128 0x5
+	.quad	.LVL75
+	.long	0xfe4
+	.uleb128 0x5
+	.quad	.LVL76
+	.long	0xfe4
+	.uleb128 0x5
+	.quad	.LVL77
+	.long	0xfce
+	.uleb128 0x5
+	.quad	.LVL78
+	.long	0xf8b
+	.uleb128 0x3
+	.quad	.LVL80
+	.long	0xf75
+	.long	0x1feb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL81
+	.long	0xf50
+	.long	0x2003
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL84
+	.long	0xf3a
+	.long	0x201b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL93
+	.long	0x101e
+	.long	0x203a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL94
+	.long	0x101e
+	.long	0x2059
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL95
+	.long	0x100b
+	.long	0x2070
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL150
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL151
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL152
+	.long	0x101e
+	.long	0x20a9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL153
+	.long	0x100b
+	.long	0x20c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL154
+	.long	0x101e
+	.long	0x20df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL155
+	.long	0x100b
+	.long	0x20f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL156
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL157
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL158
+	.long	0x101e
+	.long	0x212f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL159
+	.long	0x100b
+	.long	0x2146
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL160
+	.long	0x100b
+	.long	0x215d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL161
+	.long	0xfc2
+	.uleb128 0x5
+	.quad	.LVL162
+	.long	0xfab
+	.uleb128 0x3
+	.quad	.LVL163
+	.long	0x101e
+	.long	0x2196
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL164
+	.long	0x100b
+	.long	0x21ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL222
+	.long	0xe3d
+	.long	0x21ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL223
+	.long	0xe3d
+	.long	0x21e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL228
+	.long	0x281a
+	.long	0x2205
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL229
+	.long	0xf28
+	.uleb128 0x3
+	.quad	.LVL230
+	.long	0xdbd
+	.long	0x222a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL231
+	.long	0xeed
+	.long	0x2242
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL232
+	.long	0xf20
+	.uleb128 0x5
+	.quad	.LVL234
+	.long	0xf14
+	.uleb128 0x5
+	.quad	.LVL246
+	.long	0xeaa
+	.uleb128 0x3
+	.quad	.LVL248
+	.long	0xefe
+	.long	0x2280
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL250
+	.long	0xe8f
+	.long	0x2298
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL253
+	.long	0x101e
+	.long	0x22b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL255
+	.long	0x100b
+	.long	0x22ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL258
+	.long	0xe6a
+	.long	0x230d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL259
+	.long	0xe58
+	.long	0x2332
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL260
+	.long	0xe58
+	.long	0x2351
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL269
+	.long	0x25d9
+	.long	0x236a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL312
+	.long	0x101e
+	.long	0x2389
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL313
+	.long	0x101e
+	.long	0x23a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL314
+	.long	0x100b
+	.long	0x23bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL315
+	.long	0x2b4a
+	.byte	0
+	.uleb128 0x11
+	.long	0x544
+	.long	0x23dd
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	0x7f7
+	.uleb128 0x8
+	.long	0x23dd
+	.uleb128 0x11
+	.long	0xc9
+	.long	0x23f8
+	.uleb128 0x4b
+	.long	0x48
+	.value	0xfff
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF251
+	.byte	0x1
+	.value	0x2b3
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x21
+	.long	.LASF229
+	.value	0x29c
+	.byte	0xd
+	.long	0xa45
+	.long	0x244f
+	.uleb128 0xf
+	.long	.LASF214
+	.value	0x29c
+	.byte	0x27
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF215
+	.value	0x29c
+	.byte	0x39
+	.long	0xc5b
+	.uleb128 0x10
+	.long	.LASF228
+	.value	0x29e
+	.byte	0x1c
+	.long	0x741
+	.uleb128 0x10
+	.long	.LASF151
+	.value	0x29f
+	.byte	0x17
+	.long	0xa4a
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"i"
+	.value	0x2a9
+	.byte	0x11
+	.long	0x18a
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF230
+	.value	0x27c
+	.byte	0xd
+	.long	0xa45
+	.long	0x24dc
+	.uleb128 0xf
+	.long	.LASF214
+	.value	0x27c
+	.byte	0x26
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF215
+	.value	0x27c
+	.byte	0x38
+	.long	0xc5b
+	.uleb128 0xf
+	.long	.LASF216
+	.value	0x27d
+	.byte	0x36
+	.long	0x24dc
+	.uleb128 0x10
+	.long	.LASF228
+	.value	0x27f
+	.byte	0x1c
+	.long	0x741
+	.uleb128 0x17
+	.long	.LASF222
+	.value	0x28d
+	.byte	0x19
+	.long	0x9d7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batch.1
+	.uleb128 0x10
+	.long	.LASF231
+	.value	0x294
+	.byte	0xf
+	.long	0x53f
+	.uleb128 0x2f
+	.long	0x24cf
+	.uleb128 0x19
+	.string	"i"
+	.value	0x282
+	.byte	0x11
+	.long	0x18a
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"arg"
+	.value	0x283
+	.byte	0x13
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"i"
+	.value	0x28f
+	.byte	0x11
+	.long	0x18a
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x8aa
+	.uleb128 0x21
+	.long	.LASF232
+	.value	0x269
+	.byte	0x5
+	.long	0x538
+	.long	0x250a
+	.uleb128 0xf
+	.long	.LASF216
+	.value	0x269
+	.byte	0x36
+	.long	0x24dc
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"i"
+	.value	0x26f
+	.byte	0x11
+	.long	0x18a
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF233
+	.value	0x239
+	.byte	0x5
+	.long	0x538
+	.long	0x2591
+	.uleb128 0xf
+	.long	.LASF217
+	.value	0x239
+	.byte	0x21
+	.long	0x2591
+	.uleb128 0xf
+	.long	.LASF216
+	.value	0x239
+	.byte	0x43
+	.long	0x24dc
+	.uleb128 0x10
+	.long	.LASF221
+	.value	0x249
+	.byte	0x9
+	.long	0x538
+	.uleb128 0x2f
+	.long	0x254e
+	.uleb128 0x19
+	.string	"i"
+	.value	0x23b
+	.byte	0x11
+	.long	0x18a
+	.byte	0
+	.uleb128 0x2f
+	.long	0x256c
+	.uleb128 0x10
+	.long	.LASF147
+	.value	0x24b
+	.byte	0x1a
+	.long	0x614
+	.uleb128 0x10
+	.long	.LASF132
+	.value	0x24c
+	.byte	0x11
+	.long	0x3b9
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.long	.LASF222
+	.value	0x253
+	.byte	0x1d
+	.long	0x9d7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batch.0
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"i"
+	.value	0x255
+	.byte	0x15
+	.long	0x18a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xa59
+	.uleb128 0x21
+	.long	.LASF234
+	.value	0x226
+	.byte	0x5
+	.long	0x538
+	.long	0x25d9
+	.uleb128 0xf
+	.long	.LASF219
+	.value	0x226
+	.byte	0x1e
+	.long	0x544
+	.uleb128 0xf
+	.long	.LASF217
+	.value	0x226
+	.byte	0x35
+	.long	0x2591
+	.uleb128 0x15
+	.uleb128 0x10
+	.long	.LASF147
+	.value	0x229
+	.byte	0x1a
+	.long	0x614
+	.uleb128 0x10
+	.long	.LASF132
+	.value	0x22a
+	.byte	0x17
+	.long	0x3c5
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF238
+	.value	0x218
+	.quad	.LFB77
+	.quad	.LFE77-.LFB77
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2632
+	.uleb128 0x18
+	.long	.LASF217
+	.value	0x218
+	.byte	0x27
+	.long	0x2591
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x5
+	.quad	.LVL33
+	.long	0xd62
+	.uleb128 0x5
+	.quad	.LVL36
+	.long	0xb1f
+	.uleb128 0x5
+	.quad	.LVL39
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF248
+	.byte	0x1
+	.value	0x20b
+	.byte	0x9
+	.long	0x3b9
+	.quad	.LFB76
+	.quad	.LFE76-.LFB76
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26b1
+	.uleb128 0x18
+	.long	.LASF217
+	.value	0x20b
+	.byte	0x29
+	.long	0x2591
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x18
+	.long	.LASF147
+	.value	0x20b
+	.byte	0x43
+	.long	0xb9e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x3
+	.quad	.LVL16
+	.long	0xba8
+	.long	0x2696
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL19
+	.long	0xbc3
+	.uleb128 0x5
+	.quad	.LVL22
+	.long	0xb83
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF235
+	.value	0x1e9
+	.byte	0x5
+	.long	0x538
+	.long	0x2701
+	.uleb128 0x4e
+	.long	.LASF236
+	.byte	0x1
+	.value	0x1eb
+	.byte	0x13
+	.long	0x3ec
+	.uleb128 0x17
+	.long	.LASF237
+	.value	0x1ec
+	.byte	0x1e
+	.long	0x2711
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sudo_vars.3
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"env"
+	.value	0x1ef
+	.byte	0x11
+	.long	0x3ec
+	.uleb128 0x15
+	.uleb128 0x19
+	.string	"var"
+	.value	0x1f3
+	.byte	0x21
+	.long	0x628
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x144
+	.long	0x2711
+	.uleb128 0x16
+	.long	0x48
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x2701
+	.uleb128 0x30
+	.long	.LASF239
+	.value	0x1c6
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x280b
+	.uleb128 0x18
+	.long	.LASF219
+	.value	0x1c6
+	.byte	0x1e
+	.long	0x544
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x18
+	.long	.LASF222
+	.value	0x1c6
+	.byte	0x34
+	.long	0x280b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x18
+	.long	.LASF134
+	.value	0x1c7
+	.byte	0x25
+	.long	0x23dd
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1c
+	.long	.LLRL13
+	.long	0x27ef
+	.uleb128 0x28
+	.string	"i"
+	.value	0x1d3
+	.byte	0x17
+	.long	0x3c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1d
+	.long	.LLRL15
+	.uleb128 0xe
+	.long	.LASF240
+	.value	0x1d4
+	.byte	0x1a
+	.long	0x2815
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.quad	.LVL51
+	.long	0xa64
+	.long	0x27bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0xa64
+	.long	0x27d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL57
+	.long	0x281a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL44
+	.long	0xe58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x9d7
+	.uleb128 0x6
+	.long	0x502
+	.uleb128 0x8
+	.long	0x2810
+	.uleb128 0x30
+	.long	.LASF241
+	.value	0x1b0
+	.quad	.LFB73
+	.quad	.LFE73-.LFB73
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2899
+	.uleb128 0x18
+	.long	.LASF219
+	.value	0x1b0
+	.byte	0x1f
+	.long	0x544
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x18
+	.long	.LASF222
+	.value	0x1b0
+	.byte	0x35
+	.long	0x280b
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x3
+	.quad	.LVL26
+	.long	0xbf4
+	.long	0x2877
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL29
+	.long	0xb30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	global_abort
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF261
+	.byte	0x1
+	.value	0x10a
+	.byte	0x6
+	.byte	0x1
+	.long	0x2921
+	.uleb128 0xf
+	.long	.LASF214
+	.value	0x10a
+	.byte	0x23
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF215
+	.value	0x10a
+	.byte	0x35
+	.long	0xc5b
+	.uleb128 0xf
+	.long	.LASF242
+	.value	0x10b
+	.byte	0x2d
+	.long	0x2921
+	.uleb128 0x10
+	.long	.LASF243
+	.value	0x10d
+	.byte	0x13
+	.long	0x894
+	.uleb128 0x19
+	.string	"ch"
+	.value	0x10e
+	.byte	0x9
+	.long	0x69
+	.uleb128 0x17
+	.long	.LASF244
+	.value	0x111
+	.byte	0x17
+	.long	0x2936
+	.uleb128 0x9
+	.byte	0x3
+	.quad	opt_list.2
+	.uleb128 0x15
+	.uleb128 0x10
+	.long	.LASF245
+	.value	0x124
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x15
+	.uleb128 0x10
+	.long	.LASF246
+	.value	0x129
+	.byte	0x1a
+	.long	0x3c
+	.uleb128 0x10
+	.long	.LASF247
+	.value	0x12a
+	.byte	0x17
+	.long	0x53f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x89e
+	.uleb128 0x11
+	.long	0x13a
+	.long	0x2936
+	.uleb128 0x16
+	.long	0x48
+	.byte	0xc
+	.byte	0
+	.uleb128 0x8
+	.long	0x2926
+	.uleb128 0x3b
+	.long	.LASF249
+	.byte	0xd5
+	.byte	0x5
+	.long	0x538
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2971
+	.uleb128 0x50
+	.string	"end"
+	.byte	0x1
+	.byte	0xd5
+	.byte	0x1f
+	.long	0x13f
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF250
+	.byte	0x1
+	.byte	0xc9
+	.byte	0x6
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29d7
+	.uleb128 0x52
+	.long	0x29d7
+	.quad	.LBI17
+	.value	.LVU21
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.byte	0x1
+	.byte	0xcb
+	.byte	0x5
+	.long	0x29c3
+	.uleb128 0x5
+	.quad	.LVL3
+	.long	0xdce
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL4
+	.long	0x100b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF252
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x54
+	.long	.LASF262
+	.byte	0x1
+	.byte	0xb5
+	.byte	0x6
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a0d
+	.uleb128 0x55
+	.long	.LASF263
+	.byte	0x1
+	.byte	0xb5
+	.byte	0x18
+	.long	0x69
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF253
+	.byte	0x84
+	.byte	0xf
+	.long	0x894
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2adf
+	.uleb128 0x56
+	.long	.LASF242
+	.byte	0x1
+	.byte	0x84
+	.byte	0x2d
+	.long	0x2921
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x31
+	.long	.LASF134
+	.byte	0x91
+	.byte	0x19
+	.long	0x899
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x57
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x31
+	.long	.LASF133
+	.byte	0x87
+	.byte	0x16
+	.long	0x196
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x31
+	.long	.LASF134
+	.byte	0x88
+	.byte	0x1d
+	.long	0x899
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x3
+	.quad	.LVL11
+	.long	0xc6a
+	.long	0x2aab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL12
+	.long	0xeb6
+	.long	0x2aca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL13
+	.long	0x100b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF160
+	.byte	0x2
+	.byte	0xd1
+	.byte	0x1
+	.long	0xba
+	.byte	0x3
+	.long	0x2b21
+	.uleb128 0x32
+	.string	"__s"
+	.byte	0x2
+	.byte	0xd1
+	.byte	0x19
+	.long	0xbf
+	.uleb128 0x32
+	.string	"__n"
+	.byte	0x2
+	.byte	0xd1
+	.byte	0x22
+	.long	0x69
+	.uleb128 0x59
+	.long	.LASF254
+	.byte	0x2
+	.byte	0xd1
+	.byte	0x38
+	.long	0x3db
+	.uleb128 0x5a
+	.long	.LASF255
+	.byte	0x2
+	.byte	0xd3
+	.byte	0xa
+	.long	0x18a
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF256
+	.byte	0x3
+	.byte	0x52
+	.byte	0x1
+	.long	0x69
+	.byte	0x3
+	.long	0x2b3f
+	.uleb128 0x32
+	.string	"__c"
+	.byte	0x3
+	.byte	0x52
+	.byte	0xe
+	.long	0x69
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF264
+	.long	.LASF265
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5d
+	.long	.LASF266
+	.long	.LASF266
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LFE84-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU553
+	.uleb128 .LVU553
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LFE84-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU188
+	.uleb128 .LVU215
+	.uleb128 .LVU238
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU276
+	.uleb128 .LVU293
+	.uleb128 .LVU296
+	.uleb128 .LVU459
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU471
+	.uleb128 .LVU523
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+	.uleb128 .LVU535
+	.uleb128 .LVU568
+	.uleb128 .LVU579
+	.uleb128 .LVU631
+	.uleb128 .LVU633
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU771
+	.uleb128 .LVU778
+	.uleb128 .LVU779
+	.uleb128 .LVU791
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL156-1-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU242
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU276
+	.uleb128 .LVU463
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU526
+	.uleb128 .LVU568
+	.uleb128 .LVU576
+	.uleb128 .LVU631
+	.uleb128 .LVU632
+	.uleb128 .LVU771
+	.uleb128 .LVU774
+	.uleb128 .LVU779
+	.uleb128 .LVU782
+	.uleb128 .LVU792
+	.uleb128 .LVU806
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU251
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU276
+	.uleb128 .LVU464
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU553
+	.uleb128 .LVU555
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU576
+	.uleb128 .LVU631
+	.uleb128 .LVU632
+	.uleb128 .LVU771
+	.uleb128 .LVU806
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4336
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4336
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU264
+	.uleb128 .LVU276
+	.uleb128 .LVU525
+	.uleb128 .LVU546
+	.uleb128 .LVU555
+	.uleb128 .LVU562
+	.uleb128 .LVU568
+	.uleb128 .LVU611
+	.uleb128 .LVU631
+	.uleb128 .LVU680
+	.uleb128 .LVU771
+	.uleb128 .LVU792
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU570
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU646
+	.uleb128 .LVU646
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU662
+	.uleb128 .LVU662
+	.uleb128 .LVU663
+	.uleb128 .LVU663
+	.uleb128 .LVU768
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL244-1-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL248-1-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU576
+	.uleb128 .LVU605
+	.uleb128 .LVU633
+	.uleb128 .LVU679
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU608
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU631
+	.uleb128 .LVU679
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU768
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4416
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4416
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU547
+	.uleb128 .LVU552
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU542
+	.uleb128 .LVU547
+	.uleb128 .LVU555
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU567
+	.uleb128 .LVU785
+	.uleb128 .LVU792
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+	.uleb128 .LVU525
+	.uleb128 .LVU526
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU536
+	.uleb128 .LVU537
+	.uleb128 .LVU539
+	.uleb128 .LVU543
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU562
+	.uleb128 .LVU790
+	.uleb128 .LVU792
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4424
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU580
+	.uleb128 .LVU591
+	.uleb128 .LVU633
+	.uleb128 .LVU646
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU635
+	.uleb128 .LVU636
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU616
+	.uleb128 .LVU621
+	.uleb128 .LVU697
+	.uleb128 .LVU768
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU697
+	.uleb128 .LVU708
+	.uleb128 .LVU711
+	.uleb128 .LVU768
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU715
+	.uleb128 .LVU729
+	.uleb128 .LVU731
+	.uleb128 .LVU768
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU715
+	.uleb128 .LVU727
+	.uleb128 .LVU739
+	.uleb128 .LVU745
+	.uleb128 .LVU745
+	.uleb128 .LVU749
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-1-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-1-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU746
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU768
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU753
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 .LVU757
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x9
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU732
+	.uleb128 .LVU739
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1000
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU732
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU738
+	.uleb128 .LVU738
+	.uleb128 .LVU739
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL287-1-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU734
+	.uleb128 .LVU739
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1000
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+	.uleb128 .LVU280
+	.uleb128 .LVU293
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU288
+	.uleb128 .LVU293
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU191
+	.uleb128 .LVU215
+	.uleb128 .LVU293
+	.uleb128 .LVU296
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU191
+	.uleb128 .LVU215
+	.uleb128 .LVU293
+	.uleb128 .LVU296
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU195
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+	.uleb128 .LVU293
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU296
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU392
+	.uleb128 .LVU392
+	.uleb128 .LVU452
+	.uleb128 .LVU768
+	.uleb128 .LVU771
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU298
+	.uleb128 .LVU452
+	.uleb128 .LVU768
+	.uleb128 .LVU771
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU298
+	.uleb128 .LVU452
+	.uleb128 .LVU768
+	.uleb128 .LVU771
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU303
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU452
+	.uleb128 .LVU768
+	.uleb128 .LVU771
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU311
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU442
+	.uleb128 .LVU450
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 66
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU321
+	.uleb128 .LVU326
+	.uleb128 .LVU332
+	.uleb128 .LVU333
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU468
+	.uleb128 .LVU485
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU479
+	.uleb128 .LVU485
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU485
+	.uleb128 .LVU523
+	.uleb128 .LVU794
+	.uleb128 .LVU806
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4384
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU485
+	.uleb128 .LVU523
+	.uleb128 .LVU794
+	.uleb128 .LVU806
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU485
+	.uleb128 .LVU523
+	.uleb128 .LVU794
+	.uleb128 .LVU806
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU516
+	.uleb128 .LVU520
+	.uleb128 .LVU520
+	.uleb128 .LVU522
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU485
+	.uleb128 .LVU498
+	.uleb128 .LVU802
+	.uleb128 .LVU806
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU495
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU523
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+	.uleb128 .LVU689
+	.uleb128 .LVU691
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE77-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU134
+	.uleb128 .LVU139
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xb
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x6
+	.byte	0x34
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE73-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU34
+	.uleb128 .LVU51
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU55
+	.uleb128 .LVU62
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF114:
+	.string	"device_count"
+.LASF101:
+	.string	"trace_driver"
+.LASF254:
+	.string	"__stream"
+.LASF203:
+	.string	"beep_score_set_bpm"
+.LASF138:
+	.string	"param_device_names"
+.LASF109:
+	.string	"_beep_score"
+.LASF240:
+	.string	"tone"
+.LASF168:
+	.string	"beep_score_next"
+.LASF24:
+	.string	"size_t"
+.LASF160:
+	.string	"fgets"
+.LASF14:
+	.string	"__ssize_t"
+.LASF63:
+	.string	"_IO_codecvt"
+.LASF233:
+	.string	"export_score"
+.LASF143:
+	.string	"param_export_name"
+.LASF161:
+	.string	"beep_rtttl_close"
+.LASF43:
+	.string	"_IO_save_end"
+.LASF91:
+	.string	"beep_driver_init_func"
+.LASF129:
+	.string	"reps"
+.LASF139:
+	.string	"param_device_args"
+.LASF153:
+	.string	"rtttl"
+.LASF36:
+	.string	"_IO_write_base"
+.LASF75:
+	.string	"end_tone"
+.LASF156:
+	.string	"putc"
+.LASF52:
+	.string	"_lock"
+.LASF162:
+	.string	"beep_sequence_free"
+.LASF228:
+	.string	"settings"
+.LASF255:
+	.string	"__sz"
+.LASF176:
+	.string	"parse_uint_value"
+.LASF41:
+	.string	"_IO_save_base"
+.LASF218:
+	.string	"have_source"
+.LASF103:
+	.string	"log_level"
+.LASF98:
+	.string	"evdev_driver"
+.LASF85:
+	.string	"delay"
+.LASF204:
+	.string	"beep_score_open"
+.LASF225:
+	.string	"saved_errno"
+.LASF45:
+	.string	"_chain"
+.LASF65:
+	.string	"ssize_t"
+.LASF99:
+	.string	"pcm_driver"
+.LASF49:
+	.string	"_cur_column"
+.LASF115:
+	.string	"device_arg"
+.LASF243:
+	.string	"result"
+.LASF167:
+	.string	"beep_sequence_next"
+.LASF250:
+	.string	"usage_bail"
+.LASF199:
+	.string	"beep_timeline_now"
+.LASF22:
+	.string	"sig_atomic_t"
+.LASF136:
+	.string	"version_message"
+.LASF10:
+	.string	"long int"
+.LASF213:
+	.string	"log_init"
+.LASF235:
+	.string	"running_under_sudo"
+.LASF20:
+	.string	"has_arg"
+.LASF124:
+	.string	"STDIN_BEEP_LINE"
+.LASF62:
+	.string	"_IO_marker"
+.LASF260:
+	.string	"main"
+.LASF119:
+	.string	"beep_usage"
+.LASF223:
+	.string	"export_ok"
+.LASF6:
+	.string	"signed char"
+.LASF31:
+	.string	"_IO_FILE"
+.LASF64:
+	.string	"_IO_wide_data"
+.LASF185:
+	.string	"beep_drivers_end_tone"
+.LASF236:
+	.string	"environ"
+.LASF2:
+	.string	"unsigned char"
+.LASF56:
+	.string	"_freeres_list"
+.LASF195:
+	.string	"fanout_driver_new"
+.LASF174:
+	.string	"realloc"
+.LASF151:
+	.string	"score"
+.LASF244:
+	.string	"opt_list"
+.LASF89:
+	.string	"_Bool"
+.LASF137:
+	.string	"global_abort"
+.LASF86:
+	.string	"flags"
+.LASF15:
+	.string	"char"
+.LASF238:
+	.string	"tone_source_close"
+.LASF220:
+	.string	"detect_ns"
+.LASF211:
+	.string	"log_error"
+.LASF196:
+	.string	"beep_drivers_fini"
+.LASF133:
+	.string	"capacity"
+.LASF258:
+	.string	"_IO_lock_t"
+.LASF8:
+	.string	"__uint16_t"
+.LASF190:
+	.string	"signal"
+.LASF206:
+	.string	"__errno_location"
+.LASF217:
+	.string	"source"
+.LASF227:
+	.string	"have_input"
+.LASF77:
+	.string	"play_sequence"
+.LASF33:
+	.string	"_IO_read_ptr"
+.LASF155:
+	.string	"beep_tempo_ms"
+.LASF224:
+	.string	"devices"
+.LASF191:
+	.string	"log_verbose"
+.LASF66:
+	.string	"stdin"
+.LASF216:
+	.string	"parms_array"
+.LASF248:
+	.string	"tone_source_next"
+.LASF44:
+	.string	"_markers"
+.LASF177:
+	.string	"parse_duration_value"
+.LASF242:
+	.string	"array"
+.LASF81:
+	.string	"device_name"
+.LASF259:
+	.string	"beep_timeline_close"
+.LASF241:
+	.string	"flush_tones"
+.LASF170:
+	.string	"beep_score_write"
+.LASF263:
+	.string	"unused_signum"
+.LASF53:
+	.string	"_offset"
+.LASF123:
+	.string	"STDIN_BEEP_NONE"
+.LASF121:
+	.string	"END_DELAY_YES"
+.LASF221:
+	.string	"source_ok"
+.LASF18:
+	.string	"optind"
+.LASF106:
+	.string	"beep_rtttl"
+.LASF265:
+	.string	"__builtin_fwrite"
+.LASF73:
+	.string	"fini"
+.LASF11:
+	.string	"__uint64_t"
+.LASF5:
+	.string	"long unsigned int"
+.LASF165:
+	.string	"isatty"
+.LASF47:
+	.string	"_flags2"
+.LASF35:
+	.string	"_IO_read_base"
+.LASF30:
+	.string	"option"
+.LASF78:
+	.string	"probe"
+.LASF60:
+	.string	"_unused2"
+.LASF214:
+	.string	"argc"
+.LASF48:
+	.string	"_old_offset"
+.LASF159:
+	.string	"__fgets_alias"
+.LASF215:
+	.string	"argv"
+.LASF208:
+	.string	"beep_drivers_register"
+.LASF144:
+	.string	"param_sequence_source"
+.LASF9:
+	.string	"__uint32_t"
+.LASF266:
+	.string	"__stack_chk_fail"
+.LASF158:
+	.string	"__fgets_chk_warn"
+.LASF25:
+	.string	"long long int"
+.LASF183:
+	.string	"beep_sequence_cache_open"
+.LASF145:
+	.string	"param_rtttl_name"
+.LASF166:
+	.string	"beep_rtttl_next"
+.LASF249:
+	.string	"is_end_of_arg"
+.LASF239:
+	.string	"queue_beep"
+.LASF38:
+	.string	"_IO_write_end"
+.LASF110:
+	.string	"beep_score_writer"
+.LASF147:
+	.string	"tones"
+.LASF100:
+	.string	"pwm_driver"
+.LASF205:
+	.string	"strerror"
+.LASF76:
+	.string	"wait"
+.LASF257:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF95:
+	.string	"beep_driver_wait_func"
+.LASF132:
+	.string	"count"
+.LASF122:
+	.string	"end_delay_E"
+.LASF226:
+	.string	"read_ns"
+.LASF39:
+	.string	"_IO_buf_base"
+.LASF262:
+	.string	"handle_signal"
+.LASF231:
+	.string	"stored"
+.LASF4:
+	.string	"unsigned int"
+.LASF194:
+	.string	"perror"
+.LASF118:
+	.string	"timeline_enabled"
+.LASF58:
+	.string	"__pad5"
+.LASF189:
+	.string	"setvbuf"
+.LASF108:
+	.string	"beep_score"
+.LASF212:
+	.string	"getauxval"
+.LASF21:
+	.string	"flag"
+.LASF237:
+	.string	"sudo_vars"
+.LASF74:
+	.string	"begin_tone"
+.LASF169:
+	.string	"beep_score_finish"
+.LASF152:
+	.string	"sequence"
+.LASF157:
+	.string	"__fgets_chk"
+.LASF32:
+	.string	"_flags"
+.LASF201:
+	.string	"beep_rtttl_open"
+.LASF59:
+	.string	"_mode"
+.LASF261:
+	.string	"parse_command_line"
+.LASF54:
+	.string	"_codecvt"
+.LASF80:
+	.string	"device_fd"
+.LASF117:
+	.string	"beep_sequence_settings"
+.LASF245:
+	.string	"argval_u"
+.LASF112:
+	.string	"beep_sequence"
+.LASF184:
+	.string	"strncmp"
+.LASF193:
+	.string	"beep_device_cache_store"
+.LASF102:
+	.string	"syscall_count"
+.LASF61:
+	.string	"FILE"
+.LASF87:
+	.string	"beep_tone"
+.LASF154:
+	.string	"tone_source_T"
+.LASF135:
+	.string	"beep_parms_array_T"
+.LASF182:
+	.string	"beep_score_close"
+.LASF178:
+	.string	"beep_note_freq_hz"
+.LASF26:
+	.string	"long long unsigned int"
+.LASF140:
+	.string	"param_device_count"
+.LASF96:
+	.string	"beep_driver_play_sequence_func"
+.LASF111:
+	.string	"_beep_score_writer"
+.LASF84:
+	.string	"length"
+.LASF27:
+	.string	"uint16_t"
+.LASF12:
+	.string	"__off_t"
+.LASF126:
+	.string	"stdin_beep_E"
+.LASF92:
+	.string	"beep_driver_fini_func"
+.LASF127:
+	.string	"beep_parms_T"
+.LASF173:
+	.string	"beep_sequence_cache_create"
+.LASF234:
+	.string	"play_source"
+.LASF149:
+	.string	"export_writer"
+.LASF57:
+	.string	"_freeres_buf"
+.LASF113:
+	.string	"_beep_sequence"
+.LASF116:
+	.string	"device_offset"
+.LASF90:
+	.string	"beep_driver_probe_func"
+.LASF251:
+	.string	"fallback_beep"
+.LASF16:
+	.string	"__sig_atomic_t"
+.LASF181:
+	.string	"parse_note_value"
+.LASF42:
+	.string	"_IO_backup_base"
+.LASF51:
+	.string	"_shortbuf"
+.LASF222:
+	.string	"batch"
+.LASF94:
+	.string	"beep_driver_end_tone_func"
+.LASF13:
+	.string	"__off64_t"
+.LASF72:
+	.string	"init"
+.LASF230:
+	.string	"cache_sequence"
+.LASF164:
+	.string	"fputc"
+.LASF68:
+	.string	"beep_driver"
+.LASF186:
+	.string	"fputs"
+.LASF40:
+	.string	"_IO_buf_end"
+.LASF150:
+	.string	"tone_tempo"
+.LASF252:
+	.string	"print_usage"
+.LASF253:
+	.string	"new_parms"
+.LASF247:
+	.string	"is_note"
+.LASF219:
+	.string	"driver"
+.LASF19:
+	.string	"name"
+.LASF79:
+	.string	"default_devices"
+.LASF7:
+	.string	"short int"
+.LASF29:
+	.string	"uint64_t"
+.LASF192:
+	.string	"beep_timeline_span"
+.LASF134:
+	.string	"parms"
+.LASF107:
+	.string	"_beep_rtttl"
+.LASF202:
+	.string	"beep_sequence_compile"
+.LASF50:
+	.string	"_vtable_offset"
+.LASF198:
+	.string	"beep_device_cache_detect"
+.LASF23:
+	.string	"__sighandler_t"
+.LASF246:
+	.string	"note"
+.LASF180:
+	.string	"parse_rounded_value"
+.LASF256:
+	.string	"putchar"
+.LASF232:
+	.string	"cacheable_command_line"
+.LASF97:
+	.string	"console_driver"
+.LASF130:
+	.string	"end_delay"
+.LASF188:
+	.string	"strlen"
+.LASF229:
+	.string	"cached_sequence"
+.LASF71:
+	.string	"detect"
+.LASF163:
+	.string	"beep_drivers_play_sequence"
+.LASF34:
+	.string	"_IO_read_end"
+.LASF131:
+	.string	"stdin_beep"
+.LASF171:
+	.string	"beep_score_create"
+.LASF172:
+	.string	"beep_sequence_cache_commit"
+.LASF28:
+	.string	"uint32_t"
+.LASF175:
+	.string	"getopt_long"
+.LASF46:
+	.string	"_fileno"
+.LASF55:
+	.string	"_wide_data"
+.LASF120:
+	.string	"END_DELAY_NO"
+.LASF17:
+	.string	"optarg"
+.LASF128:
+	.string	"_beep_parms_T"
+.LASF200:
+	.string	"free"
+.LASF146:
+	.string	"param_bpm"
+.LASF83:
+	.string	"freq"
+.LASF3:
+	.string	"short unsigned int"
+.LASF67:
+	.string	"stdout"
+.LASF93:
+	.string	"beep_driver_begin_tone_func"
+.LASF207:
+	.string	"beep_timeline_open"
+.LASF37:
+	.string	"_IO_write_ptr"
+.LASF141:
+	.string	"param_timeline_name"
+.LASF179:
+	.string	"log_warning"
+.LASF210:
+	.string	"exit"
+.LASF88:
+	.string	"beep_driver_detect_func"
+.LASF197:
+	.string	"beep_drivers_detect"
+.LASF105:
+	.string	"beep_tempo"
+.LASF209:
+	.string	"beep_tempo_init"
+.LASF70:
+	.string	"next"
+.LASF69:
+	.string	"_beep_driver"
+.LASF148:
+	.string	"tone_batch_T"
+.LASF104:
+	.string	"remainder"
+.LASF187:
+	.string	"fflush"
+.LASF82:
+	.string	"driver_data"
+.LASF264:
+	.string	"fwrite"
+.LASF142:
+	.string	"param_score_name"
+.LASF125:
+	.string	"STDIN_BEEP_CHAR"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-main.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,285 @@
+/* beep-note-table.h - frequencies and console divisors of the MIDI notes
+ *
+ * Generated by "gen-freq-table --c-header" (make update-note-table).
+ * Do not edit.
+ */
+
+
+#ifndef BEEP_NOTE_TABLE_H
+#define BEEP_NOTE_TABLE_H
+
+
+#include <stdint.h>
+
+
+/* Equal temperament with A4 (MIDI note 69) at 440 Hz, rounded to Hz */
+static const uint16_t beep_note_freq[128] =
+    {
+         8, /*   0 C-1      8.176 Hz */
+         9, /*   1 C#-1     8.662 Hz */
+         9, /*   2 D-1      9.177 Hz */
+        10, /*   3 D#-1     9.723 Hz */
+        10, /*   4 E-1     10.301 Hz */
+        11, /*   5 F-1     10.913 Hz */
+        12, /*   6 F#-1    11.562 Hz */
+        12, /*   7 G-1     12.250 Hz */
+        13, /*   8 G#-1    12.978 Hz */
+        14, /*   9 A-1     13.750 Hz */
+        15, /*  10 A#-1    14.568 Hz */
+        15, /*  11 B-1     15.434 Hz */
+        16, /*  12 C0      16.352 Hz */
+        17, /*  13 C#0     17.324 Hz */
+        18, /*  14 D0      18.354 Hz */
+        19, /*  15 D#0     19.445 Hz */
+        21, /*  16 E0      20.602 Hz */
+        22, /*  17 F0      21.827 Hz */
+        23, /*  18 F#0     23.125 Hz */
+        24, /*  19 G0      24.500 Hz */
+        26, /*  20 G#0     25.957 Hz */
+        28, /*  21 A0      27.500 Hz */
+        29, /*  22 A#0     29.135 Hz */
+        31, /*  23 B0      30.868 Hz */
+        33, /*  24 C1      32.703 Hz */
+        35, /*  25 C#1     34.648 Hz */
+        37, /*  26 D1      36.708 Hz */
+        39, /*  27 D#1     38.891 Hz */
+        41, /*  28 E1      41.203 Hz */
+        44, /*  29 F1      43.654 Hz */
+        46, /*  30 F#1     46.249 Hz */
+        49, /*  31 G1      48.999 Hz */
+        52, /*  32 G#1     51.913 Hz */
+        55, /*  33 A1      55.000 Hz */
+        58, /*  34 A#1     58.270 Hz */
+        62, /*  35 B1      61.735 Hz */
+        65, /*  36 C2      65.406 Hz */
+        69, /*  37 C#2     69.296 Hz */
+        73, /*  38 D2      73.416 Hz */
+        78, /*  39 D#2     77.782 Hz */
+        82, /*  40 E2      82.407 Hz */
+        87, /*  41 F2      87.307 Hz */
+        92, /*  42 F#2     92.499 Hz */
+        98, /*  43 G2      97.999 Hz */
+       104, /*  44 G#2    103.826 Hz */
+       110, /*  45 A2     110.000 Hz */
+       117, /*  46 A#2    116.541 Hz */
+       123, /*  47 B2     123.471 Hz */
+       131, /*  48 C3     130.813 Hz */
+       139, /*  49 C#3    138.591 Hz */
+       147, /*  50 D3     146.832 Hz */
+       156, /*  51 D#3    155.563 Hz */
+       165, /*  52 E3     164.814 Hz */
+       175, /*  53 F3     174.614 Hz */
+       185, /*  54 F#3    184.997 Hz */
+       196, /*  55 G3     195.998 Hz */
+       208, /*  56 G#3    207.652 Hz */
+       220, /*  57 A3     220.000 Hz */
+       233, /*  58 A#3    233.082 Hz */
+       247, /*  59 B3     246.942 Hz */
+       262, /*  60 C4     261.626 Hz */
+       277, /*  61 C#4    277.183 Hz */
+       294, /*  62 D4     293.665 Hz */
+       311, /*  63 D#4    311.127 Hz */
+       330, /*  64 E4     329.628 Hz */
+       349, /*  65 F4     349.228 Hz */
+       370, /*  66 F#4    369.994 Hz */
+       392, /*  67 G4     391.995 Hz */
+       415, /*  68 G#4    415.305 Hz */
+       440, /*  69 A4     440.000 Hz */
+       466, /*  70 A#4    466.164 Hz */
+       494, /*  71 B4     493.883 Hz */
+       523, /*  72 C5     523.251 Hz */
+       554, /*  73 C#5    554.365 Hz */
+       587, /*  74 D5     587.330 Hz */
+       622, /*  75 D#5    622.254 Hz */
+       659, /*  76 E5     659.255 Hz */
+       698, /*  77 F5     698.456 Hz */
+       740, /*  78 F#5    739.989 Hz */
+       784, /*  79 G5     783.991 Hz */
+       831, /*  80 G#5    830.609 Hz */
+       880, /*  81 A5     880.000 Hz */
+       932, /*  82 A#5    932.328 Hz */
+       988, /*  83 B5     987.767 Hz */
+      1047, /*  84 C6    1046.502 Hz */
+      1109, /*  85 C#6   1108.731 Hz */
+      1175, /*  86 D6    1174.659 Hz */
+      1245, /*  87 D#6   1244.508 Hz */
+      1319, /*  88 E6    1318.510 Hz */
+      1397, /*  89 F6    1396.913 Hz */
+      1480, /*  90 F#6   1479.978 Hz */
+      1568, /*  91 G6    1567.982 Hz */
+      1661, /*  92 G#6   1661.219 Hz */
+      1760, /*  93 A6    1760.000 Hz */
+      1865, /*  94 A#6   1864.655 Hz */
+      1976, /*  95 B6    1975.533 Hz */
+      2093, /*  96 C7    2093.005 Hz */
+      2217, /*  97 C#7   2217.461 Hz */
+      2349, /*  98 D7    2349.318 Hz */
+      2489, /*  99 D#7   2489.016 Hz */
+      2637, /* 100 E7    2637.020 Hz */
+      2794, /* 101 F7    2793.826 Hz */
+      2960, /* 102 F#7   2959.955 Hz */
+      3136, /* 103 G7    3135.963 Hz */
+      3322, /* 104 G#7   3322.438 Hz */
+      3520, /* 105 A7    3520.000 Hz */
+      3729, /* 106 A#7   3729.310 Hz */
+      3951, /* 107 B7    3951.066 Hz */
+      4186, /* 108 C8    4186.009 Hz */
+      4435, /* 109 C#8   4434.922 Hz */
+      4699, /* 110 D8    4698.636 Hz */
+      4978, /* 111 D#8   4978.032 Hz */
+      5274, /* 112 E8    5274.041 Hz */
+      5588, /* 113 F8    5587.652 Hz */
+      5920, /* 114 F#8   5919.911 Hz */
+      6272, /* 115 G8    6271.927 Hz */
+      6645, /* 116 G#8   6644.875 Hz */
+      7040, /* 117 A8    7040.000 Hz */
+      7459, /* 118 A#8   7458.620 Hz */
+      7902, /* 119 B8    7902.133 Hz */
+      8372, /* 120 C9    8372.018 Hz */
+      8870, /* 121 C#9   8869.844 Hz */
+      9397, /* 122 D9    9397.273 Hz */
+      9956, /* 123 D#9   9956.063 Hz */
+     10548, /* 124 E9   10548.082 Hz */
+     11175, /* 125 F9   11175.303 Hz */
+     11840, /* 126 F#9  11839.822 Hz */
+     12544, /* 127 G9   12543.854 Hz */
+    };
+
+
+/* PIT counts for KIOCSOUND and KDMKTONE from the exact frequencies,
+ * limited to the 16 bits these ioctls take, i.e. at least 18.2 Hz
+ */
+static const uint16_t beep_note_console_divisor[128] =
+    {
+     65535, /*   0 C-1 */
+     65535, /*   1 C#-1 */
+     65535, /*   2 D-1 */
+     65535, /*   3 D#-1 */
+     65535, /*   4 E-1 */
+     65535, /*   5 F-1 */
+     65535, /*   6 F#-1 */
+     65535, /*   7 G-1 */
+     65535, /*   8 G#-1 */
+     65535, /*   9 A-1 */
+     65535, /*  10 A#-1 */
+     65535, /*  11 B-1 */
+     65535, /*  12 C0 */
+     65535, /*  13 C#0 */
+     65009, /*  14 D0 */
+     61361, /*  15 D#0 */
+     57917, /*  16 E0 */
+     54666, /*  17 F0 */
+     51598, /*  18 F#0 */
+     48702, /*  19 G0 */
+     45968, /*  20 G#0 */
+     43388, /*  21 A0 */
+     40953, /*  22 A#0 */
+     38655, /*  23 B0 */
+     36485, /*  24 C1 */
+     34437, /*  25 C#1 */
+     32505, /*  26 D1 */
+     30680, /*  27 D#1 */
+     28958, /*  28 E1 */
+     27333, /*  29 F1 */
+     25799, /*  30 F#1 */
+     24351, /*  31 G1 */
+     22984, /*  32 G#1 */
+     21694, /*  33 A1 */
+     20477, /*  34 A#1 */
+     19327, /*  35 B1 */
+     18243, /*  36 C2 */
+     17219, /*  37 C#2 */
+     16252, /*  38 D2 */
+     15340, /*  39 D#2 */
+     14479, /*  40 E2 */
+     13667, /*  41 F2 */
+     12899, /*  42 F#2 */
+     12175, /*  43 G2 */
+     11492, /*  44 G#2 */
+     10847, /*  45 A2 */
+     10238, /*  46 A#2 */
+      9664, /*  47 B2 */
+      9121, /*  48 C3 */
+      8609, /*  49 C#3 */
+      8126, /*  50 D3 */
+      7670, /*  51 D#3 */
+      7240, /*  52 E3 */
+      6833, /*  53 F3 */
+      6450, /*  54 F#3 */
+      6088, /*  55 G3 */
+      5746, /*  56 G#3 */
+      5424, /*  57 A3 */
+      5119, /*  58 A#3 */
+      4832, /*  59 B3 */
+      4561, /*  60 C4 */
+      4305, /*  61 C#4 */
+      4063, /*  62 D4 */
+      3835, /*  63 D#4 */
+      3620, /*  64 E4 */
+      3417, /*  65 F4 */
+      3225, /*  66 F#4 */
+      3044, /*  67 G4 */
+      2873, /*  68 G#4 */
+      2712, /*  69 A4 */
+      2560, /*  70 A#4 */
+      2416, /*  71 B4 */
+      2280, /*  72 C5 */
+      2152, /*  73 C#5 */
+      2032, /*  74 D5 */
+      1918, /*  75 D#5 */
+      1810, /*  76 E5 */
+      1708, /*  77 F5 */
+      1612, /*  78 F#5 */
+      1522, /*  79 G5 */
+      1437, /*  80 G#5 */
+      1356, /*  81 A5 */
+      1280, /*  82 A#5 */
+      1208, /*  83 B5 */
+      1140, /*  84 C6 */
+      1076, /*  85 C#6 */
+      1016, /*  86 D6 */
+       959, /*  87 D#6 */
+       905, /*  88 E6 */
+       854, /*  89 F6 */
+       806, /*  90 F#6 */
+       761, /*  91 G6 */
+       718, /*  92 G#6 */
+       678, /*  93 A6 */
+       640, /*  94 A#6 */
+       604, /*  95 B6 */
+       570, /*  96 C7 */
+       538, /*  97 C#7 */
+       508, /*  98 D7 */
+       479, /*  99 D#7 */
+       452, /* 100 E7 */
+       427, /* 101 F7 */
+       403, /* 102 F#7 */
+       380, /* 103 G7 */
+       359, /* 104 G#7 */
+       339, /* 105 A7 */
+       320, /* 106 A#7 */
+       302, /* 107 B7 */
+       285, /* 108 C8 */
+       269, /* 109 C#8 */
+       254, /* 110 D8 */
+       240, /* 111 D#8 */
+       226, /* 112 E8 */
+       214, /* 113 F8 */
+       202, /* 114 F#8 */
+       190, /* 115 G8 */
+       180, /* 116 G#8 */
+       169, /* 117 A8 */
+       160, /* 118 A#8 */
+       151, /* 119 B8 */
+       143, /* 120 C9 */
+       135, /* 121 C#9 */
+       127, /* 122 D9 */
+       120, /* 123 D#9 */
+       113, /* 124 E9 */
+       107, /* 125 F9 */
+       101, /* 126 F#9 */
+        95, /* 127 G9 */
+    };
+
+
+#endif /* BEEP_NOTE_TABLE_H */
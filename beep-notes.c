@@ -0,0 +1,145 @@
+/* beep-notes.c - note names and tempo based durations
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* The frequencies come from beep-note-table.h, which gen-freq-table
+ * generates, so there is no floating point math at run time.
+ * Durations in beats are kept in integer ticks until they are played.
+ */
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "beep-library.h"
+#include "beep-note-table.h"
+#include "beep-notes.h"
+
+
+const char *parse_note_value(const char *str, unsigned int *const note)
+{
+    /* semitones above C of the notes A to G */
+    static const int letter_semitones[7] = { 9, 11, 0, 2, 4, 5, 7 };
+
+    int semitone;
+    if ((*str >= 'A') && (*str <= 'G')) {
+        semitone = letter_semitones[*str - 'A'];
+    } else if ((*str >= 'a') && (*str <= 'g')) {
+        semitone = letter_semitones[*str - 'a'];
+    } else {
+        return NULL;
+    }
+    ++str;
+
+    if (*str == '#') {
+        ++semitone;
+        ++str;
+    } else if (*str == 'b') {
+        --semitone;
+        ++str;
+    }
+
+    int octave;
+    if ((str[0] == '-') && (str[1] == '1')) {
+        octave = -1;
+        str += 2;
+    } else if ((*str >= '0') && (*str <= '9')) {
+        octave = *str - '0';
+        ++str;
+    } else {
+        return NULL;
+    }
+
+    const int midi = 12 * (octave + 1) + semitone;
+    if ((midi < 0) || (midi > 127)) {
+        return NULL;
+    }
+    *note = (unsigned int)midi;
+    return str;
+}
+
+
+unsigned int beep_note_freq_hz(const unsigned int note)
+{
+    return beep_note_freq[note & 0x7f];
+}
+
+
+const char *parse_duration_value(const char *str, const unsigned int max_ms,
+                                 unsigned int *const duration)
+{
+    const unsigned int max_numerator = BEEP_MAX_BEATS * BEEP_TICKS_PER_BEAT;
+    unsigned int numerator;
+    str = parse_uint_value(str, (max_ms > max_numerator) ? max_ms : max_numerator,
+                           &numerator);
+    if (!str) {
+        return NULL;
+    }
+
+    unsigned int denominator = 1;
+    if (*str == '/') {
+        str = parse_uint_value(str + 1, BEEP_TICKS_PER_BEAT, &denominator);
+        if ((!str) || (denominator == 0) || (*str != 'b')) {
+            return NULL;
+        }
+    }
+
+    if (*str != 'b') {
+        if (numerator > max_ms) {
+            return NULL;
+        }
+        *duration = numerator;
+        return str;
+    }
+
+    if (numerator > BEEP_MAX_BEATS * denominator) {
+        return NULL;
+    }
+    const unsigned int ticks =
+        (numerator * BEEP_TICKS_PER_BEAT + denominator / 2) / denominator;
+    *duration = BEEP_DURATION_TICKS | ticks;
+    return str + 1;
+}
+
+
+void beep_tempo_init(beep_tempo *tempo, const unsigned int bpm)
+{
+    tempo->bpm       = bpm;
+    tempo->remainder = 0;
+}
+
+
+unsigned int beep_tempo_ms(beep_tempo *tempo, const unsigned int duration)
+{
+    if (!(duration & BEEP_DURATION_TICKS)) {
+        return duration;
+    }
+    const uint64_t ticks = duration & ~BEEP_DURATION_TICKS;
+    const uint64_t ticks_per_minute = (uint64_t)tempo->bpm * BEEP_TICKS_PER_BEAT;
+    const uint64_t scaled = ticks * 60000 + tempo->remainder;
+    tempo->remainder = scaled % ticks_per_minute;
+    return (unsigned int)(scaled / ticks_per_minute);
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
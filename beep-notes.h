@@ -0,0 +1,102 @@
+/* beep-notes.h - interface to note names and tempo based durations
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_NOTES_H
+#define BEEP_NOTES_H
+
+
+#include <stdint.h>
+
+
+/** Tempo without a --bpm option */
+#define BEEP_DEFAULT_BPM 120
+#define BEEP_MIN_BPM     20
+#define BEEP_MAX_BPM     1000
+
+/** Resolution of durations given in beats.  960 is divisible by 2,
+ * 3, 4, 5, 6 and 8, so triplets and dotted notes are exact.
+ */
+#define BEEP_TICKS_PER_BEAT 960
+
+/** Longest duration in beats, i.e. 192 seconds at BEEP_MIN_BPM */
+#define BEEP_MAX_BEATS 64
+
+/** Set in a duration which is BEEP_TICKS_PER_BEAT ticks per beat
+ * instead of milliseconds.  Durations in milliseconds are at most
+ * 300000, so the two never overlap.
+ */
+#define BEEP_DURATION_TICKS 0x80000000U
+
+
+/** Convert durations in ticks to milliseconds at one tempo.
+ *
+ * The remainder of each division is carried over to the next
+ * duration, so that the tone edges of a long piece stay within 1ms of
+ * where the exact beats would put them.
+ */
+typedef struct {
+    unsigned int bpm;
+    uint64_t     remainder;
+} beep_tempo;
+
+
+/** Parse a note name with octave like "A4", "C#5" or "Bb3" (MIDI
+ * note numbers 0 to 127 are C-1 to G9).  Returns a pointer to the
+ * first character after the note, or NULL if str has no valid note
+ * name.
+ */
+const char *parse_note_value(const char *str, unsigned int *const note)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Frequency of a MIDI note in Hz, rounded */
+unsigned int beep_note_freq_hz(const unsigned int note);
+
+
+/** Parse a duration in milliseconds up to max_ms like "250", or in
+ * beats like "1b", "1/2b" or "3/8b" as BEEP_DURATION_TICKS plus the
+ * number of ticks.  Returns a pointer to the first character after
+ * the duration, or NULL if str has no valid duration.
+ */
+const char *parse_duration_value(const char *str, const unsigned int max_ms,
+                                 unsigned int *const duration)
+    __attribute__(( nonnull(1, 3) ));
+
+
+/** Start converting durations at bpm beats per minute */
+void beep_tempo_init(beep_tempo *tempo, const unsigned int bpm)
+    __attribute__(( nonnull(1) ));
+
+
+/** The milliseconds of a duration as parsed by parse_duration_value().
+ * Call this for all durations in the order they are played.
+ */
+unsigned int beep_tempo_ms(beep_tempo *tempo, const unsigned int duration)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_NOTES_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,738 @@
+# 0 "beep-notes.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "beep-notes.c"
+# 26 "beep-notes.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 27 "beep-notes.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 28 "beep-notes.c" 2
+
+# 1 "beep-library.h" 1
+# 24 "beep-library.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "beep-library.h" 2
+
+
+
+
+
+
+# 30 "beep-library.h"
+extern unsigned int syscall_count;
+# 39 "beep-library.h"
+int open_checked_char_device(const char *const device_name)
+    __attribute__(( nonnull(1) ));
+
+
+
+
+
+int write_all(const int fd, const void *const buf, const size_t count)
+    __attribute__(( nonnull(2) ));
+# 56 "beep-library.h"
+const char *parse_uint_value(const char *str, const unsigned int max,
+                             unsigned int *const result)
+    __attribute__(( nonnull(1, 3) ));
+
+
+
+
+
+
+
+const char *parse_rounded_value(const char *str, const unsigned int max,
+                                unsigned int *const result)
+    __attribute__(( nonnull(1, 3) ));
+
+
+void safe_error_exit(const char *const msg)
+    __attribute__(( nonnull(1), noreturn ));
+# 30 "beep-notes.c" 2
+# 1 "beep-note-table.h" 1
+# 16 "beep-note-table.h"
+static const uint16_t beep_note_freq[128] =
+    {
+         8,
+         9,
+         9,
+        10,
+        10,
+        11,
+        12,
+        12,
+        13,
+        14,
+        15,
+        15,
+        16,
+        17,
+        18,
+        19,
+        21,
+        22,
+        23,
+        24,
+        26,
+        28,
+        29,
+        31,
+        33,
+        35,
+        37,
+        39,
+        41,
+        44,
+        46,
+        49,
+        52,
+        55,
+        58,
+        62,
+        65,
+        69,
+        73,
+        78,
+        82,
+        87,
+        92,
+        98,
+       104,
+       110,
+       117,
+       123,
+       131,
+       139,
+       147,
+       156,
+       165,
+       175,
+       185,
+       196,
+       208,
+       220,
+       233,
+       247,
+       262,
+       277,
+       294,
+       311,
+       330,
+       349,
+       370,
+       392,
+       415,
+       440,
+       466,
+       494,
+       523,
+       554,
+       587,
+       622,
+       659,
+       698,
+       740,
+       784,
+       831,
+       880,
+       932,
+       988,
+      1047,
+      1109,
+      1175,
+      1245,
+      1319,
+      1397,
+      1480,
+      1568,
+      1661,
+      1760,
+      1865,
+      1976,
+      2093,
+      2217,
+      2349,
+      2489,
+      2637,
+      2794,
+      2960,
+      3136,
+      3322,
+      3520,
+      3729,
+      3951,
+      4186,
+      4435,
+      4699,
+      4978,
+      5274,
+      5588,
+      5920,
+      6272,
+      6645,
+      7040,
+      7459,
+      7902,
+      8372,
+      8870,
+      9397,
+      9956,
+     10548,
+     11175,
+     11840,
+     12544,
+    };
+
+
+
+
+
+static const uint16_t beep_note_console_divisor[128] =
+    {
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65535,
+     65009,
+     61361,
+     57917,
+     54666,
+     51598,
+     48702,
+     45968,
+     43388,
+     40953,
+     38655,
+     36485,
+     34437,
+     32505,
+     30680,
+     28958,
+     27333,
+     25799,
+     24351,
+     22984,
+     21694,
+     20477,
+     19327,
+     18243,
+     17219,
+     16252,
+     15340,
+     14479,
+     13667,
+     12899,
+     12175,
+     11492,
+     10847,
+     10238,
+      9664,
+      9121,
+      8609,
+      8126,
+      7670,
+      7240,
+      6833,
+      6450,
+      6088,
+      5746,
+      5424,
+      5119,
+      4832,
+      4561,
+      4305,
+      4063,
+      3835,
+      3620,
+      3417,
+      3225,
+      3044,
+      2873,
+      2712,
+      2560,
+      2416,
+      2280,
+      2152,
+      2032,
+      1918,
+      1810,
+      1708,
+      1612,
+      1522,
+      1437,
+      1356,
+      1280,
+      1208,
+      1140,
+      1076,
+      1016,
+       959,
+       905,
+       854,
+       806,
+       761,
+       718,
+       678,
+       640,
+       604,
+       570,
+       538,
+       508,
+       479,
+       452,
+       427,
+       403,
+       380,
+       359,
+       339,
+       320,
+       302,
+       285,
+       269,
+       254,
+       240,
+       226,
+       214,
+       202,
+       190,
+       180,
+       169,
+       160,
+       151,
+       143,
+       135,
+       127,
+       120,
+       113,
+       107,
+       101,
+        95,
+    };
+# 31 "beep-notes.c" 2
+# 1 "beep-notes.h" 1
+# 53 "beep-notes.h"
+typedef struct {
+    unsigned int bpm;
+    uint64_t remainder;
+} beep_tempo;
+
+
+
+
+
+
+
+const char *parse_note_value(const char *str, unsigned int *const note)
+    __attribute__(( nonnull(1, 2) ));
+
+
+
+unsigned int beep_note_freq_hz(const unsigned int note);
+
+
+
+
+
+
+
+const char *parse_duration_value(const char *str, const unsigned int max_ms,
+                                 unsigned int *const duration)
+    __attribute__(( nonnull(1, 3) ));
+
+
+
+void beep_tempo_init(beep_tempo *tempo, const unsigned int bpm)
+    __attribute__(( nonnull(1) ));
+
+
+
+
+
+unsigned int beep_tempo_ms(beep_tempo *tempo, const unsigned int duration)
+    __attribute__(( nonnull(1) ));
+# 32 "beep-notes.c" 2
+
+
+const char *parse_note_value(const char *str, unsigned int *const note)
+{
+
+    static const int letter_semitones[7] = { 9, 11, 0, 2, 4, 5, 7 };
+
+    int semitone;
+    if ((*str >= 'A') && (*str <= 'G')) {
+        semitone = letter_semitones[*str - 'A'];
+    } else if ((*str >= 'a') && (*str <= 'g')) {
+        semitone = letter_semitones[*str - 'a'];
+    } else {
+        return 
+# 45 "beep-notes.c" 3 4
+              ((void *)0)
+# 45 "beep-notes.c"
+                  ;
+    }
+    ++str;
+
+    if (*str == '#') {
+        ++semitone;
+        ++str;
+    } else if (*str == 'b') {
+        --semitone;
+        ++str;
+    }
+
+    int octave;
+    if ((str[0] == '-') && (str[1] == '1')) {
+        octave = -1;
+        str += 2;
+    } else if ((*str >= '0') && (*str <= '9')) {
+        octave = *str - '0';
+        ++str;
+    } else {
+        return 
+# 65 "beep-notes.c" 3 4
+              ((void *)0)
+# 65 "beep-notes.c"
+                  ;
+    }
+
+    const int midi = 12 * (octave + 1) + semitone;
+    if ((midi < 0) || (midi > 127)) {
+        return 
+# 70 "beep-notes.c" 3 4
+              ((void *)0)
+# 70 "beep-notes.c"
+                  ;
+    }
+    *note = (unsigned int)midi;
+    return str;
+}
+
+
+unsigned int beep_note_freq_hz(const unsigned int note)
+{
+    return beep_note_freq[note & 0x7f];
+}
+
+
+const char *parse_duration_value(const char *str, const unsigned int max_ms,
+                                 unsigned int *const duration)
+{
+    const unsigned int max_numerator = 64 * 960;
+    unsigned int numerator;
+    str = parse_uint_value(str, (max_ms > max_numerator) ? max_ms : max_numerator,
+                           &numerator);
+    if (!str) {
+        return 
+# 91 "beep-notes.c" 3 4
+              ((void *)0)
+# 91 "beep-notes.c"
+                  ;
+    }
+
+    unsigned int denominator = 1;
+    if (*str == '/') {
+        str = parse_uint_value(str + 1, 960, &denominator);
+        if ((!str) || (denominator == 0) || (*str != 'b')) {
+            return 
+# 98 "beep-notes.c" 3 4
+                  ((void *)0)
+# 98 "beep-notes.c"
+                      ;
+        }
+    }
+
+    if (*str != 'b') {
+        if (numerator > max_ms) {
+            return 
+# 104 "beep-notes.c" 3 4
+                  ((void *)0)
+# 104 "beep-notes.c"
+                      ;
+        }
+        *duration = numerator;
+        return str;
+    }
+
+    if (numerator > 64 * denominator) {
+        return 
+# 111 "beep-notes.c" 3 4
+              ((void *)0)
+# 111 "beep-notes.c"
+                  ;
+    }
+    const unsigned int ticks =
+        (numerator * 960 + denominator / 2) / denominator;
+    *duration = 0x80000000U | ticks;
+    return str + 1;
+}
+
+
+void beep_tempo_init(beep_tempo *tempo, const unsigned int bpm)
+{
+    tempo->bpm = bpm;
+    tempo->remainder = 0;
+}
+
+
+unsigned int beep_tempo_ms(beep_tempo *tempo, const unsigned int duration)
+{
+    if (!(duration & 0x80000000U)) {
+        return duration;
+    }
+    const uint64_t ticks = duration & ~0x80000000U;
+    const uint64_t ticks_per_minute = (uint64_t)tempo->bpm * 960;
+    const uint64_t scaled = ticks * 60000 + tempo->remainder;
+    tempo->remainder = scaled % ticks_per_minute;
+    return (unsigned int)(scaled / ticks_per_minute);
+}
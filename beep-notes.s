@@ -0,0 +1,2360 @@
+	.file	"beep-notes.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-notes.c"
+	.globl	parse_note_value
+	.type	parse_note_value, @function
+parse_note_value:
+.LVL0:
+.LFB0:
+	.file 1 "beep-notes.c"
+	.loc 1 35 1 view -0
+	.cfi_startproc
+	.loc 1 35 1 is_stmt 0 view .LVU1
+	endbr64
+	movq	%rdi, %rdx
+	movq	%rsi, %rcx
+	.loc 1 37 5 is_stmt 1 view .LVU2
+	.loc 1 39 5 view .LVU3
+	.loc 1 40 5 view .LVU4
+	.loc 1 40 10 is_stmt 0 view .LVU5
+	movzbl	(%rdi), %eax
+	.loc 1 40 23 view .LVU6
+	leal	-65(%rax), %esi
+.LVL1:
+	.loc 1 40 8 view .LVU7
+	cmpb	$6, %sil
+	ja	.L2
+	.loc 1 41 9 is_stmt 1 view .LVU8
+	.loc 1 41 37 is_stmt 0 view .LVU9
+	movsbl	%al, %eax
+	.loc 1 41 42 view .LVU10
+	subl	$65, %eax
+	.loc 1 41 18 view .LVU11
+	cltq
+	leaq	letter_semitones.0(%rip), %rsi
+	movl	(%rsi,%rax,4), %esi
+.LVL2:
+.L3:
+	.loc 1 47 5 is_stmt 1 view .LVU12
+	.loc 1 49 5 view .LVU13
+	.loc 1 49 9 is_stmt 0 view .LVU14
+	movzbl	1(%rdx), %eax
+	.loc 1 49 8 view .LVU15
+	cmpb	$35, %al
+	je	.L14
+	.loc 1 52 12 is_stmt 1 view .LVU16
+	.loc 1 52 15 is_stmt 0 view .LVU17
+	cmpb	$98, %al
+	je	.L7
+	.loc 1 47 5 view .LVU18
+	addq	$1, %rdx
+.LVL3:
+.L6:
+	.loc 1 57 5 is_stmt 1 view .LVU19
+	.loc 1 58 5 view .LVU20
+	.loc 1 58 13 is_stmt 0 view .LVU21
+	movzbl	(%rdx), %eax
+	.loc 1 58 8 view .LVU22
+	cmpb	$45, %al
+	je	.L15
+	.loc 1 61 12 is_stmt 1 view .LVU23
+	.loc 1 61 30 is_stmt 0 view .LVU24
+	leal	-48(%rax), %edi
+	.loc 1 61 15 view .LVU25
+	cmpb	$9, %dil
+	ja	.L12
+	.loc 1 62 9 is_stmt 1 view .LVU26
+	.loc 1 62 18 is_stmt 0 view .LVU27
+	movsbl	%al, %eax
+	.loc 1 62 16 view .LVU28
+	subl	$48, %eax
+.LVL4:
+	.loc 1 63 9 is_stmt 1 view .LVU29
+	leaq	1(%rdx), %rdi
+.LVL5:
+.L9:
+	.loc 1 68 5 view .LVU30
+	.loc 1 69 5 view .LVU31
+	.loc 1 68 25 is_stmt 0 view .LVU32
+	leal	3(%rax,%rax,2), %eax
+.LVL6:
+	.loc 1 68 15 view .LVU33
+	leal	(%rsi,%rax,4), %eax
+	.loc 1 69 8 view .LVU34
+	cmpl	$127, %eax
+	ja	.L13
+	.loc 1 72 5 is_stmt 1 view .LVU35
+	.loc 1 72 11 is_stmt 0 view .LVU36
+	movl	%eax, (%rcx)
+	.loc 1 73 5 is_stmt 1 view .LVU37
+.LVL7:
+.L1:
+	.loc 1 74 1 is_stmt 0 view .LVU38
+	movq	%rdi, %rax
+	ret
+.LVL8:
+.L2:
+	.loc 1 42 12 is_stmt 1 view .LVU39
+	.loc 1 42 30 is_stmt 0 view .LVU40
+	leal	-97(%rax), %esi
+	.loc 1 42 15 view .LVU41
+	cmpb	$6, %sil
+	ja	.L10
+	.loc 1 43 9 is_stmt 1 view .LVU42
+	.loc 1 43 37 is_stmt 0 view .LVU43
+	movsbl	%al, %eax
+	.loc 1 43 42 view .LVU44
+	subl	$97, %eax
+	.loc 1 43 18 view .LVU45
+	cltq
+	leaq	letter_semitones.0(%rip), %rsi
+	movl	(%rsi,%rax,4), %esi
+.LVL9:
+	.loc 1 43 18 view .LVU46
+	jmp	.L3
+.LVL10:
+.L14:
+	.loc 1 50 9 is_stmt 1 view .LVU47
+	addl	$1, %esi
+.LVL11:
+	.loc 1 51 9 view .LVU48
+	addq	$2, %rdx
+.LVL12:
+	.loc 1 51 9 is_stmt 0 view .LVU49
+	jmp	.L6
+.LVL13:
+.L7:
+	.loc 1 53 9 is_stmt 1 view .LVU50
+	subl	$1, %esi
+.LVL14:
+	.loc 1 54 9 view .LVU51
+	addq	$2, %rdx
+.LVL15:
+	.loc 1 54 9 is_stmt 0 view .LVU52
+	jmp	.L6
+.L15:
+	.loc 1 65 15 discriminator 1 view .LVU53
+	movl	$0, %edi
+	.loc 1 58 25 discriminator 1 view .LVU54
+	cmpb	$49, 1(%rdx)
+	jne	.L1
+	.loc 1 59 9 is_stmt 1 view .LVU55
+.LVL16:
+	.loc 1 60 9 view .LVU56
+	.loc 1 60 13 is_stmt 0 view .LVU57
+	leaq	2(%rdx), %rdi
+.LVL17:
+	.loc 1 59 16 view .LVU58
+	movl	$-1, %eax
+	.loc 1 60 13 view .LVU59
+	jmp	.L9
+.LVL18:
+.L10:
+	.loc 1 45 15 view .LVU60
+	movl	$0, %edi
+	jmp	.L1
+.LVL19:
+.L12:
+	.loc 1 65 15 view .LVU61
+	movl	$0, %edi
+	jmp	.L1
+.LVL20:
+.L13:
+	.loc 1 70 15 view .LVU62
+	movl	$0, %edi
+.LVL21:
+	.loc 1 70 15 view .LVU63
+	jmp	.L1
+	.cfi_endproc
+.LFE0:
+	.size	parse_note_value, .-parse_note_value
+	.globl	beep_note_freq_hz
+	.type	beep_note_freq_hz, @function
+beep_note_freq_hz:
+.LVL22:
+.LFB1:
+	.loc 1 78 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 78 1 is_stmt 0 view .LVU65
+	endbr64
+	.loc 1 79 5 is_stmt 1 view .LVU66
+	.loc 1 79 26 is_stmt 0 view .LVU67
+	andl	$127, %edi
+.LVL23:
+	.loc 1 79 26 view .LVU68
+	leaq	beep_note_freq(%rip), %rax
+	movzwl	(%rax,%rdi,2), %eax
+	.loc 1 80 1 view .LVU69
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	beep_note_freq_hz, .-beep_note_freq_hz
+	.globl	parse_duration_value
+	.type	parse_duration_value, @function
+parse_duration_value:
+.LVL24:
+.LFB2:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 85 1 is_stmt 0 view .LVU71
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	movl	%esi, %ebx
+	movq	%rdx, %rbp
+	.loc 1 85 1 view .LVU72
+	movq	%fs:40, %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	.loc 1 86 5 is_stmt 1 view .LVU73
+.LVL25:
+	.loc 1 87 5 view .LVU74
+	.loc 1 88 5 view .LVU75
+	.loc 1 88 11 is_stmt 0 view .LVU76
+	movq	%rsp, %rdx
+.LVL26:
+	.loc 1 88 67 view .LVU77
+	movl	$61440, %esi
+.LVL27:
+	.loc 1 88 67 view .LVU78
+	cmpl	%esi, %ebx
+	cmovnb	%ebx, %esi
+	.loc 1 88 11 view .LVU79
+	call	parse_uint_value@PLT
+.LVL28:
+	.loc 1 88 11 view .LVU80
+	movq	%rax, %rdi
+.LVL29:
+	.loc 1 90 5 is_stmt 1 view .LVU81
+	.loc 1 90 8 is_stmt 0 view .LVU82
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 94 5 is_stmt 1 view .LVU83
+	.loc 1 94 18 is_stmt 0 view .LVU84
+	movl	$1, 4(%rsp)
+	.loc 1 95 5 is_stmt 1 view .LVU85
+	.loc 1 95 9 is_stmt 0 view .LVU86
+	movzbl	(%rax), %eax
+.LVL30:
+	.loc 1 95 8 view .LVU87
+	cmpb	$47, %al
+	je	.L27
+	.loc 1 102 5 is_stmt 1 view .LVU88
+	.loc 1 102 8 is_stmt 0 view .LVU89
+	cmpb	$98, %al
+	je	.L20
+	.loc 1 103 9 is_stmt 1 view .LVU90
+	.loc 1 103 23 is_stmt 0 view .LVU91
+	movl	(%rsp), %eax
+	.loc 1 103 12 view .LVU92
+	cmpl	%eax, %ebx
+	jb	.L24
+	.loc 1 106 9 is_stmt 1 view .LVU93
+	.loc 1 106 19 is_stmt 0 view .LVU94
+	movl	%eax, 0(%rbp)
+	.loc 1 107 9 is_stmt 1 view .LVU95
+.LVL31:
+.L17:
+	.loc 1 117 1 is_stmt 0 view .LVU96
+	movq	8(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L28
+	movq	%rdi, %rax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 117 1 view .LVU97
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL33:
+	.loc 1 117 1 view .LVU98
+	ret
+.LVL34:
+.L27:
+	.cfi_restore_state
+	.loc 1 96 9 is_stmt 1 view .LVU99
+	.loc 1 96 15 is_stmt 0 view .LVU100
+	addq	$1, %rdi
+.LVL35:
+	.loc 1 96 15 view .LVU101
+	leaq	4(%rsp), %rdx
+	movl	$960, %esi
+	call	parse_uint_value@PLT
+.LVL36:
+	.loc 1 96 15 view .LVU102
+	movq	%rax, %rdi
+.LVL37:
+	.loc 1 97 9 is_stmt 1 view .LVU103
+	.loc 1 97 12 is_stmt 0 view .LVU104
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 97 20 discriminator 1 view .LVU105
+	cmpl	$0, 4(%rsp)
+	je	.L22
+	.loc 1 97 42 discriminator 2 view .LVU106
+	cmpb	$98, (%rax)
+	jne	.L29
+.LVL38:
+.L20:
+	.loc 1 110 5 is_stmt 1 view .LVU107
+	.loc 1 110 24 is_stmt 0 view .LVU108
+	movl	4(%rsp), %esi
+	.loc 1 110 19 view .LVU109
+	movl	(%rsp), %eax
+	.loc 1 110 24 view .LVU110
+	movl	%esi, %edx
+	sall	$6, %edx
+	.loc 1 110 8 view .LVU111
+	cmpl	%eax, %edx
+	jb	.L25
+	.loc 1 113 5 is_stmt 1 view .LVU112
+.LVL39:
+	.loc 1 115 5 view .LVU113
+	.loc 1 114 20 is_stmt 0 view .LVU114
+	imull	$960, %eax, %eax
+.LVL40:
+	.loc 1 114 40 view .LVU115
+	movl	%esi, %edx
+	shrl	%edx
+	.loc 1 114 26 view .LVU116
+	addl	%edx, %eax
+	.loc 1 113 24 view .LVU117
+	movl	$0, %edx
+	divl	%esi
+.LVL41:
+	.loc 1 115 29 view .LVU118
+	orl	$-2147483648, %eax
+.LVL42:
+	.loc 1 115 29 view .LVU119
+	movl	%eax, 0(%rbp)
+	.loc 1 116 5 is_stmt 1 view .LVU120
+	.loc 1 116 16 is_stmt 0 view .LVU121
+	addq	$1, %rdi
+.LVL43:
+	.loc 1 116 16 view .LVU122
+	jmp	.L17
+.LVL44:
+.L22:
+	.loc 1 98 19 view .LVU123
+	movl	$0, %edi
+	jmp	.L17
+.L29:
+	.loc 1 98 19 view .LVU124
+	movl	$0, %edi
+	jmp	.L17
+.LVL45:
+.L24:
+	.loc 1 104 19 view .LVU125
+	movl	$0, %edi
+.LVL46:
+	.loc 1 104 19 view .LVU126
+	jmp	.L17
+.LVL47:
+.L25:
+	.loc 1 111 15 view .LVU127
+	movl	$0, %edi
+.LVL48:
+	.loc 1 111 15 view .LVU128
+	jmp	.L17
+.LVL49:
+.L28:
+	.loc 1 117 1 view .LVU129
+	call	__stack_chk_fail@PLT
+.LVL50:
+	.cfi_endproc
+.LFE2:
+	.size	parse_duration_value, .-parse_duration_value
+	.globl	beep_tempo_init
+	.type	beep_tempo_init, @function
+beep_tempo_init:
+.LVL51:
+.LFB3:
+	.loc 1 121 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 121 1 is_stmt 0 view .LVU131
+	endbr64
+	.loc 1 122 5 is_stmt 1 view .LVU132
+	.loc 1 122 16 is_stmt 0 view .LVU133
+	movl	%esi, (%rdi)
+	.loc 1 123 5 is_stmt 1 view .LVU134
+	.loc 1 123 22 is_stmt 0 view .LVU135
+	movq	$0, 8(%rdi)
+	.loc 1 124 1 view .LVU136
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	beep_tempo_init, .-beep_tempo_init
+	.globl	beep_tempo_ms
+	.type	beep_tempo_ms, @function
+beep_tempo_ms:
+.LVL52:
+.LFB4:
+	.loc 1 128 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 128 1 is_stmt 0 view .LVU138
+	endbr64
+	movq	%rdi, %rcx
+	.loc 1 129 5 is_stmt 1 view .LVU139
+	.loc 1 130 16 is_stmt 0 view .LVU140
+	movl	%esi, %eax
+	.loc 1 129 8 view .LVU141
+	testl	%esi, %esi
+	jns	.L31
+	.loc 1 132 5 is_stmt 1 view .LVU142
+.LVL53:
+	.loc 1 133 5 view .LVU143
+	.loc 1 133 39 is_stmt 0 view .LVU144
+	movl	(%rdi), %eax
+	.loc 1 133 20 view .LVU145
+	movq	%rax, %rdi
+.LVL54:
+	.loc 1 133 20 view .LVU146
+	salq	$4, %rdi
+	subq	%rax, %rdi
+	salq	$6, %rdi
+.LVL55:
+	.loc 1 134 5 is_stmt 1 view .LVU147
+	.loc 1 132 20 is_stmt 0 view .LVU148
+	andl	$2147483647, %esi
+.LVL56:
+	.loc 1 134 35 view .LVU149
+	imulq	$60000, %rsi, %rax
+	.loc 1 134 20 view .LVU150
+	addq	8(%rcx), %rax
+.LVL57:
+	.loc 1 135 5 is_stmt 1 view .LVU151
+	.loc 1 135 31 is_stmt 0 view .LVU152
+	movl	$0, %edx
+	divq	%rdi
+.LVL58:
+	.loc 1 135 22 view .LVU153
+	movq	%rdx, 8(%rcx)
+.LVL59:
+	.loc 1 136 5 is_stmt 1 view .LVU154
+.L31:
+	.loc 1 137 1 is_stmt 0 view .LVU155
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	beep_tempo_ms, .-beep_tempo_ms
+	.section	.rodata
+	.align 16
+	.type	letter_semitones.0, @object
+	.size	letter_semitones.0, 28
+letter_semitones.0:
+	.long	9
+	.long	11
+	.long	0
+	.long	2
+	.long	4
+	.long	5
+	.long	7
+	.align 32
+	.type	beep_note_freq, @object
+	.size	beep_note_freq, 256
+beep_note_freq:
+	.value	8
+	.value	9
+	.value	9
+	.value	10
+	.value	10
+	.value	11
+	.value	12
+	.value	12
+	.value	13
+	.value	14
+	.value	15
+	.value	15
+	.value	16
+	.value	17
+	.value	18
+	.value	19
+	.value	21
+	.value	22
+	.value	23
+	.value	24
+	.value	26
+	.value	28
+	.value	29
+	.value	31
+	.value	33
+	.value	35
+	.value	37
+	.value	39
+	.value	41
+	.value	44
+	.value	46
+	.value	49
+	.value	52
+	.value	55
+	.value	58
+	.value	62
+	.value	65
+	.value	69
+	.value	73
+	.value	78
+	.value	82
+	.value	87
+	.value	92
+	.value	98
+	.value	104
+	.value	110
+	.value	117
+	.value	123
+	.value	131
+	.value	139
+	.value	147
+	.value	156
+	.value	165
+	.value	175
+	.value	185
+	.value	196
+	.value	208
+	.value	220
+	.value	233
+	.value	247
+	.value	262
+	.value	277
+	.value	294
+	.value	311
+	.value	330
+	.value	349
+	.value	370
+	.value	392
+	.value	415
+	.value	440
+	.value	466
+	.value	494
+	.value	523
+	.value	554
+	.value	587
+	.value	622
+	.value	659
+	.value	698
+	.value	740
+	.value	784
+	.value	831
+	.value	880
+	.value	932
+	.value	988
+	.value	1047
+	.value	1109
+	.value	1175
+	.value	1245
+	.value	1319
+	.value	1397
+	.value	1480
+	.value	1568
+	.value	1661
+	.value	1760
+	.value	1865
+	.value	1976
+	.value	2093
+	.value	2217
+	.value	2349
+	.value	2489
+	.value	2637
+	.value	2794
+	.value	2960
+	.value	3136
+	.value	3322
+	.value	3520
+	.value	3729
+	.value	3951
+	.value	4186
+	.value	4435
+	.value	4699
+	.value	4978
+	.value	5274
+	.value	5588
+	.value	5920
+	.value	6272
+	.value	6645
+	.value	7040
+	.value	7459
+	.value	7902
+	.value	8372
+	.value	8870
+	.value	9397
+	.value	9956
+	.value	10548
+	.value	11175
+	.value	11840
+	.value	12544
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "beep-note-table.h"
+	.file 5 "beep-notes.h"
+	.file 6 "beep-library.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4f5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF36
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	0x3c
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x2
+	.long	0x56
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x4f
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x2
+	.long	0x88
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x2
+	.long	0x94
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2
+	.long	0xa5
+	.uleb128 0xb
+	.long	0xa0
+	.long	0xc6
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb6
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x10
+	.byte	0x17
+	.long	0xc6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	beep_note_freq
+	.uleb128 0x11
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x98
+	.byte	0x17
+	.long	0xc6
+	.value	0x100
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xff
+	.byte	0xf1
+	.byte	0xfd
+	.byte	0xb1
+	.byte	0xef
+	.byte	0x3d
+	.byte	0xe2
+	.byte	0x8a
+	.byte	0xd5
+	.byte	0x8e
+	.byte	0xc9
+	.byte	0x3e
+	.byte	0xbe
+	.byte	0x90
+	.byte	0xb3
+	.byte	0x7c
+	.byte	0xa9
+	.byte	0xf9
+	.byte	0x9f
+	.byte	0xff
+	.byte	0x96
+	.byte	0x85
+	.byte	0x8e
+	.byte	0x85
+	.byte	0x86
+	.byte	0xf9
+	.byte	0x7e
+	.byte	0xd8
+	.byte	0x77
+	.byte	0x1e
+	.byte	0x71
+	.byte	0xc5
+	.byte	0x6a
+	.byte	0xc7
+	.byte	0x64
+	.byte	0x1f
+	.byte	0x5f
+	.byte	0xc8
+	.byte	0x59
+	.byte	0xbe
+	.byte	0x54
+	.byte	0xfd
+	.byte	0x4f
+	.byte	0x7f
+	.byte	0x4b
+	.byte	0x43
+	.byte	0x47
+	.byte	0x43
+	.byte	0x43
+	.byte	0x7c
+	.byte	0x3f
+	.byte	0xec
+	.byte	0x3b
+	.byte	0x8f
+	.byte	0x38
+	.byte	0x63
+	.byte	0x35
+	.byte	0x63
+	.byte	0x32
+	.byte	0x8f
+	.byte	0x2f
+	.byte	0xe4
+	.byte	0x2c
+	.byte	0x5f
+	.byte	0x2a
+	.byte	0xfe
+	.byte	0x27
+	.byte	0xc0
+	.byte	0x25
+	.byte	0xa1
+	.byte	0x23
+	.byte	0xa1
+	.byte	0x21
+	.byte	0xbe
+	.byte	0x1f
+	.byte	0xf6
+	.byte	0x1d
+	.byte	0x48
+	.byte	0x1c
+	.byte	0xb1
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x19
+	.byte	0xc8
+	.byte	0x17
+	.byte	0x72
+	.byte	0x16
+	.byte	0x30
+	.byte	0x15
+	.byte	0xff
+	.byte	0x13
+	.byte	0xe0
+	.byte	0x12
+	.byte	0xd1
+	.byte	0x11
+	.byte	0xd1
+	.byte	0x10
+	.byte	0xdf
+	.byte	0xf
+	.byte	0xfb
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.byte	0x59
+	.byte	0xd
+	.byte	0x99
+	.byte	0xc
+	.byte	0xe4
+	.byte	0xb
+	.byte	0x39
+	.byte	0xb
+	.byte	0x98
+	.byte	0xa
+	.byte	0
+	.byte	0xa
+	.byte	0x70
+	.byte	0x9
+	.byte	0xe8
+	.byte	0x8
+	.byte	0x68
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x7
+	.byte	0x7e
+	.byte	0x7
+	.byte	0x12
+	.byte	0x7
+	.byte	0xac
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x6
+	.byte	0xf2
+	.byte	0x5
+	.byte	0x9d
+	.byte	0x5
+	.byte	0x4c
+	.byte	0x5
+	.byte	0
+	.byte	0x5
+	.byte	0xb8
+	.byte	0x4
+	.byte	0x74
+	.byte	0x4
+	.byte	0x34
+	.byte	0x4
+	.byte	0xf8
+	.byte	0x3
+	.byte	0xbf
+	.byte	0x3
+	.byte	0x89
+	.byte	0x3
+	.byte	0x56
+	.byte	0x3
+	.byte	0x26
+	.byte	0x3
+	.byte	0xf9
+	.byte	0x2
+	.byte	0xce
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x2
+	.byte	0x80
+	.byte	0x2
+	.byte	0x5c
+	.byte	0x2
+	.byte	0x3a
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x2
+	.byte	0xfc
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x1
+	.byte	0xab
+	.byte	0x1
+	.byte	0x93
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x1
+	.byte	0x67
+	.byte	0x1
+	.byte	0x53
+	.byte	0x1
+	.byte	0x40
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x1
+	.byte	0xd
+	.byte	0x1
+	.byte	0xfe
+	.byte	0
+	.byte	0xf0
+	.byte	0
+	.byte	0xe2
+	.byte	0
+	.byte	0xd6
+	.byte	0
+	.byte	0xca
+	.byte	0
+	.byte	0xbe
+	.byte	0
+	.byte	0xb4
+	.byte	0
+	.byte	0xa9
+	.byte	0
+	.byte	0xa0
+	.byte	0
+	.byte	0x97
+	.byte	0
+	.byte	0x8f
+	.byte	0
+	.byte	0x87
+	.byte	0
+	.byte	0x7f
+	.byte	0
+	.byte	0x78
+	.byte	0
+	.byte	0x71
+	.byte	0
+	.byte	0x6b
+	.byte	0
+	.byte	0x65
+	.byte	0
+	.byte	0x5f
+	.byte	0
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x5
+	.byte	0x35
+	.byte	0x9
+	.long	0x213
+	.uleb128 0x13
+	.string	"bpm"
+	.byte	0x5
+	.byte	0x36
+	.byte	0x12
+	.long	0x56
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x37
+	.byte	0xe
+	.long	0xa5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x38
+	.byte	0x3
+	.long	0x1ef
+	.uleb128 0x15
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x38
+	.byte	0xd
+	.long	0x23f
+	.long	0x23f
+	.uleb128 0x9
+	.long	0x23f
+	.uleb128 0x9
+	.long	0x5d
+	.uleb128 0x9
+	.long	0x249
+	.byte	0
+	.uleb128 0xa
+	.long	0x8f
+	.uleb128 0xa
+	.long	0x56
+	.uleb128 0x2
+	.long	0x244
+	.uleb128 0x8
+	.long	.LASF23
+	.byte	0x7f
+	.byte	0xe
+	.long	0x56
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2cf
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x7f
+	.byte	0x28
+	.long	0x2cf
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x7f
+	.byte	0x42
+	.long	0x5d
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x84
+	.byte	0x14
+	.long	0xb1
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x85
+	.byte	0x14
+	.long	0xb1
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x86
+	.byte	0x14
+	.long	0xb1
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0xa
+	.long	0x213
+	.uleb128 0x16
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x78
+	.byte	0x6
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x30f
+	.uleb128 0x17
+	.long	.LASF18
+	.byte	0x1
+	.byte	0x78
+	.byte	0x22
+	.long	0x2cf
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x18
+	.string	"bpm"
+	.byte	0x1
+	.byte	0x78
+	.byte	0x3c
+	.long	0x5d
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x53
+	.byte	0xd
+	.long	0x23f
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x40e
+	.uleb128 0xd
+	.string	"str"
+	.byte	0x53
+	.byte	0x2e
+	.long	0x23f
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x4
+	.long	.LASF25
+	.byte	0x53
+	.byte	0x46
+	.long	0x5d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x54
+	.byte	0x36
+	.long	0x249
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x19
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x56
+	.byte	0x18
+	.long	0x5d
+	.value	0xf000
+	.uleb128 0x7
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x57
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x71
+	.byte	0x18
+	.long	0x5d
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xe
+	.quad	.LVL28
+	.long	0x21f
+	.long	0x3e1
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x16
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xf000
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf000
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL36
+	.long	0x21f
+	.long	0x400
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3c0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL50
+	.long	0x4ef
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x4d
+	.byte	0xe
+	.long	0x56
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x443
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x4d
+	.byte	0x33
+	.long	0x5d
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF31
+	.byte	0x22
+	.byte	0xd
+	.long	0x23f
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4da
+	.uleb128 0xd
+	.string	"str"
+	.byte	0x22
+	.byte	0x2a
+	.long	0x23f
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x22
+	.byte	0x43
+	.long	0x249
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x25
+	.byte	0x16
+	.long	0x4ea
+	.uleb128 0x9
+	.byte	0x3
+	.quad	letter_semitones.0
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x27
+	.byte	0x9
+	.long	0x3c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x39
+	.byte	0x9
+	.long	0x3c
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x44
+	.byte	0xf
+	.long	0x43
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0xb
+	.long	0x43
+	.long	0x4ea
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.long	0x4da
+	.uleb128 0x1b
+	.long	.LASF39
+	.long	.LASF39
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU143
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU155
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0xf
+	.byte	0x74
+	.sleb128 0
+	.byte	0xc
+	.long	0x7fffffff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU147
+	.uleb128 .LVU155
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa
+	.value	0xea60
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU96
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa
+	.value	0x3c0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x22
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x3c0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x22
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x3c0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x22
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU63
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU12
+	.uleb128 .LVU38
+	.uleb128 .LVU46
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU29
+	.uleb128 .LVU33
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 1
+	.byte	0x3c
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF26:
+	.string	"max_numerator"
+.LASF20:
+	.string	"ticks"
+.LASF29:
+	.string	"beep_note_freq_hz"
+.LASF16:
+	.string	"remainder"
+.LASF13:
+	.string	"uint64_t"
+.LASF8:
+	.string	"short int"
+.LASF24:
+	.string	"parse_duration_value"
+.LASF17:
+	.string	"beep_tempo"
+.LASF15:
+	.string	"beep_note_console_divisor"
+.LASF9:
+	.string	"__uint16_t"
+.LASF35:
+	.string	"midi"
+.LASF25:
+	.string	"max_ms"
+.LASF22:
+	.string	"scaled"
+.LASF37:
+	.string	"parse_uint_value"
+.LASF19:
+	.string	"duration"
+.LASF2:
+	.string	"long int"
+.LASF21:
+	.string	"ticks_per_minute"
+.LASF4:
+	.string	"unsigned char"
+.LASF27:
+	.string	"numerator"
+.LASF34:
+	.string	"octave"
+.LASF7:
+	.string	"signed char"
+.LASF6:
+	.string	"unsigned int"
+.LASF12:
+	.string	"uint16_t"
+.LASF5:
+	.string	"short unsigned int"
+.LASF31:
+	.string	"parse_note_value"
+.LASF38:
+	.string	"beep_tempo_init"
+.LASF11:
+	.string	"char"
+.LASF30:
+	.string	"note"
+.LASF10:
+	.string	"__uint64_t"
+.LASF32:
+	.string	"letter_semitones"
+.LASF18:
+	.string	"tempo"
+.LASF3:
+	.string	"long unsigned int"
+.LASF14:
+	.string	"beep_note_freq"
+.LASF23:
+	.string	"beep_tempo_ms"
+.LASF33:
+	.string	"semitone"
+.LASF39:
+	.string	"__stack_chk_fail"
+.LASF28:
+	.string	"denominator"
+.LASF36:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-notes.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,415 @@
+/* beep-rtttl.c - read RTTTL ringtones
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* An RTTTL (Nokia ring tone text transfer language) ringtone is
+ *
+ *   NAME:d=DURATION,o=OCTAVE,b=BPM:NOTE,NOTE,...
+ *
+ * with each NOTE being [DURATION]LETTER[#][.][OCTAVE][.], the LETTER
+ * being one of c d e f g a b (or h) or p for a pause, and the
+ * DURATION 1 for a whole note (4 beats) to 32 (1/8 beat).  Missing
+ * defaults are d=4, o=6 and b=63.  A file may hold one ringtone per
+ * line.  A '#' raises the note by a semitone, so b# (or h#) is the C
+ * of the next octave.
+ *
+ * The tokenizer is a state machine fed one byte at a time from a
+ * fixed buffer, so tokens may span read(2) calls, nothing is copied
+ * or allocated, and the tones of a ringtone come out as soon as its
+ * header and first notes have been read.  Durations are converted
+ * with a beep_tempo from integer ticks, so long ringtones keep time.
+ */
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "beep-rtttl.h"
+
+#include "beep-log.h"
+#include "beep-notes.h"
+
+
+/* Size of the read(2) buffer */
+#define RTTTL_BUFFER_SIZE 65536
+
+/* Defaults for a ringtone without them */
+#define RTTTL_DEFAULT_DURATION 4
+#define RTTTL_DEFAULT_OCTAVE   6
+#define RTTTL_DEFAULT_BPM      63
+
+
+typedef enum {
+    RTTTL_NAME,     /* up to the first ':' */
+    RTTTL_KEY,      /* d, o or b of the defaults, or the second ':' */
+    RTTTL_EQUALS,   /* '=' after the key */
+    RTTTL_VALUE,    /* digits of the default value */
+    RTTTL_NOTE,     /* notes up to the end of the line */
+} rtttl_state_E;
+
+
+struct _beep_rtttl {
+    int            fd;
+    const char    *name;
+    unsigned long  line_number;
+    bool           eof;
+    bool           failed;
+
+    rtttl_state_E  state;
+    bool           seen_name;
+    char           key;
+    unsigned int   value;
+    unsigned int   default_duration;
+    unsigned int   default_octave;
+    unsigned int   bpm;
+    beep_tempo     tempo;
+
+    /* The note being tokenized */
+    unsigned int   duration;     /* 0 for the default duration */
+    int            semitone;     /* -1 before the letter */
+    bool           is_pause;
+    bool           sharp;
+    bool           dotted;
+    int            octave;       /* -1 for the default octave */
+
+    size_t         buf_start;
+    size_t         buf_end;
+    char           buf[RTTTL_BUFFER_SIZE];
+
+    beep_tone      tones[BEEP_RTTTL_BATCH];
+};
+
+
+beep_rtttl *beep_rtttl_open(const char *const filename)
+{
+    int fd = STDIN_FILENO;
+    if (0 != strcmp(filename, "-")) {
+        fd = open(filename, O_RDONLY|O_CLOEXEC);
+        if (fd == -1) {
+            return NULL;
+        }
+    }
+    beep_rtttl *const rtttl = malloc(sizeof(beep_rtttl));
+    if (!rtttl) {
+        const int saved_errno = errno;
+        if (fd != STDIN_FILENO) {
+            close(fd);
+        }
+        errno = saved_errno;
+        return NULL;
+    }
+    rtttl->fd          = fd;
+    rtttl->name        = filename;
+    rtttl->line_number = 1;
+    rtttl->eof         = false;
+    rtttl->failed      = false;
+    rtttl->state       = RTTTL_NAME;
+    rtttl->seen_name   = false;
+    rtttl->buf_start   = 0;
+    rtttl->buf_end     = 0;
+    log_verbose("rtttl: reading %s", filename);
+    return rtttl;
+}
+
+
+static
+void rtttl_error(beep_rtttl *rtttl, const char *const message)
+{
+    log_error("%s:%lu: %s", rtttl->name, rtttl->line_number, message);
+    rtttl->failed = true;
+}
+
+
+static
+bool valid_duration(const unsigned int duration)
+{
+    return (duration > 0) && (duration <= 32) && (0 == (duration & (duration - 1)));
+}
+
+
+static
+void start_note(beep_rtttl *rtttl)
+{
+    rtttl->duration = 0;
+    rtttl->semitone = -1;
+    rtttl->is_pause = false;
+    rtttl->sharp    = false;
+    rtttl->dotted   = false;
+    rtttl->octave   = -1;
+}
+
+
+/* Store the default value just parsed */
+static
+bool store_default(beep_rtttl *rtttl)
+{
+    switch (rtttl->key) {
+    case 'd':
+        rtttl->default_duration = rtttl->value;
+        return valid_duration(rtttl->value);
+    case 'o':
+        rtttl->default_octave = rtttl->value;
+        return (rtttl->value <= 9);
+    default: /* 'b' */
+        rtttl->bpm = rtttl->value;
+        return (rtttl->value >= BEEP_MIN_BPM) && (rtttl->value <= BEEP_MAX_BPM);
+    }
+}
+
+
+/* Turn the note just tokenized into a tone.  Returns false for an
+ * invalid note.
+ */
+static
+bool finish_note(beep_rtttl *rtttl, beep_tone *const tone)
+{
+    const unsigned int duration =
+        rtttl->duration ? rtttl->duration : rtttl->default_duration;
+    if ((rtttl->semitone < 0) || (!valid_duration(duration))) {
+        return false;
+    }
+
+    /* A whole note (duration 1) is four beats */
+    unsigned int ticks = (4 * BEEP_TICKS_PER_BEAT) / duration;
+    if (rtttl->dotted) {
+        ticks += ticks / 2;
+    }
+    tone->length = beep_tempo_ms(&rtttl->tempo, BEEP_DURATION_TICKS | ticks);
+    tone->delay  = 0;
+
+    if (rtttl->is_pause) {
+        tone->freq  = 0;
+        tone->flags = 0;
+    } else {
+        const int octave = (rtttl->octave >= 0)
+            ? rtttl->octave : (int)rtttl->default_octave;
+        const int note = 12 * (octave + 1) + rtttl->semitone
+            + (rtttl->sharp ? 1 : 0);
+        if (note > 127) {
+            return false;
+        }
+        tone->freq  = beep_note_freq_hz((unsigned int)note);
+        tone->flags = BEEP_TONE_NOTE | (uint32_t)note;
+    }
+    return true;
+}
+
+
+/* Feed one byte to the tokenizer.  Returns 1 if it completed a tone,
+ * 0 if not, and -1 after logging an error.
+ */
+static
+int rtttl_feed(beep_rtttl *rtttl, const char c, beep_tone *const tone)
+{
+    /* semitones above C of the letters a to h, h being the German b */
+    static const int letter_semitones[8] = { 9, 11, 0, 2, 4, 5, 7, 11 };
+
+    if ((c == ' ') || (c == '\t') || (c == '\r')) {
+        return 0;
+    }
+    if ((c == '\n') && (rtttl->state != RTTTL_NAME)
+        && (rtttl->state != RTTTL_NOTE)) {
+        rtttl_error(rtttl, "expected :NOTES after the defaults");
+        return -1;
+    }
+
+    switch (rtttl->state) {
+    case RTTTL_NAME:
+        if (c == ':') {
+            rtttl->state            = RTTTL_KEY;
+            rtttl->default_duration = RTTTL_DEFAULT_DURATION;
+            rtttl->default_octave   = RTTTL_DEFAULT_OCTAVE;
+            rtttl->bpm              = RTTTL_DEFAULT_BPM;
+        } else if (c == '\n') {
+            if (rtttl->seen_name) {
+                rtttl_error(rtttl, "expected NAME:DEFAULTS:NOTES");
+                return -1;
+            }
+            ++rtttl->line_number;
+        } else {
+            rtttl->seen_name = true;
+        }
+        return 0;
+
+    case RTTTL_KEY:
+        if (c == ':') {
+            beep_tempo_init(&rtttl->tempo, rtttl->bpm);
+            start_note(rtttl);
+            rtttl->state = RTTTL_NOTE;
+        } else if ((c == 'd') || (c == 'o') || (c == 'b')) {
+            rtttl->key   = c;
+            rtttl->state = RTTTL_EQUALS;
+        } else if ((c == 'D') || (c == 'O') || (c == 'B')) {
+            rtttl->key   = (char)(c - 'A' + 'a');
+            rtttl->state = RTTTL_EQUALS;
+        } else if (c != ',') {
+            rtttl_error(rtttl, "expected d=, o= or b= default");
+            return -1;
+        }
+        return 0;
+
+    case RTTTL_EQUALS:
+        if (c != '=') {
+            rtttl_error(rtttl, "expected = after default name");
+            return -1;
+        }
+        rtttl->value = 0;
+        rtttl->state = RTTTL_VALUE;
+        return 0;
+
+    case RTTTL_VALUE:
+        if ((c >= '0') && (c <= '9')) {
+            rtttl->value = 10 * rtttl->value + (unsigned int)(c - '0');
+            if (rtttl->value > 9999) {
+                rtttl_error(rtttl, "default value too large");
+                return -1;
+            }
+            return 0;
+        }
+        if ((c != ',') && (c != ':')) {
+            rtttl_error(rtttl, "expected digits of default value");
+            return -1;
+        }
+        if (!store_default(rtttl)) {
+            rtttl_error(rtttl, "invalid default value");
+            return -1;
+        }
+        rtttl->state = RTTTL_KEY;
+        if (c == ':') {
+            return rtttl_feed(rtttl, c, tone);
+        }
+        return 0;
+
+    case RTTTL_NOTE:
+        break;
+    }
+
+    if ((c >= '0') && (c <= '9')) {
+        if (rtttl->semitone < 0) {
+            rtttl->duration = 10 * rtttl->duration + (unsigned int)(c - '0');
+            if (rtttl->duration > 32) {
+                rtttl_error(rtttl, "invalid note duration");
+                return -1;
+            }
+            return 0;
+        }
+        if (rtttl->octave < 0) {
+            rtttl->octave = c - '0';
+            return 0;
+        }
+    } else if ((c >= 'a') && (c <= 'h') && (rtttl->semitone < 0)) {
+        rtttl->semitone = letter_semitones[c - 'a'];
+        return 0;
+    } else if ((c >= 'A') && (c <= 'H') && (rtttl->semitone < 0)) {
+        rtttl->semitone = letter_semitones[c - 'A'];
+        return 0;
+    } else if (((c == 'p') || (c == 'P')) && (rtttl->semitone < 0)) {
+        rtttl->semitone = 0;
+        rtttl->is_pause = true;
+        return 0;
+    } else if ((c == '#') && (rtttl->semitone >= 0)
+               && (!rtttl->is_pause) && (!rtttl->sharp)) {
+        rtttl->sharp = true;
+        return 0;
+    } else if ((c == '.') && (rtttl->semitone >= 0)) {
+        rtttl->dotted = true;
+        return 0;
+    } else if ((c == ',') || (c == '\n')) {
+        const bool empty = (rtttl->semitone < 0) && (rtttl->duration == 0);
+        const bool have_tone = (!empty) || (c == ',');
+        if (have_tone && (!finish_note(rtttl, tone))) {
+            rtttl_error(rtttl, "invalid note");
+            return -1;
+        }
+        if (c == '\n') {
+            ++rtttl->line_number;
+            rtttl->state     = RTTTL_NAME;
+            rtttl->seen_name = false;
+        }
+        start_note(rtttl);
+        return have_tone ? 1 : 0;
+    }
+    rtttl_error(rtttl, "invalid note, expected [DURATION]NOTE[#][.][OCTAVE]");
+    return -1;
+}
+
+
+ssize_t beep_rtttl_next(beep_rtttl *rtttl, const beep_tone **const tones)
+{
+    size_t count = 0;
+    while ((!rtttl->failed) && (count < BEEP_RTTTL_BATCH)) {
+        if (rtttl->buf_start < rtttl->buf_end) {
+            const int fed = rtttl_feed(rtttl, rtttl->buf[rtttl->buf_start++],
+                                       &rtttl->tones[count]);
+            if (fed > 0) {
+                ++count;
+            }
+            continue;
+        }
+        if (rtttl->eof) {
+            break;
+        }
+        if (count > 0) {
+            /* Play these tones before waiting for more input */
+            break;
+        }
+        const ssize_t bytes = read(rtttl->fd, rtttl->buf, sizeof(rtttl->buf));
+        if (bytes > 0) {
+            rtttl->buf_start = 0;
+            rtttl->buf_end   = (size_t)bytes;
+        } else if (bytes == 0) {
+            /* The end of the file ends the last line */
+            rtttl->eof       = true;
+            rtttl->buf[0]    = '\n';
+            rtttl->buf_start = 0;
+            rtttl->buf_end   = 1;
+        } else if (errno != EINTR) {
+            log_error("%s: %s", rtttl->name, strerror(errno));
+            rtttl->failed = true;
+        }
+    }
+    *tones = rtttl->tones;
+    if ((count == 0) && rtttl->failed) {
+        return -1;
+    }
+    return (ssize_t)count;
+}
+
+
+void beep_rtttl_close(beep_rtttl *rtttl)
+{
+    if (rtttl->fd != STDIN_FILENO) {
+        close(rtttl->fd);
+    }
+    free(rtttl);
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,67 @@
+/* beep-rtttl.h - interface to reading RTTTL ringtones
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_RTTTL_H
+#define BEEP_RTTTL_H
+
+
+#include <sys/types.h>
+
+#include "beep-driver.h"
+
+
+/** Number of tones beep_rtttl_next() returns at most */
+#define BEEP_RTTTL_BATCH 256
+
+
+typedef struct _beep_rtttl beep_rtttl;
+
+
+/** Open a file of RTTTL ringtones, or standard input for "-".
+ * Returns NULL and sets errno on error.
+ */
+beep_rtttl *beep_rtttl_open(const char *const filename)
+    __attribute__(( nonnull(1) ));
+
+
+/** Point *tones to the next tones of the ringtones.
+ *
+ * Returns as soon as some tones are ready, without waiting for more
+ * input.  The tones stay valid until the next call.  Returns the
+ * number of tones, 0 at the end, or -1 after logging an error.  Tones
+ * before an error are returned first.
+ */
+ssize_t beep_rtttl_next(beep_rtttl *rtttl, const beep_tone **const tones)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Close the file and free rtttl */
+void beep_rtttl_close(beep_rtttl *rtttl)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_RTTTL_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,5755 @@
+	.file	"beep-rtttl.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-rtttl.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%s:%lu: %s"
+	.text
+	.type	rtttl_error, @function
+rtttl_error:
+.LVL0:
+.LFB44:
+	.file 1 "beep-rtttl.c"
+	.loc 1 139 1 view -0
+	.cfi_startproc
+	.loc 1 139 1 is_stmt 0 view .LVU1
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	%rsi, %rcx
+	.loc 1 140 5 is_stmt 1 view .LVU2
+	movq	16(%rdi), %rdx
+	movq	8(%rdi), %rsi
+.LVL1:
+	.loc 1 140 5 is_stmt 0 view .LVU3
+	leaq	.LC0(%rip), %rdi
+.LVL2:
+	.loc 1 140 5 view .LVU4
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL3:
+	.loc 1 141 5 is_stmt 1 view .LVU5
+	.loc 1 141 19 is_stmt 0 view .LVU6
+	movb	$1, 25(%rbx)
+	.loc 1 142 1 view .LVU7
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL4:
+	.loc 1 142 1 view .LVU8
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	rtttl_error, .-rtttl_error
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"expected :NOTES after the defaults"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"expected NAME:DEFAULTS:NOTES"
+.LC3:
+	.string	"expected d=, o= or b= default"
+.LC4:
+	.string	"expected = after default name"
+.LC5:
+	.string	"default value too large"
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"expected digits of default value"
+	.section	.rodata.str1.1
+.LC7:
+	.string	"invalid default value"
+.LC8:
+	.string	"invalid note duration"
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"invalid note, expected [DURATION]NOTE[#][.][OCTAVE]"
+	.section	.rodata.str1.1
+.LC10:
+	.string	"invalid note"
+	.text
+	.type	rtttl_feed, @function
+rtttl_feed:
+.LVL5:
+.LFB49:
+	.loc 1 225 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 225 1 is_stmt 0 view .LVU10
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 227 5 is_stmt 1 view .LVU11
+	.loc 1 229 5 view .LVU12
+	.loc 1 229 26 is_stmt 0 view .LVU13
+	movl	%esi, %eax
+	andl	$-5, %eax
+	.loc 1 229 35 view .LVU14
+	cmpb	$9, %al
+	je	.L54
+	movq	%rdi, %rbp
+	movl	%esi, %ebx
+	movq	%rdx, %r13
+	cmpb	$32, %sil
+	je	.L54
+	.loc 1 232 5 is_stmt 1 view .LVU15
+	.loc 1 232 8 is_stmt 0 view .LVU16
+	cmpb	$10, %sil
+	je	.L68
+	.loc 1 238 5 is_stmt 1 view .LVU17
+	.loc 1 238 18 is_stmt 0 view .LVU18
+	movl	28(%rdi), %eax
+	.loc 1 238 5 view .LVU19
+	cmpl	$2, %eax
+	je	.L7
+	ja	.L8
+	testl	%eax, %eax
+	je	.L69
+	.loc 1 257 9 is_stmt 1 view .LVU20
+	.loc 1 257 12 is_stmt 0 view .LVU21
+	cmpb	$58, %sil
+	jne	.L14
+	.loc 1 258 13 is_stmt 1 view .LVU22
+	movl	48(%rdi), %esi
+.LVL6:
+	.loc 1 258 13 is_stmt 0 view .LVU23
+	leaq	56(%rdi), %rdi
+.LVL7:
+	.loc 1 258 13 view .LVU24
+	call	beep_tempo_init@PLT
+.LVL8:
+	.loc 1 259 13 is_stmt 1 view .LVU25
+.LBB23:
+.LBI23:
+	.loc 1 153 6 view .LVU26
+.LBB24:
+	.loc 1 155 5 view .LVU27
+	.loc 1 155 21 is_stmt 0 view .LVU28
+	movl	$0, 72(%rbp)
+	.loc 1 156 5 is_stmt 1 view .LVU29
+	.loc 1 156 21 is_stmt 0 view .LVU30
+	movl	$-1, 76(%rbp)
+	.loc 1 157 5 is_stmt 1 view .LVU31
+	.loc 1 157 21 is_stmt 0 view .LVU32
+	movb	$0, 80(%rbp)
+	.loc 1 158 5 is_stmt 1 view .LVU33
+	.loc 1 158 18 is_stmt 0 view .LVU34
+	movb	$0, 81(%rbp)
+	.loc 1 159 5 is_stmt 1 view .LVU35
+	.loc 1 159 19 is_stmt 0 view .LVU36
+	movb	$0, 82(%rbp)
+	.loc 1 160 5 is_stmt 1 view .LVU37
+	.loc 1 160 19 is_stmt 0 view .LVU38
+	movl	$-1, 84(%rbp)
+.LVL9:
+	.loc 1 160 19 view .LVU39
+.LBE24:
+.LBE23:
+	.loc 1 260 13 is_stmt 1 view .LVU40
+	.loc 1 260 26 is_stmt 0 view .LVU41
+	movl	$4, 28(%rbp)
+	.loc 1 271 16 view .LVU42
+	movl	$0, %r12d
+	jmp	.L3
+.LVL10:
+.L68:
+	.loc 1 232 30 discriminator 1 view .LVU43
+	movl	28(%rdi), %eax
+	.loc 1 233 9 discriminator 1 view .LVU44
+	testl	$-5, %eax
+	jne	.L70
+	.loc 1 238 5 is_stmt 1 view .LVU45
+	cmpl	$2, %eax
+	je	.L45
+	ja	.L46
+	testl	%eax, %eax
+	je	.L47
+	cmpl	$1, %eax
+	jne	.L71
+.L48:
+	.loc 1 238 5 is_stmt 0 view .LVU46
+	leal	-66(%rbx), %ecx
+	cmpb	$45, %cl
+	ja	.L15
+	movl	$1, %eax
+	salq	%cl, %rax
+	testl	$8197, %eax
+	jne	.L16
+	movabsq	$35205846925312, %rdx
+.LVL11:
+	.loc 1 238 5 view .LVU47
+	testq	%rdx, %rax
+	jne	.L72
+.L15:
+	.loc 1 268 13 is_stmt 1 view .LVU48
+	leaq	.LC3(%rip), %rsi
+.LVL12:
+	.loc 1 268 13 is_stmt 0 view .LVU49
+	movq	%rbp, %rdi
+.LVL13:
+	.loc 1 268 13 view .LVU50
+	call	rtttl_error
+.LVL14:
+	.loc 1 269 13 is_stmt 1 view .LVU51
+	.loc 1 269 20 is_stmt 0 view .LVU52
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL15:
+.L70:
+	.loc 1 234 9 is_stmt 1 view .LVU53
+	leaq	.LC1(%rip), %rsi
+.LVL16:
+	.loc 1 234 9 is_stmt 0 view .LVU54
+	call	rtttl_error
+.LVL17:
+	.loc 1 235 9 is_stmt 1 view .LVU55
+	.loc 1 235 16 is_stmt 0 view .LVU56
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL18:
+.L8:
+	.loc 1 238 5 view .LVU57
+	cmpl	$3, %eax
+	jne	.L73
+	.loc 1 283 9 is_stmt 1 view .LVU58
+	.loc 1 283 24 is_stmt 0 view .LVU59
+	leal	-48(%rbx), %eax
+	.loc 1 283 12 view .LVU60
+	cmpb	$9, %al
+	ja	.L18
+	.loc 1 284 13 is_stmt 1 view .LVU61
+	.loc 1 284 31 is_stmt 0 view .LVU62
+	movl	36(%rdi), %eax
+	leal	(%rax,%rax,4), %eax
+	.loc 1 284 46 view .LVU63
+	movsbl	%sil, %ebx
+	leal	-48(%rbx,%rax,2), %eax
+	.loc 1 284 26 view .LVU64
+	movl	%eax, 36(%rdi)
+	.loc 1 285 13 is_stmt 1 view .LVU65
+	.loc 1 285 16 is_stmt 0 view .LVU66
+	cmpl	$9999, %eax
+	ja	.L74
+	.loc 1 289 20 view .LVU67
+	movl	$0, %r12d
+	jmp	.L3
+.L86:
+	.loc 1 241 13 is_stmt 1 view .LVU68
+	.loc 1 241 26 is_stmt 0 view .LVU69
+	movl	$1, 28(%rbp)
+	.loc 1 242 13 is_stmt 1 view .LVU70
+	.loc 1 242 37 is_stmt 0 view .LVU71
+	movl	$4, 40(%rbp)
+	.loc 1 243 13 is_stmt 1 view .LVU72
+	.loc 1 243 35 is_stmt 0 view .LVU73
+	movl	$6, 44(%rbp)
+	.loc 1 244 13 is_stmt 1 view .LVU74
+	.loc 1 244 24 is_stmt 0 view .LVU75
+	movl	$63, 48(%rbp)
+	.loc 1 254 16 view .LVU76
+	movl	$0, %r12d
+	jmp	.L3
+.L47:
+	.loc 1 240 9 is_stmt 1 view .LVU77
+	.loc 1 246 13 view .LVU78
+	.loc 1 246 16 is_stmt 0 view .LVU79
+	cmpb	$0, 32(%rbp)
+	jne	.L75
+	.loc 1 250 13 is_stmt 1 view .LVU80
+	addq	$1, 16(%rbp)
+	.loc 1 254 16 is_stmt 0 view .LVU81
+	movl	$0, %r12d
+	jmp	.L3
+.L75:
+	.loc 1 247 17 is_stmt 1 view .LVU82
+	leaq	.LC2(%rip), %rsi
+.LVL19:
+	.loc 1 247 17 is_stmt 0 view .LVU83
+	movq	%rbp, %rdi
+.LVL20:
+	.loc 1 247 17 view .LVU84
+	call	rtttl_error
+.LVL21:
+	.loc 1 248 17 is_stmt 1 view .LVU85
+	.loc 1 248 24 is_stmt 0 view .LVU86
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL22:
+.L14:
+	.loc 1 261 16 is_stmt 1 view .LVU87
+	cmpb	$44, %sil
+	jne	.L48
+	.loc 1 257 12 is_stmt 0 view .LVU88
+	movl	$0, %r12d
+	jmp	.L3
+.LVL23:
+.L72:
+	.loc 1 262 13 is_stmt 1 view .LVU89
+	.loc 1 262 24 is_stmt 0 view .LVU90
+	movb	%bl, 33(%rbp)
+	.loc 1 263 13 is_stmt 1 view .LVU91
+	.loc 1 263 26 is_stmt 0 view .LVU92
+	movl	$2, 28(%rbp)
+	.loc 1 271 16 view .LVU93
+	movl	$0, %r12d
+	.loc 1 263 26 view .LVU94
+	jmp	.L3
+.LVL24:
+.L16:
+	.loc 1 265 13 is_stmt 1 view .LVU95
+	.loc 1 265 41 is_stmt 0 view .LVU96
+	addl	$32, %ebx
+	movb	%bl, 33(%rbp)
+	.loc 1 266 13 is_stmt 1 view .LVU97
+	.loc 1 266 26 is_stmt 0 view .LVU98
+	movl	$2, 28(%rbp)
+	.loc 1 271 16 view .LVU99
+	movl	$0, %r12d
+	.loc 1 266 26 view .LVU100
+	jmp	.L3
+.L7:
+	.loc 1 274 9 is_stmt 1 view .LVU101
+	.loc 1 274 12 is_stmt 0 view .LVU102
+	cmpb	$61, %sil
+	jne	.L45
+	.loc 1 278 9 is_stmt 1 view .LVU103
+	.loc 1 278 22 is_stmt 0 view .LVU104
+	movl	$0, 36(%rdi)
+	.loc 1 279 9 is_stmt 1 view .LVU105
+	.loc 1 279 22 is_stmt 0 view .LVU106
+	movl	$3, 28(%rdi)
+	.loc 1 280 9 is_stmt 1 view .LVU107
+	.loc 1 280 16 is_stmt 0 view .LVU108
+	movl	$0, %r12d
+	jmp	.L3
+.L45:
+	.loc 1 275 13 is_stmt 1 view .LVU109
+	leaq	.LC4(%rip), %rsi
+.LVL25:
+	.loc 1 275 13 is_stmt 0 view .LVU110
+	movq	%rbp, %rdi
+.LVL26:
+	.loc 1 275 13 view .LVU111
+	call	rtttl_error
+.LVL27:
+	.loc 1 276 13 is_stmt 1 view .LVU112
+	.loc 1 276 20 is_stmt 0 view .LVU113
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL28:
+.L74:
+	.loc 1 286 17 is_stmt 1 view .LVU114
+	leaq	.LC5(%rip), %rsi
+.LVL29:
+	.loc 1 286 17 is_stmt 0 view .LVU115
+	call	rtttl_error
+.LVL30:
+	.loc 1 287 17 is_stmt 1 view .LVU116
+	.loc 1 287 24 is_stmt 0 view .LVU117
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL31:
+.L82:
+	.loc 1 292 13 is_stmt 1 view .LVU118
+	leaq	.LC6(%rip), %rsi
+.LVL32:
+	.loc 1 292 13 is_stmt 0 view .LVU119
+	movq	%rbp, %rdi
+.LVL33:
+	.loc 1 292 13 view .LVU120
+	call	rtttl_error
+.LVL34:
+	.loc 1 293 13 is_stmt 1 view .LVU121
+	.loc 1 293 20 is_stmt 0 view .LVU122
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL35:
+.L20:
+.LBB25:
+.LBB26:
+	.loc 1 170 9 is_stmt 1 view .LVU123
+	.loc 1 170 40 is_stmt 0 view .LVU124
+	movl	36(%rbp), %eax
+	.loc 1 170 33 view .LVU125
+	movl	%eax, 40(%rbp)
+	.loc 1 171 9 is_stmt 1 view .LVU126
+.LVL36:
+.LBB27:
+.LBI27:
+	.loc 1 146 5 view .LVU127
+.LBB28:
+	.loc 1 148 5 view .LVU128
+	.loc 1 148 27 is_stmt 0 view .LVU129
+	leal	-1(%rax), %edx
+.LVL37:
+	.loc 1 148 47 view .LVU130
+	cmpl	$31, %edx
+	ja	.L23
+.LVL38:
+	.loc 1 148 47 view .LVU131
+.LBE28:
+.LBE27:
+.LBE26:
+.LBE25:
+	.loc 1 295 12 view .LVU132
+	testl	%edx, %eax
+	jne	.L23
+.L24:
+	.loc 1 299 9 is_stmt 1 view .LVU133
+	.loc 1 299 22 is_stmt 0 view .LVU134
+	movl	$1, 28(%rbp)
+	.loc 1 300 9 is_stmt 1 view .LVU135
+	.loc 1 303 16 is_stmt 0 view .LVU136
+	movl	$0, %r12d
+	.loc 1 300 12 view .LVU137
+	cmpb	$58, %bl
+	jne	.L3
+	.loc 1 301 13 is_stmt 1 view .LVU138
+	.loc 1 301 20 is_stmt 0 view .LVU139
+	movq	%r13, %rdx
+	movl	$58, %esi
+.LVL39:
+	.loc 1 301 20 view .LVU140
+	movq	%rbp, %rdi
+.LVL40:
+	.loc 1 301 20 view .LVU141
+	call	rtttl_feed
+.LVL41:
+	movl	%eax, %r12d
+	jmp	.L3
+.LVL42:
+.L21:
+.LBB31:
+.LBB29:
+	.loc 1 173 9 is_stmt 1 view .LVU142
+	.loc 1 173 38 is_stmt 0 view .LVU143
+	movl	36(%rbp), %eax
+	.loc 1 173 31 view .LVU144
+	movl	%eax, 44(%rbp)
+	.loc 1 174 9 is_stmt 1 view .LVU145
+	.loc 1 174 30 is_stmt 0 view .LVU146
+	cmpl	$9, %eax
+	setbe	%al
+.L25:
+.LVL43:
+	.loc 1 174 30 view .LVU147
+.LBE29:
+.LBE31:
+	.loc 1 295 12 view .LVU148
+	testb	%al, %al
+	jne	.L24
+.LVL44:
+.L23:
+	.loc 1 296 13 is_stmt 1 view .LVU149
+	leaq	.LC7(%rip), %rsi
+.LVL45:
+	.loc 1 296 13 is_stmt 0 view .LVU150
+	movq	%rbp, %rdi
+.LVL46:
+	.loc 1 296 13 view .LVU151
+	call	rtttl_error
+.LVL47:
+	.loc 1 297 13 is_stmt 1 view .LVU152
+	.loc 1 297 20 is_stmt 0 view .LVU153
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL48:
+.L73:
+	.loc 1 309 5 is_stmt 1 view .LVU154
+	.loc 1 309 20 is_stmt 0 view .LVU155
+	movl	%esi, %eax
+	leal	-48(%rbx), %edx
+.LVL49:
+	.loc 1 309 8 view .LVU156
+	cmpb	$9, %dl
+	ja	.L26
+.LVL50:
+	.loc 1 310 9 is_stmt 1 view .LVU157
+	.loc 1 310 12 is_stmt 0 view .LVU158
+	cmpl	$0, 76(%rdi)
+	js	.L76
+	.loc 1 318 9 is_stmt 1 view .LVU159
+	.loc 1 318 12 is_stmt 0 view .LVU160
+	cmpl	$0, 84(%rdi)
+	jns	.L28
+	.loc 1 319 13 is_stmt 1 view .LVU161
+	.loc 1 319 31 is_stmt 0 view .LVU162
+	movsbl	%sil, %ebx
+	subl	$48, %ebx
+	movl	%ebx, 84(%rdi)
+	.loc 1 320 13 is_stmt 1 view .LVU163
+	.loc 1 320 20 is_stmt 0 view .LVU164
+	movl	$0, %r12d
+	jmp	.L3
+.L76:
+	.loc 1 311 13 is_stmt 1 view .LVU165
+	.loc 1 311 34 is_stmt 0 view .LVU166
+	movl	72(%rdi), %eax
+.LVL51:
+	.loc 1 311 34 view .LVU167
+	leal	(%rax,%rax,4), %eax
+	.loc 1 311 52 view .LVU168
+	movsbl	%sil, %ebx
+	leal	-48(%rbx,%rax,2), %eax
+	.loc 1 311 29 view .LVU169
+	movl	%eax, 72(%rdi)
+	.loc 1 312 13 is_stmt 1 view .LVU170
+	.loc 1 312 16 is_stmt 0 view .LVU171
+	cmpl	$32, %eax
+	ja	.L77
+	.loc 1 316 20 view .LVU172
+	movl	$0, %r12d
+	jmp	.L3
+.L77:
+	.loc 1 313 17 is_stmt 1 view .LVU173
+	leaq	.LC8(%rip), %rsi
+.LVL52:
+	.loc 1 313 17 is_stmt 0 view .LVU174
+	call	rtttl_error
+.LVL53:
+	.loc 1 314 17 is_stmt 1 view .LVU175
+	.loc 1 314 24 is_stmt 0 view .LVU176
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL54:
+.L26:
+	.loc 1 322 12 is_stmt 1 view .LVU177
+	.loc 1 322 27 is_stmt 0 view .LVU178
+	leal	-97(%rbx), %edx
+	.loc 1 322 15 view .LVU179
+	cmpb	$7, %dl
+	ja	.L29
+	.loc 1 322 41 discriminator 1 view .LVU180
+	cmpl	$0, 76(%rdi)
+	js	.L78
+	.loc 1 328 12 is_stmt 1 view .LVU181
+	.loc 1 328 34 is_stmt 0 view .LVU182
+	andl	$-33, %eax
+.LVL55:
+	.loc 1 328 15 view .LVU183
+	cmpb	$80, %al
+	jne	.L33
+.L34:
+	.loc 1 336 12 is_stmt 1 view .LVU184
+	.loc 1 336 15 is_stmt 0 view .LVU185
+	cmpb	$46, %bl
+	jne	.L32
+	.loc 1 336 27 discriminator 1 view .LVU186
+	cmpl	$0, 76(%rbp)
+	jns	.L79
+.L28:
+	.loc 1 354 5 is_stmt 1 view .LVU187
+	leaq	.LC9(%rip), %rsi
+.LVL56:
+	.loc 1 354 5 is_stmt 0 view .LVU188
+	movq	%rbp, %rdi
+.LVL57:
+	.loc 1 354 5 view .LVU189
+	call	rtttl_error
+.LVL58:
+	.loc 1 355 5 is_stmt 1 view .LVU190
+	.loc 1 355 12 is_stmt 0 view .LVU191
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL59:
+.L78:
+	.loc 1 323 9 is_stmt 1 view .LVU192
+	.loc 1 323 46 is_stmt 0 view .LVU193
+	movsbl	%sil, %eax
+.LVL60:
+	.loc 1 323 46 view .LVU194
+	subl	$97, %eax
+	.loc 1 323 43 view .LVU195
+	cltq
+	.loc 1 323 25 view .LVU196
+	leaq	letter_semitones.0(%rip), %rdx
+	movl	(%rdx,%rax,4), %eax
+	movl	%eax, 76(%rdi)
+	.loc 1 324 9 is_stmt 1 view .LVU197
+	.loc 1 324 16 is_stmt 0 view .LVU198
+	movl	$0, %r12d
+	jmp	.L3
+.L83:
+	.loc 1 326 9 is_stmt 1 view .LVU199
+	.loc 1 326 46 is_stmt 0 view .LVU200
+	movsbl	%bl, %eax
+	subl	$65, %eax
+	.loc 1 326 43 view .LVU201
+	cltq
+	.loc 1 326 25 view .LVU202
+	leaq	letter_semitones.0(%rip), %rdx
+	movl	(%rdx,%rax,4), %eax
+	movl	%eax, 76(%rbp)
+	.loc 1 327 9 is_stmt 1 view .LVU203
+	.loc 1 327 16 is_stmt 0 view .LVU204
+	movl	$0, %r12d
+	jmp	.L3
+.L31:
+	.loc 1 328 12 is_stmt 1 view .LVU205
+	.loc 1 328 34 is_stmt 0 view .LVU206
+	movl	%ebx, %eax
+	andl	$-33, %eax
+	.loc 1 328 15 view .LVU207
+	cmpb	$80, %al
+	jne	.L33
+	.loc 1 328 43 discriminator 1 view .LVU208
+	cmpl	$0, 76(%rbp)
+	jns	.L34
+	.loc 1 329 9 is_stmt 1 view .LVU209
+	.loc 1 329 25 is_stmt 0 view .LVU210
+	movl	$0, 76(%rbp)
+	.loc 1 330 9 is_stmt 1 view .LVU211
+	.loc 1 330 25 is_stmt 0 view .LVU212
+	movb	$1, 80(%rbp)
+	.loc 1 331 9 is_stmt 1 view .LVU213
+	.loc 1 331 16 is_stmt 0 view .LVU214
+	movl	$0, %r12d
+	jmp	.L3
+.L33:
+	.loc 1 332 12 is_stmt 1 view .LVU215
+	.loc 1 332 15 is_stmt 0 view .LVU216
+	cmpb	$35, %bl
+	jne	.L34
+	.loc 1 332 27 discriminator 1 view .LVU217
+	cmpl	$0, 76(%rbp)
+	js	.L28
+	.loc 1 333 16 view .LVU218
+	cmpb	$0, 80(%rbp)
+	jne	.L28
+	.loc 1 333 38 discriminator 1 view .LVU219
+	cmpb	$0, 81(%rbp)
+	jne	.L32
+	.loc 1 334 9 is_stmt 1 view .LVU220
+	.loc 1 334 22 is_stmt 0 view .LVU221
+	movb	$1, 81(%rbp)
+	.loc 1 335 9 is_stmt 1 view .LVU222
+	.loc 1 335 16 is_stmt 0 view .LVU223
+	movl	$0, %r12d
+	jmp	.L3
+.L79:
+	.loc 1 337 9 is_stmt 1 view .LVU224
+	.loc 1 337 23 is_stmt 0 view .LVU225
+	movb	$1, 82(%rbp)
+	.loc 1 338 9 is_stmt 1 view .LVU226
+	.loc 1 338 16 is_stmt 0 view .LVU227
+	movl	$0, %r12d
+	jmp	.L3
+.L84:
+.LVL61:
+.LBB32:
+	.loc 1 341 9 is_stmt 1 discriminator 1 view .LVU228
+	.loc 1 341 32 is_stmt 0 discriminator 1 view .LVU229
+	cmpl	$0, 72(%rbp)
+	setne	%al
+	.loc 1 341 40 discriminator 1 view .LVU230
+	orl	%ecx, %eax
+	movzbl	%al, %r12d
+.LVL62:
+	.loc 1 342 9 is_stmt 1 discriminator 1 view .LVU231
+	.loc 1 342 12 is_stmt 0 discriminator 1 view .LVU232
+	testb	%al, %al
+	jne	.L80
+.LVL63:
+.L39:
+	.loc 1 347 13 is_stmt 1 view .LVU233
+	addq	$1, 16(%rbp)
+	.loc 1 348 13 view .LVU234
+	.loc 1 348 26 is_stmt 0 view .LVU235
+	movl	$0, 28(%rbp)
+	.loc 1 349 13 is_stmt 1 view .LVU236
+	.loc 1 349 30 is_stmt 0 view .LVU237
+	movb	$0, 32(%rbp)
+	jmp	.L44
+.LVL64:
+.L85:
+.LBB33:
+.LBB34:
+.LBB35:
+	.loc 1 207 29 view .LVU238
+	movl	44(%rbp), %eax
+	jmp	.L43
+.LVL65:
+.L54:
+	.loc 1 207 29 view .LVU239
+.LBE35:
+.LBE34:
+.LBE33:
+.LBE32:
+	.loc 1 230 16 view .LVU240
+	movl	$0, %r12d
+.LVL66:
+.L3:
+	.loc 1 356 1 view .LVU241
+	movl	%r12d, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL67:
+.L59:
+	.cfi_restore_state
+.LBB51:
+.LBB45:
+.LBB40:
+	.loc 1 356 1 view .LVU242
+	movl	%r14d, %eax
+.L42:
+.LBB36:
+	.loc 1 213 20 view .LVU243
+	movl	%eax, 0(%r13)
+	.loc 1 214 21 view .LVU244
+	movl	%r14d, 12(%r13)
+.LVL68:
+	.loc 1 214 21 view .LVU245
+.LBE36:
+.LBE40:
+.LBE45:
+	.loc 1 346 9 is_stmt 1 view .LVU246
+	.loc 1 346 12 is_stmt 0 view .LVU247
+	cmpb	$10, %bl
+	je	.L39
+.LVL69:
+.L44:
+	.loc 1 351 9 is_stmt 1 view .LVU248
+.LBB46:
+.LBI46:
+	.loc 1 153 6 view .LVU249
+.LBB47:
+	.loc 1 155 5 view .LVU250
+	.loc 1 155 21 is_stmt 0 view .LVU251
+	movl	$0, 72(%rbp)
+	.loc 1 156 5 is_stmt 1 view .LVU252
+	.loc 1 156 21 is_stmt 0 view .LVU253
+	movl	$-1, 76(%rbp)
+	.loc 1 157 5 is_stmt 1 view .LVU254
+	.loc 1 157 21 is_stmt 0 view .LVU255
+	movb	$0, 80(%rbp)
+	.loc 1 158 5 is_stmt 1 view .LVU256
+	.loc 1 158 18 is_stmt 0 view .LVU257
+	movb	$0, 81(%rbp)
+	.loc 1 159 5 is_stmt 1 view .LVU258
+	.loc 1 159 19 is_stmt 0 view .LVU259
+	movb	$0, 82(%rbp)
+	.loc 1 160 5 is_stmt 1 view .LVU260
+	.loc 1 160 19 is_stmt 0 view .LVU261
+	movl	$-1, 84(%rbp)
+	.loc 1 161 1 view .LVU262
+	jmp	.L3
+.LVL70:
+.L71:
+	.loc 1 161 1 view .LVU263
+.LBE47:
+.LBE46:
+.LBE51:
+	.loc 1 309 20 view .LVU264
+	movl	$10, %eax
+	jmp	.L29
+.L46:
+	.loc 1 238 5 view .LVU265
+	cmpl	$3, %eax
+	jne	.L81
+.L18:
+	.loc 1 291 9 is_stmt 1 view .LVU266
+	.loc 1 291 12 is_stmt 0 view .LVU267
+	cmpb	$44, %bl
+	je	.L19
+	cmpb	$58, %bl
+	jne	.L82
+.L19:
+	.loc 1 295 9 is_stmt 1 view .LVU268
+.LVL71:
+.LBB52:
+.LBI25:
+	.loc 1 166 5 view .LVU269
+.LBB30:
+	.loc 1 168 5 view .LVU270
+	.loc 1 168 18 is_stmt 0 view .LVU271
+	movzbl	33(%rbp), %eax
+	.loc 1 168 5 view .LVU272
+	cmpb	$100, %al
+	je	.L20
+	cmpb	$111, %al
+	je	.L21
+	.loc 1 176 9 is_stmt 1 view .LVU273
+	.loc 1 176 27 is_stmt 0 view .LVU274
+	movl	36(%rbp), %eax
+	.loc 1 176 20 view .LVU275
+	movl	%eax, 48(%rbp)
+	.loc 1 177 9 is_stmt 1 view .LVU276
+	.loc 1 177 37 is_stmt 0 view .LVU277
+	subl	$20, %eax
+	cmpl	$980, %eax
+	setbe	%al
+	jmp	.L25
+.LVL72:
+.L81:
+	.loc 1 177 37 view .LVU278
+.LBE30:
+.LBE52:
+	.loc 1 309 20 view .LVU279
+	movl	$10, %eax
+.LVL73:
+.L29:
+	.loc 1 325 12 is_stmt 1 view .LVU280
+	.loc 1 325 27 is_stmt 0 view .LVU281
+	subl	$65, %eax
+	.loc 1 325 15 view .LVU282
+	cmpb	$7, %al
+	ja	.L31
+	.loc 1 325 41 discriminator 1 view .LVU283
+	cmpl	$0, 76(%rbp)
+	js	.L83
+.L32:
+	.loc 1 339 12 is_stmt 1 view .LVU284
+	.loc 1 339 19 is_stmt 0 view .LVU285
+	cmpb	$44, %bl
+	sete	%cl
+	.loc 1 339 15 view .LVU286
+	cmpb	$10, %bl
+	je	.L61
+	testb	%cl, %cl
+	je	.L28
+.L61:
+.LBB53:
+	.loc 1 340 9 is_stmt 1 view .LVU287
+	.loc 1 340 33 is_stmt 0 view .LVU288
+	movl	76(%rbp), %edx
+	.loc 1 340 49 view .LVU289
+	testl	%edx, %edx
+	js	.L84
+.LVL74:
+.LBB48:
+.LBI33:
+	.loc 1 186 5 is_stmt 1 view .LVU290
+.LBB41:
+	.loc 1 188 5 view .LVU291
+	.loc 1 189 14 is_stmt 0 view .LVU292
+	movl	72(%rbp), %ecx
+.LBE41:
+.LBE48:
+	.loc 1 341 40 view .LVU293
+	movl	$1, %r12d
+.LBB49:
+.LBB42:
+	.loc 1 189 43 view .LVU294
+	testl	%ecx, %ecx
+	je	.L49
+.LBE42:
+.LBE49:
+	.loc 1 341 40 view .LVU295
+	movl	$1, %r12d
+.L50:
+.LVL75:
+.LBB50:
+.LBB43:
+.LBB37:
+.LBI37:
+	.loc 1 146 5 is_stmt 1 view .LVU296
+.LBB38:
+	.loc 1 148 5 view .LVU297
+	.loc 1 148 27 is_stmt 0 view .LVU298
+	leal	-1(%rcx), %r14d
+	.loc 1 148 47 view .LVU299
+	cmpl	$31, %r14d
+	ja	.L40
+.LVL76:
+	.loc 1 148 47 view .LVU300
+.LBE38:
+.LBE37:
+	.loc 1 190 31 view .LVU301
+	andl	%ecx, %r14d
+	jne	.L40
+	.loc 1 195 5 is_stmt 1 view .LVU302
+	.loc 1 195 18 is_stmt 0 view .LVU303
+	movl	$3840, %eax
+	movl	$0, %edx
+	divl	%ecx
+	movl	%eax, %esi
+.LVL77:
+	.loc 1 196 5 is_stmt 1 view .LVU304
+	.loc 1 196 8 is_stmt 0 view .LVU305
+	cmpb	$0, 82(%rbp)
+	je	.L41
+	.loc 1 197 9 is_stmt 1 view .LVU306
+	.loc 1 197 24 is_stmt 0 view .LVU307
+	shrl	%esi
+	.loc 1 197 15 view .LVU308
+	addl	%eax, %esi
+.LVL78:
+.L41:
+	.loc 1 199 5 is_stmt 1 view .LVU309
+	.loc 1 199 20 is_stmt 0 view .LVU310
+	orl	$-2147483648, %esi
+.LVL79:
+	.loc 1 199 20 view .LVU311
+	leaq	56(%rbp), %rdi
+.LVL80:
+	.loc 1 199 20 view .LVU312
+	call	beep_tempo_ms@PLT
+.LVL81:
+	.loc 1 199 18 view .LVU313
+	movl	%eax, 4(%r13)
+	.loc 1 200 5 is_stmt 1 view .LVU314
+	.loc 1 200 17 is_stmt 0 view .LVU315
+	movl	$0, 8(%r13)
+	.loc 1 202 5 is_stmt 1 view .LVU316
+	.loc 1 202 8 is_stmt 0 view .LVU317
+	cmpb	$0, 80(%rbp)
+	jne	.L59
+.LBB39:
+	.loc 1 206 9 is_stmt 1 view .LVU318
+	.loc 1 206 34 is_stmt 0 view .LVU319
+	movl	84(%rbp), %eax
+	.loc 1 207 29 view .LVU320
+	testl	%eax, %eax
+	js	.L85
+.L43:
+.LVL82:
+	.loc 1 208 9 is_stmt 1 view .LVU321
+	.loc 1 208 29 is_stmt 0 view .LVU322
+	leal	3(%rax,%rax,2), %edx
+	.loc 1 208 44 view .LVU323
+	movl	76(%rbp), %eax
+.LVL83:
+	.loc 1 208 44 view .LVU324
+	leal	(%rax,%rdx,4), %r14d
+	.loc 1 209 33 view .LVU325
+	movzbl	81(%rbp), %eax
+	.loc 1 208 19 view .LVU326
+	addl	%eax, %r14d
+.LVL84:
+	.loc 1 210 9 is_stmt 1 view .LVU327
+	.loc 1 210 12 is_stmt 0 view .LVU328
+	cmpl	$127, %r14d
+	jg	.L40
+	.loc 1 213 9 is_stmt 1 view .LVU329
+	.loc 1 213 22 is_stmt 0 view .LVU330
+	movl	%r14d, %edi
+	call	beep_note_freq_hz@PLT
+.LVL85:
+	.loc 1 214 9 is_stmt 1 view .LVU331
+	.loc 1 214 30 is_stmt 0 view .LVU332
+	orl	$256, %r14d
+.LVL86:
+	.loc 1 214 30 view .LVU333
+	jmp	.L42
+.LVL87:
+.L80:
+	.loc 1 214 30 view .LVU334
+.LBE39:
+.LBE43:
+	.loc 1 186 5 is_stmt 1 view .LVU335
+.LBB44:
+	.loc 1 188 5 view .LVU336
+	.loc 1 189 43 is_stmt 0 view .LVU337
+	cmpl	$0, 72(%rbp)
+	jne	.L40
+.L49:
+	.loc 1 189 43 view .LVU338
+	movl	40(%rbp), %ecx
+.LVL88:
+	.loc 1 190 5 is_stmt 1 view .LVU339
+	.loc 1 190 8 is_stmt 0 view .LVU340
+	testl	%edx, %edx
+	jns	.L50
+.LVL89:
+.L40:
+	.loc 1 190 8 view .LVU341
+.LBE44:
+.LBE50:
+	.loc 1 343 13 is_stmt 1 view .LVU342
+	leaq	.LC10(%rip), %rsi
+	movq	%rbp, %rdi
+	call	rtttl_error
+.LVL90:
+	.loc 1 344 13 view .LVU343
+	.loc 1 344 20 is_stmt 0 view .LVU344
+	movl	$-1, %r12d
+	jmp	.L3
+.LVL91:
+.L69:
+	.loc 1 344 20 view .LVU345
+.LBE53:
+	.loc 1 240 9 is_stmt 1 view .LVU346
+	.loc 1 240 12 is_stmt 0 view .LVU347
+	cmpb	$58, %sil
+	je	.L86
+	.loc 1 252 13 is_stmt 1 view .LVU348
+	.loc 1 252 30 is_stmt 0 view .LVU349
+	movb	$1, 32(%rbp)
+	.loc 1 254 16 view .LVU350
+	movl	$0, %r12d
+	jmp	.L3
+	.cfi_endproc
+.LFE49:
+	.size	rtttl_feed, .-rtttl_feed
+	.section	.rodata.str1.1
+.LC11:
+	.string	"-"
+.LC12:
+	.string	"rtttl: reading %s"
+	.text
+	.globl	beep_rtttl_open
+	.type	beep_rtttl_open, @function
+beep_rtttl_open:
+.LVL92:
+.LFB43:
+	.loc 1 106 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 106 1 is_stmt 0 view .LVU352
+	endbr64
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12
+	.loc 1 107 5 is_stmt 1 view .LVU353
+.LVL93:
+	.loc 1 108 5 view .LVU354
+	.loc 1 108 14 is_stmt 0 view .LVU355
+	leaq	.LC11(%rip), %rsi
+	call	strcmp@PLT
+.LVL94:
+	.loc 1 108 8 view .LVU356
+	testl	%eax, %eax
+	je	.L88
+	.loc 1 109 9 is_stmt 1 view .LVU357
+.LVL95:
+.LBB54:
+.LBI54:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 2 41 1 view .LVU358
+.LBB55:
+	.loc 2 43 3 view .LVU359
+	.loc 2 46 3 view .LVU360
+	.loc 2 48 7 view .LVU361
+	.loc 2 53 7 view .LVU362
+	.loc 2 53 14 is_stmt 0 view .LVU363
+	movl	$524288, %esi
+	movq	%r12, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL96:
+	movl	%eax, %ebp
+.LVL97:
+	.loc 2 53 14 view .LVU364
+.LBE55:
+.LBE54:
+	.loc 1 110 9 is_stmt 1 view .LVU365
+	.loc 1 110 12 is_stmt 0 view .LVU366
+	cmpl	$-1, %eax
+	je	.L93
+	.loc 1 114 5 is_stmt 1 view .LVU367
+	.loc 1 114 31 is_stmt 0 view .LVU368
+	movl	$69736, %edi
+	call	malloc@PLT
+.LVL98:
+	.loc 1 114 31 view .LVU369
+	movq	%rax, %rbx
+.LVL99:
+	.loc 1 115 5 is_stmt 1 view .LVU370
+	.loc 1 115 8 is_stmt 0 view .LVU371
+	testq	%rax, %rax
+	jne	.L90
+.LBB56:
+	.loc 1 116 9 is_stmt 1 view .LVU372
+	.loc 1 116 34 is_stmt 0 view .LVU373
+	call	__errno_location@PLT
+.LVL100:
+	.loc 1 116 34 view .LVU374
+	movq	%rax, %rbx
+.LVL101:
+	.loc 1 116 19 view .LVU375
+	movl	(%rax), %r12d
+.LVL102:
+	.loc 1 117 9 is_stmt 1 view .LVU376
+	.loc 1 117 12 is_stmt 0 view .LVU377
+	testl	%ebp, %ebp
+	je	.L91
+	.loc 1 118 13 is_stmt 1 view .LVU378
+	movl	%ebp, %edi
+	call	close@PLT
+.LVL103:
+	jmp	.L91
+.LVL104:
+.L96:
+	.loc 1 118 13 is_stmt 0 view .LVU379
+.LBE56:
+	.loc 1 132 46 is_stmt 1 discriminator 1 view .LVU380
+	movq	%r12, %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+.LVL105:
+	.loc 1 132 46 is_stmt 0 discriminator 1 view .LVU381
+	call	log_verbose@PLT
+.LVL106:
+	jmp	.L87
+.LVL107:
+.L93:
+	.loc 1 111 19 view .LVU382
+	movl	$0, %ebx
+	jmp	.L87
+.LVL108:
+.L95:
+.LBB57:
+	.loc 1 116 9 is_stmt 1 view .LVU383
+	.loc 1 116 34 is_stmt 0 view .LVU384
+	call	__errno_location@PLT
+.LVL109:
+	.loc 1 116 34 view .LVU385
+	movq	%rax, %rbx
+.LVL110:
+	.loc 1 116 19 view .LVU386
+	movl	(%rax), %r12d
+.LVL111:
+	.loc 1 117 9 is_stmt 1 view .LVU387
+.L91:
+	.loc 1 120 8 view .LVU388
+	.loc 1 120 14 is_stmt 0 view .LVU389
+	movl	%r12d, (%rbx)
+	.loc 1 121 9 is_stmt 1 view .LVU390
+	.loc 1 121 15 is_stmt 0 view .LVU391
+	movl	$0, %ebx
+	jmp	.L87
+.LVL112:
+.L88:
+	.loc 1 121 15 view .LVU392
+	movl	%eax, %ebp
+	.loc 1 121 15 view .LVU393
+.LBE57:
+	.loc 1 114 5 is_stmt 1 view .LVU394
+	.loc 1 114 31 is_stmt 0 view .LVU395
+	movl	$69736, %edi
+	call	malloc@PLT
+.LVL113:
+	movq	%rax, %rbx
+.LVL114:
+	.loc 1 115 5 is_stmt 1 view .LVU396
+	.loc 1 115 8 is_stmt 0 view .LVU397
+	testq	%rax, %rax
+	je	.L95
+.LVL115:
+.L90:
+	.loc 1 123 5 is_stmt 1 view .LVU398
+	.loc 1 123 15 is_stmt 0 view .LVU399
+	movl	%ebp, (%rbx)
+	.loc 1 124 5 is_stmt 1 view .LVU400
+	.loc 1 124 17 is_stmt 0 view .LVU401
+	movq	%r12, 8(%rbx)
+	.loc 1 125 5 is_stmt 1 view .LVU402
+	.loc 1 125 24 is_stmt 0 view .LVU403
+	movq	$1, 16(%rbx)
+	.loc 1 126 5 is_stmt 1 view .LVU404
+	.loc 1 126 16 is_stmt 0 view .LVU405
+	movb	$0, 24(%rbx)
+	.loc 1 127 5 is_stmt 1 view .LVU406
+	.loc 1 127 19 is_stmt 0 view .LVU407
+	movb	$0, 25(%rbx)
+	.loc 1 128 5 is_stmt 1 view .LVU408
+	.loc 1 128 18 is_stmt 0 view .LVU409
+	movl	$0, 28(%rbx)
+	.loc 1 129 5 is_stmt 1 view .LVU410
+	.loc 1 129 22 is_stmt 0 view .LVU411
+	movb	$0, 32(%rbx)
+	.loc 1 130 5 is_stmt 1 view .LVU412
+	.loc 1 130 22 is_stmt 0 view .LVU413
+	movq	$0, 88(%rbx)
+	.loc 1 131 5 is_stmt 1 view .LVU414
+	.loc 1 131 20 is_stmt 0 view .LVU415
+	movq	$0, 96(%rbx)
+	.loc 1 132 5 is_stmt 1 view .LVU416
+	.loc 1 132 10 view .LVU417
+	.loc 1 132 13 is_stmt 0 view .LVU418
+	cmpl	$0, log_level(%rip)
+	jg	.L96
+.LVL116:
+.L87:
+	.loc 1 134 1 view .LVU419
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	beep_rtttl_open, .-beep_rtttl_open
+	.section	.rodata.str1.1
+.LC13:
+	.string	"%s: %s"
+	.text
+	.globl	beep_rtttl_next
+	.type	beep_rtttl_next, @function
+beep_rtttl_next:
+.LVL117:
+.LFB50:
+	.loc 1 360 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 360 1 is_stmt 0 view .LVU421
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	movq	%rsi, %r13
+	.loc 1 361 5 is_stmt 1 view .LVU422
+.LVL118:
+	.loc 1 362 5 view .LVU423
+	.loc 1 362 29 view .LVU424
+	cmpb	$0, 25(%rdi)
+	jne	.L98
+	.loc 1 361 12 is_stmt 0 view .LVU425
+	movl	$0, %ebp
+.LBB58:
+	.loc 1 378 52 view .LVU426
+	leaq	104(%rdi), %r12
+	jmp	.L105
+.LVL119:
+.L113:
+.LBB59:
+	.loc 1 364 13 is_stmt 1 view .LVU427
+	.loc 1 364 74 is_stmt 0 view .LVU428
+	leaq	1(%rax), %rdx
+	movq	%rdx, 88(%rbx)
+	.loc 1 364 29 view .LVU429
+	movq	%rbp, %rdx
+	salq	$4, %rdx
+	leaq	65640(%rbx,%rdx), %rdx
+	movsbl	104(%rbx,%rax), %esi
+	movq	%rbx, %rdi
+	call	rtttl_feed
+.LVL120:
+	.loc 1 366 13 is_stmt 1 view .LVU430
+	.loc 1 367 17 is_stmt 0 view .LVU431
+	testl	%eax, %eax
+	setg	%al
+.LVL121:
+	.loc 1 367 17 view .LVU432
+	movzbl	%al, %eax
+	addq	%rax, %rbp
+.LVL122:
+.L100:
+	.loc 1 367 17 view .LVU433
+.LBE59:
+.LBE58:
+	.loc 1 362 29 is_stmt 1 view .LVU434
+	cmpb	$1, 25(%rbx)
+	je	.L101
+	cmpq	$255, %rbp
+	ja	.L101
+.LVL123:
+.L105:
+.LBB62:
+	.loc 1 363 9 view .LVU435
+	.loc 1 363 18 is_stmt 0 view .LVU436
+	movq	88(%rbx), %rax
+	.loc 1 363 12 view .LVU437
+	cmpq	96(%rbx), %rax
+	jb	.L113
+	.loc 1 371 9 is_stmt 1 view .LVU438
+	.loc 1 374 9 view .LVU439
+	.loc 1 374 12 is_stmt 0 view .LVU440
+	cmpb	$0, 24(%rbx)
+	jne	.L101
+	testq	%rbp, %rbp
+	jne	.L101
+	.loc 1 378 9 is_stmt 1 view .LVU441
+.LVL124:
+.LBB60:
+.LBI60:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/unistd.h"
+	.loc 3 36 1 view .LVU442
+.LBB61:
+	.loc 3 38 3 view .LVU443
+	.loc 3 38 469 is_stmt 0 view .LVU444
+	movl	(%rbx), %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+.LVL125:
+	.loc 3 38 469 view .LVU445
+.LBE61:
+.LBE60:
+	.loc 1 379 9 is_stmt 1 view .LVU446
+	.loc 1 379 12 is_stmt 0 view .LVU447
+	testq	%rax, %rax
+	jle	.L102
+	.loc 1 380 13 is_stmt 1 view .LVU448
+	.loc 1 380 30 is_stmt 0 view .LVU449
+	movq	$0, 88(%rbx)
+	.loc 1 381 13 is_stmt 1 view .LVU450
+	.loc 1 381 28 is_stmt 0 view .LVU451
+	movq	%rax, 96(%rbx)
+	jmp	.L100
+.L102:
+	.loc 1 382 16 is_stmt 1 view .LVU452
+	.loc 1 382 19 is_stmt 0 view .LVU453
+	jne	.L103
+	.loc 1 384 13 is_stmt 1 view .LVU454
+	.loc 1 384 24 is_stmt 0 view .LVU455
+	movb	$1, 24(%rbx)
+	.loc 1 385 13 is_stmt 1 view .LVU456
+	.loc 1 385 27 is_stmt 0 view .LVU457
+	movb	$10, 104(%rbx)
+	.loc 1 386 13 is_stmt 1 view .LVU458
+	.loc 1 386 30 is_stmt 0 view .LVU459
+	movq	$0, 88(%rbx)
+	.loc 1 387 13 is_stmt 1 view .LVU460
+	.loc 1 387 28 is_stmt 0 view .LVU461
+	movq	$1, 96(%rbx)
+	movl	$0, %ebp
+.LVL126:
+	.loc 1 387 28 view .LVU462
+	jmp	.L100
+.LVL127:
+.L103:
+	.loc 1 388 16 is_stmt 1 view .LVU463
+	.loc 1 388 21 is_stmt 0 view .LVU464
+	call	__errno_location@PLT
+.LVL128:
+	.loc 1 388 20 view .LVU465
+	movl	(%rax), %edi
+	.loc 1 388 19 view .LVU466
+	cmpl	$4, %edi
+	jne	.L114
+	movl	$0, %ebp
+.LVL129:
+	.loc 1 388 19 view .LVU467
+	jmp	.L100
+.LVL130:
+.L114:
+	.loc 1 389 13 is_stmt 1 view .LVU468
+	call	strerror@PLT
+.LVL131:
+	movq	%rax, %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL132:
+	.loc 1 390 13 view .LVU469
+	.loc 1 390 27 is_stmt 0 view .LVU470
+	movb	$1, 25(%rbx)
+.LVL133:
+	.loc 1 390 27 view .LVU471
+.LBE62:
+	.loc 1 362 29 is_stmt 1 view .LVU472
+	.loc 1 393 5 view .LVU473
+	.loc 1 393 14 is_stmt 0 view .LVU474
+	leaq	65640(%rbx), %rax
+	movq	%rax, 0(%r13)
+	.loc 1 394 5 is_stmt 1 view .LVU475
+.LVL134:
+.L104:
+	.loc 1 394 22 is_stmt 0 discriminator 1 view .LVU476
+	cmpb	$0, 25(%rbx)
+	jne	.L110
+	movl	$0, %ebp
+	jmp	.L107
+.LVL135:
+.L101:
+	.loc 1 393 5 is_stmt 1 view .LVU477
+	.loc 1 393 14 is_stmt 0 view .LVU478
+	leaq	65640(%rbx), %rax
+	movq	%rax, 0(%r13)
+	.loc 1 394 5 is_stmt 1 view .LVU479
+	.loc 1 394 8 is_stmt 0 view .LVU480
+	testq	%rbp, %rbp
+	je	.L104
+.LVL136:
+.L107:
+	.loc 1 397 5 is_stmt 1 view .LVU481
+	.loc 1 397 12 is_stmt 0 view .LVU482
+	movq	%rbp, %rax
+.L97:
+	.loc 1 398 1 view .LVU483
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL137:
+	.loc 1 398 1 view .LVU484
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL138:
+	.loc 1 398 1 view .LVU485
+	ret
+.LVL139:
+.L110:
+	.cfi_restore_state
+	.loc 1 395 16 view .LVU486
+	movq	$-1, %rax
+	jmp	.L97
+.LVL140:
+.L98:
+	.loc 1 393 5 is_stmt 1 view .LVU487
+	.loc 1 393 14 is_stmt 0 view .LVU488
+	leaq	65640(%rdi), %rax
+	movq	%rax, (%rsi)
+	.loc 1 394 5 is_stmt 1 view .LVU489
+	jmp	.L104
+	.cfi_endproc
+.LFE50:
+	.size	beep_rtttl_next, .-beep_rtttl_next
+	.globl	beep_rtttl_close
+	.type	beep_rtttl_close, @function
+beep_rtttl_close:
+.LVL141:
+.LFB51:
+	.loc 1 402 1 view -0
+	.cfi_startproc
+	.loc 1 402 1 is_stmt 0 view .LVU491
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 403 5 is_stmt 1 view .LVU492
+	.loc 1 403 14 is_stmt 0 view .LVU493
+	movl	(%rdi), %edi
+.LVL142:
+	.loc 1 403 8 view .LVU494
+	testl	%edi, %edi
+	jne	.L118
+.L116:
+	.loc 1 406 5 is_stmt 1 view .LVU495
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL143:
+	.loc 1 407 1 is_stmt 0 view .LVU496
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL144:
+	.loc 1 407 1 view .LVU497
+	ret
+.LVL145:
+.L118:
+	.cfi_restore_state
+	.loc 1 404 9 is_stmt 1 view .LVU498
+	call	close@PLT
+.LVL146:
+	jmp	.L116
+	.cfi_endproc
+.LFE51:
+	.size	beep_rtttl_close, .-beep_rtttl_close
+	.section	.rodata
+	.align 32
+	.type	letter_semitones.0, @object
+	.size	letter_semitones.0, 32
+letter_semitones.0:
+	.long	9
+	.long	11
+	.long	0
+	.long	2
+	.long	4
+	.long	5
+	.long	7
+	.long	11
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 8 "beep-driver.h"
+	.file 9 "beep-rtttl.h"
+	.file 10 "beep-notes.h"
+	.file 11 "/usr/include/stdlib.h"
+	.file 12 "beep-log.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/unistd.h"
+	.file 15 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xd86
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF93
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x7
+	.long	.LASF9
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x48
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x8
+	.long	0x62
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x7
+	.long	.LASF10
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x62
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x5
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0xb
+	.long	0xa7
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x8
+	.long	0xa7
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF16
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x13
+	.long	0x96
+	.uleb128 0x8
+	.long	0xd2
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0xb
+	.long	0xae
+	.uleb128 0x8
+	.long	0xea
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x22
+	.long	0x130
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x8
+	.byte	0x23
+	.byte	0xe
+	.long	0xb3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x8
+	.byte	0x24
+	.byte	0xe
+	.long	0xb3
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0xb3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0xb3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF23
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0xf4
+	.uleb128 0x8
+	.long	0x130
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF24
+	.uleb128 0x8
+	.long	0x141
+	.uleb128 0xb
+	.long	0x13c
+	.uleb128 0x7
+	.long	.LASF25
+	.byte	0x9
+	.byte	0x21
+	.byte	0x1c
+	.long	0x15e
+	.uleb128 0x27
+	.long	.LASF94
+	.long	0x11068
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0x29c
+	.uleb128 0xc
+	.string	"fd"
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x9
+	.long	0x48
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x11
+	.long	0xea
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x13
+	.long	0x41
+	.byte	0x10
+	.uleb128 0xc
+	.string	"eof"
+	.byte	0x1
+	.byte	0x4d
+	.byte	0x13
+	.long	0x141
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x13
+	.long	0x141
+	.byte	0x19
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x50
+	.byte	0x13
+	.long	0x303
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x51
+	.byte	0x13
+	.long	0x141
+	.byte	0x20
+	.uleb128 0xc
+	.string	"key"
+	.byte	0x1
+	.byte	0x52
+	.byte	0xa
+	.long	0xa7
+	.byte	0x21
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x53
+	.byte	0x12
+	.long	0x62
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x54
+	.byte	0x12
+	.long	0x62
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x1
+	.byte	0x55
+	.byte	0x12
+	.long	0x62
+	.byte	0x2c
+	.uleb128 0xc
+	.string	"bpm"
+	.byte	0x1
+	.byte	0x56
+	.byte	0x12
+	.long	0x62
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x1
+	.byte	0x57
+	.byte	0x10
+	.long	0x2ca
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x12
+	.long	0x62
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x9
+	.long	0x48
+	.byte	0x4c
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x13
+	.long	0x141
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x13
+	.long	0x141
+	.byte	0x51
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x13
+	.long	0x141
+	.byte	0x52
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x9
+	.long	0x48
+	.byte	0x54
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x1
+	.byte	0x61
+	.byte	0xc
+	.long	0x35
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x1
+	.byte	0x62
+	.byte	0xc
+	.long	0x35
+	.byte	0x60
+	.uleb128 0xc
+	.string	"buf"
+	.byte	0x1
+	.byte	0x63
+	.byte	0xa
+	.long	0x30f
+	.byte	0x68
+	.uleb128 0x28
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x65
+	.byte	0xf
+	.long	0x320
+	.long	0x10068
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF72
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xc
+	.long	0x48
+	.uleb128 0x1c
+	.byte	0xa
+	.byte	0x35
+	.long	0x2ca
+	.uleb128 0xc
+	.string	"bpm"
+	.byte	0xa
+	.byte	0x36
+	.byte	0x12
+	.long	0x62
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0xa
+	.byte	0x37
+	.byte	0xe
+	.long	0xbf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF45
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0x2a8
+	.uleb128 0x2a
+	.byte	0x7
+	.byte	0x4
+	.long	0x62
+	.byte	0x1
+	.byte	0x40
+	.byte	0xe
+	.long	0x303
+	.uleb128 0xd
+	.long	.LASF46
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF47
+	.byte	0x1
+	.uleb128 0xd
+	.long	.LASF48
+	.byte	0x2
+	.uleb128 0xd
+	.long	.LASF49
+	.byte	0x3
+	.uleb128 0xd
+	.long	.LASF50
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x46
+	.byte	0x3
+	.long	0x2d6
+	.uleb128 0x15
+	.long	0xa7
+	.long	0x320
+	.uleb128 0x2b
+	.long	0x41
+	.value	0xffff
+	.byte	0
+	.uleb128 0x15
+	.long	0x130
+	.long	0x330
+	.uleb128 0x1d
+	.long	0x41
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF58
+	.byte	0xb
+	.value	0x238
+	.byte	0xd
+	.long	0x343
+	.uleb128 0x2
+	.long	0x94
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF54
+	.byte	0x3
+	.byte	0x17
+	.byte	0x10
+	.long	0xd2
+	.long	0x368
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x2
+	.long	0x94
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF52
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x10
+	.long	.LASF54
+	.long	0xd2
+	.long	0x391
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x2
+	.long	0x94
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF53
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x10
+	.long	.LASF55
+	.long	0xd2
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x2
+	.long	0x94
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x45
+	.byte	0xe
+	.long	0x62
+	.long	0x3cb
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x5a
+	.byte	0xe
+	.long	0x62
+	.long	0x3e6
+	.uleb128 0x2
+	.long	0x3e6
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0xb
+	.long	0x2ca
+	.uleb128 0x17
+	.long	.LASF59
+	.byte	0xa
+	.byte	0x53
+	.long	0x401
+	.uleb128 0x2
+	.long	0x3e6
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF60
+	.byte	0xc
+	.byte	0x2d
+	.long	0x413
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF61
+	.byte	0xd
+	.value	0x1a3
+	.byte	0xe
+	.long	0xa2
+	.long	0x42a
+	.uleb128 0x2
+	.long	0x48
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF62
+	.byte	0x2
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF63
+	.long	0x48
+	.long	0x44a
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x2
+	.byte	0x1a
+	.byte	0xc
+	.long	0x48
+	.long	0x465
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x48
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF65
+	.byte	0x25
+	.uleb128 0x1e
+	.long	.LASF66
+	.byte	0x23
+	.uleb128 0x17
+	.long	.LASF67
+	.byte	0xc
+	.byte	0x43
+	.long	0x483
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF68
+	.byte	0xe
+	.value	0x166
+	.byte	0xc
+	.long	0x48
+	.long	0x49a
+	.uleb128 0x2
+	.long	0x48
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF95
+	.byte	0xf
+	.byte	0x25
+	.byte	0xd
+	.long	0x4a6
+	.uleb128 0xb
+	.long	0x48
+	.uleb128 0x18
+	.long	.LASF69
+	.byte	0xb
+	.value	0x229
+	.byte	0xe
+	.long	0x94
+	.long	0x4c2
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF70
+	.byte	0xd
+	.byte	0x9c
+	.byte	0xc
+	.long	0x48
+	.long	0x4dd
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0xea
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF96
+	.byte	0x1
+	.value	0x191
+	.byte	0x6
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x536
+	.uleb128 0x19
+	.long	.LASF71
+	.value	0x191
+	.byte	0x23
+	.long	0x536
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x4
+	.quad	.LVL143
+	.long	0x330
+	.long	0x528
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL146
+	.long	0x483
+	.byte	0
+	.uleb128 0xb
+	.long	0x152
+	.uleb128 0x8
+	.long	0x536
+	.uleb128 0x2f
+	.long	.LASF84
+	.byte	0x1
+	.value	0x167
+	.byte	0x9
+	.long	0xd2
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a6
+	.uleb128 0x19
+	.long	.LASF71
+	.value	0x167
+	.byte	0x25
+	.long	0x536
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.long	.LASF43
+	.value	0x167
+	.byte	0x44
+	.long	0x6ab
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x12
+	.long	.LASF73
+	.value	0x169
+	.byte	0xc
+	.long	0x35
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1f
+	.long	.LLRL33
+	.uleb128 0x12
+	.long	.LASF74
+	.value	0x17a
+	.byte	0x17
+	.long	0xde
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x30
+	.quad	.LBB59
+	.quad	.LBE59-.LBB59
+	.long	0x606
+	.uleb128 0x31
+	.string	"fed"
+	.byte	0x1
+	.value	0x16c
+	.byte	0x17
+	.long	0x4f
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x9
+	.quad	.LVL120
+	.long	0x6b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x10068
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xd2c
+	.quad	.LBI60
+	.value	.LVU442
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.value	0x17a
+	.byte	0x1f
+	.long	0x66f
+	.uleb128 0x5
+	.long	0xd55
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x5
+	.long	0xd49
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x5
+	.long	0xd3d
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x9
+	.quad	.LVL125
+	.long	0x391
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL128
+	.long	0x49a
+	.uleb128 0xf
+	.quad	.LVL131
+	.long	0x413
+	.uleb128 0x9
+	.quad	.LVL132
+	.long	0x401
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x14d
+	.uleb128 0x8
+	.long	0x6a6
+	.uleb128 0x32
+	.long	.LASF97
+	.byte	0x1
+	.byte	0xe0
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa7f
+	.uleb128 0x10
+	.long	.LASF71
+	.byte	0xe0
+	.byte	0x1c
+	.long	0x536
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x33
+	.string	"c"
+	.byte	0x1
+	.byte	0xe0
+	.byte	0x2e
+	.long	0xae
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x10
+	.long	.LASF75
+	.byte	0xe0
+	.byte	0x42
+	.long	0xa84
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x34
+	.long	.LASF98
+	.byte	0x1
+	.byte	0xe3
+	.byte	0x16
+	.long	0xa99
+	.uleb128 0x9
+	.byte	0x3
+	.quad	letter_semitones.0
+	.uleb128 0x20
+	.long	.LLRL9
+	.long	0x87f
+	.uleb128 0x12
+	.long	.LASF76
+	.value	0x154
+	.byte	0x13
+	.long	0x148
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x12
+	.long	.LASF77
+	.value	0x155
+	.byte	0x13
+	.long	0x148
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x21
+	.long	0xa9e
+	.quad	.LBI33
+	.value	.LVU290
+	.long	.LLRL12
+	.value	0x156
+	.byte	0x1c
+	.long	0x829
+	.uleb128 0x5
+	.long	0xab8
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x5
+	.long	0xaac
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1f
+	.long	.LLRL15
+	.uleb128 0x13
+	.long	0xac4
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x13
+	.long	0xacf
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x35
+	.long	0xada
+	.long	.LLRL18
+	.long	0x7e0
+	.uleb128 0x13
+	.long	0xadb
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x13
+	.long	0xae6
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x9
+	.quad	.LVL85
+	.long	0x3b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0xb28
+	.quad	.LBI37
+	.value	.LVU296
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.byte	0xbe
+	.byte	0x24
+	.long	0x813
+	.uleb128 0x5
+	.long	0xb36
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL81
+	.long	0x3cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xb0e
+	.quad	.LBI46
+	.value	.LVU249
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.value	0x15f
+	.byte	0x9
+	.long	0x85d
+	.uleb128 0x5
+	.long	0xb1b
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL90
+	.long	0xb43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xb0e
+	.quad	.LBI23
+	.value	.LVU26
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.value	0x103
+	.byte	0xd
+	.long	0x8b3
+	.uleb128 0x5
+	.long	0xb1b
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x21
+	.long	0xaf3
+	.quad	.LBI25
+	.value	.LVU269
+	.long	.LLRL6
+	.value	0x127
+	.byte	0xe
+	.long	0x90b
+	.uleb128 0x5
+	.long	0xb01
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x36
+	.long	0xb28
+	.quad	.LBI27
+	.value	.LVU127
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.byte	0x1
+	.byte	0xab
+	.byte	0x10
+	.uleb128 0x5
+	.long	0xb36
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL8
+	.long	0x3eb
+	.long	0x923
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 56
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL14
+	.long	0xb43
+	.long	0x948
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL17
+	.long	0xb43
+	.long	0x967
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL21
+	.long	0xb43
+	.long	0x98c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL27
+	.long	0xb43
+	.long	0x9b1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL30
+	.long	0xb43
+	.long	0x9d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL34
+	.long	0xb43
+	.long	0x9f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL41
+	.long	0x6b0
+	.long	0xa19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL47
+	.long	0xb43
+	.long	0xa3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL53
+	.long	0xb43
+	.long	0xa5d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL58
+	.long	0xb43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x130
+	.uleb128 0x8
+	.long	0xa7f
+	.uleb128 0x15
+	.long	0x4f
+	.long	0xa99
+	.uleb128 0x1d
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0xa89
+	.uleb128 0x1b
+	.long	.LASF80
+	.byte	0xba
+	.long	0x141
+	.long	0xaf3
+	.uleb128 0xa
+	.long	.LASF71
+	.byte	0x1
+	.byte	0xba
+	.byte	0x1d
+	.long	0x536
+	.uleb128 0xa
+	.long	.LASF75
+	.byte	0x1
+	.byte	0xba
+	.byte	0x35
+	.long	0xa84
+	.uleb128 0x14
+	.long	.LASF35
+	.byte	0xbc
+	.byte	0x18
+	.long	0x69
+	.uleb128 0x14
+	.long	.LASF78
+	.byte	0xc3
+	.byte	0x12
+	.long	0x62
+	.uleb128 0x37
+	.uleb128 0x14
+	.long	.LASF40
+	.byte	0xce
+	.byte	0x13
+	.long	0x4f
+	.uleb128 0x14
+	.long	.LASF79
+	.byte	0xd0
+	.byte	0x13
+	.long	0x4f
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF81
+	.byte	0xa6
+	.long	0x141
+	.long	0xb0e
+	.uleb128 0xa
+	.long	.LASF71
+	.byte	0x1
+	.byte	0xa6
+	.byte	0x1f
+	.long	0x536
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF99
+	.byte	0x1
+	.byte	0x99
+	.byte	0x6
+	.byte	0x1
+	.long	0xb28
+	.uleb128 0xa
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x99
+	.byte	0x1d
+	.long	0x536
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF82
+	.byte	0x92
+	.long	0x141
+	.long	0xb43
+	.uleb128 0xa
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x92
+	.byte	0x27
+	.long	0x69
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF100
+	.byte	0x1
+	.byte	0x8a
+	.byte	0x6
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbaa
+	.uleb128 0x10
+	.long	.LASF71
+	.byte	0x8a
+	.byte	0x1e
+	.long	0x536
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x10
+	.long	.LASF83
+	.byte	0x8a
+	.byte	0x37
+	.long	0xef
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.quad	.LVL3
+	.long	0x401
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF85
+	.byte	0x1
+	.byte	0x69
+	.byte	0xd
+	.long	0x536
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd2c
+	.uleb128 0x10
+	.long	.LASF86
+	.byte	0x69
+	.byte	0x2f
+	.long	0xef
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x3b
+	.string	"fd"
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x9
+	.long	0x48
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x23
+	.long	.LASF71
+	.byte	0x72
+	.byte	0x17
+	.long	0x53b
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x20
+	.long	.LLRL28
+	.long	0xc54
+	.uleb128 0x23
+	.long	.LASF87
+	.byte	0x74
+	.byte	0x13
+	.long	0x4f
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xf
+	.quad	.LVL100
+	.long	0x49a
+	.uleb128 0x4
+	.quad	.LVL103
+	.long	0x483
+	.long	0xc46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL109
+	.long	0x49a
+	.byte	0
+	.uleb128 0x22
+	.long	0xd62
+	.quad	.LBI54
+	.value	.LVU358
+	.quad	.LBB54
+	.quad	.LBE54-.LBB54
+	.byte	0x6d
+	.byte	0xe
+	.long	0xcaf
+	.uleb128 0x5
+	.long	0xd7b
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x5
+	.long	0xd6f
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x9
+	.quad	.LVL96
+	.long	0x42a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL94
+	.long	0x4c2
+	.long	0xcd4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL98
+	.long	0x4ab
+	.long	0xcef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x11068
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL106
+	.long	0x471
+	.long	0xd14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL113
+	.long	0x4ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x11068
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF55
+	.byte	0x3
+	.byte	0x24
+	.byte	0x1
+	.long	0xd2
+	.byte	0x3
+	.long	0xd62
+	.uleb128 0xa
+	.long	.LASF88
+	.byte	0x3
+	.byte	0x24
+	.byte	0xb
+	.long	0x48
+	.uleb128 0xa
+	.long	.LASF89
+	.byte	0x3
+	.byte	0x24
+	.byte	0x17
+	.long	0x94
+	.uleb128 0xa
+	.long	.LASF90
+	.byte	0x3
+	.byte	0x24
+	.byte	0x25
+	.long	0x35
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF63
+	.byte	0x2
+	.byte	0x29
+	.byte	0x1
+	.long	0x48
+	.byte	0x3
+	.uleb128 0xa
+	.long	.LASF91
+	.byte	0x2
+	.byte	0x29
+	.byte	0x13
+	.long	0xea
+	.uleb128 0xa
+	.long	.LASF92
+	.byte	0x2
+	.byte	0x29
+	.byte	0x1f
+	.long	0x48
+	.uleb128 0x11
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU494
+	.uleb128 .LVU494
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU423
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU462
+	.uleb128 .LVU463
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 .LVU476
+	.uleb128 .LVU477
+	.uleb128 .LVU481
+	.uleb128 .LVU487
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU445
+	.uleb128 .LVU465
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU442
+	.uleb128 .LVU445
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU442
+	.uleb128 .LVU445
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 104
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU442
+	.uleb128 .LVU445
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU228
+	.uleb128 .LVU233
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 72
+	.byte	0x94
+	.byte	0x4
+	.byte	0x30
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU231
+	.uleb128 .LVU233
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU238
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+	.uleb128 .LVU245
+	.uleb128 .LVU290
+	.uleb128 .LVU341
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU238
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+	.uleb128 .LVU245
+	.uleb128 .LVU290
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU341
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU296
+	.uleb128 .LVU313
+	.uleb128 .LVU339
+	.uleb128 .LVU341
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU304
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU311
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU327
+	.uleb128 .LVU333
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU296
+	.uleb128 .LVU300
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU249
+	.uleb128 .LVU263
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU26
+	.uleb128 .LVU39
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU123
+	.uleb128 .LVU131
+	.uleb128 .LVU142
+	.uleb128 .LVU147
+	.uleb128 .LVU269
+	.uleb128 .LVU278
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU127
+	.uleb128 .LVU131
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU392
+	.uleb128 .LVU392
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU354
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU379
+	.uleb128 .LVU382
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU398
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU375
+	.uleb128 .LVU379
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU382
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU386
+	.uleb128 .LVU396
+	.uleb128 .LVU419
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU376
+	.uleb128 .LVU379
+	.uleb128 .LVU387
+	.uleb128 .LVU392
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU358
+	.uleb128 .LVU364
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU358
+	.uleb128 .LVU364
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF78:
+	.string	"ticks"
+.LASF95:
+	.string	"__errno_location"
+.LASF56:
+	.string	"beep_note_freq_hz"
+.LASF80:
+	.string	"finish_note"
+.LASF19:
+	.string	"freq"
+.LASF100:
+	.string	"rtttl_error"
+.LASF33:
+	.string	"default_octave"
+.LASF42:
+	.string	"buf_end"
+.LASF50:
+	.string	"RTTTL_NOTE"
+.LASF29:
+	.string	"state"
+.LASF15:
+	.string	"uint64_t"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF69:
+	.string	"malloc"
+.LASF96:
+	.string	"beep_rtttl_close"
+.LASF34:
+	.string	"tempo"
+.LASF88:
+	.string	"__fd"
+.LASF97:
+	.string	"rtttl_feed"
+.LASF86:
+	.string	"filename"
+.LASF75:
+	.string	"tone"
+.LASF21:
+	.string	"delay"
+.LASF17:
+	.string	"ssize_t"
+.LASF27:
+	.string	"line_number"
+.LASF76:
+	.string	"empty"
+.LASF43:
+	.string	"tones"
+.LASF31:
+	.string	"value"
+.LASF28:
+	.string	"failed"
+.LASF73:
+	.string	"count"
+.LASF45:
+	.string	"beep_tempo"
+.LASF89:
+	.string	"__buf"
+.LASF47:
+	.string	"RTTTL_KEY"
+.LASF61:
+	.string	"strerror"
+.LASF99:
+	.string	"start_note"
+.LASF55:
+	.string	"read"
+.LASF16:
+	.string	"long long int"
+.LASF12:
+	.string	"__ssize_t"
+.LASF2:
+	.string	"long int"
+.LASF62:
+	.string	"__open_alias"
+.LASF46:
+	.string	"RTTTL_NAME"
+.LASF26:
+	.string	"name"
+.LASF20:
+	.string	"length"
+.LASF37:
+	.string	"is_pause"
+.LASF4:
+	.string	"unsigned char"
+.LASF40:
+	.string	"octave"
+.LASF32:
+	.string	"default_duration"
+.LASF7:
+	.string	"signed char"
+.LASF22:
+	.string	"flags"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF54:
+	.string	"__read_chk"
+.LASF14:
+	.string	"uint32_t"
+.LASF51:
+	.string	"rtttl_state_E"
+.LASF39:
+	.string	"dotted"
+.LASF36:
+	.string	"semitone"
+.LASF71:
+	.string	"rtttl"
+.LASF92:
+	.string	"__oflag"
+.LASF44:
+	.string	"remainder"
+.LASF91:
+	.string	"__path"
+.LASF30:
+	.string	"seen_name"
+.LASF41:
+	.string	"buf_start"
+.LASF67:
+	.string	"log_verbose"
+.LASF49:
+	.string	"RTTTL_VALUE"
+.LASF83:
+	.string	"message"
+.LASF87:
+	.string	"saved_errno"
+.LASF13:
+	.string	"char"
+.LASF72:
+	.string	"log_level"
+.LASF5:
+	.string	"short unsigned int"
+.LASF23:
+	.string	"beep_tone"
+.LASF24:
+	.string	"_Bool"
+.LASF85:
+	.string	"beep_rtttl_open"
+.LASF79:
+	.string	"note"
+.LASF11:
+	.string	"__uint64_t"
+.LASF98:
+	.string	"letter_semitones"
+.LASF35:
+	.string	"duration"
+.LASF60:
+	.string	"log_error"
+.LASF38:
+	.string	"sharp"
+.LASF3:
+	.string	"long unsigned int"
+.LASF52:
+	.string	"__read_chk_warn"
+.LASF74:
+	.string	"bytes"
+.LASF59:
+	.string	"beep_tempo_init"
+.LASF90:
+	.string	"__nbytes"
+.LASF10:
+	.string	"__uint32_t"
+.LASF84:
+	.string	"beep_rtttl_next"
+.LASF94:
+	.string	"_beep_rtttl"
+.LASF77:
+	.string	"have_tone"
+.LASF66:
+	.string	"__open_too_many_args"
+.LASF70:
+	.string	"strcmp"
+.LASF81:
+	.string	"store_default"
+.LASF25:
+	.string	"beep_rtttl"
+.LASF63:
+	.string	"open"
+.LASF65:
+	.string	"__open_missing_mode"
+.LASF64:
+	.string	"__open_2"
+.LASF57:
+	.string	"beep_tempo_ms"
+.LASF68:
+	.string	"close"
+.LASF53:
+	.string	"__read_alias"
+.LASF6:
+	.string	"unsigned int"
+.LASF58:
+	.string	"free"
+.LASF48:
+	.string	"RTTTL_EQUALS"
+.LASF93:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF82:
+	.string	"valid_duration"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-rtttl.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,836 @@
+/* beep-score.c - read tone sequences from score files
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* A score has one tone per line:
+ *
+ *   FREQ_Hz [LENGTH_ms [DELAY_ms]]
+ *
+ * with the same limits and syntax as the -f, -l and -d options, i.e.
+ * note names and durations in beats work as well.  Empty lines and
+ * lines starting with '#' are ignored.
+ *
+ * A binary score (see beep-score.h) starts with the eight bytes
+ * "BEEPSCOR", which no valid text line does, even though text scores
+ * may start with a B note.  Only all eight bytes select the binary
+ * format.  When mapped on a little endian host, its records are
+ * played right from the mapping.
+ *
+ * Scores are never read into memory as a whole.  Regular files are
+ * mmap(2)ed one window after the other, everything else (pipes,
+ * terminals) is read(2) into a fixed size buffer.  beep_score_read()
+ * parses just a few tones ahead of the playback, so that the first
+ * tone starts right away and memory use stays the same for scores of
+ * any size.
+ */
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "beep-score.h"
+
+#include "beep-library.h"
+#include "beep-log.h"
+#include "beep-notes.h"
+
+
+/* Longest tone line.  Longer comment lines are fine. */
+#define SCORE_MAX_LINE 256
+
+/* Read buffer for scores which cannot be mmap(2)ed */
+#define SCORE_BUFFER_SIZE 65536
+
+/* Size of the part of a regular file mapped at any time.  Mapping the
+ * whole file would have the parsed pages add up in the resident set.
+ */
+#define SCORE_WINDOW_SIZE (1024 * 1024)
+
+/* Most tones of a mapped binary score returned at once */
+#define SCORE_MAPPED_MAX 4096
+
+/* Limits of the -f and -l/-d options, which text scores share */
+#define SCORE_MAX_FREQ     20000U
+#define SCORE_MAX_DURATION 300000U
+
+
+/* The records of a mapped binary score are used as beep_tone */
+typedef char score_record_size_check[(sizeof(beep_tone)
+                                      == BEEP_SCORE_RECORD_SIZE) ? 1 : -1];
+
+
+struct _beep_score {
+    int           fd;
+    const char   *name;
+    unsigned long line_number;
+    unsigned int  default_length;
+    unsigned int  default_delay;
+    beep_tempo    tempo;
+    bool          format_known;
+    bool          failed;
+
+    /* Binary scores only */
+    bool          binary;
+    uint64_t      tones_left;
+    uint64_t      record_number;
+
+    /* Regular files are mapped one window at a time, binary scores
+     * as a whole ...
+     */
+    const char   *map;
+    off_t         map_offset;
+    size_t        map_size;
+    off_t         file_size;
+    off_t         file_pos;
+
+    /* ... while everything else is read into buf */
+    size_t        buf_start;
+    size_t        buf_end;
+    bool          eof;
+    char          buf[SCORE_BUFFER_SIZE];
+
+    beep_tone     lookahead[BEEP_SCORE_LOOKAHEAD];
+};
+
+
+static
+uint32_t get_le32(const unsigned char *const p)
+{
+    return ((uint32_t)p[0]) | (((uint32_t)p[1]) << 8)
+        | (((uint32_t)p[2]) << 16) | (((uint32_t)p[3]) << 24);
+}
+
+
+static
+void put_le32(unsigned char *const p, const uint32_t value)
+{
+    p[0] = (unsigned char)(value & 0xff);
+    p[1] = (unsigned char)((value >> 8) & 0xff);
+    p[2] = (unsigned char)((value >> 16) & 0xff);
+    p[3] = (unsigned char)((value >> 24) & 0xff);
+}
+
+
+/* Map the window starting at the page containing file_pos.  Without
+ * a mapping, the score is read(2) from file_pos on.
+ */
+static
+bool score_map_window(beep_score *score)
+{
+    if (score->map) {
+        munmap((void *)score->map, score->map_size);
+        score->map = NULL;
+    }
+    const off_t page_size = (off_t)sysconf(_SC_PAGESIZE);
+    const off_t offset = score->file_pos - (score->file_pos % page_size);
+    const off_t left = score->file_size - offset;
+    const size_t size = (left < SCORE_WINDOW_SIZE)
+        ? (size_t)left : SCORE_WINDOW_SIZE;
+    void *const map = mmap(NULL, size, PROT_READ, MAP_PRIVATE,
+                           score->fd, offset);
+    if (map == MAP_FAILED) {
+        return (-1 != lseek(score->fd, score->file_pos, SEEK_SET));
+    }
+    madvise(map, size, MADV_SEQUENTIAL);
+    score->map        = map;
+    score->map_offset = offset;
+    score->map_size   = size;
+    return true;
+}
+
+
+beep_score *beep_score_fdopen(const int fd, const char *const filename,
+                              const unsigned int default_length,
+                              const unsigned int default_delay)
+{
+    beep_score *const score = malloc(sizeof(beep_score));
+    if (!score) {
+        return NULL;
+    }
+    score->fd             = fd;
+    score->name           = filename;
+    score->line_number    = 0;
+    score->default_length = default_length;
+    score->default_delay  = default_delay;
+    beep_tempo_init(&score->tempo, BEEP_DEFAULT_BPM);
+    score->format_known   = false;
+    score->failed         = false;
+    score->binary         = false;
+    score->tones_left     = 0;
+    score->record_number  = 0;
+    score->map            = NULL;
+    score->map_offset     = 0;
+    score->map_size       = 0;
+    score->file_size      = 0;
+    score->file_pos       = 0;
+    score->buf_start      = 0;
+    score->buf_end        = 0;
+    score->eof            = false;
+
+    struct stat sb;
+    if ((0 == fstat(score->fd, &sb)) && S_ISREG(sb.st_mode)) {
+        const off_t start = lseek(score->fd, 0, SEEK_CUR);
+        if (sb.st_size == 0) {
+            score->eof = true;
+        } else if ((start != -1) && (start < sb.st_size)) {
+            /* The score need not start at the beginning of the file */
+            score->file_size = sb.st_size;
+            score->file_pos  = start;
+            score_map_window(score);
+        }
+    }
+    log_verbose("score: reading %s (%s)", filename,
+                score->map ? "mmap" : "stream");
+    return score;
+}
+
+
+beep_score *beep_score_open(const char *const filename,
+                            const unsigned int default_length,
+                            const unsigned int default_delay)
+{
+    if (0 == strcmp(filename, "-")) {
+        return beep_score_fdopen(STDIN_FILENO, filename,
+                                 default_length, default_delay);
+    }
+    const int fd = open(filename, O_RDONLY|O_CLOEXEC);
+    if (fd == -1) {
+        return NULL;
+    }
+    beep_score *const score = beep_score_fdopen(fd, filename,
+                                                default_length, default_delay);
+    if (!score) {
+        const int saved_errno = errno;
+        close(fd);
+        errno = saved_errno;
+    }
+    return score;
+}
+
+
+void beep_score_set_bpm(beep_score *score, const unsigned int bpm)
+{
+    beep_tempo_init(&score->tempo, bpm);
+}
+
+
+/* Read more of a score which is not mapped into buf, after moving the
+ * unused part to the front.  Returns 1 after reading, 0 at the end of
+ * the file, and -1 after logging an error.
+ */
+static
+int score_read_more(beep_score *score)
+{
+    if (score->eof) {
+        return 0;
+    }
+    if (score->buf_start > 0) {
+        const size_t available = score->buf_end - score->buf_start;
+        memmove(score->buf, &score->buf[score->buf_start], available);
+        score->buf_start = 0;
+        score->buf_end   = available;
+    }
+    const ssize_t bytes = read(score->fd, &score->buf[score->buf_end],
+                               sizeof(score->buf) - score->buf_end);
+    if (bytes > 0) {
+        score->buf_end += (size_t)bytes;
+    } else if (bytes == 0) {
+        score->eof = true;
+        return 0;
+    } else if (errno != EINTR) {
+        log_error("%s: %s", score->name, strerror(errno));
+        return -1;
+    }
+    return 1;
+}
+
+
+/* Check a binary score header */
+static
+bool score_parse_header(beep_score *score, const unsigned char *const header)
+{
+    if (0 != memcmp(header, BEEP_SCORE_MAGIC, 8)) {
+        log_error("%s: not a beep score", score->name);
+        return false;
+    }
+    const uint32_t version     = get_le32(&header[8]);
+    const uint32_t record_size = get_le32(&header[12]);
+    if ((version != BEEP_SCORE_VERSION)
+        || (record_size != BEEP_SCORE_RECORD_SIZE)) {
+        log_error("%s: unsupported binary score version %u",
+                  score->name, (unsigned int)version);
+        return false;
+    }
+    score->tones_left = ((uint64_t)get_le32(&header[16]))
+        | (((uint64_t)get_le32(&header[20])) << 32);
+    if (score->tones_left == BEEP_SCORE_COUNT_UNKNOWN) {
+        log_verbose("score: %s is a binary score up to its end", score->name);
+    } else {
+        log_verbose("score: %s is a binary score with %llu tones",
+                    score->name, (unsigned long long)score->tones_left);
+    }
+    return true;
+}
+
+
+/* Replace the window with a mapping of the whole binary score */
+static
+bool score_map_binary(beep_score *score)
+{
+    munmap((void *)score->map, score->map_size);
+    score->map = NULL;
+
+    const off_t left = score->file_size - score->file_pos;
+    if (left < BEEP_SCORE_HEADER_SIZE) {
+        log_error("%s: truncated binary score", score->name);
+        return false;
+    }
+    void *const map = mmap(NULL, (size_t)score->file_size, PROT_READ,
+                           MAP_SHARED, score->fd, 0);
+    if (map == MAP_FAILED) {
+        log_error("%s: %s", score->name, strerror(errno));
+        return false;
+    }
+    madvise(map, (size_t)score->file_size, MADV_SEQUENTIAL);
+    score->map        = map;
+    score->map_offset = 0;
+    score->map_size   = (size_t)score->file_size;
+
+    if (!score_parse_header(score, (const unsigned char *)
+                            &score->map[score->file_pos])) {
+        return false;
+    }
+    score->file_pos += BEEP_SCORE_HEADER_SIZE;
+    const uint64_t size = (uint64_t)(score->file_size - score->file_pos);
+    const uint64_t records = size / BEEP_SCORE_RECORD_SIZE;
+    if (score->tones_left == BEEP_SCORE_COUNT_UNKNOWN) {
+        score->tones_left = records;
+        if ((size % BEEP_SCORE_RECORD_SIZE) != 0) {
+            log_error("%s: truncated binary score", score->name);
+            return false;
+        }
+    } else if (records < score->tones_left) {
+        log_error("%s: truncated binary score", score->name);
+        return false;
+    }
+    return true;
+}
+
+
+/* Whether the size bytes at data could start a binary score, i.e. are
+ * a prefix of the magic.  Only all of the magic makes a binary score.
+ */
+static
+bool score_magic_prefix(const char *const data, const size_t size)
+{
+    const size_t compare = (size < 8) ? size : 8;
+    return (0 == memcmp(data, BEEP_SCORE_MAGIC, compare));
+}
+
+
+/* Tell binary from text scores by the magic.  For a binary score,
+ * also check its header.
+ */
+static
+bool score_detect_format(beep_score *score)
+{
+    if (score->map) {
+        const size_t window_pos = (size_t)(score->file_pos - score->map_offset);
+        const size_t available = score->map_size - window_pos;
+        if ((available >= 8)
+            && score_magic_prefix(&score->map[window_pos], available)) {
+            score->binary = true;
+            return score_map_binary(score);
+        }
+        return true;
+    }
+
+    /* Read until the magic is complete or cannot be any more, so that
+     * a text score starting with a note like B4 is not taken for a
+     * binary one, nor waits for more input than its first line.
+     */
+    while (((score->buf_end - score->buf_start) < 8)
+           && score_magic_prefix(&score->buf[score->buf_start],
+                                 score->buf_end - score->buf_start)) {
+        const int result = score_read_more(score);
+        if (result < 0) {
+            return false;
+        } else if (result == 0) {
+            return true;
+        }
+    }
+    if (!score_magic_prefix(&score->buf[score->buf_start],
+                            score->buf_end - score->buf_start)) {
+        return true;
+    }
+    score->binary = true;
+    while ((score->buf_end - score->buf_start) < BEEP_SCORE_HEADER_SIZE) {
+        const int result = score_read_more(score);
+        if (result < 0) {
+            return false;
+        } else if (result == 0) {
+            log_error("%s: truncated binary score", score->name);
+            return false;
+        }
+    }
+    if (!score_parse_header(score, (const unsigned char *)
+                            &score->buf[score->buf_start])) {
+        return false;
+    }
+    score->buf_start += BEEP_SCORE_HEADER_SIZE;
+    return true;
+}
+
+
+/* Find the next line.  Returns 1 for a line, 0 if there is no complete
+ * line without blocking (when !may_block) or at the end of the score,
+ * and -1 on error.
+ */
+static
+int score_next_line(beep_score *score, const bool may_block,
+                    const char **const line, size_t *const length)
+{
+    while (score->map) {
+        if (score->file_pos == score->file_size) {
+            return 0;
+        }
+        const size_t window_pos = (size_t)(score->file_pos - score->map_offset);
+        const char *const start = score->map + window_pos;
+        const size_t available = score->map_size - window_pos;
+        const char *const newline = memchr(start, '\n', available);
+        const bool window_is_last =
+            ((score->map_offset + (off_t)score->map_size) == score->file_size);
+        if (newline || window_is_last) {
+            *line   = start;
+            *length = newline ? (size_t)(newline - start) : available;
+            score->file_pos += (off_t)(*length + (newline ? 1 : 0));
+            return 1;
+        }
+        if (window_pos < (size_t)sysconf(_SC_PAGESIZE)) {
+            log_error("%s:%lu: line too long",
+                      score->name, score->line_number + 1);
+            return -1;
+        }
+        if (!score_map_window(score)) {
+            log_error("%s: %s", score->name, strerror(errno));
+            return -1;
+        }
+    }
+
+    while (true) {
+        const char *const start = &score->buf[score->buf_start];
+        const size_t available = score->buf_end - score->buf_start;
+        const char *const newline = memchr(start, '\n', available);
+        if (newline) {
+            *line   = start;
+            *length = (size_t)(newline - start);
+            score->buf_start += *length + 1;
+            return 1;
+        }
+        if (score->eof) {
+            if (available == 0) {
+                return 0;
+            }
+            *line   = start;
+            *length = available;
+            score->buf_start = score->buf_end;
+            return 1;
+        }
+        if (!may_block) {
+            return 0;
+        }
+        if (available == sizeof(score->buf)) {
+            log_error("%s:%lu: line too long",
+                      score->name, score->line_number + 1);
+            return -1;
+        }
+        if (score_read_more(score) < 0) {
+            return -1;
+        }
+    }
+}
+
+
+/* Parse one tone line.  Returns 1 for a tone, 0 for an empty or
+ * comment line, and -1 for an invalid line.
+ */
+static
+int score_parse_line(beep_score *score, const char *const line,
+                     const size_t length, beep_tone *const tone)
+{
+    size_t ofs = 0;
+    while ((ofs < length) && ((line[ofs] == ' ') || (line[ofs] == '\t')
+                              || (line[ofs] == '\r'))) {
+        ++ofs;
+    }
+    if ((ofs == length) || (line[ofs] == '#')) {
+        return 0;
+    }
+    if ((length - ofs) >= SCORE_MAX_LINE) {
+        return -1;
+    }
+
+    char buf[SCORE_MAX_LINE];
+    memcpy(buf, &line[ofs], length - ofs);
+    buf[length - ofs] = '\0';
+
+    unsigned int values[3] = { 0, score->default_length, score->default_delay };
+    uint32_t flags = 0;
+    const char *str = buf;
+    for (int i=0; i<3; ++i) {
+        while ((*str == ' ') || (*str == '\t') || (*str == '\r')) {
+            ++str;
+        }
+        if (*str == '\0') {
+            break;
+        }
+        const char *const note_end = (i == 0)
+            ? parse_note_value(str, &values[0]) : NULL;
+        if (note_end) {
+            flags = BEEP_TONE_NOTE | values[0];
+            values[0] = beep_note_freq_hz(values[0]);
+            str = note_end;
+        } else {
+            str = (i == 0)
+                ? parse_rounded_value(str, SCORE_MAX_FREQ, &values[i])
+                : parse_duration_value(str, SCORE_MAX_DURATION, &values[i]);
+        }
+        if ((!str) || ((*str != '\0') && (*str != ' ') && (*str != '\t')
+                       && (*str != '\r'))) {
+            return -1;
+        }
+    }
+    while ((*str == ' ') || (*str == '\t') || (*str == '\r')) {
+        ++str;
+    }
+    if (*str != '\0') {
+        return -1;
+    }
+
+    tone->freq   = values[0];
+    tone->length = beep_tempo_ms(&score->tempo, values[1]);
+    tone->delay  = beep_tempo_ms(&score->tempo, values[2]);
+    tone->flags  = flags;
+    return 1;
+}
+
+
+/* Parse up to BEEP_SCORE_LOOKAHEAD text tones into lookahead.  Tones
+ * before an error are still returned, the error only with the next
+ * call.
+ */
+static
+ssize_t score_next_text(beep_score *score)
+{
+    size_t tone_count = 0;
+    while ((!score->failed) && (tone_count < BEEP_SCORE_LOOKAHEAD)) {
+        const char *line;
+        size_t length;
+        const int found = score_next_line(score, (tone_count == 0),
+                                          &line, &length);
+        if (found < 0) {
+            score->failed = true;
+        } else if (found == 0) {
+            break;
+        } else {
+            ++score->line_number;
+            const int parsed = score_parse_line(score, line, length,
+                                                &score->lookahead[tone_count]);
+            if (parsed < 0) {
+                log_error("%s:%lu: invalid tone, expected "
+                          "FREQ_Hz [LENGTH_ms [DELAY_ms]]",
+                          score->name, score->line_number);
+                score->failed = true;
+            } else {
+                tone_count += (size_t)parsed;
+            }
+        }
+    }
+    if ((tone_count == 0) && score->failed) {
+        return -1;
+    }
+    return (ssize_t)tone_count;
+}
+
+
+static
+void score_decode_record(const unsigned char *const record,
+                         beep_tone *const tone)
+{
+    tone->freq   = get_le32(&record[0]);
+    tone->length = get_le32(&record[4]);
+    tone->delay  = get_le32(&record[8]);
+    tone->flags  = get_le32(&record[12]);
+}
+
+
+/* Check binary tones against the limits of the tone options, as a
+ * binary score need not have been written by --export-score.
+ */
+static
+bool score_check_binary(beep_score *score, const beep_tone *const tones,
+                        const size_t tone_count)
+{
+    for (size_t i=0; i<tone_count; ++i) {
+        const beep_tone *const tone = &tones[i];
+        ++score->record_number;
+        if ((tone->freq > SCORE_MAX_FREQ)
+            || (tone->length > SCORE_MAX_DURATION)
+            || (tone->delay > SCORE_MAX_DURATION)
+            || ((tone->flags != 0)
+                && (tone->flags != (BEEP_TONE_NOTE
+                                    | (tone->flags & BEEP_TONE_NOTE_MASK))))) {
+            log_error("%s:record %llu: tone out of range",
+                      score->name, (unsigned long long)score->record_number);
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/* Return binary tones, right from the mapping if the records have
+ * the host's beep_tone layout, and decoded into lookahead otherwise.
+ */
+static
+ssize_t score_next_binary(beep_score *score, const beep_tone **const tones)
+{
+    if (score->tones_left == 0) {
+        return 0;
+    }
+
+    size_t tone_count = 0;
+    if (score->map) {
+        const unsigned char *const records =
+            (const unsigned char *)&score->map[score->file_pos];
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (0 == (((uintptr_t)records) % __alignof__(beep_tone))) {
+            tone_count = (score->tones_left < SCORE_MAPPED_MAX)
+                ? (size_t)score->tones_left : SCORE_MAPPED_MAX;
+            *tones = (const beep_tone *)(const void *)records;
+            if (!score_check_binary(score, *tones, tone_count)) {
+                return -1;
+            }
+            score->tones_left -= tone_count;
+            score->file_pos += (off_t)(tone_count * BEEP_SCORE_RECORD_SIZE);
+            return (ssize_t)tone_count;
+        }
+#endif
+        while ((tone_count < BEEP_SCORE_LOOKAHEAD)
+               && (tone_count < score->tones_left)) {
+            score_decode_record(&records[tone_count * BEEP_SCORE_RECORD_SIZE],
+                                &score->lookahead[tone_count]);
+            ++tone_count;
+        }
+        score->file_pos += (off_t)(tone_count * BEEP_SCORE_RECORD_SIZE);
+    } else {
+        while ((tone_count < BEEP_SCORE_LOOKAHEAD)
+               && (tone_count < score->tones_left)) {
+            if ((score->buf_end - score->buf_start) < BEEP_SCORE_RECORD_SIZE) {
+                if (tone_count > 0) {
+                    break;
+                }
+                const int result = score_read_more(score);
+                if (result < 0) {
+                    return -1;
+                } else if ((result == 0)
+                           && (score->tones_left == BEEP_SCORE_COUNT_UNKNOWN)
+                           && (score->buf_end == score->buf_start)) {
+                    /* A score written to a pipe ends with the file */
+                    score->tones_left = 0;
+                    return 0;
+                } else if (result == 0) {
+                    log_error("%s: truncated binary score", score->name);
+                    return -1;
+                }
+                continue;
+            }
+            score_decode_record((const unsigned char *)
+                                &score->buf[score->buf_start],
+                                &score->lookahead[tone_count]);
+            score->buf_start += BEEP_SCORE_RECORD_SIZE;
+            ++tone_count;
+        }
+    }
+    if (!score_check_binary(score, score->lookahead, tone_count)) {
+        return -1;
+    }
+    if (score->tones_left != BEEP_SCORE_COUNT_UNKNOWN) {
+        score->tones_left -= tone_count;
+    }
+    *tones = score->lookahead;
+    return (ssize_t)tone_count;
+}
+
+
+ssize_t beep_score_next(beep_score *score, const beep_tone **const tones)
+{
+    if (!score->format_known) {
+        score->format_known = true;
+        score->failed = !score_detect_format(score);
+    }
+    if (!score->binary) {
+        *tones = score->lookahead;
+        return score_next_text(score);
+    }
+    if (score->failed) {
+        return -1;
+    }
+    const ssize_t tone_count = score_next_binary(score, tones);
+    score->failed = (tone_count < 0);
+    return tone_count;
+}
+
+
+void beep_score_close(beep_score *score)
+{
+    if (!score->binary) {
+        log_verbose("score: %lu lines read from %s",
+                    score->line_number, score->name);
+    }
+    if (score->map) {
+        munmap((void *)score->map, score->map_size);
+    }
+    if (score->fd != STDIN_FILENO) {
+        close(score->fd);
+    }
+    free(score);
+}
+
+
+struct _beep_score_writer {
+    FILE       *file;
+    long        start;        /* -1 if file cannot seek */
+    int         error;
+    uint64_t    tone_count;
+};
+
+
+static
+void score_write(beep_score_writer *writer, const void *const data,
+                 const size_t size)
+{
+    if ((writer->error == 0) && (1 != fwrite(data, size, 1, writer->file))) {
+        writer->error = errno;
+    }
+}
+
+
+static
+void score_write_header(beep_score_writer *writer)
+{
+    unsigned char header[BEEP_SCORE_HEADER_SIZE];
+    memcpy(header, BEEP_SCORE_MAGIC, 8);
+    put_le32(&header[8],  BEEP_SCORE_VERSION);
+    put_le32(&header[12], BEEP_SCORE_RECORD_SIZE);
+    const uint64_t tone_count = (writer->start == -1)
+        ? BEEP_SCORE_COUNT_UNKNOWN : writer->tone_count;
+    put_le32(&header[16], (uint32_t)(tone_count & 0xffffffffU));
+    put_le32(&header[20], (uint32_t)(tone_count >> 32));
+    score_write(writer, header, sizeof(header));
+}
+
+
+beep_score_writer *beep_score_fcreate(FILE *file)
+{
+    beep_score_writer *const writer = malloc(sizeof(beep_score_writer));
+    if (!writer) {
+        return NULL;
+    }
+    writer->file       = file;
+    writer->start      = ftell(file);
+    writer->error      = ((writer->start == -1) && (errno != ESPIPE)) ? errno : 0;
+    writer->tone_count = 0;
+    score_write_header(writer);
+    return writer;
+}
+
+
+beep_score_writer *beep_score_create(const char *const filename)
+{
+    if (0 == strcmp(filename, "-")) {
+        return beep_score_fcreate(stdout);
+    }
+    FILE *const file = fopen(filename, "wb");
+    if (!file) {
+        return NULL;
+    }
+    beep_score_writer *const writer = beep_score_fcreate(file);
+    if (!writer) {
+        const int saved_errno = errno;
+        fclose(file);
+        errno = saved_errno;
+    }
+    return writer;
+}
+
+
+void beep_score_write(beep_score_writer *writer,
+                      const beep_tone *const tones, const size_t count)
+{
+    for (size_t i=0; i<count; ++i) {
+        unsigned char record[BEEP_SCORE_RECORD_SIZE];
+        put_le32(&record[0],  tones[i].freq);
+        put_le32(&record[4],  tones[i].length);
+        put_le32(&record[8],  tones[i].delay);
+        put_le32(&record[12], tones[i].flags);
+        score_write(writer, record, sizeof(record));
+    }
+    writer->tone_count += count;
+}
+
+
+bool beep_score_finish(beep_score_writer *writer)
+{
+    /* Now that the number of tones is known, write the header again */
+    if (writer->start != -1) {
+        if ((writer->error == 0)
+            && (0 != fseek(writer->file, writer->start, SEEK_SET))) {
+            writer->error = errno;
+        }
+        score_write_header(writer);
+    }
+    const int result = (writer->file == stdout)
+        ? fflush(writer->file) : fclose(writer->file);
+    if ((0 != result) && (writer->error == 0)) {
+        writer->error = errno;
+    }
+    const int error = writer->error;
+    free(writer);
+    errno = error;
+    return (error == 0);
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
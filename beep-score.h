@@ -0,0 +1,152 @@
+/* beep-score.h - read tone sequences from score files
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_SCORE_H
+#define BEEP_SCORE_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "beep-driver.h"
+
+
+/** Number of tones parsed ahead of playback */
+#define BEEP_SCORE_LOOKAHEAD 16
+
+
+/** Binary score format, all numbers little endian:
+ *
+ *   offset  size
+ *        0     8  magic "BEEPSCOR"
+ *        8     4  format version
+ *       12     4  record size
+ *       16     8  number of tones, or BEEP_SCORE_COUNT_UNKNOWN for
+ *                 as many as there are up to the end of the file
+ *       24    16  first tone record: frequency (Hz), length (ms),
+ *                 delay (ms), flags (see beep_tone), 4 bytes each
+ *
+ * The records have the layout of beep_tone on little endian hosts.
+ * As any file can be given to --score, they are checked against the
+ * limits of the tone options before they are played.
+ *
+ * Scores written to pipes cannot go back to fill in the number of
+ * tones, and leave it at BEEP_SCORE_COUNT_UNKNOWN.
+ */
+#define BEEP_SCORE_MAGIC       "BEEPSCOR"
+#define BEEP_SCORE_VERSION     1
+#define BEEP_SCORE_HEADER_SIZE 24
+#define BEEP_SCORE_RECORD_SIZE 16
+#define BEEP_SCORE_COUNT_UNKNOWN UINT64_MAX
+
+
+typedef struct _beep_score beep_score;
+typedef struct _beep_score_writer beep_score_writer;
+
+
+/** Open a text or binary score file, or standard input for "-".
+ *
+ * Text tones without a length or delay get default_length and
+ * default_delay, which may be durations in beats (see beep-notes.h).
+ * Returns NULL and sets errno on error.
+ */
+beep_score *beep_score_open(const char *const filename,
+                            const unsigned int default_length,
+                            const unsigned int default_delay)
+    __attribute__(( nonnull(1) ));
+
+
+/** Like beep_score_open(), but read the score from fd, starting at
+ * its current offset.  filename is only used in messages.  On success,
+ * beep_score_close() closes fd unless it is standard input.
+ */
+beep_score *beep_score_fdopen(const int fd, const char *const filename,
+                              const unsigned int default_length,
+                              const unsigned int default_delay)
+    __attribute__(( nonnull(2) ));
+
+
+/** Set the tempo for text durations in beats, BEEP_DEFAULT_BPM if
+ * not called before the first beep_score_next().
+ */
+void beep_score_set_bpm(beep_score *score, const unsigned int bpm)
+    __attribute__(( nonnull(1) ));
+
+
+/** Point *tones to the next tones of the score.
+ *
+ * Text scores are parsed up to BEEP_SCORE_LOOKAHEAD tones ahead, and
+ * reading only blocks when no complete line has been read yet.
+ * Mapped binary scores are returned in large runs of records.  The
+ * tones stay valid until the next call.  Returns the number of tones,
+ * 0 at the end of the score, or -1 after logging an error.  Tones
+ * parsed before an error are returned first.
+ */
+ssize_t beep_score_next(beep_score *score, const beep_tone **const tones)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Close the score file and free score. */
+void beep_score_close(beep_score *score)
+    __attribute__(( nonnull(1) ));
+
+
+/** Create a binary score file, or write it to standard output for
+ * "-".  Returns NULL and sets errno on error.
+ */
+beep_score_writer *beep_score_create(const char *const filename)
+    __attribute__(( nonnull(1) ));
+
+
+/** Write a binary score to file, starting at its current position.
+ * If file cannot seek, the number of tones is left unknown.
+ * beep_score_finish() closes file unless it is stdout.
+ */
+beep_score_writer *beep_score_fcreate(FILE *file)
+    __attribute__(( nonnull(1) ));
+
+
+/** Append count tones to a binary score.  Write errors are reported
+ * by beep_score_finish().
+ */
+void beep_score_write(beep_score_writer *writer,
+                      const beep_tone *const tones, const size_t count)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Write the final header if possible, close the file and free
+ * writer.  Returns
+ * false and sets errno if any write has failed.
+ */
+bool beep_score_finish(beep_score_writer *writer)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_SCORE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,14196 @@
+	.file	"beep-score.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-score.c"
+	.type	get_le32, @function
+get_le32:
+.LVL0:
+.LFB67:
+	.file 1 "beep-score.c"
+	.loc 1 124 1 view -0
+	.cfi_startproc
+	.loc 1 125 5 view .LVU1
+	.loc 1 125 33 is_stmt 0 view .LVU2
+	movzbl	1(%rdi), %eax
+	.loc 1 125 49 view .LVU3
+	sall	$8, %eax
+	.loc 1 126 13 view .LVU4
+	movzbl	2(%rdi), %edx
+	.loc 1 126 29 view .LVU5
+	sall	$16, %edx
+	.loc 1 126 9 view .LVU6
+	orl	%edx, %eax
+	.loc 1 125 13 view .LVU7
+	movzbl	(%rdi), %edx
+	.loc 1 126 9 view .LVU8
+	orl	%edx, %eax
+	.loc 1 126 40 view .LVU9
+	movzbl	3(%rdi), %edx
+	.loc 1 126 56 view .LVU10
+	sall	$24, %edx
+	.loc 1 126 36 view .LVU11
+	orl	%edx, %eax
+	.loc 1 127 1 view .LVU12
+	ret
+	.cfi_endproc
+.LFE67:
+	.size	get_le32, .-get_le32
+	.type	put_le32, @function
+put_le32:
+.LVL1:
+.LFB68:
+	.loc 1 132 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 132 1 is_stmt 0 view .LVU14
+	movl	%esi, %eax
+	.loc 1 133 5 is_stmt 1 view .LVU15
+	.loc 1 133 12 is_stmt 0 view .LVU16
+	movb	%sil, (%rdi)
+	.loc 1 134 5 is_stmt 1 view .LVU17
+	.loc 1 134 12 is_stmt 0 view .LVU18
+	movzbl	%ah, %ecx
+	movb	%cl, 1(%rdi)
+	.loc 1 135 5 is_stmt 1 view .LVU19
+	.loc 1 135 35 is_stmt 0 view .LVU20
+	movl	%esi, %edx
+	shrl	$16, %edx
+	.loc 1 135 12 view .LVU21
+	movb	%dl, 2(%rdi)
+	.loc 1 136 5 is_stmt 1 view .LVU22
+	.loc 1 136 35 is_stmt 0 view .LVU23
+	shrl	$24, %eax
+	.loc 1 136 12 view .LVU24
+	movb	%al, 3(%rdi)
+	.loc 1 137 1 view .LVU25
+	ret
+	.cfi_endproc
+.LFE68:
+	.size	put_le32, .-put_le32
+	.type	score_decode_record, @function
+score_decode_record:
+.LVL2:
+.LFB81:
+	.loc 1 585 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 585 1 is_stmt 0 view .LVU27
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rbp
+	.loc 1 586 5 is_stmt 1 view .LVU28
+	.loc 1 586 18 is_stmt 0 view .LVU29
+	call	get_le32
+.LVL3:
+	.loc 1 586 16 view .LVU30
+	movl	%eax, 0(%rbp)
+	.loc 1 587 5 is_stmt 1 view .LVU31
+	.loc 1 587 29 is_stmt 0 view .LVU32
+	leaq	4(%rbx), %rdi
+	.loc 1 587 20 view .LVU33
+	call	get_le32
+.LVL4:
+	.loc 1 587 18 view .LVU34
+	movl	%eax, 4(%rbp)
+	.loc 1 588 5 is_stmt 1 view .LVU35
+	.loc 1 588 28 is_stmt 0 view .LVU36
+	leaq	8(%rbx), %rdi
+	.loc 1 588 19 view .LVU37
+	call	get_le32
+.LVL5:
+	.loc 1 588 17 view .LVU38
+	movl	%eax, 8(%rbp)
+	.loc 1 589 5 is_stmt 1 view .LVU39
+	.loc 1 589 28 is_stmt 0 view .LVU40
+	leaq	12(%rbx), %rdi
+	.loc 1 589 19 view .LVU41
+	call	get_le32
+.LVL6:
+	.loc 1 589 17 view .LVU42
+	movl	%eax, 12(%rbp)
+	.loc 1 590 1 view .LVU43
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL7:
+	.loc 1 590 1 view .LVU44
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL8:
+	.loc 1 590 1 view .LVU45
+	ret
+	.cfi_endproc
+.LFE81:
+	.size	score_decode_record, .-score_decode_record
+	.type	score_map_window, @function
+score_map_window:
+.LVL9:
+.LFB69:
+	.loc 1 145 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 145 1 is_stmt 0 view .LVU47
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	.loc 1 146 5 is_stmt 1 view .LVU48
+	.loc 1 146 14 is_stmt 0 view .LVU49
+	movq	72(%rdi), %rdi
+.LVL10:
+	.loc 1 146 8 view .LVU50
+	testq	%rdi, %rdi
+	je	.L6
+	.loc 1 147 9 is_stmt 1 view .LVU51
+	movq	88(%rbx), %rsi
+	call	munmap@PLT
+.LVL11:
+	.loc 1 148 9 view .LVU52
+	.loc 1 148 20 is_stmt 0 view .LVU53
+	movq	$0, 72(%rbx)
+.L6:
+	.loc 1 150 5 is_stmt 1 view .LVU54
+	.loc 1 150 29 is_stmt 0 view .LVU55
+	movl	$30, %edi
+	call	sysconf@PLT
+.LVL12:
+	movq	%rax, %rcx
+.LVL13:
+	.loc 1 151 5 is_stmt 1 view .LVU56
+	.loc 1 151 31 is_stmt 0 view .LVU57
+	movq	104(%rbx), %r13
+	.loc 1 151 61 view .LVU58
+	movq	%r13, %rax
+.LVL14:
+	.loc 1 151 61 view .LVU59
+	cqto
+	idivq	%rcx
+	.loc 1 151 17 view .LVU60
+	subq	%rdx, %r13
+.LVL15:
+	.loc 1 152 5 is_stmt 1 view .LVU61
+	.loc 1 153 5 view .LVU62
+	.loc 1 152 17 is_stmt 0 view .LVU63
+	movq	96(%rbx), %rbp
+	subq	%r13, %rbp
+.LVL16:
+	.loc 1 154 24 view .LVU64
+	movl	$1048576, %eax
+	cmpq	%rax, %rbp
+	cmovg	%rax, %rbp
+.LVL17:
+	.loc 1 155 5 is_stmt 1 view .LVU65
+	.loc 1 155 23 is_stmt 0 view .LVU66
+	movq	%r13, %r9
+	movl	(%rbx), %r8d
+	movl	$2, %ecx
+.LVL18:
+	.loc 1 155 23 view .LVU67
+	movl	$1, %edx
+	movq	%rbp, %rsi
+	movl	$0, %edi
+	call	mmap@PLT
+.LVL19:
+	.loc 1 155 23 view .LVU68
+	movq	%rax, %r12
+.LVL20:
+	.loc 1 157 5 is_stmt 1 view .LVU69
+	.loc 1 157 8 is_stmt 0 view .LVU70
+	cmpq	$-1, %rax
+	je	.L10
+	.loc 1 160 5 is_stmt 1 view .LVU71
+	movl	$2, %edx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	madvise@PLT
+.LVL21:
+	.loc 1 161 5 view .LVU72
+	.loc 1 161 16 is_stmt 0 view .LVU73
+	movq	%r12, 72(%rbx)
+	.loc 1 162 5 is_stmt 1 view .LVU74
+	.loc 1 162 23 is_stmt 0 view .LVU75
+	movq	%r13, 80(%rbx)
+	.loc 1 163 5 is_stmt 1 view .LVU76
+	.loc 1 163 21 is_stmt 0 view .LVU77
+	movq	%rbp, 88(%rbx)
+	.loc 1 164 5 is_stmt 1 view .LVU78
+	.loc 1 164 11 is_stmt 0 view .LVU79
+	movl	$1, %eax
+.L5:
+	.loc 1 165 1 view .LVU80
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL22:
+	.loc 1 165 1 view .LVU81
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL23:
+	.loc 1 165 1 view .LVU82
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 165 1 view .LVU83
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL25:
+	.loc 1 165 1 view .LVU84
+	ret
+.LVL26:
+.L10:
+	.cfi_restore_state
+	.loc 1 158 9 is_stmt 1 view .LVU85
+	.loc 1 158 23 is_stmt 0 view .LVU86
+	movq	104(%rbx), %rsi
+	movl	(%rbx), %edi
+	movl	$0, %edx
+	call	lseek@PLT
+.LVL27:
+	.loc 1 158 20 view .LVU87
+	cmpq	$-1, %rax
+	setne	%al
+	jmp	.L5
+	.cfi_endproc
+.LFE69:
+	.size	score_map_window, .-score_map_window
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"%s:record %llu: tone out of range"
+	.text
+	.type	score_check_binary, @function
+score_check_binary:
+.LVL28:
+.LFB82:
+	.loc 1 599 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 600 5 view .LVU89
+.LBB16:
+	.loc 1 600 10 view .LVU90
+	.loc 1 600 23 view .LVU91
+	testq	%rdx, %rdx
+	je	.L16
+	movq	%rdx, %r9
+	.loc 1 600 17 is_stmt 0 view .LVU92
+	movl	$0, %ecx
+	jmp	.L15
+.LVL29:
+.L14:
+	.loc 1 600 36 is_stmt 1 discriminator 2 view .LVU93
+	addq	$1, %rcx
+.LVL30:
+	.loc 1 600 23 discriminator 2 view .LVU94
+	addq	$16, %rsi
+.LVL31:
+	.loc 1 600 23 is_stmt 0 discriminator 2 view .LVU95
+	cmpq	%rcx, %r9
+	je	.L21
+.LVL32:
+.L15:
+.LBB17:
+	.loc 1 601 9 is_stmt 1 view .LVU96
+	.loc 1 602 9 view .LVU97
+	movq	64(%rdi), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, 64(%rdi)
+	.loc 1 603 9 view .LVU98
+	.loc 1 603 12 is_stmt 0 view .LVU99
+	cmpl	$20000, (%rsi)
+	ja	.L13
+	.loc 1 604 13 view .LVU100
+	cmpl	$300000, 4(%rsi)
+	ja	.L13
+	.loc 1 605 13 view .LVU101
+	cmpl	$300000, 8(%rsi)
+	ja	.L13
+	.loc 1 606 22 view .LVU102
+	movl	12(%rsi), %eax
+	.loc 1 606 13 view .LVU103
+	testl	%eax, %eax
+	je	.L14
+	.loc 1 608 52 view .LVU104
+	movl	%eax, %r8d
+	andl	$127, %r8d
+	.loc 1 608 37 view .LVU105
+	orl	$256, %r8d
+	.loc 1 607 17 view .LVU106
+	cmpl	%r8d, %eax
+	je	.L14
+.L13:
+.LBE17:
+.LBE16:
+	.loc 1 599 1 view .LVU107
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB19:
+.LBB18:
+	.loc 1 609 13 is_stmt 1 view .LVU108
+	movq	8(%rdi), %rsi
+.LVL33:
+	.loc 1 609 13 is_stmt 0 view .LVU109
+	leaq	.LC0(%rip), %rdi
+.LVL34:
+	.loc 1 609 13 view .LVU110
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL35:
+	.loc 1 611 13 is_stmt 1 view .LVU111
+	.loc 1 611 19 is_stmt 0 view .LVU112
+	movl	$0, %eax
+.LBE18:
+.LBE19:
+	.loc 1 615 1 view .LVU113
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL36:
+.L21:
+	.loc 1 614 11 view .LVU114
+	movl	$1, %eax
+.LBB20:
+	ret
+.LVL37:
+.L16:
+	.loc 1 614 11 view .LVU115
+.LBE20:
+	movl	$1, %eax
+	.loc 1 615 1 view .LVU116
+	ret
+	.cfi_endproc
+.LFE82:
+	.size	score_check_binary, .-score_check_binary
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"BEEPSCOR"
+.LC2:
+	.string	"%s: not a beep score"
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"%s: unsupported binary score version %u"
+	.align 8
+.LC4:
+	.string	"score: %s is a binary score up to its end"
+	.align 8
+.LC5:
+	.string	"score: %s is a binary score with %llu tones"
+	.text
+	.type	score_parse_header, @function
+score_parse_header:
+.LVL38:
+.LFB74:
+	.loc 1 277 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 277 1 is_stmt 0 view .LVU118
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	.loc 1 278 5 is_stmt 1 view .LVU119
+	.loc 1 278 14 is_stmt 0 view .LVU120
+	movl	$8, %edx
+	leaq	.LC1(%rip), %rsi
+.LVL39:
+	.loc 1 278 14 view .LVU121
+	movq	%rbx, %rdi
+.LVL40:
+	.loc 1 278 14 view .LVU122
+	call	memcmp@PLT
+.LVL41:
+	.loc 1 278 8 view .LVU123
+	testl	%eax, %eax
+	jne	.L32
+	.loc 1 282 5 is_stmt 1 view .LVU124
+	.loc 1 282 39 is_stmt 0 view .LVU125
+	leaq	8(%rbx), %rdi
+	.loc 1 282 30 view .LVU126
+	call	get_le32
+.LVL42:
+	movl	%eax, %r12d
+.LVL43:
+	.loc 1 283 5 is_stmt 1 view .LVU127
+	.loc 1 283 43 is_stmt 0 view .LVU128
+	leaq	12(%rbx), %rdi
+	.loc 1 283 34 view .LVU129
+	call	get_le32
+.LVL44:
+	.loc 1 284 5 is_stmt 1 view .LVU130
+	.loc 1 284 8 is_stmt 0 view .LVU131
+	cmpl	$1, %r12d
+	jne	.L30
+	cmpl	$16, %eax
+	jne	.L30
+	.loc 1 290 5 is_stmt 1 view .LVU132
+	.loc 1 290 45 is_stmt 0 view .LVU133
+	leaq	16(%rbx), %rdi
+	.loc 1 290 36 view .LVU134
+	call	get_le32
+.LVL45:
+	.loc 1 290 36 view .LVU135
+	movl	%eax, %r12d
+.LVL46:
+	.loc 1 291 32 view .LVU136
+	leaq	20(%rbx), %rdi
+	.loc 1 291 23 view .LVU137
+	call	get_le32
+.LVL47:
+	.loc 1 291 46 view .LVU138
+	movq	%rax, %rdx
+	salq	$32, %rdx
+	.loc 1 290 26 view .LVU139
+	movl	%r12d, %r12d
+	.loc 1 291 9 view .LVU140
+	orq	%r12, %rdx
+	.loc 1 290 23 view .LVU141
+	movq	%rdx, 56(%rbp)
+	.loc 1 292 5 is_stmt 1 view .LVU142
+	.loc 1 292 8 is_stmt 0 view .LVU143
+	cmpq	$-1, %rdx
+	je	.L33
+	.loc 1 295 9 is_stmt 1 view .LVU144
+	.loc 1 295 14 view .LVU145
+	.loc 1 298 11 is_stmt 0 view .LVU146
+	movl	$1, %eax
+	.loc 1 295 17 view .LVU147
+	cmpl	$0, log_level(%rip)
+	jg	.L34
+.LVL48:
+.L22:
+	.loc 1 299 1 view .LVU148
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL49:
+	.loc 1 299 1 view .LVU149
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL50:
+	.loc 1 299 1 view .LVU150
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL51:
+.L32:
+	.cfi_restore_state
+	.loc 1 279 9 is_stmt 1 view .LVU151
+	movq	8(%rbp), %rsi
+	leaq	.LC2(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL52:
+	.loc 1 280 9 view .LVU152
+	.loc 1 280 15 is_stmt 0 view .LVU153
+	movl	$0, %eax
+	jmp	.L22
+.LVL53:
+.L30:
+	.loc 1 286 9 is_stmt 1 view .LVU154
+	movq	8(%rbp), %rsi
+	movl	%r12d, %edx
+	leaq	.LC3(%rip), %rdi
+	movl	$0, %eax
+.LVL54:
+	.loc 1 286 9 is_stmt 0 view .LVU155
+	call	log_error@PLT
+.LVL55:
+	.loc 1 288 9 is_stmt 1 view .LVU156
+	.loc 1 288 15 is_stmt 0 view .LVU157
+	movl	$0, %eax
+	jmp	.L22
+.LVL56:
+.L33:
+	.loc 1 293 9 is_stmt 1 view .LVU158
+	.loc 1 293 14 view .LVU159
+	.loc 1 298 11 is_stmt 0 view .LVU160
+	movl	$1, %eax
+	.loc 1 293 17 view .LVU161
+	cmpl	$0, log_level(%rip)
+	jle	.L22
+	.loc 1 293 50 is_stmt 1 discriminator 1 view .LVU162
+	movq	8(%rbp), %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL57:
+	.loc 1 298 11 is_stmt 0 discriminator 1 view .LVU163
+	movl	$1, %eax
+	jmp	.L22
+.L34:
+	.loc 1 295 50 is_stmt 1 discriminator 1 view .LVU164
+	movq	8(%rbp), %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL58:
+	.loc 1 298 11 is_stmt 0 discriminator 1 view .LVU165
+	movl	$1, %eax
+	jmp	.L22
+	.cfi_endproc
+.LFE74:
+	.size	score_parse_header, .-score_parse_header
+	.section	.rodata.str1.1
+.LC6:
+	.string	"%s: %s"
+	.text
+	.type	score_read_more, @function
+score_read_more:
+.LVL59:
+.LFB73:
+	.loc 1 249 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 250 5 view .LVU167
+	.loc 1 251 16 is_stmt 0 view .LVU168
+	movl	$0, %eax
+	.loc 1 250 8 view .LVU169
+	cmpb	$0, 128(%rdi)
+	jne	.L43
+	.loc 1 249 1 view .LVU170
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 253 5 is_stmt 1 view .LVU171
+	.loc 1 253 14 is_stmt 0 view .LVU172
+	movq	112(%rdi), %rax
+	.loc 1 253 8 view .LVU173
+	testq	%rax, %rax
+	jne	.L46
+.LVL60:
+.L37:
+	.loc 1 259 5 is_stmt 1 view .LVU174
+	.loc 1 260 58 is_stmt 0 view .LVU175
+	movq	120(%rbx), %rax
+.LVL61:
+.LBB21:
+.LBI21:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/unistd.h"
+	.loc 2 36 1 is_stmt 1 view .LVU176
+.LBB22:
+	.loc 2 38 3 view .LVU177
+.LBE22:
+.LBE21:
+	.loc 1 259 27 is_stmt 0 view .LVU178
+	movl	$65536, %edx
+	subq	%rax, %rdx
+.LVL62:
+	.loc 1 259 43 view .LVU179
+	leaq	129(%rbx,%rax), %rsi
+.LVL63:
+.LBB24:
+.LBB23:
+	.loc 2 38 469 view .LVU180
+	movl	(%rbx), %edi
+	call	read@PLT
+.LVL64:
+	.loc 2 38 469 view .LVU181
+.LBE23:
+.LBE24:
+	.loc 1 261 5 is_stmt 1 view .LVU182
+	.loc 1 261 8 is_stmt 0 view .LVU183
+	testq	%rax, %rax
+	jle	.L38
+	.loc 1 262 9 is_stmt 1 view .LVU184
+	.loc 1 262 24 is_stmt 0 view .LVU185
+	addq	%rax, 120(%rbx)
+	.loc 1 270 12 view .LVU186
+	movl	$1, %eax
+.LVL65:
+.L35:
+	.loc 1 271 1 view .LVU187
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL66:
+	.loc 1 271 1 view .LVU188
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL67:
+.L46:
+	.cfi_restore_state
+.LBB25:
+	.loc 1 254 9 is_stmt 1 view .LVU189
+	.loc 1 254 22 is_stmt 0 view .LVU190
+	movq	120(%rdi), %rbp
+	subq	%rax, %rbp
+.LVL68:
+	.loc 1 255 9 is_stmt 1 view .LVU191
+.LBB26:
+.LBI26:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/string_fortified.h"
+	.loc 3 34 42 view .LVU192
+.LBB27:
+	.loc 3 36 3 view .LVU193
+.LBE27:
+.LBE26:
+	.loc 1 255 29 is_stmt 0 view .LVU194
+	leaq	129(%rdi,%rax), %rsi
+.LVL69:
+.LBB29:
+.LBB28:
+	.loc 3 36 10 view .LVU195
+	leaq	129(%rdi), %rdi
+.LVL70:
+	.loc 3 36 10 view .LVU196
+	movq	%rbp, %rdx
+	call	memmove@PLT
+.LVL71:
+	.loc 3 36 10 view .LVU197
+.LBE28:
+.LBE29:
+	.loc 1 256 9 is_stmt 1 view .LVU198
+	.loc 1 256 26 is_stmt 0 view .LVU199
+	movq	$0, 112(%rbx)
+	.loc 1 257 9 is_stmt 1 view .LVU200
+	.loc 1 257 24 is_stmt 0 view .LVU201
+	movq	%rbp, 120(%rbx)
+	jmp	.L37
+.LVL72:
+.L38:
+	.loc 1 257 24 view .LVU202
+.LBE25:
+	.loc 1 263 12 is_stmt 1 view .LVU203
+	.loc 1 263 15 is_stmt 0 view .LVU204
+	je	.L47
+	.loc 1 266 12 is_stmt 1 view .LVU205
+	.loc 1 266 17 is_stmt 0 view .LVU206
+	call	__errno_location@PLT
+.LVL73:
+	.loc 1 266 16 view .LVU207
+	movl	(%rax), %edi
+	.loc 1 270 12 view .LVU208
+	movl	$1, %eax
+	.loc 1 266 15 view .LVU209
+	cmpl	$4, %edi
+	je	.L35
+	.loc 1 267 9 is_stmt 1 view .LVU210
+	call	strerror@PLT
+.LVL74:
+	movq	%rax, %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL75:
+	.loc 1 268 9 view .LVU211
+	.loc 1 268 16 is_stmt 0 view .LVU212
+	movl	$-1, %eax
+	jmp	.L35
+.LVL76:
+.L47:
+	.loc 1 264 9 is_stmt 1 view .LVU213
+	.loc 1 264 20 is_stmt 0 view .LVU214
+	movb	$1, 128(%rbx)
+	.loc 1 265 9 is_stmt 1 view .LVU215
+	.loc 1 265 16 is_stmt 0 view .LVU216
+	jmp	.L35
+.LVL77:
+.L43:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.loc 1 271 1 view .LVU217
+	ret
+	.cfi_endproc
+.LFE73:
+	.size	score_read_more, .-score_read_more
+	.type	score_parse_line, @function
+score_parse_line:
+.LVL78:
+.LFB79:
+	.loc 1 486 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 486 1 is_stmt 0 view .LVU219
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	movq	%rdi, %rbp
+	movq	%rcx, %r12
+	.loc 1 486 1 view .LVU220
+	movq	%fs:40, %rax
+	movq	%rax, 296(%rsp)
+	xorl	%eax, %eax
+	.loc 1 487 5 is_stmt 1 view .LVU221
+.LVL79:
+	.loc 1 488 5 view .LVU222
+	.loc 1 488 27 view .LVU223
+	.loc 1 493 16 is_stmt 0 view .LVU224
+	movl	$0, %ecx
+.LVL80:
+	.loc 1 488 27 view .LVU225
+	testq	%rdx, %rdx
+	jne	.L49
+	jmp	.L48
+.LVL81:
+.L51:
+	.loc 1 490 9 is_stmt 1 view .LVU226
+	addq	$1, %rax
+.LVL82:
+	.loc 1 488 27 view .LVU227
+	cmpq	%rax, %rdx
+	je	.L68
+.LVL83:
+.L49:
+	.loc 1 488 36 is_stmt 0 discriminator 1 view .LVU228
+	movzbl	(%rsi,%rax), %ecx
+	.loc 1 488 50 discriminator 1 view .LVU229
+	movl	%ecx, %edi
+	andl	$-5, %edi
+	.loc 1 489 31 discriminator 1 view .LVU230
+	cmpb	$9, %dil
+	je	.L51
+	cmpb	$32, %cl
+	je	.L51
+	.loc 1 492 5 is_stmt 1 view .LVU231
+	.loc 1 492 8 is_stmt 0 view .LVU232
+	cmpq	%rax, %rdx
+	je	.L69
+	.loc 1 492 33 discriminator 1 view .LVU233
+	addq	%rax, %rsi
+.LVL84:
+	.loc 1 493 16 discriminator 1 view .LVU234
+	movl	$0, %ecx
+	.loc 1 492 25 discriminator 1 view .LVU235
+	cmpb	$35, (%rsi)
+	je	.L48
+	.loc 1 495 5 is_stmt 1 view .LVU236
+	.loc 1 495 17 is_stmt 0 view .LVU237
+	subq	%rax, %rdx
+.LVL85:
+	.loc 1 495 17 view .LVU238
+	movq	%rdx, %r13
+	.loc 1 496 16 view .LVU239
+	movl	$-1, %ecx
+	.loc 1 495 8 view .LVU240
+	cmpq	$255, %rdx
+	ja	.L48
+	.loc 1 499 5 is_stmt 1 view .LVU241
+	.loc 1 500 5 view .LVU242
+.LVL86:
+.LBB30:
+.LBI30:
+	.loc 3 26 42 view .LVU243
+.LBB31:
+	.loc 3 29 3 view .LVU244
+	.loc 3 29 10 is_stmt 0 view .LVU245
+	leaq	32(%rsp), %rbx
+.LVL87:
+	.loc 3 29 10 view .LVU246
+	movl	$256, %ecx
+	movq	%rbx, %rdi
+	call	__memcpy_chk@PLT
+.LVL88:
+	.loc 3 29 10 view .LVU247
+.LBE31:
+.LBE30:
+	.loc 1 501 5 is_stmt 1 view .LVU248
+	.loc 1 501 23 is_stmt 0 view .LVU249
+	movb	$0, 32(%rsp,%r13)
+	.loc 1 503 5 is_stmt 1 view .LVU250
+	.loc 1 503 18 is_stmt 0 view .LVU251
+	movl	$0, 20(%rsp)
+	movl	24(%rbp), %eax
+	movl	%eax, 24(%rsp)
+	movl	28(%rbp), %eax
+	movl	%eax, 28(%rsp)
+	.loc 1 504 5 is_stmt 1 view .LVU252
+.LVL89:
+	.loc 1 505 5 view .LVU253
+	.loc 1 506 5 view .LVU254
+.LBB32:
+	.loc 1 506 10 view .LVU255
+	.loc 1 506 20 view .LVU256
+	leaq	20(%rsp), %r14
+	.loc 1 506 14 is_stmt 0 view .LVU257
+	movl	$0, %r13d
+.LBE32:
+	.loc 1 504 14 view .LVU258
+	movl	$0, 12(%rsp)
+	jmp	.L52
+.LVL90:
+.L62:
+	.loc 1 529 44 is_stmt 1 view .LVU259
+	.loc 1 529 13 is_stmt 0 view .LVU260
+	movzbl	(%rbx), %eax
+	.loc 1 529 26 view .LVU261
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 529 44 view .LVU262
+	cmpb	$9, %dl
+	je	.L81
+	.loc 1 529 44 view .LVU263
+	cmpb	$32, %al
+	jne	.L56
+.L81:
+	.loc 1 530 9 is_stmt 1 view .LVU264
+	addq	$1, %rbx
+.LVL91:
+	.loc 1 529 44 view .LVU265
+	.loc 1 529 13 is_stmt 0 view .LVU266
+	movzbl	(%rbx), %eax
+	.loc 1 529 26 view .LVU267
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 529 44 view .LVU268
+	cmpb	$9, %dl
+	je	.L81
+	cmpb	$32, %al
+	je	.L81
+.L56:
+	.loc 1 532 5 is_stmt 1 view .LVU269
+	.loc 1 533 16 is_stmt 0 view .LVU270
+	movl	$-1, %ecx
+	.loc 1 532 8 view .LVU271
+	testb	%al, %al
+	jne	.L48
+	.loc 1 536 5 is_stmt 1 view .LVU272
+	.loc 1 536 16 is_stmt 0 view .LVU273
+	movl	20(%rsp), %eax
+	movl	%eax, (%r12)
+	.loc 1 537 5 is_stmt 1 view .LVU274
+	.loc 1 537 20 is_stmt 0 view .LVU275
+	addq	$32, %rbp
+.LVL92:
+	.loc 1 537 20 view .LVU276
+	movl	24(%rsp), %esi
+	movq	%rbp, %rdi
+	call	beep_tempo_ms@PLT
+.LVL93:
+	.loc 1 537 18 view .LVU277
+	movl	%eax, 4(%r12)
+	.loc 1 538 5 is_stmt 1 view .LVU278
+	.loc 1 538 19 is_stmt 0 view .LVU279
+	movl	28(%rsp), %esi
+	movq	%rbp, %rdi
+	call	beep_tempo_ms@PLT
+.LVL94:
+	.loc 1 538 17 view .LVU280
+	movl	%eax, 8(%r12)
+	.loc 1 539 5 is_stmt 1 view .LVU281
+	.loc 1 539 17 is_stmt 0 view .LVU282
+	movl	12(%rsp), %eax
+	movl	%eax, 12(%r12)
+	.loc 1 540 5 is_stmt 1 view .LVU283
+	.loc 1 540 12 is_stmt 0 view .LVU284
+	movl	$1, %ecx
+	jmp	.L48
+.LVL95:
+.L84:
+.LBB37:
+.LBB33:
+	.loc 1 514 15 discriminator 1 view .LVU285
+	leaq	20(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	parse_note_value@PLT
+.LVL96:
+	movq	%rax, %r15
+.LVL97:
+	.loc 1 515 9 is_stmt 1 discriminator 1 view .LVU286
+	.loc 1 515 12 is_stmt 0 discriminator 1 view .LVU287
+	testq	%rax, %rax
+	je	.L58
+	.loc 1 516 13 is_stmt 1 view .LVU288
+	.loc 1 516 36 is_stmt 0 view .LVU289
+	movl	20(%rsp), %edi
+	.loc 1 516 19 view .LVU290
+	movl	%edi, %eax
+.LVL98:
+	.loc 1 516 19 view .LVU291
+	orb	$1, %ah
+.LVL99:
+	.loc 1 516 19 view .LVU292
+	movl	%eax, 12(%rsp)
+.LVL100:
+	.loc 1 517 13 is_stmt 1 view .LVU293
+	.loc 1 517 25 is_stmt 0 view .LVU294
+	call	beep_note_freq_hz@PLT
+.LVL101:
+	.loc 1 517 23 view .LVU295
+	movl	%eax, 20(%rsp)
+	.loc 1 518 13 is_stmt 1 view .LVU296
+.LVL102:
+	.loc 1 524 9 view .LVU297
+	.loc 1 524 25 is_stmt 0 view .LVU298
+	movzbl	(%r15), %eax
+	.loc 1 524 56 view .LVU299
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 525 24 view .LVU300
+	cmpb	$9, %dl
+	je	.L60
+	testb	$-33, %al
+	jne	.L83
+.L60:
+.LBE33:
+	.loc 1 506 24 is_stmt 1 view .LVU301
+	addl	$1, %r13d
+.LVL103:
+	.loc 1 506 20 view .LVU302
+	addq	$4, %r14
+.LBB34:
+	.loc 1 514 15 is_stmt 0 view .LVU303
+	movq	%r15, %rbx
+	.loc 1 514 15 view .LVU304
+	jmp	.L52
+.LVL104:
+.L76:
+	.loc 1 514 15 view .LVU305
+.LBE34:
+	.loc 1 506 24 is_stmt 1 discriminator 2 view .LVU306
+	addl	$1, %r13d
+.LVL105:
+	.loc 1 506 20 discriminator 2 view .LVU307
+	cmpl	$3, %r13d
+	je	.L62
+	.loc 1 506 20 is_stmt 0 view .LVU308
+	addq	$4, %r14
+.LVL106:
+.L52:
+.LBB35:
+	.loc 1 507 48 is_stmt 1 view .LVU309
+	.loc 1 507 17 is_stmt 0 view .LVU310
+	movzbl	(%rbx), %eax
+	.loc 1 507 30 view .LVU311
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 507 48 view .LVU312
+	cmpb	$9, %dl
+	je	.L80
+	.loc 1 507 48 view .LVU313
+	cmpb	$32, %al
+	jne	.L63
+.L80:
+	.loc 1 508 13 is_stmt 1 view .LVU314
+	addq	$1, %rbx
+.LVL107:
+	.loc 1 507 48 view .LVU315
+	.loc 1 507 17 is_stmt 0 view .LVU316
+	movzbl	(%rbx), %eax
+	.loc 1 507 30 view .LVU317
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 507 48 view .LVU318
+	cmpb	$9, %dl
+	je	.L80
+	cmpb	$32, %al
+	je	.L80
+.L63:
+	.loc 1 510 9 is_stmt 1 view .LVU319
+	.loc 1 510 12 is_stmt 0 view .LVU320
+	testb	%al, %al
+	je	.L62
+	.loc 1 513 9 is_stmt 1 view .LVU321
+	.loc 1 514 49 is_stmt 0 view .LVU322
+	testl	%r13d, %r13d
+	je	.L84
+	.loc 1 520 13 is_stmt 1 view .LVU323
+	.loc 1 522 19 is_stmt 0 view .LVU324
+	movq	%r14, %rdx
+	movl	$300000, %esi
+	movq	%rbx, %rdi
+	call	parse_duration_value@PLT
+.LVL108:
+	movq	%rax, %rbx
+.LVL109:
+.L64:
+	.loc 1 524 9 is_stmt 1 view .LVU325
+	.loc 1 524 12 is_stmt 0 view .LVU326
+	testq	%rbx, %rbx
+	je	.L73
+	.loc 1 524 25 discriminator 1 view .LVU327
+	movzbl	(%rbx), %eax
+	.loc 1 524 56 discriminator 1 view .LVU328
+	movl	%eax, %edx
+	andl	$-5, %edx
+	.loc 1 525 24 discriminator 1 view .LVU329
+	cmpb	$9, %dl
+	je	.L76
+	testb	$-33, %al
+	je	.L76
+	.loc 1 526 20 view .LVU330
+	movl	$-1, %ecx
+	jmp	.L48
+.LVL110:
+.L68:
+	.loc 1 526 20 view .LVU331
+.LBE35:
+.LBE37:
+	.loc 1 493 16 view .LVU332
+	movl	$0, %ecx
+.LVL111:
+.L48:
+	.loc 1 541 1 view .LVU333
+	movq	296(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L85
+	movl	%ecx, %eax
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL112:
+	.loc 1 541 1 view .LVU334
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL113:
+.L69:
+	.cfi_restore_state
+	.loc 1 493 16 view .LVU335
+	movl	$0, %ecx
+	jmp	.L48
+.LVL114:
+.L83:
+.LBB38:
+.LBB36:
+	.loc 1 526 20 view .LVU336
+	movl	$-1, %ecx
+	jmp	.L48
+.LVL115:
+.L73:
+	.loc 1 526 20 view .LVU337
+	movl	$-1, %ecx
+	jmp	.L48
+.LVL116:
+.L58:
+	.loc 1 520 13 is_stmt 1 view .LVU338
+	.loc 1 521 19 is_stmt 0 view .LVU339
+	leaq	20(%rsp), %rdx
+	movl	$20000, %esi
+	movq	%rbx, %rdi
+	call	parse_rounded_value@PLT
+.LVL117:
+	movq	%rax, %rbx
+.LVL118:
+	.loc 1 521 19 view .LVU340
+	jmp	.L64
+.LVL119:
+.L85:
+	.loc 1 521 19 view .LVU341
+.LBE36:
+.LBE38:
+	.loc 1 541 1 view .LVU342
+	call	__stack_chk_fail@PLT
+.LVL120:
+	.cfi_endproc
+.LFE79:
+	.size	score_parse_line, .-score_parse_line
+	.type	score_write, @function
+score_write:
+.LVL121:
+.LFB86:
+	.loc 1 738 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 738 1 is_stmt 0 view .LVU344
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 739 5 is_stmt 1 view .LVU345
+	.loc 1 739 8 is_stmt 0 view .LVU346
+	cmpl	$0, 16(%rdi)
+	je	.L89
+.LVL122:
+.L86:
+	.loc 1 742 1 view .LVU347
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL123:
+	.loc 1 742 1 view .LVU348
+	ret
+.LVL124:
+.L89:
+	.cfi_restore_state
+	.loc 1 742 1 view .LVU349
+	movq	%rsi, %rdi
+	movq	%rdx, %rsi
+.LVL125:
+	.loc 1 739 39 discriminator 1 view .LVU350
+	movq	(%rbx), %rcx
+	movl	$1, %edx
+.LVL126:
+	.loc 1 739 39 discriminator 1 view .LVU351
+	call	fwrite@PLT
+.LVL127:
+	.loc 1 739 30 discriminator 1 view .LVU352
+	cmpq	$1, %rax
+	je	.L86
+	.loc 1 740 9 is_stmt 1 view .LVU353
+	.loc 1 740 26 is_stmt 0 view .LVU354
+	call	__errno_location@PLT
+.LVL128:
+	.loc 1 740 25 view .LVU355
+	movl	(%rax), %eax
+	.loc 1 740 23 view .LVU356
+	movl	%eax, 16(%rbx)
+	.loc 1 742 1 view .LVU357
+	jmp	.L86
+	.cfi_endproc
+.LFE86:
+	.size	score_write, .-score_write
+	.type	score_write_header, @function
+score_write_header:
+.LVL129:
+.LFB87:
+	.loc 1 747 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 747 1 is_stmt 0 view .LVU359
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbx
+	.loc 1 747 1 view .LVU360
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 748 5 is_stmt 1 view .LVU361
+	.loc 1 749 5 view .LVU362
+.LVL130:
+.LBB39:
+.LBI39:
+	.loc 3 26 42 view .LVU363
+.LBB40:
+	.loc 3 29 3 view .LVU364
+	.loc 3 29 10 is_stmt 0 view .LVU365
+	movabsq	$5931033259378296130, %rax
+	movq	%rax, (%rsp)
+.LVL131:
+	.loc 3 29 10 view .LVU366
+.LBE40:
+.LBE39:
+	.loc 1 750 5 is_stmt 1 view .LVU367
+	leaq	8(%rsp), %rdi
+.LVL132:
+	.loc 1 750 5 is_stmt 0 view .LVU368
+	movl	$1, %esi
+	call	put_le32
+.LVL133:
+	.loc 1 751 5 is_stmt 1 view .LVU369
+	leaq	12(%rsp), %rdi
+	movl	$16, %esi
+	call	put_le32
+.LVL134:
+	.loc 1 752 5 view .LVU370
+	.loc 1 753 35 is_stmt 0 view .LVU371
+	movq	$-1, %rbp
+	cmpq	$-1, 8(%rbx)
+	je	.L91
+	.loc 1 753 35 discriminator 1 view .LVU372
+	movq	24(%rbx), %rbp
+.L91:
+.LVL135:
+	.loc 1 754 5 is_stmt 1 view .LVU373
+	movq	%rsp, %r12
+	leaq	16(%rsp), %rdi
+	movl	%ebp, %esi
+	call	put_le32
+.LVL136:
+	.loc 1 755 5 view .LVU374
+	leaq	20(%rsp), %rdi
+	shrq	$32, %rbp
+.LVL137:
+	.loc 1 755 5 is_stmt 0 view .LVU375
+	movq	%rbp, %rsi
+	call	put_le32
+.LVL138:
+	.loc 1 756 5 is_stmt 1 view .LVU376
+	movl	$24, %edx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	score_write
+.LVL139:
+	.loc 1 757 1 is_stmt 0 view .LVU377
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L95
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL140:
+	.loc 1 757 1 view .LVU378
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL141:
+.L95:
+	.cfi_restore_state
+	.loc 1 757 1 view .LVU379
+	call	__stack_chk_fail@PLT
+.LVL142:
+	.cfi_endproc
+.LFE87:
+	.size	score_write_header, .-score_write_header
+	.section	.rodata.str1.1
+.LC7:
+	.string	"mmap"
+.LC8:
+	.string	"stream"
+.LC9:
+	.string	"score: reading %s (%s)"
+	.text
+	.globl	beep_score_fdopen
+	.type	beep_score_fdopen, @function
+beep_score_fdopen:
+.LVL143:
+.LFB70:
+	.loc 1 171 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 171 1 is_stmt 0 view .LVU381
+	endbr64
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 208
+	movl	%edi, %r13d
+	movq	%rsi, %rbp
+	movl	%edx, %r12d
+	movl	%ecx, %r14d
+	.loc 1 171 1 view .LVU382
+	movq	%fs:40, %rax
+	movq	%rax, 152(%rsp)
+	xorl	%eax, %eax
+	.loc 1 172 5 is_stmt 1 view .LVU383
+	.loc 1 172 31 is_stmt 0 view .LVU384
+	movl	$65928, %edi
+.LVL144:
+	.loc 1 172 31 view .LVU385
+	call	malloc@PLT
+.LVL145:
+	.loc 1 172 31 view .LVU386
+	movq	%rax, %rbx
+.LVL146:
+	.loc 1 173 5 is_stmt 1 view .LVU387
+	.loc 1 173 8 is_stmt 0 view .LVU388
+	testq	%rax, %rax
+	je	.L96
+	.loc 1 176 5 is_stmt 1 view .LVU389
+	.loc 1 176 15 is_stmt 0 view .LVU390
+	movl	%r13d, (%rax)
+	.loc 1 177 5 is_stmt 1 view .LVU391
+	.loc 1 177 17 is_stmt 0 view .LVU392
+	movq	%rbp, 8(%rax)
+	.loc 1 178 5 is_stmt 1 view .LVU393
+	.loc 1 178 24 is_stmt 0 view .LVU394
+	movq	$0, 16(%rax)
+	.loc 1 179 5 is_stmt 1 view .LVU395
+	.loc 1 179 27 is_stmt 0 view .LVU396
+	movl	%r12d, 24(%rax)
+	.loc 1 180 5 is_stmt 1 view .LVU397
+	.loc 1 180 26 is_stmt 0 view .LVU398
+	movl	%r14d, 28(%rax)
+	.loc 1 181 5 is_stmt 1 view .LVU399
+	leaq	32(%rax), %rdi
+	movl	$120, %esi
+	call	beep_tempo_init@PLT
+.LVL147:
+	.loc 1 182 5 view .LVU400
+	.loc 1 182 25 is_stmt 0 view .LVU401
+	movb	$0, 48(%rbx)
+	.loc 1 183 5 is_stmt 1 view .LVU402
+	.loc 1 183 19 is_stmt 0 view .LVU403
+	movb	$0, 49(%rbx)
+	.loc 1 184 5 is_stmt 1 view .LVU404
+	.loc 1 184 19 is_stmt 0 view .LVU405
+	movb	$0, 50(%rbx)
+	.loc 1 185 5 is_stmt 1 view .LVU406
+	.loc 1 185 23 is_stmt 0 view .LVU407
+	movq	$0, 56(%rbx)
+	.loc 1 186 5 is_stmt 1 view .LVU408
+	.loc 1 186 26 is_stmt 0 view .LVU409
+	movq	$0, 64(%rbx)
+	.loc 1 187 5 is_stmt 1 view .LVU410
+	.loc 1 187 16 is_stmt 0 view .LVU411
+	movq	$0, 72(%rbx)
+	.loc 1 188 5 is_stmt 1 view .LVU412
+	.loc 1 188 23 is_stmt 0 view .LVU413
+	movq	$0, 80(%rbx)
+	.loc 1 189 5 is_stmt 1 view .LVU414
+	.loc 1 189 21 is_stmt 0 view .LVU415
+	movq	$0, 88(%rbx)
+	.loc 1 190 5 is_stmt 1 view .LVU416
+	.loc 1 190 22 is_stmt 0 view .LVU417
+	movq	$0, 96(%rbx)
+	.loc 1 191 5 is_stmt 1 view .LVU418
+	.loc 1 191 21 is_stmt 0 view .LVU419
+	movq	$0, 104(%rbx)
+	.loc 1 192 5 is_stmt 1 view .LVU420
+	.loc 1 192 22 is_stmt 0 view .LVU421
+	movq	$0, 112(%rbx)
+	.loc 1 193 5 is_stmt 1 view .LVU422
+	.loc 1 193 20 is_stmt 0 view .LVU423
+	movq	$0, 120(%rbx)
+	.loc 1 194 5 is_stmt 1 view .LVU424
+	.loc 1 194 16 is_stmt 0 view .LVU425
+	movb	$0, 128(%rbx)
+	.loc 1 196 5 is_stmt 1 view .LVU426
+	.loc 1 197 5 view .LVU427
+	.loc 1 197 15 is_stmt 0 view .LVU428
+	movq	%rsp, %rsi
+	movl	(%rbx), %edi
+	call	fstat@PLT
+.LVL148:
+	.loc 1 197 8 view .LVU429
+	testl	%eax, %eax
+	jne	.L98
+	.loc 1 197 43 discriminator 1 view .LVU430
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 197 38 discriminator 1 view .LVU431
+	cmpl	$32768, %eax
+	je	.L104
+.L98:
+	.loc 1 208 5 is_stmt 1 view .LVU432
+	.loc 1 208 10 view .LVU433
+	.loc 1 208 13 is_stmt 0 view .LVU434
+	cmpl	$0, log_level(%rip)
+	jle	.L96
+	.loc 1 208 46 is_stmt 1 discriminator 1 view .LVU435
+	cmpq	$0, 72(%rbx)
+	leaq	.LC8(%rip), %rdx
+	leaq	.LC7(%rip), %rax
+	cmovne	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL149:
+.L96:
+	.loc 1 211 1 is_stmt 0 view .LVU436
+	movq	152(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L105
+	movq	%rbx, %rax
+	addq	$160, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL150:
+	.loc 1 211 1 view .LVU437
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL151:
+	.loc 1 211 1 view .LVU438
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL152:
+	.loc 1 211 1 view .LVU439
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL153:
+	.loc 1 211 1 view .LVU440
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL154:
+	.loc 1 211 1 view .LVU441
+	ret
+.LVL155:
+.L104:
+	.cfi_restore_state
+.LBB41:
+	.loc 1 198 9 is_stmt 1 view .LVU442
+	.loc 1 198 29 is_stmt 0 view .LVU443
+	movl	(%rbx), %edi
+	movl	$1, %edx
+	movl	$0, %esi
+	call	lseek@PLT
+.LVL156:
+	.loc 1 199 9 is_stmt 1 view .LVU444
+	.loc 1 199 15 is_stmt 0 view .LVU445
+	movq	48(%rsp), %rdx
+	.loc 1 199 12 view .LVU446
+	testq	%rdx, %rdx
+	jne	.L99
+	.loc 1 200 13 is_stmt 1 view .LVU447
+	.loc 1 200 24 is_stmt 0 view .LVU448
+	movb	$1, 128(%rbx)
+	jmp	.L98
+.L99:
+	.loc 1 201 16 is_stmt 1 discriminator 1 view .LVU449
+	.loc 1 201 34 is_stmt 0 discriminator 1 view .LVU450
+	cmpq	%rax, %rdx
+	jle	.L98
+	cmpq	$-1, %rax
+	je	.L98
+	.loc 1 203 13 is_stmt 1 view .LVU451
+	.loc 1 203 30 is_stmt 0 view .LVU452
+	movq	%rdx, 96(%rbx)
+	.loc 1 204 13 is_stmt 1 view .LVU453
+	.loc 1 204 29 is_stmt 0 view .LVU454
+	movq	%rax, 104(%rbx)
+	.loc 1 205 13 is_stmt 1 view .LVU455
+	movq	%rbx, %rdi
+	call	score_map_window
+.LVL157:
+	.loc 1 205 13 is_stmt 0 view .LVU456
+	jmp	.L98
+.LVL158:
+.L105:
+	.loc 1 205 13 view .LVU457
+.LBE41:
+	.loc 1 211 1 view .LVU458
+	call	__stack_chk_fail@PLT
+.LVL159:
+	.cfi_endproc
+.LFE70:
+	.size	beep_score_fdopen, .-beep_score_fdopen
+	.section	.rodata.str1.1
+.LC10:
+	.string	"-"
+	.text
+	.globl	beep_score_open
+	.type	beep_score_open, @function
+beep_score_open:
+.LVL160:
+.LFB71:
+	.loc 1 217 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 217 1 is_stmt 0 view .LVU460
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	movl	%esi, %ebp
+	movl	%edx, %r13d
+	.loc 1 218 5 is_stmt 1 view .LVU461
+	.loc 1 218 14 is_stmt 0 view .LVU462
+	leaq	.LC10(%rip), %rsi
+.LVL161:
+	.loc 1 218 14 view .LVU463
+	call	strcmp@PLT
+.LVL162:
+	.loc 1 218 8 view .LVU464
+	testl	%eax, %eax
+	je	.L111
+	.loc 1 222 5 is_stmt 1 view .LVU465
+.LVL163:
+.LBB42:
+.LBI42:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 4 41 1 view .LVU466
+.LBB43:
+	.loc 4 43 3 view .LVU467
+	.loc 4 46 3 view .LVU468
+	.loc 4 48 7 view .LVU469
+	.loc 4 53 7 view .LVU470
+	.loc 4 53 14 is_stmt 0 view .LVU471
+	movl	$524288, %esi
+	movq	%rbx, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL164:
+	movl	%eax, %r12d
+.LVL165:
+	.loc 4 53 14 view .LVU472
+.LBE43:
+.LBE42:
+	.loc 1 223 5 is_stmt 1 view .LVU473
+	.loc 1 223 8 is_stmt 0 view .LVU474
+	cmpl	$-1, %eax
+	je	.L109
+	.loc 1 226 5 is_stmt 1 view .LVU475
+	.loc 1 226 31 is_stmt 0 view .LVU476
+	movl	%r13d, %ecx
+	movl	%ebp, %edx
+	movq	%rbx, %rsi
+	movl	%eax, %edi
+	call	beep_score_fdopen
+.LVL166:
+	.loc 1 226 31 view .LVU477
+	movq	%rax, %rbx
+.LVL167:
+	.loc 1 228 5 is_stmt 1 view .LVU478
+	.loc 1 228 8 is_stmt 0 view .LVU479
+	testq	%rax, %rax
+	je	.L112
+.LVL168:
+.L106:
+	.loc 1 234 1 view .LVU480
+	movq	%rbx, %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL169:
+.L111:
+	.cfi_restore_state
+	.loc 1 219 9 is_stmt 1 view .LVU481
+	.loc 1 219 16 is_stmt 0 view .LVU482
+	movl	%r13d, %ecx
+	movl	%ebp, %edx
+	movq	%rbx, %rsi
+	movl	$0, %edi
+	call	beep_score_fdopen
+.LVL170:
+	movq	%rax, %rbx
+.LVL171:
+	.loc 1 219 16 view .LVU483
+	jmp	.L106
+.LVL172:
+.L112:
+.LBB44:
+	.loc 1 229 9 is_stmt 1 view .LVU484
+	.loc 1 229 34 is_stmt 0 view .LVU485
+	call	__errno_location@PLT
+.LVL173:
+	.loc 1 229 34 view .LVU486
+	movq	%rax, %rbp
+.LVL174:
+	.loc 1 229 19 view .LVU487
+	movl	(%rax), %r13d
+.LVL175:
+	.loc 1 230 9 is_stmt 1 view .LVU488
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL176:
+	.loc 1 231 8 view .LVU489
+	.loc 1 231 14 is_stmt 0 view .LVU490
+	movl	%r13d, 0(%rbp)
+	jmp	.L106
+.LVL177:
+.L109:
+	.loc 1 231 14 view .LVU491
+.LBE44:
+	.loc 1 224 15 view .LVU492
+	movl	$0, %ebx
+.LVL178:
+	.loc 1 224 15 view .LVU493
+	jmp	.L106
+	.cfi_endproc
+.LFE71:
+	.size	beep_score_open, .-beep_score_open
+	.globl	beep_score_set_bpm
+	.type	beep_score_set_bpm, @function
+beep_score_set_bpm:
+.LVL179:
+.LFB72:
+	.loc 1 238 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 238 1 is_stmt 0 view .LVU495
+	endbr64
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 239 5 is_stmt 1 view .LVU496
+	addq	$32, %rdi
+.LVL180:
+	.loc 1 239 5 is_stmt 0 view .LVU497
+	call	beep_tempo_init@PLT
+.LVL181:
+	.loc 1 240 1 view .LVU498
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE72:
+	.size	beep_score_set_bpm, .-beep_score_set_bpm
+	.section	.rodata.str1.1
+.LC11:
+	.string	"%s: truncated binary score"
+.LC12:
+	.string	"%s:%lu: line too long"
+	.section	.rodata.str1.8
+	.align 8
+.LC13:
+	.string	"%s:%lu: invalid tone, expected FREQ_Hz [LENGTH_ms [DELAY_ms]]"
+	.text
+	.globl	beep_score_next
+	.type	beep_score_next, @function
+beep_score_next:
+.LVL182:
+.LFB84:
+	.loc 1 693 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 693 1 is_stmt 0 view .LVU500
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%rdi, %rbx
+	movq	%rsi, %r12
+	.loc 1 694 5 is_stmt 1 view .LVU501
+	.loc 1 694 15 is_stmt 0 view .LVU502
+	movzbl	48(%rdi), %ebp
+	.loc 1 694 8 view .LVU503
+	testb	%bpl, %bpl
+	je	.L186
+.LVL183:
+.L116:
+	.loc 1 698 5 is_stmt 1 view .LVU504
+	.loc 1 698 8 is_stmt 0 view .LVU505
+	cmpb	$0, 50(%rbx)
+	je	.L187
+	.loc 1 702 5 is_stmt 1 view .LVU506
+	.loc 1 702 8 is_stmt 0 view .LVU507
+	cmpb	$0, 49(%rbx)
+	jne	.L170
+	.loc 1 705 5 is_stmt 1 view .LVU508
+.LVL184:
+.LBB70:
+.LBI70:
+	.loc 1 622 9 view .LVU509
+.LBB71:
+	.loc 1 624 5 view .LVU510
+	.loc 1 624 14 is_stmt 0 view .LVU511
+	movq	56(%rbx), %rdx
+	.loc 1 625 16 view .LVU512
+	movl	$0, %eax
+	.loc 1 624 8 view .LVU513
+	testq	%rdx, %rdx
+	je	.L145
+	.loc 1 628 5 is_stmt 1 view .LVU514
+.LVL185:
+	.loc 1 629 5 view .LVU515
+	.loc 1 629 14 is_stmt 0 view .LVU516
+	movq	72(%rbx), %rsi
+	.loc 1 629 8 view .LVU517
+	testq	%rsi, %rsi
+	je	.L172
+.LBB72:
+	.loc 1 630 9 is_stmt 1 view .LVU518
+	.loc 1 630 36 is_stmt 0 view .LVU519
+	addq	104(%rbx), %rsi
+.LVL186:
+	.loc 1 633 9 is_stmt 1 view .LVU520
+	.loc 1 633 20 is_stmt 0 view .LVU521
+	movq	%rsi, %r13
+	.loc 1 633 12 view .LVU522
+	testb	$3, %sil
+	je	.L147
+	leaq	65668(%rbx), %r14
+.LBE72:
+	.loc 1 628 12 view .LVU523
+	movl	$0, %ebp
+.LVL187:
+.L148:
+.LBB73:
+	.loc 1 646 16 view .LVU524
+	cmpq	56(%rbx), %rbp
+	jnb	.L149
+	.loc 1 647 13 is_stmt 1 view .LVU525
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	score_decode_record
+.LVL188:
+	.loc 1 649 13 view .LVU526
+	addq	$1, %rbp
+.LVL189:
+	.loc 1 646 16 view .LVU527
+	addq	$16, %r13
+	addq	$16, %r14
+	cmpq	$16, %rbp
+	jne	.L148
+.L149:
+	.loc 1 651 9 view .LVU528
+	.loc 1 651 47 is_stmt 0 view .LVU529
+	movq	%rbp, %rax
+	salq	$4, %rax
+	.loc 1 651 25 view .LVU530
+	addq	%rax, 104(%rbx)
+.LVL190:
+.L151:
+	.loc 1 651 25 view .LVU531
+.LBE73:
+	.loc 1 681 5 is_stmt 1 view .LVU532
+	.loc 1 681 41 is_stmt 0 view .LVU533
+	leaq	65668(%rbx), %r13
+	.loc 1 681 10 view .LVU534
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	score_check_binary
+.LVL191:
+	.loc 1 681 8 view .LVU535
+	testb	%al, %al
+	je	.L175
+	.loc 1 684 5 is_stmt 1 view .LVU536
+	.loc 1 684 14 is_stmt 0 view .LVU537
+	movq	56(%rbx), %rax
+	.loc 1 684 8 view .LVU538
+	cmpq	$-1, %rax
+	je	.L156
+	.loc 1 685 9 is_stmt 1 view .LVU539
+	.loc 1 685 27 is_stmt 0 view .LVU540
+	subq	%rbp, %rax
+	movq	%rax, 56(%rbx)
+.L156:
+	.loc 1 687 5 is_stmt 1 view .LVU541
+	.loc 1 687 12 is_stmt 0 view .LVU542
+	movq	%r13, (%r12)
+	.loc 1 688 5 is_stmt 1 view .LVU543
+	.loc 1 688 12 is_stmt 0 view .LVU544
+	movq	%rbp, %rax
+.LVL192:
+.L145:
+	.loc 1 688 12 view .LVU545
+.LBE71:
+.LBE70:
+	.loc 1 706 5 is_stmt 1 view .LVU546
+	.loc 1 706 33 is_stmt 0 view .LVU547
+	movq	%rax, %rdx
+	shrq	$63, %rdx
+	.loc 1 706 19 view .LVU548
+	movb	%dl, 49(%rbx)
+	.loc 1 707 5 is_stmt 1 view .LVU549
+.LVL193:
+.L115:
+	.loc 1 708 1 is_stmt 0 view .LVU550
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL194:
+	.loc 1 708 1 view .LVU551
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL195:
+.L186:
+	.cfi_restore_state
+	.loc 1 695 9 is_stmt 1 view .LVU552
+	.loc 1 695 29 is_stmt 0 view .LVU553
+	movb	$1, 48(%rdi)
+	.loc 1 696 9 is_stmt 1 view .LVU554
+.LVL196:
+.LBB80:
+.LBI80:
+	.loc 1 361 5 view .LVU555
+.LBB81:
+	.loc 1 363 5 view .LVU556
+	.loc 1 363 14 is_stmt 0 view .LVU557
+	movq	72(%rdi), %r13
+	.loc 1 363 8 view .LVU558
+	testq	%r13, %r13
+	je	.L188
+.LBB82:
+	.loc 1 364 9 is_stmt 1 view .LVU559
+	.loc 1 364 60 is_stmt 0 view .LVU560
+	movq	104(%rdi), %rax
+	subq	80(%rdi), %rax
+.LVL197:
+	.loc 1 365 9 is_stmt 1 view .LVU561
+	.loc 1 365 39 is_stmt 0 view .LVU562
+	movq	88(%rdi), %r14
+.LVL198:
+	.loc 1 366 9 is_stmt 1 view .LVU563
+	.loc 1 365 22 is_stmt 0 view .LVU564
+	movq	%r14, %rdx
+	subq	%rax, %rdx
+.LVL199:
+	.loc 1 366 12 view .LVU565
+	cmpq	$7, %rdx
+	jbe	.L161
+.LVL200:
+.LBB83:
+.LBI83:
+	.loc 1 350 5 is_stmt 1 view .LVU566
+.LBB84:
+	.loc 1 352 5 view .LVU567
+	.loc 1 353 5 view .LVU568
+.LBE84:
+.LBE83:
+	.loc 1 367 16 is_stmt 0 view .LVU569
+	leaq	0(%r13,%rax), %rdi
+.LVL201:
+.LBB86:
+.LBB85:
+	.loc 1 353 18 view .LVU570
+	movl	$8, %edx
+.LVL202:
+	.loc 1 353 18 view .LVU571
+	leaq	.LC1(%rip), %rsi
+.LVL203:
+	.loc 1 353 18 view .LVU572
+	call	memcmp@PLT
+.LVL204:
+	.loc 1 353 18 view .LVU573
+.LBE85:
+.LBE86:
+	.loc 1 367 13 view .LVU574
+	testl	%eax, %eax
+	je	.L189
+	.loc 1 371 15 view .LVU575
+	movl	$1, %ebp
+.LVL205:
+.L118:
+	.loc 1 371 15 view .LVU576
+.LBE82:
+.LBE81:
+.LBE80:
+	.loc 1 696 9 view .LVU577
+	xorl	$1, %ebp
+	movb	%bpl, 49(%rbx)
+	jmp	.L116
+.LVL206:
+.L188:
+.LBB106:
+.LBB105:
+.LBB91:
+.LBB92:
+	.loc 1 353 18 view .LVU578
+	leaq	.LC1(%rip), %r13
+.LVL207:
+.L117:
+	.loc 1 353 18 view .LVU579
+.LBE92:
+.LBE91:
+	.loc 1 379 12 is_stmt 1 view .LVU580
+	.loc 1 378 36 is_stmt 0 view .LVU581
+	movq	112(%rbx), %rax
+	.loc 1 378 29 view .LVU582
+	movq	120(%rbx), %rdx
+	subq	%rax, %rdx
+	.loc 1 379 12 view .LVU583
+	cmpq	$7, %rdx
+	ja	.L122
+.LVL208:
+.LBB95:
+.LBI91:
+	.loc 1 350 5 is_stmt 1 view .LVU584
+.LBB93:
+	.loc 1 352 5 view .LVU585
+	.loc 1 353 5 view .LVU586
+	.loc 1 352 18 is_stmt 0 view .LVU587
+	movl	$8, %ecx
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+.LVL209:
+	.loc 1 352 18 view .LVU588
+.LBE93:
+.LBE95:
+	.loc 1 379 34 view .LVU589
+	leaq	129(%rbx,%rax), %rdi
+.LVL210:
+.LBB96:
+.LBB94:
+	.loc 1 353 18 view .LVU590
+	movq	%r13, %rsi
+	call	memcmp@PLT
+.LVL211:
+	.loc 1 353 18 view .LVU591
+.LBE94:
+.LBE96:
+	.loc 1 379 12 view .LVU592
+	testl	%eax, %eax
+	jne	.L190
+.LBB97:
+	.loc 1 381 9 is_stmt 1 view .LVU593
+	.loc 1 381 28 is_stmt 0 view .LVU594
+	movq	%rbx, %rdi
+	call	score_read_more
+.LVL212:
+	.loc 1 382 9 is_stmt 1 view .LVU595
+	.loc 1 382 12 is_stmt 0 view .LVU596
+	testl	%eax, %eax
+	js	.L118
+	.loc 1 384 16 is_stmt 1 view .LVU597
+	.loc 1 384 19 is_stmt 0 view .LVU598
+	jne	.L117
+	.loc 1 385 19 view .LVU599
+	movl	$1, %ebp
+	jmp	.L118
+.LVL213:
+.L189:
+	.loc 1 385 19 view .LVU600
+.LBE97:
+.LBB98:
+	.loc 1 368 13 is_stmt 1 view .LVU601
+	.loc 1 368 27 is_stmt 0 view .LVU602
+	movb	$1, 50(%rbx)
+	.loc 1 369 13 is_stmt 1 view .LVU603
+.LVL214:
+.LBB87:
+.LBI87:
+	.loc 1 304 5 view .LVU604
+.LBB88:
+	.loc 1 306 5 view .LVU605
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	munmap@PLT
+.LVL215:
+	.loc 1 307 5 view .LVU606
+	.loc 1 307 16 is_stmt 0 view .LVU607
+	movq	$0, 72(%rbx)
+	.loc 1 309 5 is_stmt 1 view .LVU608
+	.loc 1 309 29 is_stmt 0 view .LVU609
+	movq	96(%rbx), %rsi
+.LVL216:
+	.loc 1 310 5 is_stmt 1 view .LVU610
+	.loc 1 309 17 is_stmt 0 view .LVU611
+	movq	%rsi, %rax
+	subq	104(%rbx), %rax
+.LVL217:
+	.loc 1 310 8 view .LVU612
+	cmpq	$23, %rax
+	jle	.L191
+	.loc 1 314 5 is_stmt 1 view .LVU613
+	.loc 1 314 23 is_stmt 0 view .LVU614
+	movl	$0, %r9d
+	movl	(%rbx), %r8d
+	movl	$1, %ecx
+	movl	$1, %edx
+	movl	$0, %edi
+	call	mmap@PLT
+.LVL218:
+	.loc 1 314 23 view .LVU615
+	movq	%rax, %r13
+.LVL219:
+	.loc 1 316 5 is_stmt 1 view .LVU616
+	.loc 1 316 8 is_stmt 0 view .LVU617
+	cmpq	$-1, %rax
+	je	.L192
+	.loc 1 320 5 is_stmt 1 view .LVU618
+	movq	96(%rbx), %rsi
+	movl	$2, %edx
+	movq	%rax, %rdi
+	call	madvise@PLT
+.LVL220:
+	.loc 1 321 5 view .LVU619
+	.loc 1 321 16 is_stmt 0 view .LVU620
+	movq	%r13, 72(%rbx)
+	.loc 1 322 5 is_stmt 1 view .LVU621
+	.loc 1 322 23 is_stmt 0 view .LVU622
+	movq	$0, 80(%rbx)
+	.loc 1 323 5 is_stmt 1 view .LVU623
+	.loc 1 323 21 is_stmt 0 view .LVU624
+	movq	96(%rbx), %rax
+	movq	%rax, 88(%rbx)
+	.loc 1 325 5 is_stmt 1 view .LVU625
+	.loc 1 326 29 is_stmt 0 view .LVU626
+	movq	%r13, %rsi
+	addq	104(%rbx), %rsi
+	.loc 1 325 10 view .LVU627
+	movq	%rbx, %rdi
+	call	score_parse_header
+.LVL221:
+	.loc 1 325 8 view .LVU628
+	testb	%al, %al
+	je	.L163
+	.loc 1 329 5 is_stmt 1 view .LVU629
+	.loc 1 329 21 is_stmt 0 view .LVU630
+	movq	104(%rbx), %rcx
+	addq	$24, %rcx
+	movq	%rcx, 104(%rbx)
+	.loc 1 330 5 is_stmt 1 view .LVU631
+	.loc 1 330 55 is_stmt 0 view .LVU632
+	movq	96(%rbx), %rdx
+	subq	%rcx, %rdx
+.LVL222:
+	.loc 1 331 5 is_stmt 1 view .LVU633
+	.loc 1 331 20 is_stmt 0 view .LVU634
+	movq	%rdx, %rsi
+	shrq	$4, %rsi
+.LVL223:
+	.loc 1 332 5 is_stmt 1 view .LVU635
+	.loc 1 332 14 is_stmt 0 view .LVU636
+	movq	56(%rbx), %rcx
+	.loc 1 332 8 view .LVU637
+	cmpq	$-1, %rcx
+	je	.L193
+	.loc 1 338 12 is_stmt 1 view .LVU638
+	.loc 1 338 15 is_stmt 0 view .LVU639
+	cmpq	%rcx, %rsi
+	jb	.L194
+	.loc 1 342 11 view .LVU640
+	movl	%eax, %ebp
+	jmp	.L118
+.LVL224:
+.L191:
+	.loc 1 311 9 is_stmt 1 view .LVU641
+	movq	8(%rbx), %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+.LVL225:
+	.loc 1 311 9 is_stmt 0 view .LVU642
+	call	log_error@PLT
+.LVL226:
+	.loc 1 312 9 is_stmt 1 view .LVU643
+	.loc 1 312 15 is_stmt 0 view .LVU644
+	jmp	.L118
+.LVL227:
+.L192:
+	.loc 1 317 9 is_stmt 1 view .LVU645
+	.loc 1 317 52 is_stmt 0 view .LVU646
+	call	__errno_location@PLT
+.LVL228:
+	.loc 1 317 9 view .LVU647
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL229:
+	movq	%rax, %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL230:
+	.loc 1 318 9 is_stmt 1 view .LVU648
+	.loc 1 318 15 is_stmt 0 view .LVU649
+	jmp	.L118
+.LVL231:
+.L193:
+	.loc 1 333 9 is_stmt 1 view .LVU650
+	.loc 1 333 27 is_stmt 0 view .LVU651
+	movq	%rsi, 56(%rbx)
+	.loc 1 334 9 is_stmt 1 view .LVU652
+	.loc 1 334 12 is_stmt 0 view .LVU653
+	testb	$15, %dl
+	jne	.L195
+	.loc 1 342 11 view .LVU654
+	movl	%eax, %ebp
+	jmp	.L118
+.L195:
+	.loc 1 335 13 is_stmt 1 view .LVU655
+	movq	8(%rbx), %rsi
+.LVL232:
+	.loc 1 335 13 is_stmt 0 view .LVU656
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL233:
+	.loc 1 336 13 is_stmt 1 view .LVU657
+	.loc 1 336 19 is_stmt 0 view .LVU658
+	jmp	.L118
+.LVL234:
+.L194:
+	.loc 1 339 9 is_stmt 1 view .LVU659
+	movq	8(%rbx), %rsi
+.LVL235:
+	.loc 1 339 9 is_stmt 0 view .LVU660
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL236:
+	.loc 1 340 9 is_stmt 1 view .LVU661
+	.loc 1 340 15 is_stmt 0 view .LVU662
+	jmp	.L118
+.LVL237:
+.L190:
+	.loc 1 340 15 view .LVU663
+.LBE88:
+.LBE87:
+.LBE98:
+	.loc 1 390 15 view .LVU664
+	movl	$1, %ebp
+	jmp	.L118
+.L122:
+	.loc 1 388 5 is_stmt 1 view .LVU665
+.LVL238:
+.LBB99:
+.LBI99:
+	.loc 1 350 5 view .LVU666
+.LBB100:
+	.loc 1 352 5 view .LVU667
+	.loc 1 353 5 view .LVU668
+	.loc 1 352 18 is_stmt 0 view .LVU669
+	movl	$8, %ecx
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+.LVL239:
+	.loc 1 352 18 view .LVU670
+.LBE100:
+.LBE99:
+	.loc 1 388 29 view .LVU671
+	leaq	129(%rbx,%rax), %rdi
+.LVL240:
+.LBB102:
+.LBB101:
+	.loc 1 353 18 view .LVU672
+	leaq	.LC1(%rip), %rsi
+	call	memcmp@PLT
+.LVL241:
+	.loc 1 353 18 view .LVU673
+.LBE101:
+.LBE102:
+	.loc 1 388 8 view .LVU674
+	testl	%eax, %eax
+	jne	.L167
+	.loc 1 392 5 is_stmt 1 view .LVU675
+	.loc 1 392 19 is_stmt 0 view .LVU676
+	movb	$1, 50(%rbx)
+	.loc 1 393 5 is_stmt 1 view .LVU677
+.L124:
+	.loc 1 393 48 view .LVU678
+	.loc 1 393 35 is_stmt 0 view .LVU679
+	movq	112(%rbx), %rdx
+	.loc 1 393 28 view .LVU680
+	movq	120(%rbx), %rax
+	subq	%rdx, %rax
+	.loc 1 393 48 view .LVU681
+	cmpq	$23, %rax
+	ja	.L196
+.LBB103:
+	.loc 1 394 9 is_stmt 1 view .LVU682
+	.loc 1 394 28 is_stmt 0 view .LVU683
+	movq	%rbx, %rdi
+	call	score_read_more
+.LVL242:
+	.loc 1 395 9 is_stmt 1 view .LVU684
+	.loc 1 395 12 is_stmt 0 view .LVU685
+	testl	%eax, %eax
+	js	.L118
+	.loc 1 397 16 is_stmt 1 view .LVU686
+	.loc 1 397 19 is_stmt 0 view .LVU687
+	jne	.L124
+	.loc 1 398 13 is_stmt 1 view .LVU688
+	movq	8(%rbx), %rsi
+	leaq	.LC11(%rip), %rdi
+	call	log_error@PLT
+.LVL243:
+	.loc 1 399 13 view .LVU689
+	.loc 1 399 19 is_stmt 0 view .LVU690
+	jmp	.L118
+.LVL244:
+.L196:
+	.loc 1 399 19 view .LVU691
+.LBE103:
+	.loc 1 402 5 is_stmt 1 view .LVU692
+	.loc 1 403 29 is_stmt 0 view .LVU693
+	leaq	129(%rbx,%rdx), %rsi
+	.loc 1 402 10 view .LVU694
+	movq	%rbx, %rdi
+	call	score_parse_header
+.LVL245:
+	movl	%eax, %ebp
+	.loc 1 402 8 view .LVU695
+	testb	%al, %al
+	je	.L118
+	.loc 1 406 5 is_stmt 1 view .LVU696
+	.loc 1 406 22 is_stmt 0 view .LVU697
+	addq	$24, 112(%rbx)
+	.loc 1 407 5 is_stmt 1 view .LVU698
+	.loc 1 407 11 is_stmt 0 view .LVU699
+	jmp	.L118
+.LVL246:
+.L161:
+.LBB104:
+	.loc 1 371 15 view .LVU700
+	movl	$1, %ebp
+	jmp	.L118
+.LVL247:
+.L163:
+.LBB90:
+.LBB89:
+	.loc 1 327 15 view .LVU701
+	movl	%eax, %ebp
+	jmp	.L118
+.LVL248:
+.L167:
+	.loc 1 327 15 view .LVU702
+.LBE89:
+.LBE90:
+.LBE104:
+	.loc 1 390 15 view .LVU703
+	movl	$1, %ebp
+	jmp	.L118
+.LVL249:
+.L187:
+	.loc 1 390 15 view .LVU704
+.LBE105:
+.LBE106:
+	.loc 1 699 9 is_stmt 1 view .LVU705
+	.loc 1 699 18 is_stmt 0 view .LVU706
+	leaq	65668(%rbx), %rax
+	movq	%rax, (%r12)
+	.loc 1 700 9 is_stmt 1 view .LVU707
+.LVL250:
+.LBB107:
+.LBI107:
+	.loc 1 549 9 view .LVU708
+.LBB108:
+	.loc 1 551 5 view .LVU709
+	.loc 1 552 5 view .LVU710
+	.loc 1 552 29 view .LVU711
+	cmpb	$0, 49(%rbx)
+	jne	.L168
+	.loc 1 551 12 is_stmt 0 view .LVU712
+	movq	$0, 24(%rsp)
+	jmp	.L136
+.LVL251:
+.L177:
+.LBB109:
+.LBB110:
+.LBB111:
+.LBB112:
+	.loc 1 430 13 is_stmt 1 view .LVU713
+	.loc 1 431 13 view .LVU714
+	.loc 1 431 50 is_stmt 0 view .LVU715
+	movq	%rax, %rcx
+	movq	16(%rsp), %rsi
+	subq	%rsi, %rcx
+	testq	%rax, %rax
+	cmove	8(%rsp), %rcx
+	movq	%rcx, 8(%rsp)
+.LVL252:
+	.loc 1 432 13 is_stmt 1 view .LVU716
+	.loc 1 432 63 is_stmt 0 view .LVU717
+	movzbl	%dl, %eax
+.LVL253:
+	.loc 1 432 48 view .LVU718
+	addq	%rcx, %rax
+	.loc 1 432 29 view .LVU719
+	addq	%r13, %rax
+	movq	%rax, 104(%rbx)
+	.loc 1 433 13 is_stmt 1 view .LVU720
+.LVL254:
+.L133:
+	.loc 1 433 13 is_stmt 0 view .LVU721
+.LBE112:
+.LBE111:
+.LBE110:
+	.loc 1 557 9 is_stmt 1 view .LVU722
+	.loc 1 559 16 view .LVU723
+.LBB117:
+	.loc 1 562 13 view .LVU724
+	addq	$1, 16(%rbx)
+	.loc 1 563 13 view .LVU725
+	.loc 1 563 32 is_stmt 0 view .LVU726
+	movq	24(%rsp), %rax
+	salq	$4, %rax
+	leaq	65668(%rbx,%rax), %rcx
+	movq	8(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	score_parse_line
+.LVL255:
+	.loc 1 565 13 is_stmt 1 view .LVU727
+	.loc 1 565 16 is_stmt 0 view .LVU728
+	testl	%eax, %eax
+	js	.L197
+	.loc 1 571 17 is_stmt 1 view .LVU729
+	.loc 1 571 31 is_stmt 0 view .LVU730
+	cltq
+	.loc 1 571 28 view .LVU731
+	addq	%rax, 24(%rsp)
+	movq	24(%rsp), %rax
+.LVL256:
+	.loc 1 571 28 view .LVU732
+.LBE117:
+.LBE109:
+	.loc 1 552 29 is_stmt 1 view .LVU733
+	cmpb	$1, 49(%rbx)
+	je	.L157
+	cmpq	$15, %rax
+	ja	.L157
+.LVL257:
+.L136:
+.LBB121:
+.LBB118:
+.LBB115:
+	.loc 1 419 12 view .LVU734
+	.loc 1 419 17 is_stmt 0 view .LVU735
+	movq	72(%rbx), %rax
+	.loc 1 419 12 view .LVU736
+	testq	%rax, %rax
+	je	.L142
+.LBB113:
+	.loc 1 420 9 is_stmt 1 view .LVU737
+	.loc 1 420 18 is_stmt 0 view .LVU738
+	movq	104(%rbx), %r13
+	.loc 1 420 37 view .LVU739
+	movq	96(%rbx), %r14
+	.loc 1 420 12 view .LVU740
+	cmpq	%r14, %r13
+	je	.L157
+	.loc 1 423 9 is_stmt 1 view .LVU741
+	.loc 1 423 67 is_stmt 0 view .LVU742
+	movq	80(%rbx), %r15
+	.loc 1 423 60 view .LVU743
+	movq	%r13, %r12
+	subq	%r15, %r12
+.LVL258:
+	.loc 1 424 9 is_stmt 1 view .LVU744
+	.loc 1 424 27 is_stmt 0 view .LVU745
+	leaq	(%rax,%r12), %rdi
+	movq	%rdi, 16(%rsp)
+.LVL259:
+	.loc 1 425 9 is_stmt 1 view .LVU746
+	.loc 1 425 39 is_stmt 0 view .LVU747
+	movq	88(%rbx), %rbp
+	.loc 1 425 22 view .LVU748
+	movq	%rbp, %rax
+	subq	%r12, %rax
+	movq	%rax, 8(%rsp)
+.LVL260:
+	.loc 1 426 9 is_stmt 1 view .LVU749
+	.loc 1 426 37 is_stmt 0 view .LVU750
+	movq	%rax, %rdx
+	movl	$10, %esi
+	call	memchr@PLT
+.LVL261:
+	.loc 1 427 9 is_stmt 1 view .LVU751
+	.loc 1 429 9 view .LVU752
+	.loc 1 429 13 is_stmt 0 view .LVU753
+	testq	%rax, %rax
+	setne	%dl
+	.loc 1 428 33 view .LVU754
+	addq	%r15, %rbp
+.LVL262:
+	.loc 1 429 12 view .LVU755
+	cmpq	%r14, %rbp
+	je	.L177
+	testb	%dl, %dl
+	jne	.L177
+	.loc 1 435 9 is_stmt 1 view .LVU756
+	.loc 1 435 34 is_stmt 0 view .LVU757
+	movl	$30, %edi
+	call	sysconf@PLT
+.LVL263:
+	.loc 1 435 12 view .LVU758
+	cmpq	%rax, %r12
+	jb	.L198
+	.loc 1 440 9 is_stmt 1 view .LVU759
+	.loc 1 440 14 is_stmt 0 view .LVU760
+	movq	%rbx, %rdi
+	call	score_map_window
+.LVL264:
+	.loc 1 440 12 view .LVU761
+	testb	%al, %al
+	jne	.L136
+	.loc 1 441 13 is_stmt 1 view .LVU762
+	.loc 1 441 56 is_stmt 0 view .LVU763
+	call	__errno_location@PLT
+.LVL265:
+	.loc 1 441 13 view .LVU764
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL266:
+	movq	%rax, %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC6(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL267:
+	.loc 1 442 13 is_stmt 1 view .LVU765
+	.loc 1 442 20 is_stmt 0 view .LVU766
+	jmp	.L143
+.L198:
+	.loc 1 436 13 is_stmt 1 view .LVU767
+	movq	16(%rbx), %rax
+	leaq	1(%rax), %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL268:
+	.loc 1 438 13 view .LVU768
+.L143:
+	.loc 1 438 13 is_stmt 0 view .LVU769
+.LBE113:
+.LBE115:
+.LBE118:
+	.loc 1 558 27 view .LVU770
+	movb	$1, 49(%rbx)
+.LVL269:
+	.loc 1 558 27 view .LVU771
+.LBE121:
+	.loc 1 552 29 is_stmt 1 view .LVU772
+	.loc 1 575 5 view .LVU773
+	.loc 1 575 8 is_stmt 0 view .LVU774
+	cmpq	$0, 24(%rsp)
+	je	.L199
+.LVL270:
+.L140:
+	.loc 1 578 5 is_stmt 1 view .LVU775
+	.loc 1 578 12 is_stmt 0 view .LVU776
+	movq	24(%rsp), %rax
+	jmp	.L115
+.L142:
+.LBB122:
+.LBB119:
+.LBB116:
+	.loc 1 446 5 is_stmt 1 view .LVU777
+.LBB114:
+	.loc 1 447 9 view .LVU778
+	.loc 1 447 52 is_stmt 0 view .LVU779
+	movq	112(%rbx), %rbp
+	.loc 1 447 27 view .LVU780
+	leaq	129(%rbx,%rbp), %rdi
+	movq	%rdi, 16(%rsp)
+.LVL271:
+	.loc 1 448 9 is_stmt 1 view .LVU781
+	.loc 1 448 39 is_stmt 0 view .LVU782
+	movq	120(%rbx), %r12
+	.loc 1 448 22 view .LVU783
+	movq	%r12, %rax
+	subq	%rbp, %rax
+	movq	%rax, 8(%rsp)
+.LVL272:
+	.loc 1 449 9 is_stmt 1 view .LVU784
+	.loc 1 449 37 is_stmt 0 view .LVU785
+	movq	%rax, %rdx
+	movl	$10, %esi
+	call	memchr@PLT
+.LVL273:
+	.loc 1 450 9 is_stmt 1 view .LVU786
+	.loc 1 450 12 is_stmt 0 view .LVU787
+	testq	%rax, %rax
+	jne	.L200
+	.loc 1 456 9 is_stmt 1 view .LVU788
+	.loc 1 456 12 is_stmt 0 view .LVU789
+	cmpb	$0, 128(%rbx)
+	jne	.L201
+	.loc 1 465 9 is_stmt 1 view .LVU790
+	.loc 1 465 12 is_stmt 0 view .LVU791
+	cmpq	$0, 24(%rsp)
+	jne	.L140
+	.loc 1 468 9 is_stmt 1 view .LVU792
+	.loc 1 468 12 is_stmt 0 view .LVU793
+	cmpq	$65536, 8(%rsp)
+	je	.L202
+	.loc 1 473 9 is_stmt 1 view .LVU794
+	.loc 1 473 13 is_stmt 0 view .LVU795
+	movq	%rbx, %rdi
+	call	score_read_more
+.LVL274:
+	.loc 1 473 12 view .LVU796
+	testl	%eax, %eax
+	jns	.L142
+	jmp	.L143
+.LVL275:
+.L200:
+	.loc 1 451 13 is_stmt 1 view .LVU797
+	.loc 1 452 13 view .LVU798
+	.loc 1 452 40 is_stmt 0 view .LVU799
+	movq	16(%rsp), %rcx
+	subq	%rcx, %rax
+.LVL276:
+	.loc 1 452 40 view .LVU800
+	movq	%rax, 8(%rsp)
+.LVL277:
+	.loc 1 453 13 is_stmt 1 view .LVU801
+	.loc 1 453 30 is_stmt 0 view .LVU802
+	leaq	1(%rax,%rbp), %rax
+.LVL278:
+	.loc 1 453 30 view .LVU803
+	movq	%rax, 112(%rbx)
+	.loc 1 454 13 is_stmt 1 view .LVU804
+	.loc 1 454 20 is_stmt 0 view .LVU805
+	jmp	.L133
+.LVL279:
+.L201:
+	.loc 1 457 13 is_stmt 1 view .LVU806
+	.loc 1 457 16 is_stmt 0 view .LVU807
+	cmpq	$0, 8(%rsp)
+	je	.L157
+	.loc 1 460 13 is_stmt 1 view .LVU808
+.LVL280:
+	.loc 1 461 13 view .LVU809
+	.loc 1 462 13 view .LVU810
+	.loc 1 462 30 is_stmt 0 view .LVU811
+	movq	%r12, 112(%rbx)
+	.loc 1 463 13 is_stmt 1 view .LVU812
+	.loc 1 463 20 is_stmt 0 view .LVU813
+	jmp	.L133
+.LVL281:
+.L202:
+	.loc 1 469 13 is_stmt 1 view .LVU814
+	movq	16(%rbx), %rax
+.LVL282:
+	.loc 1 469 13 is_stmt 0 view .LVU815
+	leaq	1(%rax), %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC12(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL283:
+	.loc 1 471 13 is_stmt 1 view .LVU816
+	.loc 1 471 20 is_stmt 0 view .LVU817
+	jmp	.L143
+.LVL284:
+.L197:
+	.loc 1 471 20 view .LVU818
+.LBE114:
+.LBE116:
+.LBE119:
+.LBB120:
+	.loc 1 566 17 is_stmt 1 view .LVU819
+	movq	16(%rbx), %rdx
+	movq	8(%rbx), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$0, %eax
+.LVL285:
+	.loc 1 566 17 is_stmt 0 view .LVU820
+	call	log_error@PLT
+.LVL286:
+	.loc 1 569 17 is_stmt 1 view .LVU821
+	jmp	.L143
+.LVL287:
+.L157:
+	.loc 1 569 17 is_stmt 0 view .LVU822
+.LBE120:
+.LBE122:
+	.loc 1 575 5 is_stmt 1 view .LVU823
+	.loc 1 575 8 is_stmt 0 view .LVU824
+	cmpq	$0, 24(%rsp)
+	jne	.L140
+	.loc 1 575 27 view .LVU825
+	cmpb	$0, 49(%rbx)
+	je	.L140
+	.loc 1 576 16 view .LVU826
+	movq	$-1, %rax
+	jmp	.L115
+.LVL288:
+.L147:
+	.loc 1 576 16 view .LVU827
+.LBE108:
+.LBE107:
+.LBB125:
+.LBB79:
+.LBB74:
+	.loc 1 634 13 is_stmt 1 view .LVU828
+	.loc 1 634 24 is_stmt 0 view .LVU829
+	movl	$4096, %eax
+	cmpq	%rax, %rdx
+	cmovbe	%rdx, %rax
+	movq	%rax, %rbp
+.LVL289:
+	.loc 1 636 13 is_stmt 1 view .LVU830
+	.loc 1 636 20 is_stmt 0 view .LVU831
+	movq	%rsi, (%r12)
+	.loc 1 637 13 is_stmt 1 view .LVU832
+	.loc 1 637 18 is_stmt 0 view .LVU833
+	movq	%rax, %rdx
+	movq	%rbx, %rdi
+	call	score_check_binary
+.LVL290:
+	.loc 1 637 16 view .LVU834
+	testb	%al, %al
+	je	.L173
+	.loc 1 640 13 is_stmt 1 view .LVU835
+	.loc 1 640 31 is_stmt 0 view .LVU836
+	subq	%rbp, 56(%rbx)
+	.loc 1 641 13 is_stmt 1 view .LVU837
+	.loc 1 641 51 is_stmt 0 view .LVU838
+	movq	%rbp, %rax
+	salq	$4, %rax
+	.loc 1 641 29 view .LVU839
+	addq	%rax, 104(%rbx)
+	.loc 1 642 13 is_stmt 1 view .LVU840
+	.loc 1 642 20 is_stmt 0 view .LVU841
+	movq	%rbp, %rax
+	jmp	.L145
+.LVL291:
+.L154:
+	.loc 1 642 20 view .LVU842
+.LBE74:
+.LBB75:
+	.loc 1 668 24 is_stmt 1 view .LVU843
+	.loc 1 669 21 view .LVU844
+	movq	8(%rbx), %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL292:
+	.loc 1 670 21 view .LVU845
+	.loc 1 670 28 is_stmt 0 view .LVU846
+	movq	$-1, %rax
+	jmp	.L145
+.LVL293:
+.L152:
+	.loc 1 670 28 view .LVU847
+.LBE75:
+	.loc 1 674 13 is_stmt 1 view .LVU848
+	movq	%rbp, %rax
+	salq	$4, %rax
+	leaq	65668(%rbx,%rax), %rsi
+	.loc 1 675 33 is_stmt 0 view .LVU849
+	leaq	129(%rbx,%rdx), %rdi
+	.loc 1 674 13 view .LVU850
+	call	score_decode_record
+.LVL294:
+	.loc 1 677 13 is_stmt 1 view .LVU851
+	.loc 1 677 30 is_stmt 0 view .LVU852
+	addq	$16, 112(%rbx)
+	.loc 1 678 13 is_stmt 1 view .LVU853
+	addq	$1, %rbp
+.LVL295:
+	.loc 1 654 16 view .LVU854
+	cmpq	$15, %rbp
+	jbe	.L146
+	jmp	.L151
+.LVL296:
+.L172:
+	.loc 1 628 12 is_stmt 0 view .LVU855
+	movl	$0, %ebp
+.LVL297:
+.L146:
+	.loc 1 654 16 view .LVU856
+	cmpq	56(%rbx), %rbp
+	jnb	.L151
+	.loc 1 655 13 is_stmt 1 view .LVU857
+	.loc 1 655 40 is_stmt 0 view .LVU858
+	movq	112(%rbx), %rdx
+	.loc 1 655 33 view .LVU859
+	movq	120(%rbx), %rax
+	subq	%rdx, %rax
+	.loc 1 655 16 view .LVU860
+	cmpq	$15, %rax
+	ja	.L152
+.LBB76:
+	.loc 1 656 17 is_stmt 1 view .LVU861
+	.loc 1 656 20 is_stmt 0 view .LVU862
+	testq	%rbp, %rbp
+	jne	.L151
+	.loc 1 659 17 is_stmt 1 view .LVU863
+	.loc 1 659 36 is_stmt 0 view .LVU864
+	movq	%rbx, %rdi
+	call	score_read_more
+.LVL298:
+	.loc 1 660 17 is_stmt 1 view .LVU865
+	.loc 1 660 20 is_stmt 0 view .LVU866
+	testl	%eax, %eax
+	js	.L174
+	.loc 1 662 24 is_stmt 1 view .LVU867
+	.loc 1 662 27 is_stmt 0 view .LVU868
+	jne	.L146
+	.loc 1 663 28 view .LVU869
+	cmpq	$-1, 56(%rbx)
+	jne	.L154
+	.loc 1 664 28 view .LVU870
+	movq	112(%rbx), %rax
+.LVL299:
+	.loc 1 664 28 view .LVU871
+	cmpq	%rax, 120(%rbx)
+	jne	.L154
+	.loc 1 666 21 is_stmt 1 view .LVU872
+	.loc 1 666 39 is_stmt 0 view .LVU873
+	movq	$0, 56(%rbx)
+	.loc 1 667 21 is_stmt 1 view .LVU874
+	.loc 1 667 28 is_stmt 0 view .LVU875
+	movl	$0, %eax
+	jmp	.L145
+.LVL300:
+.L173:
+	.loc 1 667 28 view .LVU876
+.LBE76:
+.LBB77:
+	.loc 1 638 24 view .LVU877
+	movq	$-1, %rax
+	jmp	.L145
+.LVL301:
+.L174:
+	.loc 1 638 24 view .LVU878
+.LBE77:
+.LBB78:
+	.loc 1 661 28 view .LVU879
+	movq	$-1, %rax
+.LVL302:
+	.loc 1 661 28 view .LVU880
+	jmp	.L145
+.LVL303:
+.L175:
+	.loc 1 661 28 view .LVU881
+.LBE78:
+	.loc 1 682 16 view .LVU882
+	movq	$-1, %rax
+	jmp	.L145
+.LVL304:
+.L168:
+	.loc 1 682 16 view .LVU883
+.LBE79:
+.LBE125:
+.LBB126:
+.LBB123:
+	.loc 1 576 16 view .LVU884
+	movq	$-1, %rax
+	jmp	.L115
+.LVL305:
+.L170:
+	.loc 1 576 16 view .LVU885
+.LBE123:
+.LBE126:
+	.loc 1 703 16 view .LVU886
+	movq	$-1, %rax
+	jmp	.L115
+.LVL306:
+.L199:
+.LBB127:
+.LBB124:
+	.loc 1 576 16 view .LVU887
+	movq	$-1, %rax
+.LVL307:
+	.loc 1 576 16 view .LVU888
+	jmp	.L115
+.LBE124:
+.LBE127:
+	.cfi_endproc
+.LFE84:
+	.size	beep_score_next, .-beep_score_next
+	.section	.rodata.str1.1
+.LC14:
+	.string	"score: %lu lines read from %s"
+	.text
+	.globl	beep_score_close
+	.type	beep_score_close, @function
+beep_score_close:
+.LVL308:
+.LFB85:
+	.loc 1 712 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 712 1 is_stmt 0 view .LVU890
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 713 5 is_stmt 1 view .LVU891
+	.loc 1 713 8 is_stmt 0 view .LVU892
+	cmpb	$0, 50(%rdi)
+	jne	.L204
+	.loc 1 714 9 is_stmt 1 view .LVU893
+	.loc 1 714 14 view .LVU894
+	.loc 1 714 17 is_stmt 0 view .LVU895
+	cmpl	$0, log_level(%rip)
+	jg	.L208
+.LVL309:
+.L204:
+	.loc 1 714 12 is_stmt 1 discriminator 3 view .LVU896
+	.loc 1 717 5 discriminator 3 view .LVU897
+	.loc 1 717 14 is_stmt 0 discriminator 3 view .LVU898
+	movq	72(%rbx), %rdi
+	.loc 1 717 8 discriminator 3 view .LVU899
+	testq	%rdi, %rdi
+	je	.L205
+	.loc 1 718 9 is_stmt 1 view .LVU900
+	movq	88(%rbx), %rsi
+	call	munmap@PLT
+.LVL310:
+.L205:
+	.loc 1 720 5 view .LVU901
+	.loc 1 720 14 is_stmt 0 view .LVU902
+	movl	(%rbx), %edi
+	.loc 1 720 8 view .LVU903
+	testl	%edi, %edi
+	jne	.L209
+.L206:
+	.loc 1 723 5 is_stmt 1 view .LVU904
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL311:
+	.loc 1 724 1 is_stmt 0 view .LVU905
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL312:
+	.loc 1 724 1 view .LVU906
+	ret
+.LVL313:
+.L208:
+	.cfi_restore_state
+	.loc 1 714 50 is_stmt 1 discriminator 1 view .LVU907
+	movq	8(%rdi), %rdx
+	movq	16(%rdi), %rsi
+	leaq	.LC14(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL314:
+	jmp	.L204
+.L209:
+	.loc 1 721 9 view .LVU908
+	call	close@PLT
+.LVL315:
+	jmp	.L206
+	.cfi_endproc
+.LFE85:
+	.size	beep_score_close, .-beep_score_close
+	.globl	beep_score_fcreate
+	.type	beep_score_fcreate, @function
+beep_score_fcreate:
+.LVL316:
+.LFB88:
+	.loc 1 761 1 view -0
+	.cfi_startproc
+	.loc 1 761 1 is_stmt 0 view .LVU910
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	.loc 1 762 5 is_stmt 1 view .LVU911
+	.loc 1 762 39 is_stmt 0 view .LVU912
+	movl	$32, %edi
+.LVL317:
+	.loc 1 762 39 view .LVU913
+	call	malloc@PLT
+.LVL318:
+	movq	%rax, %rbx
+.LVL319:
+	.loc 1 763 5 is_stmt 1 view .LVU914
+	.loc 1 763 8 is_stmt 0 view .LVU915
+	testq	%rax, %rax
+	je	.L210
+	.loc 1 766 5 is_stmt 1 view .LVU916
+	.loc 1 766 18 is_stmt 0 view .LVU917
+	movq	%rbp, (%rax)
+	.loc 1 767 5 is_stmt 1 view .LVU918
+	.loc 1 767 21 is_stmt 0 view .LVU919
+	movq	%rbp, %rdi
+	call	ftell@PLT
+.LVL320:
+	.loc 1 767 19 view .LVU920
+	movq	%rax, 8(%rbx)
+	.loc 1 768 5 is_stmt 1 view .LVU921
+	.loc 1 768 78 is_stmt 0 view .LVU922
+	movl	$0, %edx
+	cmpq	$-1, %rax
+	je	.L215
+.L212:
+	.loc 1 768 19 discriminator 6 view .LVU923
+	movl	%edx, 16(%rbx)
+	.loc 1 769 5 is_stmt 1 discriminator 6 view .LVU924
+	.loc 1 769 24 is_stmt 0 discriminator 6 view .LVU925
+	movq	$0, 24(%rbx)
+	.loc 1 770 5 is_stmt 1 discriminator 6 view .LVU926
+	movq	%rbx, %rdi
+	call	score_write_header
+.LVL321:
+	.loc 1 771 5 discriminator 6 view .LVU927
+.L210:
+	.loc 1 772 1 is_stmt 0 view .LVU928
+	movq	%rbx, %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL322:
+	.loc 1 772 1 view .LVU929
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL323:
+	.loc 1 772 1 view .LVU930
+	ret
+.LVL324:
+.L215:
+	.cfi_restore_state
+	.loc 1 768 54 discriminator 1 view .LVU931
+	call	__errno_location@PLT
+.LVL325:
+	.loc 1 768 53 discriminator 1 view .LVU932
+	movl	(%rax), %edx
+	.loc 1 768 78 discriminator 1 view .LVU933
+	cmpl	$29, %edx
+	movl	$0, %eax
+	cmove	%eax, %edx
+	jmp	.L212
+	.cfi_endproc
+.LFE88:
+	.size	beep_score_fcreate, .-beep_score_fcreate
+	.section	.rodata.str1.1
+.LC15:
+	.string	"wb"
+	.text
+	.globl	beep_score_create
+	.type	beep_score_create, @function
+beep_score_create:
+.LVL326:
+.LFB89:
+	.loc 1 776 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 776 1 is_stmt 0 view .LVU935
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx
+	.loc 1 777 5 is_stmt 1 view .LVU936
+	.loc 1 777 14 is_stmt 0 view .LVU937
+	leaq	.LC10(%rip), %rsi
+	call	strcmp@PLT
+.LVL327:
+	.loc 1 777 8 view .LVU938
+	testl	%eax, %eax
+	je	.L221
+	.loc 1 780 5 is_stmt 1 view .LVU939
+	.loc 1 780 24 is_stmt 0 view .LVU940
+	leaq	.LC15(%rip), %rsi
+	movq	%rbx, %rdi
+	call	fopen@PLT
+.LVL328:
+	movq	%rax, %rbp
+.LVL329:
+	.loc 1 781 5 is_stmt 1 view .LVU941
+	.loc 1 781 8 is_stmt 0 view .LVU942
+	testq	%rax, %rax
+	je	.L219
+	.loc 1 784 5 is_stmt 1 view .LVU943
+	.loc 1 784 39 is_stmt 0 view .LVU944
+	movq	%rax, %rdi
+	call	beep_score_fcreate
+.LVL330:
+	.loc 1 784 39 view .LVU945
+	movq	%rax, %rbx
+.LVL331:
+	.loc 1 785 5 is_stmt 1 view .LVU946
+	.loc 1 785 8 is_stmt 0 view .LVU947
+	testq	%rax, %rax
+	je	.L222
+.LVL332:
+.L216:
+	.loc 1 791 1 view .LVU948
+	movq	%rbx, %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL333:
+.L221:
+	.cfi_restore_state
+	.loc 1 778 9 is_stmt 1 view .LVU949
+	.loc 1 778 16 is_stmt 0 view .LVU950
+	movq	stdout(%rip), %rdi
+	call	beep_score_fcreate
+.LVL334:
+	movq	%rax, %rbx
+.LVL335:
+	.loc 1 778 16 view .LVU951
+	jmp	.L216
+.LVL336:
+.L222:
+.LBB128:
+	.loc 1 786 9 is_stmt 1 view .LVU952
+	.loc 1 786 34 is_stmt 0 view .LVU953
+	call	__errno_location@PLT
+.LVL337:
+	.loc 1 786 34 view .LVU954
+	movq	%rax, %r12
+	.loc 1 786 19 view .LVU955
+	movl	(%rax), %r13d
+.LVL338:
+	.loc 1 787 9 is_stmt 1 view .LVU956
+	movq	%rbp, %rdi
+	call	fclose@PLT
+.LVL339:
+	.loc 1 788 8 view .LVU957
+	.loc 1 788 14 is_stmt 0 view .LVU958
+	movl	%r13d, (%r12)
+	jmp	.L216
+.LVL340:
+.L219:
+	.loc 1 788 14 view .LVU959
+.LBE128:
+	.loc 1 782 15 view .LVU960
+	movq	%rax, %rbx
+.LVL341:
+	.loc 1 782 15 view .LVU961
+	jmp	.L216
+	.cfi_endproc
+.LFE89:
+	.size	beep_score_create, .-beep_score_create
+	.globl	beep_score_write
+	.type	beep_score_write, @function
+beep_score_write:
+.LVL342:
+.LFB90:
+	.loc 1 796 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 796 1 is_stmt 0 view .LVU963
+	endbr64
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %r13
+	movq	%rdx, %r14
+	.loc 1 796 1 view .LVU964
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 797 5 is_stmt 1 view .LVU965
+.LBB129:
+	.loc 1 797 10 view .LVU966
+.LVL343:
+	.loc 1 797 23 view .LVU967
+	testq	%rdx, %rdx
+	je	.L224
+	movq	%rsi, %rbx
+	.loc 1 797 17 is_stmt 0 view .LVU968
+	movl	$0, %ebp
+.LBB130:
+	.loc 1 799 9 view .LVU969
+	movq	%rsp, %r12
+.LVL344:
+.L225:
+	.loc 1 798 9 is_stmt 1 discriminator 3 view .LVU970
+	.loc 1 799 9 discriminator 3 view .LVU971
+	movl	(%rbx), %esi
+	movq	%r12, %rdi
+	call	put_le32
+.LVL345:
+	.loc 1 800 9 discriminator 3 view .LVU972
+	movl	4(%rbx), %esi
+	leaq	4(%rsp), %rdi
+	call	put_le32
+.LVL346:
+	.loc 1 801 9 discriminator 3 view .LVU973
+	movl	8(%rbx), %esi
+	leaq	8(%rsp), %rdi
+	call	put_le32
+.LVL347:
+	.loc 1 802 9 discriminator 3 view .LVU974
+	movl	12(%rbx), %esi
+	leaq	12(%rsp), %rdi
+	call	put_le32
+.LVL348:
+	.loc 1 803 9 discriminator 3 view .LVU975
+	movl	$16, %edx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	score_write
+.LVL349:
+.LBE130:
+	.loc 1 797 31 discriminator 3 view .LVU976
+	addq	$1, %rbp
+.LVL350:
+	.loc 1 797 23 discriminator 3 view .LVU977
+	addq	$16, %rbx
+	cmpq	%rbp, %r14
+	jne	.L225
+.LVL351:
+.L224:
+	.loc 1 797 23 is_stmt 0 discriminator 3 view .LVU978
+.LBE129:
+	.loc 1 805 5 is_stmt 1 view .LVU979
+	.loc 1 805 24 is_stmt 0 view .LVU980
+	addq	%r14, 24(%r13)
+	.loc 1 806 1 view .LVU981
+	movq	24(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L229
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL352:
+	.loc 1 806 1 view .LVU982
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL353:
+	.loc 1 806 1 view .LVU983
+	ret
+.LVL354:
+.L229:
+	.cfi_restore_state
+	.loc 1 806 1 view .LVU984
+	call	__stack_chk_fail@PLT
+.LVL355:
+	.cfi_endproc
+.LFE90:
+	.size	beep_score_write, .-beep_score_write
+	.globl	beep_score_finish
+	.type	beep_score_finish, @function
+beep_score_finish:
+.LVL356:
+.LFB91:
+	.loc 1 810 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 810 1 is_stmt 0 view .LVU986
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 812 5 is_stmt 1 view .LVU987
+	.loc 1 812 15 is_stmt 0 view .LVU988
+	movq	8(%rdi), %rsi
+	.loc 1 812 8 view .LVU989
+	cmpq	$-1, %rsi
+	je	.L231
+	.loc 1 813 9 is_stmt 1 view .LVU990
+	.loc 1 813 12 is_stmt 0 view .LVU991
+	cmpl	$0, 16(%rdi)
+	je	.L237
+.LVL357:
+.L232:
+	.loc 1 817 9 is_stmt 1 view .LVU992
+	movq	%rbx, %rdi
+	call	score_write_header
+.LVL358:
+.L231:
+	.loc 1 819 5 view .LVU993
+	.loc 1 819 31 is_stmt 0 view .LVU994
+	movq	(%rbx), %rdi
+	.loc 1 820 32 view .LVU995
+	cmpq	stdout(%rip), %rdi
+	je	.L238
+	.loc 1 820 34 discriminator 2 view .LVU996
+	call	fclose@PLT
+.LVL359:
+.L234:
+	.loc 1 821 5 is_stmt 1 view .LVU997
+	.loc 1 821 8 is_stmt 0 view .LVU998
+	testl	%eax, %eax
+	je	.L235
+	.loc 1 821 23 discriminator 1 view .LVU999
+	cmpl	$0, 16(%rbx)
+	jne	.L235
+	.loc 1 822 9 is_stmt 1 view .LVU1000
+	.loc 1 822 26 is_stmt 0 view .LVU1001
+	call	__errno_location@PLT
+.LVL360:
+	.loc 1 822 25 view .LVU1002
+	movl	(%rax), %eax
+	.loc 1 822 23 view .LVU1003
+	movl	%eax, 16(%rbx)
+.L235:
+	.loc 1 824 5 is_stmt 1 view .LVU1004
+	.loc 1 824 15 is_stmt 0 view .LVU1005
+	movl	16(%rbx), %ebp
+.LVL361:
+	.loc 1 825 5 is_stmt 1 view .LVU1006
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL362:
+	.loc 1 826 4 view .LVU1007
+	.loc 1 826 6 is_stmt 0 view .LVU1008
+	call	__errno_location@PLT
+.LVL363:
+	.loc 1 826 10 view .LVU1009
+	movl	%ebp, (%rax)
+	.loc 1 827 5 is_stmt 1 view .LVU1010
+	.loc 1 827 19 is_stmt 0 view .LVU1011
+	testl	%ebp, %ebp
+	sete	%al
+	.loc 1 828 1 view .LVU1012
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL364:
+	.loc 1 828 1 view .LVU1013
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL365:
+	.loc 1 828 1 view .LVU1014
+	ret
+.LVL366:
+.L237:
+	.cfi_restore_state
+	.loc 1 814 22 view .LVU1015
+	movq	(%rdi), %rdi
+	movl	$0, %edx
+	call	fseek@PLT
+.LVL367:
+	.loc 1 814 13 view .LVU1016
+	testl	%eax, %eax
+	je	.L232
+	.loc 1 815 13 is_stmt 1 view .LVU1017
+	.loc 1 815 30 is_stmt 0 view .LVU1018
+	call	__errno_location@PLT
+.LVL368:
+	.loc 1 815 29 view .LVU1019
+	movl	(%rax), %eax
+	.loc 1 815 27 view .LVU1020
+	movl	%eax, 16(%rbx)
+	jmp	.L232
+.L238:
+	.loc 1 820 11 discriminator 1 view .LVU1021
+	call	fflush@PLT
+.LVL369:
+	jmp	.L234
+	.cfi_endproc
+.LFE91:
+	.size	beep_score_finish, .-beep_score_finish
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/usr/include/stdint.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 14 "beep-driver.h"
+	.file 15 "beep-score.h"
+	.file 16 "beep-log.h"
+	.file 17 "beep-notes.h"
+	.file 18 "beep-library.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/usr/include/stdlib.h"
+	.file 21 "/usr/include/unistd.h"
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 24 "<built-in>"
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.file 26 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2c84
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3d
+	.long	.LASF443
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x8
+	.long	.LASF9
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x9
+	.long	0x35
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x4d
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x9
+	.long	0x59
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.long	0x6c
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x8
+	.long	.LASF10
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6c
+	.uleb128 0x8
+	.long	.LASF11
+	.byte	0x6
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x8
+	.long	.LASF12
+	.byte	0x6
+	.byte	0x91
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x8
+	.long	.LASF13
+	.byte	0x6
+	.byte	0x92
+	.byte	0x16
+	.long	0x6c
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x6
+	.byte	0x93
+	.byte	0x16
+	.long	0x6c
+	.uleb128 0x8
+	.long	.LASF15
+	.byte	0x6
+	.byte	0x94
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x8
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x96
+	.byte	0x16
+	.long	0x6c
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x97
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x8
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x98
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x99
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x6
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x3f
+	.byte	0x8
+	.uleb128 0x9
+	.long	0x10a
+	.uleb128 0x20
+	.long	0x10a
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x6
+	.byte	0xaf
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF22
+	.byte	0x6
+	.byte	0xb4
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF23
+	.byte	0x6
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x6
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0xe
+	.long	0x14b
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF25
+	.uleb128 0x9
+	.long	0x14b
+	.uleb128 0x8
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0x86
+	.uleb128 0x9
+	.long	0x157
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0x92
+	.uleb128 0x9
+	.long	0x168
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x28
+	.long	.LASF65
+	.byte	0xd8
+	.byte	0x9
+	.byte	0x31
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x9
+	.byte	0x33
+	.byte	0x7
+	.long	0x4d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x36
+	.byte	0x9
+	.long	0x146
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x37
+	.byte	0x9
+	.long	0x146
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x38
+	.byte	0x9
+	.long	0x146
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0x146
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x9
+	.long	0x146
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x9
+	.long	0x146
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x9
+	.long	0x146
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x9
+	.long	0x146
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x40
+	.byte	0x9
+	.long	0x146
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x41
+	.byte	0x9
+	.long	0x146
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x42
+	.byte	0x9
+	.long	0x146
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x44
+	.byte	0x16
+	.long	0x324
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x46
+	.byte	0x14
+	.long	0x329
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x48
+	.byte	0x7
+	.long	0x4d
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x49
+	.byte	0x7
+	.long	0x4d
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xb
+	.long	0xe6
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x12
+	.long	0x65
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xf
+	.long	0x78
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x8
+	.long	0x32e
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x51
+	.byte	0xf
+	.long	0x33e
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xf2
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x17
+	.long	0x348
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x19
+	.long	0x352
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x14
+	.long	0x329
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x9
+	.long	0x10a
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x60
+	.byte	0x7
+	.long	0x4d
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x62
+	.byte	0x8
+	.long	0x357
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x7
+	.byte	0x19
+	.long	0x185
+	.uleb128 0x40
+	.long	.LASF444
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x29
+	.long	.LASF59
+	.uleb128 0xe
+	.long	0x31f
+	.uleb128 0xe
+	.long	0x185
+	.uleb128 0x14
+	.long	0x14b
+	.long	0x33e
+	.uleb128 0x19
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x317
+	.uleb128 0x29
+	.long	.LASF60
+	.uleb128 0xe
+	.long	0x343
+	.uleb128 0x29
+	.long	.LASF61
+	.uleb128 0xe
+	.long	0x34d
+	.uleb128 0x14
+	.long	0x14b
+	.long	0x367
+	.uleb128 0x19
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x11
+	.long	0xe6
+	.uleb128 0x9
+	.long	0x367
+	.uleb128 0x8
+	.long	.LASF63
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x13
+	.long	0x12e
+	.uleb128 0x9
+	.long	0x378
+	.uleb128 0xe
+	.long	0x30b
+	.uleb128 0x20
+	.long	0x389
+	.uleb128 0x9
+	.long	0x389
+	.uleb128 0x30
+	.long	.LASF334
+	.byte	0xb
+	.byte	0x90
+	.byte	0xe
+	.long	0x389
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF64
+	.uleb128 0x28
+	.long	.LASF66
+	.byte	0x10
+	.byte	0xc
+	.byte	0xb
+	.long	0x3d2
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0xc
+	.byte	0x10
+	.byte	0xc
+	.long	0xfe
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF68
+	.byte	0xc
+	.byte	0x15
+	.byte	0x15
+	.long	0x13a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF69
+	.uleb128 0xe
+	.long	0x3e8
+	.uleb128 0x20
+	.long	0x3d9
+	.uleb128 0x9
+	.long	0x3d9
+	.uleb128 0x41
+	.uleb128 0x28
+	.long	.LASF70
+	.byte	0x90
+	.byte	0xd
+	.byte	0x1a
+	.long	0x4b9
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xd
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9e
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xd
+	.byte	0x24
+	.byte	0xd
+	.long	0xc2
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xd
+	.byte	0x2c
+	.byte	0xf
+	.long	0xda
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0xd
+	.byte	0x2d
+	.byte	0xe
+	.long	0xce
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0xd
+	.byte	0x2f
+	.byte	0xd
+	.long	0xaa
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xd
+	.byte	0x30
+	.byte	0xd
+	.long	0xb6
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xd
+	.byte	0x32
+	.byte	0x9
+	.long	0x4d
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xd
+	.byte	0x34
+	.byte	0xd
+	.long	0x9e
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xd
+	.byte	0x39
+	.byte	0xd
+	.long	0xe6
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x11
+	.long	0x116
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xd
+	.byte	0x3f
+	.byte	0x10
+	.long	0x122
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0xd
+	.byte	0x4a
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0xd
+	.byte	0x4b
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0xd
+	.byte	0x4c
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0xd
+	.byte	0x59
+	.byte	0x17
+	.long	0x4b9
+	.byte	0x78
+	.byte	0
+	.uleb128 0x14
+	.long	0x13a
+	.long	0x4c9
+	.uleb128 0x19
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x152
+	.uleb128 0x9
+	.long	0x4c9
+	.uleb128 0x20
+	.long	0x4c9
+	.uleb128 0x42
+	.byte	0x7
+	.byte	0x4
+	.long	0x6c
+	.byte	0x19
+	.byte	0x48
+	.byte	0x3
+	.long	0x9fd
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x6f
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x71
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x72
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x73
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x75
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x76
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x77
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x79
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x7a
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x7b
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x7f
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x81
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0x85
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0x86
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0x87
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x8b
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0x8d
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0x8e
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0x91
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0x92
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0x93
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0x95
+	.uleb128 0x1
+	.long	.LASF237
+	.byte	0x96
+	.uleb128 0x1
+	.long	.LASF238
+	.byte	0x97
+	.uleb128 0x1
+	.long	.LASF239
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF240
+	.byte	0x99
+	.uleb128 0x1
+	.long	.LASF241
+	.byte	0x9a
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0x9b
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0x9d
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0x9e
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0x9f
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0xa1
+	.uleb128 0x1
+	.long	.LASF249
+	.byte	0xa2
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0xa3
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF252
+	.byte	0xa5
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0xa6
+	.uleb128 0x1
+	.long	.LASF254
+	.byte	0xa7
+	.uleb128 0x1
+	.long	.LASF255
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF256
+	.byte	0xa9
+	.uleb128 0x1
+	.long	.LASF257
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF258
+	.byte	0xab
+	.uleb128 0x1
+	.long	.LASF259
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF260
+	.byte	0xad
+	.uleb128 0x1
+	.long	.LASF261
+	.byte	0xae
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0xaf
+	.uleb128 0x1
+	.long	.LASF263
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF264
+	.byte	0xb1
+	.uleb128 0x1
+	.long	.LASF265
+	.byte	0xb2
+	.uleb128 0x1
+	.long	.LASF266
+	.byte	0xb3
+	.uleb128 0x1
+	.long	.LASF267
+	.byte	0xb4
+	.uleb128 0x1
+	.long	.LASF268
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF269
+	.byte	0xb6
+	.uleb128 0x1
+	.long	.LASF270
+	.byte	0xb7
+	.uleb128 0x1
+	.long	.LASF271
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF272
+	.byte	0xb9
+	.uleb128 0x1
+	.long	.LASF273
+	.byte	0xba
+	.uleb128 0x1
+	.long	.LASF274
+	.byte	0xbb
+	.uleb128 0x1
+	.long	.LASF275
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF276
+	.byte	0xbd
+	.uleb128 0x1
+	.long	.LASF277
+	.byte	0xbe
+	.uleb128 0x1
+	.long	.LASF278
+	.byte	0xbf
+	.uleb128 0x1
+	.long	.LASF279
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF280
+	.byte	0xc1
+	.uleb128 0x1
+	.long	.LASF281
+	.byte	0xc2
+	.uleb128 0x1
+	.long	.LASF282
+	.byte	0xc3
+	.uleb128 0x1
+	.long	.LASF283
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF284
+	.byte	0xc5
+	.uleb128 0x1
+	.long	.LASF285
+	.byte	0xc6
+	.uleb128 0x1
+	.long	.LASF286
+	.byte	0xc7
+	.uleb128 0x1
+	.long	.LASF287
+	.byte	0xeb
+	.uleb128 0x1
+	.long	.LASF288
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF289
+	.byte	0xed
+	.uleb128 0x1
+	.long	.LASF290
+	.byte	0xee
+	.uleb128 0x1
+	.long	.LASF291
+	.byte	0xef
+	.uleb128 0x1
+	.long	.LASF292
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF293
+	.byte	0xf1
+	.uleb128 0x1
+	.long	.LASF294
+	.byte	0xf2
+	.uleb128 0x1
+	.long	.LASF295
+	.byte	0xf3
+	.uleb128 0x1
+	.long	.LASF296
+	.byte	0xf4
+	.uleb128 0x1
+	.long	.LASF297
+	.byte	0xf5
+	.uleb128 0x1
+	.long	.LASF298
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF299
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF300
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF301
+	.byte	0xf9
+	.uleb128 0x1
+	.long	.LASF302
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x31
+	.byte	0xe
+	.byte	0x22
+	.long	0xa39
+	.uleb128 0x4
+	.long	.LASF303
+	.byte	0xe
+	.byte	0x23
+	.byte	0xe
+	.long	0x157
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF304
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0x157
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF305
+	.byte	0xe
+	.byte	0x25
+	.byte	0xe
+	.long	0x157
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF306
+	.byte	0xe
+	.byte	0x26
+	.byte	0xe
+	.long	0x157
+	.byte	0xc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF307
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x9fd
+	.uleb128 0x9
+	.long	0xa39
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF308
+	.uleb128 0x9
+	.long	0xa4a
+	.uleb128 0xe
+	.long	0xa45
+	.uleb128 0x9
+	.long	0xa56
+	.uleb128 0x8
+	.long	.LASF309
+	.byte	0xf
+	.byte	0x3e
+	.byte	0x1c
+	.long	0xa6c
+	.uleb128 0x43
+	.long	.LASF310
+	.long	0x10188
+	.byte	0x1
+	.byte	0x58
+	.byte	0x8
+	.long	0xb90
+	.uleb128 0x1c
+	.string	"fd"
+	.byte	0x1
+	.byte	0x59
+	.byte	0x9
+	.long	0x4d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF311
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x11
+	.long	0x4c9
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF312
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x13
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF313
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x12
+	.long	0x6c
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF314
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x12
+	.long	0x6c
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF315
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x10
+	.long	0xc0d
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF316
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x12
+	.long	0xa4a
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF317
+	.byte	0x1
+	.byte	0x60
+	.byte	0x12
+	.long	0xa4a
+	.byte	0x31
+	.uleb128 0x4
+	.long	.LASF318
+	.byte	0x1
+	.byte	0x63
+	.byte	0x12
+	.long	0xa4a
+	.byte	0x32
+	.uleb128 0x4
+	.long	.LASF319
+	.byte	0x1
+	.byte	0x64
+	.byte	0xe
+	.long	0x168
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF320
+	.byte	0x1
+	.byte	0x65
+	.byte	0xe
+	.long	0x168
+	.byte	0x40
+	.uleb128 0x1c
+	.string	"map"
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x11
+	.long	0x4c9
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF321
+	.byte	0x1
+	.byte	0x6b
+	.byte	0xb
+	.long	0x367
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF322
+	.byte	0x1
+	.byte	0x6c
+	.byte	0xc
+	.long	0x35
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF323
+	.byte	0x1
+	.byte	0x6d
+	.byte	0xb
+	.long	0x367
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF324
+	.byte	0x1
+	.byte	0x6e
+	.byte	0xb
+	.long	0x367
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF325
+	.byte	0x1
+	.byte	0x71
+	.byte	0xc
+	.long	0x35
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF326
+	.byte	0x1
+	.byte	0x72
+	.byte	0xc
+	.long	0x35
+	.byte	0x78
+	.uleb128 0x1c
+	.string	"eof"
+	.byte	0x1
+	.byte	0x73
+	.byte	0x12
+	.long	0xa4a
+	.byte	0x80
+	.uleb128 0x1c
+	.string	"buf"
+	.byte	0x1
+	.byte	0x74
+	.byte	0xa
+	.long	0xc19
+	.byte	0x81
+	.uleb128 0x44
+	.long	.LASF327
+	.byte	0x1
+	.byte	0x76
+	.byte	0xf
+	.long	0xc2a
+	.long	0x10084
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF328
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x23
+	.long	0xb9c
+	.uleb128 0x45
+	.long	.LASF329
+	.byte	0x20
+	.byte	0x1
+	.value	0x2d7
+	.byte	0x8
+	.long	0xbdf
+	.uleb128 0x21
+	.long	.LASF330
+	.value	0x2d8
+	.byte	0xb
+	.long	0x389
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF331
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x21
+	.long	.LASF332
+	.value	0x2da
+	.byte	0x9
+	.long	0x4d
+	.byte	0x10
+	.uleb128 0x21
+	.long	.LASF333
+	.value	0x2db
+	.byte	0xe
+	.long	0x168
+	.byte	0x18
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF335
+	.byte	0x10
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x31
+	.byte	0x11
+	.byte	0x35
+	.long	0xc0d
+	.uleb128 0x1c
+	.string	"bpm"
+	.byte	0x11
+	.byte	0x36
+	.byte	0x12
+	.long	0x6c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF336
+	.byte	0x11
+	.byte	0x37
+	.byte	0xe
+	.long	0x168
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF337
+	.byte	0x11
+	.byte	0x38
+	.byte	0x3
+	.long	0xbeb
+	.uleb128 0x14
+	.long	0x14b
+	.long	0xc2a
+	.uleb128 0x46
+	.long	0x46
+	.value	0xffff
+	.byte	0
+	.uleb128 0x14
+	.long	0xa39
+	.long	0xc3a
+	.uleb128 0x19
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF338
+	.byte	0xb
+	.byte	0xe6
+	.byte	0xc
+	.long	0x4d
+	.long	0xc50
+	.uleb128 0x3
+	.long	0x389
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF339
+	.byte	0xb
+	.value	0x2c9
+	.byte	0xc
+	.long	0x4d
+	.long	0xc71
+	.uleb128 0x3
+	.long	0x389
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF340
+	.byte	0xb
+	.byte	0xb2
+	.byte	0xc
+	.long	0x4d
+	.long	0xc87
+	.uleb128 0x3
+	.long	0x389
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF341
+	.byte	0xb
+	.value	0x102
+	.byte	0xe
+	.long	0x389
+	.long	0xca3
+	.uleb128 0x3
+	.long	0x4d3
+	.uleb128 0x3
+	.long	0x4d3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF342
+	.byte	0xb
+	.value	0x2a9
+	.byte	0xf
+	.long	0x35
+	.long	0xcc9
+	.uleb128 0x3
+	.long	0x3de
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x38e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF343
+	.byte	0xb
+	.value	0x2ce
+	.byte	0x11
+	.long	0x2e
+	.long	0xce0
+	.uleb128 0x3
+	.long	0x389
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF356
+	.byte	0x14
+	.value	0x238
+	.byte	0xd
+	.long	0xcf3
+	.uleb128 0x3
+	.long	0x10a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF344
+	.byte	0x11
+	.byte	0x5a
+	.byte	0xe
+	.long	0x6c
+	.long	0xd0e
+	.uleb128 0x3
+	.long	0xd0e
+	.uleb128 0x3
+	.long	0x73
+	.byte	0
+	.uleb128 0xe
+	.long	0xc0d
+	.uleb128 0xf
+	.long	.LASF345
+	.byte	0x11
+	.byte	0x4d
+	.byte	0xd
+	.long	0x4c9
+	.long	0xd33
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0x73
+	.uleb128 0x3
+	.long	0xd38
+	.byte	0
+	.uleb128 0xe
+	.long	0x6c
+	.uleb128 0x9
+	.long	0xd33
+	.uleb128 0xf
+	.long	.LASF346
+	.byte	0x12
+	.byte	0x42
+	.byte	0xd
+	.long	0x4c9
+	.long	0xd5d
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0x73
+	.uleb128 0x3
+	.long	0xd38
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF347
+	.byte	0x11
+	.byte	0x45
+	.byte	0xe
+	.long	0x6c
+	.long	0xd73
+	.uleb128 0x3
+	.long	0x73
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF348
+	.byte	0x11
+	.byte	0x40
+	.byte	0xd
+	.long	0x4c9
+	.long	0xd8e
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0xd38
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF349
+	.byte	0x13
+	.byte	0x6b
+	.byte	0xe
+	.long	0x10a
+	.long	0xdae
+	.uleb128 0x3
+	.long	0x3d9
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF350
+	.byte	0x2
+	.byte	0x17
+	.byte	0x10
+	.long	0x378
+	.long	0xdd3
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF351
+	.byte	0x2
+	.byte	0x1d
+	.byte	0x10
+	.long	.LASF350
+	.long	0x378
+	.long	0xdfc
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF352
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x10
+	.long	.LASF353
+	.long	0x378
+	.long	0xe20
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF354
+	.byte	0x13
+	.byte	0x40
+	.byte	0xc
+	.long	0x4d
+	.long	0xe40
+	.uleb128 0x3
+	.long	0x3d9
+	.uleb128 0x3
+	.long	0x3d9
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF355
+	.byte	0x13
+	.value	0x1a3
+	.byte	0xe
+	.long	0x146
+	.long	0xe57
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF357
+	.byte	0x10
+	.byte	0x2d
+	.long	0xe69
+	.uleb128 0x3
+	.long	0x4ce
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF358
+	.byte	0x4
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF359
+	.long	0x4d
+	.long	0xe89
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF360
+	.byte	0x4
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.long	0xea4
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF361
+	.byte	0x25
+	.uleb128 0x32
+	.long	.LASF362
+	.byte	0x23
+	.uleb128 0x15
+	.long	.LASF363
+	.byte	0x15
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0xec7
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF445
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xd
+	.long	0xed3
+	.uleb128 0xe
+	.long	0x4d
+	.uleb128 0xf
+	.long	.LASF364
+	.byte	0x13
+	.byte	0x9c
+	.byte	0xc
+	.long	0x4d
+	.long	0xef3
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x3
+	.long	0x4c9
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF365
+	.byte	0x16
+	.byte	0x5e
+	.byte	0xc
+	.long	0x4d
+	.long	0xf13
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF366
+	.byte	0x16
+	.byte	0x39
+	.byte	0xe
+	.long	0x10a
+	.long	0xf42
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0xe6
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF367
+	.byte	0x15
+	.value	0x280
+	.byte	0x11
+	.long	0x2e
+	.long	0xf59
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF368
+	.byte	0x16
+	.byte	0x4c
+	.byte	0xc
+	.long	0x4d
+	.long	0xf74
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF369
+	.byte	0x10
+	.byte	0x43
+	.long	0xf86
+	.uleb128 0x3
+	.long	0x4ce
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF370
+	.byte	0x15
+	.value	0x153
+	.byte	0x10
+	.long	0xe6
+	.long	0xfa7
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0xe6
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF371
+	.byte	0x17
+	.byte	0xd2
+	.byte	0xc
+	.long	0x4d
+	.long	0xfc2
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0xfc2
+	.byte	0
+	.uleb128 0xe
+	.long	0x3e9
+	.uleb128 0x2b
+	.long	.LASF372
+	.byte	0x11
+	.byte	0x53
+	.long	0xfdd
+	.uleb128 0x3
+	.long	0xd0e
+	.uleb128 0x3
+	.long	0x73
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF373
+	.byte	0x14
+	.value	0x229
+	.byte	0xe
+	.long	0x10a
+	.long	0xff4
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF378
+	.value	0x329
+	.byte	0x5
+	.long	0xa4a
+	.quad	.LFB91
+	.quad	.LFE91-.LFB91
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10db
+	.uleb128 0xc
+	.long	.LASF375
+	.value	0x329
+	.byte	0x2a
+	.long	0x10db
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x10
+	.long	.LASF374
+	.value	0x333
+	.byte	0xf
+	.long	0x54
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x10
+	.long	.LASF332
+	.value	0x338
+	.byte	0xf
+	.long	0x54
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x5
+	.quad	.LVL358
+	.long	0x13e1
+	.long	0x106a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL359
+	.long	0xc71
+	.uleb128 0xa
+	.quad	.LVL360
+	.long	0xec7
+	.uleb128 0x5
+	.quad	.LVL362
+	.long	0xce0
+	.long	0x109c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL363
+	.long	0xec7
+	.uleb128 0x5
+	.quad	.LVL367
+	.long	0xc50
+	.long	0x10c0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL368
+	.long	0xec7
+	.uleb128 0xa
+	.quad	.LVL369
+	.long	0xc3a
+	.byte	0
+	.uleb128 0xe
+	.long	0xb90
+	.uleb128 0x9
+	.long	0x10db
+	.uleb128 0x33
+	.long	.LASF389
+	.value	0x31a
+	.quad	.LFB90
+	.quad	.LFE90-.LFB90
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1218
+	.uleb128 0xc
+	.long	.LASF375
+	.value	0x31a
+	.byte	0x2a
+	.long	0x10db
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0xc
+	.long	.LASF376
+	.value	0x31b
+	.byte	0x2e
+	.long	0xa5b
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0xc
+	.long	.LASF377
+	.value	0x31b
+	.byte	0x42
+	.long	0x41
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1d
+	.quad	.LBB129
+	.quad	.LBE129-.LBB129
+	.long	0x120a
+	.uleb128 0x1e
+	.string	"i"
+	.value	0x31d
+	.byte	0x11
+	.long	0x35
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x49
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.uleb128 0x2c
+	.long	.LASF383
+	.value	0x31e
+	.byte	0x17
+	.long	0x1218
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5
+	.quad	.LVL345
+	.long	0x2b34
+	.long	0x119e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL346
+	.long	0x2b34
+	.long	0x11b7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL347
+	.long	0x2b34
+	.long	0x11d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL348
+	.long	0x2b34
+	.long	0x11e9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL349
+	.long	0x1539
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL355
+	.long	0x2c6c
+	.byte	0
+	.uleb128 0x14
+	.long	0x59
+	.long	0x1228
+	.uleb128 0x19
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF379
+	.value	0x307
+	.byte	0x14
+	.long	0x10db
+	.quad	.LFB89
+	.quad	.LFE89-.LFB89
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1341
+	.uleb128 0xc
+	.long	.LASF380
+	.value	0x307
+	.byte	0x38
+	.long	0x4ce
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x10
+	.long	.LASF330
+	.value	0x30c
+	.byte	0x11
+	.long	0x393
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x10
+	.long	.LASF375
+	.value	0x310
+	.byte	0x1e
+	.long	0x10e0
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x1d
+	.quad	.LBB128
+	.quad	.LBE128-.LBB128
+	.long	0x12d1
+	.uleb128 0x10
+	.long	.LASF381
+	.value	0x312
+	.byte	0x13
+	.long	0x54
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xa
+	.quad	.LVL337
+	.long	0xec7
+	.uleb128 0x6
+	.quad	.LVL339
+	.long	0xc71
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL327
+	.long	0xed8
+	.long	0x12f6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL328
+	.long	0xc87
+	.long	0x131b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL330
+	.long	0x1341
+	.long	0x1333
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL334
+	.long	0x1341
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF382
+	.value	0x2f8
+	.byte	0x14
+	.long	0x10db
+	.quad	.LFB88
+	.quad	.LFE88-.LFB88
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13e1
+	.uleb128 0xc
+	.long	.LASF330
+	.value	0x2f8
+	.byte	0x2d
+	.long	0x389
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x10
+	.long	.LASF375
+	.value	0x2fa
+	.byte	0x1e
+	.long	0x10e0
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x5
+	.quad	.LVL318
+	.long	0xfdd
+	.long	0x13a3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL320
+	.long	0xcc9
+	.long	0x13bb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL321
+	.long	0x13e1
+	.long	0x13d3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL325
+	.long	0xec7
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF385
+	.value	0x2ea
+	.quad	.LFB87
+	.quad	.LFE87-.LFB87
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1529
+	.uleb128 0xc
+	.long	.LASF375
+	.value	0x2ea
+	.byte	0x2c
+	.long	0x10db
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2c
+	.long	.LASF384
+	.value	0x2ec
+	.byte	0x13
+	.long	0x1529
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x10
+	.long	.LASF333
+	.value	0x2f0
+	.byte	0x14
+	.long	0x174
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x34
+	.long	0x2c0d
+	.quad	.LBI39
+	.value	.LVU363
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.value	0x2ed
+	.long	0x1482
+	.uleb128 0xb
+	.long	0x2c35
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xb
+	.long	0x2c29
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xb
+	.long	0x2c1d
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL133
+	.long	0x2b34
+	.long	0x149f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL134
+	.long	0x2b34
+	.long	0x14bc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL136
+	.long	0x2b34
+	.long	0x14da
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL138
+	.long	0x2b34
+	.long	0x14f8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL139
+	.long	0x1539
+	.long	0x151b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL142
+	.long	0x2c6c
+	.byte	0
+	.uleb128 0x14
+	.long	0x59
+	.long	0x1539
+	.uleb128 0x19
+	.long	0x46
+	.byte	0x17
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF386
+	.value	0x2e0
+	.quad	.LFB86
+	.quad	.LFE86-.LFB86
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15c5
+	.uleb128 0xc
+	.long	.LASF375
+	.value	0x2e0
+	.byte	0x25
+	.long	0x10db
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xc
+	.long	.LASF387
+	.value	0x2e0
+	.byte	0x3f
+	.long	0x3e3
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xc
+	.long	.LASF388
+	.value	0x2e1
+	.byte	0x1f
+	.long	0x41
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x5
+	.quad	.LVL127
+	.long	0xca3
+	.long	0x15b7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL128
+	.long	0xec7
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF390
+	.value	0x2c7
+	.quad	.LFB85
+	.quad	.LFE85-.LFB85
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1648
+	.uleb128 0xc
+	.long	.LASF391
+	.value	0x2c7
+	.byte	0x23
+	.long	0x1648
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0xa
+	.quad	.LVL310
+	.long	0xf59
+	.uleb128 0x5
+	.quad	.LVL311
+	.long	0xce0
+	.long	0x161b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL314
+	.long	0xf74
+	.long	0x163a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL315
+	.long	0xeb0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa60
+	.uleb128 0x9
+	.long	0x1648
+	.uleb128 0x23
+	.long	.LASF392
+	.value	0x2b4
+	.byte	0x9
+	.long	0x378
+	.quad	.LFB84
+	.quad	.LFE84-.LFB84
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dec
+	.uleb128 0xc
+	.long	.LASF391
+	.value	0x2b4
+	.byte	0x25
+	.long	0x1648
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xc
+	.long	.LASF376
+	.value	0x2b4
+	.byte	0x44
+	.long	0x1df1
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x10
+	.long	.LASF333
+	.value	0x2c1
+	.byte	0x13
+	.long	0x384
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x1a
+	.long	0x1df6
+	.quad	.LBI70
+	.value	.LVU509
+	.long	.LLRL71
+	.value	0x2c1
+	.byte	0x20
+	.long	0x17e0
+	.uleb128 0xb
+	.long	0x1e12
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xb
+	.long	0x1e06
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x16
+	.long	.LLRL71
+	.uleb128 0x7
+	.long	0x1e1e
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x24
+	.long	0x1e2a
+	.long	.LLRL75
+	.long	0x174f
+	.uleb128 0x7
+	.long	0x1e2f
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x5
+	.quad	.LVL188
+	.long	0x1f00
+	.long	0x172e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL290
+	.long	0x1e55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x1e3c
+	.long	.LLRL77
+	.long	0x179d
+	.uleb128 0x7
+	.long	0x1e3d
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5
+	.quad	.LVL292
+	.long	0xe57
+	.long	0x1788
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL298
+	.long	0x2563
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL191
+	.long	0x1e55
+	.long	0x17c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL294
+	.long	0x1f00
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x10084
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x230b
+	.quad	.LBI80
+	.value	.LVU555
+	.long	.LLRL79
+	.value	0x2b8
+	.byte	0x1a
+	.long	0x1b62
+	.uleb128 0xb
+	.long	0x231b
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x24
+	.long	0x2327
+	.long	.LLRL81
+	.long	0x1a00
+	.uleb128 0x7
+	.long	0x232c
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x7
+	.long	0x2338
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x1a
+	.long	0x2366
+	.quad	.LBI83
+	.value	.LVU566
+	.long	.LLRL84
+	.value	0x16f
+	.byte	0x10
+	.long	0x1896
+	.uleb128 0xb
+	.long	0x2382
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xb
+	.long	0x2376
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x16
+	.long	.LLRL84
+	.uleb128 0x7
+	.long	0x238e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x6
+	.quad	.LVL204
+	.long	0xe20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x239b
+	.quad	.LBI87
+	.value	.LVU604
+	.long	.LLRL88
+	.value	0x171
+	.byte	0x14
+	.uleb128 0xb
+	.long	0x23ab
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x16
+	.long	.LLRL88
+	.uleb128 0x7
+	.long	0x23b7
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x7
+	.long	0x23c3
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x7
+	.long	0x23d0
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x7
+	.long	0x23dc
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x5
+	.quad	.LVL215
+	.long	0xf59
+	.long	0x1910
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL218
+	.long	0xf13
+	.long	0x1936
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL220
+	.long	0xef3
+	.long	0x1953
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL221
+	.long	0x23e9
+	.long	0x196b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL226
+	.long	0xe57
+	.long	0x198a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL228
+	.long	0xec7
+	.uleb128 0xa
+	.quad	.LVL229
+	.long	0xe40
+	.uleb128 0x5
+	.quad	.LVL230
+	.long	0xe57
+	.long	0x19c3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL233
+	.long	0xe57
+	.long	0x19e2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL236
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x2366
+	.quad	.LBI91
+	.value	.LVU584
+	.long	.LLRL94
+	.value	0x17b
+	.byte	0xf
+	.long	0x1a5c
+	.uleb128 0xb
+	.long	0x2382
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xb
+	.long	0x2376
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x16
+	.long	.LLRL94
+	.uleb128 0x7
+	.long	0x238e
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x6
+	.quad	.LVL211
+	.long	0xe20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	0x2345
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.long	0x1a97
+	.uleb128 0x7
+	.long	0x234a
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x6
+	.quad	.LVL212
+	.long	0x2563
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x2366
+	.quad	.LBI99
+	.value	.LVU666
+	.long	.LLRL99
+	.value	0x184
+	.byte	0xa
+	.long	0x1af3
+	.uleb128 0xb
+	.long	0x2382
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0xb
+	.long	0x2376
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x16
+	.long	.LLRL99
+	.uleb128 0x7
+	.long	0x238e
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x6
+	.quad	.LVL241
+	.long	0xe20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	0x2357
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.long	0x1b4d
+	.uleb128 0x7
+	.long	0x2358
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x5
+	.quad	.LVL242
+	.long	0x2563
+	.long	0x1b31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL243
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL245
+	.long	0x23e9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x1fac
+	.quad	.LBI107
+	.value	.LVU708
+	.long	.LLRL104
+	.value	0x2bc
+	.byte	0x10
+	.uleb128 0xb
+	.long	0x1fbc
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x16
+	.long	.LLRL104
+	.uleb128 0x7
+	.long	0x1fc8
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x37
+	.long	0x1fd4
+	.long	.LLRL107
+	.uleb128 0x7
+	.long	0x1fd5
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x7
+	.long	0x1fe1
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x7
+	.long	0x1fed
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x4a
+	.long	0x224e
+	.long	.LLRL111
+	.byte	0x1
+	.value	0x22b
+	.byte	0x1b
+	.long	0x1d7d
+	.uleb128 0x25
+	.long	0x2282
+	.uleb128 0x25
+	.long	0x2276
+	.uleb128 0x25
+	.long	0x226a
+	.uleb128 0x25
+	.long	0x225e
+	.uleb128 0x24
+	.long	0x228e
+	.long	.LLRL112
+	.long	0x1ce5
+	.uleb128 0x7
+	.long	0x2293
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x7
+	.long	0x229f
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x7
+	.long	0x22ab
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x7
+	.long	0x22b7
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x7
+	.long	0x22c3
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x5
+	.quad	.LVL261
+	.long	0xd8e
+	.long	0x1c61
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL263
+	.long	0xf42
+	.long	0x1c78
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL264
+	.long	0x2a19
+	.long	0x1c90
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL265
+	.long	0xec7
+	.uleb128 0xa
+	.quad	.LVL266
+	.long	0xe40
+	.uleb128 0x5
+	.quad	.LVL267
+	.long	0xe57
+	.long	0x1cc9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL268
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.long	0x22d0
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.uleb128 0x7
+	.long	0x22d1
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x7
+	.long	0x22dd
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x7
+	.long	0x22e9
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x5
+	.quad	.LVL273
+	.long	0xd8e
+	.long	0x1d48
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL274
+	.long	0x2563
+	.long	0x1d60
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL283
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0x1ff9
+	.long	.LLRL121
+	.uleb128 0x7
+	.long	0x1ffa
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x5
+	.quad	.LVL255
+	.long	0x2009
+	.long	0x1dcc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0xd
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x10084
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL286
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa56
+	.uleb128 0x9
+	.long	0x1dec
+	.uleb128 0x1b
+	.long	.LASF396
+	.value	0x26e
+	.byte	0x9
+	.long	0x378
+	.long	0x1e4b
+	.uleb128 0x12
+	.long	.LASF391
+	.value	0x26e
+	.byte	0x27
+	.long	0x1648
+	.uleb128 0x12
+	.long	.LASF376
+	.value	0x26e
+	.byte	0x46
+	.long	0x1df1
+	.uleb128 0xd
+	.long	.LASF333
+	.value	0x274
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x26
+	.long	0x1e3c
+	.uleb128 0xd
+	.long	.LASF393
+	.value	0x276
+	.byte	0x24
+	.long	0x1e50
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF374
+	.value	0x293
+	.byte	0x1b
+	.long	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x60
+	.uleb128 0x9
+	.long	0x1e4b
+	.uleb128 0x2e
+	.long	.LASF401
+	.value	0x255
+	.long	0xa4a
+	.quad	.LFB82
+	.quad	.LFE82-.LFB82
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f00
+	.uleb128 0xc
+	.long	.LASF391
+	.value	0x255
+	.byte	0x24
+	.long	0x1648
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xc
+	.long	.LASF376
+	.value	0x255
+	.byte	0x42
+	.long	0xa5b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xc
+	.long	.LASF333
+	.value	0x256
+	.byte	0x26
+	.long	0x41
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x16
+	.long	.LLRL11
+	.uleb128 0x1e
+	.string	"i"
+	.value	0x258
+	.byte	0x11
+	.long	0x35
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x16
+	.long	.LLRL13
+	.uleb128 0x10
+	.long	.LASF394
+	.value	0x259
+	.byte	0x20
+	.long	0xa5b
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.quad	.LVL35
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF395
+	.value	0x247
+	.quad	.LFB81
+	.quad	.LFE81-.LFB81
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fa2
+	.uleb128 0xc
+	.long	.LASF383
+	.value	0x247
+	.byte	0x35
+	.long	0x1e50
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xc
+	.long	.LASF394
+	.value	0x248
+	.byte	0x2b
+	.long	0x1fa7
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.quad	.LVL3
+	.long	0x2b76
+	.long	0x1f5d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL4
+	.long	0x2b76
+	.long	0x1f75
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL5
+	.long	0x2b76
+	.long	0x1f8d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL6
+	.long	0x2b76
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 12
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa39
+	.uleb128 0x9
+	.long	0x1fa2
+	.uleb128 0x1b
+	.long	.LASF397
+	.value	0x225
+	.byte	0x9
+	.long	0x378
+	.long	0x2009
+	.uleb128 0x12
+	.long	.LASF391
+	.value	0x225
+	.byte	0x25
+	.long	0x1648
+	.uleb128 0xd
+	.long	.LASF333
+	.value	0x227
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF398
+	.value	0x229
+	.byte	0x15
+	.long	0x4c9
+	.uleb128 0xd
+	.long	.LASF304
+	.value	0x22a
+	.byte	0x10
+	.long	0x35
+	.uleb128 0xd
+	.long	.LASF399
+	.value	0x22b
+	.byte	0x13
+	.long	0x54
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF400
+	.value	0x233
+	.byte	0x17
+	.long	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF402
+	.value	0x1e4
+	.long	0x4d
+	.quad	.LFB79
+	.quad	.LFE79-.LFB79
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x222e
+	.uleb128 0xc
+	.long	.LASF391
+	.value	0x1e4
+	.byte	0x22
+	.long	0x1648
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xc
+	.long	.LASF398
+	.value	0x1e4
+	.byte	0x3b
+	.long	0x4ce
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xc
+	.long	.LASF304
+	.value	0x1e5
+	.byte	0x23
+	.long	0x41
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xc
+	.long	.LASF394
+	.value	0x1e5
+	.byte	0x3c
+	.long	0x1fa7
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1e
+	.string	"ofs"
+	.value	0x1e7
+	.byte	0xc
+	.long	0x35
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x4c
+	.string	"buf"
+	.byte	0x1
+	.value	0x1f3
+	.byte	0xa
+	.long	0x222e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2c
+	.long	.LASF403
+	.value	0x1f7
+	.byte	0x12
+	.long	0x223e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -348
+	.uleb128 0x10
+	.long	.LASF306
+	.value	0x1f8
+	.byte	0xe
+	.long	0x157
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1e
+	.string	"str"
+	.value	0x1f9
+	.byte	0x11
+	.long	0x4c9
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x4d
+	.long	.LLRL40
+	.long	0x2182
+	.uleb128 0x1e
+	.string	"i"
+	.value	0x1fa
+	.byte	0xe
+	.long	0x4d
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x16
+	.long	.LLRL42
+	.uleb128 0x10
+	.long	.LASF404
+	.value	0x201
+	.byte	0x1b
+	.long	0x4ce
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x5
+	.quad	.LVL96
+	.long	0xd73
+	.long	0x212a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -348
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL101
+	.long	0xd5d
+	.uleb128 0x5
+	.quad	.LVL108
+	.long	0xd13
+	.long	0x215e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL117
+	.long	0xd3d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4e20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -348
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x2c0d
+	.quad	.LBI30
+	.value	.LVU243
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.value	0x1f4
+	.long	0x21f0
+	.uleb128 0xb
+	.long	0x2c35
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xb
+	.long	0x2c29
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0xb
+	.long	0x2c1d
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.quad	.LVL88
+	.long	0x2c75
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL93
+	.long	0xcf3
+	.long	0x2208
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL94
+	.long	0xcf3
+	.long	0x2220
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL120
+	.long	0x2c6c
+	.byte	0
+	.uleb128 0x14
+	.long	0x14b
+	.long	0x223e
+	.uleb128 0x19
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x14
+	.long	0x6c
+	.long	0x224e
+	.uleb128 0x19
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF405
+	.value	0x1a0
+	.byte	0x5
+	.long	0x4d
+	.long	0x22f7
+	.uleb128 0x12
+	.long	.LASF391
+	.value	0x1a0
+	.byte	0x21
+	.long	0x1648
+	.uleb128 0x12
+	.long	.LASF406
+	.value	0x1a0
+	.byte	0x32
+	.long	0xa51
+	.uleb128 0x12
+	.long	.LASF398
+	.value	0x1a1
+	.byte	0x28
+	.long	0x22fc
+	.uleb128 0x12
+	.long	.LASF304
+	.value	0x1a1
+	.byte	0x3c
+	.long	0x2306
+	.uleb128 0x26
+	.long	0x22d0
+	.uleb128 0xd
+	.long	.LASF407
+	.value	0x1a7
+	.byte	0x16
+	.long	0x41
+	.uleb128 0xd
+	.long	.LASF331
+	.value	0x1a8
+	.byte	0x1b
+	.long	0x4ce
+	.uleb128 0xd
+	.long	.LASF408
+	.value	0x1a9
+	.byte	0x16
+	.long	0x41
+	.uleb128 0xd
+	.long	.LASF409
+	.value	0x1aa
+	.byte	0x1b
+	.long	0x4ce
+	.uleb128 0xd
+	.long	.LASF410
+	.value	0x1ab
+	.byte	0x13
+	.long	0xa51
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF331
+	.value	0x1bf
+	.byte	0x1b
+	.long	0x4ce
+	.uleb128 0xd
+	.long	.LASF408
+	.value	0x1c0
+	.byte	0x16
+	.long	0x41
+	.uleb128 0xd
+	.long	.LASF409
+	.value	0x1c1
+	.byte	0x1b
+	.long	0x4ce
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x4c9
+	.uleb128 0x9
+	.long	0x22f7
+	.uleb128 0xe
+	.long	0x35
+	.uleb128 0x9
+	.long	0x2301
+	.uleb128 0x1b
+	.long	.LASF411
+	.value	0x169
+	.byte	0x5
+	.long	0xa4a
+	.long	0x2366
+	.uleb128 0x12
+	.long	.LASF391
+	.value	0x169
+	.byte	0x25
+	.long	0x1648
+	.uleb128 0x26
+	.long	0x2345
+	.uleb128 0xd
+	.long	.LASF407
+	.value	0x16c
+	.byte	0x16
+	.long	0x41
+	.uleb128 0xd
+	.long	.LASF408
+	.value	0x16d
+	.byte	0x16
+	.long	0x41
+	.byte	0
+	.uleb128 0x26
+	.long	0x2357
+	.uleb128 0xd
+	.long	.LASF374
+	.value	0x17d
+	.byte	0x13
+	.long	0x54
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF374
+	.value	0x18a
+	.byte	0x13
+	.long	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF412
+	.value	0x15e
+	.byte	0x5
+	.long	0xa4a
+	.long	0x239b
+	.uleb128 0x12
+	.long	.LASF387
+	.value	0x15e
+	.byte	0x2a
+	.long	0x4ce
+	.uleb128 0x12
+	.long	.LASF388
+	.value	0x15e
+	.byte	0x3d
+	.long	0x41
+	.uleb128 0xd
+	.long	.LASF413
+	.value	0x160
+	.byte	0x12
+	.long	0x41
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF414
+	.value	0x130
+	.byte	0x5
+	.long	0xa4a
+	.long	0x23e9
+	.uleb128 0x12
+	.long	.LASF391
+	.value	0x130
+	.byte	0x22
+	.long	0x1648
+	.uleb128 0xd
+	.long	.LASF415
+	.value	0x135
+	.byte	0x11
+	.long	0x373
+	.uleb128 0x4e
+	.string	"map"
+	.byte	0x1
+	.value	0x13a
+	.byte	0x11
+	.long	0x10c
+	.uleb128 0xd
+	.long	.LASF388
+	.value	0x14a
+	.byte	0x14
+	.long	0x174
+	.uleb128 0xd
+	.long	.LASF393
+	.value	0x14b
+	.byte	0x14
+	.long	0x174
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF416
+	.value	0x114
+	.long	0xa4a
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2563
+	.uleb128 0xc
+	.long	.LASF391
+	.value	0x114
+	.byte	0x24
+	.long	0x1648
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xc
+	.long	.LASF384
+	.value	0x114
+	.byte	0x46
+	.long	0x1e50
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x10
+	.long	.LASF417
+	.value	0x11a
+	.byte	0x14
+	.long	0x163
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x10
+	.long	.LASF418
+	.value	0x11b
+	.byte	0x14
+	.long	0x163
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x5
+	.quad	.LVL41
+	.long	0xe20
+	.long	0x2484
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL42
+	.long	0x2b76
+	.long	0x249c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL44
+	.long	0x2b76
+	.long	0x24b4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 12
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL45
+	.long	0x2b76
+	.long	0x24cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL47
+	.long	0x2b76
+	.long	0x24e4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL52
+	.long	0xe57
+	.long	0x2503
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL55
+	.long	0xe57
+	.long	0x2528
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL57
+	.long	0xf74
+	.long	0x2547
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL58
+	.long	0xf74
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF419
+	.byte	0xf8
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB73
+	.quad	.LFE73-.LFB73
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26b2
+	.uleb128 0x17
+	.long	.LASF391
+	.byte	0xf8
+	.byte	0x21
+	.long	0x1648
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.long	.LASF420
+	.value	0x103
+	.byte	0x13
+	.long	0x384
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1d
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.long	0x262d
+	.uleb128 0x18
+	.long	.LASF408
+	.byte	0xfe
+	.byte	0x16
+	.long	0x41
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x4f
+	.long	0x2bd8
+	.quad	.LBI26
+	.value	.LVU192
+	.long	.LLRL26
+	.byte	0x1
+	.byte	0xff
+	.byte	0x9
+	.uleb128 0xb
+	.long	0x2c00
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xb
+	.long	0x2bf4
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xb
+	.long	0x2be8
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x6
+	.quad	.LVL71
+	.long	0x2c7e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 129
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x2ba3
+	.quad	.LBI21
+	.value	.LVU176
+	.long	.LLRL21
+	.value	0x103
+	.byte	0x1b
+	.long	0x267c
+	.uleb128 0xb
+	.long	0x2bcb
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xb
+	.long	0x2bbf
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xb
+	.long	0x2bb3
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xa
+	.quad	.LVL64
+	.long	0xdfc
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL73
+	.long	0xec7
+	.uleb128 0xa
+	.quad	.LVL74
+	.long	0xe40
+	.uleb128 0x6
+	.quad	.LVL75
+	.long	0xe57
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF421
+	.byte	0x1
+	.byte	0xed
+	.byte	0x6
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2715
+	.uleb128 0x17
+	.long	.LASF391
+	.byte	0xed
+	.byte	0x25
+	.long	0x1648
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x38
+	.string	"bpm"
+	.byte	0xed
+	.byte	0x3f
+	.long	0x73
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x6
+	.quad	.LVL181
+	.long	0xfc7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF422
+	.byte	0xd6
+	.long	0x1648
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x28ae
+	.uleb128 0x17
+	.long	.LASF380
+	.byte	0xd6
+	.byte	0x2f
+	.long	0x4ce
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x17
+	.long	.LASF313
+	.byte	0xd7
+	.byte	0x30
+	.long	0x73
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x17
+	.long	.LASF314
+	.byte	0xd8
+	.byte	0x30
+	.long	0x73
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x3a
+	.string	"fd"
+	.byte	0xde
+	.byte	0xf
+	.long	0x54
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x18
+	.long	.LASF391
+	.byte	0xe2
+	.byte	0x17
+	.long	0x164d
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x1d
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.long	0x27dd
+	.uleb128 0x18
+	.long	.LASF381
+	.byte	0xe5
+	.byte	0x13
+	.long	0x54
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xa
+	.quad	.LVL173
+	.long	0xec7
+	.uleb128 0x6
+	.quad	.LVL176
+	.long	0xeb0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	0x2c42
+	.quad	.LBI42
+	.value	.LVU466
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.byte	0x1
+	.byte	0xde
+	.byte	0x14
+	.long	0x2839
+	.uleb128 0xb
+	.long	0x2c5e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xb
+	.long	0x2c52
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x6
+	.quad	.LVL164
+	.long	0xe69
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL162
+	.long	0xed8
+	.long	0x285e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL166
+	.long	0x28ae
+	.long	0x2888
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL170
+	.long	0x28ae
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF423
+	.byte	0xa8
+	.long	0x1648
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a19
+	.uleb128 0x38
+	.string	"fd"
+	.byte	0xa8
+	.byte	0x29
+	.long	0x54
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x17
+	.long	.LASF380
+	.byte	0xa8
+	.byte	0x3f
+	.long	0x4ce
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x17
+	.long	.LASF313
+	.byte	0xa9
+	.byte	0x32
+	.long	0x73
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x17
+	.long	.LASF314
+	.byte	0xaa
+	.byte	0x32
+	.long	0x73
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x18
+	.long	.LASF391
+	.byte	0xac
+	.byte	0x17
+	.long	0x164d
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x52
+	.string	"sb"
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x11
+	.long	0x3e9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x1d
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.long	0x2994
+	.uleb128 0x18
+	.long	.LASF331
+	.byte	0xc6
+	.byte	0x15
+	.long	0x373
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x5
+	.quad	.LVL156
+	.long	0xf86
+	.long	0x297f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL157
+	.long	0x2a19
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL145
+	.long	0xfdd
+	.long	0x29af
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x10188
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL147
+	.long	0xfc7
+	.long	0x29cd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x78
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL148
+	.long	0xfa7
+	.long	0x29e6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL149
+	.long	0xf74
+	.long	0x2a0b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL159
+	.long	0x2c6c
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF424
+	.byte	0x90
+	.byte	0x5
+	.long	0xa4a
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b34
+	.uleb128 0x17
+	.long	.LASF391
+	.byte	0x90
+	.byte	0x22
+	.long	0x1648
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.long	.LASF425
+	.byte	0x96
+	.byte	0x11
+	.long	0x373
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x18
+	.long	.LASF426
+	.byte	0x97
+	.byte	0x11
+	.long	0x373
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x18
+	.long	.LASF415
+	.byte	0x98
+	.byte	0x11
+	.long	0x373
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x18
+	.long	.LASF388
+	.byte	0x99
+	.byte	0x12
+	.long	0x41
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x3a
+	.string	"map"
+	.byte	0x9b
+	.byte	0x11
+	.long	0x10c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xa
+	.quad	.LVL11
+	.long	0xf59
+	.uleb128 0x5
+	.quad	.LVL12
+	.long	0xf42
+	.long	0x2ad0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL19
+	.long	0xf13
+	.long	0x2afd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL21
+	.long	0xef3
+	.long	0x2b20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL27
+	.long	0xf86
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF427
+	.byte	0x1
+	.byte	0x83
+	.byte	0x6
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b6c
+	.uleb128 0x3b
+	.string	"p"
+	.byte	0x83
+	.byte	0x24
+	.long	0x2b71
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x54
+	.long	.LASF428
+	.byte	0x1
+	.byte	0x83
+	.byte	0x36
+	.long	0x163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0xe
+	.long	0x59
+	.uleb128 0x9
+	.long	0x2b6c
+	.uleb128 0x2f
+	.long	.LASF429
+	.byte	0x7b
+	.byte	0xa
+	.long	0x157
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ba3
+	.uleb128 0x3b
+	.string	"p"
+	.byte	0x7b
+	.byte	0x2e
+	.long	0x1e50
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF353
+	.byte	0x2
+	.byte	0x24
+	.byte	0x1
+	.long	0x378
+	.long	0x2bd8
+	.uleb128 0x13
+	.long	.LASF430
+	.byte	0x2
+	.byte	0x24
+	.byte	0xb
+	.long	0x4d
+	.uleb128 0x13
+	.long	.LASF431
+	.byte	0x2
+	.byte	0x24
+	.byte	0x17
+	.long	0x10a
+	.uleb128 0x13
+	.long	.LASF432
+	.byte	0x2
+	.byte	0x24
+	.byte	0x25
+	.long	0x35
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF433
+	.byte	0x3
+	.byte	0x22
+	.byte	0x2a
+	.long	0x10a
+	.long	0x2c0d
+	.uleb128 0x13
+	.long	.LASF434
+	.byte	0x3
+	.byte	0x22
+	.byte	0x39
+	.long	0x10a
+	.uleb128 0x13
+	.long	.LASF435
+	.byte	0x3
+	.byte	0x22
+	.byte	0x4d
+	.long	0x3d9
+	.uleb128 0x13
+	.long	.LASF436
+	.byte	0x3
+	.byte	0x22
+	.byte	0x5b
+	.long	0x35
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF437
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x2a
+	.long	0x10a
+	.long	0x2c42
+	.uleb128 0x13
+	.long	.LASF434
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x43
+	.long	0x111
+	.uleb128 0x13
+	.long	.LASF435
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x62
+	.long	0x3de
+	.uleb128 0x13
+	.long	.LASF436
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x70
+	.long	0x35
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF359
+	.byte	0x4
+	.byte	0x29
+	.byte	0x1
+	.long	0x4d
+	.long	0x2c6c
+	.uleb128 0x13
+	.long	.LASF438
+	.byte	0x4
+	.byte	0x29
+	.byte	0x13
+	.long	0x4c9
+	.uleb128 0x13
+	.long	.LASF439
+	.byte	0x4
+	.byte	0x29
+	.byte	0x1f
+	.long	0x4d
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF446
+	.long	.LASF446
+	.uleb128 0x3c
+	.long	.LASF440
+	.long	.LASF441
+	.uleb128 0x3c
+	.long	.LASF433
+	.long	.LASF442
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS134:
+	.uleb128 0
+	.uleb128 .LVU992
+	.uleb128 .LVU992
+	.uleb128 .LVU1013
+	.uleb128 .LVU1013
+	.uleb128 .LVU1015
+	.uleb128 .LVU1015
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LFE91-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU997
+	.uleb128 .LVU1002
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL360-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1006
+	.uleb128 .LVU1014
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS130:
+	.uleb128 0
+	.uleb128 .LVU970
+	.uleb128 .LVU970
+	.uleb128 .LVU982
+	.uleb128 .LVU982
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS131:
+	.uleb128 0
+	.uleb128 .LVU970
+	.uleb128 .LVU970
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LFE90-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 0
+	.uleb128 .LVU970
+	.uleb128 .LVU970
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU967
+	.uleb128 .LVU970
+	.uleb128 .LVU970
+	.uleb128 .LVU978
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU946
+	.uleb128 .LVU946
+	.uleb128 .LVU949
+	.uleb128 .LVU949
+	.uleb128 .LVU951
+	.uleb128 .LVU951
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 0
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LFE89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU941
+	.uleb128 .LVU945
+	.uleb128 .LVU945
+	.uleb128 .LVU948
+	.uleb128 .LVU952
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL330-1-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LFE89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU946
+	.uleb128 .LVU948
+	.uleb128 .LVU952
+	.uleb128 .LVU954
+	.uleb128 .LVU954
+	.uleb128 .LVU959
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU956
+	.uleb128 .LVU959
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 .LVU930
+	.uleb128 .LVU930
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU914
+	.uleb128 .LVU920
+	.uleb128 .LVU920
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL320-1-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU363
+	.uleb128 .LVU366
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU363
+	.uleb128 .LVU366
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU363
+	.uleb128 .LVU366
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 .LFE86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 .LFE86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU896
+	.uleb128 .LVU896
+	.uleb128 .LVU906
+	.uleb128 .LVU906
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LFE85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LFE84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU701
+	.uleb128 .LVU701
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LFE84-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU545
+	.uleb128 .LVU550
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU509
+	.uleb128 .LVU545
+	.uleb128 .LVU827
+	.uleb128 .LVU883
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU509
+	.uleb128 .LVU545
+	.uleb128 .LVU827
+	.uleb128 .LVU883
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU515
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU545
+	.uleb128 .LVU827
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU834
+	.uleb128 .LVU834
+	.uleb128 .LVU855
+	.uleb128 .LVU855
+	.uleb128 .LVU856
+	.uleb128 .LVU856
+	.uleb128 .LVU883
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU520
+	.uleb128 .LVU524
+	.uleb128 .LVU827
+	.uleb128 .LVU834
+	.uleb128 .LVU834
+	.uleb128 .LVU842
+	.uleb128 .LVU876
+	.uleb128 .LVU878
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU865
+	.uleb128 .LVU871
+	.uleb128 .LVU878
+	.uleb128 .LVU880
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU555
+	.uleb128 .LVU576
+	.uleb128 .LVU578
+	.uleb128 .LVU704
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU561
+	.uleb128 .LVU573
+	.uleb128 .LVU700
+	.uleb128 .LVU701
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU563
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU573
+	.uleb128 .LVU700
+	.uleb128 .LVU701
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU566
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU573
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU566
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU568
+	.uleb128 .LVU573
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU604
+	.uleb128 .LVU663
+	.uleb128 .LVU701
+	.uleb128 .LVU702
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU610
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU615
+	.uleb128 .LVU641
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU643
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x8
+	.byte	0x74
+	.sleb128 0
+	.byte	0x73
+	.sleb128 104
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 96
+	.byte	0x6
+	.byte	0x73
+	.sleb128 104
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU616
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU641
+	.uleb128 .LVU645
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU663
+	.uleb128 .LVU701
+	.uleb128 .LVU702
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-1-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL228-1-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU633
+	.uleb128 .LVU641
+	.uleb128 .LVU650
+	.uleb128 .LVU657
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL233-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU635
+	.uleb128 .LVU641
+	.uleb128 .LVU650
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU657
+	.uleb128 .LVU659
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU661
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 56
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU584
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU591
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 120
+	.byte	0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU584
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU591
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU586
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU591
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x23
+	.byte	0x71
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x38
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x28
+	.byte	0x73
+	.sleb128 120
+	.byte	0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x38
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU595
+	.uleb128 .LVU600
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU666
+	.uleb128 .LVU670
+	.uleb128 .LVU670
+	.uleb128 .LVU673
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 120
+	.byte	0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU666
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU673
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU668
+	.uleb128 .LVU670
+	.uleb128 .LVU670
+	.uleb128 .LVU673
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x23
+	.byte	0x71
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x38
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x28
+	.byte	0x73
+	.sleb128 120
+	.byte	0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x38
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU684
+	.uleb128 .LVU689
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU708
+	.uleb128 .LVU827
+	.uleb128 .LVU883
+	.uleb128 .LVU885
+	.uleb128 .LVU887
+	.uleb128 .LVU888
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU710
+	.uleb128 .LVU713
+	.uleb128 .LVU732
+	.uleb128 .LVU734
+	.uleb128 .LVU771
+	.uleb128 .LVU775
+	.uleb128 .LVU883
+	.uleb128 .LVU885
+	.uleb128 .LVU887
+	.uleb128 .LVU888
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU714
+	.uleb128 .LVU732
+	.uleb128 .LVU798
+	.uleb128 .LVU806
+	.uleb128 .LVU809
+	.uleb128 .LVU814
+	.uleb128 .LVU818
+	.uleb128 .LVU822
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU716
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU732
+	.uleb128 .LVU801
+	.uleb128 .LVU803
+	.uleb128 .LVU803
+	.uleb128 .LVU806
+	.uleb128 .LVU810
+	.uleb128 .LVU814
+	.uleb128 .LVU818
+	.uleb128 .LVU822
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU721
+	.uleb128 .LVU734
+	.uleb128 .LVU818
+	.uleb128 .LVU822
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU713
+	.uleb128 .LVU721
+	.uleb128 .LVU744
+	.uleb128 .LVU769
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU713
+	.uleb128 .LVU721
+	.uleb128 .LVU746
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU769
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU713
+	.uleb128 .LVU716
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU769
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU713
+	.uleb128 .LVU718
+	.uleb128 .LVU751
+	.uleb128 .LVU758
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL263-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU752
+	.uleb128 .LVU755
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU781
+	.uleb128 .LVU786
+	.uleb128 .LVU786
+	.uleb128 .LVU818
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL273-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL273-1-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU784
+	.uleb128 .LVU786
+	.uleb128 .LVU786
+	.uleb128 .LVU801
+	.uleb128 .LVU801
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU818
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL273-1-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU786
+	.uleb128 .LVU796
+	.uleb128 .LVU797
+	.uleb128 .LVU800
+	.uleb128 .LVU806
+	.uleb128 .LVU815
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU727
+	.uleb128 .LVU732
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE82-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE82-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE82-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE82-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE81-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE81-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU247
+	.uleb128 .LVU331
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU253
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU292
+	.uleb128 .LVU293
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU341
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -356
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -356
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -356
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU254
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU340
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU256
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU341
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU286
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU305
+	.uleb128 .LVU336
+	.uleb128 .LVU337
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU243
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU243
+	.uleb128 .LVU247
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU243
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU247
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU127
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU136
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU181
+	.uleb128 .LVU187
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU191
+	.uleb128 .LVU202
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU192
+	.uleb128 .LVU197
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU192
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU197
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU192
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 129
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 129
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU181
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x7
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU176
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU181
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU176
+	.uleb128 .LVU181
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL162-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL162-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU472
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU480
+	.uleb128 .LVU484
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+	.uleb128 .LVU484
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU491
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU466
+	.uleb128 .LVU472
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU466
+	.uleb128 .LVU472
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU387
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL147-1-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU444
+	.uleb128 .LVU456
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU56
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU67
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU61
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU62
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 96
+	.byte	0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 96
+	.byte	0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU65
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU69
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0
+.LLRL111:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.LLRL112:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL121:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF85:
+	.string	"__glibc_reserved"
+.LASF307:
+	.string	"beep_tone"
+.LASF418:
+	.string	"record_size"
+.LASF281:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF84:
+	.string	"st_ctim"
+.LASF310:
+	.string	"_beep_score"
+.LASF394:
+	.string	"tone"
+.LASF191:
+	.string	"_SC_INT_MAX"
+.LASF392:
+	.string	"beep_score_next"
+.LASF9:
+	.string	"size_t"
+.LASF102:
+	.string	"_SC_MAPPED_FILES"
+.LASF87:
+	.string	"_SC_CHILD_MAX"
+.LASF331:
+	.string	"start"
+.LASF429:
+	.string	"get_le32"
+.LASF88:
+	.string	"_SC_CLK_TCK"
+.LASF80:
+	.string	"st_blksize"
+.LASF81:
+	.string	"st_blocks"
+.LASF120:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF383:
+	.string	"record"
+.LASF23:
+	.string	"__ssize_t"
+.LASF60:
+	.string	"_IO_codecvt"
+.LASF299:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF227:
+	.string	"_SC_DEVICE_IO"
+.LASF375:
+	.string	"writer"
+.LASF403:
+	.string	"values"
+.LASF40:
+	.string	"_IO_save_end"
+.LASF285:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF93:
+	.string	"_SC_JOB_CONTROL"
+.LASF400:
+	.string	"parsed"
+.LASF384:
+	.string	"header"
+.LASF189:
+	.string	"_SC_CHAR_MAX"
+.LASF440:
+	.string	"__memcpy_chk"
+.LASF14:
+	.string	"__gid_t"
+.LASF83:
+	.string	"st_mtim"
+.LASF270:
+	.string	"_SC_TRACE_INHERIT"
+.LASF176:
+	.string	"_SC_XOPEN_VERSION"
+.LASF33:
+	.string	"_IO_write_base"
+.LASF156:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF359:
+	.string	"open"
+.LASF141:
+	.string	"_SC_PII_SOCKET"
+.LASF190:
+	.string	"_SC_CHAR_MIN"
+.LASF411:
+	.string	"score_detect_format"
+.LASF399:
+	.string	"found"
+.LASF49:
+	.string	"_lock"
+.LASF94:
+	.string	"_SC_SAVED_IDS"
+.LASF404:
+	.string	"note_end"
+.LASF198:
+	.string	"_SC_SCHAR_MAX"
+.LASF86:
+	.string	"_SC_ARG_MAX"
+.LASF70:
+	.string	"stat"
+.LASF251:
+	.string	"_SC_TIMEOUTS"
+.LASF38:
+	.string	"_IO_save_base"
+.LASF188:
+	.string	"_SC_CHAR_BIT"
+.LASF109:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF195:
+	.string	"_SC_MB_LEN_MAX"
+.LASF168:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF335:
+	.string	"log_level"
+.LASF352:
+	.string	"__read_alias"
+.LASF305:
+	.string	"delay"
+.LASF142:
+	.string	"_SC_PII_INTERNET"
+.LASF422:
+	.string	"beep_score_open"
+.LASF169:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF381:
+	.string	"saved_errno"
+.LASF42:
+	.string	"_chain"
+.LASF63:
+	.string	"ssize_t"
+.LASF295:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF46:
+	.string	"_cur_column"
+.LASF139:
+	.string	"_SC_PII"
+.LASF111:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF314:
+	.string	"default_delay"
+.LASF12:
+	.string	"__dev_t"
+.LASF438:
+	.string	"__path"
+.LASF374:
+	.string	"result"
+.LASF105:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF382:
+	.string	"beep_score_fcreate"
+.LASF90:
+	.string	"_SC_OPEN_MAX"
+.LASF163:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF240:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF261:
+	.string	"_SC_STREAMS"
+.LASF415:
+	.string	"left"
+.LASF2:
+	.string	"long int"
+.LASF113:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF433:
+	.string	"memmove"
+.LASF231:
+	.string	"_SC_FIFO"
+.LASF228:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF183:
+	.string	"_SC_2_C_VERSION"
+.LASF300:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF59:
+	.string	"_IO_marker"
+.LASF123:
+	.string	"_SC_BC_DIM_MAX"
+.LASF304:
+	.string	"length"
+.LASF332:
+	.string	"error"
+.LASF164:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF289:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF427:
+	.string	"put_le32"
+.LASF203:
+	.string	"_SC_UINT_MAX"
+.LASF264:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF410:
+	.string	"window_is_last"
+.LASF257:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF396:
+	.string	"score_next_binary"
+.LASF7:
+	.string	"signed char"
+.LASF21:
+	.string	"__blksize_t"
+.LASF277:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF65:
+	.string	"_IO_FILE"
+.LASF61:
+	.string	"_IO_wide_data"
+.LASF75:
+	.string	"st_uid"
+.LASF269:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF207:
+	.string	"_SC_NL_LANGMAX"
+.LASF265:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF402:
+	.string	"score_parse_line"
+.LASF208:
+	.string	"_SC_NL_MSGMAX"
+.LASF4:
+	.string	"unsigned char"
+.LASF53:
+	.string	"_freeres_list"
+.LASF151:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF78:
+	.string	"st_rdev"
+.LASF340:
+	.string	"fclose"
+.LASF273:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF391:
+	.string	"score"
+.LASF229:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF196:
+	.string	"_SC_NZERO"
+.LASF185:
+	.string	"_SC_XOPEN_XPG2"
+.LASF186:
+	.string	"_SC_XOPEN_XPG3"
+.LASF187:
+	.string	"_SC_XOPEN_XPG4"
+.LASF204:
+	.string	"_SC_ULONG_MAX"
+.LASF441:
+	.string	"__builtin___memcpy_chk"
+.LASF24:
+	.string	"__syscall_slong_t"
+.LASF308:
+	.string	"_Bool"
+.LASF180:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF420:
+	.string	"bytes"
+.LASF428:
+	.string	"value"
+.LASF192:
+	.string	"_SC_INT_MIN"
+.LASF25:
+	.string	"char"
+.LASF184:
+	.string	"_SC_2_UPE"
+.LASF116:
+	.string	"_SC_PAGESIZE"
+.LASF357:
+	.string	"log_error"
+.LASF235:
+	.string	"_SC_FILE_SYSTEM"
+.LASF351:
+	.string	"__read_chk_warn"
+.LASF444:
+	.string	"_IO_lock_t"
+.LASF401:
+	.string	"score_check_binary"
+.LASF132:
+	.string	"_SC_2_VERSION"
+.LASF380:
+	.string	"filename"
+.LASF445:
+	.string	"__errno_location"
+.LASF130:
+	.string	"_SC_RE_DUP_MAX"
+.LASF393:
+	.string	"records"
+.LASF282:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF16:
+	.string	"__mode_t"
+.LASF306:
+	.string	"flags"
+.LASF135:
+	.string	"_SC_2_FORT_DEV"
+.LASF30:
+	.string	"_IO_read_ptr"
+.LASF344:
+	.string	"beep_tempo_ms"
+.LASF343:
+	.string	"ftell"
+.LASF147:
+	.string	"_SC_IOV_MAX"
+.LASF369:
+	.string	"log_verbose"
+.LASF364:
+	.string	"strcmp"
+.LASF226:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF249:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF366:
+	.string	"mmap"
+.LASF149:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF234:
+	.string	"_SC_FILE_LOCKING"
+.LASF41:
+	.string	"_markers"
+.LASF330:
+	.string	"file"
+.LASF413:
+	.string	"compare"
+.LASF199:
+	.string	"_SC_SCHAR_MIN"
+.LASF146:
+	.string	"_SC_UIO_MAXIOV"
+.LASF345:
+	.string	"parse_duration_value"
+.LASF115:
+	.string	"_SC_VERSION"
+.LASF395:
+	.string	"score_decode_record"
+.LASF424:
+	.string	"score_map_window"
+.LASF316:
+	.string	"format_known"
+.LASF323:
+	.string	"file_size"
+.LASF241:
+	.string	"_SC_SPIN_LOCKS"
+.LASF50:
+	.string	"_offset"
+.LASF275:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF259:
+	.string	"_SC_2_PBS_TRACK"
+.LASF76:
+	.string	"st_gid"
+.LASF288:
+	.string	"_SC_RAW_SOCKETS"
+.LASF154:
+	.string	"_SC_THREADS"
+.LASF155:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF194:
+	.string	"_SC_WORD_BIT"
+.LASF242:
+	.string	"_SC_REGEXP"
+.LASF98:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF131:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF276:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF283:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF162:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF320:
+	.string	"record_number"
+.LASF11:
+	.string	"__uint64_t"
+.LASF3:
+	.string	"long unsigned int"
+.LASF442:
+	.string	"__builtin_memmove"
+.LASF178:
+	.string	"_SC_XOPEN_UNIX"
+.LASF432:
+	.string	"__nbytes"
+.LASF211:
+	.string	"_SC_NL_TEXTMAX"
+.LASF44:
+	.string	"_flags2"
+.LASF148:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF302:
+	.string	"_SC_SIGSTKSZ"
+.LASF79:
+	.string	"st_size"
+.LASF32:
+	.string	"_IO_read_base"
+.LASF290:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF386:
+	.string	"score_write"
+.LASF107:
+	.string	"_SC_SEMAPHORES"
+.LASF398:
+	.string	"line"
+.LASF284:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF389:
+	.string	"beep_score_write"
+.LASF301:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF57:
+	.string	"_unused2"
+.LASF358:
+	.string	"__open_alias"
+.LASF408:
+	.string	"available"
+.LASF237:
+	.string	"_SC_MULTI_PROCESS"
+.LASF171:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF28:
+	.string	"uintptr_t"
+.LASF253:
+	.string	"_SC_USER_GROUPS"
+.LASF138:
+	.string	"_SC_2_LOCALEDEF"
+.LASF313:
+	.string	"default_length"
+.LASF129:
+	.string	"_SC_LINE_MAX"
+.LASF45:
+	.string	"_old_offset"
+.LASF172:
+	.string	"_SC_PHYS_PAGES"
+.LASF217:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF245:
+	.string	"_SC_SIGNALS"
+.LASF371:
+	.string	"fstat"
+.LASF22:
+	.string	"__blkcnt_t"
+.LASF236:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF117:
+	.string	"_SC_RTSIG_MAX"
+.LASF431:
+	.string	"__buf"
+.LASF346:
+	.string	"parse_rounded_value"
+.LASF233:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF15:
+	.string	"__ino_t"
+.LASF254:
+	.string	"_SC_USER_GROUPS_R"
+.LASF177:
+	.string	"_SC_XOPEN_XCU_VERSION"
+.LASF10:
+	.string	"__uint32_t"
+.LASF446:
+	.string	"__stack_chk_fail"
+.LASF140:
+	.string	"_SC_PII_XTI"
+.LASF218:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF64:
+	.string	"long long int"
+.LASF212:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF193:
+	.string	"_SC_LONG_BIT"
+.LASF213:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF35:
+	.string	"_IO_write_end"
+.LASF328:
+	.string	"beep_score_writer"
+.LASF202:
+	.string	"_SC_UCHAR_MAX"
+.LASF376:
+	.string	"tones"
+.LASF232:
+	.string	"_SC_PIPE"
+.LASF252:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF158:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF216:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF161:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF219:
+	.string	"_SC_ADVISORY_INFO"
+.LASF355:
+	.string	"strerror"
+.LASF443:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF377:
+	.string	"count"
+.LASF353:
+	.string	"read"
+.LASF36:
+	.string	"_IO_buf_base"
+.LASF6:
+	.string	"unsigned int"
+.LASF362:
+	.string	"__open_too_many_args"
+.LASF419:
+	.string	"score_read_more"
+.LASF126:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF152:
+	.string	"_SC_PII_OSI_M"
+.LASF134:
+	.string	"_SC_2_C_DEV"
+.LASF77:
+	.string	"__pad0"
+.LASF339:
+	.string	"fseek"
+.LASF55:
+	.string	"__pad5"
+.LASF250:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF309:
+	.string	"beep_score"
+.LASF294:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF430:
+	.string	"__fd"
+.LASF205:
+	.string	"_SC_USHRT_MAX"
+.LASF378:
+	.string	"beep_score_finish"
+.LASF287:
+	.string	"_SC_IPV6"
+.LASF267:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF125:
+	.string	"_SC_BC_STRING_MAX"
+.LASF406:
+	.string	"may_block"
+.LASF166:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF29:
+	.string	"_flags"
+.LASF426:
+	.string	"offset"
+.LASF388:
+	.string	"size"
+.LASF56:
+	.string	"_mode"
+.LASF349:
+	.string	"memchr"
+.LASF368:
+	.string	"munmap"
+.LASF51:
+	.string	"_codecvt"
+.LASF137:
+	.string	"_SC_2_SW_DEV"
+.LASF73:
+	.string	"st_nlink"
+.LASF62:
+	.string	"off_t"
+.LASF95:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF315:
+	.string	"tempo"
+.LASF350:
+	.string	"__read_chk"
+.LASF215:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF256:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF160:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF271:
+	.string	"_SC_TRACE_LOG"
+.LASF103:
+	.string	"_SC_MEMLOCK"
+.LASF143:
+	.string	"_SC_PII_OSI"
+.LASF370:
+	.string	"lseek"
+.LASF112:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF136:
+	.string	"_SC_2_FORT_RUN"
+.LASF291:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF170:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF200:
+	.string	"_SC_SHRT_MAX"
+.LASF58:
+	.string	"FILE"
+.LASF110:
+	.string	"_SC_AIO_MAX"
+.LASF220:
+	.string	"_SC_BARRIERS"
+.LASF243:
+	.string	"_SC_REGEX_VERSION"
+.LASF280:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF71:
+	.string	"st_dev"
+.LASF66:
+	.string	"timespec"
+.LASF325:
+	.string	"buf_start"
+.LASF108:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF397:
+	.string	"score_next_text"
+.LASF390:
+	.string	"beep_score_close"
+.LASF318:
+	.string	"binary"
+.LASF347:
+	.string	"beep_note_freq_hz"
+.LASF214:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF69:
+	.string	"long long unsigned int"
+.LASF329:
+	.string	"_beep_score_writer"
+.LASF292:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF412:
+	.string	"score_magic_prefix"
+.LASF206:
+	.string	"_SC_NL_ARGMAX"
+.LASF18:
+	.string	"__off_t"
+.LASF238:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF333:
+	.string	"tone_count"
+.LASF173:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF181:
+	.string	"_SC_XOPEN_SHM"
+.LASF248:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF54:
+	.string	"_freeres_buf"
+.LASF293:
+	.string	"_SC_SS_REPL_MAX"
+.LASF416:
+	.string	"score_parse_header"
+.LASF324:
+	.string	"file_pos"
+.LASF209:
+	.string	"_SC_NL_NMAX"
+.LASF20:
+	.string	"__time_t"
+.LASF361:
+	.string	"__open_missing_mode"
+.LASF417:
+	.string	"version"
+.LASF348:
+	.string	"parse_note_value"
+.LASF39:
+	.string	"_IO_backup_base"
+.LASF48:
+	.string	"_shortbuf"
+.LASF258:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF118:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF153:
+	.string	"_SC_T_IOV_MAX"
+.LASF99:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF373:
+	.string	"malloc"
+.LASF19:
+	.string	"__off64_t"
+.LASF263:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF91:
+	.string	"_SC_STREAM_MAX"
+.LASF341:
+	.string	"fopen"
+.LASF92:
+	.string	"_SC_TZNAME_MAX"
+.LASF354:
+	.string	"memcmp"
+.LASF262:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF246:
+	.string	"_SC_SPAWN"
+.LASF104:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF124:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF360:
+	.string	"__open_2"
+.LASF367:
+	.string	"sysconf"
+.LASF296:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF260:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF37:
+	.string	"_IO_buf_end"
+.LASF182:
+	.string	"_SC_2_CHAR_TERM"
+.LASF244:
+	.string	"_SC_SHELL"
+.LASF230:
+	.string	"_SC_FD_MGMT"
+.LASF179:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF274:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF223:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF311:
+	.string	"name"
+.LASF297:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF326:
+	.string	"buf_end"
+.LASF121:
+	.string	"_SC_TIMER_MAX"
+.LASF435:
+	.string	"__src"
+.LASF255:
+	.string	"_SC_2_PBS"
+.LASF225:
+	.string	"_SC_CPUTIME"
+.LASF247:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF8:
+	.string	"short int"
+.LASF224:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF27:
+	.string	"uint64_t"
+.LASF372:
+	.string	"beep_tempo_init"
+.LASF312:
+	.string	"line_number"
+.LASF239:
+	.string	"_SC_NETWORKING"
+.LASF423:
+	.string	"beep_score_fdopen"
+.LASF286:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF68:
+	.string	"tv_nsec"
+.LASF174:
+	.string	"_SC_ATEXIT_MAX"
+.LASF150:
+	.string	"_SC_PII_OSI_COTS"
+.LASF114:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF47:
+	.string	"_vtable_offset"
+.LASF327:
+	.string	"lookahead"
+.LASF119:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF222:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF365:
+	.string	"madvise"
+.LASF97:
+	.string	"_SC_TIMERS"
+.LASF175:
+	.string	"_SC_PASS_MAX"
+.LASF101:
+	.string	"_SC_FSYNC"
+.LASF434:
+	.string	"__dest"
+.LASF145:
+	.string	"_SC_SELECT"
+.LASF407:
+	.string	"window_pos"
+.LASF159:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF385:
+	.string	"score_write_header"
+.LASF322:
+	.string	"map_size"
+.LASF439:
+	.string	"__oflag"
+.LASF144:
+	.string	"_SC_POLL"
+.LASF437:
+	.string	"memcpy"
+.LASF74:
+	.string	"st_mode"
+.LASF13:
+	.string	"__uid_t"
+.LASF106:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF31:
+	.string	"_IO_read_end"
+.LASF279:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF122:
+	.string	"_SC_BC_BASE_MAX"
+.LASF278:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF128:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF100:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF379:
+	.string	"beep_score_create"
+.LASF26:
+	.string	"uint32_t"
+.LASF319:
+	.string	"tones_left"
+.LASF43:
+	.string	"_fileno"
+.LASF298:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF201:
+	.string	"_SC_SHRT_MIN"
+.LASF52:
+	.string	"_wide_data"
+.LASF89:
+	.string	"_SC_NGROUPS_MAX"
+.LASF266:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF356:
+	.string	"free"
+.LASF425:
+	.string	"page_size"
+.LASF321:
+	.string	"map_offset"
+.LASF303:
+	.string	"freq"
+.LASF5:
+	.string	"short unsigned int"
+.LASF334:
+	.string	"stdout"
+.LASF272:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF421:
+	.string	"beep_score_set_bpm"
+.LASF127:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF34:
+	.string	"_IO_write_ptr"
+.LASF221:
+	.string	"_SC_BASE"
+.LASF96:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF197:
+	.string	"_SC_SSIZE_MAX"
+.LASF157:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF72:
+	.string	"st_ino"
+.LASF317:
+	.string	"failed"
+.LASF167:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF17:
+	.string	"__nlink_t"
+.LASF436:
+	.string	"__len"
+.LASF337:
+	.string	"beep_tempo"
+.LASF268:
+	.string	"_SC_TRACE"
+.LASF387:
+	.string	"data"
+.LASF363:
+	.string	"close"
+.LASF336:
+	.string	"remainder"
+.LASF338:
+	.string	"fflush"
+.LASF210:
+	.string	"_SC_NL_SETMAX"
+.LASF67:
+	.string	"tv_sec"
+.LASF342:
+	.string	"fwrite"
+.LASF414:
+	.string	"score_map_binary"
+.LASF133:
+	.string	"_SC_2_C_BIND"
+.LASF409:
+	.string	"newline"
+.LASF82:
+	.string	"st_atim"
+.LASF405:
+	.string	"score_next_line"
+.LASF165:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-score.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,553 @@
+/* beep-sequence-cache.c - cache compiled command lines across invocations
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Scripts call beep with the same long command lines over and over.
+ *
+ * The tones of a command line with at least
+ * BEEP_SEQUENCE_CACHE_MIN_ARGS arguments and nothing but tone,
+ * --device and --verbose options are compiled into a binary score in
+ * $XDG_CACHE_HOME/beep/ (or ~/.cache/beep/).  The next beep with the
+ * very same command line plays that score without parsing the command
+ * line at all.
+ *
+ * The key is argv[1] to argv[argc-1], each with its terminating NUL.
+ * The file is named after a 64bit hash of the key, and starts with
+ * the key itself, so that hash collisions are just misses:
+ *
+ *   offset  size
+ *        0     8  magic "BEEPARGS"
+ *        8     4  cache format version
+ *       12     4  score format version
+ *       16     4  key size
+ *       20     4  log level
+ *       24     4  number of --device options
+ *       28    64  argv index of each --device argument
+ *       92    64  offset of each --device argument in its argv element
+ *      156     4  hash of the beep version
+ *      160        key, padded with NULs to a multiple of 8 bytes
+ *                 binary score (see beep-score.h)
+ *
+ * An entry holds the tones as a given beep version parsed the command
+ * line, so entries written by other beep versions are never used.
+ *
+ * The numbers in this header are in host byte order.  The padding
+ * keeps the tone records aligned, so they are played right from the
+ * mapped file.
+ *
+ * The tones are frequencies in Hz, as everywhere else.  Each driver
+ * turns them into its divisor or period with a single division per
+ * tone, so cache entries do not depend on the driver.
+ *
+ * Every command line leaves its own entry, so whenever an entry is
+ * written, entries older than BEEP_SEQUENCE_CACHE_MAX_AGE are removed,
+ * and then the oldest ones beyond BEEP_SEQUENCE_CACHE_MAX_ENTRIES.
+ * Entries which are played are not touched, so a frequently used
+ * entry may be removed and written again once a month.
+ */
+
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <dirent.h>
+#include <time.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "beep-sequence-cache.h"
+
+#include "beep-log.h"
+
+
+#define SEQUENCE_CACHE_MAGIC   "BEEPARGS"
+#define SEQUENCE_CACHE_VERSION 2
+
+
+/* The score of a cache entry keeps pointing to cache_name.  New
+ * entries are written to tmp_name and rename(2)d into place, so that
+ * concurrent beeps never read a partially written entry.
+ */
+static char cache_name[PATH_MAX];
+static char tmp_name[PATH_MAX + 32];
+
+
+typedef struct {
+    char     magic[8];
+    uint32_t cache_version;
+    uint32_t score_version;
+    uint32_t key_size;
+    uint32_t log_level;
+    uint32_t device_count;
+    uint32_t device_arg[BEEP_SEQUENCE_CACHE_MAX_DEVICES];
+    uint32_t device_offset[BEEP_SEQUENCE_CACHE_MAX_DEVICES];
+    uint32_t package_hash;
+} sequence_cache_header;
+
+
+/* The score after the header and padded key must stay aligned */
+typedef char sequence_cache_header_size_check[
+    (sizeof(sequence_cache_header) == 160) ? 1 : -1];
+
+
+static
+bool sequence_cache_dir(char *const buf, const size_t size)
+{
+    const char *const cache_home = getenv("XDG_CACHE_HOME");
+    int len;
+    if (cache_home && (cache_home[0] == '/')) {
+        len = snprintf(buf, size, "%s/%s",
+                       cache_home, BEEP_SEQUENCE_CACHE_NAME);
+    } else {
+        const char *const home = getenv("HOME");
+        if ((!home) || (home[0] != '/')) {
+            return false;
+        }
+        len = snprintf(buf, size, "%s/.cache/%s",
+                       home, BEEP_SEQUENCE_CACHE_NAME);
+    }
+    return (len > 0) && ((size_t)len < size);
+}
+
+
+/* The key of this command line, found by sequence_cache_file_name() */
+static const char *key = NULL;
+static size_t      key_size = 0;
+
+
+/* FNV-1a, but 8 bytes at a time instead of bytewise.  Counts the NUL
+ * bytes in data on the way.
+ */
+static
+uint64_t sequence_cache_hash(const char *const data, const size_t size,
+                             size_t *const nul_count)
+{
+    const uint64_t low7 = 0x7f7f7f7f7f7f7f7fU;
+    uint64_t hash = 0xcbf29ce484222325U;
+    size_t count = 0;
+    size_t i = 0;
+    for (; (i + 8) <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, &data[i], 8);
+        hash ^= word;
+        hash *= 0x100000001b3U;
+        /* High bit set in each byte which is 0 */
+        const uint64_t zero = ~(((word & low7) + low7) | word | low7);
+        count += (size_t)__builtin_popcountll(zero);
+    }
+    for (; i < size; ++i) {
+        hash ^= (unsigned char)data[i];
+        hash *= 0x100000001b3U;
+        count += (data[i] == '\0');
+    }
+    *nul_count = count;
+    return hash;
+}
+
+
+/* execve(2) copies the arguments one after the other, so argv[1] to
+ * argv[argc-1] usually are the key already.  That is the case if each
+ * argument directly follows a NUL and the block holds exactly one
+ * NUL per argument.  This avoids thousands of strlen(3) calls and
+ * copying the whole command line.
+ */
+static
+bool contiguous_key(const int argc, char *const argv[], uint64_t *const hash)
+{
+    for (int i=2; i<argc; ++i) {
+        if ((argv[i] <= argv[i-1]) || (argv[i][-1] != '\0')) {
+            return false;
+        }
+    }
+    const char *const end = argv[argc-1] + strlen(argv[argc-1]) + 1;
+    const size_t size = (size_t)(end - argv[1]);
+    size_t nul_count;
+    *hash = sequence_cache_hash(argv[1], size, &nul_count);
+    if (nul_count != (size_t)(argc - 1)) {
+        return false;
+    }
+    key      = argv[1];
+    key_size = size;
+    return true;
+}
+
+
+static
+bool copied_key(const int argc, char *const argv[], uint64_t *const hash)
+{
+    size_t size = 0;
+    for (int i=1; i<argc; ++i) {
+        size += strlen(argv[i]) + 1;
+    }
+    char *const copy = malloc(size);
+    if (!copy) {
+        return false;
+    }
+    char *p = copy;
+    for (int i=1; i<argc; ++i) {
+        const size_t len = strlen(argv[i]) + 1;
+        memcpy(p, argv[i], len);
+        p += len;
+    }
+    size_t nul_count;
+    *hash    = sequence_cache_hash(copy, size, &nul_count);
+    key      = copy;
+    key_size = size;
+    return true;
+}
+
+
+static
+uint32_t package_hash(void)
+{
+    size_t nul_count;
+    return (uint32_t)sequence_cache_hash(PACKAGE_VERSION,
+                                         sizeof(PACKAGE_VERSION), &nul_count);
+}
+
+
+/* Build the key and from its hash, the cache file name, once */
+static
+bool sequence_cache_file_name(const int argc, char *const argv[])
+{
+    if (cache_name[0] != '\0') {
+        return true;
+    }
+    char dir[PATH_MAX];
+    if (!sequence_cache_dir(dir, sizeof(dir))) {
+        return false;
+    }
+
+    uint64_t hash;
+    if ((!contiguous_key(argc, argv, &hash))
+        && (!copied_key(argc, argv, &hash))) {
+        return false;
+    }
+
+    const int len = snprintf(cache_name, sizeof(cache_name), "%s/%016llx",
+                             dir, (unsigned long long)hash);
+    if ((len <= 0) || ((size_t)len >= sizeof(cache_name))) {
+        cache_name[0] = '\0';
+        return false;
+    }
+    return true;
+}
+
+
+static
+size_t padded_key_size(const size_t key_size)
+{
+    return (key_size + 7) & ~(size_t)7;
+}
+
+
+/* Check the header and key of a cache entry, and seek to its score */
+static
+bool sequence_cache_check(const int fd, const int argc, char *const argv[],
+                          beep_sequence_settings *const settings)
+{
+    sequence_cache_header header;
+    if (((ssize_t)sizeof(header) != read(fd, &header, sizeof(header)))
+        || (0 != memcmp(header.magic, SEQUENCE_CACHE_MAGIC, 8))
+        || (header.cache_version != SEQUENCE_CACHE_VERSION)
+        || (header.score_version != BEEP_SCORE_VERSION)
+        || (header.package_hash != package_hash())
+        || (header.key_size != key_size)
+        || (header.device_count > BEEP_SEQUENCE_CACHE_MAX_DEVICES)) {
+        return false;
+    }
+
+    /* Compare the key in the mapped file, which costs fewer page
+     * faults than reading it into a buffer.
+     */
+    const size_t map_size = sizeof(header) + key_size;
+    struct stat sb;
+    if ((0 != fstat(fd, &sb)) || ((off_t)map_size > sb.st_size)) {
+        return false;
+    }
+    const char *const map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    const bool same_key = (0 == memcmp(&map[sizeof(header)], key, key_size));
+    munmap((void *)map, map_size);
+    if (!same_key) {
+        return false;
+    }
+
+    settings->log_level    = (int)header.log_level;
+    settings->device_count = header.device_count;
+    for (size_t i=0; i<header.device_count; ++i) {
+        const uint32_t arg = header.device_arg[i];
+        if ((arg == 0) || (arg >= (uint32_t)argc)
+            || (header.device_offset[i] > strlen(argv[arg]))) {
+            return false;
+        }
+        settings->device_arg[i]    = arg;
+        settings->device_offset[i] = header.device_offset[i];
+    }
+
+    const off_t score_offset =
+        (off_t)(sizeof(header) + padded_key_size(key_size));
+    return (score_offset == lseek(fd, score_offset, SEEK_SET));
+}
+
+
+beep_score *beep_sequence_cache_open(const int argc, char *const argv[],
+                                     beep_sequence_settings *const settings)
+{
+    if (!sequence_cache_file_name(argc, argv)) {
+        return NULL;
+    }
+
+    const int fd = open(cache_name, O_RDONLY|O_CLOEXEC);
+    if (fd == -1) {
+        log_verbose("sequence cache: could not open(2) %s: %s",
+                    cache_name, strerror(errno));
+        return NULL;
+    }
+    if (!sequence_cache_check(fd, argc, argv, settings)) {
+        log_verbose("sequence cache: %s is not for this command line",
+                    cache_name);
+        close(fd);
+        return NULL;
+    }
+    beep_score *const score = beep_score_fdopen(fd, cache_name, 0, 0);
+    if (!score) {
+        close(fd);
+        return NULL;
+    }
+    log_verbose("sequence cache: using %s", cache_name);
+    return score;
+}
+
+
+/* Create the cache directory, and its parent directory if necessary */
+static
+bool sequence_cache_mkdir(char *const dir)
+{
+    if ((0 == mkdir(dir, 0700)) || (errno == EEXIST)) {
+        return true;
+    }
+    char *const slash = strrchr(dir, '/');
+    if ((errno != ENOENT) || (!slash) || (slash == dir)) {
+        return false;
+    }
+    *slash = '\0';
+    const bool parent_ok = ((0 == mkdir(dir, 0700)) || (errno == EEXIST));
+    *slash = '/';
+    return parent_ok && (0 == mkdir(dir, 0700));
+}
+
+
+beep_score_writer *beep_sequence_cache_create(
+    const int argc, char *const argv[],
+    const beep_sequence_settings *const settings)
+{
+    char dir[PATH_MAX];
+    if ((!sequence_cache_dir(dir, sizeof(dir)))
+        || (!sequence_cache_file_name(argc, argv))
+        || (key_size > UINT32_MAX)
+        || (settings->device_count > BEEP_SEQUENCE_CACHE_MAX_DEVICES)) {
+        return NULL;
+    }
+    if (!sequence_cache_mkdir(dir)) {
+        log_verbose("sequence cache: could not mkdir(2) %s: %s",
+                    dir, strerror(errno));
+        return NULL;
+    }
+
+    snprintf(tmp_name, sizeof(tmp_name), "%s.%ld",
+             cache_name, (long)getpid());
+    const int fd = open(tmp_name, O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC, 0600);
+    if (fd == -1) {
+        log_verbose("sequence cache: could not open(2) %s: %s",
+                    tmp_name, strerror(errno));
+        return NULL;
+    }
+    FILE *const file = fdopen(fd, "wb");
+    if (!file) {
+        close(fd);
+        unlink(tmp_name);
+        return NULL;
+    }
+
+    sequence_cache_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SEQUENCE_CACHE_MAGIC, 8);
+    header.cache_version = SEQUENCE_CACHE_VERSION;
+    header.score_version = BEEP_SCORE_VERSION;
+    header.key_size      = (uint32_t)key_size;
+    header.package_hash  = package_hash();
+    header.log_level     = (uint32_t)settings->log_level;
+    header.device_count  = (uint32_t)settings->device_count;
+    for (size_t i=0; i<settings->device_count; ++i) {
+        header.device_arg[i]    = settings->device_arg[i];
+        header.device_offset[i] = settings->device_offset[i];
+    }
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(key, key_size, 1, file);
+    static const char padding[8] = { 0 };
+    fwrite(padding, padded_key_size(key_size) - key_size, 1, file);
+
+    beep_score_writer *const writer =
+        ferror(file) ? NULL : beep_score_fcreate(file);
+    if (!writer) {
+        log_verbose("sequence cache: could not write %s", tmp_name);
+        fclose(file);
+        unlink(tmp_name);
+    }
+    return writer;
+}
+
+
+/* Whether name is that of a cache entry (with suffix '\0') or of an
+ * entry being written (with suffix '.', followed by the PID).
+ */
+static
+bool is_entry_name(const char *const name, const char suffix)
+{
+    for (size_t i=0; i<16; ++i) {
+        const char c = name[i];
+        if (!(((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'f')))) {
+            return false;
+        }
+    }
+    return (name[16] == suffix);
+}
+
+
+typedef struct {
+    time_t mtime;
+    char   name[17];
+} cache_entry;
+
+
+static
+int compare_entry_age(const void *a, const void *b)
+{
+    const time_t mtime_a = ((const cache_entry *)a)->mtime;
+    const time_t mtime_b = ((const cache_entry *)b)->mtime;
+    return (mtime_a > mtime_b) - (mtime_a < mtime_b);
+}
+
+
+/* Keep the cache directory from growing without bounds: remove the
+ * entries which are too old in one scan of the directory, and then
+ * the oldest ones beyond BEEP_SEQUENCE_CACHE_MAX_ENTRIES.
+ */
+static
+void sequence_cache_prune(void)
+{
+    char dir_name[PATH_MAX];
+    snprintf(dir_name, sizeof(dir_name), "%s", cache_name);
+    char *const slash = strrchr(dir_name, '/');
+    if (!slash) {
+        return;
+    }
+    *slash = '\0';
+    const int dir_fd = open(dir_name, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+    if (dir_fd == -1) {
+        return;
+    }
+    DIR *const dir = fdopendir(dir_fd);
+    if (!dir) {
+        close(dir_fd);
+        return;
+    }
+
+    const time_t now = time(NULL);
+    cache_entry *entries = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+    struct dirent *dirent;
+    while (NULL != (dirent = readdir(dir))) {
+        struct stat sb;
+        const bool is_entry = is_entry_name(dirent->d_name, '\0');
+        if (((!is_entry) && (!is_entry_name(dirent->d_name, '.')))
+            || (0 != fstatat(dir_fd, dirent->d_name, &sb, AT_SYMLINK_NOFOLLOW))
+            || (!S_ISREG(sb.st_mode))) {
+            continue;
+        }
+        /* Entries being written are only removed when left behind
+         * by a beep which has died long ago.
+         */
+        if ((now - sb.st_mtime) > BEEP_SEQUENCE_CACHE_MAX_AGE) {
+            log_verbose("sequence cache: removing old %s", dirent->d_name);
+            unlinkat(dir_fd, dirent->d_name, 0);
+            continue;
+        }
+        if (!is_entry) {
+            continue;
+        }
+        if (count == capacity) {
+            capacity = capacity ? (2 * capacity)
+                : (2 * BEEP_SEQUENCE_CACHE_MAX_ENTRIES);
+            cache_entry *const grown =
+                realloc(entries, capacity * sizeof(cache_entry));
+            if (!grown) {
+                break;
+            }
+            entries = grown;
+        }
+        entries[count].mtime = sb.st_mtime;
+        memcpy(entries[count].name, dirent->d_name, sizeof(entries[count].name));
+        ++count;
+    }
+
+    if (count > BEEP_SEQUENCE_CACHE_MAX_ENTRIES) {
+        qsort(entries, count, sizeof(cache_entry), compare_entry_age);
+        for (size_t i=0; i<(count - BEEP_SEQUENCE_CACHE_MAX_ENTRIES); ++i) {
+            log_verbose("sequence cache: removing %s", entries[i].name);
+            unlinkat(dir_fd, entries[i].name, 0);
+        }
+    }
+    free(entries);
+    closedir(dir);
+}
+
+
+bool beep_sequence_cache_commit(beep_score_writer *writer)
+{
+    if ((!beep_score_finish(writer)) || (-1 == rename(tmp_name, cache_name))) {
+        log_verbose("sequence cache: could not write %s: %s",
+                    cache_name, strerror(errno));
+        unlink(tmp_name);
+        return false;
+    }
+    log_verbose("sequence cache: stored %s", cache_name);
+    sequence_cache_prune();
+    return true;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,92 @@
+/* beep-sequence-cache.h - interface to the cache of compiled command lines
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_SEQUENCE_CACHE_H
+#define BEEP_SEQUENCE_CACHE_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "beep-score.h"
+
+
+/** Name of the cache directory in $XDG_CACHE_HOME */
+#define BEEP_SEQUENCE_CACHE_NAME "beep"
+
+/** Shorter command lines are parsed faster than a cache entry is found */
+#define BEEP_SEQUENCE_CACHE_MIN_ARGS 64
+
+/** Most --device options a cache entry can keep */
+#define BEEP_SEQUENCE_CACHE_MAX_DEVICES 16
+
+/** Most cache entries kept, the oldest ones being removed first */
+#define BEEP_SEQUENCE_CACHE_MAX_ENTRIES 256
+
+/** Cache entries not written for this many seconds are removed */
+#define BEEP_SEQUENCE_CACHE_MAX_AGE (30L * 24 * 60 * 60)
+
+
+/** The options besides the tones which a cache entry keeps.  Device
+ * names are kept as the argv index and offset of the option argument.
+ */
+typedef struct {
+    int      log_level;
+    size_t   device_count;
+    uint32_t device_arg[BEEP_SEQUENCE_CACHE_MAX_DEVICES];
+    uint32_t device_offset[BEEP_SEQUENCE_CACHE_MAX_DEVICES];
+} beep_sequence_settings;
+
+
+/** Open the tones cached for this very command line as a score, and
+ * fill in settings.
+ *
+ * Returns NULL if there is no such cache entry, or if it has been
+ * written by a different cache or score format version.
+ */
+beep_score *beep_sequence_cache_open(const int argc, char *const argv[],
+                                     beep_sequence_settings *const settings)
+    __attribute__(( nonnull(2, 3) ));
+
+/** Start a cache entry for this command line.
+ *
+ * The tones written to the returned score writer only become the
+ * cache entry with beep_sequence_cache_commit().  Returns NULL if
+ * there is no cache directory.
+ */
+beep_score_writer *beep_sequence_cache_create(
+    const int argc, char *const argv[],
+    const beep_sequence_settings *const settings)
+    __attribute__(( nonnull(2, 3) ));
+
+/** Finish the cache entry started by beep_sequence_cache_create(). */
+bool beep_sequence_cache_commit(beep_score_writer *writer)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_SEQUENCE_CACHE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
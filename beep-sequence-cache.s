@@ -0,0 +1,11303 @@
+	.file	"beep-sequence-cache.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-sequence-cache.c"
+	.type	is_entry_name, @function
+is_entry_name:
+.LVL0:
+.LFB78:
+	.file 1 "beep-sequence-cache.c"
+	.loc 1 433 1 view -0
+	.cfi_startproc
+	.loc 1 434 5 view .LVU1
+.LBB41:
+	.loc 1 434 10 view .LVU2
+	.loc 1 434 23 view .LVU3
+	movq	%rdi, %rax
+	leaq	16(%rdi), %r8
+	jmp	.L4
+.LVL1:
+.L6:
+	.loc 1 434 28 discriminator 2 view .LVU4
+	.loc 1 434 23 discriminator 2 view .LVU5
+	addq	$1, %rax
+.LVL2:
+	.loc 1 434 23 is_stmt 0 discriminator 2 view .LVU6
+	cmpq	%r8, %rax
+	je	.L8
+.LVL3:
+.L4:
+.LBB42:
+	.loc 1 435 9 is_stmt 1 view .LVU7
+	.loc 1 436 9 view .LVU8
+	.loc 1 436 27 is_stmt 0 view .LVU9
+	movzbl	(%rax), %edx
+	leal	-48(%rdx), %ecx
+	.loc 1 436 12 view .LVU10
+	cmpb	$9, %cl
+	jbe	.L6
+	.loc 1 436 57 view .LVU11
+	subl	$97, %edx
+	.loc 1 436 12 view .LVU12
+	cmpb	$5, %dl
+	jbe	.L6
+	.loc 1 437 19 view .LVU13
+	movl	$0, %eax
+.LVL4:
+	.loc 1 437 19 view .LVU14
+.LBE42:
+.LBE41:
+	.loc 1 441 1 view .LVU15
+	ret
+.LVL5:
+.L8:
+	.loc 1 440 5 is_stmt 1 view .LVU16
+	.loc 1 440 22 is_stmt 0 view .LVU17
+	cmpb	%sil, 16(%rdi)
+	sete	%al
+.LVL6:
+	.loc 1 440 22 view .LVU18
+	ret
+	.cfi_endproc
+.LFE78:
+	.size	is_entry_name, .-is_entry_name
+	.type	compare_entry_age, @function
+compare_entry_age:
+.LVL7:
+.LFB79:
+	.loc 1 452 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 452 1 is_stmt 0 view .LVU20
+	endbr64
+	.loc 1 453 5 is_stmt 1 view .LVU21
+.LVL8:
+	.loc 1 454 5 view .LVU22
+	.loc 1 455 5 view .LVU23
+	.loc 1 455 21 is_stmt 0 view .LVU24
+	movq	(%rsi), %rax
+	cmpq	%rax, (%rdi)
+	setg	%al
+	movzbl	%al, %eax
+	.loc 1 455 43 view .LVU25
+	setl	%dl
+	movzbl	%dl, %edx
+	.loc 1 455 32 view .LVU26
+	subl	%edx, %eax
+	.loc 1 456 1 view .LVU27
+	ret
+	.cfi_endproc
+.LFE79:
+	.size	compare_entry_age, .-compare_entry_age
+	.globl	__popcountdi2
+	.type	sequence_cache_hash, @function
+sequence_cache_hash:
+.LVL9:
+.LFB68:
+	.loc 1 148 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 148 1 is_stmt 0 view .LVU29
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %r14
+	movq	%rsi, %r15
+	movq	%rdx, 8(%rsp)
+	.loc 1 149 5 is_stmt 1 view .LVU30
+.LVL10:
+	.loc 1 150 5 view .LVU31
+	.loc 1 151 5 view .LVU32
+	.loc 1 152 5 view .LVU33
+	.loc 1 153 5 view .LVU34
+	.loc 1 153 20 view .LVU35
+	cmpq	$7, %rsi
+	jbe	.L15
+	movl	$8, %ebp
+	.loc 1 151 12 is_stmt 0 view .LVU36
+	movl	$0, %r12d
+	.loc 1 150 14 view .LVU37
+	movabsq	$-3750763034362895579, %rbx
+.LBB43:
+	.loc 1 159 40 view .LVU38
+	movabsq	$9187201950435737471, %r13
+.LVL11:
+.L12:
+	.loc 1 154 9 is_stmt 1 discriminator 2 view .LVU39
+	.loc 1 155 9 discriminator 2 view .LVU40
+.LBB44:
+.LBI44:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/string_fortified.h"
+	.loc 2 26 42 discriminator 2 view .LVU41
+.LBB45:
+	.loc 2 29 3 discriminator 2 view .LVU42
+	.loc 2 29 10 is_stmt 0 discriminator 2 view .LVU43
+	movq	-8(%r14,%rbp), %rax
+.LVL12:
+	.loc 2 29 10 discriminator 2 view .LVU44
+.LBE45:
+.LBE44:
+	.loc 1 156 9 is_stmt 1 discriminator 2 view .LVU45
+	.loc 1 156 14 is_stmt 0 discriminator 2 view .LVU46
+	xorq	%rax, %rbx
+.LVL13:
+	.loc 1 157 9 is_stmt 1 discriminator 2 view .LVU47
+	.loc 1 157 14 is_stmt 0 discriminator 2 view .LVU48
+	movabsq	$1099511628211, %rsi
+	imulq	%rsi, %rbx
+.LVL14:
+	.loc 1 159 9 is_stmt 1 discriminator 2 view .LVU49
+	.loc 1 160 9 discriminator 2 view .LVU50
+	.loc 1 159 40 is_stmt 0 discriminator 2 view .LVU51
+	movq	%rax, %rdi
+	andq	%r13, %rdi
+	.loc 1 159 48 discriminator 2 view .LVU52
+	addq	%r13, %rdi
+	.loc 1 159 56 discriminator 2 view .LVU53
+	orq	%rax, %rdi
+	.loc 1 159 63 discriminator 2 view .LVU54
+	orq	%r13, %rdi
+	.loc 1 159 24 discriminator 2 view .LVU55
+	notq	%rdi
+	.loc 1 160 26 discriminator 2 view .LVU56
+	call	__popcountdi2@PLT
+.LVL15:
+	.loc 1 160 18 discriminator 2 view .LVU57
+	cltq
+	.loc 1 160 15 discriminator 2 view .LVU58
+	addq	%rax, %r12
+.LVL16:
+	.loc 1 160 15 discriminator 2 view .LVU59
+.LBE43:
+	.loc 1 153 31 is_stmt 1 discriminator 2 view .LVU60
+	.loc 1 153 20 discriminator 2 view .LVU61
+	movq	%rbp, %rax
+	addq	$8, %rbp
+.LVL17:
+	.loc 1 153 20 is_stmt 0 discriminator 2 view .LVU62
+	cmpq	%rbp, %r15
+	jnb	.L12
+.LVL18:
+.L11:
+	.loc 1 162 14 is_stmt 1 view .LVU63
+	cmpq	%r15, %rax
+	jnb	.L13
+	addq	%r14, %rax
+.LVL19:
+	.loc 1 162 14 is_stmt 0 view .LVU64
+	addq	%r15, %r14
+.LVL20:
+	.loc 1 164 14 view .LVU65
+	movabsq	$1099511628211, %rsi
+.LVL21:
+.L14:
+	.loc 1 163 9 is_stmt 1 discriminator 2 view .LVU66
+	.loc 1 163 36 is_stmt 0 discriminator 2 view .LVU67
+	movzbl	(%rax), %ecx
+	.loc 1 163 17 discriminator 2 view .LVU68
+	movzbl	%cl, %edx
+	.loc 1 163 14 discriminator 2 view .LVU69
+	xorq	%rbx, %rdx
+.LVL22:
+	.loc 1 164 9 is_stmt 1 discriminator 2 view .LVU70
+	.loc 1 164 14 is_stmt 0 discriminator 2 view .LVU71
+	imulq	%rsi, %rdx
+.LVL23:
+	.loc 1 164 14 discriminator 2 view .LVU72
+	movq	%rdx, %rbx
+.LVL24:
+	.loc 1 165 9 is_stmt 1 discriminator 2 view .LVU73
+	.loc 1 165 15 is_stmt 0 discriminator 2 view .LVU74
+	cmpb	$1, %cl
+	adcq	$0, %r12
+.LVL25:
+	.loc 1 162 22 is_stmt 1 discriminator 2 view .LVU75
+	.loc 1 162 14 discriminator 2 view .LVU76
+	addq	$1, %rax
+.LVL26:
+	.loc 1 162 14 is_stmt 0 discriminator 2 view .LVU77
+	cmpq	%rax, %r14
+	jne	.L14
+.LVL27:
+.L13:
+	.loc 1 167 5 is_stmt 1 view .LVU78
+	.loc 1 167 16 is_stmt 0 view .LVU79
+	movq	8(%rsp), %rax
+	movq	%r12, (%rax)
+	.loc 1 168 5 is_stmt 1 view .LVU80
+	.loc 1 169 1 is_stmt 0 view .LVU81
+	movq	%rbx, %rax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL28:
+	.loc 1 169 1 view .LVU82
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL29:
+	.loc 1 169 1 view .LVU83
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL30:
+	.loc 1 169 1 view .LVU84
+	ret
+.LVL31:
+.L15:
+	.cfi_restore_state
+	.loc 1 152 12 view .LVU85
+	movl	$0, %eax
+	.loc 1 151 12 view .LVU86
+	movl	$0, %r12d
+	.loc 1 150 14 view .LVU87
+	movabsq	$-3750763034362895579, %rbx
+	jmp	.L11
+	.cfi_endproc
+.LFE68:
+	.size	sequence_cache_hash, .-sequence_cache_hash
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"XDG_CACHE_HOME"
+.LC1:
+	.string	"%s/%s"
+.LC2:
+	.string	"beep"
+.LC3:
+	.string	"HOME"
+.LC4:
+	.string	"%s/.cache/%s"
+	.text
+	.type	sequence_cache_dir, @function
+sequence_cache_dir:
+.LVL32:
+.LFB67:
+	.loc 1 119 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 119 1 is_stmt 0 view .LVU89
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp
+	movq	%rsi, %rbx
+	.loc 1 120 5 is_stmt 1 view .LVU90
+	.loc 1 120 36 is_stmt 0 view .LVU91
+	leaq	.LC0(%rip), %rdi
+.LVL33:
+	.loc 1 120 36 view .LVU92
+	call	getenv@PLT
+.LVL34:
+	.loc 1 121 5 is_stmt 1 view .LVU93
+	.loc 1 122 5 view .LVU94
+	.loc 1 122 8 is_stmt 0 view .LVU95
+	testq	%rax, %rax
+	je	.L20
+	.loc 1 122 20 discriminator 1 view .LVU96
+	cmpb	$47, (%rax)
+	je	.L28
+.L20:
+.LBB46:
+	.loc 1 126 9 is_stmt 1 view .LVU97
+	.loc 1 126 34 is_stmt 0 view .LVU98
+	leaq	.LC3(%rip), %rdi
+	call	getenv@PLT
+.LVL35:
+	.loc 1 126 34 view .LVU99
+	movq	%rax, %r9
+.LVL36:
+	.loc 1 127 9 is_stmt 1 view .LVU100
+	.loc 1 127 12 is_stmt 0 view .LVU101
+	testq	%rax, %rax
+	je	.L24
+	.loc 1 128 19 discriminator 1 view .LVU102
+	movl	$0, %eax
+.LVL37:
+	.loc 1 127 21 discriminator 1 view .LVU103
+	cmpb	$47, (%r9)
+	je	.L29
+.LVL38:
+.L19:
+	.loc 1 127 21 discriminator 1 view .LVU104
+.LBE46:
+	.loc 1 134 1 view .LVU105
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL39:
+	.loc 1 134 1 view .LVU106
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL40:
+	.loc 1 134 1 view .LVU107
+	ret
+.LVL41:
+.L28:
+	.cfi_restore_state
+	.loc 1 123 9 is_stmt 1 view .LVU108
+.LBB49:
+.LBI49:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdio2.h"
+	.loc 3 51 42 view .LVU109
+.LBB50:
+	.loc 3 54 3 view .LVU110
+	.loc 3 54 10 is_stmt 0 view .LVU111
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	leaq	.LC2(%rip), %rcx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+	movq	%rax, %r9
+	leaq	.LC1(%rip), %r8
+	movq	$-1, %rcx
+	movl	$1, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+.LVL42:
+	.loc 3 54 10 view .LVU112
+	call	__snprintf_chk@PLT
+.LVL43:
+	.loc 3 54 10 view .LVU113
+	movl	%eax, %edx
+.LVL44:
+	.loc 3 54 10 view .LVU114
+.LBE50:
+.LBE49:
+	.loc 1 123 13 view .LVU115
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L21
+.LVL45:
+.L29:
+.LBB51:
+	.loc 1 130 9 is_stmt 1 view .LVU116
+.LBB47:
+.LBI47:
+	.loc 3 51 42 view .LVU117
+.LBB48:
+	.loc 3 54 3 view .LVU118
+	.loc 3 54 10 is_stmt 0 view .LVU119
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	leaq	.LC2(%rip), %rax
+	pushq	%rax
+	.cfi_def_cfa_offset 48
+	leaq	.LC4(%rip), %r8
+	movq	$-1, %rcx
+	movl	$1, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	__snprintf_chk@PLT
+.LVL46:
+	.loc 3 54 10 view .LVU120
+	movl	%eax, %edx
+.LVL47:
+	.loc 3 54 10 view .LVU121
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+.LVL48:
+.L21:
+	.loc 3 54 10 view .LVU122
+.LBE48:
+.LBE47:
+.LBE51:
+	.loc 1 133 5 is_stmt 1 view .LVU123
+	.loc 1 133 22 is_stmt 0 view .LVU124
+	movl	$0, %eax
+.LVL49:
+	.loc 1 133 22 view .LVU125
+	testl	%edx, %edx
+	jle	.L23
+	.loc 1 133 26 discriminator 1 view .LVU126
+	movslq	%edx, %rdx
+	.loc 1 133 22 discriminator 1 view .LVU127
+	cmpq	%rbx, %rdx
+	setb	%al
+	movzbl	%al, %eax
+.LVL50:
+.L23:
+	.loc 1 133 22 discriminator 6 view .LVU128
+	andl	$1, %eax
+	jmp	.L19
+.LVL51:
+.L24:
+.LBB52:
+	.loc 1 128 19 view .LVU129
+	movl	$0, %eax
+.LVL52:
+	.loc 1 128 19 view .LVU130
+	jmp	.L19
+.LBE52:
+	.cfi_endproc
+.LFE67:
+	.size	sequence_cache_dir, .-sequence_cache_dir
+	.section	.rodata.str1.1
+.LC5:
+	.string	"%s/%016llx"
+	.text
+	.type	sequence_cache_file_name, @function
+sequence_cache_file_name:
+.LVL53:
+.LFB72:
+	.loc 1 236 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 236 1 is_stmt 0 view .LVU132
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4152
+	orq	$0, (%rsp)
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 4208
+	.loc 1 236 1 view .LVU133
+	movq	%fs:40, %rax
+	movq	%rax, 4136(%rsp)
+	xorl	%eax, %eax
+	.loc 1 237 5 is_stmt 1 view .LVU134
+	.loc 1 238 15 is_stmt 0 view .LVU135
+	movl	$1, %ebp
+	.loc 1 237 8 view .LVU136
+	cmpb	$0, cache_name(%rip)
+	je	.L53
+.LVL54:
+.L30:
+	.loc 1 258 1 view .LVU137
+	movq	4136(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L54
+	movl	%ebp, %eax
+	addq	$4152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL55:
+.L53:
+	.cfi_restore_state
+	.loc 1 258 1 view .LVU138
+	movl	%edi, %r13d
+	movq	%rsi, %rbx
+	.loc 1 240 5 is_stmt 1 view .LVU139
+	.loc 1 241 5 view .LVU140
+	.loc 1 241 10 is_stmt 0 view .LVU141
+	leaq	32(%rsp), %rdi
+.LVL56:
+	.loc 1 241 10 view .LVU142
+	movl	$4096, %esi
+.LVL57:
+	.loc 1 241 10 view .LVU143
+	call	sequence_cache_dir
+.LVL58:
+	movl	%eax, %ebp
+	.loc 1 241 8 view .LVU144
+	testb	%al, %al
+	je	.L30
+.LVL59:
+.LBB65:
+.LBB66:
+.LBB67:
+	.loc 1 181 20 is_stmt 1 view .LVU145
+	cmpl	$2, %r13d
+	jle	.L32
+	leaq	8(%rbx), %rax
+	leal	-3(%r13), %edx
+	leaq	16(%rbx,%rdx,8), %rcx
+.LVL60:
+.L34:
+	.loc 1 182 9 view .LVU146
+	.loc 1 182 18 is_stmt 0 view .LVU147
+	movq	8(%rax), %rdx
+	.loc 1 182 12 view .LVU148
+	cmpq	%rdx, (%rax)
+	jnb	.L44
+	.loc 1 182 36 view .LVU149
+	cmpb	$0, -1(%rdx)
+	jne	.L44
+	.loc 1 181 27 is_stmt 1 view .LVU150
+.LVL61:
+	.loc 1 181 20 view .LVU151
+	addq	$8, %rax
+.LVL62:
+	.loc 1 181 20 is_stmt 0 view .LVU152
+	cmpq	%rcx, %rax
+	jne	.L34
+.LVL63:
+.L32:
+	.loc 1 181 20 view .LVU153
+.LBE67:
+	.loc 1 186 5 is_stmt 1 view .LVU154
+	.loc 1 186 33 is_stmt 0 view .LVU155
+	movslq	%r13d, %rax
+	.loc 1 186 65 view .LVU156
+	movq	-8(%rbx,%rax,8), %r12
+	.loc 1 186 44 view .LVU157
+	movq	%r12, %rdi
+	call	strlen@PLT
+.LVL64:
+	.loc 1 187 5 is_stmt 1 view .LVU158
+	.loc 1 187 44 is_stmt 0 view .LVU159
+	movq	8(%rbx), %r14
+	.loc 1 186 23 view .LVU160
+	leaq	1(%r12,%rax), %r12
+.LVL65:
+	.loc 1 187 38 view .LVU161
+	subq	%r14, %r12
+.LVL66:
+	.loc 1 188 5 is_stmt 1 view .LVU162
+	.loc 1 189 5 view .LVU163
+	.loc 1 189 13 is_stmt 0 view .LVU164
+	leaq	24(%rsp), %rdx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	sequence_cache_hash
+.LVL67:
+	.loc 1 190 5 is_stmt 1 view .LVU165
+	.loc 1 190 36 is_stmt 0 view .LVU166
+	leal	-1(%r13), %edx
+	.loc 1 190 22 view .LVU167
+	movslq	%edx, %rdx
+	.loc 1 190 8 view .LVU168
+	cmpq	24(%rsp), %rdx
+	jne	.L35
+	.loc 1 193 5 is_stmt 1 view .LVU169
+	.loc 1 193 9 is_stmt 0 view .LVU170
+	movq	%r14, key(%rip)
+	.loc 1 194 5 is_stmt 1 view .LVU171
+	.loc 1 194 14 is_stmt 0 view .LVU172
+	movq	%r12, key_size(%rip)
+	.loc 1 195 5 is_stmt 1 view .LVU173
+.LVL68:
+	.loc 1 195 5 is_stmt 0 view .LVU174
+	jmp	.L36
+.LVL69:
+.L35:
+	.loc 1 195 5 view .LVU175
+.LBE66:
+.LBE65:
+.LBB68:
+.LBB69:
+.LBB70:
+	.loc 1 203 20 is_stmt 1 view .LVU176
+	cmpl	$1, %r13d
+	jg	.L44
+.LBE70:
+	.loc 1 206 5 view .LVU177
+	.loc 1 206 24 is_stmt 0 view .LVU178
+	movl	$0, %edi
+	call	malloc@PLT
+.LVL70:
+	movq	%rax, 8(%rsp)
+.LVL71:
+	.loc 1 207 5 is_stmt 1 view .LVU179
+	.loc 1 207 8 is_stmt 0 view .LVU180
+	testq	%rax, %rax
+	je	.L41
+	.loc 1 202 12 view .LVU181
+	movl	$0, %r15d
+	jmp	.L43
+.LVL72:
+.L44:
+	.loc 1 202 12 view .LVU182
+	leaq	8(%rbx), %r12
+	leal	-2(%r13), %eax
+	leaq	16(%rbx,%rax,8), %r14
+	movl	$0, %r15d
+.LVL73:
+.L38:
+.LBB71:
+	.loc 1 204 9 is_stmt 1 view .LVU183
+	.loc 1 204 17 is_stmt 0 view .LVU184
+	movq	(%r12), %rdi
+	call	strlen@PLT
+.LVL74:
+	.loc 1 204 14 view .LVU185
+	leaq	1(%r15,%rax), %r15
+.LVL75:
+	.loc 1 203 27 is_stmt 1 view .LVU186
+	.loc 1 203 20 view .LVU187
+	addq	$8, %r12
+.LVL76:
+	.loc 1 203 20 is_stmt 0 view .LVU188
+	cmpq	%r14, %r12
+	jne	.L38
+.LBE71:
+	.loc 1 206 5 is_stmt 1 view .LVU189
+	.loc 1 206 24 is_stmt 0 view .LVU190
+	movq	%r15, %rdi
+	call	malloc@PLT
+.LVL77:
+	movq	%rax, 8(%rsp)
+.LVL78:
+	.loc 1 207 5 is_stmt 1 view .LVU191
+	.loc 1 207 8 is_stmt 0 view .LVU192
+	testq	%rax, %rax
+	je	.L41
+.LVL79:
+	.loc 1 207 8 view .LVU193
+	leaq	8(%rbx), %r12
+.LVL80:
+	.loc 1 207 8 view .LVU194
+	leal	-2(%r13), %eax
+.LVL81:
+	.loc 1 207 8 view .LVU195
+	leaq	16(%rbx,%rax,8), %rax
+	movq	%rax, (%rsp)
+	.loc 1 206 24 view .LVU196
+	movq	8(%rsp), %r13
+.LVL82:
+.L40:
+.LBB72:
+.LBB73:
+	.loc 1 212 9 is_stmt 1 view .LVU197
+	.loc 1 212 28 is_stmt 0 view .LVU198
+	movq	(%r12), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+.LVL83:
+	.loc 1 212 22 view .LVU199
+	leaq	1(%rax), %rbx
+.LVL84:
+	.loc 1 213 9 is_stmt 1 view .LVU200
+.LBB74:
+.LBI74:
+	.loc 2 26 42 view .LVU201
+.LBB75:
+	.loc 2 29 3 view .LVU202
+	.loc 2 29 10 is_stmt 0 view .LVU203
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	memcpy@PLT
+.LVL85:
+	.loc 2 29 10 view .LVU204
+.LBE75:
+.LBE74:
+	.loc 1 214 9 is_stmt 1 view .LVU205
+	.loc 1 214 11 is_stmt 0 view .LVU206
+	addq	%rbx, %r13
+.LVL86:
+	.loc 1 214 11 view .LVU207
+.LBE73:
+	.loc 1 211 27 is_stmt 1 view .LVU208
+	.loc 1 211 20 view .LVU209
+	addq	$8, %r12
+.LVL87:
+	.loc 1 211 20 is_stmt 0 view .LVU210
+	cmpq	%r12, (%rsp)
+	jne	.L40
+.LVL88:
+.L43:
+	.loc 1 211 20 view .LVU211
+.LBE72:
+	.loc 1 216 5 is_stmt 1 view .LVU212
+	.loc 1 217 5 view .LVU213
+	.loc 1 217 13 is_stmt 0 view .LVU214
+	leaq	24(%rsp), %rdx
+	movq	%r15, %rsi
+	movq	8(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	sequence_cache_hash
+.LVL89:
+	.loc 1 218 5 is_stmt 1 view .LVU215
+	.loc 1 218 9 is_stmt 0 view .LVU216
+	movq	%rbx, key(%rip)
+	.loc 1 219 5 is_stmt 1 view .LVU217
+	.loc 1 219 14 is_stmt 0 view .LVU218
+	movq	%r15, key_size(%rip)
+	.loc 1 220 5 is_stmt 1 view .LVU219
+.LVL90:
+.L36:
+	.loc 1 220 5 is_stmt 0 view .LVU220
+.LBE69:
+.LBE68:
+	.loc 1 251 5 is_stmt 1 view .LVU221
+.LBB76:
+.LBI76:
+	.loc 3 51 42 view .LVU222
+.LBB77:
+	.loc 3 54 3 view .LVU223
+	.loc 3 54 10 is_stmt 0 view .LVU224
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 4216
+	pushq	%rax
+	.cfi_def_cfa_offset 4224
+	leaq	48(%rsp), %r9
+	leaq	.LC5(%rip), %r8
+	movl	$4096, %ecx
+	movl	$1, %edx
+	movl	$4096, %esi
+	leaq	cache_name(%rip), %rdi
+	movl	$0, %eax
+.LVL91:
+	.loc 3 54 10 view .LVU225
+	call	__snprintf_chk@PLT
+.LVL92:
+	.loc 3 54 10 view .LVU226
+.LBE77:
+.LBE76:
+	.loc 1 253 5 is_stmt 1 view .LVU227
+	.loc 1 253 20 is_stmt 0 view .LVU228
+	subl	$1, %eax
+.LVL93:
+	.loc 1 253 8 view .LVU229
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 4208
+	cmpl	$4094, %eax
+	jbe	.L30
+	.loc 1 254 9 is_stmt 1 view .LVU230
+	.loc 1 254 23 is_stmt 0 view .LVU231
+	movb	$0, cache_name(%rip)
+	.loc 1 255 9 is_stmt 1 view .LVU232
+	.loc 1 255 15 is_stmt 0 view .LVU233
+	movl	$0, %ebp
+	jmp	.L30
+.LVL94:
+.L41:
+	.loc 1 248 15 view .LVU234
+	movl	$0, %ebp
+	jmp	.L30
+.LVL95:
+.L54:
+	.loc 1 258 1 view .LVU235
+	call	__stack_chk_fail@PLT
+.LVL96:
+	.cfi_endproc
+.LFE72:
+	.size	sequence_cache_file_name, .-sequence_cache_file_name
+	.section	.rodata.str1.1
+.LC6:
+	.string	"BEEPARGS"
+.LC7:
+	.string	"1.4.3"
+	.text
+	.type	sequence_cache_check, @function
+sequence_cache_check:
+.LVL97:
+.LFB74:
+	.loc 1 272 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 272 1 is_stmt 0 view .LVU237
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 432
+	movl	%edi, %ebx
+	movl	%esi, %r13d
+	movq	%rdx, %r14
+	movq	%rcx, %r12
+	.loc 1 272 1 view .LVU238
+	movq	%fs:40, %rax
+	movq	%rax, 360(%rsp)
+	xorl	%eax, %eax
+	.loc 1 273 5 is_stmt 1 view .LVU239
+	.loc 1 274 5 view .LVU240
+.LVL98:
+.LBB86:
+.LBI86:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/unistd.h"
+	.loc 4 36 1 view .LVU241
+.LBB87:
+	.loc 4 38 3 view .LVU242
+	.loc 4 38 469 is_stmt 0 view .LVU243
+	leaq	192(%rsp), %rsi
+.LVL99:
+	.loc 4 38 469 view .LVU244
+	movl	$160, %edx
+.LVL100:
+	.loc 4 38 469 view .LVU245
+	call	read@PLT
+.LVL101:
+	.loc 4 38 469 view .LVU246
+.LBE87:
+.LBE86:
+	.loc 1 281 15 view .LVU247
+	movl	$0, %ebp
+	.loc 1 274 8 view .LVU248
+	cmpq	$160, %rax
+	jne	.L55
+	.loc 1 275 18 view .LVU249
+	leaq	192(%rsp), %rdi
+	movl	$8, %edx
+	leaq	.LC6(%rip), %rsi
+	call	memcmp@PLT
+.LVL102:
+	.loc 1 275 9 view .LVU250
+	testl	%eax, %eax
+	jne	.L55
+	.loc 1 276 9 view .LVU251
+	cmpl	$2, 200(%rsp)
+	jne	.L55
+	.loc 1 277 9 view .LVU252
+	cmpl	$1, 204(%rsp)
+	jne	.L55
+	.loc 1 278 19 view .LVU253
+	movl	348(%rsp), %r15d
+.LBB88:
+.LBI88:
+	.loc 1 225 10 is_stmt 1 view .LVU254
+.LBB89:
+	.loc 1 227 5 view .LVU255
+	.loc 1 228 5 view .LVU256
+	.loc 1 228 22 is_stmt 0 view .LVU257
+	leaq	40(%rsp), %rdx
+	movl	$6, %esi
+	leaq	.LC7(%rip), %rdi
+	call	sequence_cache_hash
+.LVL103:
+.LBE89:
+.LBE88:
+	.loc 1 278 9 view .LVU258
+	cmpl	%eax, %r15d
+	jne	.L55
+	.loc 1 279 29 view .LVU259
+	movq	key_size(%rip), %r15
+	.loc 1 279 19 view .LVU260
+	movl	208(%rsp), %eax
+	.loc 1 279 9 view .LVU261
+	cmpq	%r15, %rax
+	jne	.L55
+	.loc 1 280 9 view .LVU262
+	cmpl	$16, 216(%rsp)
+	jbe	.L74
+.L55:
+	.loc 1 317 1 view .LVU263
+	movq	360(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L75
+	movl	%ebp, %eax
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL104:
+	.loc 1 317 1 view .LVU264
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL105:
+	.loc 1 317 1 view .LVU265
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL106:
+	.loc 1 317 1 view .LVU266
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL107:
+	.loc 1 317 1 view .LVU267
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL108:
+.L74:
+	.cfi_restore_state
+	.loc 1 287 5 is_stmt 1 view .LVU268
+	.loc 1 288 5 view .LVU269
+	.loc 1 289 5 view .LVU270
+	.loc 1 289 15 is_stmt 0 view .LVU271
+	leaq	48(%rsp), %rsi
+	movl	%ebx, %edi
+	call	fstat@PLT
+.LVL109:
+	.loc 1 289 8 view .LVU272
+	testl	%eax, %eax
+	jne	.L55
+	.loc 1 287 18 discriminator 1 view .LVU273
+	leaq	160(%r15), %rax
+.LVL110:
+	.loc 1 289 31 discriminator 1 view .LVU274
+	cmpq	%rax, 96(%rsp)
+	jl	.L55
+	.loc 1 292 5 is_stmt 1 view .LVU275
+	.loc 1 292 29 is_stmt 0 view .LVU276
+	movl	$0, %r9d
+	movl	%ebx, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rsi
+	movl	$0, %edi
+	call	mmap@PLT
+.LVL111:
+	.loc 1 293 5 is_stmt 1 view .LVU277
+	.loc 1 293 8 is_stmt 0 view .LVU278
+	cmpq	$-1, %rax
+	je	.L55
+	.loc 1 296 5 is_stmt 1 view .LVU279
+	.loc 1 296 39 is_stmt 0 view .LVU280
+	movq	%rax, %rbp
+	leaq	160(%rax), %rdi
+	.loc 1 296 32 view .LVU281
+	movq	%r15, %rdx
+	movq	key(%rip), %rsi
+	call	memcmp@PLT
+.LVL112:
+	.loc 1 296 32 view .LVU282
+	movl	%eax, 16(%rsp)
+.LVL113:
+	.loc 1 297 5 is_stmt 1 view .LVU283
+	movq	8(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	munmap@PLT
+.LVL114:
+	.loc 1 298 5 view .LVU284
+	.loc 1 299 15 is_stmt 0 view .LVU285
+	movl	$0, %ebp
+.LVL115:
+	.loc 1 298 8 view .LVU286
+	cmpl	$0, 16(%rsp)
+	jne	.L55
+	.loc 1 302 5 is_stmt 1 view .LVU287
+	.loc 1 302 25 is_stmt 0 view .LVU288
+	movl	212(%rsp), %eax
+	movl	%eax, (%r12)
+	.loc 1 303 5 is_stmt 1 view .LVU289
+	.loc 1 303 36 is_stmt 0 view .LVU290
+	movl	216(%rsp), %eax
+	movq	%rax, 24(%rsp)
+	.loc 1 303 28 view .LVU291
+	movq	%rax, 8(%r12)
+	.loc 1 304 5 is_stmt 1 view .LVU292
+.LBB90:
+	.loc 1 304 10 view .LVU293
+.LVL116:
+	.loc 1 304 23 view .LVU294
+	testq	%rax, %rax
+	je	.L57
+	.loc 1 304 17 is_stmt 0 view .LVU295
+	movq	$0, 8(%rsp)
+.LVL117:
+.L58:
+.LBB91:
+	.loc 1 305 9 is_stmt 1 view .LVU296
+	.loc 1 305 24 is_stmt 0 view .LVU297
+	movq	8(%rsp), %rcx
+	movl	220(%rsp,%rcx,4), %edx
+.LVL118:
+	.loc 1 306 9 is_stmt 1 view .LVU298
+	.loc 1 306 18 is_stmt 0 view .LVU299
+	testl	%edx, %edx
+	sete	%bpl
+	.loc 1 306 32 view .LVU300
+	cmpl	%r13d, %edx
+	setnb	%al
+	.loc 1 306 12 view .LVU301
+	orb	%al, %bpl
+	jne	.L71
+	.loc 1 307 37 view .LVU302
+	movl	284(%rsp,%rcx,4), %edi
+	movl	%edi, 16(%rsp)
+	.loc 1 307 54 view .LVU303
+	movl	%edx, 20(%rsp)
+	movl	%edx, %eax
+	.loc 1 307 43 view .LVU304
+	movq	(%r14,%rax,8), %rdi
+	call	strlen@PLT
+.LVL119:
+	.loc 1 307 43 view .LVU305
+	movq	%rax, %rdx
+	.loc 1 307 37 view .LVU306
+	movl	16(%rsp), %edi
+	movl	%edi, %eax
+	.loc 1 307 13 view .LVU307
+	cmpq	%rax, %rdx
+	jb	.L55
+	.loc 1 310 9 is_stmt 1 discriminator 2 view .LVU308
+	.loc 1 310 33 is_stmt 0 discriminator 2 view .LVU309
+	movq	8(%rsp), %rcx
+	movl	20(%rsp), %edx
+	movl	%edx, 16(%r12,%rcx,4)
+	.loc 1 311 9 is_stmt 1 discriminator 2 view .LVU310
+	.loc 1 311 36 is_stmt 0 discriminator 2 view .LVU311
+	movl	%edi, 80(%r12,%rcx,4)
+.LBE91:
+	.loc 1 304 45 is_stmt 1 discriminator 2 view .LVU312
+	addq	$1, %rcx
+	movq	%rcx, 8(%rsp)
+.LVL120:
+	.loc 1 304 23 discriminator 2 view .LVU313
+	cmpq	%rcx, 24(%rsp)
+	jne	.L58
+.LVL121:
+.L57:
+	.loc 1 304 23 is_stmt 0 discriminator 2 view .LVU314
+.LBE90:
+	.loc 1 314 5 is_stmt 1 view .LVU315
+.LBB93:
+.LBI93:
+	.loc 1 262 8 view .LVU316
+.LBB94:
+	.loc 1 264 5 view .LVU317
+	.loc 1 264 22 is_stmt 0 view .LVU318
+	leaq	7(%r15), %rbp
+	.loc 1 264 27 view .LVU319
+	andq	$-8, %rbp
+.LBE94:
+.LBE93:
+	.loc 1 315 32 view .LVU320
+	addq	$160, %rbp
+.LVL122:
+	.loc 1 316 5 is_stmt 1 view .LVU321
+	.loc 1 316 29 is_stmt 0 view .LVU322
+	movl	$0, %edx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	lseek@PLT
+.LVL123:
+	.loc 1 316 26 view .LVU323
+	cmpq	%rbp, %rax
+	sete	%bpl
+.LVL124:
+	.loc 1 316 26 view .LVU324
+	jmp	.L55
+.LVL125:
+.L71:
+.LBB95:
+.LBB92:
+	.loc 1 308 19 view .LVU325
+	movl	$0, %ebp
+	jmp	.L55
+.LVL126:
+.L75:
+	.loc 1 308 19 view .LVU326
+.LBE92:
+.LBE95:
+	.loc 1 317 1 view .LVU327
+	call	__stack_chk_fail@PLT
+.LVL127:
+	.cfi_endproc
+.LFE74:
+	.size	sequence_cache_check, .-sequence_cache_check
+	.section	.rodata.str1.1
+.LC8:
+	.string	"%s"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC9:
+	.string	"sequence cache: removing old %s"
+	.section	.rodata.str1.1
+.LC10:
+	.string	"sequence cache: removing %s"
+	.text
+	.type	sequence_cache_prune, @function
+sequence_cache_prune:
+.LFB80:
+	.loc 1 465 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4152
+	orq	$0, (%rsp)
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 4368
+	.loc 1 465 1 is_stmt 0 view .LVU329
+	movq	%fs:40, %rax
+	movq	%rax, 4296(%rsp)
+	xorl	%eax, %eax
+	.loc 1 466 5 is_stmt 1 view .LVU330
+	.loc 1 467 5 view .LVU331
+.LVL128:
+.LBB96:
+.LBI96:
+	.loc 3 51 42 view .LVU332
+.LBB97:
+	.loc 3 54 3 view .LVU333
+	.loc 3 54 10 is_stmt 0 view .LVU334
+	leaq	192(%rsp), %rbx
+.LVL129:
+	.loc 3 54 10 view .LVU335
+	leaq	cache_name(%rip), %rcx
+	leaq	.LC8(%rip), %rdx
+	movl	$4096, %esi
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+.LVL130:
+	.loc 3 54 10 view .LVU336
+.LBE97:
+.LBE96:
+	.loc 1 468 5 is_stmt 1 view .LVU337
+	.loc 1 468 25 is_stmt 0 view .LVU338
+	movl	$47, %esi
+	movq	%rbx, %rdi
+	call	strrchr@PLT
+.LVL131:
+	.loc 1 469 5 is_stmt 1 view .LVU339
+	.loc 1 469 8 is_stmt 0 view .LVU340
+	testq	%rax, %rax
+	je	.L76
+	.loc 1 472 5 is_stmt 1 view .LVU341
+	.loc 1 472 12 is_stmt 0 view .LVU342
+	movb	$0, (%rax)
+	.loc 1 473 5 is_stmt 1 view .LVU343
+.LVL132:
+.LBB98:
+.LBI98:
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/fcntl2.h"
+	.loc 5 41 1 view .LVU344
+.LBB99:
+	.loc 5 43 3 view .LVU345
+	.loc 5 46 3 view .LVU346
+	.loc 5 48 7 view .LVU347
+	.loc 5 53 7 view .LVU348
+	.loc 5 53 14 is_stmt 0 view .LVU349
+	movq	%rbx, %rdi
+	movl	$589824, %esi
+	movl	$0, %eax
+.LVL133:
+	.loc 5 53 14 view .LVU350
+	call	open@PLT
+.LVL134:
+	movl	%eax, %r13d
+.LVL135:
+	.loc 5 53 14 view .LVU351
+.LBE99:
+.LBE98:
+	.loc 1 474 5 is_stmt 1 view .LVU352
+	.loc 1 474 8 is_stmt 0 view .LVU353
+	cmpl	$-1, %eax
+	je	.L76
+	.loc 1 477 5 is_stmt 1 view .LVU354
+	.loc 1 477 22 is_stmt 0 view .LVU355
+	movl	%eax, %edi
+	call	fdopendir@PLT
+.LVL136:
+	.loc 1 477 22 view .LVU356
+	movq	%rax, %r14
+.LVL137:
+	.loc 1 478 5 is_stmt 1 view .LVU357
+	.loc 1 478 8 is_stmt 0 view .LVU358
+	testq	%rax, %rax
+	je	.L99
+	.loc 1 483 5 is_stmt 1 view .LVU359
+	.loc 1 483 24 is_stmt 0 view .LVU360
+	movl	$0, %edi
+	call	time@PLT
+.LVL138:
+	.loc 1 483 24 view .LVU361
+	movq	%rax, 32(%rsp)
+.LVL139:
+	.loc 1 484 5 is_stmt 1 view .LVU362
+	.loc 1 485 5 view .LVU363
+	.loc 1 486 5 view .LVU364
+	.loc 1 487 5 view .LVU365
+	.loc 1 488 5 view .LVU366
+	.loc 1 486 12 is_stmt 0 view .LVU367
+	movq	$0, 40(%rsp)
+	.loc 1 485 12 view .LVU368
+	movq	$0, 16(%rsp)
+	.loc 1 484 18 view .LVU369
+	movq	$0, 24(%rsp)
+.LBB100:
+	.loc 1 492 22 view .LVU370
+	leaq	48(%rsp), %rax
+.LVL140:
+	.loc 1 492 22 view .LVU371
+	movq	%rax, 8(%rsp)
+.LBE100:
+	.loc 1 488 11 view .LVU372
+	jmp	.L79
+.LVL141:
+.L99:
+	.loc 1 479 9 is_stmt 1 view .LVU373
+	movl	%r13d, %edi
+	call	close@PLT
+.LVL142:
+	.loc 1 480 9 view .LVU374
+	jmp	.L76
+.LVL143:
+.L101:
+.LBB104:
+	.loc 1 500 13 view .LVU375
+	.loc 1 500 18 view .LVU376
+	.loc 1 500 21 is_stmt 0 view .LVU377
+	cmpl	$0, log_level(%rip)
+	jg	.L100
+.L83:
+	.loc 1 500 16 is_stmt 1 discriminator 3 view .LVU378
+	.loc 1 501 13 discriminator 3 view .LVU379
+	movl	$0, %edx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	unlinkat@PLT
+.LVL144:
+	.loc 1 502 13 discriminator 3 view .LVU380
+	jmp	.L79
+.L100:
+	.loc 1 500 54 discriminator 1 view .LVU381
+	movq	%r12, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL145:
+	jmp	.L83
+.L95:
+	.loc 1 500 54 is_stmt 0 discriminator 1 view .LVU382
+	movq	24(%rsp), %rax
+.L84:
+.LVL146:
+	.loc 1 517 9 is_stmt 1 view .LVU383
+	.loc 1 517 16 is_stmt 0 view .LVU384
+	movq	16(%rsp), %rsi
+	movq	%rsi, %rdx
+	salq	$5, %rdx
+	addq	%rax, %rdx
+	.loc 1 517 30 view .LVU385
+	movq	%r15, (%rdx)
+	.loc 1 518 9 is_stmt 1 view .LVU386
+.LVL147:
+.LBB101:
+.LBI101:
+	.loc 2 26 42 view .LVU387
+.LBB102:
+	.loc 2 29 3 view .LVU388
+	.loc 2 29 10 is_stmt 0 view .LVU389
+	movdqu	19(%rbx), %xmm0
+	movups	%xmm0, 8(%rdx)
+	movzbl	16(%r12), %ecx
+	movb	%cl, 24(%rdx)
+.LVL148:
+	.loc 2 29 10 view .LVU390
+.LBE102:
+.LBE101:
+	.loc 1 519 9 is_stmt 1 view .LVU391
+	addq	$1, %rsi
+	movq	%rsi, 16(%rsp)
+.LVL149:
+	.loc 1 519 9 is_stmt 0 view .LVU392
+	movq	%rax, 24(%rsp)
+.LVL150:
+.L79:
+	.loc 1 519 9 view .LVU393
+.LBE104:
+	.loc 1 488 16 is_stmt 1 view .LVU394
+	.loc 1 488 29 is_stmt 0 view .LVU395
+	movq	%r14, %rdi
+	call	readdir@PLT
+.LVL151:
+	movq	%rax, %rbx
+.LVL152:
+	.loc 1 488 16 view .LVU396
+	testq	%rax, %rax
+	je	.L88
+.LBB105:
+	.loc 1 489 9 is_stmt 1 view .LVU397
+	.loc 1 490 9 view .LVU398
+	.loc 1 490 50 is_stmt 0 view .LVU399
+	leaq	19(%rbx), %r12
+	.loc 1 490 30 view .LVU400
+	movl	$0, %esi
+	movq	%r12, %rdi
+	call	is_entry_name
+.LVL153:
+	.loc 1 490 30 view .LVU401
+	movl	%eax, %ebp
+.LVL154:
+	.loc 1 491 9 is_stmt 1 view .LVU402
+	.loc 1 491 12 is_stmt 0 view .LVU403
+	testb	%al, %al
+	jne	.L80
+	.loc 1 491 31 discriminator 1 view .LVU404
+	movl	$46, %esi
+	movq	%r12, %rdi
+	call	is_entry_name
+.LVL155:
+	.loc 1 491 26 discriminator 1 view .LVU405
+	testb	%al, %al
+	je	.L79
+.L80:
+	.loc 1 492 22 view .LVU406
+	movl	$256, %ecx
+	movq	8(%rsp), %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	fstatat@PLT
+.LVL156:
+	.loc 1 492 13 view .LVU407
+	testl	%eax, %eax
+	jne	.L79
+	.loc 1 493 20 view .LVU408
+	movl	72(%rsp), %eax
+	andl	$61440, %eax
+	.loc 1 493 13 view .LVU409
+	cmpl	$32768, %eax
+	jne	.L79
+	.loc 1 499 9 is_stmt 1 view .LVU410
+	.loc 1 499 29 is_stmt 0 view .LVU411
+	movq	136(%rsp), %r15
+	.loc 1 499 18 view .LVU412
+	movq	32(%rsp), %rax
+	subq	%r15, %rax
+	.loc 1 499 12 view .LVU413
+	cmpq	$2592000, %rax
+	jg	.L101
+	.loc 1 504 9 is_stmt 1 view .LVU414
+	.loc 1 504 12 is_stmt 0 view .LVU415
+	testb	%bpl, %bpl
+	je	.L79
+	.loc 1 507 9 is_stmt 1 view .LVU416
+	.loc 1 507 12 is_stmt 0 view .LVU417
+	movq	40(%rsp), %rax
+	cmpq	%rax, 16(%rsp)
+	jne	.L95
+.LBB103:
+	.loc 1 508 13 is_stmt 1 view .LVU418
+	.loc 1 509 17 is_stmt 0 view .LVU419
+	leaq	(%rax,%rax), %rdx
+	testq	%rax, %rax
+	movl	$512, %eax
+	cmovne	%rdx, %rax
+	movq	%rax, 40(%rsp)
+.LVL157:
+	.loc 1 510 13 is_stmt 1 view .LVU420
+	.loc 1 511 17 is_stmt 0 view .LVU421
+	movq	%rax, %rsi
+	salq	$5, %rsi
+	movq	24(%rsp), %rdi
+	call	realloc@PLT
+.LVL158:
+	.loc 1 512 13 is_stmt 1 view .LVU422
+	.loc 1 512 16 is_stmt 0 view .LVU423
+	testq	%rax, %rax
+	jne	.L84
+.LVL159:
+.L88:
+	.loc 1 512 16 view .LVU424
+.LBE103:
+.LBE105:
+	.loc 1 522 5 is_stmt 1 view .LVU425
+	.loc 1 522 8 is_stmt 0 view .LVU426
+	cmpq	$256, 16(%rsp)
+	ja	.L102
+.LVL160:
+.L90:
+	.loc 1 529 5 is_stmt 1 view .LVU427
+	movq	24(%rsp), %rdi
+	call	free@PLT
+.LVL161:
+	.loc 1 530 5 view .LVU428
+	movq	%r14, %rdi
+	call	closedir@PLT
+.LVL162:
+.L76:
+	.loc 1 531 1 is_stmt 0 view .LVU429
+	movq	4296(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L103
+	addq	$4312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL163:
+.L102:
+	.cfi_restore_state
+	.loc 1 523 9 is_stmt 1 view .LVU430
+	leaq	compare_entry_age(%rip), %rcx
+	movl	$32, %edx
+	movq	16(%rsp), %rbx
+.LVL164:
+	.loc 1 523 9 is_stmt 0 view .LVU431
+	movq	%rbx, %rsi
+	movq	24(%rsp), %r15
+	movq	%r15, %rdi
+	call	qsort@PLT
+.LVL165:
+	.loc 1 524 9 is_stmt 1 view .LVU432
+.LBB106:
+	.loc 1 524 14 view .LVU433
+	.loc 1 524 27 view .LVU434
+	.loc 1 524 35 is_stmt 0 view .LVU435
+	subq	$256, %rbx
+	leaq	8(%r15), %rbp
+	.loc 1 524 21 view .LVU436
+	movl	$0, %r12d
+	.loc 1 525 54 view .LVU437
+	leaq	.LC10(%rip), %r15
+	jmp	.L92
+.LVL166:
+.L91:
+	.loc 1 525 16 is_stmt 1 discriminator 3 view .LVU438
+	.loc 1 526 13 discriminator 3 view .LVU439
+	movl	$0, %edx
+	movq	%rbp, %rsi
+	movl	%r13d, %edi
+	call	unlinkat@PLT
+.LVL167:
+	.loc 1 524 43 discriminator 3 view .LVU440
+	addq	$1, %r12
+.LVL168:
+	.loc 1 524 27 discriminator 3 view .LVU441
+	addq	$32, %rbp
+	cmpq	%rbx, %r12
+	je	.L90
+.LVL169:
+.L92:
+	.loc 1 525 13 view .LVU442
+	.loc 1 525 18 view .LVU443
+	.loc 1 525 21 is_stmt 0 view .LVU444
+	cmpl	$0, log_level(%rip)
+	jle	.L91
+	.loc 1 525 54 is_stmt 1 discriminator 1 view .LVU445
+	movq	%rbp, %rsi
+	movq	%r15, %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL170:
+	jmp	.L91
+.LVL171:
+.L103:
+	.loc 1 525 54 is_stmt 0 discriminator 1 view .LVU446
+.LBE106:
+	.loc 1 531 1 view .LVU447
+	call	__stack_chk_fail@PLT
+.LVL172:
+	.cfi_endproc
+.LFE80:
+	.size	sequence_cache_prune, .-sequence_cache_prune
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"sequence cache: could not open(2) %s: %s"
+	.align 8
+.LC12:
+	.string	"sequence cache: %s is not for this command line"
+	.section	.rodata.str1.1
+.LC13:
+	.string	"sequence cache: using %s"
+	.text
+	.globl	beep_sequence_cache_open
+	.type	beep_sequence_cache_open, @function
+beep_sequence_cache_open:
+.LVL173:
+.LFB75:
+	.loc 1 322 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 322 1 is_stmt 0 view .LVU449
+	endbr64
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%edi, %ebx
+	movq	%rsi, %rbp
+	movq	%rdx, %r14
+	.loc 1 323 5 is_stmt 1 view .LVU450
+	.loc 1 323 10 is_stmt 0 view .LVU451
+	call	sequence_cache_file_name
+.LVL174:
+	.loc 1 324 15 view .LVU452
+	movl	$0, %r13d
+	.loc 1 323 8 view .LVU453
+	testb	%al, %al
+	je	.L104
+	.loc 1 327 5 is_stmt 1 view .LVU454
+.LVL175:
+.LBB107:
+.LBI107:
+	.loc 5 41 1 view .LVU455
+.LBB108:
+	.loc 5 43 3 view .LVU456
+	.loc 5 46 3 view .LVU457
+	.loc 5 48 7 view .LVU458
+	.loc 5 53 7 view .LVU459
+	.loc 5 53 14 is_stmt 0 view .LVU460
+	movl	$524288, %esi
+	leaq	cache_name(%rip), %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL176:
+	movl	%eax, %r12d
+.LVL177:
+	.loc 5 53 14 view .LVU461
+.LBE108:
+.LBE107:
+	.loc 1 328 5 is_stmt 1 view .LVU462
+	.loc 1 328 8 is_stmt 0 view .LVU463
+	cmpl	$-1, %eax
+	je	.L113
+	.loc 1 333 5 is_stmt 1 view .LVU464
+	.loc 1 333 10 is_stmt 0 view .LVU465
+	movq	%r14, %rcx
+	movq	%rbp, %rdx
+	movl	%ebx, %esi
+	movl	%eax, %edi
+	call	sequence_cache_check
+.LVL178:
+	.loc 1 333 8 view .LVU466
+	testb	%al, %al
+	je	.L114
+	.loc 1 339 5 is_stmt 1 view .LVU467
+	.loc 1 339 31 is_stmt 0 view .LVU468
+	movl	$0, %ecx
+	movl	$0, %edx
+	leaq	cache_name(%rip), %rsi
+	movl	%r12d, %edi
+	call	beep_score_fdopen@PLT
+.LVL179:
+	movq	%rax, %r13
+.LVL180:
+	.loc 1 340 5 is_stmt 1 view .LVU469
+	.loc 1 340 8 is_stmt 0 view .LVU470
+	testq	%rax, %rax
+	je	.L115
+	.loc 1 344 5 is_stmt 1 view .LVU471
+	.loc 1 344 10 view .LVU472
+	.loc 1 344 13 is_stmt 0 view .LVU473
+	cmpl	$0, log_level(%rip)
+	jg	.L116
+.LVL181:
+.L104:
+	.loc 1 346 1 view .LVU474
+	movq	%r13, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LVL182:
+	.loc 1 346 1 view .LVU475
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL183:
+	.loc 1 346 1 view .LVU476
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL184:
+	.loc 1 346 1 view .LVU477
+	ret
+.LVL185:
+.L113:
+	.cfi_restore_state
+	.loc 1 329 9 is_stmt 1 view .LVU478
+	.loc 1 329 14 view .LVU479
+	.loc 1 329 17 is_stmt 0 view .LVU480
+	cmpl	$0, log_level(%rip)
+	jle	.L104
+	.loc 1 329 50 is_stmt 1 discriminator 1 view .LVU481
+	.loc 1 329 10 is_stmt 0 discriminator 1 view .LVU482
+	call	__errno_location@PLT
+.LVL186:
+	.loc 1 329 50 discriminator 1 view .LVU483
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL187:
+	movq	%rax, %rdx
+	leaq	cache_name(%rip), %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL188:
+	jmp	.L104
+.L114:
+	.loc 1 334 9 is_stmt 1 view .LVU484
+	.loc 1 334 14 view .LVU485
+	.loc 1 334 17 is_stmt 0 view .LVU486
+	cmpl	$0, log_level(%rip)
+	jg	.L117
+.L108:
+	.loc 1 334 12 is_stmt 1 discriminator 3 view .LVU487
+	.loc 1 336 9 discriminator 3 view .LVU488
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL189:
+	.loc 1 337 9 discriminator 3 view .LVU489
+	.loc 1 337 15 is_stmt 0 discriminator 3 view .LVU490
+	movl	$0, %r13d
+	jmp	.L104
+.L117:
+	.loc 1 334 50 is_stmt 1 discriminator 1 view .LVU491
+	leaq	cache_name(%rip), %rsi
+	leaq	.LC12(%rip), %rdi
+	call	log_verbose@PLT
+.LVL190:
+	jmp	.L108
+.LVL191:
+.L115:
+	.loc 1 341 9 view .LVU492
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL192:
+	.loc 1 342 9 view .LVU493
+	.loc 1 342 15 is_stmt 0 view .LVU494
+	jmp	.L104
+.LVL193:
+.L116:
+	.loc 1 344 46 is_stmt 1 discriminator 1 view .LVU495
+	leaq	cache_name(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$0, %eax
+.LVL194:
+	.loc 1 344 46 is_stmt 0 discriminator 1 view .LVU496
+	call	log_verbose@PLT
+.LVL195:
+	jmp	.L104
+	.cfi_endproc
+.LFE75:
+	.size	beep_sequence_cache_open, .-beep_sequence_cache_open
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"sequence cache: could not mkdir(2) %s: %s"
+	.section	.rodata.str1.1
+.LC15:
+	.string	"%s.%ld"
+.LC16:
+	.string	"wb"
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"sequence cache: could not write %s"
+	.text
+	.globl	beep_sequence_cache_create
+	.type	beep_sequence_cache_create, @function
+beep_sequence_cache_create:
+.LVL196:
+.LFB77:
+	.loc 1 370 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 370 1 is_stmt 0 view .LVU498
+	endbr64
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$4096, %rsp
+	.cfi_def_cfa_offset 4136
+	orq	$0, (%rsp)
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 4336
+	movl	%edi, %ebp
+	movq	%rsi, %r12
+	movq	%rdx, %rbx
+	.loc 1 370 1 view .LVU499
+	movq	%fs:40, %rax
+	movq	%rax, 4280(%rsp)
+	xorl	%eax, %eax
+	.loc 1 371 5 is_stmt 1 view .LVU500
+	.loc 1 372 5 view .LVU501
+	.loc 1 372 11 is_stmt 0 view .LVU502
+	leaq	176(%rsp), %rdi
+.LVL197:
+	.loc 1 372 11 view .LVU503
+	movl	$4096, %esi
+.LVL198:
+	.loc 1 372 11 view .LVU504
+	call	sequence_cache_dir
+.LVL199:
+	.loc 1 372 11 view .LVU505
+	movl	%eax, %edx
+	.loc 1 376 15 view .LVU506
+	movl	$0, %eax
+	.loc 1 372 8 view .LVU507
+	testb	%dl, %dl
+	je	.L118
+	.loc 1 373 14 view .LVU508
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	sequence_cache_file_name
+.LVL200:
+	.loc 1 373 9 view .LVU509
+	testb	%al, %al
+	je	.L132
+	.loc 1 374 9 view .LVU510
+	movl	$4294967295, %eax
+	cmpq	key_size(%rip), %rax
+	jb	.L133
+	.loc 1 376 15 view .LVU511
+	movl	$0, %eax
+	.loc 1 375 9 view .LVU512
+	cmpq	$16, 8(%rbx)
+	ja	.L118
+	.loc 1 378 5 is_stmt 1 view .LVU513
+.LVL201:
+.LBB124:
+.LBI124:
+	.loc 1 351 5 view .LVU514
+.LBB125:
+	.loc 1 353 5 view .LVU515
+	.loc 1 353 15 is_stmt 0 view .LVU516
+	leaq	176(%rsp), %rdi
+.LVL202:
+	.loc 1 353 15 view .LVU517
+	movl	$448, %esi
+	call	mkdir@PLT
+.LVL203:
+	.loc 1 353 8 view .LVU518
+	testl	%eax, %eax
+	je	.L120
+	.loc 1 353 38 view .LVU519
+	call	__errno_location@PLT
+.LVL204:
+	movq	%rax, %rbp
+.LVL205:
+	.loc 1 353 37 view .LVU520
+	movl	(%rax), %r13d
+	.loc 1 353 33 view .LVU521
+	cmpl	$17, %r13d
+	je	.L120
+	.loc 1 356 5 is_stmt 1 view .LVU522
+	.loc 1 356 25 is_stmt 0 view .LVU523
+	leaq	176(%rsp), %rdi
+.LVL206:
+	.loc 1 356 25 view .LVU524
+	movl	$47, %esi
+	call	strrchr@PLT
+.LVL207:
+	.loc 1 356 25 view .LVU525
+	movq	%rax, %r12
+.LVL208:
+	.loc 1 357 5 is_stmt 1 view .LVU526
+	.loc 1 357 8 is_stmt 0 view .LVU527
+	cmpl	$2, %r13d
+	jne	.L121
+	.loc 1 357 38 view .LVU528
+	testq	%rax, %rax
+	je	.L121
+	.loc 1 357 48 view .LVU529
+	leaq	176(%rsp), %rax
+.LVL209:
+	.loc 1 357 38 view .LVU530
+	cmpq	%rax, %r12
+	je	.L121
+	.loc 1 360 5 is_stmt 1 view .LVU531
+	.loc 1 360 12 is_stmt 0 view .LVU532
+	movb	$0, (%r12)
+	.loc 1 361 5 is_stmt 1 view .LVU533
+	.loc 1 361 34 is_stmt 0 view .LVU534
+	movq	%rax, %rdi
+	movl	$448, %esi
+	call	mkdir@PLT
+.LVL210:
+	.loc 1 361 52 view .LVU535
+	testl	%eax, %eax
+	je	.L122
+.LVL211:
+	.loc 1 362 5 is_stmt 1 view .LVU536
+	.loc 1 362 12 is_stmt 0 view .LVU537
+	movb	$47, (%r12)
+	.loc 1 363 5 is_stmt 1 view .LVU538
+	.loc 1 363 22 is_stmt 0 view .LVU539
+	cmpl	$17, 0(%rbp)
+	je	.L129
+.LVL212:
+.L121:
+	.loc 1 363 22 view .LVU540
+.LBE125:
+.LBE124:
+	.loc 1 379 9 is_stmt 1 view .LVU541
+	.loc 1 379 14 view .LVU542
+	.loc 1 381 15 is_stmt 0 view .LVU543
+	movl	$0, %eax
+	.loc 1 379 17 view .LVU544
+	cmpl	$0, log_level(%rip)
+	jle	.L118
+	.loc 1 379 50 is_stmt 1 discriminator 1 view .LVU545
+	movl	0(%rbp), %edi
+	call	strerror@PLT
+.LVL213:
+	movq	%rax, %rdx
+	leaq	176(%rsp), %rsi
+	leaq	.LC14(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL214:
+	.loc 1 381 15 is_stmt 0 discriminator 1 view .LVU546
+	movl	$0, %eax
+	jmp	.L118
+.LVL215:
+.L139:
+	.loc 1 388 9 is_stmt 1 view .LVU547
+	.loc 1 388 14 view .LVU548
+	.loc 1 390 15 is_stmt 0 view .LVU549
+	movl	$0, %eax
+.LVL216:
+	.loc 1 388 17 view .LVU550
+	cmpl	$0, log_level(%rip)
+	jle	.L118
+	.loc 1 388 50 is_stmt 1 discriminator 1 view .LVU551
+	.loc 1 388 10 is_stmt 0 discriminator 1 view .LVU552
+	call	__errno_location@PLT
+.LVL217:
+	.loc 1 388 50 discriminator 1 view .LVU553
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL218:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL219:
+	.loc 1 390 15 discriminator 1 view .LVU554
+	movl	$0, %eax
+	jmp	.L118
+.LVL220:
+.L140:
+	.loc 1 394 9 is_stmt 1 view .LVU555
+	movl	%r12d, %edi
+	call	close@PLT
+.LVL221:
+	.loc 1 395 9 view .LVU556
+	leaq	tmp_name(%rip), %rdi
+	call	unlink@PLT
+.LVL222:
+	.loc 1 396 9 view .LVU557
+	.loc 1 396 15 is_stmt 0 view .LVU558
+	movq	%rbp, %rax
+	jmp	.L118
+.L141:
+	.loc 1 418 30 discriminator 1 view .LVU559
+	movq	%rbp, %rdi
+	call	beep_score_fcreate@PLT
+.LVL223:
+	.loc 1 419 5 is_stmt 1 discriminator 1 view .LVU560
+	.loc 1 419 8 is_stmt 0 discriminator 1 view .LVU561
+	testq	%rax, %rax
+	jne	.L118
+	.loc 1 419 8 discriminator 1 view .LVU562
+	jmp	.L127
+.LVL224:
+.L142:
+	.loc 1 420 50 is_stmt 1 discriminator 1 view .LVU563
+	leaq	tmp_name(%rip), %rsi
+	leaq	.LC17(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL225:
+	jmp	.L128
+.LVL226:
+.L132:
+	.loc 1 376 15 is_stmt 0 view .LVU564
+	movl	$0, %eax
+	jmp	.L118
+.L133:
+	movl	$0, %eax
+	jmp	.L118
+.LVL227:
+.L122:
+.LBB127:
+.LBB126:
+	.loc 1 362 5 is_stmt 1 view .LVU565
+	.loc 1 362 12 is_stmt 0 view .LVU566
+	movb	$47, (%r12)
+	.loc 1 363 5 is_stmt 1 view .LVU567
+.LVL228:
+.L129:
+	.loc 1 363 31 is_stmt 0 view .LVU568
+	leaq	176(%rsp), %rdi
+.LVL229:
+	.loc 1 363 31 view .LVU569
+	movl	$448, %esi
+	call	mkdir@PLT
+.LVL230:
+	.loc 1 363 31 view .LVU570
+.LBE126:
+.LBE127:
+	.loc 1 378 8 view .LVU571
+	testl	%eax, %eax
+	jne	.L121
+.L120:
+	.loc 1 384 5 is_stmt 1 view .LVU572
+	.loc 1 385 32 is_stmt 0 view .LVU573
+	call	getpid@PLT
+.LVL231:
+.LBB128:
+.LBI128:
+	.loc 3 51 42 is_stmt 1 view .LVU574
+.LBB129:
+	.loc 3 54 3 view .LVU575
+	.loc 3 54 10 is_stmt 0 view .LVU576
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 4344
+.LBE129:
+.LBE128:
+	.loc 1 384 5 view .LVU577
+	cltq
+.LBB131:
+.LBB130:
+	.loc 3 54 10 view .LVU578
+	pushq	%rax
+	.cfi_def_cfa_offset 4352
+	leaq	cache_name(%rip), %r9
+	leaq	.LC15(%rip), %r8
+	movl	$4128, %ecx
+	movl	$1, %edx
+	movl	$4128, %esi
+	leaq	tmp_name(%rip), %rbp
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	__snprintf_chk@PLT
+.LVL232:
+	.loc 3 54 10 view .LVU579
+.LBE130:
+.LBE131:
+	.loc 1 386 5 is_stmt 1 view .LVU580
+.LBB132:
+.LBI132:
+	.loc 5 41 1 view .LVU581
+.LBB133:
+	.loc 5 43 3 view .LVU582
+	.loc 5 46 3 view .LVU583
+	.loc 5 48 7 view .LVU584
+	.loc 5 53 7 view .LVU585
+	.loc 5 53 14 is_stmt 0 view .LVU586
+	movl	$384, %edx
+	movl	$524865, %esi
+	movq	%rbp, %rdi
+	movl	$0, %eax
+	call	open@PLT
+.LVL233:
+	movl	%eax, %r12d
+.LVL234:
+	.loc 5 53 14 view .LVU587
+.LBE133:
+.LBE132:
+	.loc 1 387 5 is_stmt 1 view .LVU588
+	.loc 1 387 8 is_stmt 0 view .LVU589
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 4336
+	cmpl	$-1, %eax
+	je	.L139
+	.loc 1 392 5 is_stmt 1 view .LVU590
+	.loc 1 392 24 is_stmt 0 view .LVU591
+	leaq	.LC16(%rip), %rsi
+	movl	%eax, %edi
+	call	fdopen@PLT
+.LVL235:
+	.loc 1 392 24 view .LVU592
+	movq	%rax, %rbp
+.LVL236:
+	.loc 1 393 5 is_stmt 1 view .LVU593
+	.loc 1 393 8 is_stmt 0 view .LVU594
+	testq	%rax, %rax
+	je	.L140
+	.loc 1 399 5 is_stmt 1 view .LVU595
+	.loc 1 400 5 view .LVU596
+.LVL237:
+.LBB134:
+.LBI134:
+	.loc 2 57 42 view .LVU597
+.LBB135:
+	.loc 2 59 3 view .LVU598
+	.loc 2 59 10 is_stmt 0 view .LVU599
+	movq	$0, 36(%rsp)
+	movq	$0, 168(%rsp)
+	leaq	40(%rsp), %rdi
+	movl	$17, %ecx
+	movl	$0, %eax
+.LVL238:
+	.loc 2 59 10 view .LVU600
+	rep stosq
+.LVL239:
+	.loc 2 59 10 view .LVU601
+.LBE135:
+.LBE134:
+	.loc 1 401 5 is_stmt 1 view .LVU602
+.LBB136:
+.LBI136:
+	.loc 2 26 42 view .LVU603
+.LBB137:
+	.loc 2 29 3 view .LVU604
+	.loc 2 29 10 is_stmt 0 view .LVU605
+	movabsq	$6000855468967544130, %rax
+	movq	%rax, 16(%rsp)
+.LVL240:
+	.loc 2 29 10 view .LVU606
+.LBE137:
+.LBE136:
+	.loc 1 402 5 is_stmt 1 view .LVU607
+	.loc 1 402 26 is_stmt 0 view .LVU608
+	movl	$2, 24(%rsp)
+	.loc 1 403 5 is_stmt 1 view .LVU609
+	.loc 1 403 26 is_stmt 0 view .LVU610
+	movl	$1, 28(%rsp)
+	.loc 1 404 5 is_stmt 1 view .LVU611
+	.loc 1 404 23 is_stmt 0 view .LVU612
+	movq	key_size(%rip), %rax
+	movl	%eax, 32(%rsp)
+	.loc 1 405 5 is_stmt 1 view .LVU613
+.LBB138:
+.LBI138:
+	.loc 1 225 10 view .LVU614
+.LBB139:
+	.loc 1 227 5 view .LVU615
+	.loc 1 228 5 view .LVU616
+	.loc 1 228 22 is_stmt 0 view .LVU617
+	leaq	8(%rsp), %rdx
+	movl	$6, %esi
+	leaq	.LC7(%rip), %rdi
+	call	sequence_cache_hash
+.LVL241:
+	.loc 1 228 12 view .LVU618
+	movl	%eax, 172(%rsp)
+.LBE139:
+.LBE138:
+	.loc 1 406 5 is_stmt 1 view .LVU619
+	.loc 1 406 22 is_stmt 0 view .LVU620
+	movl	(%rbx), %eax
+	movl	%eax, 36(%rsp)
+	.loc 1 407 5 is_stmt 1 view .LVU621
+	.loc 1 407 45 is_stmt 0 view .LVU622
+	movq	8(%rbx), %rcx
+	.loc 1 407 27 view .LVU623
+	movl	%ecx, 40(%rsp)
+	.loc 1 408 5 is_stmt 1 view .LVU624
+.LBB140:
+	.loc 1 408 10 view .LVU625
+.LVL242:
+	.loc 1 408 23 view .LVU626
+	testq	%rcx, %rcx
+	je	.L125
+	leaq	80(%rbx), %rax
+	leaq	108(%rsp), %rdx
+	leaq	(%rax,%rcx,4), %rsi
+.LVL243:
+.L126:
+	.loc 1 409 9 discriminator 3 view .LVU627
+	.loc 1 409 30 is_stmt 0 discriminator 3 view .LVU628
+	movl	-64(%rax), %ecx
+	movl	%ecx, -64(%rdx)
+	.loc 1 410 9 is_stmt 1 discriminator 3 view .LVU629
+	.loc 1 410 33 is_stmt 0 discriminator 3 view .LVU630
+	movl	(%rax), %ecx
+	movl	%ecx, (%rdx)
+	.loc 1 408 48 is_stmt 1 discriminator 3 view .LVU631
+	.loc 1 408 23 discriminator 3 view .LVU632
+	addq	$4, %rax
+	addq	$4, %rdx
+	cmpq	%rsi, %rax
+	jne	.L126
+.L125:
+.LBE140:
+	.loc 1 412 5 view .LVU633
+	leaq	16(%rsp), %rdi
+	movq	%rbp, %rcx
+	movl	$1, %edx
+	movl	$160, %esi
+	call	fwrite@PLT
+.LVL244:
+	.loc 1 413 5 view .LVU634
+	movq	%rbp, %rcx
+	movl	$1, %edx
+	movq	key_size(%rip), %rsi
+	movq	key(%rip), %rdi
+	call	fwrite@PLT
+.LVL245:
+	.loc 1 414 5 view .LVU635
+	.loc 1 415 5 view .LVU636
+	.loc 1 415 21 is_stmt 0 view .LVU637
+	movq	key_size(%rip), %rax
+.LVL246:
+.LBB141:
+.LBI141:
+	.loc 1 262 8 is_stmt 1 view .LVU638
+.LBB142:
+	.loc 1 264 5 view .LVU639
+	.loc 1 264 22 is_stmt 0 view .LVU640
+	leaq	7(%rax), %rsi
+	.loc 1 264 27 view .LVU641
+	andq	$-8, %rsi
+.LBE142:
+.LBE141:
+	.loc 1 415 5 view .LVU642
+	subq	%rax, %rsi
+	movq	%rbp, %rcx
+	movl	$1, %edx
+	leaq	padding.0(%rip), %rdi
+	call	fwrite@PLT
+.LVL247:
+	.loc 1 417 5 is_stmt 1 view .LVU643
+	.loc 1 418 9 is_stmt 0 view .LVU644
+	movq	%rbp, %rdi
+	call	ferror@PLT
+.LVL248:
+	.loc 1 418 28 view .LVU645
+	testl	%eax, %eax
+	je	.L141
+.L127:
+	.loc 1 420 9 is_stmt 1 view .LVU646
+	.loc 1 420 14 view .LVU647
+	.loc 1 420 17 is_stmt 0 view .LVU648
+	cmpl	$0, log_level(%rip)
+	jg	.L142
+.L128:
+	.loc 1 420 12 is_stmt 1 discriminator 3 view .LVU649
+	.loc 1 421 9 discriminator 3 view .LVU650
+	movq	%rbp, %rdi
+	call	fclose@PLT
+.LVL249:
+	.loc 1 422 9 discriminator 3 view .LVU651
+	leaq	tmp_name(%rip), %rdi
+	call	unlink@PLT
+.LVL250:
+	movl	$0, %eax
+.LVL251:
+.L118:
+	.loc 1 425 1 is_stmt 0 view .LVU652
+	movq	4280(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L143
+	addq	$4296, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL252:
+	.loc 1 425 1 view .LVU653
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL253:
+.L143:
+	.cfi_restore_state
+	.loc 1 425 1 view .LVU654
+	call	__stack_chk_fail@PLT
+.LVL254:
+	.cfi_endproc
+.LFE77:
+	.size	beep_sequence_cache_create, .-beep_sequence_cache_create
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"sequence cache: could not write %s: %s"
+	.section	.rodata.str1.1
+.LC19:
+	.string	"sequence cache: stored %s"
+	.text
+	.globl	beep_sequence_cache_commit
+	.type	beep_sequence_cache_commit, @function
+beep_sequence_cache_commit:
+.LVL255:
+.LFB81:
+	.loc 1 535 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 535 1 is_stmt 0 view .LVU656
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 536 5 is_stmt 1 view .LVU657
+	.loc 1 536 11 is_stmt 0 view .LVU658
+	call	beep_score_finish@PLT
+.LVL256:
+	.loc 1 536 8 view .LVU659
+	testb	%al, %al
+	jne	.L151
+.L145:
+	.loc 1 537 9 is_stmt 1 view .LVU660
+	.loc 1 537 14 view .LVU661
+	.loc 1 537 17 is_stmt 0 view .LVU662
+	cmpl	$0, log_level(%rip)
+	jg	.L152
+.L147:
+	.loc 1 537 12 is_stmt 1 discriminator 3 view .LVU663
+	.loc 1 539 9 discriminator 3 view .LVU664
+	leaq	tmp_name(%rip), %rdi
+	call	unlink@PLT
+.LVL257:
+	.loc 1 540 9 discriminator 3 view .LVU665
+	.loc 1 540 15 is_stmt 0 discriminator 3 view .LVU666
+	movl	$0, %ebx
+.L144:
+	.loc 1 545 1 view .LVU667
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L151:
+	.cfi_restore_state
+	movl	%eax, %ebx
+	.loc 1 536 48 discriminator 1 view .LVU668
+	leaq	cache_name(%rip), %rsi
+	leaq	tmp_name(%rip), %rdi
+	call	rename@PLT
+.LVL258:
+	.loc 1 536 38 discriminator 1 view .LVU669
+	cmpl	$-1, %eax
+	je	.L145
+	.loc 1 542 5 is_stmt 1 view .LVU670
+	.loc 1 542 10 view .LVU671
+	.loc 1 542 13 is_stmt 0 view .LVU672
+	cmpl	$0, log_level(%rip)
+	jg	.L153
+.L149:
+	.loc 1 542 8 is_stmt 1 discriminator 3 view .LVU673
+	.loc 1 543 5 discriminator 3 view .LVU674
+	call	sequence_cache_prune
+.LVL259:
+	.loc 1 544 5 discriminator 3 view .LVU675
+	.loc 1 544 11 is_stmt 0 discriminator 3 view .LVU676
+	jmp	.L144
+.L152:
+	.loc 1 537 50 is_stmt 1 discriminator 1 view .LVU677
+	.loc 1 537 10 is_stmt 0 discriminator 1 view .LVU678
+	call	__errno_location@PLT
+.LVL260:
+	.loc 1 537 50 discriminator 1 view .LVU679
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL261:
+	movq	%rax, %rdx
+	leaq	cache_name(%rip), %rsi
+	leaq	.LC18(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL262:
+	jmp	.L147
+.L153:
+	.loc 1 542 46 is_stmt 1 discriminator 1 view .LVU680
+	leaq	cache_name(%rip), %rsi
+	leaq	.LC19(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL263:
+	jmp	.L149
+	.cfi_endproc
+.LFE81:
+	.size	beep_sequence_cache_commit, .-beep_sequence_cache_commit
+	.section	.rodata
+	.align 8
+	.type	padding.0, @object
+	.size	padding.0, 8
+padding.0:
+	.zero	8
+	.local	key_size
+	.comm	key_size,8,8
+	.local	key
+	.comm	key,8,8
+	.local	tmp_name
+	.comm	tmp_name,4128,32
+	.local	cache_name
+	.comm	cache_name,4096,32
+	.text
+.Letext0:
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 14 "/usr/include/stdlib.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/dirent.h"
+	.file 17 "beep-score.h"
+	.file 18 "beep-sequence-cache.h"
+	.file 19 "/usr/include/dirent.h"
+	.file 20 "/usr/include/unistd.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 22 "/usr/include/time.h"
+	.file 23 "/usr/include/string.h"
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 25 "beep-log.h"
+	.file 26 "/usr/include/errno.h"
+	.file 27 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2664
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x41
+	.long	.LASF223
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x6
+	.long	.LASF9
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x9
+	.long	0x35
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x4d
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.long	0x67
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x6
+	.long	.LASF10
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x6
+	.long	.LASF11
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF12
+	.byte	0x7
+	.byte	0x91
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF13
+	.byte	0x7
+	.byte	0x92
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x7
+	.byte	0x93
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x7
+	.byte	0x94
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x7
+	.byte	0x96
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x7
+	.byte	0x97
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x7
+	.byte	0x98
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x99
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x7
+	.byte	0x9a
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x7
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x43
+	.byte	0x8
+	.uleb128 0x17
+	.long	0x111
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x7
+	.byte	0xaf
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x7
+	.byte	0xb4
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x7
+	.byte	0xc2
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x7
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x7
+	.long	0x157
+	.uleb128 0x9
+	.long	0x148
+	.uleb128 0x17
+	.long	0x148
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF26
+	.uleb128 0x9
+	.long	0x157
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x14
+	.long	0x81
+	.uleb128 0x9
+	.long	0x163
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x9
+	.long	0x174
+	.uleb128 0x22
+	.long	.LASF66
+	.byte	0xd8
+	.byte	0x9
+	.byte	0x31
+	.long	0x30b
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x9
+	.byte	0x33
+	.byte	0x7
+	.long	0x4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x36
+	.byte	0x9
+	.long	0x148
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x37
+	.byte	0x9
+	.long	0x148
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x38
+	.byte	0x9
+	.long	0x148
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0x148
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x9
+	.long	0x148
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x9
+	.long	0x148
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x9
+	.long	0x148
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x9
+	.long	0x148
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x40
+	.byte	0x9
+	.long	0x148
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x41
+	.byte	0x9
+	.long	0x148
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x42
+	.byte	0x9
+	.long	0x148
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x44
+	.byte	0x16
+	.long	0x324
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x46
+	.byte	0x14
+	.long	0x329
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x48
+	.byte	0x7
+	.long	0x4d
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x49
+	.byte	0x7
+	.long	0x4d
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xb
+	.long	0xe1
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x12
+	.long	0x60
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xf
+	.long	0x73
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x8
+	.long	0x32e
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x51
+	.byte	0xf
+	.long	0x33e
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xed
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x17
+	.long	0x348
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x19
+	.long	0x352
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x14
+	.long	0x329
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x9
+	.long	0x111
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x60
+	.byte	0x7
+	.long	0x4d
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x62
+	.byte	0x8
+	.long	0x357
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x7
+	.byte	0x19
+	.long	0x185
+	.uleb128 0x44
+	.long	.LASF224
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x18
+	.long	.LASF59
+	.uleb128 0x7
+	.long	0x31f
+	.uleb128 0x7
+	.long	0x185
+	.uleb128 0x13
+	.long	0x157
+	.long	0x33e
+	.uleb128 0x15
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x317
+	.uleb128 0x18
+	.long	.LASF60
+	.uleb128 0x7
+	.long	0x343
+	.uleb128 0x18
+	.long	.LASF61
+	.uleb128 0x7
+	.long	0x34d
+	.uleb128 0x13
+	.long	0x157
+	.long	0x367
+	.uleb128 0x15
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x11
+	.long	0xe1
+	.uleb128 0x9
+	.long	0x367
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x13
+	.long	0x130
+	.uleb128 0x7
+	.long	0x30b
+	.uleb128 0x17
+	.long	0x384
+	.uleb128 0x9
+	.long	0x384
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF64
+	.uleb128 0x6
+	.long	.LASF65
+	.byte	0xc
+	.byte	0xa
+	.byte	0x12
+	.long	0x105
+	.uleb128 0x9
+	.long	0x39a
+	.uleb128 0x22
+	.long	.LASF67
+	.byte	0x10
+	.byte	0xd
+	.byte	0xb
+	.long	0x3d2
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0xd
+	.byte	0x10
+	.byte	0xc
+	.long	0x105
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0xd
+	.byte	0x15
+	.byte	0x15
+	.long	0x13c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF70
+	.uleb128 0x13
+	.long	0x157
+	.long	0x3e9
+	.uleb128 0x15
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF71
+	.byte	0xe
+	.value	0x33d
+	.byte	0xf
+	.long	0x3f6
+	.uleb128 0x7
+	.long	0x3fb
+	.uleb128 0x45
+	.long	0x4d
+	.long	0x40f
+	.uleb128 0x2
+	.long	0x40f
+	.uleb128 0x2
+	.long	0x40f
+	.byte	0
+	.uleb128 0x7
+	.long	0x419
+	.uleb128 0x17
+	.long	0x40f
+	.uleb128 0x46
+	.uleb128 0x22
+	.long	.LASF72
+	.byte	0x90
+	.byte	0xf
+	.byte	0x1a
+	.long	0x4ea
+	.uleb128 0x3
+	.long	.LASF73
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xd
+	.long	0x99
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF74
+	.byte	0xf
+	.byte	0x24
+	.byte	0xd
+	.long	0xbd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd5
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF76
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc9
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF77
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0xa5
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF78
+	.byte	0xf
+	.byte	0x30
+	.byte	0xd
+	.long	0xb1
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF79
+	.byte	0xf
+	.byte	0x32
+	.byte	0x9
+	.long	0x4d
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF80
+	.byte	0xf
+	.byte	0x34
+	.byte	0xd
+	.long	0x99
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF81
+	.byte	0xf
+	.byte	0x39
+	.byte	0xd
+	.long	0xe1
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF82
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x11
+	.long	0x118
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF83
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x10
+	.long	0x124
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF84
+	.byte	0xf
+	.byte	0x4a
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF85
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF86
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x15
+	.long	0x3ab
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF87
+	.byte	0xf
+	.byte	0x59
+	.byte	0x17
+	.long	0x4ea
+	.byte	0x78
+	.byte	0
+	.uleb128 0x13
+	.long	0x13c
+	.long	0x4fa
+	.uleb128 0x15
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x15e
+	.uleb128 0x9
+	.long	0x4fa
+	.uleb128 0x17
+	.long	0x4fa
+	.uleb128 0x47
+	.long	.LASF88
+	.value	0x118
+	.byte	0x10
+	.byte	0x16
+	.byte	0x8
+	.long	0x559
+	.uleb128 0x3
+	.long	.LASF89
+	.byte	0x10
+	.byte	0x19
+	.byte	0xd
+	.long	0xbd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF90
+	.byte	0x10
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe1
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF91
+	.byte	0x10
+	.byte	0x1f
+	.byte	0x18
+	.long	0x60
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF92
+	.byte	0x10
+	.byte	0x20
+	.byte	0x13
+	.long	0x59
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF93
+	.byte	0x10
+	.byte	0x21
+	.byte	0xa
+	.long	0x559
+	.byte	0x13
+	.byte	0
+	.uleb128 0x13
+	.long	0x157
+	.long	0x569
+	.uleb128 0x15
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x48
+	.string	"DIR"
+	.byte	0x13
+	.byte	0x7f
+	.byte	0x1c
+	.long	0x575
+	.uleb128 0x18
+	.long	.LASF94
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF95
+	.uleb128 0x9
+	.long	0x57a
+	.uleb128 0x6
+	.long	.LASF96
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x1c
+	.long	0x592
+	.uleb128 0x18
+	.long	.LASF97
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x11
+	.byte	0x3f
+	.byte	0x23
+	.long	0x5a3
+	.uleb128 0x18
+	.long	.LASF99
+	.uleb128 0x31
+	.byte	0x90
+	.byte	0x12
+	.byte	0x32
+	.long	0x5e5
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0x12
+	.byte	0x33
+	.byte	0x9
+	.long	0x4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF101
+	.byte	0x12
+	.byte	0x34
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0x12
+	.byte	0x35
+	.byte	0xe
+	.long	0x5e5
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF103
+	.byte	0x12
+	.byte	0x36
+	.byte	0xe
+	.long	0x5e5
+	.byte	0x50
+	.byte	0
+	.uleb128 0x13
+	.long	0x163
+	.long	0x5f5
+	.uleb128 0x15
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF104
+	.byte	0x12
+	.byte	0x37
+	.byte	0x3
+	.long	0x5a8
+	.uleb128 0x9
+	.long	0x5f5
+	.uleb128 0x49
+	.long	.LASF100
+	.byte	0x19
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x13
+	.long	0x157
+	.long	0x623
+	.uleb128 0x32
+	.long	0x46
+	.value	0xfff
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF105
+	.byte	0x5f
+	.byte	0xd
+	.long	0x612
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.uleb128 0x13
+	.long	0x157
+	.long	0x649
+	.uleb128 0x32
+	.long	0x46
+	.value	0x101f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF106
+	.byte	0x60
+	.byte	0xd
+	.long	0x638
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.uleb128 0x31
+	.byte	0xa0
+	.byte	0x1
+	.byte	0x63
+	.long	0x6dc
+	.uleb128 0x3
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x64
+	.byte	0xa
+	.long	0x3d9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x1
+	.byte	0x65
+	.byte	0xe
+	.long	0x163
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF109
+	.byte	0x1
+	.byte	0x66
+	.byte	0xe
+	.long	0x163
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF110
+	.byte	0x1
+	.byte	0x67
+	.byte	0xe
+	.long	0x163
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0x1
+	.byte	0x68
+	.byte	0xe
+	.long	0x163
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF101
+	.byte	0x1
+	.byte	0x69
+	.byte	0xe
+	.long	0x163
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x6a
+	.byte	0xe
+	.long	0x5e5
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF103
+	.byte	0x1
+	.byte	0x6b
+	.byte	0xe
+	.long	0x5e5
+	.byte	0x5c
+	.uleb128 0x3
+	.long	.LASF111
+	.byte	0x1
+	.byte	0x6c
+	.byte	0xe
+	.long	0x163
+	.byte	0x9c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF112
+	.byte	0x1
+	.byte	0x6d
+	.byte	0x3
+	.long	0x65e
+	.uleb128 0x33
+	.string	"key"
+	.byte	0x8a
+	.byte	0x14
+	.long	0x4fa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	key
+	.uleb128 0x23
+	.long	.LASF110
+	.byte	0x8b
+	.byte	0xf
+	.long	0x35
+	.uleb128 0x9
+	.byte	0x3
+	.quad	key_size
+	.uleb128 0x4a
+	.byte	0x20
+	.byte	0x1
+	.value	0x1bc
+	.byte	0x9
+	.long	0x737
+	.uleb128 0x34
+	.long	.LASF113
+	.value	0x1bd
+	.byte	0xc
+	.long	0x39a
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF114
+	.value	0x1be
+	.byte	0xa
+	.long	0x737
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	0x157
+	.long	0x747
+	.uleb128 0x15
+	.long	0x46
+	.byte	0x10
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF115
+	.byte	0x1
+	.value	0x1bf
+	.byte	0x3
+	.long	0x712
+	.uleb128 0xd
+	.long	.LASF118
+	.byte	0x13
+	.byte	0x86
+	.byte	0xc
+	.long	0x4d
+	.long	0x76a
+	.uleb128 0x2
+	.long	0x76a
+	.byte	0
+	.uleb128 0x7
+	.long	0x569
+	.uleb128 0x9
+	.long	0x76a
+	.uleb128 0x35
+	.long	.LASF116
+	.value	0x238
+	.long	0x785
+	.uleb128 0x2
+	.long	0x111
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF117
+	.value	0x353
+	.long	0x7a5
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x3e9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF119
+	.byte	0x13
+	.byte	0xa4
+	.byte	0x17
+	.long	0x7bb
+	.long	0x7bb
+	.uleb128 0x2
+	.long	0x76a
+	.byte	0
+	.uleb128 0x7
+	.long	0x509
+	.uleb128 0xe
+	.long	.LASF120
+	.byte	0xe
+	.value	0x234
+	.byte	0xe
+	.long	0x111
+	.long	0x7dc
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF121
+	.byte	0x14
+	.value	0x35e
+	.byte	0xc
+	.long	0x4d
+	.long	0x7fd
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF122
+	.byte	0x15
+	.value	0x108
+	.byte	0xc
+	.long	0x4d
+	.long	0x823
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x504
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x7
+	.long	0x41a
+	.uleb128 0x17
+	.long	0x823
+	.uleb128 0xd
+	.long	.LASF123
+	.byte	0x16
+	.byte	0x4c
+	.byte	0xf
+	.long	0x39a
+	.long	0x843
+	.uleb128 0x2
+	.long	0x843
+	.byte	0
+	.uleb128 0x7
+	.long	0x39a
+	.uleb128 0xd
+	.long	.LASF124
+	.byte	0x13
+	.byte	0x95
+	.byte	0xd
+	.long	0x76a
+	.long	0x85e
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF125
+	.byte	0xb
+	.byte	0x9a
+	.byte	0xc
+	.long	0x4d
+	.long	0x879
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0x4fa
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF126
+	.byte	0x11
+	.byte	0x8c
+	.byte	0x5
+	.long	0x57a
+	.long	0x88f
+	.uleb128 0x2
+	.long	0x88f
+	.byte	0
+	.uleb128 0x7
+	.long	0x597
+	.uleb128 0x9
+	.long	0x88f
+	.uleb128 0xe
+	.long	.LASF127
+	.byte	0x17
+	.value	0x111
+	.byte	0xe
+	.long	0x148
+	.long	0x8b5
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF128
+	.byte	0x15
+	.value	0x185
+	.byte	0xc
+	.long	0x4d
+	.long	0x8d1
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0xc9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF129
+	.byte	0xb
+	.byte	0xb2
+	.byte	0xc
+	.long	0x4d
+	.long	0x8e7
+	.uleb128 0x2
+	.long	0x384
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF130
+	.byte	0x11
+	.byte	0x7c
+	.byte	0x14
+	.long	0x88f
+	.long	0x8fd
+	.uleb128 0x2
+	.long	0x384
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF131
+	.byte	0xb
+	.value	0x316
+	.byte	0xc
+	.long	0x4d
+	.long	0x914
+	.uleb128 0x2
+	.long	0x384
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF132
+	.byte	0xb
+	.value	0x2a9
+	.byte	0xf
+	.long	0x35
+	.long	0x93a
+	.uleb128 0x2
+	.long	0x414
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x389
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF133
+	.byte	0x14
+	.value	0x35a
+	.byte	0xc
+	.long	0x4d
+	.long	0x951
+	.uleb128 0x2
+	.long	0x4fa
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF134
+	.byte	0xb
+	.value	0x125
+	.byte	0xe
+	.long	0x384
+	.long	0x96d
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4fa
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF156
+	.byte	0x14
+	.value	0x28a
+	.byte	0x10
+	.long	0xf9
+	.uleb128 0xd
+	.long	.LASF135
+	.byte	0x4
+	.byte	0x17
+	.byte	0x10
+	.long	0x378
+	.long	0x99f
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF136
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x10
+	.long	.LASF135
+	.long	0x378
+	.long	0x9c8
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF137
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x10
+	.long	.LASF138
+	.long	0x378
+	.long	0x9ec
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF139
+	.byte	0x14
+	.value	0x153
+	.byte	0x10
+	.long	0xe1
+	.long	0xa0d
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xe1
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF140
+	.byte	0x18
+	.byte	0x4c
+	.byte	0xc
+	.long	0x4d
+	.long	0xa28
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF141
+	.byte	0x18
+	.byte	0x39
+	.byte	0xe
+	.long	0x111
+	.long	0xa57
+	.uleb128 0x2
+	.long	0x111
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xe1
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF142
+	.byte	0x15
+	.byte	0xd2
+	.byte	0xc
+	.long	0x4d
+	.long	0xa72
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x823
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF143
+	.byte	0x17
+	.byte	0x40
+	.byte	0xc
+	.long	0x4d
+	.long	0xa92
+	.uleb128 0x2
+	.long	0x40f
+	.uleb128 0x2
+	.long	0x40f
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF144
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xc
+	.long	.LASF145
+	.long	0x4d
+	.long	0xab2
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF146
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.long	0xacd
+	.uleb128 0x2
+	.long	0x4fa
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF147
+	.byte	0x25
+	.uleb128 0x36
+	.long	.LASF148
+	.byte	0x23
+	.uleb128 0xe
+	.long	.LASF149
+	.byte	0xe
+	.value	0x229
+	.byte	0xe
+	.long	0x111
+	.long	0xaf0
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF150
+	.byte	0x17
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0xb07
+	.uleb128 0x2
+	.long	0x4fa
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF151
+	.byte	0xe
+	.value	0x28e
+	.byte	0xe
+	.long	0x148
+	.long	0xb1e
+	.uleb128 0x2
+	.long	0x4fa
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF152
+	.byte	0x11
+	.byte	0x52
+	.byte	0xd
+	.long	0xb43
+	.long	0xb43
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0x4ff
+	.uleb128 0x2
+	.long	0x6e
+	.uleb128 0x2
+	.long	0x6e
+	.byte	0
+	.uleb128 0x7
+	.long	0x586
+	.uleb128 0x9
+	.long	0xb43
+	.uleb128 0xe
+	.long	.LASF153
+	.byte	0x14
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0xb64
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF154
+	.byte	0x19
+	.byte	0x43
+	.byte	0x6
+	.long	0xb77
+	.uleb128 0x2
+	.long	0x4ff
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF155
+	.byte	0x17
+	.value	0x1a3
+	.byte	0xe
+	.long	0x148
+	.long	0xb8e
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF157
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xd
+	.long	0xb9a
+	.uleb128 0x7
+	.long	0x4d
+	.uleb128 0x25
+	.long	.LASF171
+	.value	0x216
+	.byte	0x5
+	.long	0x57a
+	.quad	.LFB81
+	.quad	.LFE81-.LFB81
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcb5
+	.uleb128 0x14
+	.long	.LASF173
+	.value	0x216
+	.byte	0x33
+	.long	0x88f
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x4
+	.quad	.LVL256
+	.long	0x879
+	.long	0xbee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL257
+	.long	0x93a
+	.long	0xc0d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL258
+	.long	0x85e
+	.long	0xc39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL259
+	.long	0xcb5
+	.uleb128 0xb
+	.quad	.LVL260
+	.long	0xb8e
+	.uleb128 0xb
+	.quad	.LVL261
+	.long	0xb77
+	.uleb128 0x4
+	.quad	.LVL262
+	.long	0xb64
+	.long	0xc8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL263
+	.long	0xb64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF225
+	.byte	0x1
+	.value	0x1d0
+	.byte	0x6
+	.quad	.LFB80
+	.quad	.LFE80-.LFB80
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1124
+	.uleb128 0x20
+	.long	.LASF158
+	.value	0x1d2
+	.byte	0xa
+	.long	0x612
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0xc
+	.long	.LASF159
+	.value	0x1d4
+	.byte	0x11
+	.long	0x14d
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xc
+	.long	.LASF160
+	.value	0x1d9
+	.byte	0xf
+	.long	0x54
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x11
+	.string	"dir"
+	.value	0x1dd
+	.byte	0x10
+	.long	0x76f
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x11
+	.string	"now"
+	.value	0x1e3
+	.byte	0x12
+	.long	0x3a6
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xc
+	.long	.LASF161
+	.value	0x1e4
+	.byte	0x12
+	.long	0x1124
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xc
+	.long	.LASF162
+	.value	0x1e5
+	.byte	0xc
+	.long	0x35
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xc
+	.long	.LASF163
+	.value	0x1e6
+	.byte	0xc
+	.long	0x35
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xc
+	.long	.LASF88
+	.value	0x1e7
+	.byte	0x14
+	.long	0x7bb
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x26
+	.long	.LLRL75
+	.long	0xef4
+	.uleb128 0x27
+	.string	"sb"
+	.value	0x1e9
+	.byte	0x15
+	.long	0x41a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0xc
+	.long	.LASF164
+	.value	0x1ea
+	.byte	0x13
+	.long	0x581
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x28
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.long	0xdfa
+	.uleb128 0xc
+	.long	.LASF165
+	.value	0x1fe
+	.byte	0x20
+	.long	0x1129
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x8
+	.quad	.LVL158
+	.long	0x7c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -4328
+	.byte	0x6
+	.byte	0x35
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x25a9
+	.quad	.LBI101
+	.byte	.LVU387
+	.quad	.LBB101
+	.quad	.LBE101-.LBB101
+	.value	0x206
+	.byte	0x9
+	.long	0xe47
+	.uleb128 0x5
+	.long	0x25d1
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x5
+	.long	0x25c5
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5
+	.long	0x25b9
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL144
+	.long	0x7dc
+	.long	0xe6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL145
+	.long	0xb64
+	.long	0xe8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL153
+	.long	0x118c
+	.long	0xeac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL155
+	.long	0x118c
+	.long	0xeca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL156
+	.long	0x7fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4360
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.long	0xf59
+	.uleb128 0x11
+	.string	"i"
+	.value	0x20c
+	.byte	0x15
+	.long	0x35
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x4
+	.quad	.LVL167
+	.long	0x7dc
+	.long	0xf3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL170
+	.long	0xb64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x2608
+	.quad	.LBI96
+	.byte	.LVU332
+	.quad	.LBB96
+	.quad	.LBE96-.LBB96
+	.value	0x1d3
+	.byte	0x5
+	.long	0xfdb
+	.uleb128 0x5
+	.long	0x262c
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x5
+	.long	0x2622
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x5
+	.long	0x2618
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x8
+	.quad	.LVL130
+	.long	0x263a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x25de
+	.quad	.LBI98
+	.byte	.LVU344
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.value	0x1d9
+	.byte	0x18
+	.long	0x1036
+	.uleb128 0x5
+	.long	0x25fa
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x5
+	.long	0x25ee
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x8
+	.quad	.LVL134
+	.long	0xa92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x42
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL131
+	.long	0x899
+	.long	0x1054
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL136
+	.long	0x848
+	.long	0x106c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL138
+	.long	0x82d
+	.long	0x1083
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL142
+	.long	0xb4d
+	.long	0x109b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL151
+	.long	0x7a5
+	.long	0x10b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL161
+	.long	0x774
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL162
+	.long	0x754
+	.long	0x10e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL165
+	.long	0x785
+	.long	0x1116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	compare_entry_age
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL172
+	.long	0x2643
+	.byte	0
+	.uleb128 0x7
+	.long	0x747
+	.uleb128 0x9
+	.long	0x1124
+	.uleb128 0x29
+	.long	.LASF168
+	.value	0x1c3
+	.long	0x4d
+	.quad	.LFB79
+	.quad	.LFE79-.LFB79
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x118c
+	.uleb128 0x37
+	.string	"a"
+	.byte	0x23
+	.long	0x40f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x37
+	.string	"b"
+	.byte	0x32
+	.long	0x40f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF166
+	.value	0x1c5
+	.byte	0x12
+	.long	0x3a6
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xc
+	.long	.LASF167
+	.value	0x1c6
+	.byte	0x12
+	.long	0x3a6
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF169
+	.value	0x1b0
+	.long	0x57a
+	.quad	.LFB78
+	.quad	.LFE78-.LFB78
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x120e
+	.uleb128 0x38
+	.long	.LASF114
+	.byte	0x25
+	.long	0x4ff
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x38
+	.long	.LASF170
+	.byte	0x36
+	.long	0x15e
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2a
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1b2
+	.byte	0x11
+	.long	0x35
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2a
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.uleb128 0x11
+	.string	"c"
+	.value	0x1b3
+	.byte	0x14
+	.long	0x15e
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF172
+	.value	0x16f
+	.byte	0x14
+	.long	0x88f
+	.quad	.LFB77
+	.quad	.LFE77-.LFB77
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1808
+	.uleb128 0x14
+	.long	.LASF174
+	.value	0x170
+	.byte	0xf
+	.long	0x54
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x14
+	.long	.LASF175
+	.value	0x170
+	.byte	0x21
+	.long	0x1808
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x14
+	.long	.LASF176
+	.value	0x171
+	.byte	0x29
+	.long	0x1812
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x27
+	.string	"dir"
+	.value	0x173
+	.byte	0xa
+	.long	0x612
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x11
+	.string	"fd"
+	.value	0x182
+	.byte	0xf
+	.long	0x54
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0xc
+	.long	.LASF177
+	.value	0x188
+	.byte	0x11
+	.long	0x38e
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x20
+	.long	.LASF178
+	.value	0x18f
+	.byte	0x1b
+	.long	0x6dc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0x20
+	.long	.LASF179
+	.value	0x19e
+	.byte	0x17
+	.long	0x1827
+	.uleb128 0x9
+	.byte	0x3
+	.quad	padding.0
+	.uleb128 0xc
+	.long	.LASF173
+	.value	0x1a1
+	.byte	0x1e
+	.long	0x894
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x28
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.long	0x1305
+	.uleb128 0x11
+	.string	"i"
+	.value	0x198
+	.byte	0x11
+	.long	0x35
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x39
+	.long	0x182c
+	.quad	.LBI124
+	.byte	.LVU514
+	.long	.LLRL95
+	.value	0x17a
+	.byte	0xa
+	.long	0x13d4
+	.uleb128 0x5
+	.long	0x183c
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x3a
+	.long	.LLRL95
+	.uleb128 0x12
+	.long	0x1849
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x12
+	.long	0x1855
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x4
+	.quad	.LVL203
+	.long	0x8b5
+	.long	0x136a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1c0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL204
+	.long	0xb8e
+	.uleb128 0x4
+	.quad	.LVL207
+	.long	0x899
+	.long	0x1396
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL210
+	.long	0x8b5
+	.long	0x13b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1c0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL230
+	.long	0x8b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1c0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x2608
+	.quad	.LBI128
+	.byte	.LVU574
+	.long	.LLRL99
+	.value	0x180
+	.byte	0x5
+	.long	0x1456
+	.uleb128 0x5
+	.long	0x262c
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x5
+	.long	0x2622
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x5
+	.long	0x2618
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x8
+	.quad	.LVL232
+	.long	0x264c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1020
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1020
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x25de
+	.quad	.LBI132
+	.byte	.LVU581
+	.quad	.LBB132
+	.quad	.LBE132-.LBB132
+	.value	0x182
+	.byte	0x14
+	.long	0x14ba
+	.uleb128 0x5
+	.long	0x25fa
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x5
+	.long	0x25ee
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x8
+	.quad	.LVL233
+	.long	0xa92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x80241
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x180
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x2574
+	.quad	.LBI134
+	.byte	.LVU597
+	.quad	.LBB134
+	.quad	.LBE134-.LBB134
+	.value	0x190
+	.byte	0x5
+	.long	0x1507
+	.uleb128 0x5
+	.long	0x259c
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x5
+	.long	0x2590
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x5
+	.long	0x2584
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.uleb128 0xf
+	.long	0x25a9
+	.quad	.LBI136
+	.byte	.LVU603
+	.quad	.LBB136
+	.quad	.LBE136-.LBB136
+	.value	0x191
+	.byte	0x5
+	.long	0x1554
+	.uleb128 0x5
+	.long	0x25d1
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x5
+	.long	0x25c5
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x5
+	.long	0x25b9
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.uleb128 0xf
+	.long	0x213e
+	.quad	.LBI138
+	.byte	.LVU614
+	.quad	.LBB138
+	.quad	.LBE138-.LBB138
+	.value	0x195
+	.byte	0x1b
+	.long	0x15aa
+	.uleb128 0x21
+	.long	0x214d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.uleb128 0x8
+	.quad	.LVL241
+	.long	0x2248
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1d9d
+	.quad	.LBI141
+	.byte	.LVU638
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.value	0x19f
+	.byte	0x15
+	.long	0x15dd
+	.uleb128 0x5
+	.long	0x1dad
+	.long	.LLST112
+	.long	.LVUS112
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL199
+	.long	0x2381
+	.long	0x15fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL200
+	.long	0x1dbb
+	.long	0x161b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL213
+	.long	0xb77
+	.uleb128 0x4
+	.quad	.LVL214
+	.long	0xb64
+	.long	0x164e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL217
+	.long	0xb8e
+	.uleb128 0xb
+	.quad	.LVL218
+	.long	0xb77
+	.uleb128 0x4
+	.quad	.LVL219
+	.long	0xb64
+	.long	0x168d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL221
+	.long	0xb4d
+	.long	0x16a5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL222
+	.long	0x93a
+	.long	0x16c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL223
+	.long	0x8e7
+	.long	0x16dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL225
+	.long	0xb64
+	.long	0x1708
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL231
+	.long	0x96d
+	.uleb128 0x4
+	.quad	.LVL235
+	.long	0x951
+	.long	0x173a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL244
+	.long	0x914
+	.long	0x1764
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL245
+	.long	0x914
+	.long	0x1781
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL247
+	.long	0x914
+	.long	0x17ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	padding.0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL248
+	.long	0x8fd
+	.long	0x17c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL249
+	.long	0x8d1
+	.long	0x17db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL250
+	.long	0x93a
+	.long	0x17fa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL254
+	.long	0x2643
+	.byte	0
+	.uleb128 0x7
+	.long	0x14d
+	.uleb128 0x7
+	.long	0x601
+	.uleb128 0x9
+	.long	0x180d
+	.uleb128 0x13
+	.long	0x15e
+	.long	0x1827
+	.uleb128 0x15
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0x1817
+	.uleb128 0x3b
+	.long	.LASF187
+	.value	0x15f
+	.byte	0x5
+	.long	0x57a
+	.long	0x1862
+	.uleb128 0x4f
+	.string	"dir"
+	.byte	0x1
+	.value	0x15f
+	.byte	0x26
+	.long	0x14d
+	.uleb128 0x3c
+	.long	.LASF159
+	.value	0x164
+	.byte	0x11
+	.long	0x14d
+	.uleb128 0x3c
+	.long	.LASF180
+	.value	0x169
+	.byte	0xf
+	.long	0x581
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF181
+	.value	0x140
+	.byte	0xd
+	.long	0xb43
+	.quad	.LFB75
+	.quad	.LFE75-.LFB75
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a8b
+	.uleb128 0x14
+	.long	.LASF174
+	.value	0x140
+	.byte	0x30
+	.long	0x54
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x14
+	.long	.LASF175
+	.value	0x140
+	.byte	0x42
+	.long	0x1808
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x14
+	.long	.LASF176
+	.value	0x141
+	.byte	0x44
+	.long	0x1a90
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x11
+	.string	"fd"
+	.value	0x147
+	.byte	0xf
+	.long	0x54
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xc
+	.long	.LASF182
+	.value	0x153
+	.byte	0x17
+	.long	0xb48
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0xf
+	.long	0x25de
+	.quad	.LBI107
+	.byte	.LVU455
+	.quad	.LBB107
+	.quad	.LBE107-.LBB107
+	.value	0x147
+	.byte	0x14
+	.long	0x1949
+	.uleb128 0x5
+	.long	0x25fa
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x5
+	.long	0x25ee
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x8
+	.quad	.LVL176
+	.long	0xa92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL174
+	.long	0x1dbb
+	.long	0x1967
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL178
+	.long	0x1a95
+	.long	0x1991
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL179
+	.long	0xb1e
+	.long	0x19c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL186
+	.long	0xb8e
+	.uleb128 0xb
+	.quad	.LVL187
+	.long	0xb77
+	.uleb128 0x4
+	.quad	.LVL188
+	.long	0xb64
+	.long	0x1a06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL189
+	.long	0xb4d
+	.long	0x1a1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL190
+	.long	0xb64
+	.long	0x1a4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL192
+	.long	0xb4d
+	.long	0x1a62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL195
+	.long	0xb64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5f5
+	.uleb128 0x9
+	.long	0x1a8b
+	.uleb128 0x29
+	.long	.LASF183
+	.value	0x10e
+	.long	0x57a
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d9d
+	.uleb128 0x50
+	.string	"fd"
+	.byte	0x1
+	.value	0x10e
+	.byte	0x24
+	.long	0x54
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x14
+	.long	.LASF174
+	.value	0x10e
+	.byte	0x32
+	.long	0x54
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x14
+	.long	.LASF175
+	.value	0x10e
+	.byte	0x44
+	.long	0x1808
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x14
+	.long	.LASF176
+	.value	0x10f
+	.byte	0x39
+	.long	0x1a90
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x20
+	.long	.LASF178
+	.value	0x111
+	.byte	0x1b
+	.long	0x6dc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0xc
+	.long	.LASF184
+	.value	0x11f
+	.byte	0x12
+	.long	0x41
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x27
+	.string	"sb"
+	.value	0x120
+	.byte	0x11
+	.long	0x41a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x11
+	.string	"map"
+	.value	0x124
+	.byte	0x17
+	.long	0x4ff
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0xc
+	.long	.LASF185
+	.value	0x128
+	.byte	0xf
+	.long	0x581
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xc
+	.long	.LASF186
+	.value	0x13a
+	.byte	0x11
+	.long	0x373
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x26
+	.long	.LLRL57
+	.long	0x1bb8
+	.uleb128 0x11
+	.string	"i"
+	.value	0x130
+	.byte	0x11
+	.long	0x35
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x3a
+	.long	.LLRL59
+	.uleb128 0x11
+	.string	"arg"
+	.value	0x131
+	.byte	0x18
+	.long	0x16f
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0xb
+	.quad	.LVL119
+	.long	0xaf0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x253f
+	.quad	.LBI86
+	.byte	.LVU241
+	.quad	.LBB86
+	.quad	.LBE86-.LBB86
+	.value	0x112
+	.byte	0x25
+	.long	0x1c26
+	.uleb128 0x5
+	.long	0x2567
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x5
+	.long	0x255b
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x5
+	.long	0x254f
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x8
+	.quad	.LVL101
+	.long	0x9c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x213e
+	.quad	.LBI88
+	.byte	.LVU254
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.value	0x116
+	.byte	0x24
+	.long	0x1c7c
+	.uleb128 0x21
+	.long	0x214d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x8
+	.quad	.LVL103
+	.long	0x2248
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1d9d
+	.quad	.LBI93
+	.byte	.LVU316
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.value	0x13b
+	.byte	0x22
+	.long	0x1caf
+	.uleb128 0x5
+	.long	0x1dad
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL102
+	.long	0xa72
+	.long	0x1cda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL109
+	.long	0xa57
+	.long	0x1cf9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL111
+	.long	0xa28
+	.long	0x1d2d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL112
+	.long	0xa72
+	.long	0x1d4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL114
+	.long	0xa0d
+	.long	0x1d6c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL123
+	.long	0x9ec
+	.long	0x1d8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL127
+	.long	0x2643
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF188
+	.value	0x106
+	.byte	0x8
+	.long	0x35
+	.long	0x1dbb
+	.uleb128 0x51
+	.long	.LASF110
+	.byte	0x1
+	.value	0x106
+	.byte	0x25
+	.long	0x41
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF189
+	.byte	0xeb
+	.byte	0x5
+	.long	0x57a
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x213e
+	.uleb128 0x19
+	.long	.LASF174
+	.byte	0xeb
+	.byte	0x28
+	.long	0x54
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x19
+	.long	.LASF175
+	.byte	0xeb
+	.byte	0x3a
+	.long	0x1808
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x33
+	.string	"dir"
+	.byte	0xf0
+	.byte	0xa
+	.long	0x612
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0x1a
+	.long	.LASF190
+	.byte	0xf5
+	.byte	0xe
+	.long	0x174
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2c
+	.string	"len"
+	.byte	0xfb
+	.byte	0xf
+	.long	0x54
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x3d
+	.long	0x21e8
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.byte	0xf6
+	.byte	0xb
+	.long	0x1ee5
+	.uleb128 0x1b
+	.long	0x220f
+	.uleb128 0x1b
+	.long	0x2203
+	.uleb128 0x1b
+	.long	0x21f7
+	.uleb128 0x12
+	.long	0x221b
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x12
+	.long	0x2226
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x21
+	.long	0x2231
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4184
+	.uleb128 0x3e
+	.long	0x223c
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.long	0x1eab
+	.uleb128 0x12
+	.long	0x223d
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL64
+	.long	0xaf0
+	.long	0x1ec3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL67
+	.long	0x2248
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4184
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0x2159
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0xf7
+	.byte	0xe
+	.long	0x2082
+	.uleb128 0x1b
+	.long	0x2180
+	.uleb128 0x1b
+	.long	0x2174
+	.uleb128 0x1b
+	.long	0x2168
+	.uleb128 0x12
+	.long	0x218c
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x12
+	.long	0x2197
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x12
+	.long	0x21a2
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x21
+	.long	0x21ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4184
+	.uleb128 0x52
+	.long	0x21b6
+	.long	.LLRL36
+	.long	0x1f67
+	.uleb128 0x12
+	.long	0x21bb
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xb
+	.quad	.LVL74
+	.long	0xaf0
+	.byte	0
+	.uleb128 0x3e
+	.long	0x21c5
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.long	0x2031
+	.uleb128 0x12
+	.long	0x21c6
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x53
+	.long	0x21cf
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.uleb128 0x12
+	.long	0x21d0
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1d
+	.long	0x25a9
+	.quad	.LBI74
+	.byte	.LVU201
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.byte	0xd5
+	.byte	0x9
+	.long	0x201b
+	.uleb128 0x5
+	.long	0x25d1
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x5
+	.long	0x25c5
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x5
+	.long	0x25b9
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x8
+	.quad	.LVL85
+	.long	0x2655
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL83
+	.long	0xaf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL70
+	.long	0xad9
+	.long	0x2048
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL77
+	.long	0xad9
+	.long	0x2060
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL89
+	.long	0x2248
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4184
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x2608
+	.quad	.LBI76
+	.byte	.LVU222
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0xfb
+	.byte	0x15
+	.long	0x2110
+	.uleb128 0x5
+	.long	0x262c
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x5
+	.long	0x2622
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x5
+	.long	0x2618
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x8
+	.quad	.LVL92
+	.long	0x264c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cache_name
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL58
+	.long	0x2381
+	.long	0x2130
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL96
+	.long	0x2643
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF111
+	.byte	0xe1
+	.byte	0xa
+	.long	0x163
+	.long	0x2159
+	.uleb128 0x16
+	.long	.LASF191
+	.byte	0xe3
+	.byte	0xc
+	.long	0x35
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF192
+	.byte	0xc8
+	.byte	0x5
+	.long	0x57a
+	.long	0x21de
+	.uleb128 0xa
+	.long	.LASF174
+	.byte	0x1
+	.byte	0xc8
+	.byte	0x1a
+	.long	0x54
+	.uleb128 0xa
+	.long	.LASF175
+	.byte	0x1
+	.byte	0xc8
+	.byte	0x2c
+	.long	0x1808
+	.uleb128 0xa
+	.long	.LASF190
+	.byte	0x1
+	.byte	0xc8
+	.byte	0x44
+	.long	0x21e3
+	.uleb128 0x16
+	.long	.LASF193
+	.byte	0xca
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x16
+	.long	.LASF194
+	.byte	0xce
+	.byte	0x11
+	.long	0x14d
+	.uleb128 0x1c
+	.string	"p"
+	.byte	0xd2
+	.byte	0xb
+	.long	0x148
+	.uleb128 0x16
+	.long	.LASF191
+	.byte	0xd8
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x54
+	.long	0x21c5
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0xcb
+	.byte	0xe
+	.long	0x4d
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0xd3
+	.byte	0xe
+	.long	0x4d
+	.uleb128 0x2e
+	.uleb128 0x1c
+	.string	"len"
+	.byte	0xd4
+	.byte	0x16
+	.long	0x41
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x174
+	.uleb128 0x9
+	.long	0x21de
+	.uleb128 0x2d
+	.long	.LASF195
+	.byte	0xb3
+	.byte	0x5
+	.long	0x57a
+	.long	0x2248
+	.uleb128 0xa
+	.long	.LASF174
+	.byte	0x1
+	.byte	0xb3
+	.byte	0x1e
+	.long	0x54
+	.uleb128 0xa
+	.long	.LASF175
+	.byte	0x1
+	.byte	0xb3
+	.byte	0x30
+	.long	0x1808
+	.uleb128 0xa
+	.long	.LASF190
+	.byte	0x1
+	.byte	0xb3
+	.byte	0x48
+	.long	0x21e3
+	.uleb128 0x1c
+	.string	"end"
+	.byte	0xba
+	.byte	0x17
+	.long	0x4ff
+	.uleb128 0x16
+	.long	.LASF193
+	.byte	0xbb
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x16
+	.long	.LASF191
+	.byte	0xbc
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x2e
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0xb5
+	.byte	0xe
+	.long	0x4d
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF196
+	.byte	0x92
+	.byte	0xa
+	.long	0x174
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2377
+	.uleb128 0x19
+	.long	.LASF197
+	.byte	0x92
+	.byte	0x30
+	.long	0x4ff
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x19
+	.long	.LASF193
+	.byte	0x92
+	.byte	0x43
+	.long	0x41
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x19
+	.long	.LASF191
+	.byte	0x93
+	.byte	0x2c
+	.long	0x237c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x55
+	.long	.LASF198
+	.byte	0x1
+	.byte	0x95
+	.byte	0x14
+	.long	0x180
+	.quad	0x7f7f7f7f7f7f7f7f
+	.uleb128 0x1a
+	.long	.LASF190
+	.byte	0x96
+	.byte	0xe
+	.long	0x174
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1a
+	.long	.LASF162
+	.byte	0x97
+	.byte	0xc
+	.long	0x35
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x2c
+	.string	"i"
+	.byte	0x98
+	.byte	0xc
+	.long	0x35
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2a
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.uleb128 0x16
+	.long	.LASF199
+	.byte	0x9a
+	.byte	0x12
+	.long	0x174
+	.uleb128 0x1a
+	.long	.LASF200
+	.byte	0x9f
+	.byte	0x18
+	.long	0x180
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1d
+	.long	0x25a9
+	.quad	.LBI44
+	.byte	.LVU41
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.byte	0x9b
+	.byte	0x9
+	.long	0x2368
+	.uleb128 0x5
+	.long	0x25d1
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x5
+	.long	0x25c5
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x5
+	.long	0x25b9
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL15
+	.long	0x265e
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x35
+	.uleb128 0x9
+	.long	0x2377
+	.uleb128 0x2b
+	.long	.LASF201
+	.byte	0x76
+	.byte	0x5
+	.long	0x57a
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x253f
+	.uleb128 0x56
+	.string	"buf"
+	.byte	0x1
+	.byte	0x76
+	.byte	0x24
+	.long	0x14d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x19
+	.long	.LASF193
+	.byte	0x76
+	.byte	0x36
+	.long	0x41
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1a
+	.long	.LASF202
+	.byte	0x78
+	.byte	0x17
+	.long	0x4ff
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2c
+	.string	"len"
+	.byte	0x79
+	.byte	0x9
+	.long	0x4d
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x26
+	.long	.LLRL18
+	.long	0x24a5
+	.uleb128 0x1a
+	.long	.LASF203
+	.byte	0x7e
+	.byte	0x1b
+	.long	0x4ff
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1d
+	.long	0x2608
+	.quad	.LBI47
+	.byte	.LVU117
+	.quad	.LBB47
+	.quad	.LBE47-.LBB47
+	.byte	0x82
+	.byte	0xf
+	.long	0x2489
+	.uleb128 0x5
+	.long	0x262c
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x5
+	.long	0x2622
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x5
+	.long	0x2618
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.quad	.LVL46
+	.long	0x264c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL35
+	.long	0xb07
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x2608
+	.quad	.LBI49
+	.byte	.LVU109
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.byte	0x7b
+	.byte	0xf
+	.long	0x2523
+	.uleb128 0x5
+	.long	0x262c
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.long	0x2622
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x5
+	.long	0x2618
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x8
+	.quad	.LVL43
+	.long	0x264c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL34
+	.long	0xb07
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF138
+	.byte	0x4
+	.byte	0x24
+	.byte	0x1
+	.long	0x378
+	.long	0x2574
+	.uleb128 0xa
+	.long	.LASF204
+	.byte	0x4
+	.byte	0x24
+	.byte	0xb
+	.long	0x4d
+	.uleb128 0xa
+	.long	.LASF205
+	.byte	0x4
+	.byte	0x24
+	.byte	0x17
+	.long	0x111
+	.uleb128 0xa
+	.long	.LASF206
+	.byte	0x4
+	.byte	0x24
+	.byte	0x25
+	.long	0x35
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF207
+	.byte	0x2
+	.byte	0x39
+	.byte	0x2a
+	.long	0x111
+	.long	0x25a9
+	.uleb128 0xa
+	.long	.LASF208
+	.byte	0x2
+	.byte	0x39
+	.byte	0x38
+	.long	0x111
+	.uleb128 0xa
+	.long	.LASF209
+	.byte	0x2
+	.byte	0x39
+	.byte	0x44
+	.long	0x4d
+	.uleb128 0xa
+	.long	.LASF210
+	.byte	0x2
+	.byte	0x39
+	.byte	0x51
+	.long	0x35
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF211
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x2a
+	.long	0x111
+	.long	0x25de
+	.uleb128 0xa
+	.long	.LASF208
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x43
+	.long	0x113
+	.uleb128 0xa
+	.long	.LASF212
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x62
+	.long	0x414
+	.uleb128 0xa
+	.long	.LASF210
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x70
+	.long	0x35
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF145
+	.byte	0x5
+	.byte	0x29
+	.byte	0x1
+	.long	0x4d
+	.long	0x2608
+	.uleb128 0xa
+	.long	.LASF213
+	.byte	0x5
+	.byte	0x29
+	.byte	0x13
+	.long	0x4fa
+	.uleb128 0xa
+	.long	.LASF214
+	.byte	0x5
+	.byte	0x29
+	.byte	0x1f
+	.long	0x4d
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF215
+	.byte	0x3
+	.byte	0x33
+	.byte	0x2a
+	.long	0x4d
+	.long	0x263a
+	.uleb128 0x3f
+	.string	"__s"
+	.byte	0x45
+	.long	0x152
+	.uleb128 0x3f
+	.string	"__n"
+	.byte	0x51
+	.long	0x35
+	.uleb128 0xa
+	.long	.LASF216
+	.byte	0x3
+	.byte	0x33
+	.byte	0x6d
+	.long	0x504
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF215
+	.long	.LASF218
+	.uleb128 0x40
+	.long	.LASF221
+	.long	.LASF221
+	.uleb128 0x2f
+	.long	.LASF217
+	.long	.LASF219
+	.uleb128 0x2f
+	.long	.LASF211
+	.long	.LASF220
+	.uleb128 0x40
+	.long	.LASF222
+	.long	.LASF222
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 451
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 432
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 .LFE81-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU339
+	.uleb128 .LVU350
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU351
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU357
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU362
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4336
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4336
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4336
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU363
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4344
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU364
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+	.uleb128 .LVU392
+	.uleb128 .LVU392
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU365
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU446
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL158-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU375
+	.uleb128 .LVU393
+	.uleb128 .LVU396
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU427
+	.uleb128 .LVU430
+	.uleb128 .LVU431
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU375
+	.uleb128 .LVU393
+	.uleb128 .LVU402
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU424
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU422
+	.uleb128 .LVU424
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU387
+	.uleb128 .LVU390
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x41
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU387
+	.uleb128 .LVU390
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU387
+	.uleb128 .LVU390
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU434
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU446
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU332
+	.uleb128 .LVU336
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC8
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU332
+	.uleb128 .LVU336
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1000
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU344
+	.uleb128 .LVU351
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0x42
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU344
+	.uleb128 .LVU351
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU22
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE79-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -1
+	.byte	0
+.LVUS89:
+	.uleb128 0
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU520
+	.uleb128 .LVU520
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE77-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 0
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU526
+	.uleb128 .LVU526
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE77-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 0
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LFE77-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU547
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU564
+	.uleb128 .LVU587
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU652
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL235-1-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU555
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU564
+	.uleb128 .LVU593
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU652
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL221-1-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU560
+	.uleb128 .LVU563
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU514
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU540
+	.uleb128 .LVU565
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL203-1-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL207-1-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL230-1-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU526
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU540
+	.uleb128 .LVU565
+	.uleb128 .LVU570
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU536
+	.uleb128 .LVU540
+	.uleb128 .LVU565
+	.uleb128 .LVU568
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x94
+	.byte	0x4
+	.byte	0x41
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU574
+	.uleb128 .LVU579
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC15
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU574
+	.uleb128 .LVU579
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1020
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU574
+	.uleb128 .LVU579
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU581
+	.uleb128 .LVU587
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80241
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU581
+	.uleb128 .LVU587
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	tmp_name
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU597
+	.uleb128 .LVU601
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU597
+	.uleb128 .LVU601
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU597
+	.uleb128 .LVU601
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU603
+	.uleb128 .LVU606
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU603
+	.uleb128 .LVU606
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC6
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU603
+	.uleb128 .LVU606
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4320
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS83:
+	.uleb128 0
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE75-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS84:
+	.uleb128 0
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU461
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU474
+	.uleb128 .LVU478
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL178-1-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 .LFE75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU469
+	.uleb128 .LVU474
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU455
+	.uleb128 .LVU461
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU455
+	.uleb128 .LVU461
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	cache_name
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU269
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU326
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0x7f
+	.sleb128 160
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x4
+	.byte	0x7f
+	.sleb128 160
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU277
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU286
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU283
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU296
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x94
+	.byte	0x4
+	.byte	0x30
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU325
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 7
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0xa0
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU294
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU314
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU298
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU314
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -412
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU241
+	.uleb128 .LVU246
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU241
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU241
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU316
+	.uleb128 .LVU318
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU165
+	.uleb128 .LVU175
+	.uleb128 .LVU215
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU226
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4224
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU226
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU234
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU158
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU162
+	.uleb128 .LVU174
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU153
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU175
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU211
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU179
+	.uleb128 .LVU182
+	.uleb128 .LVU191
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU220
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4200
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU193
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU211
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4200
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU175
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU194
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0xc
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0xc
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0xc
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU193
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0xd
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0xd
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0xd
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU200
+	.uleb128 .LVU211
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU201
+	.uleb128 .LVU204
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU201
+	.uleb128 .LVU204
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU201
+	.uleb128 .LVU204
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC5
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1000
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	cache_name
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU32
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.quad	0xcbf29ce484222325
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.quad	0xcbf29ce484222325
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU33
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU34
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU50
+	.uleb128 .LVU57
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x29
+	.byte	0x70
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0x7f7f7f7f7f7f7f7f
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x7f7f7f7f7f7f7f7f
+	.byte	0x20
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x11
+	.sleb128 -9187201950435737472
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+8958
+	.sleb128 0
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU93
+	.uleb128 .LVU99
+	.uleb128 .LVU108
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU113
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU121
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU128
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU100
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+	.uleb128 .LVU116
+	.uleb128 .LVU120
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB131-.Ltext0
+	.uleb128 .LBE131-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF18:
+	.string	"__off_t"
+.LASF14:
+	.string	"__gid_t"
+.LASF8:
+	.string	"short int"
+.LASF30:
+	.string	"_IO_read_ptr"
+.LASF149:
+	.string	"malloc"
+.LASF42:
+	.string	"_chain"
+.LASF86:
+	.string	"st_ctim"
+.LASF167:
+	.string	"mtime_b"
+.LASF9:
+	.string	"size_t"
+.LASF137:
+	.string	"__read_alias"
+.LASF198:
+	.string	"low7"
+.LASF48:
+	.string	"_shortbuf"
+.LASF153:
+	.string	"close"
+.LASF102:
+	.string	"device_arg"
+.LASF213:
+	.string	"__path"
+.LASF63:
+	.string	"ssize_t"
+.LASF191:
+	.string	"nul_count"
+.LASF209:
+	.string	"__ch"
+.LASF69:
+	.string	"tv_nsec"
+.LASF36:
+	.string	"_IO_buf_base"
+.LASF100:
+	.string	"log_level"
+.LASF70:
+	.string	"long long unsigned int"
+.LASF134:
+	.string	"fdopen"
+.LASF156:
+	.string	"getpid"
+.LASF171:
+	.string	"beep_sequence_cache_commit"
+.LASF212:
+	.string	"__src"
+.LASF148:
+	.string	"__open_too_many_args"
+.LASF116:
+	.string	"free"
+.LASF51:
+	.string	"_codecvt"
+.LASF152:
+	.string	"beep_score_fdopen"
+.LASF223:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF163:
+	.string	"capacity"
+.LASF72:
+	.string	"stat"
+.LASF128:
+	.string	"mkdir"
+.LASF64:
+	.string	"long long int"
+.LASF7:
+	.string	"signed char"
+.LASF117:
+	.string	"qsort"
+.LASF74:
+	.string	"st_ino"
+.LASF214:
+	.string	"__oflag"
+.LASF189:
+	.string	"sequence_cache_file_name"
+.LASF16:
+	.string	"__mode_t"
+.LASF193:
+	.string	"size"
+.LASF43:
+	.string	"_fileno"
+.LASF136:
+	.string	"__read_chk_warn"
+.LASF111:
+	.string	"package_hash"
+.LASF23:
+	.string	"__blkcnt_t"
+.LASF225:
+	.string	"sequence_cache_prune"
+.LASF2:
+	.string	"long int"
+.LASF91:
+	.string	"d_reclen"
+.LASF29:
+	.string	"_flags"
+.LASF218:
+	.string	"__builtin_snprintf"
+.LASF24:
+	.string	"__ssize_t"
+.LASF37:
+	.string	"_IO_buf_end"
+.LASF60:
+	.string	"_IO_codecvt"
+.LASF84:
+	.string	"st_atim"
+.LASF104:
+	.string	"beep_sequence_settings"
+.LASF45:
+	.string	"_old_offset"
+.LASF50:
+	.string	"_offset"
+.LASF125:
+	.string	"rename"
+.LASF188:
+	.string	"padded_key_size"
+.LASF164:
+	.string	"is_entry"
+.LASF93:
+	.string	"d_name"
+.LASF182:
+	.string	"score"
+.LASF62:
+	.string	"off_t"
+.LASF10:
+	.string	"__uint32_t"
+.LASF122:
+	.string	"fstatat"
+.LASF201:
+	.string	"sequence_cache_dir"
+.LASF83:
+	.string	"st_blocks"
+.LASF200:
+	.string	"zero"
+.LASF77:
+	.string	"st_uid"
+.LASF179:
+	.string	"padding"
+.LASF124:
+	.string	"fdopendir"
+.LASF184:
+	.string	"map_size"
+.LASF6:
+	.string	"unsigned int"
+.LASF54:
+	.string	"_freeres_buf"
+.LASF150:
+	.string	"strlen"
+.LASF147:
+	.string	"__open_missing_mode"
+.LASF187:
+	.string	"sequence_cache_mkdir"
+.LASF67:
+	.string	"timespec"
+.LASF3:
+	.string	"long unsigned int"
+.LASF131:
+	.string	"ferror"
+.LASF34:
+	.string	"_IO_write_ptr"
+.LASF140:
+	.string	"munmap"
+.LASF114:
+	.string	"name"
+.LASF197:
+	.string	"data"
+.LASF118:
+	.string	"closedir"
+.LASF5:
+	.string	"short unsigned int"
+.LASF90:
+	.string	"d_off"
+.LASF108:
+	.string	"cache_version"
+.LASF38:
+	.string	"_IO_save_base"
+.LASF17:
+	.string	"__nlink_t"
+.LASF173:
+	.string	"writer"
+.LASF168:
+	.string	"compare_entry_age"
+.LASF154:
+	.string	"log_verbose"
+.LASF220:
+	.string	"__builtin_memcpy"
+.LASF49:
+	.string	"_lock"
+.LASF135:
+	.string	"__read_chk"
+.LASF56:
+	.string	"_mode"
+.LASF119:
+	.string	"readdir"
+.LASF172:
+	.string	"beep_sequence_cache_create"
+.LASF219:
+	.string	"__builtin___snprintf_chk"
+.LASF98:
+	.string	"beep_score_writer"
+.LASF81:
+	.string	"st_size"
+.LASF146:
+	.string	"__open_2"
+.LASF52:
+	.string	"_wide_data"
+.LASF13:
+	.string	"__uid_t"
+.LASF126:
+	.string	"beep_score_finish"
+.LASF151:
+	.string	"getenv"
+.LASF194:
+	.string	"copy"
+.LASF166:
+	.string	"mtime_a"
+.LASF192:
+	.string	"copied_key"
+.LASF31:
+	.string	"_IO_read_end"
+.LASF133:
+	.string	"unlink"
+.LASF157:
+	.string	"__errno_location"
+.LASF203:
+	.string	"home"
+.LASF121:
+	.string	"unlinkat"
+.LASF145:
+	.string	"open"
+.LASF12:
+	.string	"__dev_t"
+.LASF204:
+	.string	"__fd"
+.LASF25:
+	.string	"__syscall_slong_t"
+.LASF96:
+	.string	"beep_score"
+.LASF130:
+	.string	"beep_score_fcreate"
+.LASF35:
+	.string	"_IO_write_end"
+.LASF28:
+	.string	"uint64_t"
+.LASF105:
+	.string	"cache_name"
+.LASF160:
+	.string	"dir_fd"
+.LASF89:
+	.string	"d_ino"
+.LASF224:
+	.string	"_IO_lock_t"
+.LASF66:
+	.string	"_IO_FILE"
+.LASF127:
+	.string	"strrchr"
+.LASF123:
+	.string	"time"
+.LASF22:
+	.string	"__blksize_t"
+.LASF205:
+	.string	"__buf"
+.LASF176:
+	.string	"settings"
+.LASF65:
+	.string	"time_t"
+.LASF11:
+	.string	"__uint64_t"
+.LASF106:
+	.string	"tmp_name"
+.LASF59:
+	.string	"_IO_marker"
+.LASF68:
+	.string	"tv_sec"
+.LASF41:
+	.string	"_markers"
+.LASF169:
+	.string	"is_entry_name"
+.LASF109:
+	.string	"score_version"
+.LASF165:
+	.string	"grown"
+.LASF87:
+	.string	"__glibc_reserved"
+.LASF75:
+	.string	"st_nlink"
+.LASF95:
+	.string	"_Bool"
+.LASF4:
+	.string	"unsigned char"
+.LASF97:
+	.string	"_beep_score"
+.LASF94:
+	.string	"__dirstream"
+.LASF92:
+	.string	"d_type"
+.LASF186:
+	.string	"score_offset"
+.LASF202:
+	.string	"cache_home"
+.LASF177:
+	.string	"file"
+.LASF82:
+	.string	"st_blksize"
+.LASF210:
+	.string	"__len"
+.LASF88:
+	.string	"dirent"
+.LASF110:
+	.string	"key_size"
+.LASF158:
+	.string	"dir_name"
+.LASF180:
+	.string	"parent_ok"
+.LASF47:
+	.string	"_vtable_offset"
+.LASF221:
+	.string	"__stack_chk_fail"
+.LASF79:
+	.string	"__pad0"
+.LASF185:
+	.string	"same_key"
+.LASF15:
+	.string	"__ino_t"
+.LASF27:
+	.string	"uint32_t"
+.LASF112:
+	.string	"sequence_cache_header"
+.LASF113:
+	.string	"mtime"
+.LASF141:
+	.string	"mmap"
+.LASF26:
+	.string	"char"
+.LASF107:
+	.string	"magic"
+.LASF183:
+	.string	"sequence_cache_check"
+.LASF103:
+	.string	"device_offset"
+.LASF162:
+	.string	"count"
+.LASF161:
+	.string	"entries"
+.LASF129:
+	.string	"fclose"
+.LASF222:
+	.string	"__popcountdi2"
+.LASF143:
+	.string	"memcmp"
+.LASF199:
+	.string	"word"
+.LASF19:
+	.string	"__off64_t"
+.LASF76:
+	.string	"st_mode"
+.LASF46:
+	.string	"_cur_column"
+.LASF32:
+	.string	"_IO_read_base"
+.LASF211:
+	.string	"memcpy"
+.LASF40:
+	.string	"_IO_save_end"
+.LASF190:
+	.string	"hash"
+.LASF216:
+	.string	"__fmt"
+.LASF78:
+	.string	"st_gid"
+.LASF101:
+	.string	"device_count"
+.LASF55:
+	.string	"__pad5"
+.LASF215:
+	.string	"snprintf"
+.LASF21:
+	.string	"__time_t"
+.LASF57:
+	.string	"_unused2"
+.LASF208:
+	.string	"__dest"
+.LASF207:
+	.string	"memset"
+.LASF99:
+	.string	"_beep_score_writer"
+.LASF206:
+	.string	"__nbytes"
+.LASF73:
+	.string	"st_dev"
+.LASF195:
+	.string	"contiguous_key"
+.LASF44:
+	.string	"_flags2"
+.LASF39:
+	.string	"_IO_backup_base"
+.LASF144:
+	.string	"__open_alias"
+.LASF139:
+	.string	"lseek"
+.LASF196:
+	.string	"sequence_cache_hash"
+.LASF85:
+	.string	"st_mtim"
+.LASF170:
+	.string	"suffix"
+.LASF142:
+	.string	"fstat"
+.LASF138:
+	.string	"read"
+.LASF132:
+	.string	"fwrite"
+.LASF71:
+	.string	"__compar_fn_t"
+.LASF174:
+	.string	"argc"
+.LASF181:
+	.string	"beep_sequence_cache_open"
+.LASF53:
+	.string	"_freeres_list"
+.LASF159:
+	.string	"slash"
+.LASF120:
+	.string	"realloc"
+.LASF61:
+	.string	"_IO_wide_data"
+.LASF58:
+	.string	"FILE"
+.LASF80:
+	.string	"st_rdev"
+.LASF217:
+	.string	"__snprintf_chk"
+.LASF155:
+	.string	"strerror"
+.LASF175:
+	.string	"argv"
+.LASF33:
+	.string	"_IO_write_base"
+.LASF178:
+	.string	"header"
+.LASF115:
+	.string	"cache_entry"
+.LASF20:
+	.string	"__pid_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-sequence-cache.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,326 @@
+/* beep-sequence.c - compile and run the sequence language
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* A sequence program is a list of tones and groups separated by white
+ * space:
+ *
+ *   TONE   FREQ[:LENGTH[:DELAY]]
+ *   GROUP  (PROGRAM)[xCOUNT]
+ *
+ * FREQ is a frequency in Hz, a note name like A4 or R for a rest, and
+ * LENGTH and DELAY are milliseconds or beats as for -l and -d.
+ *
+ * The program is compiled into 32 bit words of bytecode:
+ *
+ *   OP_TONE freq length delay flags
+ *   OP_REPEAT count                   start of a group
+ *   OP_END                            end of a group
+ *   OP_HALT
+ *
+ * which the interpreter runs with an explicit stack of the groups
+ * being repeated.  Groups are never expanded, so a million tones of a
+ * repeated phrase need no more memory than the phrase itself, and the
+ * first tones play right away.  The durations are converted to
+ * milliseconds as the tones are played, so that durations in beats do
+ * not drift however often they are repeated.
+ */
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "beep-sequence.h"
+
+#include "beep-library.h"
+#include "beep-log.h"
+#include "beep-notes.h"
+
+
+enum {
+    OP_HALT   = 0,
+    OP_TONE   = 1,
+    OP_REPEAT = 2,
+    OP_END    = 3,
+};
+
+
+struct _beep_sequence {
+    uint32_t     *code;
+    size_t        code_size;      /* words */
+    size_t        code_capacity;  /* words */
+
+    size_t        pc;
+    size_t        depth;
+    struct {
+        size_t    body;           /* pc of the first instruction */
+        uint32_t  left;           /* repetitions left after this one */
+    } stack[BEEP_SEQUENCE_MAX_DEPTH];
+
+    beep_tempo    tempo;
+    beep_tone     tones[BEEP_SEQUENCE_BATCH];
+};
+
+
+/* Append count words to the code, growing it by doubling */
+static
+uint32_t *emit(beep_sequence *sequence, const size_t count)
+{
+    if ((sequence->code_size + count) > sequence->code_capacity) {
+        const size_t capacity = sequence->code_capacity
+            ? (2 * sequence->code_capacity) : 64;
+        uint32_t *const code = realloc(sequence->code,
+                                       capacity * sizeof(uint32_t));
+        if (!code) {
+            return NULL;
+        }
+        sequence->code          = code;
+        sequence->code_capacity = capacity;
+    }
+    uint32_t *const words = &sequence->code[sequence->code_size];
+    sequence->code_size += count;
+    return words;
+}
+
+
+static
+bool is_space(const char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+
+/* Whether a tone or a group may end right before c */
+static
+bool is_separator(const char c)
+{
+    return (c == '\0') || is_space(c) || (c == '(') || (c == ')');
+}
+
+
+/* Compile the tone at str.  Returns the first character after it, or
+ * NULL for an invalid tone.
+ */
+static
+const char *compile_tone(beep_sequence *sequence, const char *str,
+                         const unsigned int default_length,
+                         const unsigned int default_delay)
+{
+    unsigned int freq;
+    uint32_t     flags = 0;
+    const char  *end;
+    if ((*str == 'R') && ((str[1] == ':') || is_separator(str[1]))) {
+        freq = 0;
+        end  = str + 1;
+    } else if (NULL != (end = parse_note_value(str, &freq))) {
+        flags = BEEP_TONE_NOTE | freq;
+        freq  = beep_note_freq_hz(freq);
+    } else if (NULL == (end = parse_rounded_value(str, 20000U, &freq))) {
+        return NULL;
+    }
+
+    unsigned int length = default_length;
+    unsigned int delay  = default_delay;
+    if (*end == ':') {
+        end = parse_duration_value(end + 1, 300000U, &length);
+        if (end && (*end == ':')) {
+            end = parse_duration_value(end + 1, 300000U, &delay);
+        }
+    }
+    if ((!end) || (!is_separator(*end))) {
+        return NULL;
+    }
+
+    uint32_t *const words = emit(sequence, 5);
+    if (!words) {
+        return NULL;
+    }
+    words[0] = OP_TONE;
+    words[1] = freq;
+    words[2] = length;
+    words[3] = delay;
+    words[4] = flags;
+    return end;
+}
+
+
+beep_sequence *beep_sequence_compile(const char *const source,
+                                     const unsigned int default_length,
+                                     const unsigned int default_delay,
+                                     const unsigned int bpm)
+{
+    beep_sequence *const sequence = malloc(sizeof(beep_sequence));
+    if (!sequence) {
+        log_error("--sequence: out of memory");
+        return NULL;
+    }
+    sequence->code          = NULL;
+    sequence->code_size     = 0;
+    sequence->code_capacity = 0;
+    sequence->pc            = 0;
+    sequence->depth         = 0;
+    beep_tempo_init(&sequence->tempo, bpm);
+
+    /* The OP_REPEAT of each open group, to be given its count */
+    size_t      open_groups[BEEP_SEQUENCE_MAX_DEPTH];
+    size_t      depth = 0;
+    const char *error = NULL;
+    const char *str   = source;
+
+    while (!error) {
+        while (is_space(*str)) {
+            ++str;
+        }
+        if (*str == '\0') {
+            if (depth > 0) {
+                error = "missing )";
+            }
+            break;
+        } else if (*str == '(') {
+            if (depth == BEEP_SEQUENCE_MAX_DEPTH) {
+                error = "groups nested too deeply";
+                break;
+            }
+            uint32_t *const words = emit(sequence, 2);
+            if (!words) {
+                error = "out of memory";
+                break;
+            }
+            words[0] = OP_REPEAT;
+            words[1] = 1;
+            open_groups[depth++] = sequence->code_size - 2;
+            ++str;
+        } else if (*str == ')') {
+            if (depth == 0) {
+                error = "unexpected )";
+                break;
+            }
+            const size_t repeat = open_groups[--depth];
+            if (sequence->code_size == (repeat + 2)) {
+                error = "empty group";
+                break;
+            }
+            unsigned int count = 1;
+            ++str;
+            if (*str == 'x') {
+                const char *const end =
+                    parse_uint_value(str + 1, BEEP_SEQUENCE_MAX_REPEAT, &count);
+                if ((!end) || (count == 0)) {
+                    error = "invalid repeat count";
+                    break;
+                }
+                str = end;
+            }
+            if (!is_separator(*str)) {
+                error = "expected white space after group";
+                break;
+            }
+            uint32_t *const words = emit(sequence, 1);
+            if (!words) {
+                error = "out of memory";
+                break;
+            }
+            words[0] = OP_END;
+            sequence->code[repeat + 1] = count;
+        } else {
+            const char *const end = compile_tone(sequence, str,
+                                                 default_length, default_delay);
+            if (!end) {
+                error = "invalid tone, expected FREQ[:LENGTH[:DELAY]]";
+                break;
+            }
+            str = end;
+        }
+    }
+
+    if ((!error) && (sequence->code_size == 0)) {
+        error = "no tones";
+    }
+    uint32_t *const halt = error ? NULL : emit(sequence, 1);
+    if ((!error) && (!halt)) {
+        error = "out of memory";
+    }
+    if (error) {
+        log_error("--sequence: %s at offset %zu", error, (size_t)(str - source));
+        beep_sequence_free(sequence);
+        return NULL;
+    }
+    *halt = OP_HALT;
+
+    log_verbose("sequence: %zu bytes of bytecode",
+                sequence->code_size * sizeof(uint32_t));
+    return sequence;
+}
+
+
+size_t beep_sequence_next(beep_sequence *sequence,
+                          const beep_tone **const tones)
+{
+    const uint32_t *const code = sequence->code;
+    size_t pc    = sequence->pc;
+    size_t count = 0;
+
+    while (count < BEEP_SEQUENCE_BATCH) {
+        const uint32_t *const op = &code[pc];
+        if (op[0] == OP_TONE) {
+            beep_tone *const tone = &sequence->tones[count++];
+            tone->freq   = op[1];
+            tone->length = beep_tempo_ms(&sequence->tempo, op[2]);
+            tone->delay  = beep_tempo_ms(&sequence->tempo, op[3]);
+            tone->flags  = op[4];
+            pc += 5;
+        } else if (op[0] == OP_REPEAT) {
+            sequence->stack[sequence->depth].body = pc + 2;
+            sequence->stack[sequence->depth].left = op[1] - 1;
+            ++sequence->depth;
+            pc += 2;
+        } else if (op[0] == OP_END) {
+            const size_t top = sequence->depth - 1;
+            if (sequence->stack[top].left > 0) {
+                --sequence->stack[top].left;
+                pc = sequence->stack[top].body;
+            } else {
+                sequence->depth = top;
+                pc += 1;
+            }
+        } else {
+            break;
+        }
+    }
+
+    sequence->pc = pc;
+    *tones = sequence->tones;
+    return count;
+}
+
+
+void beep_sequence_free(beep_sequence *sequence)
+{
+    free(sequence->code);
+    free(sequence);
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
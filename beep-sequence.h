@@ -0,0 +1,78 @@
+/* beep-sequence.h - interface to the sequence language
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_SEQUENCE_H
+#define BEEP_SEQUENCE_H
+
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "beep-driver.h"
+
+
+/** Number of tones beep_sequence_next() returns at most */
+#define BEEP_SEQUENCE_BATCH 256
+
+/** Deepest nesting of repeat groups */
+#define BEEP_SEQUENCE_MAX_DEPTH 16
+
+/** Most repetitions of one group */
+#define BEEP_SEQUENCE_MAX_REPEAT 1000000
+
+
+typedef struct _beep_sequence beep_sequence;
+
+
+/** Compile a sequence program like "(A4:100 C5:100)x50".
+ *
+ * Tones without a length or delay get default_length and
+ * default_delay, and durations in beats are played at bpm.  Returns
+ * NULL after logging an error.
+ */
+beep_sequence *beep_sequence_compile(const char *const source,
+                                     const unsigned int default_length,
+                                     const unsigned int default_delay,
+                                     const unsigned int bpm)
+    __attribute__(( nonnull(1) ));
+
+
+/** Run the program until up to BEEP_SEQUENCE_BATCH tones are ready,
+ * and point *tones to them.  The tones stay valid until the next
+ * call.  Returns the number of tones, and 0 at the end.
+ */
+size_t beep_sequence_next(beep_sequence *sequence,
+                          const beep_tone **const tones)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Free the program */
+void beep_sequence_free(beep_sequence *sequence)
+    __attribute__(( nonnull(1) ));
+
+
+#endif /* BEEP_SEQUENCE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
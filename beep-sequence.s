@@ -0,0 +1,4479 @@
+	.file	"beep-sequence.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-sequence.c"
+	.type	is_space, @function
+is_space:
+.LVL0:
+.LFB18:
+	.file 1 "beep-sequence.c"
+	.loc 1 105 1 view -0
+	.cfi_startproc
+	.loc 1 106 5 view .LVU1
+	cmpb	$32, %dil
+	ja	.L3
+	movabsq	$4294977024, %rax
+	movl	%edi, %ecx
+	shrq	%cl, %rax
+	andl	$1, %eax
+.L2:
+	.loc 1 106 53 is_stmt 0 discriminator 6 view .LVU2
+	andl	$1, %eax
+	.loc 1 107 1 discriminator 6 view .LVU3
+	ret
+.L3:
+	.loc 1 106 53 view .LVU4
+	movl	$0, %eax
+	jmp	.L2
+	.cfi_endproc
+.LFE18:
+	.size	is_space, .-is_space
+	.type	is_separator, @function
+is_separator:
+.LVL1:
+.LFB19:
+	.loc 1 113 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 114 5 view .LVU6
+	.loc 1 114 53 is_stmt 0 view .LVU7
+	movl	$1, %eax
+	testb	%dil, %dil
+	je	.L9
+	.loc 1 113 1 discriminator 2 view .LVU8
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edi, %ebx
+	.loc 1 114 27 discriminator 2 view .LVU9
+	movsbl	%dil, %edi
+	.loc 1 114 27 discriminator 2 view .LVU10
+	call	is_space
+.LVL2:
+	.loc 1 114 27 discriminator 2 view .LVU11
+	movl	%eax, %edx
+	.loc 1 114 53 discriminator 2 view .LVU12
+	movl	$1, %eax
+	.loc 1 114 24 discriminator 2 view .LVU13
+	testb	%dl, %dl
+	jne	.L5
+	.loc 1 114 53 discriminator 4 view .LVU14
+	subl	$40, %ebx
+	cmpb	$1, %bl
+	setbe	%al
+	movzbl	%al, %eax
+.L5:
+	.loc 1 114 53 discriminator 8 view .LVU15
+	andl	$1, %eax
+	.loc 1 115 1 discriminator 8 view .LVU16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.LVL3:
+.L9:
+	.cfi_restore 3
+	.loc 1 114 53 view .LVU17
+	andl	$1, %eax
+	.loc 1 115 1 view .LVU18
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	is_separator, .-is_separator
+	.type	emit, @function
+emit:
+.LVL4:
+.LFB17:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 85 1 is_stmt 0 view .LVU20
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	movq	%rsi, %rbp
+	.loc 1 86 5 is_stmt 1 view .LVU21
+	.loc 1 86 49 is_stmt 0 view .LVU22
+	movq	16(%rdi), %rax
+	.loc 1 86 30 view .LVU23
+	movq	%rsi, %rdx
+	addq	8(%rdi), %rdx
+	.loc 1 86 8 view .LVU24
+	cmpq	%rdx, %rax
+	jnb	.L13
+.LBB2:
+	.loc 1 87 9 is_stmt 1 view .LVU25
+	.loc 1 88 45 is_stmt 0 view .LVU26
+	leaq	(%rax,%rax), %r12
+	testq	%rax, %rax
+	movl	$64, %eax
+	cmove	%rax, %r12
+.LVL5:
+	.loc 1 89 9 is_stmt 1 view .LVU27
+	.loc 1 89 32 is_stmt 0 view .LVU28
+	leaq	0(,%r12,4), %rsi
+.LVL6:
+	.loc 1 89 32 view .LVU29
+	movq	(%rdi), %rdi
+.LVL7:
+	.loc 1 89 32 view .LVU30
+	call	realloc@PLT
+.LVL8:
+	.loc 1 91 9 is_stmt 1 view .LVU31
+	.loc 1 91 12 is_stmt 0 view .LVU32
+	testq	%rax, %rax
+	je	.L12
+	.loc 1 94 9 is_stmt 1 view .LVU33
+	.loc 1 94 24 is_stmt 0 view .LVU34
+	movq	%rax, (%rbx)
+	.loc 1 95 9 is_stmt 1 view .LVU35
+	.loc 1 95 33 is_stmt 0 view .LVU36
+	movq	%r12, 16(%rbx)
+.LVL9:
+.L13:
+	.loc 1 95 33 view .LVU37
+.LBE2:
+	.loc 1 97 5 is_stmt 1 view .LVU38
+	.loc 1 97 53 is_stmt 0 view .LVU39
+	movq	8(%rbx), %rdx
+	.loc 1 97 21 view .LVU40
+	movq	(%rbx), %rax
+	leaq	(%rax,%rdx,4), %rax
+.LVL10:
+	.loc 1 98 5 is_stmt 1 view .LVU41
+	.loc 1 98 25 is_stmt 0 view .LVU42
+	addq	%rbp, %rdx
+	movq	%rdx, 8(%rbx)
+	.loc 1 99 5 is_stmt 1 view .LVU43
+.LVL11:
+.L12:
+	.loc 1 100 1 is_stmt 0 view .LVU44
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL12:
+	.loc 1 100 1 view .LVU45
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL13:
+	.loc 1 100 1 view .LVU46
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	emit, .-emit
+	.globl	beep_sequence_next
+	.type	beep_sequence_next, @function
+beep_sequence_next:
+.LVL14:
+.LFB22:
+	.loc 1 275 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 275 1 is_stmt 0 view .LVU48
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %r12
+	movq	%rsi, 8(%rsp)
+	.loc 1 276 5 is_stmt 1 view .LVU49
+	.loc 1 276 27 is_stmt 0 view .LVU50
+	movq	(%rdi), %r14
+.LVL15:
+	.loc 1 277 5 is_stmt 1 view .LVU51
+	.loc 1 277 12 is_stmt 0 view .LVU52
+	movq	24(%rdi), %rbp
+.LVL16:
+	.loc 1 278 5 is_stmt 1 view .LVU53
+	.loc 1 280 5 view .LVU54
+	.loc 1 280 18 view .LVU55
+	.loc 1 278 12 is_stmt 0 view .LVU56
+	movl	$0, %ebx
+.LBB3:
+.LBB4:
+	.loc 1 285 28 view .LVU57
+	leaq	296(%rdi), %rax
+	movq	%rax, (%rsp)
+	jmp	.L24
+.LVL17:
+.L27:
+	.loc 1 283 13 is_stmt 1 view .LVU58
+	.loc 1 283 59 is_stmt 0 view .LVU59
+	leaq	1(%rbx), %r15
+.LVL18:
+	.loc 1 284 13 is_stmt 1 view .LVU60
+	.loc 1 284 28 is_stmt 0 view .LVU61
+	movl	4(%r13), %eax
+	salq	$4, %rbx
+.LVL19:
+	.loc 1 284 28 view .LVU62
+	addq	%r12, %rbx
+	.loc 1 284 24 view .LVU63
+	movl	%eax, 312(%rbx)
+	.loc 1 285 13 is_stmt 1 view .LVU64
+	.loc 1 285 28 is_stmt 0 view .LVU65
+	movl	8(%r13), %esi
+	movq	(%rsp), %rdi
+	call	beep_tempo_ms@PLT
+.LVL20:
+	.loc 1 285 26 view .LVU66
+	movl	%eax, 316(%rbx)
+	.loc 1 286 13 is_stmt 1 view .LVU67
+	.loc 1 286 27 is_stmt 0 view .LVU68
+	movl	12(%r13), %esi
+	movq	(%rsp), %rdi
+	call	beep_tempo_ms@PLT
+.LVL21:
+	.loc 1 286 25 view .LVU69
+	movl	%eax, 320(%rbx)
+	.loc 1 287 13 is_stmt 1 view .LVU70
+	.loc 1 287 29 is_stmt 0 view .LVU71
+	movl	16(%r13), %eax
+	.loc 1 287 25 view .LVU72
+	movl	%eax, 324(%rbx)
+	.loc 1 288 13 is_stmt 1 view .LVU73
+	.loc 1 288 16 is_stmt 0 view .LVU74
+	addq	$5, %rbp
+.LVL22:
+	.loc 1 283 59 view .LVU75
+	movq	%r15, %rbx
+.LBE4:
+	jmp	.L20
+.LVL23:
+.L28:
+	.loc 1 290 13 is_stmt 1 view .LVU76
+	.loc 1 290 37 is_stmt 0 view .LVU77
+	movq	32(%r12), %rax
+	.loc 1 290 56 view .LVU78
+	addq	$2, %rbp
+.LVL24:
+	.loc 1 290 56 view .LVU79
+	movq	%rax, %rdx
+	salq	$4, %rdx
+	addq	%r12, %rdx
+	.loc 1 290 51 view .LVU80
+	movq	%rbp, 40(%rdx)
+	.loc 1 291 13 is_stmt 1 view .LVU81
+	.loc 1 291 59 is_stmt 0 view .LVU82
+	movl	4(%r13), %ecx
+	subl	$1, %ecx
+	.loc 1 291 51 view .LVU83
+	movl	%ecx, 48(%rdx)
+	.loc 1 292 13 is_stmt 1 view .LVU84
+	addq	$1, %rax
+	movq	%rax, 32(%r12)
+	.loc 1 293 13 view .LVU85
+.LVL25:
+.L20:
+	.loc 1 293 13 is_stmt 0 view .LVU86
+.LBE3:
+	.loc 1 280 18 is_stmt 1 view .LVU87
+	cmpq	$255, %rbx
+	ja	.L22
+.LVL26:
+.L24:
+.LBB6:
+	.loc 1 281 9 view .LVU88
+	.loc 1 281 31 is_stmt 0 view .LVU89
+	leaq	(%r14,%rbp,4), %r13
+.LVL27:
+	.loc 1 282 9 is_stmt 1 view .LVU90
+	.loc 1 282 15 is_stmt 0 view .LVU91
+	movl	0(%r13), %eax
+	.loc 1 282 12 view .LVU92
+	cmpl	$1, %eax
+	je	.L27
+	.loc 1 289 16 is_stmt 1 view .LVU93
+	.loc 1 289 19 is_stmt 0 view .LVU94
+	cmpl	$2, %eax
+	je	.L28
+	.loc 1 294 16 is_stmt 1 view .LVU95
+	.loc 1 294 19 is_stmt 0 view .LVU96
+	cmpl	$3, %eax
+	jne	.L22
+.LBB5:
+	.loc 1 295 13 is_stmt 1 view .LVU97
+	.loc 1 295 40 is_stmt 0 view .LVU98
+	movq	32(%r12), %rdx
+.LVL28:
+	.loc 1 296 13 is_stmt 1 view .LVU99
+	movq	%rdx, %rax
+	salq	$4, %rax
+	addq	%r12, %rax
+	.loc 1 296 37 is_stmt 0 view .LVU100
+	movl	32(%rax), %ecx
+	.loc 1 296 16 view .LVU101
+	testl	%ecx, %ecx
+	je	.L23
+	.loc 1 297 17 is_stmt 1 view .LVU102
+	subl	$1, %ecx
+	movl	%ecx, 32(%rax)
+	.loc 1 298 17 view .LVU103
+	.loc 1 298 20 is_stmt 0 view .LVU104
+	movq	24(%rax), %rbp
+.LVL29:
+	.loc 1 298 20 view .LVU105
+	jmp	.L20
+.L23:
+	.loc 1 300 17 is_stmt 1 view .LVU106
+	.loc 1 295 26 is_stmt 0 view .LVU107
+	subq	$1, %rdx
+.LVL30:
+	.loc 1 295 26 view .LVU108
+	movq	%rdx, 32(%r12)
+.LVL31:
+	.loc 1 301 17 is_stmt 1 view .LVU109
+	.loc 1 301 20 is_stmt 0 view .LVU110
+	addq	$1, %rbp
+.LVL32:
+	.loc 1 301 20 view .LVU111
+	jmp	.L20
+.LVL33:
+.L22:
+	.loc 1 301 20 view .LVU112
+.LBE5:
+.LBE6:
+	.loc 1 308 5 is_stmt 1 view .LVU113
+	.loc 1 308 18 is_stmt 0 view .LVU114
+	movq	%rbp, 24(%r12)
+	.loc 1 309 5 is_stmt 1 view .LVU115
+	.loc 1 309 14 is_stmt 0 view .LVU116
+	addq	$312, %r12
+.LVL34:
+	.loc 1 309 14 view .LVU117
+	movq	8(%rsp), %rax
+	movq	%r12, (%rax)
+	.loc 1 310 5 is_stmt 1 view .LVU118
+	.loc 1 311 1 is_stmt 0 view .LVU119
+	movq	%rbx, %rax
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL35:
+	.loc 1 311 1 view .LVU120
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL36:
+	.loc 1 311 1 view .LVU121
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL37:
+	.loc 1 311 1 view .LVU122
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL38:
+	.loc 1 311 1 view .LVU123
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL39:
+	.loc 1 311 1 view .LVU124
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	beep_sequence_next, .-beep_sequence_next
+	.globl	beep_sequence_free
+	.type	beep_sequence_free, @function
+beep_sequence_free:
+.LVL40:
+.LFB23:
+	.loc 1 315 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 315 1 is_stmt 0 view .LVU126
+	endbr64
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 316 5 is_stmt 1 view .LVU127
+	movq	(%rdi), %rdi
+.LVL41:
+	.loc 1 316 5 is_stmt 0 view .LVU128
+	call	free@PLT
+.LVL42:
+	.loc 1 317 5 is_stmt 1 view .LVU129
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL43:
+	.loc 1 318 1 is_stmt 0 view .LVU130
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL44:
+	.loc 1 318 1 view .LVU131
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	beep_sequence_free, .-beep_sequence_free
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"unexpected )"
+.LC1:
+	.string	"empty group"
+.LC2:
+	.string	"invalid repeat count"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"expected white space after group"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"out of memory"
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"invalid tone, expected FREQ[:LENGTH[:DELAY]]"
+	.section	.rodata.str1.1
+.LC6:
+	.string	"groups nested too deeply"
+.LC7:
+	.string	"no tones"
+.LC8:
+	.string	"missing )"
+.LC9:
+	.string	"--sequence: out of memory"
+.LC10:
+	.string	"--sequence: %s at offset %zu"
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"sequence: %zu bytes of bytecode"
+	.text
+	.globl	beep_sequence_compile
+	.type	beep_sequence_compile, @function
+beep_sequence_compile:
+.LVL45:
+.LFB21:
+	.loc 1 168 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 168 1 is_stmt 0 view .LVU133
+	endbr64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%rdi, 24(%rsp)
+	movl	%esi, 12(%rsp)
+	movl	%edx, %r14d
+	movl	%ecx, %ebx
+	.loc 1 168 1 view .LVU134
+	movq	%fs:40, %rax
+	movq	%rax, 184(%rsp)
+	xorl	%eax, %eax
+	.loc 1 169 5 is_stmt 1 view .LVU135
+	.loc 1 169 37 is_stmt 0 view .LVU136
+	movl	$4408, %edi
+.LVL46:
+	.loc 1 169 37 view .LVU137
+	call	malloc@PLT
+.LVL47:
+	.loc 1 169 37 view .LVU138
+	movq	%rax, %r12
+.LVL48:
+	.loc 1 170 5 is_stmt 1 view .LVU139
+	.loc 1 170 8 is_stmt 0 view .LVU140
+	testq	%rax, %rax
+	je	.L71
+	.loc 1 174 5 is_stmt 1 view .LVU141
+	.loc 1 174 20 is_stmt 0 view .LVU142
+	movq	$0, (%rax)
+	.loc 1 175 5 is_stmt 1 view .LVU143
+	.loc 1 175 25 is_stmt 0 view .LVU144
+	movq	$0, 8(%rax)
+	.loc 1 176 5 is_stmt 1 view .LVU145
+	.loc 1 176 29 is_stmt 0 view .LVU146
+	movq	$0, 16(%rax)
+	.loc 1 177 5 is_stmt 1 view .LVU147
+	.loc 1 177 18 is_stmt 0 view .LVU148
+	movq	$0, 24(%rax)
+	.loc 1 178 5 is_stmt 1 view .LVU149
+	.loc 1 178 21 is_stmt 0 view .LVU150
+	movq	$0, 32(%rax)
+	.loc 1 179 5 is_stmt 1 view .LVU151
+	leaq	296(%rax), %rdi
+	movl	%ebx, %esi
+	call	beep_tempo_init@PLT
+.LVL49:
+	.loc 1 182 5 view .LVU152
+	.loc 1 183 5 view .LVU153
+	.loc 1 184 5 view .LVU154
+	.loc 1 185 5 view .LVU155
+	.loc 1 187 5 view .LVU156
+	.loc 1 185 17 is_stmt 0 view .LVU157
+	movq	24(%rsp), %rbx
+.LVL50:
+	.loc 1 183 12 view .LVU158
+	movl	$0, %ebp
+.LBB13:
+.LBB14:
+.LBB15:
+	.loc 1 132 30 view .LVU159
+	leaq	36(%rsp), %rax
+	movq	%rax, 16(%rsp)
+.LBE15:
+.LBE14:
+.LBE13:
+	.loc 1 187 11 view .LVU160
+	jmp	.L51
+.LVL51:
+.L71:
+	.loc 1 171 9 is_stmt 1 view .LVU161
+	leaq	.LC9(%rip), %rdi
+	movl	$0, %eax
+.LVL52:
+	.loc 1 171 9 is_stmt 0 view .LVU162
+	call	log_error@PLT
+.LVL53:
+	.loc 1 172 9 is_stmt 1 view .LVU163
+	.loc 1 172 15 is_stmt 0 view .LVU164
+	jmp	.L31
+.LVL54:
+.L35:
+	.loc 1 189 13 is_stmt 1 view .LVU165
+	addq	$1, %rbx
+.LVL55:
+.L51:
+	.loc 1 188 16 view .LVU166
+	.loc 1 188 25 is_stmt 0 view .LVU167
+	movzbl	(%rbx), %r13d
+	.loc 1 188 16 view .LVU168
+	movsbl	%r13b, %edi
+	call	is_space
+.LVL56:
+	testb	%al, %al
+	jne	.L35
+	.loc 1 191 9 is_stmt 1 view .LVU169
+	.loc 1 191 12 is_stmt 0 view .LVU170
+	testb	%r13b, %r13b
+	je	.L72
+	.loc 1 196 16 is_stmt 1 view .LVU171
+	.loc 1 196 19 is_stmt 0 view .LVU172
+	cmpb	$40, %r13b
+	je	.L73
+	.loc 1 210 16 is_stmt 1 view .LVU173
+	.loc 1 210 19 is_stmt 0 view .LVU174
+	cmpb	$41, %r13b
+	jne	.L42
+.LBB20:
+	.loc 1 211 13 is_stmt 1 view .LVU175
+	.loc 1 211 16 is_stmt 0 view .LVU176
+	testq	%rbp, %rbp
+	je	.L59
+	.loc 1 215 13 is_stmt 1 view .LVU177
+	.loc 1 215 26 is_stmt 0 view .LVU178
+	subq	$1, %rbp
+.LVL57:
+	.loc 1 215 26 view .LVU179
+	movq	48(%rsp,%rbp,8), %r15
+.LVL58:
+	.loc 1 216 13 is_stmt 1 view .LVU180
+	.loc 1 216 48 is_stmt 0 view .LVU181
+	leaq	2(%r15), %rax
+	.loc 1 216 16 view .LVU182
+	cmpq	%rax, 8(%r12)
+	je	.L60
+	.loc 1 220 13 is_stmt 1 view .LVU183
+	.loc 1 220 26 is_stmt 0 view .LVU184
+	movl	$1, 44(%rsp)
+	.loc 1 221 13 is_stmt 1 view .LVU185
+	leaq	1(%rbx), %r13
+.LVL59:
+	.loc 1 222 13 view .LVU186
+	.loc 1 222 16 is_stmt 0 view .LVU187
+	cmpb	$120, 1(%rbx)
+	je	.L74
+.L44:
+	.loc 1 231 13 is_stmt 1 view .LVU188
+	.loc 1 231 18 is_stmt 0 view .LVU189
+	movsbl	0(%r13), %edi
+	call	is_separator
+.LVL60:
+	.loc 1 231 16 view .LVU190
+	testb	%al, %al
+	je	.L63
+	.loc 1 235 13 is_stmt 1 view .LVU191
+	.loc 1 235 37 is_stmt 0 view .LVU192
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	emit
+.LVL61:
+	.loc 1 236 13 is_stmt 1 view .LVU193
+	.loc 1 236 16 is_stmt 0 view .LVU194
+	testq	%rax, %rax
+	je	.L64
+	.loc 1 240 13 is_stmt 1 view .LVU195
+	.loc 1 240 22 is_stmt 0 view .LVU196
+	movl	$3, (%rax)
+	.loc 1 241 13 is_stmt 1 view .LVU197
+	.loc 1 241 40 is_stmt 0 view .LVU198
+	movq	(%r12), %rax
+.LVL62:
+	.loc 1 241 40 view .LVU199
+	movl	44(%rsp), %edx
+	movl	%edx, 4(%rax,%r15,4)
+.LBE20:
+	movq	%r13, %rbx
+	jmp	.L51
+.LVL63:
+.L72:
+	.loc 1 192 13 is_stmt 1 view .LVU200
+	.loc 1 192 16 is_stmt 0 view .LVU201
+	testq	%rbp, %rbp
+	jne	.L56
+.LVL64:
+	.loc 1 253 18 discriminator 1 view .LVU202
+	cmpq	$0, 8(%r12)
+	je	.L65
+.LVL65:
+	.loc 1 256 5 is_stmt 1 view .LVU203
+	.loc 1 256 42 is_stmt 0 view .LVU204
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	emit
+.LVL66:
+	.loc 1 257 5 is_stmt 1 view .LVU205
+	.loc 1 257 8 is_stmt 0 view .LVU206
+	testq	%rax, %rax
+	je	.L75
+.LVL67:
+	.loc 1 265 5 is_stmt 1 view .LVU207
+	.loc 1 265 11 is_stmt 0 view .LVU208
+	movl	$0, (%rax)
+	.loc 1 267 5 is_stmt 1 view .LVU209
+	.loc 1 267 10 view .LVU210
+	.loc 1 267 13 is_stmt 0 view .LVU211
+	cmpl	$0, log_level(%rip)
+	jle	.L31
+	.loc 1 267 46 is_stmt 1 discriminator 1 view .LVU212
+	movq	8(%r12), %rax
+.LVL68:
+	.loc 1 267 46 is_stmt 0 discriminator 1 view .LVU213
+	leaq	0(,%rax,4), %rsi
+	leaq	.LC11(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL69:
+	jmp	.L31
+.LVL70:
+.L73:
+.LBB24:
+	.loc 1 197 13 is_stmt 1 view .LVU214
+	.loc 1 197 16 is_stmt 0 view .LVU215
+	cmpq	$16, %rbp
+	je	.L57
+	.loc 1 201 13 is_stmt 1 view .LVU216
+	.loc 1 201 37 is_stmt 0 view .LVU217
+	movl	$2, %esi
+	movq	%r12, %rdi
+	call	emit
+.LVL71:
+	.loc 1 202 13 is_stmt 1 view .LVU218
+	.loc 1 202 16 is_stmt 0 view .LVU219
+	testq	%rax, %rax
+	je	.L58
+	.loc 1 206 13 is_stmt 1 view .LVU220
+	.loc 1 206 22 is_stmt 0 view .LVU221
+	movl	$2, (%rax)
+	.loc 1 207 13 is_stmt 1 view .LVU222
+	.loc 1 207 22 is_stmt 0 view .LVU223
+	movl	$1, 4(%rax)
+	.loc 1 208 13 is_stmt 1 view .LVU224
+.LVL72:
+	.loc 1 208 56 is_stmt 0 view .LVU225
+	movq	8(%r12), %rax
+.LVL73:
+	.loc 1 208 56 view .LVU226
+	subq	$2, %rax
+	.loc 1 208 34 view .LVU227
+	movq	%rax, 48(%rsp,%rbp,8)
+	.loc 1 209 13 is_stmt 1 view .LVU228
+	addq	$1, %rbx
+.LVL74:
+	.loc 1 208 30 is_stmt 0 view .LVU229
+	leaq	1(%rbp), %rbp
+.LVL75:
+	.loc 1 208 30 view .LVU230
+.LBE24:
+	jmp	.L51
+.LVL76:
+.L74:
+.LBB25:
+.LBB21:
+	.loc 1 223 17 is_stmt 1 view .LVU231
+	.loc 1 224 21 is_stmt 0 view .LVU232
+	leaq	44(%rsp), %rdx
+	leaq	2(%rbx), %rdi
+	movl	$1000000, %esi
+	call	parse_uint_value@PLT
+.LVL77:
+	.loc 1 225 17 is_stmt 1 view .LVU233
+	.loc 1 225 20 is_stmt 0 view .LVU234
+	testq	%rax, %rax
+	je	.L61
+	.loc 1 225 28 discriminator 1 view .LVU235
+	cmpl	$0, 44(%rsp)
+	je	.L62
+.LVL78:
+	.loc 1 229 21 view .LVU236
+	movq	%rax, %r13
+	jmp	.L44
+.LVL79:
+.L59:
+	.loc 1 229 21 view .LVU237
+.LBE21:
+	.loc 1 212 23 view .LVU238
+	leaq	.LC0(%rip), %rsi
+	jmp	.L52
+.LVL80:
+.L60:
+	.loc 1 217 23 view .LVU239
+	leaq	.LC1(%rip), %rsi
+	jmp	.L52
+.LVL81:
+.L61:
+	.loc 1 221 13 view .LVU240
+	movq	%r13, %rbx
+.LBB22:
+	.loc 1 226 27 view .LVU241
+	leaq	.LC2(%rip), %rsi
+	jmp	.L52
+.L62:
+	.loc 1 226 27 view .LVU242
+.LBE22:
+	.loc 1 221 13 view .LVU243
+	movq	%r13, %rbx
+.LBB23:
+	.loc 1 226 27 view .LVU244
+	leaq	.LC2(%rip), %rsi
+	jmp	.L52
+.LVL82:
+.L63:
+	.loc 1 226 27 view .LVU245
+.LBE23:
+	movq	%r13, %rbx
+	.loc 1 232 23 view .LVU246
+	leaq	.LC3(%rip), %rsi
+	jmp	.L52
+.LVL83:
+.L64:
+	.loc 1 232 23 view .LVU247
+	movq	%r13, %rbx
+	.loc 1 237 23 view .LVU248
+	leaq	.LC4(%rip), %rsi
+.LVL84:
+	.loc 1 237 23 view .LVU249
+.LBE25:
+	.loc 1 253 5 is_stmt 1 view .LVU250
+	jmp	.L52
+.LVL85:
+.L42:
+.LBB26:
+	.loc 1 243 13 view .LVU251
+.LBB18:
+.LBI14:
+	.loc 1 122 13 view .LVU252
+.LBB16:
+	.loc 1 126 5 view .LVU253
+	.loc 1 127 5 view .LVU254
+	.loc 1 128 5 view .LVU255
+	.loc 1 129 5 view .LVU256
+	.loc 1 129 8 is_stmt 0 view .LVU257
+	cmpb	$82, %r13b
+	jne	.L45
+	.loc 1 129 31 view .LVU258
+	movzbl	1(%rbx), %eax
+	.loc 1 129 23 view .LVU259
+	cmpb	$58, %al
+	je	.L46
+	.loc 1 129 46 view .LVU260
+	movsbl	%al, %edi
+	call	is_separator
+.LVL86:
+	.loc 1 129 43 view .LVU261
+	testb	%al, %al
+	je	.L45
+.L46:
+	.loc 1 130 9 is_stmt 1 view .LVU262
+	.loc 1 130 14 is_stmt 0 view .LVU263
+	movl	$0, 36(%rsp)
+	.loc 1 131 9 is_stmt 1 view .LVU264
+	.loc 1 131 13 is_stmt 0 view .LVU265
+	leaq	1(%rbx), %r13
+.LVL87:
+	.loc 1 127 14 view .LVU266
+	movl	$0, %r15d
+	.loc 1 131 13 view .LVU267
+	jmp	.L47
+.LVL88:
+.L45:
+	.loc 1 132 12 is_stmt 1 view .LVU268
+	.loc 1 132 30 is_stmt 0 view .LVU269
+	movq	16(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	parse_note_value@PLT
+.LVL89:
+	movq	%rax, %r13
+.LVL90:
+	.loc 1 132 15 view .LVU270
+	testq	%rax, %rax
+	je	.L48
+	.loc 1 133 9 is_stmt 1 view .LVU271
+	.loc 1 133 24 is_stmt 0 view .LVU272
+	movl	36(%rsp), %edi
+	.loc 1 133 15 view .LVU273
+	movl	%edi, %r15d
+	orl	$256, %r15d
+.LVL91:
+	.loc 1 134 9 is_stmt 1 view .LVU274
+	.loc 1 134 16 is_stmt 0 view .LVU275
+	call	beep_note_freq_hz@PLT
+.LVL92:
+	.loc 1 134 14 view .LVU276
+	movl	%eax, 36(%rsp)
+.LVL93:
+.L47:
+	.loc 1 139 5 is_stmt 1 view .LVU277
+	.loc 1 139 18 is_stmt 0 view .LVU278
+	movl	12(%rsp), %eax
+	movl	%eax, 40(%rsp)
+	.loc 1 140 5 is_stmt 1 view .LVU279
+	.loc 1 140 18 is_stmt 0 view .LVU280
+	movl	%r14d, 44(%rsp)
+	.loc 1 141 5 is_stmt 1 view .LVU281
+	.loc 1 141 8 is_stmt 0 view .LVU282
+	cmpb	$58, 0(%r13)
+	je	.L76
+.L50:
+.LVL94:
+	.loc 1 147 21 view .LVU283
+	movsbl	0(%r13), %edi
+	call	is_separator
+.LVL95:
+	.loc 1 147 16 view .LVU284
+	testb	%al, %al
+	je	.L49
+	.loc 1 151 5 is_stmt 1 view .LVU285
+	.loc 1 151 29 is_stmt 0 view .LVU286
+	movl	$5, %esi
+	movq	%r12, %rdi
+	call	emit
+.LVL96:
+	.loc 1 152 5 is_stmt 1 view .LVU287
+	.loc 1 152 8 is_stmt 0 view .LVU288
+	testq	%rax, %rax
+	je	.L49
+	.loc 1 155 5 is_stmt 1 view .LVU289
+	.loc 1 155 14 is_stmt 0 view .LVU290
+	movl	$1, (%rax)
+	.loc 1 156 5 is_stmt 1 view .LVU291
+	.loc 1 156 14 is_stmt 0 view .LVU292
+	movl	36(%rsp), %edx
+	movl	%edx, 4(%rax)
+	.loc 1 157 5 is_stmt 1 view .LVU293
+	.loc 1 157 14 is_stmt 0 view .LVU294
+	movl	40(%rsp), %edx
+	movl	%edx, 8(%rax)
+	.loc 1 158 5 is_stmt 1 view .LVU295
+	.loc 1 158 14 is_stmt 0 view .LVU296
+	movl	44(%rsp), %edx
+	movl	%edx, 12(%rax)
+	.loc 1 159 5 is_stmt 1 view .LVU297
+	.loc 1 159 14 is_stmt 0 view .LVU298
+	movl	%r15d, 16(%rax)
+	.loc 1 160 5 is_stmt 1 view .LVU299
+.LVL97:
+	.loc 1 160 5 is_stmt 0 view .LVU300
+.LBE16:
+.LBE18:
+	.loc 1 245 13 is_stmt 1 view .LVU301
+.LBB19:
+.LBB17:
+	movq	%r13, %rbx
+.LVL98:
+	.loc 1 245 13 is_stmt 0 view .LVU302
+	jmp	.L51
+.LVL99:
+.L48:
+	.loc 1 135 12 is_stmt 1 view .LVU303
+	.loc 1 135 30 is_stmt 0 view .LVU304
+	leaq	36(%rsp), %rdx
+	movl	$20000, %esi
+	movq	%rbx, %rdi
+	call	parse_rounded_value@PLT
+.LVL100:
+	.loc 1 135 30 view .LVU305
+	movq	%rax, %r13
+.LVL101:
+	.loc 1 135 15 view .LVU306
+	testq	%rax, %rax
+	je	.L49
+	.loc 1 127 14 view .LVU307
+	movl	$0, %r15d
+	jmp	.L47
+.LVL102:
+.L76:
+	.loc 1 142 9 is_stmt 1 view .LVU308
+	.loc 1 142 15 is_stmt 0 view .LVU309
+	leaq	1(%r13), %rdi
+	leaq	40(%rsp), %rdx
+	movl	$300000, %esi
+	call	parse_duration_value@PLT
+.LVL103:
+	movq	%rax, %r13
+.LVL104:
+	.loc 1 143 9 is_stmt 1 view .LVU310
+	.loc 1 143 12 is_stmt 0 view .LVU311
+	testq	%rax, %rax
+	je	.L49
+	.loc 1 143 17 view .LVU312
+	cmpb	$58, (%rax)
+	jne	.L50
+	.loc 1 144 13 is_stmt 1 view .LVU313
+	.loc 1 144 19 is_stmt 0 view .LVU314
+	leaq	1(%rax), %rdi
+	leaq	44(%rsp), %rdx
+	movl	$300000, %esi
+	call	parse_duration_value@PLT
+.LVL105:
+	.loc 1 144 19 view .LVU315
+	movq	%rax, %r13
+.LVL106:
+	.loc 1 147 5 is_stmt 1 view .LVU316
+	.loc 1 147 8 is_stmt 0 view .LVU317
+	testq	%rax, %rax
+	jne	.L50
+.LVL107:
+.L49:
+	.loc 1 147 8 view .LVU318
+.LBE17:
+.LBE19:
+	.loc 1 245 13 is_stmt 1 view .LVU319
+	.loc 1 246 23 is_stmt 0 view .LVU320
+	leaq	.LC5(%rip), %rsi
+	jmp	.L52
+.LVL108:
+.L57:
+	.loc 1 246 23 view .LVU321
+.LBE26:
+.LBB27:
+	.loc 1 198 23 view .LVU322
+	leaq	.LC6(%rip), %rsi
+	jmp	.L52
+.LVL109:
+.L58:
+	.loc 1 203 23 view .LVU323
+	leaq	.LC4(%rip), %rsi
+.LVL110:
+	.loc 1 203 23 view .LVU324
+.LBE27:
+	.loc 1 253 5 is_stmt 1 view .LVU325
+	.loc 1 257 5 view .LVU326
+	.loc 1 260 5 view .LVU327
+	jmp	.L52
+.LVL111:
+.L75:
+	.loc 1 258 15 is_stmt 0 view .LVU328
+	leaq	.LC4(%rip), %rsi
+	jmp	.L52
+.LVL112:
+.L56:
+	.loc 1 193 23 view .LVU329
+	leaq	.LC8(%rip), %rsi
+.LVL113:
+.L52:
+	.loc 1 261 9 is_stmt 1 view .LVU330
+	.loc 1 261 71 is_stmt 0 view .LVU331
+	movq	%rbx, %rdx
+	movq	24(%rsp), %rax
+	subq	%rax, %rdx
+	.loc 1 261 9 view .LVU332
+	leaq	.LC10(%rip), %rdi
+	movl	$0, %eax
+	call	log_error@PLT
+.LVL114:
+	.loc 1 262 9 is_stmt 1 view .LVU333
+	movq	%r12, %rdi
+	call	beep_sequence_free
+.LVL115:
+	.loc 1 263 9 view .LVU334
+	.loc 1 263 15 is_stmt 0 view .LVU335
+	movl	$0, %r12d
+.LVL116:
+.L31:
+	.loc 1 270 1 view .LVU336
+	movq	184(%rsp), %rax
+	subq	%fs:40, %rax
+	jne	.L77
+	movq	%r12, %rax
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL117:
+	.loc 1 270 1 view .LVU337
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL118:
+.L65:
+	.cfi_restore_state
+	.loc 1 254 15 view .LVU338
+	leaq	.LC7(%rip), %rsi
+.LVL119:
+	.loc 1 257 5 is_stmt 1 view .LVU339
+	jmp	.L52
+.LVL120:
+.L77:
+	.loc 1 270 1 is_stmt 0 view .LVU340
+	call	__stack_chk_fail@PLT
+.LVL121:
+	.cfi_endproc
+.LFE21:
+	.size	beep_sequence_compile, .-beep_sequence_compile
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "beep-driver.h"
+	.file 6 "beep-sequence.h"
+	.file 7 "beep-notes.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "beep-library.h"
+	.file 10 "beep-log.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb33
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF69
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x4
+	.long	0x62
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x62
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF16
+	.uleb128 0x13
+	.byte	0x5
+	.byte	0x22
+	.byte	0x9
+	.long	0x10a
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x23
+	.byte	0xe
+	.long	0xa2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x24
+	.byte	0xe
+	.long	0xa2
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x25
+	.byte	0xe
+	.long	0xa2
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x26
+	.byte	0xe
+	.long	0xa2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x27
+	.byte	0x3
+	.long	0xcd
+	.uleb128 0x4
+	.long	0x10a
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF22
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0x4
+	.long	0x122
+	.uleb128 0x7
+	.long	0x116
+	.uleb128 0x9
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x28
+	.byte	0x1f
+	.long	0x13d
+	.uleb128 0x29
+	.long	.LASF70
+	.value	0x1138
+	.byte	0x1
+	.byte	0x41
+	.byte	0x8
+	.long	0x1b3
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x1
+	.byte	0x42
+	.byte	0xf
+	.long	0x238
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x43
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x44
+	.byte	0xc
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x1e
+	.string	"pc"
+	.byte	0x1
+	.byte	0x46
+	.byte	0xc
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x47
+	.byte	0xc
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x7
+	.long	0x242
+	.byte	0x28
+	.uleb128 0x1f
+	.long	.LASF29
+	.byte	0x4d
+	.byte	0x10
+	.long	0x1e2
+	.value	0x128
+	.uleb128 0x1f
+	.long	.LASF30
+	.byte	0x4e
+	.byte	0xf
+	.long	0x252
+	.value	0x138
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x13
+	.byte	0x7
+	.byte	0x35
+	.byte	0x9
+	.long	0x1e2
+	.uleb128 0x1e
+	.string	"bpm"
+	.byte	0x7
+	.byte	0x36
+	.byte	0x12
+	.long	0x62
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x37
+	.byte	0xe
+	.long	0xb3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x38
+	.byte	0x3
+	.long	0x1bf
+	.uleb128 0x2b
+	.byte	0x7
+	.byte	0x4
+	.long	0x62
+	.byte	0x1
+	.byte	0x39
+	.byte	0x6
+	.long	0x215
+	.uleb128 0xf
+	.long	.LASF33
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF34
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF35
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF36
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x48
+	.byte	0x5
+	.long	0x238
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x49
+	.byte	0x10
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x12
+	.long	0xa2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x4
+	.long	0x238
+	.uleb128 0x14
+	.long	0x215
+	.long	0x252
+	.uleb128 0x15
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x14
+	.long	0x10a
+	.long	0x262
+	.uleb128 0x15
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF45
+	.byte	0x8
+	.value	0x238
+	.byte	0xd
+	.long	0x275
+	.uleb128 0x2
+	.long	0x94
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF39
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xe
+	.long	0x62
+	.long	0x290
+	.uleb128 0x2
+	.long	0x290
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x7
+	.long	0x1e2
+	.uleb128 0x20
+	.long	.LASF40
+	.value	0x234
+	.long	0x94
+	.long	0x2af
+	.uleb128 0x2
+	.long	0x94
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd
+	.long	0x122
+	.long	0x2cf
+	.uleb128 0x2
+	.long	0x122
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x2d4
+	.byte	0
+	.uleb128 0x7
+	.long	0x62
+	.uleb128 0x4
+	.long	0x2cf
+	.uleb128 0xb
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x42
+	.byte	0xd
+	.long	0x122
+	.long	0x2f9
+	.uleb128 0x2
+	.long	0x122
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x2d4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x45
+	.byte	0xe
+	.long	0x62
+	.long	0x30f
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x40
+	.byte	0xd
+	.long	0x122
+	.long	0x32a
+	.uleb128 0x2
+	.long	0x122
+	.uleb128 0x2
+	.long	0x2d4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF46
+	.byte	0xa
+	.byte	0x43
+	.long	0x33c
+	.uleb128 0x2
+	.long	0x127
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x38
+	.byte	0xd
+	.long	0x122
+	.long	0x35c
+	.uleb128 0x2
+	.long	0x122
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x2d4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF48
+	.byte	0x7
+	.byte	0x53
+	.long	0x372
+	.uleb128 0x2
+	.long	0x290
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x2d
+	.long	0x384
+	.uleb128 0x2
+	.long	0x127
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF50
+	.value	0x229
+	.long	0x94
+	.long	0x399
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF71
+	.byte	0x1
+	.value	0x13a
+	.byte	0x6
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ee
+	.uleb128 0x17
+	.long	.LASF51
+	.value	0x13a
+	.byte	0x28
+	.long	0x3ee
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xc
+	.quad	.LVL42
+	.long	0x262
+	.uleb128 0xa
+	.quad	.LVL43
+	.long	0x262
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x131
+	.uleb128 0x4
+	.long	0x3ee
+	.uleb128 0x2e
+	.long	.LASF55
+	.byte	0x1
+	.value	0x111
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x518
+	.uleb128 0x17
+	.long	.LASF51
+	.value	0x111
+	.byte	0x2a
+	.long	0x3ee
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x17
+	.long	.LASF30
+	.value	0x112
+	.byte	0x33
+	.long	0x51d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x10
+	.long	.LASF24
+	.value	0x114
+	.byte	0x1b
+	.long	0x527
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x18
+	.string	"pc"
+	.value	0x115
+	.byte	0xc
+	.long	0x35
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x10
+	.long	.LASF53
+	.value	0x116
+	.byte	0xc
+	.long	0x35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x22
+	.long	.LLRL11
+	.uleb128 0x18
+	.string	"op"
+	.value	0x119
+	.byte	0x1f
+	.long	0x527
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2f
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x4f0
+	.uleb128 0x10
+	.long	.LASF54
+	.value	0x11b
+	.byte	0x1e
+	.long	0x531
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x3
+	.quad	.LVL20
+	.long	0x275
+	.long	0x4d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL21
+	.long	0x275
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x18
+	.string	"top"
+	.value	0x127
+	.byte	0x1a
+	.long	0x41
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x12c
+	.uleb128 0x4
+	.long	0x518
+	.uleb128 0x7
+	.long	0xae
+	.uleb128 0x4
+	.long	0x522
+	.uleb128 0x7
+	.long	0x10a
+	.uleb128 0x4
+	.long	0x52c
+	.uleb128 0x30
+	.long	.LASF56
+	.byte	0x1
+	.byte	0xa4
+	.byte	0x10
+	.long	0x3ee
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x976
+	.uleb128 0xd
+	.long	.LASF57
+	.byte	0xa4
+	.byte	0x38
+	.long	0x127
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xd
+	.long	.LASF58
+	.byte	0xa5
+	.byte	0x39
+	.long	0x69
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xd
+	.long	.LASF59
+	.byte	0xa6
+	.byte	0x39
+	.long	0x69
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x24
+	.string	"bpm"
+	.byte	0xa7
+	.byte	0x39
+	.long	0x69
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0xa9
+	.byte	0x1a
+	.long	0x3f3
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x25
+	.long	.LASF64
+	.byte	0xb6
+	.byte	0xc
+	.long	0x976
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0xb7
+	.byte	0xc
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.long	.LASF60
+	.byte	0xb8
+	.byte	0x11
+	.long	0x122
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x19
+	.string	"str"
+	.byte	0xb9
+	.byte	0x11
+	.long	0x122
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x100
+	.byte	0x15
+	.long	0x23d
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x11
+	.long	.LLRL40
+	.long	0x649
+	.uleb128 0x8
+	.long	.LASF62
+	.byte	0xc9
+	.byte	0x1d
+	.long	0x23d
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0xa
+	.quad	.LVL71
+	.long	0xa84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LLRL35
+	.long	0x6ef
+	.uleb128 0x8
+	.long	.LASF63
+	.byte	0xd7
+	.byte	0x1a
+	.long	0x41
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x25
+	.long	.LASF53
+	.byte	0xdc
+	.byte	0x1a
+	.long	0x62
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.uleb128 0x8
+	.long	.LASF62
+	.byte	0xeb
+	.byte	0x1d
+	.long	0x23d
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x11
+	.long	.LLRL38
+	.long	0x6c8
+	.uleb128 0x19
+	.string	"end"
+	.byte	0xdf
+	.byte	0x23
+	.long	0x127
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xa
+	.quad	.LVL77
+	.long	0x33c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0xf4240
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL60
+	.long	0xa08
+	.uleb128 0xa
+	.quad	.LVL61
+	.long	0xa84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LLRL25
+	.long	0x875
+	.uleb128 0x19
+	.string	"end"
+	.byte	0xf3
+	.byte	0x1f
+	.long	0x127
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x31
+	.long	0x986
+	.quad	.LBI14
+	.byte	.LVU252
+	.long	.LLRL27
+	.byte	0x1
+	.byte	0xf3
+	.byte	0x25
+	.uleb128 0x12
+	.long	0x9b9
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x12
+	.long	0x9ae
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x12
+	.long	0x9a2
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x12
+	.long	0x997
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x22
+	.long	.LLRL27
+	.uleb128 0x1a
+	.long	0x9c4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -220
+	.uleb128 0x1b
+	.long	0x9cf
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1b
+	.long	0x9da
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1a
+	.long	0x9e6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x1a
+	.long	0x9f1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.uleb128 0x1b
+	.long	0x9fc
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xc
+	.quad	.LVL86
+	.long	0xa08
+	.uleb128 0x3
+	.quad	.LVL89
+	.long	0x30f
+	.long	0x7c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL92
+	.long	0x2f9
+	.uleb128 0xc
+	.quad	.LVL95
+	.long	0xa08
+	.uleb128 0x3
+	.quad	.LVL96
+	.long	0xa84
+	.long	0x7ff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL100
+	.long	0x2d9
+	.long	0x826
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4e20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL103
+	.long	0x2af
+	.long	0x84e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL105
+	.long	0x2af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x493e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL47
+	.long	0x384
+	.long	0x88e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1138
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL49
+	.long	0x35c
+	.long	0x8ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 296
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL53
+	.long	0x372
+	.long	0x8cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0xa56
+	.long	0x8ea
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL66
+	.long	0xa84
+	.long	0x907
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL69
+	.long	0x32a
+	.long	0x926
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL114
+	.long	0x372
+	.long	0x950
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL115
+	.long	0x399
+	.long	0x968
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL121
+	.long	0xb2d
+	.byte	0
+	.uleb128 0x14
+	.long	0x35
+	.long	0x986
+	.uleb128 0x15
+	.long	0x46
+	.byte	0xf
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF72
+	.byte	0x1
+	.byte	0x7a
+	.byte	0xd
+	.long	0x122
+	.byte	0x1
+	.long	0xa08
+	.uleb128 0x1c
+	.long	.LASF51
+	.byte	0x7a
+	.byte	0x29
+	.long	0x3ee
+	.uleb128 0x33
+	.string	"str"
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x3f
+	.long	0x122
+	.uleb128 0x1c
+	.long	.LASF58
+	.byte	0x7b
+	.byte	0x2d
+	.long	0x69
+	.uleb128 0x1c
+	.long	.LASF59
+	.byte	0x7c
+	.byte	0x2d
+	.long	0x69
+	.uleb128 0xe
+	.long	.LASF17
+	.byte	0x7e
+	.byte	0x12
+	.long	0x62
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x7f
+	.byte	0xe
+	.long	0xa2
+	.uleb128 0x34
+	.string	"end"
+	.byte	0x1
+	.byte	0x80
+	.byte	0x11
+	.long	0x122
+	.uleb128 0xe
+	.long	.LASF18
+	.byte	0x8b
+	.byte	0x12
+	.long	0x62
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x8c
+	.byte	0x12
+	.long	0x62
+	.uleb128 0xe
+	.long	.LASF62
+	.byte	0x97
+	.byte	0x15
+	.long	0x23d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF65
+	.byte	0x70
+	.byte	0x5
+	.long	0x11b
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa56
+	.uleb128 0x24
+	.string	"c"
+	.byte	0x70
+	.byte	0x1d
+	.long	0x9d
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.quad	.LVL2
+	.long	0xa56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF66
+	.byte	0x68
+	.byte	0x5
+	.long	0x11b
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa84
+	.uleb128 0x35
+	.string	"c"
+	.byte	0x1
+	.byte	0x68
+	.byte	0x19
+	.long	0x9d
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF67
+	.byte	0x54
+	.byte	0xb
+	.long	0x238
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb2d
+	.uleb128 0xd
+	.long	.LASF51
+	.byte	0x54
+	.byte	0x1f
+	.long	0x3ee
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xd
+	.long	.LASF53
+	.byte	0x54
+	.byte	0x36
+	.long	0x41
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.long	.LASF62
+	.byte	0x61
+	.byte	0x15
+	.long	0x23d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x23
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x8
+	.long	.LASF68
+	.byte	0x57
+	.byte	0x16
+	.long	0x41
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x59
+	.byte	0x19
+	.long	0x23d
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.quad	.LVL8
+	.long	0x295
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF73
+	.long	.LASF73
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -312
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x6
+	.byte	0xa
+	.value	0x138
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU51
+	.uleb128 .LVU124
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU53
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU121
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU58
+	.uleb128 .LVU88
+	.uleb128 .LVU90
+	.uleb128 .LVU123
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU76
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 19
+	.byte	0x34
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 18
+	.byte	0x34
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU99
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU112
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -244
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU139
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU336
+	.uleb128 .LVU338
+	.uleb128 .LVU340
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU154
+	.uleb128 .LVU161
+	.uleb128 .LVU179
+	.uleb128 .LVU200
+	.uleb128 .LVU225
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU237
+	.uleb128 .LVU239
+	.uleb128 .LVU251
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU155
+	.uleb128 .LVU161
+	.uleb128 .LVU165
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU156
+	.uleb128 .LVU161
+	.uleb128 .LVU165
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+	.uleb128 .LVU214
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU302
+	.uleb128 .LVU303
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU205
+	.uleb128 .LVU213
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+	.uleb128 .LVU339
+	.uleb128 .LVU340
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU218
+	.uleb128 .LVU226
+	.uleb128 .LVU323
+	.uleb128 .LVU328
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU180
+	.uleb128 .LVU200
+	.uleb128 .LVU231
+	.uleb128 .LVU237
+	.uleb128 .LVU239
+	.uleb128 .LVU251
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU193
+	.uleb128 .LVU199
+	.uleb128 .LVU247
+	.uleb128 .LVU251
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU233
+	.uleb128 .LVU237
+	.uleb128 .LVU240
+	.uleb128 .LVU245
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU318
+	.uleb128 .LVU321
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU252
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU318
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU252
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU318
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -244
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -244
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU252
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU318
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU252
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU318
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU255
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU300
+	.uleb128 .LVU303
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU318
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU270
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU283
+	.uleb128 .LVU303
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU318
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU287
+	.uleb128 .LVU300
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU27
+	.uleb128 .LVU37
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU31
+	.uleb128 .LVU37
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF62:
+	.string	"words"
+.LASF58:
+	.string	"default_length"
+.LASF72:
+	.string	"compile_tone"
+.LASF36:
+	.string	"OP_END"
+.LASF35:
+	.string	"OP_REPEAT"
+.LASF31:
+	.string	"remainder"
+.LASF14:
+	.string	"uint64_t"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF50:
+	.string	"malloc"
+.LASF59:
+	.string	"default_delay"
+.LASF41:
+	.string	"parse_duration_value"
+.LASF32:
+	.string	"beep_tempo"
+.LASF63:
+	.string	"repeat"
+.LASF54:
+	.string	"tone"
+.LASF19:
+	.string	"delay"
+.LASF30:
+	.string	"tones"
+.LASF23:
+	.string	"beep_sequence"
+.LASF43:
+	.string	"beep_note_freq_hz"
+.LASF51:
+	.string	"sequence"
+.LASF42:
+	.string	"parse_rounded_value"
+.LASF45:
+	.string	"free"
+.LASF47:
+	.string	"parse_uint_value"
+.LASF17:
+	.string	"freq"
+.LASF15:
+	.string	"long long int"
+.LASF70:
+	.string	"_beep_sequence"
+.LASF2:
+	.string	"long int"
+.LASF37:
+	.string	"body"
+.LASF33:
+	.string	"OP_HALT"
+.LASF57:
+	.string	"source"
+.LASF55:
+	.string	"beep_sequence_next"
+.LASF20:
+	.string	"flags"
+.LASF66:
+	.string	"is_space"
+.LASF18:
+	.string	"length"
+.LASF4:
+	.string	"unsigned char"
+.LASF7:
+	.string	"signed char"
+.LASF68:
+	.string	"capacity"
+.LASF16:
+	.string	"long long unsigned int"
+.LASF13:
+	.string	"uint32_t"
+.LASF6:
+	.string	"unsigned int"
+.LASF28:
+	.string	"stack"
+.LASF40:
+	.string	"realloc"
+.LASF24:
+	.string	"code"
+.LASF56:
+	.string	"beep_sequence_compile"
+.LASF46:
+	.string	"log_verbose"
+.LASF44:
+	.string	"parse_note_value"
+.LASF48:
+	.string	"beep_tempo_init"
+.LASF12:
+	.string	"char"
+.LASF22:
+	.string	"_Bool"
+.LASF65:
+	.string	"is_separator"
+.LASF38:
+	.string	"left"
+.LASF52:
+	.string	"log_level"
+.LASF5:
+	.string	"short unsigned int"
+.LASF21:
+	.string	"beep_tone"
+.LASF61:
+	.string	"halt"
+.LASF11:
+	.string	"__uint64_t"
+.LASF67:
+	.string	"emit"
+.LASF29:
+	.string	"tempo"
+.LASF49:
+	.string	"log_error"
+.LASF64:
+	.string	"open_groups"
+.LASF71:
+	.string	"beep_sequence_free"
+.LASF3:
+	.string	"long unsigned int"
+.LASF10:
+	.string	"__uint32_t"
+.LASF53:
+	.string	"count"
+.LASF39:
+	.string	"beep_tempo_ms"
+.LASF25:
+	.string	"code_size"
+.LASF34:
+	.string	"OP_TONE"
+.LASF60:
+	.string	"error"
+.LASF26:
+	.string	"code_capacity"
+.LASF73:
+	.string	"__stack_chk_fail"
+.LASF27:
+	.string	"depth"
+.LASF69:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-sequence.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,168 @@
+/* beep-timeline.c - record a timeline of a beep run
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* For finding the cause of timing stutter, --timeline=FILE records
+ * when each driver call, wait, tone sequence and stdin read began and
+ * ended.  Recording a span only takes two clock_gettime(2) vDSO calls
+ * and storing a few words into a preallocated array.
+ *
+ * All formatting happens at the end of the run, when the spans are
+ * written as Chrome trace event JSON ("X" complete events, timestamps
+ * in microseconds of CLOCK_MONOTONIC, the same clock the trace driver
+ * uses).  chrome://tracing and https://ui.perfetto.dev both load it.
+ */
+
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "beep-timeline.h"
+
+#include "beep-log.h"
+
+
+typedef struct {
+    const char   *name;
+    const char   *category;
+    const char   *arg_name;
+    unsigned int  arg;
+    uint64_t      start_ns;
+    uint64_t      end_ns;
+} timeline_span;
+
+
+bool timeline_enabled = false;
+
+
+static FILE          *timeline_file    = NULL;
+static timeline_span *timeline_spans   = NULL;
+static size_t         timeline_count   = 0;
+static unsigned long  timeline_dropped = 0;
+
+
+bool beep_timeline_open(const char *const filename)
+{
+    timeline_spans = malloc(BEEP_TIMELINE_MAX_SPANS * sizeof(timeline_span));
+    if (!timeline_spans) {
+        return false;
+    }
+    timeline_file = fopen(filename, "w");
+    if (!timeline_file) {
+        const int saved_errno = errno;
+        free(timeline_spans);
+        timeline_spans = NULL;
+        errno = saved_errno;
+        return false;
+    }
+    timeline_count = 0;
+    timeline_dropped = 0;
+    timeline_enabled = true;
+    log_verbose("timeline: recording to %s", filename);
+    return true;
+}
+
+
+uint64_t beep_timeline_now(void)
+{
+    if (!timeline_enabled) {
+        return 0;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+void beep_timeline_span(const char *const name, const char *const category,
+                        const uint64_t start_ns,
+                        const char *const arg_name, const unsigned int arg)
+{
+    if (!timeline_enabled) {
+        return;
+    }
+    if (timeline_count == BEEP_TIMELINE_MAX_SPANS) {
+        ++timeline_dropped;
+        return;
+    }
+    timeline_span *const span = &timeline_spans[timeline_count++];
+    span->name     = name;
+    span->category = category;
+    span->arg_name = arg_name;
+    span->arg      = arg;
+    span->start_ns = start_ns;
+    span->end_ns   = beep_timeline_now();
+}
+
+
+void beep_timeline_close(void)
+{
+    if (!timeline_enabled) {
+        return;
+    }
+    timeline_enabled = false;
+
+    const long pid = (long)getpid();
+    fputs("{\"traceEvents\":[\n", timeline_file);
+    for (size_t i=0; i<timeline_count; ++i) {
+        const timeline_span *const span = &timeline_spans[i];
+        const uint64_t duration_ns = span->end_ns - span->start_ns;
+        fprintf(timeline_file,
+                "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                "\"ts\":%llu.%03u,\"dur\":%llu.%03u,"
+                "\"pid\":%ld,\"tid\":%ld",
+                span->name, span->category,
+                (unsigned long long)(span->start_ns / 1000U),
+                (unsigned int)(span->start_ns % 1000U),
+                (unsigned long long)(duration_ns / 1000U),
+                (unsigned int)(duration_ns % 1000U),
+                pid, pid);
+        if (span->arg_name) {
+            fprintf(timeline_file, ",\"args\":{\"%s\":%u}",
+                    span->arg_name, span->arg);
+        }
+        fputs((i+1 < timeline_count) ? "},\n" : "}\n", timeline_file);
+    }
+    fprintf(timeline_file,
+            "],\n\"displayTimeUnit\":\"ns\",\n"
+            "\"otherData\":{\"dropped_spans\":%lu}}\n",
+            timeline_dropped);
+    if (fclose(timeline_file) != 0) {
+        log_warning("timeline: could not write: %s", strerror(errno));
+    }
+    log_verbose("timeline: %zu spans written, %lu dropped",
+                timeline_count, timeline_dropped);
+
+    timeline_file = NULL;
+    free(timeline_spans);
+    timeline_spans = NULL;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
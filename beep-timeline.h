@@ -0,0 +1,84 @@
+/* beep-timeline.h - record a timeline of a beep run
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_TIMELINE_H
+#define BEEP_TIMELINE_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/** Maximum number of spans recorded.  Later spans are dropped. */
+#define BEEP_TIMELINE_MAX_SPANS 65536
+
+
+/** Whether spans are being recorded.  Only test this, never set it. */
+extern bool timeline_enabled;
+
+
+/** Start recording spans, to be written to filename at the end.
+ *
+ * Returns false and sets errno if the file cannot be opened.
+ */
+bool beep_timeline_open(const char *const filename)
+    __attribute__(( nonnull(1) ));
+
+
+/** Current CLOCK_MONOTONIC time in nanoseconds, or 0 when disabled. */
+uint64_t beep_timeline_now(void);
+
+
+/** Record a span from start_ns (from beep_timeline_now()) until now.
+ *
+ * name, category and arg_name must be string literals, as only the
+ * pointers are stored.  arg_name may be NULL if there is no argument.
+ */
+void beep_timeline_span(const char *const name, const char *const category,
+                        const uint64_t start_ns,
+                        const char *const arg_name, const unsigned int arg)
+    __attribute__(( nonnull(1, 2) ));
+
+
+/** Write all recorded spans as Chrome trace event JSON and stop. */
+void beep_timeline_close(void);
+
+
+/** Begin a span, at the cost of a single branch when not recording */
+#define TIMELINE_BEGIN(start_var)                                       \
+    const uint64_t start_var = timeline_enabled ? beep_timeline_now() : 0
+
+/** End a span begun with TIMELINE_BEGIN() */
+#define TIMELINE_END(start_var, name, category, arg_name, arg)          \
+    do {                                                                \
+        if (timeline_enabled) {                                         \
+            beep_timeline_span(name, category, start_var, arg_name, arg); \
+        }                                                               \
+    } while (0)
+
+
+#endif /* BEEP_TIMELINE_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,3024 @@
+	.file	"beep-timeline.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-timeline.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"w"
+.LC1:
+	.string	"timeline: recording to %s"
+	.text
+	.globl	beep_timeline_open
+	.type	beep_timeline_open, @function
+beep_timeline_open:
+.LVL0:
+.LFB65:
+	.file 1 "beep-timeline.c"
+	.loc 1 66 1 view -0
+	.cfi_startproc
+	.loc 1 66 1 is_stmt 0 view .LVU1
+	endbr64
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx
+	.loc 1 67 5 is_stmt 1 view .LVU2
+	.loc 1 67 22 is_stmt 0 view .LVU3
+	movl	$3145728, %edi
+.LVL1:
+	.loc 1 67 22 view .LVU4
+	call	malloc@PLT
+.LVL2:
+	.loc 1 67 20 view .LVU5
+	movq	%rax, timeline_spans(%rip)
+	.loc 1 68 5 is_stmt 1 view .LVU6
+	.loc 1 68 8 is_stmt 0 view .LVU7
+	testq	%rax, %rax
+	je	.L4
+	.loc 1 71 5 is_stmt 1 view .LVU8
+	.loc 1 71 21 is_stmt 0 view .LVU9
+	leaq	.LC0(%rip), %rsi
+	movq	%rbx, %rdi
+	call	fopen@PLT
+.LVL3:
+	.loc 1 71 19 view .LVU10
+	movq	%rax, timeline_file(%rip)
+	.loc 1 72 5 is_stmt 1 view .LVU11
+	.loc 1 72 8 is_stmt 0 view .LVU12
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 79 5 is_stmt 1 view .LVU13
+	.loc 1 79 20 is_stmt 0 view .LVU14
+	movq	$0, timeline_count(%rip)
+	.loc 1 80 5 is_stmt 1 view .LVU15
+	.loc 1 80 22 is_stmt 0 view .LVU16
+	movq	$0, timeline_dropped(%rip)
+	.loc 1 81 5 is_stmt 1 view .LVU17
+	.loc 1 81 22 is_stmt 0 view .LVU18
+	movb	$1, timeline_enabled(%rip)
+	.loc 1 82 5 is_stmt 1 view .LVU19
+	.loc 1 82 10 view .LVU20
+	.loc 1 83 11 is_stmt 0 view .LVU21
+	movl	$1, %eax
+	.loc 1 82 13 view .LVU22
+	cmpl	$0, log_level(%rip)
+	jg	.L8
+.LVL4:
+.L1:
+	.loc 1 84 1 view .LVU23
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL5:
+.L7:
+	.cfi_restore_state
+.LBB10:
+	.loc 1 73 9 is_stmt 1 view .LVU24
+	.loc 1 73 34 is_stmt 0 view .LVU25
+	call	__errno_location@PLT
+.LVL6:
+	movq	%rax, %rbx
+.LVL7:
+	.loc 1 73 19 view .LVU26
+	movl	(%rax), %ebp
+.LVL8:
+	.loc 1 74 9 is_stmt 1 view .LVU27
+	movq	timeline_spans(%rip), %rdi
+	call	free@PLT
+.LVL9:
+	.loc 1 75 9 view .LVU28
+	.loc 1 75 24 is_stmt 0 view .LVU29
+	movq	$0, timeline_spans(%rip)
+	.loc 1 76 8 is_stmt 1 view .LVU30
+	.loc 1 76 14 is_stmt 0 view .LVU31
+	movl	%ebp, (%rbx)
+	.loc 1 77 9 is_stmt 1 view .LVU32
+	.loc 1 77 15 is_stmt 0 view .LVU33
+	movl	$0, %eax
+	jmp	.L1
+.LVL10:
+.L8:
+	.loc 1 77 15 view .LVU34
+.LBE10:
+	.loc 1 82 46 is_stmt 1 discriminator 1 view .LVU35
+	movq	%rbx, %rsi
+	leaq	.LC1(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL11:
+	.loc 1 83 11 is_stmt 0 discriminator 1 view .LVU36
+	movl	$1, %eax
+	jmp	.L1
+.L4:
+	.loc 1 69 15 view .LVU37
+	movl	$0, %eax
+	jmp	.L1
+	.cfi_endproc
+.LFE65:
+	.size	beep_timeline_open, .-beep_timeline_open
+	.globl	beep_timeline_now
+	.type	beep_timeline_now, @function
+beep_timeline_now:
+.LFB66:
+	.loc 1 88 1 is_stmt 1 view -0
+	.cfi_startproc
+	endbr64
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 88 1 is_stmt 0 view .LVU39
+	movq	%fs:40, %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 89 5 is_stmt 1 view .LVU40
+	.loc 1 89 8 is_stmt 0 view .LVU41
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L14
+.L9:
+	.loc 1 95 1 view .LVU42
+	movq	24(%rsp), %rdx
+	subq	%fs:40, %rdx
+	jne	.L15
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L14:
+	.cfi_restore_state
+	.loc 1 92 5 is_stmt 1 view .LVU43
+	.loc 1 93 5 view .LVU44
+	movq	%rsp, %rsi
+	movl	$1, %edi
+	call	clock_gettime@PLT
+.LVL12:
+	.loc 1 94 5 view .LVU45
+	.loc 1 94 32 is_stmt 0 view .LVU46
+	imulq	$1000000000, (%rsp), %rax
+	.loc 1 94 46 view .LVU47
+	addq	8(%rsp), %rax
+	jmp	.L9
+.L15:
+	.loc 1 95 1 view .LVU48
+	call	__stack_chk_fail@PLT
+.LVL13:
+	.cfi_endproc
+.LFE66:
+	.size	beep_timeline_now, .-beep_timeline_now
+	.globl	beep_timeline_span
+	.type	beep_timeline_span, @function
+beep_timeline_span:
+.LVL14:
+.LFB67:
+	.loc 1 101 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 101 1 is_stmt 0 view .LVU50
+	endbr64
+	.loc 1 102 5 is_stmt 1 view .LVU51
+	.loc 1 102 8 is_stmt 0 view .LVU52
+	cmpb	$0, timeline_enabled(%rip)
+	je	.L20
+	.loc 1 105 5 is_stmt 1 view .LVU53
+	.loc 1 105 24 is_stmt 0 view .LVU54
+	movq	timeline_count(%rip), %rax
+	.loc 1 105 8 view .LVU55
+	cmpq	$65536, %rax
+	je	.L22
+	.loc 1 101 1 view .LVU56
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 109 5 is_stmt 1 view .LVU57
+	.loc 1 109 63 is_stmt 0 view .LVU58
+	leaq	1(%rax), %r9
+	movq	%r9, timeline_count(%rip)
+	.loc 1 109 48 view .LVU59
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	.loc 1 109 26 view .LVU60
+	addq	timeline_spans(%rip), %rbx
+.LVL15:
+	.loc 1 110 5 is_stmt 1 view .LVU61
+	.loc 1 110 16 is_stmt 0 view .LVU62
+	movq	%rdi, (%rbx)
+	.loc 1 111 5 is_stmt 1 view .LVU63
+	.loc 1 111 20 is_stmt 0 view .LVU64
+	movq	%rsi, 8(%rbx)
+	.loc 1 112 5 is_stmt 1 view .LVU65
+	.loc 1 112 20 is_stmt 0 view .LVU66
+	movq	%rcx, 16(%rbx)
+	.loc 1 113 5 is_stmt 1 view .LVU67
+	.loc 1 113 15 is_stmt 0 view .LVU68
+	movl	%r8d, 24(%rbx)
+	.loc 1 114 5 is_stmt 1 view .LVU69
+	.loc 1 114 20 is_stmt 0 view .LVU70
+	movq	%rdx, 32(%rbx)
+	.loc 1 115 5 is_stmt 1 view .LVU71
+	.loc 1 115 20 is_stmt 0 view .LVU72
+	call	beep_timeline_now
+.LVL16:
+	.loc 1 115 18 view .LVU73
+	movq	%rax, 40(%rbx)
+	.loc 1 116 1 view .LVU74
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 116 1 view .LVU75
+	ret
+.LVL18:
+.L22:
+	.cfi_restore 3
+	.loc 1 106 9 is_stmt 1 view .LVU76
+	addq	$1, timeline_dropped(%rip)
+	.loc 1 107 9 view .LVU77
+	ret
+.L20:
+	ret
+	.cfi_endproc
+.LFE67:
+	.size	beep_timeline_span, .-beep_timeline_span
+	.section	.rodata.str1.1
+.LC2:
+	.string	"},\n"
+.LC3:
+	.string	"}\n"
+.LC4:
+	.string	"{\"traceEvents\":[\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu.%03u,\"dur\":%llu.%03u,\"pid\":%ld,\"tid\":%ld"
+	.section	.rodata.str1.1
+.LC6:
+	.string	",\"args\":{\"%s\":%u}"
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"],\n\"displayTimeUnit\":\"ns\",\n\"otherData\":{\"dropped_spans\":%lu}}\n"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"timeline: could not write: %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"timeline: %zu spans written, %lu dropped"
+	.text
+	.globl	beep_timeline_close
+	.type	beep_timeline_close, @function
+beep_timeline_close:
+.LFB68:
+	.loc 1 120 1 view -0
+	.cfi_startproc
+	endbr64
+	.loc 1 121 5 view .LVU79
+	.loc 1 121 8 is_stmt 0 view .LVU80
+	cmpb	$0, timeline_enabled(%rip)
+	jne	.L37
+	ret
+.L37:
+	.loc 1 120 1 view .LVU81
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 124 5 is_stmt 1 view .LVU82
+	.loc 1 124 22 is_stmt 0 view .LVU83
+	movb	$0, timeline_enabled(%rip)
+	.loc 1 126 5 is_stmt 1 view .LVU84
+	.loc 1 126 28 is_stmt 0 view .LVU85
+	call	getpid@PLT
+.LVL19:
+	.loc 1 126 16 view .LVU86
+	movslq	%eax, %r12
+.LVL20:
+	.loc 1 127 5 is_stmt 1 view .LVU87
+	movq	timeline_file(%rip), %rcx
+	movl	$17, %edx
+	movl	$1, %esi
+	leaq	.LC4(%rip), %rdi
+	call	fwrite@PLT
+.LVL21:
+	.loc 1 128 5 view .LVU88
+.LBB11:
+	.loc 1 128 10 view .LVU89
+	.loc 1 128 23 view .LVU90
+	cmpq	$0, timeline_count(%rip)
+	je	.L25
+	.loc 1 128 17 is_stmt 0 view .LVU91
+	movl	$0, %ebp
+.LBB12:
+	.loc 1 136 53 view .LVU92
+	movabsq	$2361183241434822607, %r13
+.LBB13:
+.LBB14:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdio2.h"
+	.loc 2 79 10 view .LVU93
+	leaq	.LC5(%rip), %r15
+.LBE14:
+.LBE13:
+	.loc 1 145 9 view .LVU94
+	leaq	.LC3(%rip), %r14
+	jmp	.L28
+.LVL22:
+.L26:
+	.loc 1 145 9 is_stmt 1 view .LVU95
+	.loc 1 145 17 is_stmt 0 view .LVU96
+	addq	$1, %rbp
+.LVL23:
+	.loc 1 145 9 view .LVU97
+	cmpq	timeline_count(%rip), %rbp
+	leaq	.LC2(%rip), %rdi
+	cmovnb	%r14, %rdi
+	movq	timeline_file(%rip), %rsi
+	call	fputs@PLT
+.LVL24:
+.LBE12:
+	.loc 1 128 40 is_stmt 1 view .LVU98
+	.loc 1 128 23 view .LVU99
+	cmpq	timeline_count(%rip), %rbp
+	jnb	.L25
+.LVL25:
+.L28:
+.LBB25:
+	.loc 1 129 9 view .LVU100
+	.loc 1 129 36 is_stmt 0 view .LVU101
+	leaq	0(%rbp,%rbp,2), %rbx
+	salq	$4, %rbx
+	addq	timeline_spans(%rip), %rbx
+.LVL26:
+	.loc 1 130 9 is_stmt 1 view .LVU102
+	.loc 1 130 57 is_stmt 0 view .LVU103
+	movq	32(%rbx), %rdi
+	.loc 1 130 24 view .LVU104
+	movq	40(%rbx), %rcx
+	subq	%rdi, %rcx
+.LVL27:
+	.loc 1 131 9 is_stmt 1 view .LVU105
+.LBB19:
+.LBI13:
+	.loc 2 77 1 view .LVU106
+.LBB15:
+	.loc 2 79 3 view .LVU107
+.LBE15:
+.LBE19:
+	.loc 1 136 53 is_stmt 0 view .LVU108
+	movq	%rdi, %rdx
+	shrq	$3, %rdx
+	movq	%rdx, %rax
+	mulq	%r13
+	shrq	$4, %rdx
+	movq	%rdx, %r9
+.LBB20:
+.LBB16:
+	.loc 2 79 10 view .LVU109
+	movq	8(%rbx), %r8
+	movq	(%rbx), %rsi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 72
+	pushq	%r12
+	.cfi_def_cfa_offset 80
+	pushq	%r12
+	.cfi_def_cfa_offset 88
+.LBE16:
+.LBE20:
+	.loc 1 139 44 view .LVU110
+	movq	%rcx, %rdx
+	shrq	$3, %rdx
+	movq	%rdx, %rax
+	mulq	%r13
+	shrq	$4, %rdx
+	imulq	$1000, %rdx, %rax
+	subq	%rax, %rcx
+.LVL28:
+.LBB21:
+.LBB17:
+	.loc 2 79 10 view .LVU111
+	pushq	%rcx
+	.cfi_def_cfa_offset 96
+	pushq	%rdx
+	.cfi_def_cfa_offset 104
+.LBE17:
+.LBE21:
+	.loc 1 137 47 view .LVU112
+	imulq	$1000, %r9, %rax
+	subq	%rax, %rdi
+.LBB22:
+.LBB18:
+	.loc 2 79 10 view .LVU113
+	pushq	%rdi
+	.cfi_def_cfa_offset 112
+	movq	%rsi, %rcx
+	movq	%r15, %rdx
+	movl	$1, %esi
+	movq	timeline_file(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL29:
+	.loc 2 79 10 view .LVU114
+.LBE18:
+.LBE22:
+	.loc 1 141 9 is_stmt 1 view .LVU115
+	.loc 1 141 17 is_stmt 0 view .LVU116
+	movq	16(%rbx), %rcx
+	.loc 1 141 12 view .LVU117
+	addq	$48, %rsp
+	.cfi_def_cfa_offset 64
+	testq	%rcx, %rcx
+	je	.L26
+	.loc 1 142 13 is_stmt 1 view .LVU118
+.LVL30:
+.LBB23:
+.LBI23:
+	.loc 2 77 1 view .LVU119
+.LBB24:
+	.loc 2 79 3 view .LVU120
+	.loc 2 79 10 is_stmt 0 view .LVU121
+	movl	24(%rbx), %r8d
+	leaq	.LC6(%rip), %rdx
+	movl	$1, %esi
+	movq	timeline_file(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL31:
+	.loc 2 79 10 view .LVU122
+	jmp	.L26
+.LVL32:
+.L25:
+	.loc 2 79 10 view .LVU123
+.LBE24:
+.LBE23:
+.LBE25:
+.LBE11:
+	.loc 1 147 5 is_stmt 1 view .LVU124
+.LBB26:
+.LBI26:
+	.loc 2 77 1 view .LVU125
+.LBB27:
+	.loc 2 79 3 view .LVU126
+	.loc 2 79 10 is_stmt 0 view .LVU127
+	movq	timeline_dropped(%rip), %rcx
+	leaq	.LC7(%rip), %rdx
+	movl	$1, %esi
+	movq	timeline_file(%rip), %rdi
+	movl	$0, %eax
+	call	__fprintf_chk@PLT
+.LVL33:
+	.loc 2 79 10 view .LVU128
+.LBE27:
+.LBE26:
+	.loc 1 151 5 is_stmt 1 view .LVU129
+	.loc 1 151 9 is_stmt 0 view .LVU130
+	movq	timeline_file(%rip), %rdi
+	call	fclose@PLT
+.LVL34:
+	.loc 1 151 8 view .LVU131
+	testl	%eax, %eax
+	jne	.L38
+.L29:
+	.loc 1 154 5 is_stmt 1 view .LVU132
+	.loc 1 154 10 view .LVU133
+	.loc 1 154 13 is_stmt 0 view .LVU134
+	cmpl	$0, log_level(%rip)
+	jg	.L39
+.L30:
+	.loc 1 154 8 is_stmt 1 discriminator 3 view .LVU135
+	.loc 1 157 5 discriminator 3 view .LVU136
+	.loc 1 157 19 is_stmt 0 discriminator 3 view .LVU137
+	movq	$0, timeline_file(%rip)
+	.loc 1 158 5 is_stmt 1 discriminator 3 view .LVU138
+	movq	timeline_spans(%rip), %rdi
+	call	free@PLT
+.LVL35:
+	.loc 1 159 5 discriminator 3 view .LVU139
+	.loc 1 159 20 is_stmt 0 discriminator 3 view .LVU140
+	movq	$0, timeline_spans(%rip)
+	.loc 1 160 1 discriminator 3 view .LVU141
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL36:
+	.loc 1 160 1 discriminator 3 view .LVU142
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL37:
+.L38:
+	.cfi_restore_state
+	.loc 1 152 9 is_stmt 1 view .LVU143
+	.loc 1 152 64 is_stmt 0 view .LVU144
+	call	__errno_location@PLT
+.LVL38:
+	.loc 1 152 9 view .LVU145
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL39:
+	movq	%rax, %rsi
+	leaq	.LC8(%rip), %rdi
+	movl	$0, %eax
+	call	log_warning@PLT
+.LVL40:
+	jmp	.L29
+.L39:
+	.loc 1 154 46 is_stmt 1 discriminator 1 view .LVU146
+	movq	timeline_dropped(%rip), %rdx
+	movq	timeline_count(%rip), %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$0, %eax
+	call	log_verbose@PLT
+.LVL41:
+	jmp	.L30
+	.cfi_endproc
+.LFE68:
+	.size	beep_timeline_close, .-beep_timeline_close
+	.local	timeline_dropped
+	.comm	timeline_dropped,8,8
+	.local	timeline_count
+	.comm	timeline_count,8,8
+	.local	timeline_spans
+	.comm	timeline_spans,8,8
+	.local	timeline_file
+	.comm	timeline_file,8,8
+	.globl	timeline_enabled
+	.bss
+	.type	timeline_enabled, @object
+	.size	timeline_enabled, 1
+timeline_enabled:
+	.zero	1
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 10 "beep-timeline.h"
+	.file 11 "beep-log.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/stdio2-decl.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/stdio.h"
+	.file 15 "/usr/include/time.h"
+	.file 16 "/usr/include/stdlib.h"
+	.file 17 "/usr/include/unistd.h"
+	.file 18 "/usr/include/errno.h"
+	.file 19 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x98b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF94
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x4d
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x8
+	.long	0x59
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x99
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x9a
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x4
+	.byte	0xa9
+	.byte	0xd
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xdc
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF17
+	.uleb128 0x8
+	.long	0xdc
+	.uleb128 0x12
+	.long	.LASF53
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.long	0x26e
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0xd7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0xd7
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0xd7
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0xd7
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0xd7
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0xd7
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0xd7
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0xd7
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0xd7
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0xd7
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0xd7
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x287
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x28c
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x4d
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x4d
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8f
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x6e
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x75
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x291
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x2a1
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0x9b
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2ab
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2b5
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x28c
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0x65
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x3a
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x4d
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x2ba
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0xe8
+	.uleb128 0x22
+	.long	.LASF95
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x11
+	.long	.LASF48
+	.uleb128 0x5
+	.long	0x282
+	.uleb128 0x5
+	.long	0xe8
+	.uleb128 0x13
+	.long	0xdc
+	.long	0x2a1
+	.uleb128 0x14
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x27a
+	.uleb128 0x11
+	.long	.LASF49
+	.uleb128 0x5
+	.long	0x2a6
+	.uleb128 0x11
+	.long	.LASF50
+	.uleb128 0x5
+	.long	0x2b0
+	.uleb128 0x13
+	.long	0xdc
+	.long	0x2ca
+	.uleb128 0x14
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x26e
+	.uleb128 0x15
+	.long	0x2ca
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF51
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x7
+	.byte	0x15
+	.long	0xbf
+	.uleb128 0x12
+	.long	.LASF54
+	.byte	0x10
+	.byte	0x8
+	.byte	0xb
+	.long	0x30e
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x10
+	.byte	0xc
+	.long	0xb3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x15
+	.byte	0x15
+	.long	0xcb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF57
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x15
+	.long	0x315
+	.uleb128 0x8
+	.long	0x315
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x8
+	.long	0x324
+	.uleb128 0x16
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x21
+	.long	0x340
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF59
+	.uleb128 0x16
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x1a
+	.long	0x4d
+	.uleb128 0x23
+	.byte	0x30
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x9
+	.long	0x3aa
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x1
+	.byte	0x2f
+	.byte	0x11
+	.long	0x315
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x1
+	.byte	0x30
+	.byte	0x11
+	.long	0x315
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x1
+	.byte	0x31
+	.byte	0x11
+	.long	0x315
+	.byte	0x10
+	.uleb128 0x24
+	.string	"arg"
+	.byte	0x1
+	.byte	0x32
+	.byte	0x12
+	.long	0x59
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x33
+	.byte	0xe
+	.long	0x324
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x1
+	.byte	0x34
+	.byte	0xe
+	.long	0x324
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0x1
+	.byte	0x35
+	.byte	0x3
+	.long	0x352
+	.uleb128 0x8
+	.long	0x3aa
+	.uleb128 0x25
+	.long	0x335
+	.byte	0x1
+	.byte	0x38
+	.byte	0x5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_enabled
+	.uleb128 0xe
+	.long	.LASF68
+	.byte	0x3b
+	.byte	0xe
+	.long	0x2ca
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_file
+	.uleb128 0xe
+	.long	.LASF69
+	.byte	0x3c
+	.byte	0x17
+	.long	0x3f7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_spans
+	.uleb128 0x5
+	.long	0x3aa
+	.uleb128 0x8
+	.long	0x3f7
+	.uleb128 0xe
+	.long	.LASF70
+	.byte	0x3d
+	.byte	0xf
+	.long	0x3a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_count
+	.uleb128 0xe
+	.long	.LASF71
+	.byte	0x3e
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_dropped
+	.uleb128 0x17
+	.long	.LASF72
+	.byte	0xc
+	.byte	0x31
+	.long	0x4d
+	.long	0x44b
+	.uleb128 0x3
+	.long	0x2cf
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF77
+	.byte	0x33
+	.long	0x45c
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF73
+	.byte	0xd
+	.value	0x1a3
+	.byte	0xe
+	.long	0xd7
+	.long	0x473
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF74
+	.byte	0xe
+	.byte	0xb2
+	.long	0x4d
+	.long	0x488
+	.uleb128 0x3
+	.long	0x2ca
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF75
+	.byte	0xe
+	.value	0x28f
+	.byte	0xc
+	.long	0x4d
+	.long	0x4a4
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x2cf
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF80
+	.byte	0x11
+	.value	0x28a
+	.byte	0x10
+	.long	0xa7
+	.uleb128 0xa
+	.long	.LASF76
+	.byte	0xf
+	.value	0x120
+	.byte	0xc
+	.long	0x4d
+	.long	0x4cd
+	.uleb128 0x3
+	.long	0x2db
+	.uleb128 0x3
+	.long	0x4cd
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e7
+	.uleb128 0x18
+	.long	.LASF78
+	.byte	0x43
+	.long	0x4e3
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF79
+	.byte	0x10
+	.value	0x238
+	.byte	0xd
+	.long	0x4f6
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF81
+	.byte	0x12
+	.byte	0x25
+	.byte	0xd
+	.long	0x502
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0xa
+	.long	.LASF82
+	.byte	0xe
+	.value	0x102
+	.byte	0xe
+	.long	0x2ca
+	.long	0x523
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x31a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF83
+	.byte	0x10
+	.value	0x229
+	.byte	0xe
+	.long	0x65
+	.long	0x53a
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF86
+	.byte	0x77
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x779
+	.uleb128 0x1a
+	.string	"pid"
+	.byte	0x7e
+	.byte	0x10
+	.long	0x35
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1b
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x675
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x80
+	.byte	0x11
+	.long	0x3a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x29
+	.long	.LLRL10
+	.uleb128 0x10
+	.long	.LASF84
+	.byte	0x81
+	.byte	0x24
+	.long	0x77e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x10
+	.long	.LASF85
+	.byte	0x82
+	.byte	0x18
+	.long	0x330
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2a
+	.long	0x951
+	.quad	.LBI13
+	.byte	.LVU106
+	.long	.LLRL13
+	.byte	0x1
+	.byte	0x83
+	.byte	0x9
+	.long	0x607
+	.uleb128 0x9
+	.long	0x96d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x9
+	.long	0x962
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xb
+	.quad	.LVL29
+	.long	0x42b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x951
+	.quad	.LBI23
+	.byte	.LVU119
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.byte	0x8e
+	.byte	0xd
+	.long	0x666
+	.uleb128 0x9
+	.long	0x96d
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x9
+	.long	0x962
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xb
+	.quad	.LVL31
+	.long	0x42b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL24
+	.long	0x488
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x951
+	.quad	.LBI26
+	.byte	.LVU125
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.byte	0x93
+	.byte	0x5
+	.long	0x6d4
+	.uleb128 0x9
+	.long	0x96d
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.long	0x962
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xb
+	.quad	.LVL33
+	.long	0x42b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL19
+	.long	0x4a4
+	.uleb128 0xc
+	.quad	.LVL21
+	.long	0x97a
+	.long	0x70a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x41
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL34
+	.long	0x473
+	.uleb128 0x7
+	.quad	.LVL35
+	.long	0x4e3
+	.uleb128 0x7
+	.quad	.LVL38
+	.long	0x4f6
+	.uleb128 0x7
+	.quad	.LVL39
+	.long	0x45c
+	.uleb128 0xc
+	.quad	.LVL40
+	.long	0x44b
+	.long	0x75d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL41
+	.long	0x4d2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x3b6
+	.uleb128 0x8
+	.long	0x779
+	.uleb128 0x19
+	.long	.LASF87
+	.byte	0x62
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x820
+	.uleb128 0xd
+	.long	.LASF62
+	.byte	0x62
+	.byte	0x2b
+	.long	0x31f
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xd
+	.long	.LASF63
+	.byte	0x62
+	.byte	0x43
+	.long	0x31f
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xd
+	.long	.LASF65
+	.byte	0x63
+	.byte	0x28
+	.long	0x330
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xd
+	.long	.LASF64
+	.byte	0x64
+	.byte	0x2b
+	.long	0x31f
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2b
+	.string	"arg"
+	.byte	0x1
+	.byte	0x64
+	.byte	0x48
+	.long	0x60
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x10
+	.long	.LASF84
+	.byte	0x6d
+	.byte	0x1a
+	.long	0x3fc
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.quad	.LVL16
+	.long	0x820
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF88
+	.byte	0x57
+	.byte	0xa
+	.long	0x324
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x87a
+	.uleb128 0x2c
+	.string	"ts"
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x15
+	.long	0x2e7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xc
+	.quad	.LVL12
+	.long	0x4b1
+	.long	0x86c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL13
+	.long	0x985
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF89
+	.byte	0x41
+	.byte	0x5
+	.long	0x340
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x951
+	.uleb128 0xd
+	.long	.LASF90
+	.byte	0x41
+	.byte	0x2a
+	.long	0x31f
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1b
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x8f1
+	.uleb128 0x10
+	.long	.LASF91
+	.byte	0x49
+	.byte	0x13
+	.long	0x54
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.quad	.LVL6
+	.long	0x4f6
+	.uleb128 0x7
+	.quad	.LVL9
+	.long	0x4e3
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL2
+	.long	0x523
+	.long	0x90a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x48
+	.byte	0x41
+	.byte	0x24
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL3
+	.long	0x507
+	.long	0x92f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL11
+	.long	0x4d2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF96
+	.byte	0x2
+	.byte	0x4d
+	.byte	0x1
+	.long	0x4d
+	.byte	0x3
+	.long	0x97a
+	.uleb128 0x1e
+	.long	.LASF92
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x2cf
+	.uleb128 0x1e
+	.long	.LASF93
+	.byte	0x4d
+	.byte	0x3c
+	.long	0x31a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF97
+	.long	.LASF98
+	.byte	0x13
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF99
+	.long	.LASF99
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS8:
+	.uleb128 .LVU87
+	.uleb128 .LVU142
+	.uleb128 .LVU143
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU90
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU123
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU95
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU123
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU105
+	.uleb128 .LVU111
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU106
+	.uleb128 .LVU114
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC5
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU106
+	.uleb128 .LVU114
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_file
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC6
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_file
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU125
+	.uleb128 .LVU128
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU125
+	.uleb128 .LVU128
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timeline_file
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU61
+	.uleb128 .LVU75
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU27
+	.uleb128 .LVU34
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF81:
+	.string	"__errno_location"
+.LASF82:
+	.string	"fopen"
+.LASF41:
+	.string	"_wide_data"
+.LASF53:
+	.string	"_IO_FILE"
+.LASF55:
+	.string	"tv_sec"
+.LASF29:
+	.string	"_IO_save_end"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF83:
+	.string	"malloc"
+.LASF39:
+	.string	"_offset"
+.LASF13:
+	.string	"__pid_t"
+.LASF23:
+	.string	"_IO_write_ptr"
+.LASF18:
+	.string	"_flags"
+.LASF16:
+	.string	"__syscall_slong_t"
+.LASF25:
+	.string	"_IO_buf_base"
+.LASF67:
+	.string	"timeline_span"
+.LASF30:
+	.string	"_markers"
+.LASF73:
+	.string	"strerror"
+.LASF43:
+	.string	"_freeres_buf"
+.LASF60:
+	.string	"timeline_enabled"
+.LASF90:
+	.string	"filename"
+.LASF79:
+	.string	"free"
+.LASF70:
+	.string	"timeline_count"
+.LASF52:
+	.string	"clockid_t"
+.LASF47:
+	.string	"FILE"
+.LASF51:
+	.string	"long long int"
+.LASF65:
+	.string	"start_ns"
+.LASF84:
+	.string	"span"
+.LASF38:
+	.string	"_lock"
+.LASF2:
+	.string	"long int"
+.LASF85:
+	.string	"duration_ns"
+.LASF35:
+	.string	"_cur_column"
+.LASF96:
+	.string	"fprintf"
+.LASF71:
+	.string	"timeline_dropped"
+.LASF36:
+	.string	"_vtable_offset"
+.LASF34:
+	.string	"_old_offset"
+.LASF98:
+	.string	"__builtin_fwrite"
+.LASF86:
+	.string	"beep_timeline_close"
+.LASF5:
+	.string	"unsigned char"
+.LASF88:
+	.string	"beep_timeline_now"
+.LASF68:
+	.string	"timeline_file"
+.LASF56:
+	.string	"tv_nsec"
+.LASF7:
+	.string	"signed char"
+.LASF58:
+	.string	"uint64_t"
+.LASF57:
+	.string	"long long unsigned int"
+.LASF37:
+	.string	"_shortbuf"
+.LASF48:
+	.string	"_IO_marker"
+.LASF80:
+	.string	"getpid"
+.LASF76:
+	.string	"clock_gettime"
+.LASF20:
+	.string	"_IO_read_end"
+.LASF22:
+	.string	"_IO_write_base"
+.LASF46:
+	.string	"_unused2"
+.LASF19:
+	.string	"_IO_read_ptr"
+.LASF78:
+	.string	"log_verbose"
+.LASF26:
+	.string	"_IO_buf_end"
+.LASF91:
+	.string	"saved_errno"
+.LASF17:
+	.string	"char"
+.LASF77:
+	.string	"log_warning"
+.LASF87:
+	.string	"beep_timeline_span"
+.LASF61:
+	.string	"log_level"
+.LASF42:
+	.string	"_freeres_list"
+.LASF12:
+	.string	"__off64_t"
+.LASF74:
+	.string	"fclose"
+.LASF59:
+	.string	"_Bool"
+.LASF44:
+	.string	"__pad5"
+.LASF89:
+	.string	"beep_timeline_open"
+.LASF10:
+	.string	"__uint64_t"
+.LASF63:
+	.string	"category"
+.LASF75:
+	.string	"fputs"
+.LASF6:
+	.string	"short unsigned int"
+.LASF93:
+	.string	"__fmt"
+.LASF69:
+	.string	"timeline_spans"
+.LASF64:
+	.string	"arg_name"
+.LASF97:
+	.string	"fwrite"
+.LASF3:
+	.string	"long unsigned int"
+.LASF24:
+	.string	"_IO_write_end"
+.LASF14:
+	.string	"__time_t"
+.LASF32:
+	.string	"_fileno"
+.LASF31:
+	.string	"_chain"
+.LASF50:
+	.string	"_IO_wide_data"
+.LASF45:
+	.string	"_mode"
+.LASF15:
+	.string	"__clockid_t"
+.LASF28:
+	.string	"_IO_backup_base"
+.LASF11:
+	.string	"__off_t"
+.LASF33:
+	.string	"_flags2"
+.LASF49:
+	.string	"_IO_codecvt"
+.LASF21:
+	.string	"_IO_read_base"
+.LASF62:
+	.string	"name"
+.LASF54:
+	.string	"timespec"
+.LASF40:
+	.string	"_codecvt"
+.LASF27:
+	.string	"_IO_save_base"
+.LASF72:
+	.string	"__fprintf_chk"
+.LASF99:
+	.string	"__stack_chk_fail"
+.LASF4:
+	.string	"unsigned int"
+.LASF92:
+	.string	"__stream"
+.LASF66:
+	.string	"end_ns"
+.LASF94:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF95:
+	.string	"_IO_lock_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-timeline.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,70 @@
+/* Auto-generated from beep-usage.txt. Modify that file instead. */
+#include "beep-usage.h"
+char beep_usage[] =
+  "Usage:\n"
+  "  beep [--verbose|--debug] [-e DEVICE]\n"
+  "       [-f FREQ_Hz] [-l LEN_ms] [-r REPS] [<-d|-D> DELAY_ms] [-s] [-c]\n"
+  "  beep [OPTIONS] <TONE_OPTS> [-n|--new TONE_OPTS...]\n"
+  "  beep [-h|--help]\n"
+  "  beep [-v|-V|--version]\n"
+  "\n"
+  "Beep the PC speaker in a number of ways.\n"
+  "\n"
+  "Options:\n"
+  "  Information options:\n"
+  "    -h, --help\n"
+  "                  print this usage information and exit\n"
+  "    -V, -v, --version\n"
+  "                  print program version information and exit\n"
+  "\n"
+  "  Global options:\n"
+  "    -e, --device=DEVICE\n"
+  "                  set the device to output the beeps to (see beep(1) man page)\n"
+  "                  give up to 16 times to beep on all those devices at once\n"
+  "                  trace:FILE appends timestamped tone edges to FILE\n"
+  "                  pcm:FILE and wav:FILE render the tones to FILE (- for stdout)\n"
+  "                  pwm:DIR drives the sysfs PWM channel DIR\n"
+  "    --debug, --verbose\n"
+  "                  make program output more verbose\n"
+  "    --timeline=FILE\n"
+  "                  write a Chrome trace event JSON timeline of the run to FILE\n"
+  "    --score=FILE\n"
+  "                  play the tones from FILE (- for stdin) instead of the tone\n"
+  "                  options, one FREQ_Hz [LENGTH_ms [DELAY_ms]] line per tone,\n"
+  "                  or a binary score written by --export-score\n"
+  "    --sequence=PROGRAM\n"
+  "                  play the tones of PROGRAM instead of the tone options,\n"
+  "                  FREQ[:LENGTH[:DELAY]] tones and (PROGRAM)xCOUNT groups,\n"
+  "                  e.g. '(A4:100 C5:100)x50 R:200 A4:1b'\n"
+  "    --rtttl=FILE  play the RTTTL ringtones in FILE (- for stdin) instead of\n"
+  "                  the tone options, one NAME:d=4,o=6,b=63:NOTES per line\n"
+  "    --export-score=FILE\n"
+  "                  write the tones to the binary score FILE (- for stdout)\n"
+  "                  instead of playing them\n"
+  "    --bpm=BPM     tempo for lengths and delays given in beats (default 120)\n"
+  "\n"
+  "  Tone options:\n"
+  "    -f FREQ_Hz    frequency of the tone in Hertz (Hz)\n"
+  "    -f NOTE       note name with octave, e.g. A4 (440 Hz), C#5 or Bb3\n"
+  "    -l LENGTH_ms  length of the tone in milliseconds (ms)\n"
+  "    -l BEATSb     length of the tone in beats at the --bpm tempo,\n"
+  "                  e.g. 1b, 1/2b or 3/8b (also for -d and -D)\n"
+  "    -d DELAY_ms   delay between repetitions of the tone\n"
+  "                  *without* delay after last repetition of the tone\n"
+  "    -D DELAY_ms   delay between repetitions of the tone\n"
+  "                  *with* delay after last repetition of the tone\n"
+  "    -r REPS       number of repetitions of the last tone\n"
+  "\n"
+  "    -n, --new     start a new tone\n"
+  "\n"
+  "    -s            read text from stdin and write it through to stdout,\n"
+  "                  beeping the last defined tone for every newline in the text,\n"
+  "		  until EOF in stdin\n"
+  "    -c            like -s, but beep for every character in the text\n"
+  "\n"
+  "Exit status:\n"
+  "  0      if OK\n"
+  "  non-0  if any problems occured\n"
+  "\n"
+  "More documentation is available in the beep(1) man page via:  man 1 beep\n"
+  ;
@@ -0,0 +1,242 @@
+	.file	"beep-usage.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "beep-usage.c"
+	.globl	beep_usage
+	.data
+	.align 32
+	.type	beep_usage, @object
+	.size	beep_usage, 2886
+beep_usage:
+	.ascii	"Usage:\n  beep [--verbose|--debug] [-e DEVICE]\n       [-f F"
+	.ascii	"REQ_Hz] [-l LEN_ms] [-r REPS] [<-d|-D> DELAY_ms] [-s] [-c]\n"
+	.ascii	"  beep [OPTIONS] <TONE_OPTS> [-n|--new TONE_OPTS...]\n  beep"
+	.ascii	" [-h|--help]\n  beep [-v|-V|--version]\n\nBeep the PC speake"
+	.ascii	"r in a number of ways.\n\nOptions:\n  Information options:\n"
+	.ascii	"    -h, --help\n                  print this usage informati"
+	.ascii	"on and exit\n    -V, -v, --version\n                  print "
+	.ascii	"program version information and exit\n\n  Global options:\n "
+	.ascii	"   -e, --device=DEVICE\n                  set the device to "
+	.ascii	"output the beeps to (see beep(1) man page)\n                "
+	.ascii	"  give up to 16 times to beep on all those devices at once\n"
+	.ascii	"                  trace:FILE appends timestamped tone edges "
+	.ascii	"to FILE\n                  pcm:FILE and wav:FILE render the "
+	.ascii	"tones to FILE (- for stdout)\n                  pwm:DIR driv"
+	.ascii	"es the sysfs PWM channel DIR\n    --debug, --verbose\n      "
+	.ascii	"            make program output more verbose\n    --timeline"
+	.ascii	"=FILE\n                  write a Chrome trace event JSON tim"
+	.ascii	"eline of the run to FILE\n    --score=FILE\n                "
+	.ascii	"  play the tones from FILE (- for stdin) instead of the tone"
+	.ascii	"\n                  options, one FREQ_Hz [LENGTH_ms [DELAY_m"
+	.ascii	"s]] line per tone,\n                  or a binary score writ"
+	.ascii	"ten by --export-score\n    --sequence=PROGRAM\n             "
+	.ascii	"     play the tones of PROGRAM instead of the tone options,\n"
+	.ascii	"                  FREQ[:LENGTH[:DELAY]] tones and (PROGRAM)x"
+	.ascii	"COUNT groups,\n                  e.g. '(A4:100 C5:100)x50 R:"
+	.ascii	"200 A4:1b'\n    --rtttl=FILE  play the RTTTL ringtones in FI"
+	.ascii	"LE (- for stdin) instead of\n                  the tone opti"
+	.ascii	"ons, one NAME:d=4,o=6,b=63:NOTES per line\n    --export-scor"
+	.ascii	"e=FILE\n                  write the tones to the binary scor"
+	.ascii	"e FILE (- for stdout)\n                  instead of playing "
+	.ascii	"them\n    --bpm=BPM     tempo for lengths and delays given i"
+	.ascii	"n beats (default 120)\n\n  Tone options:\n    -f FREQ_Hz    "
+	.ascii	"frequency of the tone in Hertz (Hz)\n    -f NOTE       note "
+	.ascii	"name with octave, e.g. A4 (440 Hz), C#5 or Bb3\n    -l LENGT"
+	.ascii	"H_ms"
+	.ascii	"  length of the tone in milliseconds (ms)\n    -l BEATSb    "
+	.ascii	" length of the tone in beats at the --bpm tempo,\n          "
+	.ascii	"        e.g. 1b, 1/2b or 3/8b (also for -d and -D)\n    -d D"
+	.ascii	"ELAY_ms   delay between repetitions of the tone\n           "
+	.ascii	"       *without* delay after last repetition of the tone\n  "
+	.ascii	"  -D DELAY_ms   delay between repetitions of the tone\n     "
+	.ascii	"             *with* delay after last repetition of the tone\n"
+	.ascii	"    -r REPS       number of repetitions of the last tone\n\n"
+	.ascii	"    -n, --new     start a new tone\n\n    -s            read"
+	.ascii	" text from stdin and write it through to stdout,\n          "
+	.ascii	"        beeping the last defined tone fo"
+	.string	"r every newline in the text,\n\t\t  until EOF in stdin\n    -c            like -s, but beep for every character in the text\n\nExit status:\n  0      if OK\n  non-0  if any problems occured\n\nMore documentation is available in the beep(1) man page via:  man 1 beep\n"
+	.text
+.Letext0:
+	.file 1 "beep-usage.h"
+	.file 2 "beep-usage.c"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x67
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF4
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.long	0x29
+	.long	0x29
+	.uleb128 0x4
+	.byte	0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x5
+	.long	.LASF5
+	.byte	0x1
+	.byte	0x16
+	.byte	0xd
+	.long	0x1e
+	.uleb128 0x1
+	.long	0x29
+	.long	0x4d
+	.uleb128 0x6
+	.long	0x4d
+	.value	0xb45
+	.byte	0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x2
+	.byte	0x3
+	.byte	0x6
+	.long	0x3c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	beep_usage
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x1c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF4:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O -std=gnu99 -fstack-protector-strong -fstack-clash-protection -fcf-protection=full -fasynchronous-unwind-tables"
+.LASF3:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"beep_usage"
+.LASF2:
+	.string	"char"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"beep-usage.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
+	.section	.note.gnu.property,"a"
+	.align 8
+	.long	1f - 0f
+	.long	4f - 1f
+	.long	5
+0:
+	.string	"GNU"
+1:
+	.align 8
+	.long	0xc0000002
+	.long	3f - 2f
+2:
+	.long	0x3
+3:
+	.align 8
+4:
@@ -0,0 +1,59 @@
+/* beep-usdt.h - USDT static tracepoints for perf, bpftrace and systemtap
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef BEEP_USDT_H
+#define BEEP_USDT_H
+
+
+/* Built with "make USDT=yes", every BEEP_PROBEn() becomes a single
+ * nop instruction plus an ELF note in the "beep" provider, which
+ * tools like bpftrace can attach to at runtime, e.g.
+ *
+ *   bpftrace -e 'usdt:/usr/bin/beep:beep:begin_tone { @[arg1] = count(); }'
+ *
+ * The probes and their arguments are listed in DEVELOPMENT.md.
+ *
+ * Otherwise, they compile to nothing at all, and <sys/sdt.h> from
+ * systemtap is not needed.
+ */
+
+#ifdef BEEP_USDT
+
+# include <sys/sdt.h>
+
+# define BEEP_PROBE1(name, a1)             DTRACE_PROBE1(beep, name, a1)
+# define BEEP_PROBE2(name, a1, a2)         DTRACE_PROBE2(beep, name, a1, a2)
+
+#else
+
+# define BEEP_PROBE1(name, a1)             do {} while (0)
+# define BEEP_PROBE2(name, a1, a2)         do {} while (0)
+
+#endif
+
+
+#endif /* BEEP_USDT_H */
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
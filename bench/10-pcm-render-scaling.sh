@@ -0,0 +1,25 @@
+# Render one hour of tones into a WAV file on 1, 2, 4, ... CPUs.  The
+# PCM driver uses one thread per CPU it may run on.
+
+wav="$(mktemp)"
+cpus="$(nproc)"
+
+# 12 times 5 minutes
+score=(-f 1000 -l 300000 -r 12 -d 0)
+
+echo "rendering one hour at 48kHz, ${cpus} CPUs available"
+n=1
+while test "$n" -le "$cpus"; do
+    start="$(now)"
+    taskset -c "0-$(expr "$n" - 1)" "${BEEP}" -e "wav:${wav}" "${score[@]}"
+    end="$(now)"
+    echo "  ${n} CPUs: $(elapsed "$start" "$end") s"
+    n="$(expr "$n" \* 2)"
+done
+
+start="$(now)"
+"${BEEP}" -e "pcm:-" "${score[@]}" > /dev/null
+end="$(now)"
+echo "  streaming to a pipe: $(elapsed "$start" "$end") s"
+
+rm -f "${wav}"
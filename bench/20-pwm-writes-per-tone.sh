@@ -0,0 +1,23 @@
+# Count the sysfs attribute writes the PWM driver needs per tone, for
+# a melody changing frequency on every tone and for repeated tones of
+# the same frequency, using a fake sysfs PWM directory.
+
+pwm="$(mktemp -d)"
+: > "${pwm}/period"
+: > "${pwm}/duty_cycle"
+: > "${pwm}/enable"
+
+writes() {
+    "${BEEP}" --verbose -e "pwm:${pwm}" "$@" 2>&1 \
+        | sed -n 's/^.*pwm: \([0-9]* attribute writes for [0-9]* tones\)$/\1/p'
+}
+
+melody=(-f 262 -l 1 -d 0)
+for f in 294 330 349 392 440 494 523 494 440 392 349 330 294 262; do
+    melody+=(-n -f "$f" -l 1 -d 0)
+done
+
+echo "  changing frequency: $(writes "${melody[@]}")"
+echo "  same frequency:     $(writes -f 440 -l 1 -d 0 -r 15)"
+
+rm -rf "${pwm}"
@@ -0,0 +1,22 @@
+# Compare the per edge overhead of the driver layer between the
+# dynamic driver registry, a STATIC_DRIVER build, and a STATIC_DRIVER
+# build with NO_VERBOSE=yes, using the noop driver.
+
+tmp="$(mktemp -d)"
+
+cflags=(-std=gnu99 -O -I.)
+common=(bench/edge-dispatch.c beep-drivers.c beep-library.c beep-log.c
+        beep-timeline.c)
+static=(-DBEEP_STATIC_DRIVER=noop_driver
+        -DBEEP_STATIC_DRIVER_SOURCE='"beep-driver-noop.c"')
+
+gcc "${cflags[@]}" -o "${tmp}/dynamic" "${common[@]}" beep-driver-noop.c
+gcc "${cflags[@]}" "${static[@]}" -o "${tmp}/static" "${common[@]}"
+gcc "${cflags[@]}" "${static[@]}" -DBEEP_LOG_MAX_LEVEL=0 \
+    -o "${tmp}/static-no-verbose" "${common[@]}"
+
+for variant in dynamic static static-no-verbose; do
+    printf "  %-18s %s\n" "${variant}:" "$("${tmp}/${variant}")"
+done
+
+rm -rf "${tmp}"
@@ -0,0 +1,12 @@
+# Distribution of the time from exec(2) until beep begins its first
+# tone, which is what matters for alerts fired from event handlers.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -o "${tmp}/exec-first-edge" bench/exec-first-edge.c
+touch "${tmp}/trace"
+
+"${tmp}/exec-first-edge" 500 "${tmp}/trace" \
+                         "${BEEP}" -e "trace:${tmp}/trace" -l 0
+
+rm -rf "${tmp}"
@@ -0,0 +1,11 @@
+# Parse time of huge generated command lines, which should grow
+# linearly with the number of options.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -I. -o "${tmp}/parse-args" bench/parse-args.c beep-library.c \
+    beep-log.c
+
+"${tmp}/parse-args" "${BEEP}"
+
+rm -rf "${tmp}"
@@ -0,0 +1,17 @@
+# Reading a text score parses every line, while a mapped binary score
+# is used as it is.  Both should have their first tones right away.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -I. -o "${tmp}/score-formats" bench/score-formats.c \
+    beep-score.c beep-notes.c beep-library.c beep-log.c
+
+awk 'BEGIN { for (i=0; i<1000000; ++i) printf "%d %d %d\n", 100+(i%5000), i%300, i%50 }' \
+    > "${tmp}/text"
+"${BEEP}" --export-score="${tmp}/binary" --score="${tmp}/text"
+
+cd "${tmp}"
+./score-formats text binary
+./score-formats text binary
+
+rm -rf "${tmp}"
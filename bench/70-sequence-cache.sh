@@ -0,0 +1,26 @@
+# Time from exec(2) to the first tone edge for a long command line,
+# parsed every time and played from the sequence cache.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -o "${tmp}/exec-first-edge" bench/exec-first-edge.c
+touch "${tmp}/trace"
+
+args=()
+for i in $(seq 1 5000); do
+    args+=(-f $((100 + i % 1000)).5 -l 0 -d 0 -n)
+done
+args+=(-l 0)
+
+for cache in none cached; do
+    echo "${cache}:"
+    if test "${cache}" = none; then
+        cache_env=(env -u XDG_CACHE_HOME HOME=/nonexistent)
+    else
+        cache_env=(env XDG_CACHE_HOME="${tmp}/cache")
+    fi
+    "${cache_env[@]}" "${tmp}/exec-first-edge" 100 "${tmp}/trace" \
+                      "${BEEP}" -e "trace:${tmp}/trace" "${args[@]}"
+done
+
+rm -rf "${tmp}"
@@ -0,0 +1,14 @@
+# A million tones from nested repeat groups, compared with the same
+# tones written out in full: the groups start right away and need no
+# more memory than the phrase, while the written out program is
+# compiled as a whole before the first tone.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -I. -o "${tmp}/sequence-program" bench/sequence-program.c \
+    beep-sequence.c beep-notes.c beep-library.c beep-log.c
+
+"${tmp}/sequence-program"
+"${tmp}/sequence-program"
+
+rm -rf "${tmp}"
@@ -0,0 +1,26 @@
+# Read a large corpus of RTTTL ringtones, one per line, with the one
+# pass tokenizer of beep --rtttl.
+
+tmp="$(mktemp -d)"
+
+gcc -std=gnu99 -O -I. -o "${tmp}/rtttl-corpus" bench/rtttl-corpus.c \
+    beep-rtttl.c beep-notes.c beep-library.c beep-log.c
+
+awk 'BEGIN {
+    split("c c# d d# e f f# g g# a a# b p", letters, " ");
+    split("1 2 4 8 16 32", durations, " ");
+    for (i=0; i<100000; ++i) {
+        printf "Tone%d:d=%d,o=%d,b=%d:", i, durations[3 + i%3], 4 + i%3, 63 + i%200;
+        for (n=0; n<40; ++n) {
+            k = (i * 7 + n * 5) % 13;
+            printf "%s%s%s%s%s", (n%3 ? durations[1 + (i+n)%6] : ""), letters[1 + k],
+                (n%4 ? "" : "."), (n%2 ? 4 + (i+n)%4 : ""), (n<39 ? "," : "\n");
+        }
+    }
+}' > "${tmp}/corpus"
+
+cd "${tmp}"
+./rtttl-corpus corpus
+./rtttl-corpus corpus
+
+rm -rf "${tmp}"
@@ -0,0 +1,66 @@
+/* edge-dispatch.c - measure the per edge overhead of the driver layer
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Plays a long sequence of zero length tones on the noop driver,
+ * which does nothing but log, so that all the measured time is spent
+ * in beep_drivers_play_sequence() dispatching the tone edges.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <time.h>
+
+#include "beep-drivers.h"
+#include "beep-driver-noop.h"
+
+
+#define TONES 4000000
+
+
+static beep_tone tones[TONES];
+
+
+int main(void)
+{
+    static volatile sig_atomic_t abort_flag = false;
+
+    for (size_t i=0; i<TONES; ++i) {
+        tones[i].freq = 440;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    beep_drivers_play_sequence(&noop_driver, tones, TONES, &abort_flag);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const double ns = (double)(end.tv_sec - start.tv_sec) * 1e9
+        + (double)(end.tv_nsec - start.tv_nsec);
+    printf("%.2f ns per edge\n", ns / (2.0 * TONES));
+    return EXIT_SUCCESS;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,116 @@
+/* exec-first-edge.c - measure the time from exec to the first tone edge
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Usage: exec-first-edge RUNS TRACE_FILE BEEP [ARGS...]
+ *
+ * Runs BEEP [ARGS...] RUNS times.  BEEP must be told to write to
+ * trace:TRACE_FILE, whose first record has the CLOCK_MONOTONIC time
+ * of the first tone edge.  The child process reads the same clock
+ * right before execv(2), so the difference is the time from exec to
+ * the first edge, without the fork(2).
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+
+static
+uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+static
+int compare_u64(const void *a, const void *b)
+{
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+int main(const int argc, char *const argv[])
+{
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s RUNS TRACE_FILE BEEP [ARGS...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const size_t runs = strtoul(argv[1], NULL, 10);
+    const char *const trace_file = argv[2];
+
+    uint64_t *const exec_ns = mmap(NULL, sizeof(uint64_t),
+                                   PROT_READ|PROT_WRITE,
+                                   MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    uint64_t *const samples = calloc(runs, sizeof(uint64_t));
+    if ((exec_ns == MAP_FAILED) || (!samples) || (runs == 0)) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i=0; i<runs; ++i) {
+        if (-1 == truncate(trace_file, 0)) {
+            perror(trace_file);
+            return EXIT_FAILURE;
+        }
+        const pid_t pid = fork();
+        if (pid == 0) {
+            *exec_ns = now_ns();
+            execv(argv[3], &argv[3]);
+            _exit(127);
+        }
+        int status;
+        if ((pid == -1) || (-1 == waitpid(pid, &status, 0))
+            || (!WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+            fprintf(stderr, "%s failed\n", argv[3]);
+            return EXIT_FAILURE;
+        }
+
+        uint64_t edge_ns = 0;
+        const int fd = open(trace_file, O_RDONLY);
+        if ((fd == -1)
+            || (sizeof(edge_ns) != read(fd, &edge_ns, sizeof(edge_ns)))) {
+            fprintf(stderr, "%s: no tone edge recorded\n", trace_file);
+            return EXIT_FAILURE;
+        }
+        close(fd);
+        samples[i] = edge_ns - *exec_ns;
+    }
+
+    qsort(samples, runs, sizeof(uint64_t), compare_u64);
+    printf("%zu runs, exec to first edge in us: "
+           "min %.1f  median %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+           runs,
+           samples[0] / 1e3,
+           samples[runs / 2] / 1e3,
+           samples[(runs * 90) / 100] / 1e3,
+           samples[(runs * 99) / 100] / 1e3,
+           samples[runs - 1] / 1e3);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/* parse-args.c - measure command line parsing of huge tone lists
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Usage: parse-args BEEP
+ *
+ * First compares the sscanf(3) calls the command line parser used to
+ * make with the parse_*_value() functions from beep-library.c.
+ *
+ * Then runs "BEEP -f 523.25 -l 120 -d 30 -n ... -h" with up to 100000
+ * options.  The -h makes beep exit right after parsing them all.  The
+ * same command line passed to /bin/true gives the exec(2) cost, which
+ * is subtracted to get the parse time per option.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/wait.h>
+
+#include "beep-library.h"
+
+
+static
+uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+static
+void compare_number_parsers(void)
+{
+    static const char *const values[] = { "523.25", "120", "30", "440" };
+    const unsigned int rounds = 1000000;
+    unsigned int sum = 0;
+
+    const uint64_t start_ns = now_ns();
+    for (unsigned int i=0; i<rounds; ++i) {
+        float f;
+        unsigned int u;
+        sscanf(values[0], "%f", &f);
+        sum += (unsigned int)(f + 0.5f);
+        for (int k=1; k<4; ++k) {
+            sscanf(values[k], "%u", &u);
+            sum += u;
+        }
+    }
+    const uint64_t middle_ns = now_ns();
+    for (unsigned int i=0; i<rounds; ++i) {
+        unsigned int u;
+        parse_rounded_value(values[0], 20000U, &u);
+        sum += u;
+        for (int k=1; k<4; ++k) {
+            parse_uint_value(values[k], 300000U, &u);
+            sum += u;
+        }
+    }
+    const uint64_t end_ns = now_ns();
+
+    printf("  sscanf:             %6.1f ns per value\n",
+           (double)(middle_ns - start_ns) / (4.0 * rounds));
+    printf("  parse_*_value:      %6.1f ns per value (%u)\n",
+           (double)(end_ns - middle_ns) / (4.0 * rounds), sum & 1);
+}
+
+
+/* Best of 5 runs of program with the given argv, in nanoseconds */
+static
+uint64_t time_exec(const char *const program, char *argv[])
+{
+    uint64_t best_ns = UINT64_MAX;
+    for (int run=0; run<5; ++run) {
+        const uint64_t start_ns = now_ns();
+        const pid_t pid = fork();
+        if (pid == 0) {
+            const int null_fd = open("/dev/null", O_WRONLY);
+            dup2(null_fd, STDOUT_FILENO);
+            execv(program, argv);
+            _exit(127);
+        }
+        int status;
+        if ((pid == -1) || (-1 == waitpid(pid, &status, 0))
+            || (!WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+            fprintf(stderr, "%s failed\n", program);
+            exit(EXIT_FAILURE);
+        }
+        const uint64_t elapsed_ns = now_ns() - start_ns;
+        if (elapsed_ns < best_ns) {
+            best_ns = elapsed_ns;
+        }
+    }
+    return best_ns;
+}
+
+
+int main(const int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s BEEP\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    compare_number_parsers();
+
+    static char *tone[] = { "-f", "523.25", "-l", "120", "-d", "30", "-n" };
+    const size_t max_options = 100000;
+    char **const beep_argv = calloc(2 * max_options + 3, sizeof(char *));
+    if (!beep_argv) {
+        return EXIT_FAILURE;
+    }
+    for (size_t options=1000; options<=max_options; options*=10) {
+        size_t n = 0;
+        beep_argv[n++] = argv[1];
+        for (size_t i=0; i<options/4; ++i) {
+            for (size_t k=0; k<7; ++k) {
+                beep_argv[n++] = tone[k];
+            }
+        }
+        beep_argv[n++] = "-h";
+        beep_argv[n] = NULL;
+
+        const uint64_t beep_ns = time_exec(argv[1], beep_argv);
+        const uint64_t true_ns = time_exec("/bin/true", beep_argv);
+        printf("  %6zu options:     %6.2f ms, %5.1f ns per option\n",
+               options, (double)beep_ns / 1e6,
+               (double)(beep_ns - true_ns) / (double)options);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/* rtttl-corpus.c - measure reading RTTTL ringtones
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Usage: rtttl-corpus FILE...
+ *
+ * Reads each file of RTTTL ringtones with beep_rtttl_next() like
+ * beep --rtttl does, without playing them, and prints the time until
+ * the first tones are available, the throughput and the time per
+ * tone.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sys/stat.h>
+#include <time.h>
+
+#include "beep-rtttl.h"
+
+
+static
+uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+int main(const int argc, char *const argv[])
+{
+    for (int i=1; i<argc; ++i) {
+        struct stat sb;
+        if (0 != stat(argv[i], &sb)) {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+
+        const uint64_t start_ns = now_ns();
+        beep_rtttl *const rtttl = beep_rtttl_open(argv[i]);
+        if (!rtttl) {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+
+        uint64_t first_ns = 0;
+        uint64_t tone_count = 0;
+        uint64_t length_sum = 0;
+        const beep_tone *tones;
+        ssize_t count;
+        while (0 < (count = beep_rtttl_next(rtttl, &tones))) {
+            if (tone_count == 0) {
+                first_ns = now_ns();
+            }
+            for (ssize_t k=0; k<count; ++k) {
+                length_sum += tones[k].length;
+            }
+            tone_count += (uint64_t)count;
+        }
+        beep_rtttl_close(rtttl);
+        const uint64_t end_ns = now_ns();
+
+        if ((count < 0) || (tone_count == 0)) {
+            return EXIT_FAILURE;
+        }
+        printf("%-8s %5.1f MB, %8llu tones, first tones after %6.1f us, "
+               "%6.1f MB/s, %5.1f ns per tone (%llu ms)\n",
+               argv[i], (double)sb.st_size / 1e6,
+               (unsigned long long)tone_count,
+               (double)(first_ns - start_ns) / 1000.0,
+               ((double)sb.st_size * 1000.0) / (double)(end_ns - start_ns),
+               (double)(end_ns - start_ns) / (double)tone_count,
+               (unsigned long long)length_sum);
+    }
+    return EXIT_SUCCESS;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
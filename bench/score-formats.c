@@ -0,0 +1,92 @@
+/* score-formats.c - compare reading text and binary scores
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Usage: score-formats SCORE...
+ *
+ * Reads each score with beep_score_next() like beep --score does,
+ * without playing it, and prints the time until the first tones are
+ * available and the time per tone for the whole score.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <time.h>
+
+#include "beep-score.h"
+
+
+static
+uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+int main(const int argc, char *const argv[])
+{
+    for (int i=1; i<argc; ++i) {
+        const uint64_t start_ns = now_ns();
+        beep_score *const score = beep_score_open(argv[i], 200, 100);
+        if (!score) {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+
+        uint64_t first_ns = 0;
+        uint64_t tone_count = 0;
+        uint64_t freq_sum = 0;
+        const beep_tone *tones;
+        ssize_t count;
+        while (0 < (count = beep_score_next(score, &tones))) {
+            if (tone_count == 0) {
+                first_ns = now_ns();
+            }
+            for (ssize_t k=0; k<count; ++k) {
+                freq_sum += tones[k].freq;
+            }
+            tone_count += (uint64_t)count;
+        }
+        beep_score_close(score);
+        const uint64_t end_ns = now_ns();
+
+        if ((count < 0) || (tone_count == 0)) {
+            return EXIT_FAILURE;
+        }
+        printf("%-12s %8llu tones, first tones after %7.1f us, "
+               "%6.1f ns per tone (freq sum %llu)\n",
+               argv[i], (unsigned long long)tone_count,
+               (double)(first_ns - start_ns) / 1000.0,
+               (double)(end_ns - start_ns) / (double)tone_count,
+               (unsigned long long)freq_sum);
+    }
+    return EXIT_SUCCESS;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
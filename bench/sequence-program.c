@@ -0,0 +1,127 @@
+/* sequence-program.c - run sequence programs with and without groups
+ * Copyright (C) 2019 Hans Ulrich Niedermann
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+/* Usage: sequence-program
+ *
+ * Runs a million tones of a two tone phrase with beep_sequence_next()
+ * like beep --sequence does, without playing them, once as nested
+ * repeat groups and once written out in full.  Prints the time until
+ * the first tones are available, the time per tone and how much the
+ * maximum resident set size has grown.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/resource.h>
+#include <time.h>
+
+#include "beep-sequence.h"
+
+
+#define TONE_COUNT 1000000
+
+
+static
+uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+static
+long maxrss_kb(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+
+static
+int run(const char *const name, const char *const source)
+{
+    const long     start_kb = maxrss_kb();
+    const uint64_t start_ns = now_ns();
+    beep_sequence *const sequence = beep_sequence_compile(source, 0, 0, 120);
+    if (!sequence) {
+        return EXIT_FAILURE;
+    }
+
+    uint64_t first_ns = 0;
+    uint64_t tone_count = 0;
+    uint64_t freq_sum = 0;
+    const beep_tone *tones;
+    size_t count;
+    while (0 < (count = beep_sequence_next(sequence, &tones))) {
+        if (tone_count == 0) {
+            first_ns = now_ns();
+        }
+        for (size_t k=0; k<count; ++k) {
+            freq_sum += tones[k].freq;
+        }
+        tone_count += count;
+    }
+    beep_sequence_free(sequence);
+    const uint64_t end_ns = now_ns();
+
+    printf("%-9s %8llu tones, first tones after %9.1f us, "
+           "%5.1f ns per tone, maxrss +%6ld KB (freq sum %llu)\n",
+           name, (unsigned long long)tone_count,
+           (double)(first_ns - start_ns) / 1000.0,
+           (double)(end_ns - start_ns) / (double)tone_count,
+           maxrss_kb() - start_kb, (unsigned long long)freq_sum);
+    return (tone_count == TONE_COUNT) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+int main(void)
+{
+    if (EXIT_SUCCESS != run("groups", "((A4:1/8b:0 C5:1/8b:0)x1000)x500")) {
+        return EXIT_FAILURE;
+    }
+
+    static const char phrase[] = "A4:1/8b:0 C5:1/8b:0 ";
+    const size_t phrase_len = strlen(phrase);
+    char *const source = malloc((TONE_COUNT / 2) * phrase_len + 1);
+    if (!source) {
+        perror("malloc");
+        return EXIT_FAILURE;
+    }
+    for (size_t i=0; i<(TONE_COUNT / 2); ++i) {
+        memcpy(&source[i * phrase_len], phrase, phrase_len);
+    }
+    source[(TONE_COUNT / 2) * phrase_len] = '\0';
+    const int retval = run("expanded", source);
+    free(source);
+    return retval;
+}
+
+
+/*
+ * Local Variables:
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -1,5 +1,20 @@
-if ${BEEP} -e /dev/tty0 -e /dev/tty1; then
-    :
-else
-    echo "Error"
-fi
+first="$(mktemp)"
+second="$(mktemp)"
+
+${BEEP} -e "trace:${first}" -e "trace:${second}" -f 440 -l 10 -r 2 -d 10
+
+for trace in "${first}" "${second}"; do
+    echo "records: $(expr "$(wc -c < "${trace}")" / 16)"
+    od -An -tu4 -w16 -j8 "${trace}" | while read event freq unused; do
+        echo "event ${event} freq ${freq}"
+    done
+done
+
+rm -f "${first}" "${second}"
+
+devices=()
+for i in $(seq 16); do
+    devices+=(-e trace:/dev/null)
+done
+${BEEP} "${devices[@]}" -f 440 -l 1 && echo "16 devices: ok"
+${BEEP} "${devices[@]}" -e trace:/dev/null -f 440 -l 1 || echo "17 devices: exit $?"
@@ -0,0 +1,10 @@
+trace="$(mktemp)"
+
+${BEEP} -e "trace:${trace}" -f 440 -l 10 -r 3 -d 10
+
+echo "records: $(expr "$(wc -c < "${trace}")" / 16)"
+od -An -tu4 -w16 -j8 "${trace}" | while read event freq unused; do
+    echo "event ${event} freq ${freq}"
+done
+
+rm -f "${trace}"
@@ -0,0 +1,11 @@
+wav="$(mktemp)"
+
+echo "pcm bytes: $(${BEEP} -e pcm:- -f 1000 -l 10 | wc -c)"
+
+${BEEP} -e "wav:${wav}" -f 1000 -l 10 -r 2 -d 5
+echo "wav bytes: $(wc -c < "${wav}")"
+od -An -c -N16 "${wav}"
+od -An -tu4 -j24 -N8 "${wav}"
+od -An -tu4 -j40 -N4 "${wav}"
+
+rm -f "${wav}"
@@ -0,0 +1,12 @@
+pwm="$(mktemp -d)"
+: > "${pwm}/period"
+: > "${pwm}/duty_cycle"
+: > "${pwm}/enable"
+
+${BEEP} --verbose -e "pwm:${pwm}" -f 1000 -l 10 -r 3 -d 10 -n -f 500 -l 10 2>&1 \
+    | sed -n 's/^.*\(pwm: [0-9]* attribute writes.*\)$/\1/p'
+echo "period: $(cat "${pwm}/period")"
+echo "duty_cycle: $(cat "${pwm}/duty_cycle")"
+echo "enable: $(cat "${pwm}/enable")"
+
+rm -rf "${pwm}"
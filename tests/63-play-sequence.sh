@@ -0,0 +1,19 @@
+# The PCM driver plays whole tone sequences itself.  Two PCM devices
+# are driven edge by edge through the fan-out driver instead, which
+# must give the very same samples.
+
+dir="$(mktemp -d)"
+
+tones=(-f 1000 -l 10 -r 3 -d 5 -n -f 0 -l 7 -n -f 523.25 -l 12 -D 3)
+
+${BEEP} -e "pcm:${dir}/sequence" "${tones[@]}"
+${BEEP} -e "pcm:${dir}/edge1" -e "pcm:${dir}/edge2" "${tones[@]}"
+
+echo "sequence bytes: $(wc -c < "${dir}/sequence")"
+for edge in edge1 edge2; do
+    if cmp "${dir}/sequence" "${dir}/${edge}"; then
+        echo "${edge}: same"
+    fi
+done
+
+rm -rf "${dir}"
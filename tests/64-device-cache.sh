@@ -0,0 +1,20 @@
+# Pretend an earlier beep has found /dev/null to be an evdev device,
+# which accepts the EV_SND writes just like the real thing.
+
+runtime="$(mktemp -d)"
+export XDG_RUNTIME_DIR="${runtime}"
+
+set -- $(stat -c '%t %T %i' /dev/null)
+printf 'evdev\n/dev/null\n%d:%d %d\n' "0x$1" "0x$2" "$3" > "${runtime}/beep-device"
+
+${BEEP} --verbose -f "${FREQ}" -l 1 2>&1 \
+    | sed -n -e 's/0x[0-9a-f]*/PTR/' -e 's/fd=[0-9]*/fd=FD/' \
+             -e '/device cache\|using driver/p'
+
+# A different inode means a different device file
+printf 'evdev\n/dev/null\n%d:%d %d\n' "0x$1" "0x$2" "$(expr "$3" + 1)" > "${runtime}/beep-device"
+
+${BEEP} --verbose -f "${FREQ}" -l 1 2>&1 \
+    | sed -n '/not the cached device/p'
+
+rm -rf "${runtime}"
@@ -0,0 +1,18 @@
+# /dev/null is a character device, but neither an evdev nor a console
+# device.  Both drivers must probe the same fd, opened only once.
+
+${BEEP} --verbose -e /dev/null -f "${FREQ}" -l 1 2>&1 \
+    | sed -n -e 's/0x[0-9a-f]*/PTR/' -e 's/ [0-9]*$/ FD/' \
+             -e '/opened\|driver_probe\|Error/p'
+
+# With a cached device, startup is open, read and close of the cache
+# file, plus open and fstat of the device.
+runtime="$(mktemp -d)"
+export XDG_RUNTIME_DIR="${runtime}"
+set -- $(stat -c '%t %T %i' /dev/null)
+printf 'evdev\n/dev/null\n%d:%d %d\n' "0x$1" "0x$2" "$3" > "${runtime}/beep-device"
+
+${BEEP} --verbose -f "${FREQ}" -l 1 2>&1 \
+    | sed -n '/system calls/p'
+
+rm -rf "${runtime}"
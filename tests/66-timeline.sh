@@ -0,0 +1,13 @@
+# --timeline writes one Chrome trace event per driver call, wait,
+# tone sequence and stdin read.  Nested spans come before the span
+# containing them, as each span is recorded when it ends.
+
+timeline="$(mktemp)"
+
+printf 'a\nb\n' | ${BEEP} -e trace:/dev/null --timeline="${timeline}" -l 1 -D 1 -s
+
+head -n 1 "${timeline}"
+grep -o '"name":"[a-z_]*","cat":"[a-z]*"' "${timeline}"
+tail -n 2 "${timeline}"
+
+rm -f "${timeline}"
@@ -0,0 +1,26 @@
+# Frequencies are rounded to whole Hz, and all values are checked
+# against the same limits as always.  Anything but white space after
+# a number is an error.
+
+trace="$(mktemp)"
+
+${BEEP} -e "trace:${trace}" -l 0 -f 523.25 -n -l 0 -f 1.5e3 -n -l 0 -f " 440" \
+        -n -l 0 -f 20000 -n -l 0 -f 0.5 -n -l +0 -f 439.5
+od -An -tu4 -w16 -j8 "${trace}" | while read event freq unused; do
+    if test "${event}" = 1; then
+        echo "freq ${freq}"
+    fi
+done
+
+for args in "-f 20000.5" "-f -1" "-f x" "-f ." "-l 300000 -r 0" "-l 300001" \
+            "-l 99999999999999999999" "-r -1" "-d 1e3" "-f 0x1F4" \
+            "-f 440Hz" "-f A4x" "-l 10ms" "-l 1/2bx" "-r 2x" "-D 5q" \
+            "--bpm=120x" "-f 440 -l 10 -r 2 -d 5"; do
+    if ${BEEP} -e "trace:${trace}" ${args} > /dev/null 2>&1; then
+        echo "accepted: ${args}"
+    else
+        echo "rejected: ${args}"
+    fi
+done
+
+rm -f "${trace}"
@@ -0,0 +1,33 @@
+# --score plays one tone per line from a file or from stdin.  Missing
+# lengths and delays default to the -l and -d options.
+
+score="$(mktemp)"
+trace="$(mktemp)"
+
+cat > "${score}" <<SCORE
+# comment lines and empty lines are skipped
+
+440 0 0
+  880.4
+523 0
+SCORE
+
+${BEEP} -e "trace:${trace}" -l 0 -d 0 --score="${score}"
+print_trace_freqs "${trace}"
+
+printf '1000 0 0\n2000 0 0' | ${BEEP} -e "trace:${trace}" --score=-
+print_trace_freqs "${trace}"
+
+printf '440 0 0\n440 x\n' | ${BEEP} -e "trace:${trace}" --score=-
+echo "exit $?"
+print_trace_freqs "${trace}"
+
+# Text scores may start with a B note, just like the binary magic
+printf 'B4 0 0\nA4 0 0\n' > "${score}"
+${BEEP} -e "trace:${trace}" --score="${score}"
+print_trace_freqs "${trace}"
+
+printf 'Bb3 0 0\nA4 0 0\n' | ${BEEP} -e "trace:${trace}" --score=-
+print_trace_freqs "${trace}"
+
+rm -f "${score}" "${trace}"
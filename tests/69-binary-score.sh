@@ -0,0 +1,49 @@
+# --export-score writes the tones to a binary score instead of playing
+# them, and --score plays binary scores from files and pipes.
+
+score="$(mktemp)"
+trace="$(mktemp)"
+
+${BEEP} --export-score="${score}" -f 440 -l 0 -d 0 -r 2 -n -f 880 -l 0
+od -An -tx1 -w8 "${score}"
+
+${BEEP} -e "trace:${trace}" --score="${score}"
+print_trace_freqs "${trace}"
+
+${BEEP} -e "trace:${trace}" --score=- < "${score}"
+print_trace_freqs "${trace}"
+
+cat "${score}" | ${BEEP} -e "trace:${trace}" --score=-
+print_trace_freqs "${trace}"
+
+printf '523 0 0\n659 0 0\n' | ${BEEP} --export-score="${score}" --score=-
+${BEEP} -e "trace:${trace}" --score="${score}"
+print_trace_freqs "${trace}"
+
+head -c 50 "${score}" | ${BEEP} -e "trace:${trace}" --score=-
+echo "exit $?"
+print_trace_freqs "${trace}"
+
+# Records are checked against the limits of the tone options
+header='BEEPSCOR\001\000\000\000\020\000\000\000\002\000\000\000\000\000\000\000'
+a4='\270\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000'
+printf "${header}${a4}"'\060\165\000\000\000\000\000\000\000\000\000\000\000\000\000\000' > "${score}"
+${BEEP} -e "trace:${trace}" --score=- < "${score}"
+echo "exit $?"
+print_trace_freqs "${trace}"
+printf "${header}${a4}"'\270\001\000\000\000\000\000\000\000\000\000\000\000\002\000\000' \
+    | ${BEEP} -e "trace:${trace}" --score=-
+echo "exit $?"
+print_trace_freqs "${trace}"
+
+# Scores written to pipes have no tone count and go on up to their end
+printf '523 0 0\n659 0 0\n' | ${BEEP} --export-score=- --score=- | cat > "${score}"
+od -An -tx1 -w8 -j16 -N8 "${score}"
+${BEEP} -e "trace:${trace}" --score="${score}"
+print_trace_freqs "${trace}"
+printf '440 0 0\n' | ${BEEP} --export-score=- --score=- \
+    | ${BEEP} -e "trace:${trace}" --score=-
+echo "exit $?"
+print_trace_freqs "${trace}"
+
+rm -f "${score}" "${trace}"
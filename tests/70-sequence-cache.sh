@@ -0,0 +1,50 @@
+# Long command lines are compiled into the sequence cache and played
+# from there the next time, with the same tones.  Entries written by
+# another cache format version are replaced.
+
+cache="$(mktemp -d)"
+trace="$(mktemp)"
+
+args=""
+for freq in $(seq 100 100 2000); do
+    args="${args} -f ${freq} -l 0 -d 0 -n"
+done
+args="${args} -f 3000 -l 0 -r 2"
+
+count_tones() {
+    print_trace_freqs "${trace}" \
+        | awk '{ n++; sum += $2 } END { print n " tones, sum " sum " Hz" }'
+}
+
+for run in first second; do
+    XDG_CACHE_HOME="${cache}" ${BEEP} -e "trace:${trace}" ${args}
+    echo "${run} run: $(count_tones), $(ls "${cache}/beep" | wc -l) cache entries"
+done
+
+entry="$(ls "${cache}"/beep/*)"
+printf '\377' | dd of="${entry}" bs=1 seek=8 conv=notrunc 2> /dev/null
+XDG_CACHE_HOME="${cache}" ${BEEP} -e "trace:${trace}" ${args}
+echo "other version: $(count_tones), $(ls "${cache}/beep" | wc -l) cache entries"
+od -An -tu4 -j8 -N4 "${entry}"
+
+# Entries written by another beep version are replaced as well
+package_hash="$(od -An -tx4 -j156 -N4 "${entry}")"
+printf '\377\377\377\377' | dd of="${entry}" bs=1 seek=156 conv=notrunc 2> /dev/null
+XDG_CACHE_HOME="${cache}" ${BEEP} -e "trace:${trace}" ${args}
+echo "other beep: $(count_tones), $(ls "${cache}/beep" | wc -l) cache entries"
+test "$(od -An -tx4 -j156 -N4 "${entry}")" = "${package_hash}" && echo "rewritten"
+
+# Writing an entry removes entries not written for 30 days, then the
+# oldest ones beyond 256 entries, but not entries other beeps are
+# still writing.
+rm -f "${cache}"/beep/*
+touch -d '2000-01-01' "${cache}/beep/0000000000000000"
+touch -d "@$(( $(date +%s) - 100000 ))" "${cache}/beep/0000000000000001.12345"
+for i in $(seq 1000 1299); do
+    touch -d "@$(( $(date +%s) - 100000 + i ))" "${cache}/beep/000000000000${i}"
+done
+XDG_CACHE_HOME="${cache}" ${BEEP} -e "trace:${trace}" ${args}
+echo "pruned: $(count_tones), $(ls "${cache}/beep" | wc -l) cache entries"
+ls "${cache}/beep" | head -n 2
+
+rm -rf "${cache}" "${trace}"
@@ -0,0 +1,20 @@
+# -f takes note names, and -l, -d and -D take durations in beats at
+# the --bpm tempo.  The milliseconds of triplets are 166 or 167 with
+# the remainder carried over, so that no rounding drift accumulates.
+
+score="$(mktemp)"
+
+${BEEP} --export-score="${score}" -f A4 -l 1/3b -d 1/3b -r 3 -n -f C#5 -l 1b -n -f Bb3 -l 100 -D 1/2b --bpm=120
+print_score_tones "${score}"
+
+printf 'A4 1/4b 1/4b\nC-1\nG9 0\n440 0 0\n' | ${BEEP} --export-score="${score}" --bpm=60 -l 1b -d 0 --score=-
+print_score_tones "${score}"
+
+${BEEP} --export-score="${score}" -f H4 > /dev/null
+echo "exit $?"
+${BEEP} --export-score="${score}" -f A4 -l 65b > /dev/null
+echo "exit $?"
+${BEEP} --export-score="${score}" -f A4 --bpm=10 > /dev/null
+echo "exit $?"
+
+rm -f "${score}"
@@ -0,0 +1,18 @@
+# --sequence runs a program of tones and nested repeat groups, with
+# missing lengths and delays from the -l and -d options.
+
+score="$(mktemp)"
+
+${BEEP} --export-score="${score}" -d 10 \
+        --sequence='(A4:100 523:100:0)x2 R:50 ((440:1/3b:0)x3 880:0)x2'
+print_score_tones "${score}"
+
+${BEEP} --export-score="${score}" --sequence='((A4:0:0 C5:0:0)x1000)x500'
+od -An -tu8 -j16 -N8 "${score}"
+
+for program in '(A4' 'A4)' '()x3' '(A4)x0' '(A4)y' 'H4' 'A4:100:5:3' ''; do
+    ${BEEP} --export-score="${score}" --sequence="${program}"
+    echo "exit $?"
+done
+
+rm -f "${score}"
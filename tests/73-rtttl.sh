@@ -0,0 +1,31 @@
+# --rtttl reads RTTTL ringtones, one per line, with the d=, o= and b=
+# defaults applied to the notes without their own duration or octave.
+
+tmp="$(mktemp -d)"
+score="${tmp}/score"
+input="ringtones.txt"
+cd "${tmp}"
+
+printf 'Test:d=4,o=5,b=120:8c,c#6,8p,2a.,16b4,32h\nTwo : b=100 : e\n' > "${input}"
+${BEEP} --export-score="${score}" --rtttl="${input}"
+print_score_tones "${score}"
+
+printf 'Stdin:d=8,o=4,b=240:g,4f#' | ${BEEP} --export-score="${score}" --rtttl=-
+print_score_tones "${score}"
+
+# A sharp b is the C of the next octave, not a pause
+echo 'Sharp:d=4,o=5,b=120:b#,h#4,c6' > "${input}"
+${BEEP} --export-score="${score}" --rtttl="${input}"
+print_score_tones "${score}"
+
+for ringtone in 'Name' 'Name:d=4' 'Name:x=4:c' 'Name:b=5:c' 'Name:d=3:c' 'Name:d=4:c,q' 'Name:d=4:c##' 'Name:d=4:p#'; do
+    echo "${ringtone}" > "${input}"
+    ${BEEP} --export-score="${score}" --rtttl="${input}"
+    echo "exit $?"
+done
+
+${BEEP} --rtttl="${input}" --sequence=A4
+echo "exit $?"
+
+cd /
+rm -rf "${tmp}"
@@ -0,0 +1,22 @@
+raw="$(mktemp)"
+
+# Many short tones of different frequencies make many segments, so the
+# chunks start inside tones and in the middle of the repetitions.
+args=(-f 440 -l 70 -D 13)
+for f in 523 587 659 698 784 880 988 1047; do
+    args+=(-n -f "$f" -l 97 -r 3 -d 31)
+done
+
+for threads in 1 2 3 7; do
+    BEEP_PCM_THREADS="$threads" ${BEEP} -e "pcm:${raw}" "${args[@]}"
+    if ${BEEP} -e pcm:- "${args[@]}" | cat | cmp - "${raw}"; then
+        echo "threads $threads: identical ($(wc -c < "${raw}") bytes)"
+    else
+        echo "threads $threads: different"
+    fi
+done
+
+BEEP_PCM_THREADS=3 ${BEEP} --verbose -e "pcm:${raw}" "${args[@]}" 2>&1 \
+    | grep -o 'rendering .* threads'
+
+rm -f "${raw}"